@@ -0,0 +1,139 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#define ALLOC_IMPLEMENTATION
+#include "alloc.hh"
+#include <stdio.h>
+#include <string.h>
+
+AllocAccounting allocAccounting;
+
+const char* const allocEventNames[NUM_ALLOC_EVENTS] = {"Startup", "Key", "Update", "Idle", "Mouse", "Menu", "Other"};
+
+AllocAccounting::AllocAccounting()
+{
+	current = AllocStartup;
+	setupDepth = 0;
+	steady = 0;
+	memset(counts, 0, sizeof(counts));
+	memset(totals, 0, sizeof(totals));
+}
+
+AllocEvent AllocAccounting::eventFor(short what)
+{
+	switch (what)
+	{
+		case nullEvent:
+			return AllocIdle;
+		case keyDown:
+		case autoKey:
+			return AllocKey;
+		case updateEvt:
+			return AllocUpdate;
+		case mouseDown:
+		case mouseUp:
+			return AllocMouse;
+		default:
+			return AllocOther;
+	}
+}
+
+void AllocAccounting::setEvent(AllocEvent event)
+{
+	current = event;
+}
+
+// Setup brackets nest, so a window opened while an offscreen is rebuilt stays setup
+void AllocAccounting::beginSetup()
+{
+	setupDepth++;
+}
+
+void AllocAccounting::endSetup()
+{
+	if (setupDepth > 0)
+	{
+		setupDepth--;
+	}
+}
+
+void AllocAccounting::counted(long bytes)
+{
+	counts[current]++;
+	totals[current] += bytes;
+
+	if (setupDepth == 0 && (current == AllocKey || current == AllocUpdate || current == AllocIdle))
+	{
+		steady++;
+	}
+}
+
+unsigned long AllocAccounting::count(AllocEvent event)
+{
+	return counts[event];
+}
+
+unsigned long AllocAccounting::bytes(AllocEvent event)
+{
+	return totals[event];
+}
+
+// Allocations made while typing, drawing or idle outside any setup; should stay at zero
+unsigned long AllocAccounting::steadyCount()
+{
+	return steady;
+}
+
+BOOL AllocAccounting::save(const char* path)
+{
+	FILE* file = fopen(path, "w");
+	if (file == NULL)
+	{
+		return FALSE;
+	}
+
+	fprintf(file, "Event\tAllocations\tBytes\n");
+	for (int event = 0; event < NUM_ALLOC_EVENTS; event++)
+	{
+		fprintf(file, "%s\t%lu\t%lu\n", allocEventNames[event], counts[event], totals[event]);
+	}
+	fprintf(file, "Steady state\t%lu\n", steady);
+
+	BOOL ok = !ferror(file);
+	fclose(file);
+	return ok;
+}
+
+#if ALLOC_ACCOUNTING
+
+// The Memory Manager is what C++ allocations come from on the Mac anyway
+void* operator new(size_t size)
+{
+	allocAccounting.counted(size);
+	return NewPtr(size);
+}
+
+void operator delete(void* p)
+{
+	if (p)
+	{
+		DisposePtr((Ptr)p);
+	}
+}
+
+#endif
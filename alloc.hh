@@ -0,0 +1,182 @@
+#ifndef ALLOC_HH
+#define ALLOC_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include <MacMemory.h>
+#include <MacWindows.h>
+#include <QDOffscreen.h>
+#include <Events.h>
+#include "engine.hh"
+#include "budget.hh"
+
+// Build with ALLOC_ACCOUNTING defined as 1 to count the game's heap allocations by the kind of
+// event being handled. Include this header last, since it redefines the allocating calls.
+#ifndef ALLOC_ACCOUNTING
+#define ALLOC_ACCOUNTING (0)
+#endif
+
+#define ALLOC_FILE_NAME "MacWords Allocations"
+
+enum AllocEvent
+{
+	AllocStartup,
+	AllocKey,
+	AllocUpdate,
+	AllocIdle,
+	AllocMouse,
+	// Menu commands, whether chosen with the mouse or a command key
+	AllocMenu,
+	AllocOther,
+	NUM_ALLOC_EVENTS
+};
+
+// Typing, drawing and idle time must not allocate once the game is up. Allocations they
+// legitimately cause, such as rebuilding an offscreen or opening the Score window, are
+// bracketed as setup and don't count against that.
+class AllocAccounting
+{
+public:
+	AllocAccounting();
+
+	void setEvent(AllocEvent event);
+	void beginSetup();
+	void endSetup();
+	void counted(long bytes);
+
+	unsigned long count(AllocEvent event);
+	unsigned long bytes(AllocEvent event);
+	unsigned long steadyCount();
+	BOOL save(const char* path);
+
+	static AllocEvent eventFor(short what);
+
+private:
+	AllocEvent current;
+	short setupDepth;
+	unsigned long counts[NUM_ALLOC_EVENTS];
+	unsigned long totals[NUM_ALLOC_EVENTS];
+	unsigned long steady;
+};
+
+extern AllocAccounting allocAccounting;
+extern const char* const allocEventNames[NUM_ALLOC_EVENTS];
+
+#if ALLOC_ACCOUNTING
+
+#define ACCOUNT_EVENT(event) allocAccounting.setEvent(event)
+#define ALLOC_SETUP_BEGIN() allocAccounting.beginSetup()
+#define ALLOC_SETUP_END() allocAccounting.endSetup()
+
+#ifndef ALLOC_IMPLEMENTATION
+
+inline Handle accountedNewHandle(Size size)
+{
+	allocAccounting.counted(size);
+	return NewHandle(size);
+}
+
+inline Handle accountedNewHandleClear(Size size)
+{
+	allocAccounting.counted(size);
+	return NewHandleClear(size);
+}
+
+inline Ptr accountedNewPtr(Size size)
+{
+	allocAccounting.counted(size);
+	return NewPtr(size);
+}
+
+inline Ptr accountedNewPtrClear(Size size)
+{
+	allocAccounting.counted(size);
+	return NewPtrClear(size);
+}
+
+inline RgnHandle accountedNewRgn()
+{
+	allocAccounting.counted(sizeof(Region));
+	return NewRgn();
+}
+
+inline PixPatHandle accountedNewPixPat()
+{
+	allocAccounting.counted(sizeof(PixPat));
+	return NewPixPat();
+}
+
+inline PicHandle accountedOpenPicture(const Rect* frame)
+{
+	allocAccounting.counted(sizeof(Picture));
+	return OpenPicture(frame);
+}
+
+inline QDErr accountedNewGWorld(GWorldPtr* world, short depth, const Rect* bounds, CTabHandle table, GDHandle device, GWorldFlags flags)
+{
+	allocAccounting.counted(MemoryBudget::offscreenBytes(bounds->right - bounds->left, bounds->bottom - bounds->top, depth));
+	return NewGWorld(world, depth, bounds, table, device, flags);
+}
+
+// Only counted when the pixels had to be reallocated
+inline GWorldFlags accountedUpdateGWorld(GWorldPtr* world, short depth, const Rect* bounds, CTabHandle table, GDHandle device, GWorldFlags flags)
+{
+	GWorldFlags result = UpdateGWorld(world, depth, bounds, table, device, flags);
+	if (result & reallocPix)
+	{
+		allocAccounting.counted(MemoryBudget::offscreenBytes(bounds->right - bounds->left, bounds->bottom - bounds->top, depth));
+	}
+	return result;
+}
+
+inline WindowPtr accountedGetNewWindow(short id, void* storage, WindowPtr behind)
+{
+	allocAccounting.counted(sizeof(WindowRecord));
+	return GetNewWindow(id, storage, behind);
+}
+
+inline WindowPtr accountedGetNewCWindow(short id, void* storage, WindowPtr behind)
+{
+	allocAccounting.counted(sizeof(CWindowRecord));
+	return GetNewCWindow(id, storage, behind);
+}
+
+#define NewHandle(size) accountedNewHandle(size)
+#define NewHandleClear(size) accountedNewHandleClear(size)
+#define NewPtr(size) accountedNewPtr(size)
+#define NewPtrClear(size) accountedNewPtrClear(size)
+#define NewRgn() accountedNewRgn()
+#define NewPixPat() accountedNewPixPat()
+#define OpenPicture(frame) accountedOpenPicture(frame)
+#define NewGWorld(world, depth, bounds, table, device, flags) accountedNewGWorld(world, depth, bounds, table, device, flags)
+#define UpdateGWorld(world, depth, bounds, table, device, flags) accountedUpdateGWorld(world, depth, bounds, table, device, flags)
+#define GetNewWindow(id, storage, behind) accountedGetNewWindow(id, storage, behind)
+#define GetNewCWindow(id, storage, behind) accountedGetNewCWindow(id, storage, behind)
+
+#endif
+
+#else
+
+#define ACCOUNT_EVENT(event) ((void)0)
+#define ALLOC_SETUP_BEGIN() ((void)0)
+#define ALLOC_SETUP_END() ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,368 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+#include "analysis.hh"
+#include <MacMemory.h>
+#include <string.h>
+
+static const unsigned char patternWeights[WORD_LENGTH] = {81, 27, 9, 3, 1};
+
+// Encodes the colours a guess would receive against an answer as a base 3 number
+unsigned char scorePattern(const char* guess, const char* answer)
+{
+	unsigned char remaining[ALPHABET_LENGTH];
+	unsigned char pattern = 0;
+	BOOL matched[WORD_LENGTH];
+	int i;
+
+	memset(remaining, 0, sizeof(remaining));
+
+	for (i = 0; i < WORD_LENGTH; i++)
+	{
+		matched[i] = (guess[i] == answer[i]);
+		if (matched[i])
+		{
+			pattern += 2 * patternWeights[i];
+		}
+		else
+		{
+			remaining[answer[i] - 'A']++;
+		}
+	}
+
+	for (i = 0; i < WORD_LENGTH; i++)
+	{
+		if (!matched[i] && remaining[guess[i] - 'A'] > 0)
+		{
+			remaining[guess[i] - 'A']--;
+			pattern += patternWeights[i];
+		}
+	}
+
+	return pattern;
+}
+
+// log2(x) in 16.16 fixed point, avoiding the FPU which many 68k machines lack
+unsigned long fixedLog2(unsigned long x)
+{
+	unsigned long result = 0;
+
+	if (x <= 1)
+	{
+		return 0;
+	}
+
+	// Integer part
+	unsigned long mantissa = x;
+	while (mantissa >= 2)
+	{
+		mantissa >>= 1;
+		result += 0x10000L;
+	}
+
+	// Normalize x into [1, 2) with 15 fractional bits
+	int shift = result >> 16;
+	if (shift > 15)
+	{
+		mantissa = x >> (shift - 15);
+	}
+	else
+	{
+		mantissa = x << (15 - shift);
+	}
+
+	// Fractional part, one bit per squaring
+	for (unsigned long bit = 0x8000L; bit != 0; bit >>= 1)
+	{
+		mantissa = (mantissa * mantissa) >> 15;
+		if (mantissa >= (2L << 15))
+		{
+			mantissa >>= 1;
+			result |= bit;
+		}
+	}
+
+	return result;
+}
+
+GameAnalysis::GameAnalysis()
+{
+	memset(buckets, 0, sizeof(buckets));
+	numTouched = 0;
+	reset();
+}
+
+// Starts over with every daily word a candidate, for a new game
+void GameAnalysis::reset()
+{
+	numRows = 0;
+	count = NUM_DAILY_WORDS;
+
+	for (short i = 0; i < NUM_DAILY_WORDS; i++)
+	{
+		candidates[i] = i;
+	}
+
+	stage = AnalysisGuess;
+	scanned = 0;
+	kept = 0;
+
+	// A step stopped part way through scoring leaves counts behind
+	for (short t = 0; t < numTouched; t++)
+	{
+		buckets[touched[t]] = 0;
+	}
+	numTouched = 0;
+}
+
+// Does at most ANALYSIS_STEP_WORK scorings. Returns TRUE once every guess made so far is analysed.
+BOOL GameAnalysis::step(Engine* engine)
+{
+	Handle dailyWords = engine->getDailyWords();
+	if (dailyWords == NULL || numRows >= engine->numGuesses)
+	{
+		return TRUE;
+	}
+
+	HLock(dailyWords);
+	const char* words = *dailyWords;
+
+	GuessAnalysis* row = &rows[numRows];
+	const char* guess = engine->guesses[numRows];
+
+	switch (stage)
+	{
+		case AnalysisGuess:
+			if (scanned == 0)
+			{
+				memcpy(row->guess, guess, WORD_LENGTH);
+				row->guess[WORD_LENGTH] = '\0';
+				row->candidatesBefore = count;
+			}
+
+			if (scoreChunk(guess, words))
+			{
+				guessSum = bucketSum();
+				row->expectedBits = expectedBits(guessSum, count);
+
+				if (count == NUM_DAILY_WORDS)
+				{
+					strcpy(row->bestGuess, ANALYSIS_OPENER);
+					row->bestBits = ANALYSIS_OPENER_BITS;
+					stage = AnalysisFilter;
+				}
+				else
+				{
+					startPool();
+					stage = AnalysisPool;
+				}
+			}
+			break;
+
+		case AnalysisPool:
+		{
+			short candidate = candidates[poolNext * poolStride];
+			if (scoreChunk(words + candidate * (WORD_LENGTH + 1), words))
+			{
+				unsigned long sum = bucketSum();
+				if (sum < bestSum)
+				{
+					bestSum = sum;
+					bestWord = candidate;
+				}
+
+				if (++poolNext == poolSize)
+				{
+					const char* best = (bestWord < 0) ? guess : words + bestWord * (WORD_LENGTH + 1);
+					memcpy(row->bestGuess, best, WORD_LENGTH);
+					row->bestGuess[WORD_LENGTH] = '\0';
+					row->bestBits = expectedBits(bestSum, count);
+					stage = AnalysisFilter;
+				}
+			}
+			break;
+		}
+
+		case AnalysisFilter:
+			if (filterChunk(guess, guessPattern(engine), words))
+			{
+				count = kept;
+				row->candidatesAfter = count;
+
+				if (count > 0)
+				{
+					row->bitsGained = (short)(((fixedLog2(row->candidatesBefore) - fixedLog2(count)) * 100 + 0x8000L) >> 16);
+				}
+				else
+				{
+					row->bitsGained = 0;
+				}
+
+				numRows++;
+				stage = AnalysisGuess;
+			}
+			break;
+	}
+
+	HUnlock(dailyWords);
+
+	return numRows >= engine->numGuesses;
+}
+
+// Catches up with every guess made so far
+void GameAnalysis::analyze(Engine* engine)
+{
+	while (!step(engine))
+	{
+	}
+}
+
+// Sample the remaining candidates as guesses so the work stays bounded. The guess actually
+// played competes too, so a sampled pool never reports worse than it.
+void GameAnalysis::startPool()
+{
+	poolSize = count;
+	if ((long)count * count > ANALYSIS_MAX_WORK)
+	{
+		poolSize = ANALYSIS_MAX_WORK / count;
+		if (poolSize < 1)
+		{
+			poolSize = 1;
+		}
+	}
+	poolStride = count / poolSize;
+	poolNext = 0;
+
+	bestSum = guessSum;
+	bestWord = -1;
+}
+
+// Scores a guess against the next candidates into the pattern buckets. Returns TRUE once
+// every candidate has been scored.
+BOOL GameAnalysis::scoreChunk(const char* guess, const char* words)
+{
+	short end = scanned + ANALYSIS_STEP_WORK;
+	if (end > count)
+	{
+		end = count;
+	}
+
+	for (; scanned < end; scanned++)
+	{
+		unsigned char pattern = scorePattern(guess, words + candidates[scanned] * (WORD_LENGTH + 1));
+		if (buckets[pattern] == 0)
+		{
+			touched[numTouched++] = pattern;
+		}
+		buckets[pattern]++;
+	}
+
+	if (scanned < count)
+	{
+		return FALSE;
+	}
+
+	scanned = 0;
+	return TRUE;
+}
+
+// Returns the sum of c * log2(c) over the pattern buckets and empties them
+unsigned long GameAnalysis::bucketSum()
+{
+	unsigned long sum = 0;
+	for (short t = 0; t < numTouched; t++)
+	{
+		unsigned short c = buckets[touched[t]];
+		sum += c * fixedLog2(c);
+		buckets[touched[t]] = 0;
+	}
+	numTouched = 0;
+
+	return sum;
+}
+
+// Keeps only the candidates that would have produced the same pattern, in place
+BOOL GameAnalysis::filterChunk(const char* guess, unsigned char pattern, const char* words)
+{
+	if (scanned == 0)
+	{
+		kept = 0;
+	}
+
+	short end = scanned + ANALYSIS_STEP_WORK;
+	if (end > count)
+	{
+		end = count;
+	}
+
+	for (; scanned < end; scanned++)
+	{
+		if (scorePattern(guess, words + candidates[scanned] * (WORD_LENGTH + 1)) == pattern)
+		{
+			candidates[kept++] = candidates[scanned];
+		}
+	}
+
+	if (scanned < count)
+	{
+		return FALSE;
+	}
+
+	scanned = 0;
+	return TRUE;
+}
+
+// The engine's scores are the pattern the guess actually received
+unsigned char GameAnalysis::guessPattern(Engine* engine)
+{
+	unsigned char pattern = 0;
+	for (int i = 0; i < WORD_LENGTH; i++)
+	{
+		letterScore score = engine->scores[numRows][i];
+		if (score == Correct)
+		{
+			pattern += 2 * patternWeights[i];
+		}
+		else if (score == WrongPos)
+		{
+			pattern += patternWeights[i];
+		}
+	}
+
+	return pattern;
+}
+
+// Expected information of a guess is log2(n) - sum(c * log2(c)) / n
+short GameAnalysis::expectedBits(unsigned long bucketSum, short count)
+{
+	if (count <= 0)
+	{
+		return 0;
+	}
+
+	unsigned long total = fixedLog2(count);
+	unsigned long average = bucketSum / count;
+
+	if (average >= total)
+	{
+		return 0;
+	}
+
+	unsigned long bits = total - average;
+
+	return (short)((bits * 100 + 0x8000L) >> 16);
+}
@@ -0,0 +1,101 @@
+#ifndef ANALYSIS_HH
+#define ANALYSIS_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+#include "engine.hh"
+
+// Number of distinct colour patterns a guess can produce (3 ^ WORD_LENGTH)
+#define NUM_PATTERNS (243)
+
+// Upper bound on guess * candidate scorings spent looking for the best guess of one round
+#define ANALYSIS_MAX_WORK (8192L)
+
+// Candidates scored by one step of an analysis running in idle time
+#define ANALYSIS_STEP_WORK (256)
+
+// Best opening guess against the full daily list, precomputed since searching it is too slow
+#define ANALYSIS_OPENER "RAISE"
+#define ANALYSIS_OPENER_BITS (588)
+
+// Information values are stored in hundredths of a bit
+struct GuessAnalysis
+{
+	char guess[WORD_LENGTH + 1];
+	short candidatesBefore;
+	short candidatesAfter;
+	short bitsGained;
+	short expectedBits;
+	short bestBits;
+	char bestGuess[WORD_LENGTH + 1];
+};
+
+// Where a step left off within the current guess
+enum AnalysisStage
+{
+	AnalysisGuess,
+	AnalysisPool,
+	AnalysisFilter
+};
+
+// Follows one engine's game a guess at a time. Work can be done in small steps during idle
+// time, and analyze finishes whatever is left when the results are wanted.
+class GameAnalysis
+{
+public:
+	GameAnalysis();
+
+	void reset();
+	BOOL step(Engine* engine);
+	void analyze(Engine* engine);
+
+	int numRows;
+	GuessAnalysis rows[NUM_OF_GUESSES];
+
+private:
+	BOOL scoreChunk(const char* guess, const char* words);
+	unsigned long bucketSum();
+	BOOL filterChunk(const char* guess, unsigned char pattern, const char* words);
+	void startPool();
+	unsigned char guessPattern(Engine* engine);
+	short expectedBits(unsigned long bucketSum, short count);
+
+	short candidates[NUM_DAILY_WORDS];
+	short count;
+
+	AnalysisStage stage;
+	short scanned;
+	short kept;
+
+	unsigned long guessSum;
+	unsigned long bestSum;
+	// Index of the best guess found in the daily list, or -1 for the guess played
+	short bestWord;
+	short poolNext;
+	short poolSize;
+	short poolStride;
+
+	unsigned short buckets[NUM_PATTERNS];
+	unsigned char touched[NUM_PATTERNS];
+	short numTouched;
+};
+
+unsigned char scorePattern(const char* guess, const char* answer);
+unsigned long fixedLog2(unsigned long x);
+
+#endif
@@ -0,0 +1,170 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "animation.hh"
+#include <Events.h>
+#include "board.hh"
+
+Animator animator;
+
+Animator::Animator()
+{
+	numAnimations = 0;
+}
+
+// With no room left the animation is not shown at all, which is only visual
+void Animator::start(Board* board, AnimationKind kind, short row, short col, short delay, short duration)
+{
+	if (numAnimations >= MAX_ANIMATIONS)
+	{
+		board->endAnimation(kind, row, col);
+		return;
+	}
+
+	Animation* a = &animations[numAnimations++];
+	a->board = board;
+	a->kind = kind;
+	a->row = row;
+	a->col = col;
+	a->start = TickCount() + delay;
+	a->lastFrame = 0;
+	a->duration = duration;
+}
+
+// Jump a board's animations to their end, such as when a new guess starts revealing
+void Animator::finish(Board* board)
+{
+	int i = 0;
+	while (i < numAnimations)
+	{
+		if (animations[i].board == board)
+		{
+			Animation done = animations[i];
+			remove(i);
+			board->endAnimation(done.kind, done.row, done.col);
+		}
+		else
+		{
+			i++;
+		}
+	}
+}
+
+// For boards being deleted, which must not be called back
+void Animator::cancel(Board* board)
+{
+	int i = 0;
+	while (i < numAnimations)
+	{
+		if (animations[i].board == board)
+		{
+			remove(i);
+		}
+		else
+		{
+			i++;
+		}
+	}
+}
+
+// Called on every pass of the main loop. Progress comes from the tick count, so a frame that
+// is skipped or late is simply dropped rather than slowing the animation down.
+void Animator::step()
+{
+	if (numAnimations == 0)
+	{
+		return;
+	}
+
+	long now = TickCount();
+
+	// Pending input always comes first
+	EventRecord pending;
+	BOOL inputPending = EventAvail(keyDownMask | autoKeyMask | mDownMask, &pending);
+
+	int i = 0;
+	while (i < numAnimations)
+	{
+		Animation* a = &animations[i];
+		long elapsed = now - a->start;
+
+		if (elapsed < 0)
+		{
+			i++;
+			continue;
+		}
+
+		if (elapsed >= a->duration)
+		{
+			Animation done = *a;
+			remove(i);
+			done.board->endAnimation(done.kind, done.row, done.col);
+			continue;
+		}
+
+		// Animations left over when the budget runs out are due first on the next step
+		if (!inputPending && now - a->lastFrame >= ANIMATION_FRAME_TICKS &&
+			TickCount() - now < ANIMATION_BUDGET_TICKS)
+		{
+			a->board->drawAnimation(a->kind, a->row, a->col, (short)((elapsed * ANIMATION_STEPS) / a->duration));
+			a->lastFrame = now;
+		}
+
+		i++;
+	}
+}
+
+// How long WaitNextEvent may sleep without missing a frame, the start of a staggered
+// animation or the end of one
+long Animator::sleepTicks()
+{
+	long now = TickCount();
+	long sleep = 10L;
+
+	for (int i = 0; i < numAnimations; i++)
+	{
+		Animation* a = &animations[i];
+		long due;
+
+		if (now < a->start)
+		{
+			due = a->start;
+		}
+		else
+		{
+			due = a->lastFrame + ANIMATION_FRAME_TICKS;
+			if (a->start + a->duration < due)
+			{
+				due = a->start + a->duration;
+			}
+		}
+
+		if (due - now < sleep)
+		{
+			sleep = due - now;
+		}
+	}
+
+	return (sleep < 0) ? 0 : sleep;
+}
+
+void Animator::remove(int index)
+{
+	numAnimations--;
+	animations[index] = animations[numAnimations];
+}
@@ -0,0 +1,85 @@
+#ifndef ANIMATION_HH
+#define ANIMATION_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include <MacTypes.h>
+#include "engine.hh"
+
+// Progress is passed to the board as 0 to ANIMATION_STEPS, so frames need no FPU
+#define ANIMATION_STEPS (256)
+
+// Most animations running at once across all windows; a reveal takes one per tile
+#define MAX_ANIMATIONS (16)
+
+// Ticks between frames of one animation, about 30 frames a second
+#define ANIMATION_FRAME_TICKS (2)
+
+// Ticks one step of the scheduler may spend drawing before it leaves the rest for later
+#define ANIMATION_BUDGET_TICKS (1)
+
+// Lengths in ticks
+#define POP_TICKS (6)
+#define SHAKE_TICKS (24)
+#define REVEAL_TICKS (12)
+#define REVEAL_STAGGER_TICKS (9)
+
+class Board;
+
+enum AnimationKind
+{
+	PopAnimation,
+	ShakeAnimation,
+	RevealAnimation
+};
+
+struct Animation
+{
+	Board* board;
+	AnimationKind kind;
+	short row;
+	short col;
+	long start;
+	long lastFrame;
+	short duration;
+};
+
+// Animations are purely visual. The engine is updated before they start, and a board that
+// cannot draw a frame simply skips it; endAnimation always brings it to the final state.
+class Animator
+{
+public:
+	Animator();
+
+	void start(Board* board, AnimationKind kind, short row, short col, short delay, short duration);
+	void finish(Board* board);
+	void cancel(Board* board);
+	void step();
+	long sleepTicks();
+
+private:
+	void remove(int index);
+
+	Animation animations[MAX_ANIMATIONS];
+	int numAnimations;
+};
+
+extern Animator animator;
+
+#endif
@@ -23,384 +23,1478 @@
 #include <Sound.h>
 
 #include "windows.hh"
+#include "trace.hh"
+#include "timing.hh"
+#include "idle.hh"
+#include "alloc.hh"
 
-#define MIN(a,b) (((a)<(b))?(a):(b))
 #define MAX(a,b) (((a)>(b))?(a):(b))
 
-#define ROUND_RECT_SZ (5)
+// Never a real tile letter, so a cell marked with it is repainted by the next draw
+#define DIRTY_LETTER ((char)1)
 
-static char* keyboard[] = {"QWERTYUIOP", "ASDFGHJKL", "\nZXCVBNM\b", nil};
+// Colour table for indexed offscreen worlds, holding exactly the board palette
+static CTabHandle boardColorTable = NULL;
+
+BOOL Board::indexedOffscreen = TRUE;
 
 Board::Board(WindowPtr w)
 {
 	window = w;
 	type = BoardWindow;
 
-	lastPortRect.right = 0;
-	lastPortRect.left = 0;
-	lastPortRect.top = 0;
-	lastPortRect.bottom = 0;
+	fontsValid = FALSE;
+
+	numScreens = 0;
+	active = TRUE;
+	renderer = windowRenderer();
+
+	monoBits = NULL;
+	monoRowBytes = 0;
+	memset(&monoScreen, 0, sizeof(ScreenWorld));
+	monoScreen.fullRedraw = TRUE;
+	revealRow = -1;
+	revealed = 0;
+
+	analysis = new GameAnalysis;
+	if (analysis)
+	{
+		memoryBudget.allocated(MemoryAnalysis, sizeof(GameAnalysis));
+	}
+
+	memoryBudget.addConsumer(MemoryAnalysis, purgeAnalysis, NULL, this);
+	memoryBudget.addConsumer(MemoryAtlases, purgeAtlases, ownsAtlas, this);
+	memoryBudget.addConsumer(MemoryOffscreens, purgeOffscreens, ownsOffscreen, this);
+
+	init();
+	clear();
+}
+
+Board::~Board()
+{
+	cleanup();
+}
+
+Rect Board::calculateVisibleRect(Rect r)
+{
+	r.right -= 16;
+	r.bottom -= 16;
+	return r;
+}
+
+// Draw one screen's part of the board in its offscreen GWorld, or straight into the window when
+// it has none. Only keys and tiles whose letter or colour changed since the last draw are repainted.
+void Board::draw_board(ScreenWorld* screen)
+{
+	CGrafPtr origPort;
+	GDHandle origDev;
+	GrafPtr origClassicPort;
+
+	// Monochrome mode can't use the GWorld calls, which need Color QuickDraw
+	if (monochromeMode)
+	{
+		GetPort(&origClassicPort);
+		if (monoBits)
+		{
+			SetPort(&monoPort);
+		}
+	}
+	else
+	{
+		GetGWorld(&origPort, &origDev);
+		if (screen->world) {
+			SetGWorld(screen->world, NULL);
+		}
+	}
+
+	Rect contentRect = screen->bounds;
+	BOOL fullRedraw = screen->fullRedraw;
+
+	if (fullRedraw) {
+		renderer->eraseRect(&contentRect);
+	}
+
+	short keySize = layout.keySize;
+	short tileSize = layout.tileSize;
+
+	frameTimer.begin(PhaseFonts);
+
+	if (!fontsValid)
+	{
+		painter.buildFonts(renderer, keySize, tileSize);
+		fontsValid = TRUE;
+	}
+
+	// Only the front window's offscreen worlds compose from an atlas
+	if (screen->world && (screen->atlas == NULL || screen->atlasTileSize != tileSize || screen->atlasKeySize != keySize))
+	{
+		ALLOC_SETUP_BEGIN();
+		buildAtlas(screen, tileSize, keySize);
+		ALLOC_SETUP_END();
+	}
+
+	frameTimer.end(PhaseFonts);
+
+	BOOL useAtlas = screen->atlas && screen->atlasTileSize == tileSize && screen->atlasKeySize == keySize;
+	QuickDrawRenderer atlasSource(screen->atlas);
+
+	// Cells on other screens are left for their own worlds
+	Rect onScreen;
+
+	frameTimer.begin(PhaseKeyboard);
+	painter.useKeyboardFont(renderer);
+
+	for (int row = 0; row < KEYBOARD_NUM_ROWS; row++)
+	{
+		for ( int col = 0; col < key_rect_len[row]; col++)
+		{
+			Rect r = layout.keyRects[row][col];
+			char l = keyboardRows[row][col];
+
+			letterScore score = Unknown;
+			if (l != '\n' && l != '\b')
+			{
+				score = shownAlphabet[l - 'A'];
+			}
+
+			if ((fullRedraw || screen->drawnKeys[row][col] != score) && SectRect(&r, &contentRect, &onScreen))
+			{
+				if (useAtlas)
+				{
+					Rect src = keySprite(screen, l, score);
+					renderer->copyFrom(&atlasSource, &src, &r);
+				}
+				else
+				{
+					if (!fullRedraw)
+					{
+						renderer->eraseRect(&r);
+					}
+					painter.drawKey(renderer, l, score, r);
+				}
+				screen->drawnKeys[row][col] = score;
+			}
+		}
+	}
+
+	frameTimer.end(PhaseKeyboard);
+	frameTimer.begin(PhaseGrid);
+	painter.useBoardFont(renderer);
+
+	// Draw the game board
+	for (int boardRow = 0; boardRow < NUM_OF_GUESSES; boardRow++)
+	{
+		for (int boardCol = 0; boardCol < WORD_LENGTH; boardCol++)
+		{
+			char letter;
+			letterScore score;
+			cellState(boardRow, boardCol, &letter, &score);
+
+			TileState* drawn = &screen->drawnTiles[boardRow][boardCol];
+			if (!fullRedraw && drawn->letter == letter && drawn->score == score)
+			{
+				continue;
+			}
+
+			Rect r = layout.tileRects[boardRow][boardCol];
+
+			if (!SectRect(&r, &contentRect, &onScreen))
+			{
+				continue;
+			}
+
+			if (useAtlas)
+			{
+				Rect src = tileSprite(screen, letter, score);
+				renderer->copyFrom(&atlasSource, &src, &r);
+			}
+			else
+			{
+				if (!fullRedraw)
+				{
+					renderer->eraseRect(&r);
+				}
+				painter.drawTile(renderer, letter, score, r);
+			}
+
+			drawn->letter = letter;
+			drawn->score = score;
+		}
+	}
+
+	frameTimer.end(PhaseGrid);
+
+	screen->fullRedraw = FALSE;
+
+	if (monochromeMode)
+	{
+		SetPort(origClassicPort);
+	}
+	else
+	{
+		SetGWorld(origPort, origDev);
+	}
+}
+
+// What a grid tile currently shows. Tiles of a guess still being revealed keep no colour.
+void Board::cellState(int row, int col, char* letter, letterScore* score)
+{
+	*letter = '\0';
+	*score = Unknown;
+
+	if (col < curGuessLen && row == engine.numGuesses)
+	{
+		*letter = curGuess[col];
+	}
+	else if (row < engine.numGuesses)
+	{
+		*letter = engine.guesses[row][col];
+		if (row != revealRow || col < revealed)
+		{
+			*score = engine.scores[row][col];
+		}
+	}
+}
+
+// Draw one frame of an animation into the offscreen worlds and copy just that area to the
+// window. Screens without a world or atlas skip the frame.
+void Board::drawAnimation(AnimationKind kind, short row, short col, short progress)
+{
+	short tileSize = layout.tileSize;
+	short half = ANIMATION_STEPS / 2;
+
+	if (!active || tileSize == 0 || monochromeMode)
+	{
+		return;
+	}
+
+	MemoryHold hold(this);
+
+	int first = col;
+	int last = col;
+	short dx = 0;
+	short grow = 0;
+	short height = tileSize;
+	BOOL flipped = TRUE;
+	Rect area = layout.tileRects[row][col];
+
+	if (kind == ShakeAnimation)
+	{
+		// A decaying wobble, in quarters of the amplitude
+		static const signed char wave[] = {0, 2, 4, 2, 0, -2, -4, -2, 0, 2, 3, 1, 0, -1, -2, -1};
+		short amplitude = tileSize / 8;
+
+		first = 0;
+		last = WORD_LENGTH - 1;
+		dx = (wave[(progress * sizeof(wave)) / ANIMATION_STEPS] * amplitude) / 4;
+		UnionRect(&layout.tileRects[row][0], &layout.tileRects[row][WORD_LENGTH - 1], &area);
+		InsetRect(&area, -amplitude, 0);
+	}
+	else if (kind == PopAnimation)
+	{
+		// Stays within half the gap between tiles
+		short maxGrow = tileSize / 12;
+
+		grow = (maxGrow * (progress < half ? progress : ANIMATION_STEPS - progress)) / half;
+		InsetRect(&area, -maxGrow, -maxGrow);
+	}
+	else
+	{
+		// The tile folds flat showing no colour, then unfolds showing its score
+		flipped = progress >= half;
+		height = (tileSize * (flipped ? progress - half : half - progress)) / half;
+	}
+
+	// Called from idle time, when another window's port may be current
+	GrafPtr savedPort;
+	GetPort(&savedPort);
+	SetPort(window);
+	CWindowPtr cWindow = (CWindowPtr)window;
+
+	CGrafPtr origPort;
+	GDHandle origDev;
+	GetGWorld(&origPort, &origDev);
+
+	Rect shown = {0, 0, 0, 0};
+
+	for (int i = 0; i < numScreens; i++)
+	{
+		ScreenWorld* screen = &screens[i];
+		Rect onScreen;
+
+		if (screen->world == NULL || screen->atlas == NULL ||
+			screen->atlasTileSize != tileSize || !SectRect(&area, &screen->bounds, &onScreen))
+		{
+			continue;
+		}
+
+		SetGWorld(screen->world, NULL);
+		renderer->eraseRect(&onScreen);
+		QuickDrawRenderer atlasSource(screen->atlas);
+
+		for (int c = first; c <= last; c++)
+		{
+			char letter;
+			letterScore score;
+			cellState(row, c, &letter, &score);
+
+			if (kind == RevealAnimation && flipped)
+			{
+				score = engine.scores[row][c];
+			}
+
+			Rect r = layout.tileRects[row][c];
+			OffsetRect(&r, dx, 0);
+			r.top += (tileSize - height) / 2;
+			r.bottom = r.top + height;
+			InsetRect(&r, -grow, -grow);
+
+			if (r.bottom > r.top)
+			{
+				Rect src = tileSprite(screen, letter, score);
+				renderer->copyFrom(&atlasSource, &src, &r);
+			}
+
+			screen->drawnTiles[row][c].letter = DIRTY_LETTER;
+		}
+
+		SetGWorld(origPort, origDev);
+
+		CopyBits((BitMap *)*(screen->world->portPixMap),
+					(BitMap *)*(cWindow->portPixMap),
+					&onScreen,
+					&onScreen,
+					srcCopy,
+					window->visRgn);
+		addShown(&onScreen, &shown);
+	}
+
+	SetPort(savedPort);
+
+	// A guess first shows as its reveal or shake
+	if (!EmptyRect(&shown))
+	{
+		keyLatency.drawn(this, &shown, TRUE);
+	}
+}
+
+// Leave the tiles an animation touched in their final state
+void Board::endAnimation(AnimationKind kind, short row, short col)
+{
+	if (kind != PopAnimation)
+	{
+		Rect area;
+		keyArea(row, (kind == ShakeAnimation) ? -1 : col, &area);
+		keyLatency.settled(this, &area);
+	}
+
+	if (kind == ShakeAnimation)
+	{
+		for (int c = 0; c < WORD_LENGTH; c++)
+		{
+			dirtyTile(row, c);
+		}
+		invalidateRow(row);
+		return;
+	}
+
+	if (kind == RevealAnimation && row == revealRow)
+	{
+		if (col + 1 > revealed)
+		{
+			revealed = col + 1;
+		}
+
+		// The keyboard catches up once the whole guess is shown
+		if (revealed == WORD_LENGTH)
+		{
+			revealRow = -1;
+			for (int c = 0; c < WORD_LENGTH; c++)
+			{
+				invalidateKey(engine.guesses[row][c]);
+			}
+			syncAlphabet();
+		}
+	}
+
+	dirtyTile(row, col);
+	invalidateTile(row, col);
+}
+
+void Board::dirtyTile(int row, int col)
+{
+	for (int i = 0; i < numScreens; i++)
+	{
+		screens[i].drawnTiles[row][col].letter = DIRTY_LETTER;
+	}
+	redraw = TRUE;
+}
+
+void Board::syncAlphabet()
+{
+	memcpy(shownAlphabet, engine.alphabet, sizeof(shownAlphabet));
+}
+
+// Tiles are laid out one column per letter (blank first) and one row per letterScore
+Rect Board::tileSprite(const ScreenWorld* screen, char letter, letterScore score)
+{
+	return atlasTile(screen->atlasTileSize, letter, score);
+}
+
+Rect Board::keySprite(const ScreenWorld* screen, char key, letterScore score)
+{
+	return atlasKey(screen->atlasTileSize, screen->atlasKeySize, key, score);
+}
+
+// Render every tile and key image once for the current cell sizes, at the screen's depth
+void Board::buildAtlas(ScreenWorld* screen, short tileSize, short keySize)
+{
+	releaseAtlas(screen);
+
+	Rect atlasRect;
+	atlasBounds(tileSize, keySize, &atlasRect);
+
+	if (tileSize <= 0 || keySize <= 0)
+	{
+		return;
+	}
+
+	CTabHandle table;
+	short depth = screenDepth(screen->device, &table);
+	Size spaceNeeded = MemoryBudget::offscreenBytes(atlasRect.right, atlasRect.bottom, depth);
+
+	// Without an atlas the cells are drawn one by one, so this is never fatal
+	if (!memoryBudget.canAllocate(0, spaceNeeded))
+	{
+		return;
+	}
+
+	QDErr newWorldErr = NewGWorld(&screen->atlas, depth, &atlasRect, table, NULL, 0);
+
+	if (newWorldErr != noErr)
+	{
+		screen->atlas = NULL;
+		return;
+	}
+
+	screen->atlasSize = spaceNeeded;
+	memoryBudget.allocated(MemoryAtlases, screen->atlasSize);
+	screen->atlasTileSize = tileSize;
+	screen->atlasKeySize = keySize;
+
+	CGrafPtr origPort;
+	GDHandle origDev;
+	GetGWorld(&origPort, &origDev);
+	SetGWorld(screen->atlas, NULL);
+	renderer->eraseRect(&atlasRect);
+
+	for (int state = Unknown; state <= Correct; state++)
+	{
+		letterScore score = (letterScore)state;
+
+		painter.useBoardFont(renderer);
+		for (int index = 0; index <= ALPHABET_LENGTH; index++)
+		{
+			// Only empty frames are ever blank
+			if (index == 0 && score != Unknown)
+			{
+				continue;
+			}
+
+			char letter = (index == 0) ? '\0' : 'A' + index - 1;
+			painter.drawTile(renderer, letter, score, tileSprite(screen, letter, score));
+		}
+
+		painter.useKeyboardFont(renderer);
+		for (int key = 0; key < ALPHABET_LENGTH; key++)
+		{
+			painter.drawKey(renderer, 'A' + key, score, keySprite(screen, 'A' + key, score));
+		}
+	}
+
+	painter.drawKey(renderer, '\n', Unknown, keySprite(screen, '\n', Unknown));
+	painter.drawKey(renderer, '\b', Unknown, keySprite(screen, '\b', Unknown));
+
+	SetGWorld(origPort, origDev);
+}
+
+void Board::releaseAtlas(ScreenWorld* screen)
+{
+	if (screen->atlas)
+	{
+		DisposeGWorld(screen->atlas);
+		screen->atlas = NULL;
+		memoryBudget.released(MemoryAtlases, screen->atlasSize);
+		screen->atlasSize = 0;
+	}
+	screen->atlasTileSize = 0;
+	screen->atlasKeySize = 0;
+}
+
+// Key handling only invalidates; the Event Manager merges these into one update event
+void Board::invalidate(const Rect* r)
+{
+	GrafPtr origPort;
+	GetPort(&origPort);
+	SetPort(window);
+	InvalRect(r);
+	SetPort(origPort);
+}
+
+void Board::invalidateAll()
+{
+	invalidate(&window->portRect);
+}
+
+void Board::invalidateTile(int row, int col)
+{
+	if (layout.tileSize == 0)
+	{
+		invalidateAll();
+		return;
+	}
+
+	invalidate(&layout.tileRects[row][col]);
+}
+
+void Board::invalidateRow(int row)
+{
+	if (layout.tileSize == 0)
+	{
+		invalidateAll();
+		return;
+	}
+
+	Rect r;
+	UnionRect(&layout.tileRects[row][0], &layout.tileRects[row][WORD_LENGTH - 1], &r);
+	invalidate(&r);
+}
+
+void Board::invalidateKey(char key)
+{
+	if (layout.keySize == 0)
+	{
+		invalidateAll();
+		return;
+	}
+
+	for (int row = 0; row < KEYBOARD_NUM_ROWS; row++)
+	{
+		const char* found = strchr(keyboardRows[row], key);
+		if (found != NULL)
+		{
+			invalidate(&layout.keyRects[row][found - keyboardRows[row]]);
+			return;
+		}
+	}
+}
+
+void Board::resized()
+{
+	redraw = TRUE;
+	redrawAll();
+}
+
+// Stretches what was last rendered to the window's current size without a new layout, fonts
+// or offscreen, so each step of a live resize costs one CopyBits per screen
+void Board::drawResizePreview()
+{
+	MemoryHold hold(this);
+	SetPort(window);
+
+	Rect content = calculateVisibleRect(window->portRect);
+	Rect bounds = layout.bounds;
+	MapRect(&bounds, layout.content(), &content);
+
+	eraseMargins(&bounds);
+
+	if (monochromeMode)
+	{
+		if (monoBits)
+		{
+			Rect dst = monoScreen.bounds;
+			MapRect(&dst, layout.content(), &content);
+			CopyBits(&monoPort.portBits, &window->portBits, &monoScreen.bounds, &dst, srcCopy, NULL);
+		}
+	}
+	else
+	{
+		CWindowPtr cWindow = (CWindowPtr)window;
+
+		for (int i = 0; i < numScreens; i++)
+		{
+			if (screens[i].world == NULL)
+			{
+				continue;
+			}
+
+			Rect dst = screens[i].bounds;
+			MapRect(&dst, layout.content(), &content);
+			CopyBits((BitMap *)*(screens[i].world->portPixMap),
+						(BitMap *)*(cWindow->portPixMap),
+						&screens[i].bounds,
+						&dst,
+						srcCopy,
+						NULL);
+		}
+	}
+
+	DrawGrowIcon(window);
+}
+
+void Board::redrawAll()
+{
+	for (int i = 0; i < numScreens; i++)
+	{
+		screens[i].fullRedraw = TRUE;
+	}
+	monoScreen.fullRedraw = TRUE;
+}
+
+// Background windows give up their offscreen worlds and get them back when they come to the front
+void Board::activate(BOOL isActive)
+{
+	active = isActive;
+
+	if (!active)
+	{
+		releaseScreens();
+		releaseBitMap();
+	}
+
+	redraw = TRUE;
+	redrawAll();
+	SetPort(window);
+	InvalRect(&window->portRect);
+}
+
+// Window dragging copies the bits across screens itself, so only a change of screens needs a redraw
+void Board::moved()
+{
+	GDHandle devices[MAX_SCREEN_WORLDS];
+	Rect portions[MAX_SCREEN_WORLDS];
+
+	if (monochromeMode)
+	{
+		return;
+	}
+
+	SetPort(window);
+	int numFound = findScreens(&layout.bounds, devices, portions);
+
+	if (!screensMatch(devices, portions, numFound))
+	{
+		invalidateAll();
+	}
+}
+
+// Find the active screens the bounds cross, with the part on each in window coordinates.
+// The current port must be the board's window.
+int Board::findScreens(const Rect* bounds, GDHandle* devices, Rect* portions)
+{
+	Point offset = {0, 0};
+	LocalToGlobal(&offset);
+
+	Rect globalBounds = *bounds;
+	OffsetRect(&globalBounds, offset.h, offset.v);
+
+	int numFound = 0;
+
+	for (GDHandle device = GetDeviceList(); device != NULL && numFound < MAX_SCREEN_WORLDS; device = GetNextDevice(device))
+	{
+		if (!TestDeviceAttribute(device, screenDevice) || !TestDeviceAttribute(device, screenActive))
+		{
+			continue;
+		}
+
+		Rect portion;
+		if (SectRect(&globalBounds, &(**device).gdRect, &portion))
+		{
+			OffsetRect(&portion, -offset.h, -offset.v);
+			devices[numFound] = device;
+			portions[numFound] = portion;
+			numFound++;
+		}
+	}
+
+	return numFound;
+}
+
+BOOL Board::screensMatch(const GDHandle* devices, const Rect* portions, int numFound)
+{
+	if (numFound != numScreens)
+	{
+		return FALSE;
+	}
+
+	for (int i = 0; i < numFound; i++)
+	{
+		if (screens[i].device != devices[i] || !EqualRect(&screens[i].bounds, &portions[i]))
+		{
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+// Keep one entry per screen the board is on. Screens it stays on keep their worlds, which
+// updateGWorld resizes; screens it has left give their memory back.
+BOOL Board::updateScreens(const Rect* bounds)
+{
+	GDHandle devices[MAX_SCREEN_WORLDS];
+	Rect portions[MAX_SCREEN_WORLDS];
+	int numFound = findScreens(bounds, devices, portions);
+
+	if (screensMatch(devices, portions, numFound))
+	{
+		return FALSE;
+	}
+
+	ScreenWorld previous[MAX_SCREEN_WORLDS];
+	int numPrevious = numScreens;
+	memcpy(previous, screens, numPrevious * sizeof(ScreenWorld));
+
+	for (int i = 0; i < numFound; i++)
+	{
+		ScreenWorld* screen = &screens[i];
+		int match = -1;
+
+		for (int j = 0; j < numPrevious; j++)
+		{
+			if (previous[j].device == devices[i])
+			{
+				match = j;
+				break;
+			}
+		}
+
+		if (match >= 0)
+		{
+			*screen = previous[match];
+			previous[match].device = NULL;
+		}
+		else
+		{
+			memset(screen, 0, sizeof(ScreenWorld));
+			screen->device = devices[i];
+		}
+
+		screen->bounds = portions[i];
+		screen->fullRedraw = TRUE;
+	}
+
+	for (int j = 0; j < numPrevious; j++)
+	{
+		if (previous[j].device != NULL)
+		{
+			releaseGWorld(&previous[j]);
+			releaseAtlas(&previous[j]);
+		}
+	}
+
+	numScreens = numFound;
+	return TRUE;
+}
+
+void Board::releaseScreens()
+{
+	for (int i = 0; i < numScreens; i++)
+	{
+		releaseGWorld(&screens[i]);
+		releaseAtlas(&screens[i]);
+	}
+}
+
+// Each world matches its screen's depth and colour table, so the CopyBits needs no translation.
+// Indexed worlds instead use a small custom colour table, so a full-screen board costs a
+// fraction of a direct-colour one; QuickDraw maps it to the screen during the CopyBits.
+short Board::screenDepth(GDHandle device, CTabHandle* table)
+{
+	short depth = devicePixelSize(device);
+
+	if (!indexedOffscreen || depth <= INDEXED_DEPTH)
+	{
+		// Direct colour devices have no table to match
+		*table = (depth <= 8) ? (**(**device).gdPMap).pmTable : NULL;
+		return depth;
+	}
+
+	if (boardColorTable == NULL)
+	{
+		boardColorTable = newBoardColorTable();
+	}
+
+	*table = boardColorTable;
+	return INDEXED_DEPTH;
+}
+
+// White first and black last, as QuickDraw expects, with a grey ramp filling the spare entries
+CTabHandle Board::newBoardColorTable()
+{
+	const RGBColor* palette[] = {&renderRGB[RenderWhite], &renderRGB[RenderLightGrey], &renderRGB[RenderGrey],
+								&renderRGB[RenderYellow], &renderRGB[RenderGreen]};
+	short numColors = 1 << INDEXED_DEPTH;
+	short numPalette = sizeof(palette) / sizeof(palette[0]);
+
+	CTabHandle table = (CTabHandle)NewHandleClear(sizeof(ColorTable) + (numColors - 1) * sizeof(ColorSpec));
+	if (table == NULL)
+	{
+		return NULL;
+	}
+
+	(**table).ctSeed = GetCTSeed();
+	(**table).ctFlags = 0;
+	(**table).ctSize = numColors - 1;
+
+	for (short i = 0; i < numColors; i++)
+	{
+		ColorSpec* spec = &(**table).ctTable[i];
+		spec->value = i;
+
+		if (i < numPalette)
+		{
+			spec->rgb = *palette[i];
+		}
+		else if (i == numColors - 1)
+		{
+			spec->rgb = renderRGB[RenderBlack];
+		}
+		else
+		{
+			unsigned short level = (unsigned short)(((long)(numColors - 1 - i) * 0xFFFFL) / (numColors - numPalette));
+			spec->rgb.red = level;
+			spec->rgb.green = level;
+			spec->rgb.blue = level;
+		}
+	}
+
+	return table;
+}
+
+// Worlds at screen depth only need their atlas and tiles redrawn, but indexed ones were
+// built with the old colours in their table
+void Board::themeChanged()
+{
+	if (indexedOffscreen)
+	{
+		releaseScreens();
+	}
+	else
+	{
+		for (int i = 0; i < numScreens; i++)
+		{
+			releaseAtlas(&screens[i]);
+		}
+	}
+
+	redraw = TRUE;
+	redrawAll();
+	invalidateAll();
+}
+
+// Called once per theme change, before any board rebuilds its worlds
+void Board::releaseColorTable()
+{
+	if (boardColorTable)
+	{
+		DisposeCTable(boardColorTable);
+		boardColorTable = NULL;
+	}
+}
+
+// Called when the offscreen depth option changes
+void Board::depthChanged()
+{
+	releaseScreens();
+	redraw = TRUE;
+	redrawAll();
+	invalidateAll();
+}
+
+short Board::devicePixelSize(GDHandle device)
+{
+	PixMapHandle pixMap = (**device).gdPMap;
+	return (**pixMap).pixelSize;
+}
+
+BOOL Board::canResize(short width, short height)
+{
+	// Only other windows' caches may be purged to make room; this one's are counted as reclaimable
+	MemoryHold hold(this);
+
+	// Size the check by what the new layout would actually need
+	Rect r;
+	SetRect(&r, 0, 0, width, height);
+	r = calculateVisibleRect(r);
+
+	BoardLayout probe;
+	probe.update(&r, key_rect_len);
+
+	short boundsWidth = probe.bounds.right - probe.bounds.left;
+	short boundsHeight = probe.bounds.bottom - probe.bounds.top;
+
+	if (monochromeMode)
+	{
+		if (monoBits && boundsWidth <= monoScreen.worldWidth && boundsHeight <= monoScreen.worldHeight)
+		{
+			return TRUE;
+		}
+
+		Size bitsNeeded = (Size)(((boundsWidth + 15) / 16) * 2) * boundsHeight;
+		return memoryBudget.canAllocate(monoScreen.worldSize, bitsNeeded);
+	}
+
+	// An offscreen world with enough slack is kept as it is
+	if (numScreens == 1 && screens[0].world &&
+		boundsWidth <= screens[0].worldWidth && boundsHeight <= screens[0].worldHeight)
+	{
+		return TRUE;
+	}
+
+	// The new bounds may cross the screens differently, so cost all of it at the deepest one
+	CTabHandle table;
+	short pixelSize = screenDepth(GetMainDevice(), &table);
+	Size reclaimable = 0;
+
+	for (int i = 0; i < numScreens; i++)
+	{
+		short depth = screenDepth(screens[i].device, &table);
+		pixelSize = MAX(pixelSize, depth);
+		reclaimable += screens[i].worldSize;
+	}
+
+	Size spaceNeeded = MemoryBudget::offscreenBytes(boundsWidth, boundsHeight, pixelSize);
+
+	return memoryBudget.canAllocate(reclaimable, spaceNeeded);
+}
+
+// Keep a screen's offscreen world sized to its part of the board. It is over-allocated when it
+// grows and only shrunk on large reductions, so live resizes rarely touch the heap.
+BOOL Board::updateGWorld(ScreenWorld* screen)
+{
+	const Rect* bounds = &screen->bounds;
+	short width = bounds->right - bounds->left;
+	short height = bounds->bottom - bounds->top;
+	short deviceDepth = devicePixelSize(screen->device);
+
+	if (screen->world && screen->depth == deviceDepth)
+	{
+		BOOL fits = width <= screen->worldWidth && height <= screen->worldHeight;
+		BOOL wasteful = (long)width * height < ((long)screen->worldWidth * screen->worldHeight) / GWORLD_SHRINK_RATIO;
+
+		if (fits && !wasteful)
+		{
+			originGWorld(screen);
+			screen->fullRedraw = TRUE;
+			return TRUE;
+		}
+	}
+
+	CTabHandle table;
+	short depth = screenDepth(screen->device, &table);
+	short allocWidth = width + (width >> GWORLD_SLACK_SHIFT);
+	short allocHeight = height + (height >> GWORLD_SLACK_SHIFT);
+	Size spaceNeeded = MemoryBudget::offscreenBytes(allocWidth, allocHeight, depth);
+
+	if (!memoryBudget.canAllocate(screen->worldSize, spaceNeeded))
+	{
+		// Try again without the slack
+		allocWidth = width;
+		allocHeight = height;
+		spaceNeeded = MemoryBudget::offscreenBytes(allocWidth, allocHeight, depth);
+
+		if (!memoryBudget.canAllocate(screen->worldSize, spaceNeeded))
+		{
+			// Draw straight into the window until memory frees up
+			releaseGWorld(screen);
+			return FALSE;
+		}
+	}
+
+	TRACE(TraceWorldSize, spaceNeeded, FreeMem());
+
+	Rect allocRect;
+	SetRect(&allocRect, 0, 0, allocWidth, allocHeight);
+
+	if (screen->world)
+	{
+		// Resizes the pixels in place when the heap allows, with no CompactMem of our own
+		GWorldFlags flags = UpdateGWorld(&screen->world, depth, &allocRect, table, NULL, 0);
 
-	boardFontSize = 0;
-	keyboardFontSize = 0;
+		memoryBudget.released(MemoryOffscreens, screen->worldSize);
+		screen->worldSize = 0;
 
-	offscreenWorld = NULL;
+		if (flags & gwFlagErr)
+		{
+			TRACE(TraceUpdateWorldFailed, QDError(), 0);
+			if (screen->world)
+			{
+				DisposeGWorld(screen->world);
+			}
+			screen->world = NULL;
+			return FALSE;
+		}
+	}
+	else
+	{
+		QDErr newWorldErr = NewGWorld(&screen->world, depth, &allocRect, table, NULL, 0);
 
-	init();
-	clear();
-}
+		if (newWorldErr != noErr) {
+			TRACE(TraceNewWorldFailed, newWorldErr, 0);
+			screen->world = NULL;
+			return FALSE;
+		}
+	}
 
-BOOL Board::equalPortRect(Rect cmp)
-{
-	return  cmp.right == lastPortRect.right &&
-			cmp.left == lastPortRect.left &&
-			cmp.top == lastPortRect.top &&
-			cmp.bottom == lastPortRect.bottom;
-}
+	screen->depth = deviceDepth;
+	screen->worldWidth = allocWidth;
+	screen->worldHeight = allocHeight;
+	screen->worldSize = spaceNeeded;
+	memoryBudget.allocated(MemoryOffscreens, screen->worldSize);
 
-Board::~Board()
-{
-	cleanup();
-}
+	originGWorld(screen);
+	screen->fullRedraw = TRUE;
 
-Rect Board::calculateVisibleRect(Rect r)
-{
-	r.right -= 16;
-	r.bottom -= 16;
-	return r;
+	return TRUE;
 }
 
-// Always draw the whole board in the offscreen GWorld
-void Board::draw_board()
+// Give the offscreen world window coordinates, so layout rects can be used in both
+void Board::originGWorld(ScreenWorld* screen)
 {
 	CGrafPtr origPort;
 	GDHandle origDev;
 
 	GetGWorld(&origPort, &origDev);
+	SetGWorld(screen->world, NULL);
+	SetOrigin(screen->bounds.left, screen->bounds.top);
+	SetGWorld(origPort, origDev);
 
-	Rect contentRect = calculateVisibleRect(window->portRect);
-
-	BOOL isNewPortRect = !equalPortRect(contentRect);
+	screen->worldBounds = screen->bounds;
+}
 
-	if (isNewPortRect) {
-		isNewPortRect = updateGWorld(&contentRect);
+void Board::releaseGWorld(ScreenWorld* screen)
+{
+	if (screen->world) {
+		DisposeGWorld(screen->world);
+		screen->world = NULL;
+		memoryBudget.released(MemoryOffscreens, screen->worldSize);
+		screen->worldSize = 0;
+		screen->worldWidth = 0;
+		screen->worldHeight = 0;
 	}
+}
 
-	if (isNewPortRect) {
-		boardSizeUpdated = isNewPortRect;
-		keyboardSizeUpdated = isNewPortRect;
-	}
+void Board::draw()
+{
+	MemoryHold hold(this);
+	SetPort(window);
 
-	contentRect = offscreenWorld->portRect;
-	if (offscreenWorld) {
-		SetGWorld(offscreenWorld, NULL);
-		EraseRect(&offscreenWorld->portRect);
-	}
+	frameTimer.beginFrame();
+	frameTimer.begin(PhaseLayout);
 
-	short winWidth = contentRect.right - contentRect.left;
+	Rect contentRect = calculateVisibleRect(window->portRect);
 
-	float buttonWidth = ((float)winWidth) / (((float)max_key_rect_len) + 1);
-	float spacerWidth = buttonWidth / (max_key_rect_len + 1);
+	// Rects are only recalculated when the content rect changes
+	BOOL layoutChanged = layout.update(&contentRect, key_rect_len);
+	if (layoutChanged)
+	{
+		fontsValid = FALSE;
+		redrawAll();
+	}
 
-	// Calculate space from the bottom
+	frameTimer.end(PhaseLayout);
 
-	short vertOffset = (contentRect.bottom - contentRect.top) - ((KEYBOARD_NUM_ROWS * (buttonWidth + spacerWidth) + spacerWidth));
+	// What reached the window this frame, for the keystroke latency
+	Rect shown = {0, 0, 0, 0};
 
-	for (int row = 0; row < KEYBOARD_NUM_ROWS; row++)
+	if (monochromeMode)
 	{
-		for ( int col = 0; col < key_rect_len[row]; col++)
-		{
-			Rect r;
-			r.top = vertOffset + (row * (buttonWidth + spacerWidth));
-			r.bottom = r.top + buttonWidth;
-			unsigned char numMissingKeys = max_key_rect_len - key_rect_len[row];
-			r.left = spacerWidth + (spacerWidth + buttonWidth) * col + ((spacerWidth + buttonWidth) / 2) * numMissingKeys;
-			r.right = r.left + buttonWidth;
+		drawMonochrome(&shown);
+	}
+	else
+	{
+		// A window straddling monitors gets a world per screen, each blitted without translation
+		frameTimer.begin(PhaseLayout);
+		updateScreens(&layout.bounds);
+		frameTimer.end(PhaseLayout);
+
+		// During an update the visRgn is already the intersection with the update region,
+		// so only the exposed part of each offscreen world is copied
+		RgnHandle visible = window->visRgn;
+		CWindowPtr cWindow = (CWindowPtr)window;
 
-			key_rects[row][col] = r;
-			char l = keyboard[row][col];
+		for (int i = 0; i < numScreens; i++)
+		{
+			ScreenWorld* screen = &screens[i];
 
-			if ( l == '\n' )
+			// Offscreen worlds are only kept by the front window, and rebuilt lazily
+			if (active && (screen->world == NULL || !EqualRect(&screen->worldBounds, &screen->bounds) ||
+				screen->depth != devicePixelSize(screen->device)))
 			{
-				FillCRoundRect(&r, ROUND_RECT_SZ, ROUND_RECT_SZ, lightGreyPixPat);
-				l = 0xc8;
+				frameTimer.begin(PhaseLayout);
+				ALLOC_SETUP_BEGIN();
+				updateGWorld(screen);
+				ALLOC_SETUP_END();
+				frameTimer.end(PhaseLayout);
 			}
-			else if (l == '\b' )
+
+			if (screen->world == NULL)
 			{
-				FillCRoundRect(&r, ROUND_RECT_SZ, ROUND_RECT_SZ, lightGreyPixPat);
-				l = 0xc7;
+				GetClip(savedClip);
+				ClipRect(&screen->bounds);
+				screen->fullRedraw = TRUE;
+				draw_board(screen);
+				SetClip(savedClip);
+				addVisible(&screen->bounds, &shown);
+				continue;
 			}
-			else
+
+			if (redraw || screen->fullRedraw)
 			{
-				letterScore score = engine.alphabet[l - 'A'];
-				if (score == Unknown)
-				{
-					FillCRoundRect(&r, ROUND_RECT_SZ, ROUND_RECT_SZ, lightGreyPixPat);
-				}
-				else if (score == NoMatch)
-				{
-					FillCRoundRect(&r, ROUND_RECT_SZ, ROUND_RECT_SZ, greyPixPat);
-				}
-				else if (score == WrongPos)
-				{
-					FillCRoundRect(&r, ROUND_RECT_SZ, ROUND_RECT_SZ, yellowPixPat);
-				}
-				else if (score == Correct)
-				{
-					FillCRoundRect(&r, ROUND_RECT_SZ, ROUND_RECT_SZ, greenPixPat);
-				}
+				draw_board(screen);
 			}
 
-			draw_letter(l, r, &keyboardFontSize, &keyboardSizeUpdated);
+			Rect exposed;
+
+			if (SectRect(&(**visible).rgnBBox, &screen->bounds, &exposed))
+			{
+				frameTimer.begin(PhaseCopy);
+				CopyBits((BitMap *)*(screen->world->portPixMap),
+							(BitMap *)*(cWindow->portPixMap),
+							&exposed,
+							&exposed,
+							srcCopy,
+							visible);
+				frameTimer.end(PhaseCopy);
+				addShown(&exposed, &shown);
+			}
 		}
 	}
 
-	float boardWidthCalc = (float)winWidth / ((float)WORD_LENGTH + 1.0);
-	float boardHeightCalc = (float)vertOffset / ((float)NUM_OF_GUESSES + 1.0);
-	float boardButtonWidth = MIN(boardWidthCalc, boardHeightCalc);
-	float boardSpacerWidth = boardButtonWidth / (WORD_LENGTH + 1);
+	redraw = FALSE;
 
-	float boardEmptySpace = winWidth - WORD_LENGTH * (boardButtonWidth + boardSpacerWidth);
+	eraseMargins(&layout.bounds);
+	DrawGrowIcon(window);
+	TRACE(TraceBoardDraw, layoutChanged, numScreens);
 
-	// Draw the game board
-	for (int boardRow = 0; boardRow < NUM_OF_GUESSES; boardRow++)
+	if (!EmptyRect(&shown))
 	{
-		for (int boardCol = 0; boardCol < WORD_LENGTH; boardCol++)
-		{
-			char letter = '\0';
-			PixPatHandle color = nil;
+		keyLatency.drawn(this, &shown, FALSE);
+	}
+	frameTimer.endFrame();
+}
 
-			if (boardCol < curGuessLen && boardRow == engine.numGuesses)
-			{
-				letter = curGuess[boardCol];
-			}
-			else if (boardRow < engine.numGuesses )
-			{
-				letter = engine.guesses[boardRow][boardCol];
+// 1-bit boards keep one plain BitMap, an eighth of the size of an 8-bit GWorld, and draw
+// with nothing from Color QuickDraw
+void Board::drawMonochrome(Rect* shown)
+{
+	ScreenWorld* screen = &monoScreen;
 
-				letterScore score = engine.scores[boardRow][boardCol];
+	if (!EqualRect(&screen->bounds, &layout.bounds))
+	{
+		screen->bounds = layout.bounds;
+		screen->fullRedraw = TRUE;
+	}
 
-				if ( score == NoMatch)
-				{
-					color = greyPixPat;
-				}
-				else if (score == WrongPos)
-				{
-					color = yellowPixPat;
-				}
-				else if (score == Correct)
-				{
-					color = greenPixPat;
-				}
-			}
+	if (active && (monoBits == NULL || !EqualRect(&screen->worldBounds, &screen->bounds)))
+	{
+		frameTimer.begin(PhaseLayout);
+		ALLOC_SETUP_BEGIN();
+		updateBitMap();
+		ALLOC_SETUP_END();
+		frameTimer.end(PhaseLayout);
+	}
 
-			Rect r;
-			r.top = boardSpacerWidth + (boardButtonWidth + boardSpacerWidth) * boardRow;
-			r.bottom = r.top + boardButtonWidth;
-			r.left = boardSpacerWidth + (boardButtonWidth + boardSpacerWidth) * boardCol + (boardEmptySpace / 2.0);
-			r.right = r.left + boardButtonWidth;
+	if (monoBits == NULL)
+	{
+		screen->fullRedraw = TRUE;
+		draw_board(screen);
+		addVisible(&screen->bounds, shown);
+		return;
+	}
 
-			if (color != nil)
-			{
-				FillCRect(&r, color);
-			}
-			else
-			{
-				FrameRect(&r);
-			}
+	if (redraw || screen->fullRedraw)
+	{
+		draw_board(screen);
+	}
 
+	RgnHandle visible = window->visRgn;
+	Rect exposed;
 
-			if (letter != '\0')
-			{
-				draw_letter(letter, r, &boardFontSize, &boardSizeUpdated);
-			}
-		}
+	if (SectRect(&(**visible).rgnBBox, &screen->bounds, &exposed))
+	{
+		frameTimer.begin(PhaseCopy);
+		CopyBits(&monoPort.portBits, &window->portBits, &exposed, &exposed, srcCopy, visible);
+		frameTimer.end(PhaseCopy);
+		addShown(&exposed, shown);
 	}
-
-	lastPortRect = contentRect;
-	SetGWorld(origPort, origDev);
 }
 
-void Board::resized()
+// Grows the area that reached the window this frame; an empty area holds nothing yet
+void Board::addShown(const Rect* drawn, Rect* shown)
 {
-	redraw = TRUE;
+	if (EmptyRect(shown))
+	{
+		*shown = *drawn;
+	}
+	else
+	{
+		UnionRect(shown, drawn, shown);
+	}
 }
 
-BOOL Board::canCreateGWorld(short width, short numRows)
+// Direct drawing only reaches the part of the window's visRgn it covers
+void Board::addVisible(const Rect* drawn, Rect* shown)
 {
-	// Assume the existing GWorld's space can be reclaimed
-	Size existingSpace = 0;
-	if (offscreenWorld) {
-		existingSpace = GetHandleSize((Handle)offscreenWorld->portPixMap);
+	Rect visible;
+	if (SectRect(&(**window->visRgn).rgnBBox, drawn, &visible))
+	{
+		addShown(&visible, shown);
 	}
+}
 
-	PixMapHandle pixMap = ((CGrafPtr) window)->portPixMap;
-	HLock((Handle)pixMap);
-	short pixelSize = (*pixMap)->pixelSize;
-	HUnlock((Handle)pixMap);
-
-	int spaceNeeded = (( ( (width * (pixelSize / 8)) + 15) / 16) * 16) * numRows;
-
-	Size maxGrow;
-	MaxMem(&maxGrow);
-	Size free = CompactMem(spaceNeeded);
-
-	Size avail = free + existingSpace;
-
-	return avail > spaceNeeded;
+// The pending keystroke shows at this tile or row; a guess shows first on its animation
+void Board::expectKey(int row, int col, BOOL animation)
+{
+	Rect area;
+	keyArea(row, col, &area);
+	keyLatency.expect(this, &area, animation);
 }
 
-BOOL Board::updateGWorld(const Rect* updateRect)
+// Where a key shows on the grid: one tile, or the whole row for a column of -1
+void Board::keyArea(int row, int col, Rect* area)
 {
-	if (offscreenWorld) {
-		DisposeGWorld(offscreenWorld);
-		offscreenWorld = NULL;
+	if (layout.tileSize == 0)
+	{
+		*area = window->portRect;
 	}
+	else if (col < 0)
+	{
+		UnionRect(&layout.tileRects[row][0], &layout.tileRects[row][WORD_LENGTH - 1], area);
+	}
+	else
+	{
+		*area = layout.tileRects[row][col];
+	}
+}
 
-	//const Rect* windowRect = &(window->portRect);
-
-	PixMapHandle pixMap = ((CGrafPtr) window)->portPixMap;
-	HLock((Handle)pixMap);
-	short pixelSize = (*pixMap)->pixelSize;
-	HUnlock((Handle)pixMap);
+// Sized with the same slack and shrink rules as the GWorlds
+BOOL Board::updateBitMap()
+{
+	ScreenWorld* screen = &monoScreen;
+	short width = screen->bounds.right - screen->bounds.left;
+	short height = screen->bounds.bottom - screen->bounds.top;
 
-	short numRows = updateRect->bottom - updateRect->top;
-	short width = updateRect->right - updateRect->left;
+	if (monoBits)
+	{
+		BOOL fits = width <= screen->worldWidth && height <= screen->worldHeight;
+		BOOL wasteful = (long)width * height < ((long)screen->worldWidth * screen->worldHeight) / GWORLD_SHRINK_RATIO;
 
-	int spaceNeeded = (( ( (width * (pixelSize / 8)) + 15) / 16) * 16) * numRows;
+		if (fits && !wasteful)
+		{
+			originBitMap();
+			screen->fullRedraw = TRUE;
+			return TRUE;
+		}
+	}
 
-	Size maxGrow;
-	MaxMem(&maxGrow);
-	Size free = CompactMem(spaceNeeded);
+	short allocWidth = width + (width >> GWORLD_SLACK_SHIFT);
+	short allocHeight = height + (height >> GWORLD_SLACK_SHIFT);
+	short rowBytes = ((allocWidth + 15) / 16) * 2;
+	Size spaceNeeded = (Size)rowBytes * allocHeight;
 
-	printf("free: %d spaceNeeded %d\n", free, spaceNeeded);
+	if (!memoryBudget.canAllocate(screen->worldSize, spaceNeeded))
+	{
+		allocWidth = width;
+		allocHeight = height;
+		rowBytes = ((allocWidth + 15) / 16) * 2;
+		spaceNeeded = (Size)rowBytes * allocHeight;
 
-	if (spaceNeeded > free) {
-		return FALSE;
-		// Go back to the last working size
+		if (!memoryBudget.canAllocate(screen->worldSize, spaceNeeded))
+		{
+			releaseBitMap();
+			return FALSE;
+		}
 	}
 
-	QDErr newWorldErr = NewGWorld(&offscreenWorld, 0, updateRect, NULL, NULL, 0);
+	releaseBitMap();
 
-	if (newWorldErr != noErr) {
-		printf("Failed to UpdateGWorld with err: %d\n", newWorldErr);
-		ExitToShell();
+	monoBits = NewPtr(spaceNeeded);
+	if (monoBits == NULL)
+	{
 		return FALSE;
 	}
 
+	monoRowBytes = rowBytes;
+	screen->worldWidth = allocWidth;
+	screen->worldHeight = allocHeight;
+	screen->worldSize = spaceNeeded;
+	memoryBudget.allocated(MemoryOffscreens, screen->worldSize);
+
+	originBitMap();
+	screen->fullRedraw = TRUE;
+
 	return TRUE;
 }
 
-void Board::draw_letter(char letter, Rect r, short* fontSize, BOOL* updateFontSize)
+// Place the BitMap at the board's bounds, so layout rects can be used in it directly
+void Board::originBitMap()
 {
-	PenState oldState;
-	GetPenState(&oldState);
+	ScreenWorld* screen = &monoScreen;
 
-	if (*updateFontSize)
-	{
-		short fontSizes[] = { 72, 48, 36, 24, 18, 14, 12, 10, 9, 8, 7, 6, 5, 4};
-
-		Style s = 0;
-		Str255 fontName;
+	BitMap bits;
+	bits.baseAddr = monoBits;
+	bits.rowBytes = monoRowBytes;
+	SetRect(&bits.bounds, screen->bounds.left, screen->bounds.top,
+			screen->bounds.left + screen->worldWidth, screen->bounds.top + screen->worldHeight);
 
-		// Use the courier monospace font
-		short fontFamily = 0;
-		c2pstrcpy_cust(fontName, "courier");
-		GetFNum(fontName, &fontFamily);
-		TextFont(fontFamily);
-		for (int i = 0; i < (sizeof(fontSizes) / sizeof(fontSizes[0])); i++)
-		{
-			TextSize(fontSizes[i]);
-			*fontSize = fontSizes[i];
+	GrafPtr origPort;
+	GetPort(&origPort);
+	SetPort(&monoPort);
 
-			CharParameter testLetter = 'A';
-			short charWidth = CharWidth(testLetter);
+	SetPortBits(&bits);
+	monoPort.portRect = bits.bounds;
+	RectRgn(monoPort.visRgn, &bits.bounds);
+	ClipRect(&bits.bounds);
 
-			FontInfo testInfo;
-			GetFontInfo(&testInfo);
+	SetPort(origPort);
 
-			if ( charWidth < (r.right - r.left) && ((testInfo.ascent + testInfo.descent) <= (r.bottom - r.top)))
-			{
-				break;
-			}
-		}
+	screen->worldBounds = screen->bounds;
+}
 
-		*updateFontSize = FALSE;
-	}
-	else
+void Board::releaseBitMap()
+{
+	if (monoBits)
 	{
-		Str255 fontName;
+		DisposePtr(monoBits);
+		monoBits = NULL;
+		memoryBudget.released(MemoryOffscreens, monoScreen.worldSize);
+		monoScreen.worldSize = 0;
+		monoScreen.worldWidth = 0;
+		monoScreen.worldHeight = 0;
+	}
+}
+
+// Erase only the strips around the board, so the board itself never flickers
+void Board::eraseMargins(const Rect* bounds)
+{
+	Rect margin = window->portRect;
+	margin.bottom = bounds->top;
+	EraseRect(&margin);
+
+	margin = window->portRect;
+	margin.top = bounds->bottom;
+	EraseRect(&margin);
+
+	margin = window->portRect;
+	margin.top = bounds->top;
+	margin.bottom = bounds->bottom;
+	margin.right = bounds->left;
+	EraseRect(&margin);
+
+	margin.left = bounds->right;
+	margin.right = window->portRect.right;
+	EraseRect(&margin);
+}
 
-		// Use the courier monospace font
-		short fontFamily = 0;
-		c2pstrcpy_cust(fontName, "courier");
-		GetFNum(fontName, &fontFamily);
-		TextFont(fontFamily);
+// On-screen keys track like buttons: the key is hilited while the mouse is over it and
+// typed when the button is released there
+void Board::process_click(Point where)
+{
+	int row;
+	int col;
+
+	TRACE(TraceClick, where.h, where.v);
 
-		TextSize(*fontSize);
+	if (!layout.keyAt(where, &row, &col))
+	{
+		return;
 	}
 
-	CharParameter ch = letter;
-	short space = ((r.right - r.left) - CharWidth(ch)) / 2;
-	FontInfo info;
-	GetFontInfo(&info);
-	short vSpace = ((r.bottom - r.top) - (info.ascent + info.descent)) / 2;
+	SetPort(window);
 
-	PenState ps = {0};
-	ps.pnLoc.v = r.bottom - vSpace - info.descent;
-	ps.pnLoc.h = r.left + space;
-	ps.pnSize.v = 1;
-	ps.pnSize.h = 1;
+	const Rect* r = &layout.keyRects[row][col];
+	BOOL pressed = TRUE;
+	hiliteKey(row, col);
 
-	SetPenState(&ps);
-	DrawChar(ch);
-	SetPenState(&oldState);
-}
+	while (StillDown())
+	{
+		Point mouse;
+		GetMouse(&mouse);
 
-void Board::draw()
-{
-	SetPort(window);
+		BOOL over = PtInRect(mouse, r);
+		if (over != pressed)
+		{
+			pressed = over;
+			hiliteKey(row, col);
+		}
+	}
 
-	if (redraw) 
+	if (pressed)
 	{
-		draw_board();
-		redraw = FALSE;
+		hiliteKey(row, col);
+		process_key(keyboardRows[row][col]);
 	}
+}
 
-	Rect contentRect = calculateVisibleRect(window->portRect);
+// Inverting on screen touches only the one key, and inverting again restores it exactly
+void Board::hiliteKey(int row, int col)
+{
+	GrafPtr origPort;
+	GetPort(&origPort);
+	SetPort(window);
 
-	CWindowPtr cWindow = (CWindowPtr)window;
+	InvertRoundRect(&layout.keyRects[row][col], ROUND_RECT_SZ, ROUND_RECT_SZ);
 
-	EraseRect(&window->portRect);
-	DrawGrowIcon(window);
-	CopyBits((BitMap *)*(offscreenWorld->portPixMap),
-				(BitMap *)*(cWindow->portPixMap),
-				&offscreenWorld->portRect,
-				&contentRect,
-				srcCopy,
-				NULL);
-	printf("DrawGrowWindow\n");
+	SetPort(origPort);
 }
 
 void Board::process_key(char key)
 {
+	TRACE(TraceKey, key, engine.numGuesses);
+
 	if (engine.gameDone())
 	{
 		// Already done, won't do anything
 		SysBeep(1);
+		keyLatency.cancel(this);
 	}
 	else if ( key == '\n')
 	{
 		// Enter case
+		BOOL accepted = FALSE;
+
 		if ( curGuessLen == WORD_LENGTH )
 		{
 			// Always ensure the word is null terminated
 			curGuess[WORD_LENGTH] = '\0';
+			int row = engine.numGuesses;
+
+			// A previous guess still revealing is shown in full first
+			animator.finish(this);
+
 			BOOL isValid = engine.makeGuess(curGuess);
 			if (isValid)
 			{
+				accepted = TRUE;
 				curGuessLen = 0;
 
+				// The tiles flip over one at a time, and the keys change colour after the last
+				revealRow = row;
+				revealed = 0;
+				for (int i = 0; i < WORD_LENGTH; i++)
+				{
+					animator.start(this, RevealAnimation, row, i, i * REVEAL_STAGGER_TICKS, REVEAL_TICKS);
+				}
+				invalidateRow(row);
+				expectKey(row, -1, TRUE);
+
+				if (!engine.gameDone())
+				{
+					idleScheduler.add(analyzeInIdle, this, IdleLow);
+				}
+
 				// Check if the game is now won
 				if (engine.hasWon())
 				{
@@ -414,11 +1508,21 @@ void Board::process_key(char key)
 			else
 			{
 				SysBeep(1);
+				animator.start(this, ShakeAnimation, row, 0, 0, SHAKE_TICKS);
+				expectKey(row, -1, TRUE);
 			}
 		}
 		else
 		{
 			SysBeep(1);
+			animator.start(this, ShakeAnimation, engine.numGuesses, 0, 0, SHAKE_TICKS);
+			expectKey(engine.numGuesses, -1, TRUE);
+		}
+
+		// Monochrome mode has no shake to show a refused guess
+		if (monochromeMode && !accepted)
+		{
+			keyLatency.cancel(this);
 		}
 		redraw = TRUE;
 	}
@@ -428,35 +1532,177 @@ void Board::process_key(char key)
 		if (curGuessLen > 0)
 		{
 			curGuessLen--;
+			invalidateTile(engine.numGuesses, curGuessLen);
+			expectKey(engine.numGuesses, curGuessLen, FALSE);
 		}
 		else
 		{
 			SysBeep(1);
+			keyLatency.cancel(this);
 		}
 		redraw = TRUE;
 	}
 	else if (curGuessLen < WORD_LENGTH)
 	{
 		curGuess[curGuessLen] = key;
+		invalidateTile(engine.numGuesses, curGuessLen);
+		expectKey(engine.numGuesses, curGuessLen, FALSE);
+		animator.start(this, PopAnimation, engine.numGuesses, curGuessLen, 0, POP_TICKS);
 		curGuessLen++;
 		redraw = TRUE;
 	}
 	else
 	{
 		SysBeep(1);
+		keyLatency.cancel(this);
 	}
 }
 
 void Board::newGame()
 {
-	clear();
 	engine.newGame();
+	idleScheduler.cancel(analyzeInIdle, this);
+	if (analysis)
+	{
+		analysis->reset();
+	}
+	clear();
+}
+
+BOOL Board::analyzeInIdle(void* board)
+{
+	Board* b = (Board*)board;
+
+	// Reloading a purged word list can call the grow-zone, which must not delete the analysis
+	MemoryHold hold(b);
+	if (!b->loadAnalysis())
+	{
+		return TRUE;
+	}
+	return b->analysis->step(&b->engine);
+}
+
+// A purged analysis is recreated when next wanted, and catches up from the first guess
+BOOL Board::loadAnalysis()
+{
+	if (analysis == NULL)
+	{
+		ALLOC_SETUP_BEGIN();
+		analysis = new GameAnalysis;
+		ALLOC_SETUP_END();
+
+		if (analysis == NULL)
+		{
+			return FALSE;
+		}
+		memoryBudget.allocated(MemoryAnalysis, sizeof(GameAnalysis));
+	}
+	return TRUE;
+}
+
+Size Board::purgeAnalysis(void* board)
+{
+	Board* b = (Board*)board;
+	if (b->analysis == NULL)
+	{
+		return 0;
+	}
+
+	delete b->analysis;
+	b->analysis = NULL;
+	memoryBudget.released(MemoryAnalysis, sizeof(GameAnalysis));
+	return sizeof(GameAnalysis);
+}
+
+// The next draw rebuilds whatever was purged
+Size Board::purgeAtlases(void* board)
+{
+	Board* b = (Board*)board;
+	Size freed = 0;
+
+	for (int i = 0; i < b->numScreens; i++)
+	{
+		freed += b->screens[i].atlasSize;
+		b->releaseAtlas(&b->screens[i]);
+	}
+	return freed;
+}
+
+Size Board::purgeOffscreens(void* board)
+{
+	Board* b = (Board*)board;
+	Size freed = 0;
+
+	if (monochromeMode)
+	{
+		freed = b->monoScreen.worldSize;
+		b->releaseBitMap();
+		b->monoScreen.fullRedraw = TRUE;
+		return freed;
+	}
+
+	for (int i = 0; i < b->numScreens; i++)
+	{
+		freed += b->screens[i].worldSize;
+		b->releaseGWorld(&b->screens[i]);
+		b->screens[i].fullRedraw = TRUE;
+	}
+	return freed;
+}
+
+// The handle the Memory Manager grows for a GWorld is the one holding its pixels, which
+// baseAddr points into, not the PixMap record. Purged pixels have no handle left to grow.
+static Handle pixelStorage(GWorldPtr world)
+{
+	if (world == NULL)
+	{
+		return NULL;
+	}
+
+	Ptr pixels = GetPixBaseAddr(GetGWorldPixMap(world));
+	if (pixels == NULL)
+	{
+		return NULL;
+	}
+	return RecoverHandle(pixels);
+}
+
+BOOL Board::ownsAtlas(void* board, Handle h)
+{
+	Board* b = (Board*)board;
+
+	for (int i = 0; i < b->numScreens; i++)
+	{
+		if (pixelStorage(b->screens[i].atlas) == h)
+		{
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+// The 1-bit BitMap is a pointer block, which is never the handle being grown
+BOOL Board::ownsOffscreen(void* board, Handle h)
+{
+	Board* b = (Board*)board;
+
+	for (int i = 0; i < b->numScreens; i++)
+	{
+		if (pixelStorage(b->screens[i].world) == h)
+		{
+			return TRUE;
+		}
+	}
+	return FALSE;
 }
 
 void Board::clear()
 {
+	animator.finish(this);
+	syncAlphabet();
 	redraw = TRUE;
 	curGuessLen = 0;
+	invalidateAll();
 }
 
 void Board::init()
@@ -464,64 +1710,38 @@ void Board::init()
 
 	curGuessLen = 0;
 
-	RGBColor grey;
-	grey.red = 119 << 8;
-	grey.green = 124 << 8;
-	grey.blue = 126 << 8;
-
-	RGBColor yellow;
-	yellow.red = 205 << 8;
-	yellow.green = 178 << 8;
-	yellow.blue = 100 << 8;
-
-	RGBColor green;
-	green.red = 93 << 8;
-	green.green = 170 << 8;
-	green.blue = 107 << 8;
-
-	RGBColor lightGrey;
-	lightGrey.red = 211 << 8;
-	lightGrey.green = 214 << 8;
-	lightGrey.blue = 218 << 8;
-
-	greyPixPat = NewPixPat();
-	yellowPixPat = NewPixPat();
-	greenPixPat = NewPixPat();
-	lightGreyPixPat = NewPixPat();
-
-	MakeRGBPat(greyPixPat, &grey);
-	MakeRGBPat(yellowPixPat, &yellow);
-	MakeRGBPat(greenPixPat, &green);
-	MakeRGBPat(lightGreyPixPat, &lightGrey);
-
-	max_key_rect_len = 0;
 	for (int i = 0; i < KEYBOARD_NUM_ROWS; i++)
 	{
-		int len = strlen(keyboard[i]);
-		key_rect_len[i] = len;
-		key_rects[i] = new Rect[len];
-
-		if ( len > max_key_rect_len)
-		{
-			max_key_rect_len = len;
-		}
+		key_rect_len[i] = strlen(keyboardRows[i]);
 	}
 
-	QDErr newWorldErr = NewGWorld(&offscreenWorld, 0, &window->portRect, NULL, NULL, 0);
+	savedClip = NewRgn();
 
-	if (newWorldErr != noErr) {
-		printf("Failed to create NewGWorld with err: %d\n", newWorldErr);
-		ExitToShell();
+	if (monochromeMode)
+	{
+		GrafPtr origPort;
+		GetPort(&origPort);
+		OpenPort(&monoPort);
+		SetPort(origPort);
 	}
+
+	// Offscreen worlds are created by the first draw, once the screens and budget are known
 }
 
 void Board::cleanup()
 {
-	DisposePixPat(greyPixPat);
-	DisposePixPat(yellowPixPat);
-	DisposePixPat(greenPixPat);
-	DisposePixPat(lightGreyPixPat);
-	DisposeGWorld(offscreenWorld);
+	animator.cancel(this);
+	keyLatency.cancel(this);
+	idleScheduler.cancel(this);
+	memoryBudget.removeConsumer(this);
+	purgeAnalysis(this);
+	releaseScreens();
+	releaseBitMap();
+	if (monochromeMode)
+	{
+		ClosePort(&monoPort);
+	}
+	DisposeRgn(savedClip);
 }
 
 void c2pstrcpy_cust(Str255 dest, const char* src)
@@ -537,16 +1757,33 @@ void c2pstrcpy_cust(Str255 dest, const char* src)
     memcpy(dest + 1, src, len);
 }
 
+// Opened from a key press, but a new window is setup rather than steady state
 void Board::createScoreWindow(BOOL win)
 {
+	ALLOC_SETUP_BEGIN();
 
-	WindowPtr window = GetNewCWindow(scoreWindow, nil, (WindowPtr) -1);
+	WindowPtr window = newWindow(scoreWindow);
 	Str255 title;
 	c2pstrcpy_cust(title, "MacWords Score");
 	SetWTitle(window, title);
 
-	Score* score = new Score(window, win, (char)engine.numGuesses, engine.getSelectedWord());
+	// The Score window covers the row the final guess would have shown in
+	keyLatency.cancel(this);
+
+	// Finish what idle time hasn't before the window's first update, so the table is ready to draw
+	idleScheduler.cancel(analyzeInIdle, this);
+
+	// The analysis must outlive reloading the word lists and the Score copying it
+	MemoryHold hold(this);
+	if (loadAnalysis())
+	{
+		analysis->analyze(&engine);
+	}
+
+	Score* score = new Score(window, win, (char)engine.numGuesses, engine.getSelectedWord(), analysis);
 	SetWRefCon(window, (long)score);
 
 	score->draw();
+
+	ALLOC_SETUP_END();
 }
\ No newline at end of file
@@ -21,11 +21,54 @@
 #include <MacWindows.h>
 #include "engine.hh"
 #include "windows.hh"
+#include "budget.hh"
+#include "layout.hh"
+#include "animation.hh"
+#include "painter.hh"
+#include "qdrender.hh"
 
-#define KEYBOARD_NUM_ROWS (3)
+// Offscreen worlds grow with 1/8th slack and shrink when less than half is used
+#define GWORLD_SLACK_SHIFT (3)
+#define GWORLD_SHRINK_RATIO (2)
+
+// Depth of indexed offscreen worlds; the board palette needs only a handful of entries
+#define INDEXED_DEPTH (4)
+
+// Most screens one window keeps offscreen worlds for
+#define MAX_SCREEN_WORLDS (4)
 
 void c2pstrcpy_cust(Str255 dest, const char* src);
 
+// What was last painted in a grid tile, to skip tiles that haven't changed
+struct TileState
+{
+	char letter;
+	letterScore score;
+};
+
+// The part of the board on one screen, with an offscreen world and atlas matching that screen
+struct ScreenWorld
+{
+	GDHandle device;
+	Rect bounds;
+	short depth;
+	BOOL fullRedraw;
+
+	TileState drawnTiles[NUM_OF_GUESSES][WORD_LENGTH];
+	letterScore drawnKeys[KEYBOARD_NUM_ROWS][KEYBOARD_MAX_ROW_LEN];
+
+	GWorldPtr world;
+	Rect worldBounds;
+	Size worldSize;
+	short worldWidth;
+	short worldHeight;
+
+	GWorldPtr atlas;
+	Size atlasSize;
+	short atlasTileSize;
+	short atlasKeySize;
+};
+
 // Each board is pointed to by a window. Actions on performed on the board through the ui_main
 class Board
 {
@@ -38,45 +81,102 @@ class Board
 		void newGame();
 		void clear();
 		void createScoreWindow(BOOL win);
-		BOOL canCreateGWorld(short width, short numRows);
+		BOOL canResize(short width, short height);
 		void resized();
+		void drawResizePreview();
+		void activate(BOOL isActive);
+		void depthChanged();
+		void themeChanged();
+		static void releaseColorTable();
+		void moved();
+		void drawAnimation(AnimationKind kind, short row, short col, short progress);
+		void endAnimation(AnimationKind kind, short row, short col);
+		static BOOL analyzeInIdle(void* board);
+		static Size purgeAnalysis(void* board);
+		static Size purgeAtlases(void* board);
+		static Size purgeOffscreens(void* board);
+		static BOOL ownsAtlas(void* board, Handle h);
+		static BOOL ownsOffscreen(void* board, Handle h);
+
+		static BOOL indexedOffscreen;
 		~Board();
 
 	private:
 		void init();
 		void cleanup();
-		void draw_board();
-		BOOL updateGWorld(const Rect* updateRect);
+		BOOL loadAnalysis();
+		void draw_board(ScreenWorld* screen);
+		int findScreens(const Rect* bounds, GDHandle* devices, Rect* portions);
+		BOOL screensMatch(const GDHandle* devices, const Rect* portions, int numFound);
+		BOOL updateScreens(const Rect* bounds);
+		void releaseScreens();
+		void drawMonochrome(Rect* shown);
+		void addShown(const Rect* drawn, Rect* shown);
+		void addVisible(const Rect* drawn, Rect* shown);
+		void keyArea(int row, int col, Rect* area);
+		void expectKey(int row, int col, BOOL animation);
+		BOOL updateBitMap();
+		void originBitMap();
+		void releaseBitMap();
+		void redrawAll();
+		BOOL updateGWorld(ScreenWorld* screen);
+		void originGWorld(ScreenWorld* screen);
+		void releaseGWorld(ScreenWorld* screen);
+		short screenDepth(GDHandle device, CTabHandle* table);
+		static short devicePixelSize(GDHandle device);
+		static CTabHandle newBoardColorTable();
 		Rect calculateVisibleRect(Rect r);
-
-		void draw_letter(char letter, Rect r, short *fontSize, BOOL* updateFontSize);
-
-		BOOL Board::equalPortRect(Rect cmp);
+		void eraseMargins(const Rect* bounds);
+
+		void invalidate(const Rect* r);
+		void invalidateAll();
+		void hiliteKey(int row, int col);
+		void invalidateTile(int row, int col);
+		void invalidateRow(int row);
+		void invalidateKey(char key);
+		void cellState(int row, int col, char* letter, letterScore* score);
+		void dirtyTile(int row, int col);
+		void syncAlphabet();
+
+		void buildAtlas(ScreenWorld* screen, short tileSize, short keySize);
+		void releaseAtlas(ScreenWorld* screen);
+		Rect tileSprite(const ScreenWorld* screen, char letter, letterScore score);
+		Rect keySprite(const ScreenWorld* screen, char key, letterScore score);
 
 		Engine engine;
 		WindowPtr window;
 
-		PixPatHandle greyPixPat;
-		PixPatHandle yellowPixPat;
-		PixPatHandle greenPixPat;
-		PixPatHandle lightGreyPixPat;
+		// Kept up to date in idle time so the Score window opens without a pause
+		GameAnalysis* analysis;
 
-		Rect *key_rects[KEYBOARD_NUM_ROWS];
+		Renderer* renderer;
+		CellPainter painter;
+
+		BoardLayout layout;
 		int key_rect_len[KEYBOARD_NUM_ROWS];
-		int max_key_rect_len;
 
 		char curGuess[WORD_LENGTH + 1];
 		unsigned char curGuessLen;
-		Rect lastPortRect;
 
-		short boardFontSize;
-		short keyboardFontSize;
-		BOOL boardSizeUpdated;
-		BOOL keyboardSizeUpdated;
+		BOOL fontsValid;
+
+		// Colours shown while a guess is still being revealed, which lag the engine's
+		letterScore shownAlphabet[ALPHABET_LENGTH];
+		short revealRow;
+		short revealed;
 
 		BOOL redraw;
+		BOOL active;
+
+		ScreenWorld screens[MAX_SCREEN_WORLDS];
+		int numScreens;
+		RgnHandle savedClip;
 
-		GWorldPtr offscreenWorld;
+		// A 1-bit offscreen replaces the screen worlds in monochrome mode
+		GrafPort monoPort;
+		Ptr monoBits;
+		short monoRowBytes;
+		ScreenWorld monoScreen;
 };
 
 #endif
\ No newline at end of file
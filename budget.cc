@@ -0,0 +1,245 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+#include "budget.hh"
+#include <OSUtils.h>
+#include <string.h>
+
+MemoryBudget memoryBudget;
+
+MemoryBudget::MemoryBudget()
+{
+	budget = 0;
+	inUse = 0;
+	memset(used, 0, sizeof(used));
+	numConsumers = 0;
+	held = NULL;
+	purging = FALSE;
+	purges = 0;
+}
+
+// Called once the application zone has been grown to the full partition
+void MemoryBudget::init()
+{
+	Size maxGrow;
+	Size free = MaxMem(&maxGrow);
+
+	budget = free - BUDGET_RESERVE;
+	if (budget < 0)
+	{
+		budget = 0;
+	}
+	inUse = 0;
+	memset(used, 0, sizeof(used));
+
+	static GrowZoneUPP growZoneUPP = NULL;
+	if (growZoneUPP == NULL)
+	{
+		growZoneUPP = NewGrowZoneUPP(growZone);
+	}
+	SetGrowZone(growZoneUPP);
+}
+
+// reclaimable is memory the caller will release before allocating, such as an existing GWorld.
+// Caches are purged to make room before giving up.
+BOOL MemoryBudget::canAllocate(Size reclaimable, Size needed)
+{
+	Size over = inUse - reclaimable + needed - budget;
+	if (over > 0 && purge(over) < over)
+	{
+		return FALSE;
+	}
+
+	if (needed <= reclaimable)
+	{
+		return TRUE;
+	}
+
+	// Compacting can take a noticeable time, so only do it when no free block is large enough
+	if (MaxBlock() > needed)
+	{
+		return TRUE;
+	}
+
+	Size free = CompactMem(needed);
+
+	if (free + reclaimable > needed)
+	{
+		return TRUE;
+	}
+
+	purge(needed - reclaimable - free);
+	free = CompactMem(needed);
+
+	return free + reclaimable > needed;
+}
+
+void MemoryBudget::allocated(MemoryConsumer kind, Size bytes)
+{
+	inUse += bytes;
+	used[kind] += bytes;
+}
+
+void MemoryBudget::released(MemoryConsumer kind, Size bytes)
+{
+	inUse -= bytes;
+	if (inUse < 0)
+	{
+		inUse = 0;
+	}
+
+	used[kind] -= bytes;
+	if (used[kind] < 0)
+	{
+		used[kind] = 0;
+	}
+}
+
+// Returns FALSE when the table is full, which only means the owner is never purged
+BOOL MemoryBudget::addConsumer(MemoryConsumer kind, MemoryPurge purge, MemoryOwns owns, void* owner)
+{
+	if (numConsumers >= MAX_MEMORY_CONSUMERS)
+	{
+		return FALSE;
+	}
+
+	MemoryConsumerEntry* c = &consumers[numConsumers++];
+	c->kind = kind;
+	c->purge = purge;
+	c->owns = owns;
+	c->owner = owner;
+	return TRUE;
+}
+
+// For owners being deleted, which must not be called back
+void MemoryBudget::removeConsumer(void* owner)
+{
+	int i = 0;
+	while (i < numConsumers)
+	{
+		if (consumers[i].owner == owner)
+		{
+			numConsumers--;
+			consumers[i] = consumers[numConsumers];
+		}
+		else
+		{
+			i++;
+		}
+	}
+}
+
+// Returns the owner held before, to be restored when this one is done
+void* MemoryBudget::hold(void* owner)
+{
+	void* previous = held;
+	held = owner;
+	return previous;
+}
+
+// Purges whole kinds at a time, cheapest first, until enough has been freed. Owners of keep,
+// the handle being grown, are skipped.
+Size MemoryBudget::purge(Size needed, Handle keep)
+{
+	if (purging)
+	{
+		return 0;
+	}
+
+	purging = TRUE;
+	Size freed = 0;
+
+	for (int kind = 0; kind < NUM_MEMORY_CONSUMERS && freed < needed; kind++)
+	{
+		for (int i = 0; i < numConsumers; i++)
+		{
+			MemoryConsumerEntry* c = &consumers[i];
+			if (c->kind != kind || c->owner == held)
+			{
+				continue;
+			}
+
+			if (keep != NULL && c->owns != NULL && c->owns(c->owner, keep))
+			{
+				continue;
+			}
+
+			freed += c->purge(c->owner);
+		}
+	}
+
+	if (freed > 0)
+	{
+		purges++;
+	}
+
+	purging = FALSE;
+	return freed;
+}
+
+Size MemoryBudget::usage(MemoryConsumer kind)
+{
+	return used[kind];
+}
+
+Size MemoryBudget::totalUsage()
+{
+	return inUse;
+}
+
+Size MemoryBudget::budgetSize()
+{
+	return budget;
+}
+
+unsigned long MemoryBudget::purgeCount()
+{
+	return purges;
+}
+
+// Called by the Memory Manager when it can't satisfy a request. Nothing here may allocate, and
+// the application's globals are only reachable once A5 is its own.
+pascal long MemoryBudget::growZone(Size needed)
+{
+	long oldA5 = SetCurrentA5();
+	long freed = memoryBudget.purge(needed, GZSaveHnd());
+	SetA5(oldA5);
+	return freed;
+}
+
+// Pixel rows are padded to a long word, as QuickDraw does for GWorlds
+Size MemoryBudget::offscreenBytes(short width, short height, short pixelSize)
+{
+	if (width <= 0 || height <= 0)
+	{
+		return 0;
+	}
+
+	Size rowBytes = ((((Size)width * pixelSize) + 31) / 32) * 4;
+
+	return rowBytes * height;
+}
+
+MemoryHold::MemoryHold(void* owner)
+{
+	previous = memoryBudget.hold(owner);
+}
+
+MemoryHold::~MemoryHold()
+{
+	memoryBudget.hold(previous);
+}
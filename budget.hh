@@ -0,0 +1,115 @@
+#ifndef BUDGET_HH
+#define BUDGET_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+#include <MacMemory.h>
+#include "engine.hh"
+
+// Heap kept back from offscreen buffers for window records, boards and score windows
+#define BUDGET_RESERVE (384L * 1024L)
+
+// Most purgeable consumers registered at once; boards register three each
+#define MAX_MEMORY_CONSUMERS (48)
+
+// Large users of the heap, in the order they are purged when it runs short. Each is cheaper
+// to do without or rebuild than the next. The word lists are purgeable resources, which the
+// Memory Manager reclaims itself before asking.
+enum MemoryConsumer
+{
+	// Score windows draw directly instead of replaying a picture
+	MemoryPictures,
+	// Redone in idle time, or when the Score window opens
+	MemoryAnalysis,
+	// Cells are drawn one by one until the next draw rebuilds them
+	MemoryAtlases,
+	// Boards draw straight into the window until the next draw rebuilds them
+	MemoryOffscreens,
+	NUM_MEMORY_CONSUMERS
+};
+
+// Releases what it can of one owner's memory and returns the bytes freed
+typedef Size (*MemoryPurge)(void* owner);
+
+// Whether a handle belongs to the owner, so the one the Memory Manager is growing is left alone
+typedef BOOL (*MemoryOwns)(void* owner, Handle h);
+
+struct MemoryConsumerEntry
+{
+	MemoryConsumer kind;
+	MemoryPurge purge;
+	MemoryOwns owns;
+	void* owner;
+};
+
+// Single app-wide budget shared by every window's offscreen buffers and caches. When the
+// budget or the heap runs short, registered consumers are purged in priority order, both
+// before refusing an allocation and from the grow-zone procedure.
+class MemoryBudget
+{
+public:
+	MemoryBudget();
+
+	void init();
+
+	BOOL canAllocate(Size reclaimable, Size needed);
+	void allocated(MemoryConsumer kind, Size bytes);
+	void released(MemoryConsumer kind, Size bytes);
+
+	BOOL addConsumer(MemoryConsumer kind, MemoryPurge purge, MemoryOwns owns, void* owner);
+	void removeConsumer(void* owner);
+	void* hold(void* owner);
+	Size purge(Size needed, Handle keep = NULL);
+
+	Size usage(MemoryConsumer kind);
+	Size totalUsage();
+	Size budgetSize();
+	unsigned long purgeCount();
+
+	static Size offscreenBytes(short width, short height, short pixelSize);
+
+private:
+	static pascal long growZone(Size needed);
+
+	Size budget;
+	Size inUse;
+	Size used[NUM_MEMORY_CONSUMERS];
+
+	MemoryConsumerEntry consumers[MAX_MEMORY_CONSUMERS];
+	int numConsumers;
+
+	// Owner whose memory is being drawn from and must not be purged
+	void* held;
+	BOOL purging;
+	unsigned long purges;
+};
+
+extern MemoryBudget memoryBudget;
+
+// Holds an owner's memory for the life of a drawing call
+class MemoryHold
+{
+public:
+	MemoryHold(void* owner);
+	~MemoryHold();
+
+private:
+	void* previous;
+};
+
+#endif
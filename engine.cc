@@ -19,7 +19,7 @@
 #include <MacMemory.h>
 #include <Sound.h>
 #include <Resources.h>
-#include <QuickDraw.h>
+#include <Quickdraw.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -52,14 +52,58 @@ Engine::Engine()
 		splitWord[WORD_LENGTH] = '\0';
 	}
 
+	// The lists are only needed while checking a guess or starting a game, so the Memory
+	// Manager may reclaim them when the heap is short; each use reloads them if so
+	makePurgeable(dailyWords);
+	makePurgeable(allWords_a);
+	makePurgeable(allWords_b);
+
 	newGame();
 }
 
+void Engine::makePurgeable(Handle words)
+{
+	if (words != NULL)
+	{
+		HPurge(words);
+	}
+}
+
+// Returns the list locked, or NULL if it couldn't be read back in
+char* Engine::lockWords(Handle words)
+{
+	if (words == NULL)
+	{
+		return NULL;
+	}
+
+	LoadResource(words);
+	if (*words == NULL)
+	{
+		return NULL;
+	}
+
+	HLock(words);
+	return *words;
+}
+
 char* Engine::getSelectedWord()
 {
 	return selectedWord;
 }
 
+// Callers lock the list straight away; NULL if it couldn't be read back in
+Handle Engine::getDailyWords()
+{
+	if (dailyWords == NULL)
+	{
+		return NULL;
+	}
+
+	LoadResource(dailyWords);
+	return (*dailyWords == NULL) ? NULL : dailyWords;
+}
+
 void Engine::newGame()
 {
 	*selectedWord = '\0';
@@ -77,8 +121,12 @@ void Engine::newGame()
 	randWordNum = Random() + -RAND_MIN;
 	randWordNum = randWordNum % NUM_DAILY_WORDS;
 
-	HLock(dailyWords);
-	getWord(randWordNum, *dailyWords, selectedWord);
+	char* words = lockWords(dailyWords);
+	if (words == NULL)
+	{
+		return;
+	}
+	getWord(randWordNum, words, selectedWord);
 	HUnlock(dailyWords);
 }
 
@@ -170,9 +218,12 @@ BOOL Engine::checkWord(char* word)
 
 	// First, always check the list of daily words
 
-	HLock(dailyWords);
-	retVal = binSearch(0, NUM_DAILY_WORDS, *dailyWords, word);
-	HUnlock(dailyWords);
+	char* daily = lockWords(dailyWords);
+	if (daily != NULL)
+	{
+		retVal = binSearch(0, NUM_DAILY_WORDS, daily, word);
+		HUnlock(dailyWords);
+	}
 
 	if (retVal)
 	{
@@ -184,15 +235,21 @@ BOOL Engine::checkWord(char* word)
 
 	if (cmpRes < 0)
 	{
-		HLock(allWords_a);
-		retVal = binSearch(0, NUM_WORDS_A, *allWords_a, word);
-		HUnlock(allWords_a);
+		char* words = lockWords(allWords_a);
+		if (words != NULL)
+		{
+			retVal = binSearch(0, NUM_WORDS_A, words, word);
+			HUnlock(allWords_a);
+		}
 	}
 	else if (cmpRes > 0)
 	{
-		HLock(allWords_b);
-		retVal = binSearch(0, NUM_WORDS_B, *allWords_b, word);
-		HUnlock(allWords_b);
+		char* words = lockWords(allWords_b);
+		if (words != NULL)
+		{
+			retVal = binSearch(0, NUM_WORDS_B, words, word);
+			HUnlock(allWords_b);
+		}
 	}
 	else
 	{
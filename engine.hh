@@ -57,6 +57,8 @@ public:
 
 	char* getSelectedWord();
 
+	Handle getDailyWords();
+
 	void newGame();
 
 	int numGuesses;
@@ -64,8 +66,13 @@ public:
 	letterScore scores[NUM_OF_GUESSES][WORD_LENGTH];
 	letterScore alphabet[ALPHABET_LENGTH];
 private:
+	// The host benchmark times the word lookups on their own
+	friend class EngineBench;
+
 	void alphabetAdd(char letter, letterScore score);
 	void getWord(int num, char* words, char* ret);
+	static void makePurgeable(Handle words);
+	static char* lockWords(Handle words);
 
 	BOOL checkWord(char* word);
 
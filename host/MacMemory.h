@@ -0,0 +1,29 @@
+#ifndef HOST_MACMEMORY_H
+#define HOST_MACMEMORY_H
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+#include <MacTypes.h>
+
+// Handles never move or get purged on the host, so these do nothing.
+
+void HLock(Handle h);
+void HUnlock(Handle h);
+void HPurge(Handle h);
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef HOST_MACTYPES_H
+#define HOST_MACTYPES_H
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+// Just enough of the Mac types for the portable sources to build with a host compiler.
+// Only the host tools put this directory on the include path.
+
+typedef char* Ptr;
+typedef Ptr* Handle;
+typedef int Size;
+typedef int Fixed;
+typedef unsigned char Boolean;
+typedef short OSErr;
+
+struct Rect
+{
+	short top;
+	short left;
+	short bottom;
+	short right;
+};
+
+struct Point
+{
+	short v;
+	short h;
+};
+
+#define nil 0
+
+#endif
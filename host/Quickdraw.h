@@ -0,0 +1,36 @@
+#ifndef HOST_QUICKDRAW_H
+#define HOST_QUICKDRAW_H
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include <MacTypes.h>
+
+struct RGBColor
+{
+	unsigned short red;
+	unsigned short green;
+	unsigned short blue;
+};
+
+// Same sequence as QuickDraw's, seeded from randSeed
+extern long randSeed;
+
+short Random();
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+// Plays games through the engine and the game analysis on the real word lists, counting every
+// operator new by the kind of event the game would be handling, as an ALLOC_ACCOUNTING build
+// does on the Mac. Guesses are key events and analysis steps are idle time; neither may
+// allocate once the engine and analysis are set up. Exits 1 if either did.
+//
+//   alloccheck [-resources macwords.r] [-games count]
+
+#include "wordlists.hh"
+#include "../analysis.hh"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+
+#define DEFAULT_GAMES (200)
+#define GUESS_STEP (7919)
+
+enum CheckEvent
+{
+	CheckStartup,
+	CheckKey,
+	CheckIdle,
+	CheckMenu,
+	NUM_CHECK_EVENTS
+};
+
+static const char* const checkEventNames[NUM_CHECK_EVENTS] = {"Startup", "Key", "Idle", "Menu"};
+
+static CheckEvent current = CheckStartup;
+static unsigned long counts[NUM_CHECK_EVENTS];
+static unsigned long totals[NUM_CHECK_EVENTS];
+
+static void* counted(size_t size)
+{
+	counts[current]++;
+	totals[current] += size;
+
+	void* p = malloc(size ? size : 1);
+	if (p == NULL)
+	{
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void* operator new(size_t size)
+{
+	return counted(size);
+}
+
+void* operator new[](size_t size)
+{
+	return counted(size);
+}
+
+void operator delete(void* p) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+	free(p);
+}
+
+// Guesses walk the daily list in a scattered order, with a word in none of the lists every
+// so often to cover refused guesses
+static void nextGuess(long* n, char* word)
+{
+	*n += GUESS_STEP;
+
+	if (*n % 5 == 0)
+	{
+		memcpy(word, "QZXJV", WORD_LENGTH);
+	}
+	else
+	{
+		memcpy(word, wordLists[0].data + (*n % NUM_DAILY_WORDS) * WORD_STRIDE, WORD_LENGTH);
+	}
+	word[WORD_LENGTH] = '\0';
+}
+
+int main(int argc, char** argv)
+{
+	const char* resourcePath = "macwords.r";
+	int games = DEFAULT_GAMES;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-resources") == 0 && i + 1 < argc)
+		{
+			resourcePath = argv[++i];
+		}
+		else if (strcmp(argv[i], "-games") == 0 && i + 1 < argc)
+		{
+			games = atoi(argv[++i]);
+		}
+		else
+		{
+			fprintf(stderr, "usage: %s [-resources macwords.r] [-games count]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	if (!loadWordLists(resourcePath))
+	{
+		return 1;
+	}
+
+	// What the board makes when it opens
+	Engine* engine = new Engine;
+	GameAnalysis* analysis = new GameAnalysis;
+	if (beeps != 0)
+	{
+		fprintf(stderr, "the engine could not load its word lists\n");
+		return 1;
+	}
+
+	long n = 0;
+	char word[WORD_LENGTH + 1];
+	int won = 0;
+
+	for (int game = 0; game < games; game++)
+	{
+		current = CheckMenu;
+		engine->newGame();
+		analysis->reset();
+
+		while (!engine->gameDone())
+		{
+			current = CheckKey;
+			nextGuess(&n, word);
+			if (!engine->makeGuess(word))
+			{
+				continue;
+			}
+
+			current = CheckIdle;
+			while (!analysis->step(engine))
+			{
+			}
+		}
+
+		won += engine->hasWon();
+	}
+
+	current = CheckStartup;
+	delete analysis;
+	delete engine;
+
+	printf("%d games, %d won\n\n", games, won);
+	printf("%-10s %12s %12s\n", "Event", "Allocations", "Bytes");
+	for (int event = 0; event < NUM_CHECK_EVENTS; event++)
+	{
+		printf("%-10s %12lu %12lu\n", checkEventNames[event], counts[event], totals[event]);
+	}
+
+	unsigned long steady = counts[CheckKey] + counts[CheckIdle];
+	printf("\nSteady-state allocations %lu\n", steady);
+
+	return steady ? 1 : 0;
+}
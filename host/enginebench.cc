@@ -0,0 +1,483 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+// Times the game engine on the real word lists read from macwords.r: word lookups that hit
+// each list or miss them all, guess scoring, new games and whole simulated games. The
+// engine's search is also run over synthetic dictionaries of 10k to 1M words to show how it
+// scales. Results can be recorded as a baseline and later runs compared against it.
+//
+//   enginebench [-resources macwords.r] [-time seconds] [-tolerance percent]
+//               [-record file | -compare file]
+
+#include "wordlists.hh"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_PROBES (4096)
+#define PROBE_STEP (7919)
+#define MAX_WORKLOADS (32)
+#define MAX_NAME (32)
+#define DEFAULT_SECONDS (0.2)
+#define DEFAULT_TOLERANCE (25)
+
+// Every five letter word, used to space out the synthetic dictionaries
+#define NUM_LETTER_WORDS (26L * 26 * 26 * 26 * 26)
+
+struct Result
+{
+	char name[MAX_NAME];
+	double nsPerOp;
+};
+
+static BOOL inAnyList(const char* word)
+{
+	for (int list = 0; list < NUM_WORD_LISTS; list++)
+	{
+		for (int i = 0; i < listSizes[list]; i++)
+		{
+			if (memcmp(word, wordLists[list].data + i * WORD_STRIDE, WORD_LENGTH) == 0)
+			{
+				return TRUE;
+			}
+		}
+	}
+
+	return FALSE;
+}
+
+static void spellNumber(long n, char* word)
+{
+	for (int i = WORD_LENGTH - 1; i >= 0; i--)
+	{
+		word[i] = 'A' + n % 26;
+		n /= 26;
+	}
+	word[WORD_LENGTH] = '\0';
+}
+
+// Probes are drawn across the whole list in a scattered order so they don't share a search path
+static void pickProbes(const char* list, int count, char probes[][WORD_STRIDE])
+{
+	for (int i = 0; i < NUM_PROBES; i++)
+	{
+		memcpy(probes[i], list + ((long)i * PROBE_STEP % count) * WORD_STRIDE, WORD_LENGTH);
+		probes[i][WORD_LENGTH] = '\0';
+	}
+}
+
+class EngineBench
+{
+public:
+	EngineBench(Engine* engine);
+	~EngineBench();
+
+	void run(double seconds);
+	int compare(const char* path, int tolerance);
+	BOOL record(const char* path);
+
+private:
+	typedef long (EngineBench::*Workload)(long ops);
+
+	void time(const char* name, const char* unit, Workload workload, double seconds);
+
+	long checkDaily(long ops);
+	long checkListA(long ops);
+	long checkListB(long ops);
+	long checkMiss(long ops);
+	long checkProbes(char probes[][WORD_STRIDE], long ops);
+	long scoreGuess(long ops);
+	long startGame(long ops);
+	long playGame(long ops);
+	long searchHit(long ops);
+	long searchMiss(long ops);
+
+	void buildDictionary(long count);
+
+	Engine* engine;
+
+	char dailyProbes[NUM_PROBES][WORD_STRIDE];
+	char listAProbes[NUM_PROBES][WORD_STRIDE];
+	char listBProbes[NUM_PROBES][WORD_STRIDE];
+	char missProbes[NUM_PROBES][WORD_STRIDE];
+
+	char* dictionary;
+	long dictionarySize;
+	long dictionaryStep;
+
+	Result results[MAX_WORKLOADS];
+	int numResults;
+};
+
+EngineBench::EngineBench(Engine* engine)
+{
+	this->engine = engine;
+	dictionary = NULL;
+	dictionarySize = 0;
+	dictionaryStep = 1;
+	numResults = 0;
+
+	pickProbes(wordLists[0].data, NUM_DAILY_WORDS, dailyProbes);
+	pickProbes(wordLists[1].data, NUM_WORDS_A, listAProbes);
+	pickProbes(wordLists[2].data, NUM_WORDS_B, listBProbes);
+
+	// Misses are spread over the alphabet so they fall on both sides of the split word
+	long n = 0;
+	for (int i = 0; i < NUM_PROBES; )
+	{
+		n = (n + 104729) % NUM_LETTER_WORDS;
+		spellNumber(n, missProbes[i]);
+		if (!inAnyList(missProbes[i]))
+		{
+			i++;
+		}
+	}
+}
+
+EngineBench::~EngineBench()
+{
+	free(dictionary);
+}
+
+// Doubles the operation count until a run takes long enough to time, then reports that run
+void EngineBench::time(const char* name, const char* unit, Workload workload, double seconds)
+{
+	long ops = 1;
+	long check = 0;
+	double elapsed = 0;
+
+	for (;;)
+	{
+		clock_t start = clock();
+		check += (this->*workload)(ops);
+		elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+		if (elapsed >= seconds || ops >= (1L << 40))
+		{
+			break;
+		}
+		ops *= 2;
+	}
+
+	double nsPerOp = elapsed * 1e9 / ops;
+	double rate = (elapsed > 0) ? ops / elapsed : 0;
+
+	printf("%-22s %12.1f ns/op %14.0f %s/s  (%ld)\n", name, nsPerOp, rate, unit, check);
+
+	if (numResults < MAX_WORKLOADS)
+	{
+		Result* result = &results[numResults++];
+		strncpy(result->name, name, MAX_NAME - 1);
+		result->name[MAX_NAME - 1] = '\0';
+		result->nsPerOp = nsPerOp;
+	}
+}
+
+long EngineBench::checkProbes(char probes[][WORD_STRIDE], long ops)
+{
+	long found = 0;
+
+	for (long i = 0; i < ops; i++)
+	{
+		found += engine->checkWord(probes[i % NUM_PROBES]);
+	}
+
+	return found;
+}
+
+long EngineBench::checkDaily(long ops)
+{
+	return checkProbes(dailyProbes, ops);
+}
+
+long EngineBench::checkListA(long ops)
+{
+	return checkProbes(listAProbes, ops);
+}
+
+long EngineBench::checkListB(long ops)
+{
+	return checkProbes(listBProbes, ops);
+}
+
+long EngineBench::checkMiss(long ops)
+{
+	return checkProbes(missProbes, ops);
+}
+
+// Scores valid guesses into the first row over and over
+long EngineBench::scoreGuess(long ops)
+{
+	long correct = 0;
+
+	for (long i = 0; i < ops; i++)
+	{
+		engine->numGuesses = 0;
+		engine->makeGuess(listAProbes[i % NUM_PROBES]);
+		correct += engine->scores[0][0];
+	}
+
+	engine->newGame();
+	return correct;
+}
+
+long EngineBench::startGame(long ops)
+{
+	long letters = 0;
+
+	for (long i = 0; i < ops; i++)
+	{
+		engine->newGame();
+		letters += engine->getSelectedWord()[0];
+	}
+
+	return letters;
+}
+
+// Each game guesses daily words in turn until it is won or out of rows
+long EngineBench::playGame(long ops)
+{
+	long won = 0;
+	long probe = 0;
+
+	for (long i = 0; i < ops; i++)
+	{
+		engine->newGame();
+
+		while (!engine->gameDone())
+		{
+			engine->makeGuess(dailyProbes[probe++ % NUM_PROBES]);
+		}
+
+		won += engine->hasWon();
+	}
+
+	engine->newGame();
+	return won;
+}
+
+// Word n of the dictionary spells n * step, so every word in between is a miss
+void EngineBench::buildDictionary(long count)
+{
+	free(dictionary);
+	dictionary = (char*)malloc(count * WORD_STRIDE);
+	dictionarySize = count;
+	dictionaryStep = NUM_LETTER_WORDS / count;
+
+	for (long i = 0; i < count; i++)
+	{
+		spellNumber(i * dictionaryStep, dictionary + i * WORD_STRIDE);
+		dictionary[i * WORD_STRIDE + WORD_LENGTH] = '\r';
+	}
+}
+
+long EngineBench::searchHit(long ops)
+{
+	long found = 0;
+	char word[WORD_STRIDE];
+
+	for (long i = 0; i < ops; i++)
+	{
+		spellNumber((i * PROBE_STEP % dictionarySize) * dictionaryStep, word);
+		found += engine->binSearch(0, dictionarySize, dictionary, word);
+	}
+
+	return found;
+}
+
+long EngineBench::searchMiss(long ops)
+{
+	long found = 0;
+	char word[WORD_STRIDE];
+
+	for (long i = 0; i < ops; i++)
+	{
+		spellNumber((i * PROBE_STEP % dictionarySize) * dictionaryStep + dictionaryStep / 2, word);
+		found += engine->binSearch(0, dictionarySize, dictionary, word);
+	}
+
+	return found;
+}
+
+void EngineBench::run(double seconds)
+{
+	time("check-daily-hit", "lookups", &EngineBench::checkDaily, seconds);
+	time("check-a-hit", "lookups", &EngineBench::checkListA, seconds);
+	time("check-b-hit", "lookups", &EngineBench::checkListB, seconds);
+	time("check-miss", "lookups", &EngineBench::checkMiss, seconds);
+	time("make-guess", "guesses", &EngineBench::scoreGuess, seconds);
+	time("new-game", "games", &EngineBench::startGame, seconds);
+	time("full-game", "games", &EngineBench::playGame, seconds);
+
+	static const long sizes[] = {10000, 100000, 1000000};
+	static const char* labels[] = {"10k", "100k", "1m"};
+
+	for (int s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++)
+	{
+		char name[MAX_NAME];
+
+		buildDictionary(sizes[s]);
+
+		sprintf(name, "search-%s-hit", labels[s]);
+		time(name, "lookups", &EngineBench::searchHit, seconds);
+
+		sprintf(name, "search-%s-miss", labels[s]);
+		time(name, "lookups", &EngineBench::searchMiss, seconds);
+	}
+}
+
+// One "name ns/op" line per workload
+BOOL EngineBench::record(const char* path)
+{
+	FILE* file = fopen(path, "w");
+	if (file == NULL)
+	{
+		fprintf(stderr, "can't write %s\n", path);
+		return FALSE;
+	}
+
+	for (int i = 0; i < numResults; i++)
+	{
+		fprintf(file, "%s %.2f\n", results[i].name, results[i].nsPerOp);
+	}
+
+	fclose(file);
+	return TRUE;
+}
+
+// Returns how many workloads got slower than the baseline by more than the tolerance
+int EngineBench::compare(const char* path, int tolerance)
+{
+	FILE* file = fopen(path, "r");
+	if (file == NULL)
+	{
+		fprintf(stderr, "can't open %s\n", path);
+		return 1;
+	}
+
+	Result baseline[MAX_WORKLOADS];
+	int numBaseline = 0;
+
+	while (numBaseline < MAX_WORKLOADS &&
+			fscanf(file, "%31s %lf", baseline[numBaseline].name, &baseline[numBaseline].nsPerOp) == 2)
+	{
+		numBaseline++;
+	}
+	fclose(file);
+
+	int failures = 0;
+
+	printf("\nAgainst %s:\n", path);
+	for (int i = 0; i < numResults; i++)
+	{
+		int b = 0;
+		while (b < numBaseline && strcmp(baseline[b].name, results[i].name) != 0)
+		{
+			b++;
+		}
+
+		if (b == numBaseline || baseline[b].nsPerOp <= 0)
+		{
+			printf("%-22s no baseline\n", results[i].name);
+			continue;
+		}
+
+		double change = (results[i].nsPerOp - baseline[b].nsPerOp) * 100 / baseline[b].nsPerOp;
+		BOOL slower = change > tolerance;
+
+		printf("%-22s %12.1f -> %12.1f ns/op %+7.1f%%%s\n", results[i].name, baseline[b].nsPerOp,
+				results[i].nsPerOp, change, slower ? "  FAIL" : "");
+
+		if (slower)
+		{
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+int main(int argc, char** argv)
+{
+	const char* resourcePath = "macwords.r";
+	const char* recordPath = NULL;
+	const char* comparePath = NULL;
+	double seconds = DEFAULT_SECONDS;
+	int tolerance = DEFAULT_TOLERANCE;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-resources") == 0 && i + 1 < argc)
+		{
+			resourcePath = argv[++i];
+		}
+		else if (strcmp(argv[i], "-time") == 0 && i + 1 < argc)
+		{
+			seconds = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-tolerance") == 0 && i + 1 < argc)
+		{
+			tolerance = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-record") == 0 && i + 1 < argc)
+		{
+			recordPath = argv[++i];
+		}
+		else if (strcmp(argv[i], "-compare") == 0 && i + 1 < argc)
+		{
+			comparePath = argv[++i];
+		}
+		else
+		{
+			fprintf(stderr, "usage: %s [-resources macwords.r] [-time seconds] [-tolerance percent]"
+					" [-record file | -compare file]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	if (!loadWordLists(resourcePath))
+	{
+		return 1;
+	}
+
+	Engine engine;
+	if (beeps != 0)
+	{
+		fprintf(stderr, "the engine could not load its word lists\n");
+		return 1;
+	}
+
+	EngineBench bench(&engine);
+	bench.run(seconds);
+
+	int failures = 0;
+
+	if (recordPath && !bench.record(recordPath))
+	{
+		failures++;
+	}
+	else if (comparePath)
+	{
+		failures = bench.compare(comparePath, tolerance);
+		printf("%d slower than baseline\n", failures);
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,434 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+// Renders boards with the software renderer at many window sizes and game states, reporting
+// frames per second and pixels touched, and checks them against recorded golden images. The
+// images are kept as one checksum each; whole images can be written out to look at a change.
+//
+//   renderbench [-frames n] [-record-sums file | -compare-sums file]
+//               [-record dir | -compare dir]
+
+#include "swrender.hh"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_FRAMES (20)
+#define MAX_PATH (512)
+#define MAX_NAME (48)
+#define MAX_SUMS (64)
+
+struct GameState
+{
+	const char* name;
+	const char* guesses[NUM_OF_GUESSES + 1];
+	const char* typing;
+};
+
+struct WindowSize
+{
+	short width;
+	short height;
+};
+
+// Everything a full redraw of the board reads
+struct BoardCells
+{
+	char letters[NUM_OF_GUESSES][WORD_LENGTH];
+	letterScore scores[NUM_OF_GUESSES][WORD_LENGTH];
+	letterScore alphabet[ALPHABET_LENGTH];
+};
+
+static const char* answer = "SHINE";
+
+static const GameState states[] =
+{
+	{"empty", {NULL}, ""},
+	{"typing", {NULL}, "CRA"},
+	{"midgame", {"CRANE", "SLOTH", NULL}, "PI"},
+	{"finished", {"CRANE", "SLOTH", "BUMPY", "WHINE", "THINE", "SHINE", NULL}, ""}
+};
+
+static const WindowSize sizes[] =
+{
+	{180, 200}, {240, 280}, {320, 360}, {400, 460}, {512, 342},
+	{640, 480}, {800, 600}, {1024, 768}, {1280, 1024}, {1600, 1200}
+};
+
+// Same rules as the engine: exact matches first, then misplaced letters while any remain
+static void scoreGuess(const char* guess, letterScore* scores)
+{
+	int remaining[ALPHABET_LENGTH];
+	int i;
+
+	memset(remaining, 0, sizeof(remaining));
+
+	for (i = 0; i < WORD_LENGTH; i++)
+	{
+		if (guess[i] == answer[i])
+		{
+			scores[i] = Correct;
+		}
+		else
+		{
+			scores[i] = NoMatch;
+			remaining[answer[i] - 'A']++;
+		}
+	}
+
+	for (i = 0; i < WORD_LENGTH; i++)
+	{
+		if (scores[i] != Correct && remaining[guess[i] - 'A'] > 0)
+		{
+			remaining[guess[i] - 'A']--;
+			scores[i] = WrongPos;
+		}
+	}
+}
+
+static void buildCells(const GameState* state, BoardCells* cells)
+{
+	memset(cells, 0, sizeof(BoardCells));
+
+	int row = 0;
+	for (; row < NUM_OF_GUESSES && state->guesses[row] != NULL; row++)
+	{
+		memcpy(cells->letters[row], state->guesses[row], WORD_LENGTH);
+		scoreGuess(state->guesses[row], cells->scores[row]);
+
+		for (int col = 0; col < WORD_LENGTH; col++)
+		{
+			letterScore* best = &cells->alphabet[state->guesses[row][col] - 'A'];
+			if (cells->scores[row][col] > *best)
+			{
+				*best = cells->scores[row][col];
+			}
+		}
+	}
+
+	if (row < NUM_OF_GUESSES)
+	{
+		memcpy(cells->letters[row], state->typing, strlen(state->typing));
+	}
+}
+
+// Laid out as the board's atlas is
+static SoftwareRenderer* buildAtlas(CellPainter* painter, short tileSize, short keySize)
+{
+	Rect atlasRect;
+	atlasBounds(tileSize, keySize, &atlasRect);
+
+	SoftwareRenderer* atlas = new SoftwareRenderer(&atlasRect);
+
+	for (int state = Unknown; state <= Correct; state++)
+	{
+		letterScore score = (letterScore)state;
+
+		painter->useBoardFont(atlas);
+		for (int index = 0; index <= ALPHABET_LENGTH; index++)
+		{
+			char letter = (index == 0) ? '\0' : 'A' + index - 1;
+			painter->drawTile(atlas, letter, score, atlasTile(tileSize, letter, score));
+		}
+
+		painter->useKeyboardFont(atlas);
+		for (int key = 0; key < ALPHABET_LENGTH; key++)
+		{
+			painter->drawKey(atlas, 'A' + key, score, atlasKey(tileSize, keySize, 'A' + key, score));
+		}
+	}
+
+	painter->drawKey(atlas, '\n', Unknown, atlasKey(tileSize, keySize, '\n', Unknown));
+	painter->drawKey(atlas, '\b', Unknown, atlasKey(tileSize, keySize, '\b', Unknown));
+
+	return atlas;
+}
+
+// A full redraw, as Board::draw_board does after a resize. Without an atlas every cell is drawn.
+static void renderBoard(Renderer* target, CellPainter* painter, const BoardLayout* layout,
+						const BoardCells* cells, SoftwareRenderer* atlas)
+{
+	target->eraseRect(&layout->bounds);
+
+	painter->useKeyboardFont(target);
+	for (int row = 0; row < KEYBOARD_NUM_ROWS; row++)
+	{
+		for (int col = 0; keyboardRows[row][col] != '\0'; col++)
+		{
+			char key = keyboardRows[row][col];
+			letterScore score = (key == '\n' || key == '\b') ? Unknown : cells->alphabet[key - 'A'];
+
+			if (atlas)
+			{
+				Rect src = atlasKey(layout->tileSize, layout->keySize, key, score);
+				target->copyFrom(atlas, &src, &layout->keyRects[row][col]);
+			}
+			else
+			{
+				painter->drawKey(target, key, score, layout->keyRects[row][col]);
+			}
+		}
+	}
+
+	painter->useBoardFont(target);
+	for (int row = 0; row < NUM_OF_GUESSES; row++)
+	{
+		for (int col = 0; col < WORD_LENGTH; col++)
+		{
+			char letter = cells->letters[row][col];
+			letterScore score = cells->scores[row][col];
+
+			if (atlas)
+			{
+				Rect src = atlasTile(layout->tileSize, letter, score);
+				target->copyFrom(atlas, &src, &layout->tileRects[row][col]);
+			}
+			else
+			{
+				painter->drawTile(target, letter, score, layout->tileRects[row][col]);
+			}
+		}
+	}
+}
+
+// Renders the same frame repeatedly and reports the rate
+static void timeFrames(SoftwareRenderer* target, CellPainter* painter, const BoardLayout* layout,
+						const BoardCells* cells, SoftwareRenderer* atlas, int frames, const char* label)
+{
+	long touchedBefore = target->pixelsTouched;
+	clock_t start = clock();
+
+	for (int i = 0; i < frames; i++)
+	{
+		renderBoard(target, painter, layout, cells, atlas);
+	}
+
+	double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	long touched = (target->pixelsTouched - touchedBefore) / frames;
+	double fps = (seconds > 0) ? frames / seconds : 0;
+
+	printf("  %-6s %10.1f fps %10ld px/frame %8.1f Mpx/s\n", label, fps, touched, fps * touched / 1e6);
+}
+
+struct ImageSum
+{
+	char name[MAX_NAME];
+	unsigned long sum;
+};
+
+// One "name checksum" line per image
+static int loadSums(const char* path, ImageSum* sums)
+{
+	FILE* file = fopen(path, "r");
+	if (file == NULL)
+	{
+		fprintf(stderr, "can't open %s\n", path);
+		return -1;
+	}
+
+	int count = 0;
+	while (count < MAX_SUMS && fscanf(file, "%47s %lx", sums[count].name, &sums[count].sum) == 2)
+	{
+		count++;
+	}
+
+	fclose(file);
+	return count;
+}
+
+static const ImageSum* findSum(const ImageSum* sums, int count, const char* name)
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (strcmp(sums[i].name, name) == 0)
+		{
+			return &sums[i];
+		}
+	}
+	return NULL;
+}
+
+int main(int argc, char** argv)
+{
+	int frames = DEFAULT_FRAMES;
+	const char* recordDir = NULL;
+	const char* compareDir = NULL;
+	const char* recordSums = NULL;
+	const char* compareSums = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-frames") == 0 && i + 1 < argc)
+		{
+			frames = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-record") == 0 && i + 1 < argc)
+		{
+			recordDir = argv[++i];
+		}
+		else if (strcmp(argv[i], "-compare") == 0 && i + 1 < argc)
+		{
+			compareDir = argv[++i];
+		}
+		else if (strcmp(argv[i], "-record-sums") == 0 && i + 1 < argc)
+		{
+			recordSums = argv[++i];
+		}
+		else if (strcmp(argv[i], "-compare-sums") == 0 && i + 1 < argc)
+		{
+			compareSums = argv[++i];
+		}
+		else
+		{
+			fprintf(stderr, "usage: %s [-frames n] [-record-sums file | -compare-sums file]"
+					" [-record dir | -compare dir]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	ImageSum sums[MAX_SUMS];
+	int numSums = 0;
+
+	if (compareSums)
+	{
+		numSums = loadSums(compareSums, sums);
+		if (numSums < 0)
+		{
+			return 1;
+		}
+	}
+
+	FILE* sumsFile = NULL;
+	if (recordSums)
+	{
+		sumsFile = fopen(recordSums, "w");
+		if (sumsFile == NULL)
+		{
+			fprintf(stderr, "can't write %s\n", recordSums);
+			return 1;
+		}
+	}
+
+	if (frames < 1)
+	{
+		frames = 1;
+	}
+
+	int rowLengths[KEYBOARD_NUM_ROWS];
+	for (int row = 0; row < KEYBOARD_NUM_ROWS; row++)
+	{
+		rowLengths[row] = strlen(keyboardRows[row]);
+	}
+
+	int failures = 0;
+
+	for (int s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++)
+	{
+		Rect content;
+		content.left = 0;
+		content.top = 0;
+		content.right = sizes[s].width;
+		content.bottom = sizes[s].height;
+
+		BoardLayout layout;
+		layout.update(&content, rowLengths);
+
+		SoftwareRenderer direct(&content);
+		SoftwareRenderer composed(&content);
+
+		CellPainter painter;
+		painter.buildFonts(&direct, layout.keySize, layout.tileSize);
+		SoftwareRenderer* atlas = buildAtlas(&painter, layout.tileSize, layout.keySize);
+
+		for (int g = 0; g < (int)(sizeof(states) / sizeof(states[0])); g++)
+		{
+			BoardCells cells;
+			buildCells(&states[g], &cells);
+
+			printf("%dx%d %s\n", sizes[s].width, sizes[s].height, states[g].name);
+			timeFrames(&direct, &painter, &layout, &cells, NULL, frames, "direct");
+			timeFrames(&composed, &painter, &layout, &cells, atlas, frames, "atlas");
+
+			// Composing from the atlas must give exactly what drawing each cell does
+			long atlasDiff = composed.compare(&direct);
+			if (atlasDiff != 0)
+			{
+				printf("  FAIL atlas differs from direct drawing in %ld pixels\n", atlasDiff);
+				failures++;
+			}
+
+			char name[MAX_NAME];
+			sprintf(name, "board-%dx%d-%.16s", sizes[s].width, sizes[s].height, states[g].name);
+			unsigned long sum = direct.checksum();
+
+			if (sumsFile)
+			{
+				fprintf(sumsFile, "%s %08lx\n", name, sum);
+			}
+			else if (compareSums)
+			{
+				const ImageSum* golden = findSum(sums, numSums, name);
+				if (golden == NULL)
+				{
+					printf("  FAIL %s has no checksum\n", name);
+					failures++;
+				}
+				else if (golden->sum != sum)
+				{
+					printf("  FAIL %s: checksum %08lx, expected %08lx\n", name, sum, golden->sum);
+					failures++;
+				}
+			}
+
+			char path[MAX_PATH];
+			const char* dir = recordDir ? recordDir : compareDir;
+			if (dir)
+			{
+				sprintf(path, "%.400s/%s.ppm", dir, name);
+			}
+
+			if (recordDir && !direct.writePPM(path))
+			{
+				printf("  FAIL could not write %s\n", path);
+				failures++;
+			}
+			else if (compareDir)
+			{
+				long diff = direct.comparePPM(path);
+				if (diff != 0)
+				{
+					printf("  FAIL %s: %ld\n", path, diff);
+					failures++;
+				}
+			}
+		}
+
+		delete atlas;
+	}
+
+	if (sumsFile && fclose(sumsFile) != 0)
+	{
+		printf("FAIL could not write %s\n", recordSums);
+		failures++;
+	}
+
+	printf("%d failures\n", failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,482 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "swrender.hh"
+#include <stdio.h>
+#include <string.h>
+
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#define MIN(a,b) (((a)<(b))?(a):(b))
+
+// Rows of each glyph from space to Z, most significant of the low five bits on the left
+static const unsigned char font[][GLYPH_HEIGHT] =
+{
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// space
+	{0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04},	// !
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// "
+	{0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A},	// #
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// $
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// %
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// &
+	{0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00},	// '
+	{0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02},	// (
+	{0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08},	// )
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// *
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// +
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// ,
+	{0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00},	// -
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C},	// .
+	{0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00},	// /
+	{0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},	// 0
+	{0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},	// 1
+	{0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F},	// 2
+	{0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E},	// 3
+	{0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},	// 4
+	{0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},	// 5
+	{0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},	// 6
+	{0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},	// 7
+	{0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},	// 8
+	{0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C},	// 9
+	{0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00},	// :
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// ;
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// <
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// =
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// >
+	{0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04},	// ?
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},	// @
+	{0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},	// A
+	{0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E},	// B
+	{0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E},	// C
+	{0x1E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E},	// D
+	{0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F},	// E
+	{0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10},	// F
+	{0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F},	// G
+	{0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},	// H
+	{0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},	// I
+	{0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C},	// J
+	{0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11},	// K
+	{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F},	// L
+	{0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11},	// M
+	{0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11},	// N
+	{0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},	// O
+	{0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10},	// P
+	{0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D},	// Q
+	{0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11},	// R
+	{0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E},	// S
+	{0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},	// T
+	{0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},	// U
+	{0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04},	// V
+	{0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A},	// W
+	{0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11},	// X
+	{0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04},	// Y
+	{0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F},	// Z
+};
+
+static const unsigned char enterGlyph[GLYPH_HEIGHT] = {0x01, 0x01, 0x05, 0x09, 0x1F, 0x08, 0x04};
+static const unsigned char deleteGlyph[GLYPH_HEIGHT] = {0x00, 0x04, 0x08, 0x1F, 0x08, 0x04, 0x00};
+
+SoftwareRenderer::SoftwareRenderer(const Rect* bounds)
+{
+	frame = *bounds;
+	width = frame.right - frame.left;
+	height = frame.bottom - frame.top;
+	pixels = new unsigned char[(long)width * height];
+	memset(pixels, RenderWhite, (long)width * height);
+	pixelsTouched = 0;
+	scale = 1;
+}
+
+SoftwareRenderer::~SoftwareRenderer()
+{
+	delete[] pixels;
+}
+
+// Fills [left, right) of one row, clipped to the frame
+void SoftwareRenderer::span(short v, short left, short right, RenderColor color)
+{
+	if (v < frame.top || v >= frame.bottom)
+	{
+		return;
+	}
+	if (left < frame.left)
+	{
+		left = frame.left;
+	}
+	if (right > frame.right)
+	{
+		right = frame.right;
+	}
+	if (left >= right)
+	{
+		return;
+	}
+
+	memset(pixels + (long)(v - frame.top) * width + (left - frame.left), color, right - left);
+	pixelsTouched += right - left;
+}
+
+void SoftwareRenderer::plot(short h, short v, RenderColor color)
+{
+	span(v, h, h + 1, color);
+}
+
+void SoftwareRenderer::eraseRect(const Rect* r)
+{
+	fillRect(r, RenderWhite);
+}
+
+void SoftwareRenderer::fillRect(const Rect* r, RenderColor color)
+{
+	for (short v = r->top; v < r->bottom; v++)
+	{
+		span(v, r->left, r->right, color);
+	}
+}
+
+// Corners are quarter circles of half the diameter, as close to QuickDraw's as integers allow
+void SoftwareRenderer::fillRoundRect(const Rect* r, short diameter, RenderColor color)
+{
+	short radius = diameter / 2;
+
+	for (short v = r->top; v < r->bottom; v++)
+	{
+		short fromEdge = v - r->top;
+		if (r->bottom - 1 - v < fromEdge)
+		{
+			fromEdge = r->bottom - 1 - v;
+		}
+
+		short inset = 0;
+		if (fromEdge < radius)
+		{
+			short dy = radius - fromEdge;
+			short dx = 0;
+			while ((dx + 1) * (dx + 1) + dy * dy <= radius * radius)
+			{
+				dx++;
+			}
+			inset = radius - dx;
+		}
+
+		span(v, r->left + inset, r->right - inset, color);
+	}
+}
+
+void SoftwareRenderer::frameRect(const Rect* r, RenderColor color)
+{
+	if (r->bottom <= r->top || r->right <= r->left)
+	{
+		return;
+	}
+
+	span(r->top, r->left, r->right, color);
+	span(r->bottom - 1, r->left, r->right, color);
+
+	for (short v = r->top + 1; v < r->bottom - 1; v++)
+	{
+		plot(r->left, v, color);
+		plot(r->right - 1, v, color);
+	}
+}
+
+void SoftwareRenderer::drawLine(short h1, short v1, short h2, short v2, RenderColor color)
+{
+	short dh = (h2 > h1) ? h2 - h1 : h1 - h2;
+	short dv = (v2 > v1) ? v2 - v1 : v1 - v2;
+	short stepH = (h2 > h1) ? 1 : -1;
+	short stepV = (v2 > v1) ? 1 : -1;
+	short error = dh - dv;
+
+	while (TRUE)
+	{
+		plot(h1, v1, color);
+		if (h1 == h2 && v1 == v2)
+		{
+			break;
+		}
+
+		short twice = 2 * error;
+		if (twice > -dv)
+		{
+			error -= dv;
+			h1 += stepH;
+		}
+		if (twice < dh)
+		{
+			error += dh;
+			v1 += stepV;
+		}
+	}
+}
+
+// Both fonts share the bitmap font; the size only picks the scale
+void SoftwareRenderer::setFont(RenderFont /* font */, short size)
+{
+	scale = (size + GLYPH_DESCENT * 2) / (GLYPH_HEIGHT + GLYPH_DESCENT);
+	if (scale < 1)
+	{
+		scale = 1;
+	}
+}
+
+void SoftwareRenderer::fontMetrics(short* ascent, short* descent)
+{
+	*ascent = GLYPH_HEIGHT * scale;
+	*descent = GLYPH_DESCENT * scale;
+}
+
+short SoftwareRenderer::charWidth(char /* c */)
+{
+	return GLYPH_ADVANCE * scale;
+}
+
+const unsigned char* SoftwareRenderer::glyph(char c)
+{
+	if (c == ENTER_GLYPH)
+	{
+		return enterGlyph;
+	}
+	if (c == DELETE_GLYPH)
+	{
+		return deleteGlyph;
+	}
+	if (c >= 'a' && c <= 'z')
+	{
+		c = c - 'a' + 'A';
+	}
+	if (c < ' ' || c > 'Z')
+	{
+		return font[0];
+	}
+	return font[c - ' '];
+}
+
+// (h, v) is the left end of the baseline, as with QuickDraw's pen
+void SoftwareRenderer::drawChar(short h, short v, char c, RenderColor color)
+{
+	const unsigned char* rows = glyph(c);
+	short top = v - GLYPH_HEIGHT * scale;
+
+	for (short row = 0; row < GLYPH_HEIGHT; row++)
+	{
+		for (short col = 0; col < GLYPH_WIDTH; col++)
+		{
+			if (rows[row] & (0x10 >> col))
+			{
+				Rect dot;
+				dot.left = h + col * scale;
+				dot.top = top + row * scale;
+				dot.right = dot.left + scale;
+				dot.bottom = dot.top + scale;
+				fillRect(&dot, color);
+			}
+		}
+	}
+}
+
+void SoftwareRenderer::drawText(short h, short v, const char* text, RenderColor color)
+{
+	for (; *text != '\0'; text++)
+	{
+		drawChar(h, v, *text, color);
+		h += charWidth(*text);
+	}
+}
+
+// Nearest-neighbour scaling when the rects differ in size, as CopyBits does with srcCopy
+void SoftwareRenderer::copyFrom(Renderer* source, const Rect* srcRect, const Rect* dstRect)
+{
+	SoftwareRenderer* from = (SoftwareRenderer*)source;
+	short srcWidth = srcRect->right - srcRect->left;
+	short srcHeight = srcRect->bottom - srcRect->top;
+	short dstWidth = dstRect->right - dstRect->left;
+	short dstHeight = dstRect->bottom - dstRect->top;
+
+	if (srcWidth <= 0 || srcHeight <= 0 || dstWidth <= 0 || dstHeight <= 0)
+	{
+		return;
+	}
+
+	if (srcWidth == dstWidth && srcHeight == dstHeight)
+	{
+		copyRows(from, srcRect, dstRect);
+		return;
+	}
+
+	for (short y = 0; y < dstHeight; y++)
+	{
+		short v = dstRect->top + y;
+		short sv = srcRect->top + (short)(((long)y * srcHeight) / dstHeight);
+
+		if (v < frame.top || v >= frame.bottom || sv < from->frame.top || sv >= from->frame.bottom)
+		{
+			continue;
+		}
+
+		unsigned char* dst = pixels + (long)(v - frame.top) * width;
+		const unsigned char* src = from->pixels + (long)(sv - from->frame.top) * from->width;
+
+		for (short x = 0; x < dstWidth; x++)
+		{
+			short h = dstRect->left + x;
+			short sh = srcRect->left + (short)(((long)x * srcWidth) / dstWidth);
+
+			if (h < frame.left || h >= frame.right || sh < from->frame.left || sh >= from->frame.right)
+			{
+				continue;
+			}
+
+			dst[h - frame.left] = src[sh - from->frame.left];
+			pixelsTouched++;
+		}
+	}
+}
+
+// Unscaled copies move whole clipped rows at a time
+void SoftwareRenderer::copyRows(const SoftwareRenderer* from, const Rect* srcRect, const Rect* dstRect)
+{
+	short dh = dstRect->left - srcRect->left;
+	short dv = dstRect->top - srcRect->top;
+
+	// Clip in source coordinates against both frames
+	short left = MAX(srcRect->left, MAX(from->frame.left, frame.left - dh));
+	short right = MIN(srcRect->right, MIN(from->frame.right, frame.right - dh));
+	short top = MAX(srcRect->top, MAX(from->frame.top, frame.top - dv));
+	short bottom = MIN(srcRect->bottom, MIN(from->frame.bottom, frame.bottom - dv));
+
+	if (left >= right)
+	{
+		return;
+	}
+
+	for (short v = top; v < bottom; v++)
+	{
+		memcpy(pixels + (long)(v + dv - frame.top) * width + (left + dh - frame.left),
+				from->pixels + (long)(v - from->frame.top) * from->width + (left - from->frame.left),
+				right - left);
+		pixelsTouched += right - left;
+	}
+}
+
+// Binary PPM, viewable with most image tools
+BOOL SoftwareRenderer::writePPM(const char* path)
+{
+	FILE* file = fopen(path, "wb");
+	if (file == NULL)
+	{
+		return FALSE;
+	}
+
+	fprintf(file, "P6\n%d %d\n255\n", width, height);
+
+	for (long i = 0; i < (long)width * height; i++)
+	{
+		const RGBColor* rgb = &renderRGB[pixels[i]];
+		fputc(rgb->red >> 8, file);
+		fputc(rgb->green >> 8, file);
+		fputc(rgb->blue >> 8, file);
+	}
+
+	fclose(file);
+	return TRUE;
+}
+
+// Returns the number of differing pixels, or -1 if the file is missing or a different size
+long SoftwareRenderer::comparePPM(const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		return -1;
+	}
+
+	int fileWidth = 0;
+	int fileHeight = 0;
+	int maxValue = 0;
+
+	if (fscanf(file, "P6 %d %d %d", &fileWidth, &fileHeight, &maxValue) != 3 ||
+		fileWidth != width || fileHeight != height || maxValue != 255)
+	{
+		fclose(file);
+		return -1;
+	}
+	fgetc(file);
+
+	long differences = 0;
+
+	for (long i = 0; i < (long)width * height; i++)
+	{
+		const RGBColor* rgb = &renderRGB[pixels[i]];
+		int red = fgetc(file);
+		int green = fgetc(file);
+		int blue = fgetc(file);
+
+		if (blue == EOF)
+		{
+			fclose(file);
+			return -1;
+		}
+
+		if (red != (rgb->red >> 8) || green != (rgb->green >> 8) || blue != (rgb->blue >> 8))
+		{
+			differences++;
+		}
+	}
+
+	fclose(file);
+	return differences;
+}
+
+long SoftwareRenderer::compare(const SoftwareRenderer* other)
+{
+	if (other->width != width || other->height != height)
+	{
+		return -1;
+	}
+
+	long differences = 0;
+	for (long i = 0; i < (long)width * height; i++)
+	{
+		if (pixels[i] != other->pixels[i])
+		{
+			differences++;
+		}
+	}
+
+	return differences;
+}
+
+// FNV-1a over the size and every pixel, small enough to keep a golden image as one line
+unsigned long SoftwareRenderer::checksum()
+{
+	unsigned long hash = 2166136261UL;
+	unsigned char size[4] = {(unsigned char)(width >> 8), (unsigned char)width,
+							(unsigned char)(height >> 8), (unsigned char)height};
+
+	for (int i = 0; i < 4; i++)
+	{
+		hash = ((hash ^ size[i]) * 16777619UL) & 0xFFFFFFFFUL;
+	}
+
+	for (long i = 0; i < (long)width * height; i++)
+	{
+		hash = ((hash ^ pixels[i]) * 16777619UL) & 0xFFFFFFFFUL;
+	}
+
+	return hash;
+}
@@ -0,0 +1,73 @@
+#ifndef SWRENDER_HH
+#define SWRENDER_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "../painter.hh"
+
+// Built in 5x7 font in a 6x9 cell, scaled by whole pixels to approximate point sizes
+#define GLYPH_WIDTH (5)
+#define GLYPH_HEIGHT (7)
+#define GLYPH_ADVANCE (6)
+#define GLYPH_DESCENT (2)
+
+// Renders into a framebuffer of RenderColor indices, so results can be compared exactly
+class SoftwareRenderer : public Renderer
+{
+public:
+	SoftwareRenderer(const Rect* bounds);
+	~SoftwareRenderer();
+
+	void eraseRect(const Rect* r);
+	void fillRect(const Rect* r, RenderColor color);
+	void fillRoundRect(const Rect* r, short diameter, RenderColor color);
+	void frameRect(const Rect* r, RenderColor color);
+	void drawLine(short h1, short v1, short h2, short v2, RenderColor color);
+
+	void setFont(RenderFont font, short size);
+	void fontMetrics(short* ascent, short* descent);
+	short charWidth(char c);
+	void drawChar(short h, short v, char c, RenderColor color);
+	void drawText(short h, short v, const char* text, RenderColor color);
+
+	void copyFrom(Renderer* source, const Rect* srcRect, const Rect* dstRect);
+
+	BOOL writePPM(const char* path);
+	long comparePPM(const char* path);
+	long compare(const SoftwareRenderer* other);
+	unsigned long checksum();
+
+	short width;
+	short height;
+
+	// Pixel writes since construction or the last reset
+	long pixelsTouched;
+
+private:
+	void span(short v, short left, short right, RenderColor color);
+	void plot(short h, short v, RenderColor color);
+	void copyRows(const SoftwareRenderer* from, const Rect* srcRect, const Rect* dstRect);
+	const unsigned char* glyph(char c);
+
+	Rect frame;
+	unsigned char* pixels;
+	short scale;
+};
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+// Prints a trace dumped with File > Save Trace, one record per line with the ticks since the
+// first record and since the previous one.
+//
+//   tracedecode "MacWords Trace"
+
+#include "../trace.hh"
+
+#include <stdio.h>
+
+static BOOL getLong(FILE* file, unsigned long* value)
+{
+	unsigned long result = 0;
+
+	for (int i = 0; i < 4; i++)
+	{
+		int c = fgetc(file);
+		if (c == EOF)
+		{
+			return FALSE;
+		}
+		result = (result << 8) | (unsigned long)c;
+	}
+
+	*value = result;
+	return TRUE;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 2)
+	{
+		fprintf(stderr, "usage: tracedecode tracefile\n");
+		return 2;
+	}
+
+	FILE* file = fopen(argv[1], "rb");
+	if (file == NULL)
+	{
+		fprintf(stderr, "can't open %s\n", argv[1]);
+		return 1;
+	}
+
+	unsigned long magic;
+	unsigned long count;
+
+	if (!getLong(file, &magic) || magic != TRACE_MAGIC || !getLong(file, &count))
+	{
+		fprintf(stderr, "%s is not a MacWords trace\n", argv[1]);
+		fclose(file);
+		return 1;
+	}
+
+	unsigned long firstTicks = 0;
+	unsigned long lastTicks = 0;
+
+	for (unsigned long i = 0; i < count; i++)
+	{
+		unsigned long ticks;
+		unsigned long event;
+		unsigned long arg1;
+		unsigned long arg2;
+
+		if (!getLong(file, &ticks) || !getLong(file, &event) || !getLong(file, &arg1) || !getLong(file, &arg2))
+		{
+			fprintf(stderr, "trace ends after %lu of %lu records\n", i, count);
+			fclose(file);
+			return 1;
+		}
+
+		if (i == 0)
+		{
+			firstTicks = ticks;
+			lastTicks = ticks;
+		}
+
+		const char* name = (event < NUM_TRACE_EVENTS) ? traceEventNames[event] : "unknown";
+
+		// Arguments are signed on the Mac
+		printf("%8lu %6lu  %-20s %11ld %11ld\n", ticks - firstTicks, ticks - lastTicks, name,
+				(long)(int)arg1, (long)(int)arg2);
+
+		lastTicks = ticks;
+	}
+
+	fclose(file);
+	return 0;
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+#include "wordlists.hh"
+
+#include <MacMemory.h>
+#include <Quickdraw.h>
+#include <Resources.h>
+#include <Sound.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+WordList wordLists[NUM_WORD_LISTS];
+const int listSizes[NUM_WORD_LISTS] = {NUM_DAILY_WORDS, NUM_WORDS_A, NUM_WORDS_B};
+int beeps = 0;
+
+long randSeed = 1;
+
+short Random()
+{
+	// Park and Miller's minimal standard generator, as QuickDraw uses
+	randSeed = (long)(((unsigned long long)randSeed * 16807) % 0x7FFFFFFF);
+
+	short result = (short)(randSeed & 0xFFFF);
+	return (result == -32768) ? 0 : result;
+}
+
+void HLock(Handle /* h */)
+{
+}
+
+void HUnlock(Handle /* h */)
+{
+}
+
+void HPurge(Handle /* h */)
+{
+}
+
+void LoadResource(Handle /* h */)
+{
+}
+
+void SysBeep(short /* duration */)
+{
+	beeps++;
+}
+
+Handle GetResource(ResType type, short id)
+{
+	int list = id - FIRST_WORD_LIST_ID;
+
+	if (type != 'TEXT' || list < 0 || list >= NUM_WORD_LISTS || wordLists[list].data == NULL)
+	{
+		return NULL;
+	}
+
+	return &wordLists[list].handle;
+}
+
+static int hexValue(char c)
+{
+	if (c >= '0' && c <= '9')
+	{
+		return c - '0';
+	}
+	else if (c >= 'A' && c <= 'F')
+	{
+		return c - 'A' + 10;
+	}
+	else if (c >= 'a' && c <= 'f')
+	{
+		return c - 'a' + 10;
+	}
+
+	return -1;
+}
+
+// Decodes the $"..." strings of one DeRez data block, skipping the comments after each line
+static long decodeBlock(const char* text, Ptr out)
+{
+	long size = 0;
+	const char* p = text;
+
+	while (*p != '\0')
+	{
+		if (p[0] == '/' && p[1] == '*')
+		{
+			const char* close = strstr(p + 2, "*/");
+			if (close == NULL)
+			{
+				break;
+			}
+			p = close + 2;
+		}
+		else if (p[0] == '}' && p[1] == ';')
+		{
+			break;
+		}
+		else if (p[0] == '$' && p[1] == '"')
+		{
+			p += 2;
+			int high = -1;
+			for (; *p != '"' && *p != '\0'; p++)
+			{
+				int value = hexValue(*p);
+				if (value < 0)
+				{
+					continue;
+				}
+
+				if (high < 0)
+				{
+					high = value;
+				}
+				else
+				{
+					out[size++] = (char)((high << 4) | value);
+					high = -1;
+				}
+			}
+
+			if (*p == '"')
+			{
+				p++;
+			}
+		}
+		else
+		{
+			p++;
+		}
+	}
+
+	return size;
+}
+
+BOOL loadWordLists(const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		fprintf(stderr, "can't open %s\n", path);
+		return FALSE;
+	}
+
+	fseek(file, 0, SEEK_END);
+	long length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	char* text = (char*)malloc(length + 1);
+	long got = fread(text, 1, length, file);
+	fclose(file);
+	text[got] = '\0';
+
+	BOOL ok = TRUE;
+
+	for (int list = 0; list < NUM_WORD_LISTS; list++)
+	{
+		char header[32];
+		sprintf(header, "data 'TEXT' (%d", FIRST_WORD_LIST_ID + list);
+
+		const char* block = strstr(text, header);
+		if (block == NULL)
+		{
+			fprintf(stderr, "%s has no TEXT %d resource\n", path, FIRST_WORD_LIST_ID + list);
+			ok = FALSE;
+			continue;
+		}
+
+		// The hex text is always more than twice the size of the data it encodes
+		WordList* words = &wordLists[list];
+		words->data = (Ptr)malloc(strlen(block) / 2 + 1);
+		words->size = decodeBlock(strchr(block, '{'), words->data);
+		words->handle = words->data;
+
+		long count = (words->size + 1) / WORD_STRIDE;
+		if (count != listSizes[list])
+		{
+			fprintf(stderr, "TEXT %d has %ld words, the engine expects %d\n",
+					FIRST_WORD_LIST_ID + list, count, listSizes[list]);
+			ok = FALSE;
+		}
+	}
+
+	free(text);
+	return ok;
+}
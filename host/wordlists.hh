@@ -0,0 +1,46 @@
+#ifndef WORDLISTS_HH
+#define WORDLISTS_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+// The Toolbox calls the engine makes, answered from the word lists in macwords.r so the engine
+// can run on a host. Shared by the host tools that drive the engine.
+
+#include "../engine.hh"
+
+#define NUM_WORD_LISTS (3)
+#define FIRST_WORD_LIST_ID (128)
+#define WORD_STRIDE (WORD_LENGTH + 1)
+
+struct WordList
+{
+	Ptr data;
+	long size;
+	Ptr handle;
+};
+
+extern WordList wordLists[NUM_WORD_LISTS];
+extern const int listSizes[NUM_WORD_LISTS];
+
+// SysBeep calls so far; the engine beeps when it can't load a word list
+extern int beeps;
+
+BOOL loadWordLists(const char* path);
+
+#endif
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "idle.hh"
+#include <Events.h>
+#include "timing.hh"
+#include "trace.hh"
+
+IdleScheduler idleScheduler;
+
+IdleScheduler::IdleScheduler()
+{
+	numTasks = 0;
+	runs = 0;
+	finished = 0;
+	doneCalls = 0;
+	doneMicros = 0;
+	totalMicros = 0;
+}
+
+// A task already queued only has its priority changed. Returns FALSE when the queue is full,
+// so the caller can do the work when it is needed instead.
+BOOL IdleScheduler::add(IdleWork work, void* owner, IdlePriority priority)
+{
+	int index = find(work, owner);
+	if (index >= 0)
+	{
+		tasks[index].priority = priority;
+		return TRUE;
+	}
+
+	if (numTasks >= MAX_IDLE_TASKS)
+	{
+		return FALSE;
+	}
+
+	IdleTask* t = &tasks[numTasks++];
+	t->work = work;
+	t->owner = owner;
+	t->priority = priority;
+	t->lastRun = runs;
+	t->calls = 0;
+	t->micros = 0;
+	return TRUE;
+}
+
+void IdleScheduler::cancel(IdleWork work, void* owner)
+{
+	int index = find(work, owner);
+	if (index >= 0)
+	{
+		remove(index);
+	}
+}
+
+// For owners being deleted, which must not be called back
+void IdleScheduler::cancel(void* owner)
+{
+	int i = 0;
+	while (i < numTasks)
+	{
+		if (tasks[i].owner == owner)
+		{
+			remove(i);
+		}
+		else
+		{
+			i++;
+		}
+	}
+}
+
+void IdleScheduler::step()
+{
+	if (numTasks == 0)
+	{
+		return;
+	}
+
+	long start = TickCount();
+	EventRecord pending;
+
+	do
+	{
+		// Pending input always comes first
+		if (EventAvail(keyDownMask | autoKeyMask | mDownMask, &pending))
+		{
+			break;
+		}
+
+		int index = next();
+		IdleTask* t = &tasks[index];
+
+		unsigned long began = microseconds();
+		BOOL done = t->work(t->owner);
+		unsigned long spent = microseconds() - began;
+
+		t->calls++;
+		t->micros += spent;
+		t->lastRun = ++runs;
+		totalMicros += spent;
+
+		if (done)
+		{
+			TRACE(TraceIdleTask, t->calls, t->micros);
+			finished++;
+			doneCalls += t->calls;
+			doneMicros += t->micros;
+			remove(index);
+		}
+	}
+	while (numTasks > 0 && TickCount() - start < IDLE_SLICE_TICKS);
+}
+
+// How long WaitNextEvent may sleep; queued work wants null events as often as they come
+long IdleScheduler::sleepTicks()
+{
+	if (numTasks > 0)
+	{
+		return 0;
+	}
+	return 10L;
+}
+
+int IdleScheduler::taskCount()
+{
+	return numTasks;
+}
+
+unsigned long IdleScheduler::finishedCount()
+{
+	return finished;
+}
+
+unsigned long IdleScheduler::finishedCalls()
+{
+	return doneCalls;
+}
+
+unsigned long IdleScheduler::finishedMicros()
+{
+	return doneMicros;
+}
+
+unsigned long IdleScheduler::busyMicros()
+{
+	return totalMicros;
+}
+
+int IdleScheduler::find(IdleWork work, void* owner)
+{
+	for (int i = 0; i < numTasks; i++)
+	{
+		if (tasks[i].work == work && tasks[i].owner == owner)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+// The highest priority task that has waited longest since its last call
+int IdleScheduler::next()
+{
+	int best = 0;
+	for (int i = 1; i < numTasks; i++)
+	{
+		if (tasks[i].priority > tasks[best].priority ||
+			(tasks[i].priority == tasks[best].priority && tasks[i].lastRun < tasks[best].lastRun))
+		{
+			best = i;
+		}
+	}
+	return best;
+}
+
+void IdleScheduler::remove(int index)
+{
+	numTasks--;
+	tasks[index] = tasks[numTasks];
+}
@@ -0,0 +1,93 @@
+#ifndef IDLE_HH
+#define IDLE_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+
+#include "engine.hh"
+
+// Most background tasks queued at once across all windows
+#define MAX_IDLE_TASKS (8)
+
+// Ticks one null event may spend on background work before going back to WaitNextEvent
+#define IDLE_SLICE_TICKS (1)
+
+enum IdlePriority
+{
+	IdleLow,
+	IdleNormal,
+	IdleHigh
+};
+
+// Does one small piece of work and returns TRUE once there is nothing left to do. A call
+// should stay well under a tick, since input is only checked between calls. Work functions
+// must not add or cancel tasks themselves.
+typedef BOOL (*IdleWork)(void* owner);
+
+struct IdleTask
+{
+	IdleWork work;
+	void* owner;
+	IdlePriority priority;
+	// Order of the last call, so tasks of equal priority take turns
+	unsigned long lastRun;
+	unsigned long calls;
+	unsigned long micros;
+};
+
+// Runs background work on null events, highest priority first, and stops as soon as a key or
+// click is waiting. Tasks are identified by their work function and owner.
+class IdleScheduler
+{
+public:
+	IdleScheduler();
+
+	BOOL add(IdleWork work, void* owner, IdlePriority priority);
+	void cancel(IdleWork work, void* owner);
+	void cancel(void* owner);
+	void step();
+	long sleepTicks();
+
+	int taskCount();
+	unsigned long finishedCount();
+	unsigned long finishedCalls();
+	unsigned long finishedMicros();
+	unsigned long busyMicros();
+
+private:
+	int find(IdleWork work, void* owner);
+	int next();
+	void remove(int index);
+
+	IdleTask tasks[MAX_IDLE_TASKS];
+	int numTasks;
+	unsigned long runs;
+
+	// Calls and time of the tasks that ran to completion
+	unsigned long finished;
+	unsigned long doneCalls;
+	unsigned long doneMicros;
+
+	// Time spent by every task, including those already finished or cancelled
+	unsigned long totalMicros;
+};
+
+extern IdleScheduler idleScheduler;
+
+#endif
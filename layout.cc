@@ -0,0 +1,294 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+#include "layout.hh"
+#include <string.h>
+
+#define FIXED_ONE (0x10000L)
+
+// Truncates toward zero, as a float to short conversion does
+static short fixTrunc(Fixed f)
+{
+	if (f >= 0)
+	{
+		return (short)(f >> 16);
+	}
+	return (short)-((-f) >> 16);
+}
+
+static Fixed fixFromInt(long i)
+{
+	return i * FIXED_ONE;
+}
+
+static void setCell(Rect* r, Fixed left, Fixed top, short size)
+{
+	r->left = fixTrunc(left);
+	r->top = fixTrunc(top);
+	r->right = r->left + size;
+	r->bottom = r->top + size;
+}
+
+static void growBounds(Rect* bounds, const Rect* r)
+{
+	if (r->top < bounds->top)
+	{
+		bounds->top = r->top;
+	}
+	if (r->left < bounds->left)
+	{
+		bounds->left = r->left;
+	}
+	if (r->bottom > bounds->bottom)
+	{
+		bounds->bottom = r->bottom;
+	}
+	if (r->right > bounds->right)
+	{
+		bounds->right = r->right;
+	}
+}
+
+BoardLayout::BoardLayout()
+{
+	lastContent.top = 0;
+	lastContent.left = 0;
+	lastContent.bottom = 0;
+	lastContent.right = 0;
+
+	for (int row = 0; row < KEYBOARD_NUM_ROWS; row++)
+	{
+		lastRowLengths[row] = 0;
+	}
+
+	keySize = 0;
+	tileSize = 0;
+	bounds = lastContent;
+	keyBounds = lastContent;
+	memset(hitGrid, HIT_NO_KEY, sizeof(hitGrid));
+}
+
+// Returns TRUE when the rects were recalculated for a new content rect
+BOOL BoardLayout::update(const Rect* content, const int* rowLengths)
+{
+	int row;
+	BOOL changed = content->top != lastContent.top ||
+					content->left != lastContent.left ||
+					content->bottom != lastContent.bottom ||
+					content->right != lastContent.right;
+
+	int maxRowLen = 0;
+	for (row = 0; row < KEYBOARD_NUM_ROWS; row++)
+	{
+		if (rowLengths[row] != lastRowLengths[row])
+		{
+			changed = TRUE;
+		}
+		if (rowLengths[row] > maxRowLen)
+		{
+			maxRowLen = rowLengths[row];
+		}
+	}
+
+	if (!changed)
+	{
+		return FALSE;
+	}
+
+	lastContent = *content;
+	for (row = 0; row < KEYBOARD_NUM_ROWS; row++)
+	{
+		lastRowLengths[row] = rowLengths[row];
+	}
+
+	long winWidth = content->right - content->left;
+	long winHeight = content->bottom - content->top;
+
+	// Keyboard, anchored to the bottom of the content
+	Fixed buttonWidth = fixFromInt(winWidth) / (maxRowLen + 1);
+	Fixed spacerWidth = buttonWidth / (maxRowLen + 1);
+	Fixed keyPitch = buttonWidth + spacerWidth;
+
+	keySize = fixTrunc(buttonWidth);
+
+	short vertOffset = fixTrunc(fixFromInt(winHeight) - (KEYBOARD_NUM_ROWS * keyPitch + spacerWidth));
+
+	for (row = 0; row < KEYBOARD_NUM_ROWS; row++)
+	{
+		int numMissingKeys = maxRowLen - rowLengths[row];
+		Fixed top = fixFromInt(vertOffset) + row * keyPitch;
+
+		for (int col = 0; col < rowLengths[row]; col++)
+		{
+			Fixed left = spacerWidth + keyPitch * col + (keyPitch / 2) * numMissingKeys;
+			setCell(&keyRects[row][col], left, top, keySize);
+
+			if (row == 0 && col == 0)
+			{
+				bounds = keyRects[0][0];
+			}
+			growBounds(&bounds, &keyRects[row][col]);
+		}
+	}
+
+	keyBounds = bounds;
+	buildHitGrid(rowLengths);
+
+	// Grid, as large as fits above the keyboard and centred horizontally
+	Fixed boardWidthCalc = fixFromInt(winWidth) / (WORD_LENGTH + 1);
+	Fixed boardHeightCalc = fixFromInt(vertOffset) / (NUM_OF_GUESSES + 1);
+	Fixed boardButtonWidth = (boardWidthCalc < boardHeightCalc) ? boardWidthCalc : boardHeightCalc;
+	Fixed boardSpacerWidth = boardButtonWidth / (WORD_LENGTH + 1);
+	Fixed tilePitch = boardButtonWidth + boardSpacerWidth;
+
+	Fixed boardEmptySpace = fixFromInt(winWidth) - WORD_LENGTH * tilePitch;
+
+	tileSize = fixTrunc(boardButtonWidth);
+
+	for (int boardRow = 0; boardRow < NUM_OF_GUESSES; boardRow++)
+	{
+		Fixed top = boardSpacerWidth + tilePitch * boardRow;
+
+		for (int boardCol = 0; boardCol < WORD_LENGTH; boardCol++)
+		{
+			Fixed left = boardSpacerWidth + tilePitch * boardCol + boardEmptySpace / 2;
+			setCell(&tileRects[boardRow][boardCol], left, top, tileSize);
+			growBounds(&bounds, &tileRects[boardRow][boardCol]);
+		}
+	}
+
+	return TRUE;
+}
+
+short BoardLayout::hitColumn(short h) const
+{
+	return (short)(((long)(h - keyBounds.left) * HIT_GRID_COLS) / (keyBounds.right - keyBounds.left));
+}
+
+short BoardLayout::hitRow(short v) const
+{
+	return (short)(((long)(v - keyBounds.top) * HIT_GRID_ROWS) / (keyBounds.bottom - keyBounds.top));
+}
+
+// Rebuilt with the key rects, so a click costs a cell lookup and a few rect tests
+void BoardLayout::buildHitGrid(const int* rowLengths)
+{
+	memset(hitGrid, HIT_NO_KEY, sizeof(hitGrid));
+
+	if (keyBounds.right <= keyBounds.left || keyBounds.bottom <= keyBounds.top)
+	{
+		return;
+	}
+
+	for (int row = 0; row < KEYBOARD_NUM_ROWS; row++)
+	{
+		for (int col = 0; col < rowLengths[row]; col++)
+		{
+			const Rect* r = &keyRects[row][col];
+
+			for (short v = hitRow(r->top); v <= hitRow(r->bottom - 1); v++)
+			{
+				for (short h = hitColumn(r->left); h <= hitColumn(r->right - 1); h++)
+				{
+					unsigned char* cell = hitGrid[v][h];
+					for (int i = 0; i < HIT_CELL_KEYS; i++)
+					{
+						if (cell[i] == HIT_NO_KEY)
+						{
+							cell[i] = (unsigned char)(row * KEYBOARD_MAX_ROW_LEN + col);
+							break;
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+// Returns FALSE for points between keys or outside the keyboard
+BOOL BoardLayout::keyAt(Point where, int* row, int* col) const
+{
+	if (where.h < keyBounds.left || where.h >= keyBounds.right ||
+		where.v < keyBounds.top || where.v >= keyBounds.bottom)
+	{
+		return FALSE;
+	}
+
+	const unsigned char* cell = hitGrid[hitRow(where.v)][hitColumn(where.h)];
+
+	for (int i = 0; i < HIT_CELL_KEYS && cell[i] != HIT_NO_KEY; i++)
+	{
+		int keyRow = cell[i] / KEYBOARD_MAX_ROW_LEN;
+		int keyCol = cell[i] % KEYBOARD_MAX_ROW_LEN;
+		const Rect* r = &keyRects[keyRow][keyCol];
+
+		if (where.h >= r->left && where.h < r->right && where.v >= r->top && where.v < r->bottom)
+		{
+			*row = keyRow;
+			*col = keyCol;
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+// Wide enough for whichever of the tile and key rows is longer
+void atlasBounds(short tileSize, short keySize, Rect* bounds)
+{
+	bounds->left = 0;
+	bounds->top = 0;
+	bounds->right = (ALPHABET_LENGTH + 1) * tileSize;
+	if (NUM_ATLAS_KEYS * keySize > bounds->right)
+	{
+		bounds->right = NUM_ATLAS_KEYS * keySize;
+	}
+	bounds->bottom = NUM_TILE_STATES * (tileSize + keySize);
+}
+
+// A letter of '\0' is the blank tile
+Rect atlasTile(short tileSize, char letter, letterScore score)
+{
+	short index = (letter == '\0') ? 0 : letter - 'A' + 1;
+
+	Rect r;
+	r.left = index * tileSize;
+	r.top = score * tileSize;
+	r.right = r.left + tileSize;
+	r.bottom = r.top + tileSize;
+	return r;
+}
+
+Rect atlasKey(short tileSize, short keySize, char key, letterScore score)
+{
+	short index = key - 'A';
+	if (key == '\n')
+	{
+		index = ALPHABET_LENGTH;
+	}
+	else if (key == '\b')
+	{
+		index = ALPHABET_LENGTH + 1;
+	}
+
+	Rect r;
+	r.left = index * keySize;
+	r.top = NUM_TILE_STATES * tileSize + score * keySize;
+	r.right = r.left + keySize;
+	r.bottom = r.top + keySize;
+	return r;
+}
@@ -0,0 +1,79 @@
+#ifndef LAYOUT_HH
+#define LAYOUT_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+#include <MacTypes.h>
+#include "engine.hh"
+
+#define KEYBOARD_NUM_ROWS (3)
+#define KEYBOARD_MAX_ROW_LEN (10)
+
+// Coarse grid over the keyboard for hit-testing. A cell is narrower than a key pitch and
+// shorter than a row pitch, so it overlaps at most two keys in each of two rows.
+#define HIT_GRID_COLS (2 * KEYBOARD_MAX_ROW_LEN)
+#define HIT_GRID_ROWS (2 * KEYBOARD_NUM_ROWS)
+#define HIT_CELL_KEYS (4)
+#define HIT_NO_KEY (0xFF)
+
+// A board's atlas has one row of tiles for each letterScore, blank tile first, then one row of
+// keys for each letterScore with Enter and Delete after Z
+#define NUM_TILE_STATES (4)
+#define NUM_ATLAS_KEYS (ALPHABET_LENGTH + 2)
+
+// Positions of every grid tile and keyboard key for one content rect.
+// Computed with 16.16 fixed point integer math only, so it needs no FPU and
+// gives the same pixels on 68k, PPC and host builds.
+class BoardLayout
+{
+public:
+	BoardLayout();
+
+	BOOL update(const Rect* content, const int* rowLengths);
+	BOOL keyAt(Point where, int* row, int* col) const;
+
+	// The content rect the rects were last calculated for
+	const Rect* content() const { return &lastContent; }
+
+	Rect keyRects[KEYBOARD_NUM_ROWS][KEYBOARD_MAX_ROW_LEN];
+	Rect tileRects[NUM_OF_GUESSES][WORD_LENGTH];
+
+	short keySize;
+	short tileSize;
+
+	// Bounding box of the grid and keyboard
+	Rect bounds;
+
+private:
+	void buildHitGrid(const int* rowLengths);
+	short hitColumn(short h) const;
+	short hitRow(short v) const;
+
+	// Keys overlapping each cell, as row * KEYBOARD_MAX_ROW_LEN + col
+	unsigned char hitGrid[HIT_GRID_ROWS][HIT_GRID_COLS][HIT_CELL_KEYS];
+	Rect keyBounds;
+
+	Rect lastContent;
+	int lastRowLengths[KEYBOARD_NUM_ROWS];
+};
+
+void atlasBounds(short tileSize, short keySize, Rect* bounds);
+Rect atlasTile(short tileSize, char letter, letterScore score);
+Rect atlasKey(short tileSize, short keySize, char key, letterScore score);
+
+#endif
\ No newline at end of file
@@ -1 +1 @@
-data 'MBAR' (128) {	$"0004 0080 0081 0082 0083"                           /* ...... */};data 'MENU' (128) {	$"0080 0000 0000 0000 0000 FFFF FFFB 0114"            /* ........... */	$"0E41 626F 7574 204D 6163 576F 7264 7300"            /* .About MacWords. */	$"0000 0001 2D00 0000 0000"                           /* ....-..... */};data 'MENU' (129) {	$"0081 0000 0000 0000 0000 FFFF FFFF 0446"            /* ..........F */	$"696C 6504 5175 6974 0051 0000 00"                   /* ile.Quit.Q... */};data 'MENU' (130) {	$"0082 0000 0000 0000 0000 FFFF FFFF 0445"            /* ..........E */	$"6469 7404 436F 7079 0043 0000 0543 6C65"            /* dit.Copy.C...Cle */	$"6172 0000 0000 00"                                  /* ar..... */};data 'MENU' (131) {	$"0083 0000 0000 0000 0000 FFFF FFFF 0447"            /* ..........G */	$"616D 6508 4E65 7720 4761 6D65 0042 0000"            /* ame.New Game.B.. */	$"0C43 6C6F 7365 2057 696E 646F 7700 5700"            /* .Close Window.W. */	$"0000"                                               /* .. */};data 'WIND' (129) {	$"0028 0028 00BE 00FF 0002 0100 0000 0000"            /* .(.(.......... */	$"0000 0A4E 6577 2057 696E 646F 77"                   /* ...New Window */};data 'WIND' (130) {	$"0040 0020 00C0 00E8 0004 0100 0100 0000"            /* .@. .......... */	$"0000 0A4E 6577 2057 696E 646F 77"                   /* ...New Window */};data 'WIND' (128) {	$"002C 0028 0154 0128 0000 0100 0100 0000"            /* .,.(.T.(........ */	$"0000 0A4E 6577 2057 696E 646F 77"                   /* ...New Window */};data 'TEXT' (130) {	$"4C4F 5552 590D 4C4F 5554 530D 4C4F 5641"            /* LOURYLOUTSLOVA */	$"540D 4C4F 5645 440D 4C4F 5645 530D 4C4F"            /* TLOVEDLOVESLO */	$"5645 590D 4C4F 5649 450D 4C4F 5741 4E0D"            /* VEYLOVIELOWAN */	$"4C4F 5745 440D 4C4F 5745 530D 4C4F 574E"            /* LOWEDLOWESLOWN */	$"440D 4C4F 574E 450D 4C4F 574E 530D 4C4F"            /* DLOWNELOWNSLO */	$"5750 530D 4C4F 5752 590D 4C4F 5753 450D"            /* WPSLOWRYLOWSE */	$"4C4F 5754 530D 4C4F 5845 440D 4C4F 5845"            /* LOWTSLOXEDLOXE */	$"530D 4C4F 5A45 4E0D 4C55 4143 480D 4C55"            /* SLOZENLUACHLU */	$"4155 530D 4C55 4245 440D 4C55 4245 530D"            /* AUSLUBEDLUBES */	$"4C55 4252 410D 4C55 4345 530D 4C55 434B"            /* LUBRALUCESLUCK */	$"530D 4C55 4352 450D 4C55 4445 530D 4C55"            /* SLUCRELUDESLU */	$"4449 430D 4C55 444F 530D 4C55 4646 410D"            /* DICLUDOSLUFFA */	$"4C55 4646 530D 4C55 4745 440D 4C55 4745"            /* LUFFSLUGEDLUGE */	$"520D 4C55 4745 530D 4C55 4C4C 530D 4C55"            /* RLUGESLULLSLU */	$"4C55 530D 4C55 4D41 530D 4C55 4D42 490D"            /* LUSLUMASLUMBI */	$"4C55 4D4D 450D 4C55 4D4D 590D 4C55 4D50"            /* LUMMELUMMYLUMP */	$"530D 4C55 4E41 530D 4C55 4E45 530D 4C55"            /* SLUNASLUNESLU */	$"4E45 540D 4C55 4E47 490D 4C55 4E47 530D"            /* NETLUNGILUNGS */	$"4C55 4E4B 530D 4C55 4E54 530D 4C55 5049"            /* LUNKSLUNTSLUPI */	$"4E0D 4C55 5245 440D 4C55 5245 520D 4C55"            /* NLUREDLURERLU */	$"5245 530D 4C55 5245 580D 4C55 5247 490D"            /* RESLUREXLURGI */	$"4C55 5247 590D 4C55 524B 530D 4C55 5252"            /* LURGYLURKSLURR */	$"590D 4C55 5256 450D 4C55 5345 520D 4C55"            /* YLURVELUSERLU */	$"5348 590D 4C55 534B 530D 4C55 5354 530D"            /* SHYLUSKSLUSTS */	$"4C55 5355 530D 4C55 5445 410D 4C55 5445"            /* LUSUSLUTEALUTE */	$"440D 4C55 5445 520D 4C55 5445 530D 4C55"            /* DLUTERLUTESLU */	$"5656 590D 4C55 5845 440D 4C55 5845 520D"            /* VVYLUXEDLUXER */	$"4C55 5845 530D 4C57 4549 530D 4C59 414D"            /* LUXESLWEISLYAM */	$"530D 4C59 4152 440D 4C59 4152 540D 4C59"            /* SLYARDLYARTLY */	$"4153 450D 4C59 4345 410D 4C59 4345 450D"            /* ASELYCEALYCEE */	$"4C59 4352 410D 4C59 4D45 530D 4C59 4E43"            /* LYCRALYMESLYNC */	$"480D 4C59 4E45 530D 4C59 5245 530D 4C59"            /* HLYNESLYRESLY */	$"5345 440D 4C59 5345 530D 4C59 5349 4E0D"            /* SEDLYSESLYSIN */	$"4C59 5349 530D 4C59 534F 4C0D 4C59 5353"            /* LYSISLYSOLLYSS */	$"410D 4C59 5445 440D 4C59 5445 530D 4C59"            /* ALYTEDLYTESLY */	$"5448 450D 4C59 5449 430D 4C59 5454 410D"            /* THELYTICLYTTA */	$"4D41 4145 440D 4D41 4152 450D 4D41 4152"            /* MAAEDMAAREMAAR */	$"530D 4D41 4245 530D 4D41 4341 530D 4D41"            /* SMABESMACASMA */	$"4345 440D 4D41 4345 520D 4D41 4345 530D"            /* CEDMACERMACES */	$"4D41 4348 450D 4D41 4348 490D 4D41 4348"            /* MACHEMACHIMACH */	$"530D 4D41 434B 530D 4D41 434C 450D 4D41"            /* SMACKSMACLEMA */	$"434F 4E0D 4D41 4447 450D 4D41 4449 440D"            /* CONMADGEMADID */	$"4D41 4452 450D 4D41 4552 4C0D 4D41 4649"            /* MADREMAERLMAFI */	$"430D 4D41 4745 530D 4D41 4747 530D 4D41"            /* CMAGESMAGGSMA */	$"474F 540D 4D41 4755 530D 4D41 484F 450D"            /* GOTMAGUSMAHOE */	$"4D41 4855 410D 4D41 4857 410D 4D41 4944"            /* MAHUAMAHWAMAID */	$"530D 4D41 494B 4F0D 4D41 494B 530D 4D41"            /* SMAIKOMAIKSMA */	$"494C 450D 4D41 494C 4C0D 4D41 494C 530D"            /* ILEMAILLMAILS */	$"4D41 494D 530D 4D41 494E 530D 4D41 4952"            /* MAIMSMAINSMAIR */	$"450D 4D41 4952 530D 4D41 4953 450D 4D41"            /* EMAIRSMAISEMA */	$"4953 540D 4D41 4B41 520D 4D41 4B45 530D"            /* ISTMAKARMAKES */	$"4D41 4B49 530D 4D41 4B4F 530D 4D41 4C41"            /* MAKISMAKOSMALA */	$"4D0D 4D41 4C41 520D 4D41 4C41 530D 4D41"            /* MMALARMALASMA */	$"4C41 580D 4D41 4C45 530D 4D41 4C49 430D"            /* LAXMALESMALIC */	$"4D41 4C49 4B0D 4D41 4C49 530D 4D41 4C4C"            /* MALIKMALISMALL */	$"530D 4D41 4C4D 530D 4D41 4C4D 590D 4D41"            /* SMALMSMALMYMA */	$"4C54 530D 4D41 4C54 590D 4D41 4C55 530D"            /* LTSMALTYMALUS */	$"4D41 4C56 410D 4D41 4C57 410D 4D41 4D41"            /* MALVAMALWAMAMA */	$"530D 4D41 4D42 410D 4D41 4D45 450D 4D41"            /* SMAMBAMAMEEMA */	$"4D45 590D 4D41 4D49 450D 4D41 4E41 530D"            /* MEYMAMIEMANAS */	$"4D41 4E41 540D 4D41 4E44 490D 4D41 4E45"            /* MANATMANDIMANE */	$"420D 4D41 4E45 440D 4D41 4E45 480D 4D41"            /* BMANEDMANEHMA */	$"4E45 530D 4D41 4E45 540D 4D41 4E47 530D"            /* NESMANETMANGS */	$"4D41 4E49 530D 4D41 4E4B 590D 4D41 4E4E"            /* MANISMANKYMANN */	$"410D 4D41 4E4F 530D 4D41 4E53 450D 4D41"            /* AMANOSMANSEMA */	$"4E54 410D 4D41 4E54 4F0D 4D41 4E54 590D"            /* NTAMANTOMANTY */	$"4D41 4E55 4C0D 4D41 4E55 530D 4D41 5041"            /* MANULMANUSMAPA */	$"550D 4D41 5155 490D 4D41 5241 450D 4D41"            /* UMAQUIMARAEMA */	$"5241 480D 4D41 5241 530D 4D41 5243 530D"            /* RAHMARASMARCS */	$"4D41 5244 590D 4D41 5245 530D 4D41 5247"            /* MARDYMARESMARG */	$"450D 4D41 5247 530D 4D41 5249 410D 4D41"            /* EMARGSMARIAMA */	$"5249 440D 4D41 524B 410D 4D41 524B 530D"            /* RIDMARKAMARKS */	$"4D41 524C 450D 4D41 524C 530D 4D41 524C"            /* MARLEMARLSMARL */	$"590D 4D41 524D 530D 4D41 524F 4E0D 4D41"            /* YMARMSMARONMA */	$"524F 520D 4D41 5252 410D 4D41 5252 490D"            /* RORMARRAMARRI */	$"4D41 5253 450D 4D41 5254 530D 4D41 5256"            /* MARSEMARTSMARV */	$"590D 4D41 5341 530D 4D41 5345 440D 4D41"            /* YMASASMASEDMA */	$"5345 520D 4D41 5345 530D 4D41 5348 590D"            /* SERMASESMASHY */	$"4D41 534B 530D 4D41 5353 410D 4D41 5353"            /* MASKSMASSAMASS */	$"590D 4D41 5354 530D 4D41 5354 590D 4D41"            /* YMASTSMASTYMA */	$"5355 530D 4D41 5441 490D 4D41 5445 440D"            /* SUSMATAIMATED */	$"4D41 5445 520D 4D41 5445 530D 4D41 5448"            /* MATERMATESMATH */	$"530D 4D41 5449 4E0D 4D41 544C 4F0D 4D41"            /* SMATINMATLOMA */	$"5454 450D 4D41 5454 530D 4D41 545A 410D"            /* TTEMATTSMATZA */	$"4D41 545A 4F0D 4D41 5542 590D 4D41 5544"            /* MATZOMAUBYMAUD */	$"530D 4D41 554C 530D 4D41 554E 440D 4D41"            /* SMAULSMAUNDMA */	$"5552 490D 4D41 5553 590D 4D41 5554 530D"            /* URIMAUSYMAUTS */	$"4D41 555A 590D 4D41 5645 4E0D 4D41 5649"            /* MAUZYMAVENMAVI */	$"450D 4D41 5649 4E0D 4D41 5649 530D 4D41"            /* EMAVINMAVISMA */	$"5745 440D 4D41 574B 530D 4D41 574B 590D"            /* WEDMAWKSMAWKY */	$"4D41 574E 530D 4D41 5752 530D 4D41 5845"            /* MAWNSMAWRSMAXE */	$"440D 4D41 5845 530D 4D41 5849 530D 4D41"            /* DMAXESMAXISMA */	$"5941 4E0D 4D41 5941 530D 4D41 5945 440D"            /* YANMAYASMAYED */	$"4D41 594F 530D 4D41 5953 540D 4D41 5A45"            /* MAYOSMAYSTMAZE */	$"440D 4D41 5A45 520D 4D41 5A45 530D 4D41"            /* DMAZERMAZESMA */	$"5A45 590D 4D41 5A55 540D 4D42 4952 410D"            /* ZEYMAZUTMBIRA */	$"4D45 4144 530D 4D45 414C 530D 4D45 414E"            /* MEADSMEALSMEAN */	$"450D 4D45 414E 530D 4D45 414E 590D 4D45"            /* EMEANSMEANYME */	$"4152 450D 4D45 4153 450D 4D45 4154 480D"            /* AREMEASEMEATH */	$"4D45 4154 530D 4D45 424F 530D 4D45 4348"            /* MEATSMEBOSMECH */	$"530D 4D45 434B 530D 4D45 4449 490D 4D45"            /* SMECKSMEDIIME */	$"444C 450D 4D45 4544 530D 4D45 4552 530D"            /* DLEMEEDSMEERS */	$"4D45 4554 530D 4D45 4646 530D 4D45 494E"            /* MEETSMEFFSMEIN */	$"530D 4D45 494E 540D 4D45 494E 590D 4D45"            /* SMEINTMEINYME */	$"4954 480D 4D45 4B4B 410D 4D45 4C41 530D"            /* ITHMEKKAMELAS */	$"4D45 4C42 410D 4D45 4C44 530D 4D45 4C49"            /* MELBAMELDSMELI */	$"430D 4D45 4C49 4B0D 4D45 4C4C 530D 4D45"            /* CMELIKMELLSME */	$"4C54 530D 4D45 4C54 590D 4D45 4D45 530D"            /* LTSMELTYMEMES */	$"4D45 4D4F 530D 4D45 4E41 440D 4D45 4E44"            /* MEMOSMENADMEND */	$"530D 4D45 4E45 440D 4D45 4E45 530D 4D45"            /* SMENEDMENESME */	$"4E47 450D 4D45 4E47 530D 4D45 4E53 410D"            /* NGEMENGSMENSA */	$"4D45 4E53 450D 4D45 4E53 480D 4D45 4E54"            /* MENSEMENSHMENT */	$"410D 4D45 4E54 4F0D 4D45 4E55 530D 4D45"            /* AMENTOMENUSME */	$"4F55 530D 4D45 4F57 530D 4D45 5243 480D"            /* OUSMEOWSMERCH */	$"4D45 5243 530D 4D45 5244 450D 4D45 5245"            /* MERCSMERDEMERE */	$"440D 4D45 5245 4C0D 4D45 5245 520D 4D45"            /* DMERELMERERME */	$"5245 530D 4D45 5249 4C0D 4D45 5249 530D"            /* RESMERILMERIS */	$"4D45 524B 530D 4D45 524C 450D 4D45 524C"            /* MERKSMERLEMERL */	$"530D 4D45 5253 450D 4D45 5341 4C0D 4D45"            /* SMERSEMESALME */	$"5341 530D 4D45 5345 4C0D 4D45 5345 530D"            /* SASMESELMESES */	$"4D45 5348 590D 4D45 5349 430D 4D45 534E"            /* MESHYMESICMESN */	$"450D 4D45 534F 4E0D 4D45 5353 590D 4D45"            /* EMESONMESSYME */	$"5354 4F0D 4D45 5445 440D 4D45 5445 530D"            /* STOMETEDMETES */	$"4D45 5448 4F0D 4D45 5448 530D 4D45 5449"            /* METHOMETHSMETI */	$"430D 4D45 5449 460D 4D45 5449 530D 4D45"            /* CMETIFMETISME */	$"544F 4C0D 4D45 5452 450D 4D45 5553 450D"            /* TOLMETREMEUSE */	$"4D45 5645 440D 4D45 5645 530D 4D45 5745"            /* MEVEDMEVESMEWE */	$"440D 4D45 574C 530D 4D45 594E 540D 4D45"            /* DMEWLSMEYNTME */	$"5A45 530D 4D45 5A5A 450D 4D45 5A5A 4F0D"            /* ZESMEZZEMEZZO */	$"4D48 4F52 520D 4D49 414F 550D 4D49 414F"            /* MHORRMIAOUMIAO */	$"570D 4D49 4153 4D0D 4D49 4155 4C0D 4D49"            /* WMIASMMIAULMI */	$"4341 530D 4D49 4348 450D 4D49 4348 540D"            /* CASMICHEMICHT */	$"4D49 434B 530D 4D49 434B 590D 4D49 434F"            /* MICKSMICKYMICO */	$"530D 4D49 4352 410D 4D49 4444 590D 4D49"            /* SMICRAMIDDYMI */	$"4447 590D 4D49 4449 530D 4D49 454E 530D"            /* DGYMIDISMIENS */	$"4D49 4556 450D 4D49 4646 530D 4D49 4646"            /* MIEVEMIFFSMIFF */	$"590D 4D49 4654 590D 4D49 4747 530D 4D49"            /* YMIFTYMIGGSMI */	$"4841 530D 4D49 4849 530D 4D49 4B45 440D"            /* HASMIHISMIKED */	$"4D49 4B45 530D 4D49 4B52 410D 4D49 4B56"            /* MIKESMIKRAMIKV */	$"410D 4D49 4C43 480D 4D49 4C44 530D 4D49"            /* AMILCHMILDSMI */	$"4C45 520D 4D49 4C45 530D 4D49 4C46 530D"            /* LERMILESMILFS */	$"4D49 4C49 410D 4D49 4C4B 4F0D 4D49 4C4B"            /* MILIAMILKOMILK */	$"530D 4D49 4C4C 450D 4D49 4C4C 530D 4D49"            /* SMILLEMILLSMI */	$"4C4F 520D 4D49 4C4F 530D 4D49 4C50 410D"            /* LORMILOSMILPA */	$"4D49 4C54 530D 4D49 4C54 590D 4D49 4C54"            /* MILTSMILTYMILT */	$"5A0D 4D49 4D45 440D 4D49 4D45 4F0D 4D49"            /* ZMIMEDMIMEOMI */	$"4D45 520D 4D49 4D45 530D 4D49 4D53 590D"            /* MERMIMESMIMSY */	$"4D49 4E41 450D 4D49 4E41 520D 4D49 4E41"            /* MINAEMINARMINA */	$"530D 4D49 4E43 590D 4D49 4E44 530D 4D49"            /* SMINCYMINDSMI */	$"4E45 440D 4D49 4E45 530D 4D49 4E47 450D"            /* NEDMINESMINGE */	$"4D49 4E47 530D 4D49 4E47 590D 4D49 4E49"            /* MINGSMINGYMINI */	$"530D 4D49 4E4B 450D 4D49 4E4B 530D 4D49"            /* SMINKEMINKSMI */	$"4E4E 590D 4D49 4E4F 530D 4D49 4E54 530D"            /* NNYMINOSMINTS */	$"4D49 5245 440D 4D49 5245 530D 4D49 5245"            /* MIREDMIRESMIRE */	$"580D 4D49 5249 440D 4D49 5249 4E0D 4D49"            /* XMIRIDMIRINMI */	$"524B 530D 4D49 524B 590D 4D49 524C 590D"            /* RKSMIRKYMIRLY */	$"4D49 524F 530D 4D49 5256 530D 4D49 525A"            /* MIROSMIRVSMIRZ */	$"410D 4D49 5343 480D 4D49 5344 4F0D 4D49"            /* AMISCHMISDOMI */	$"5345 530D 4D49 5347 4F0D 4D49 534F 530D"            /* SESMISGOMISOS */	$"4D49 5353 410D 4D49 5354 530D 4D49 5354"            /* MISSAMISTSMIST */	$"590D 4D49 5443 480D 4D49 5445 520D 4D49"            /* YMITCHMITERMI */	$"5445 530D 4D49 5449 530D 4D49 5452 450D"            /* TESMITISMITRE */	$"4D49 5454 530D 4D49 5845 440D 4D49 5845"            /* MITTSMIXEDMIXE */	$"4E0D 4D49 5845 520D 4D49 5845 530D 4D49"            /* NMIXERMIXESMI */	$"5854 450D 4D49 5855 500D 4D49 5A45 4E0D"            /* XTEMIXUPMIZEN */	$"4D49 5A5A 590D 4D4E 454D 450D 4D4F 414E"            /* MIZZYMNEMEMOAN */	$"530D 4D4F 4154 530D 4D4F 4242 590D 4D4F"            /* SMOATSMOBBYMO */	$"4245 530D 4D4F 4245 590D 4D4F 4249 450D"            /* BESMOBEYMOBIE */	$"4D4F 424C 450D 4D4F 4348 490D 4D4F 4348"            /* MOBLEMOCHIMOCH */	$"530D 4D4F 4348 590D 4D4F 434B 530D 4D4F"            /* SMOCHYMOCKSMO */	$"4445 520D 4D4F 4445 530D 4D4F 4447 450D"            /* DERMODESMODGE */	$"4D4F 4449 490D 4D4F 4455 530D 4D4F 4552"            /* MODIIMODUSMOER */	$"530D 4D4F 464F 530D 4D4F 4747 590D 4D4F"            /* SMOFOSMOGGYMO */	$"4845 4C0D 4D4F 484F 530D 4D4F 4852 530D"            /* HELMOHOSMOHRS */	$"4D4F 4855 410D 4D4F 4855 520D 4D4F 494C"            /* MOHUAMOHURMOIL */	$"450D 4D4F 494C 530D 4D4F 4952 410D 4D4F"            /* EMOILSMOIRAMO */	$"4952 450D 4D4F 4954 530D 4D4F 4A4F 530D"            /* IREMOITSMOJOS */	$"4D4F 4B45 530D 4D4F 4B49 530D 4D4F 4B4F"            /* MOKESMOKISMOKO */	$"530D 4D4F 4C41 4C0D 4D4F 4C41 530D 4D4F"            /* SMOLALMOLASMO */	$"4C44 530D 4D4F 4C45 440D 4D4F 4C45 530D"            /* LDSMOLEDMOLES */	$"4D4F 4C4C 410D 4D4F 4C4C 530D 4D4F 4C4C"            /* MOLLAMOLLSMOLL */	$"590D 4D4F 4C54 4F0D 4D4F 4C54 530D 4D4F"            /* YMOLTOMOLTSMO */	$"4C59 530D 4D4F 4D45 530D 4D4F 4D4D 410D"            /* LYSMOMESMOMMA */	$"4D4F 4D4D 590D 4D4F 4D55 530D 4D4F 4E41"            /* MOMMYMOMUSMONA */	$"440D 4D4F 4E41 4C0D 4D4F 4E41 530D 4D4F"            /* DMONALMONASMO */	$"4E44 450D 4D4F 4E44 4F0D 4D4F 4E45 520D"            /* NDEMONDOMONER */	$"4D4F 4E47 4F0D 4D4F 4E47 530D 4D4F 4E49"            /* MONGOMONGSMONI */	$"430D 4D4F 4E49 450D 4D4F 4E4B 530D 4D4F"            /* CMONIEMONKSMO */	$"4E4F 530D 4D4F 4E54 450D 4D4F 4E54 590D"            /* NOSMONTEMONTY */	$"4D4F 4F42 530D 4D4F 4F43 480D 4D4F 4F44"            /* MOOBSMOOCHMOOD */	$"530D 4D4F 4F45 440D 4D4F 4F4B 530D 4D4F"            /* SMOOEDMOOKSMO */	$"4F4C 410D 4D4F 4F4C 490D 4D4F 4F4C 530D"            /* OLAMOOLIMOOLS */	$"4D4F 4F4C 590D 4D4F 4F4E 470D 4D4F 4F4E"            /* MOOLYMOONGMOON */	$"530D 4D4F 4F4E 590D 4D4F 4F50 530D 4D4F"            /* SMOONYMOOPSMO */	$"4F52 530D 4D4F 4F52 590D 4D4F 4F54 530D"            /* ORSMOORYMOOTS */	$"4D4F 4F56 450D 4D4F 5045 440D 4D4F 5045"            /* MOOVEMOPEDMOPE */	$"520D 4D4F 5045 530D 4D4F 5045 590D 4D4F"            /* RMOPESMOPEYMO */	$"5050 590D 4D4F 5053 590D 4D4F 5055 530D"            /* PPYMOPSYMOPUS */	$"4D4F 5241 450D 4D4F 5241 530D 4D4F 5241"            /* MORAEMORASMORA */	$"540D 4D4F 5241 590D 4D4F 5245 4C0D 4D4F"            /* TMORAYMORELMO */	$"5245 530D 4D4F 5249 410D 4D4F 524E 450D"            /* RESMORIAMORNE */	$"4D4F 524E 530D 4D4F 5252 410D 4D4F 5252"            /* MORNSMORRAMORR */	$"4F0D 4D4F 5253 450D 4D4F 5254 530D 4D4F"            /* OMORSEMORTSMO */	$"5345 440D 4D4F 5345 530D 4D4F 5345 590D"            /* SEDMOSESMOSEY */	$"4D4F 534B 530D 4D4F 5353 4F0D 4D4F 5354"            /* MOSKSMOSSOMOST */	$"450D 4D4F 5354 530D 4D4F 5445 440D 4D4F"            /* EMOSTSMOTEDMO */	$"5445 4E0D 4D4F 5445 530D 4D4F 5445 540D"            /* TENMOTESMOTET */	$"4D4F 5445 590D 4D4F 5448 530D 4D4F 5448"            /* MOTEYMOTHSMOTH */	$"590D 4D4F 5449 530D 4D4F 5454 450D 4D4F"            /* YMOTISMOTTEMO */	$"5454 530D 4D4F 5454 590D 4D4F 5455 530D"            /* TTSMOTTYMOTUS */	$"4D4F 545A 410D 4D4F 5543 480D 4D4F 5545"            /* MOTZAMOUCHMOUE */	$"530D 4D4F 554C 440D 4D4F 554C 530D 4D4F"            /* SMOULDMOULSMO */	$"5550 530D 4D4F 5553 540D 4D4F 5553 590D"            /* UPSMOUSTMOUSY */	$"4D4F 5645 440D 4D4F 5645 530D 4D4F 5741"            /* MOVEDMOVESMOWA */	$"530D 4D4F 5745 440D 4D4F 5752 410D 4D4F"            /* SMOWEDMOWRAMO */	$"5841 530D 4D4F 5849 450D 4D4F 5941 530D"            /* XASMOXIEMOYAS */	$"4D4F 594C 450D 4D4F 594C 530D 4D4F 5A45"            /* MOYLEMOYLSMOZE */	$"440D 4D4F 5A45 530D 4D4F 5A4F 530D 4D50"            /* DMOZESMOZOSMP */	$"5245 540D 4D55 4348 4F0D 4D55 4349 430D"            /* RETMUCHOMUCIC */	$"4D55 4349 440D 4D55 4349 4E0D 4D55 434B"            /* MUCIDMUCINMUCK */	$"530D 4D55 434F 520D 4D55 4352 4F0D 4D55"            /* SMUCORMUCROMU */	$"4447 450D 4D55 4449 520D 4D55 4452 410D"            /* DGEMUDIRMUDRA */	$"4D55 4646 530D 4D55 4654 490D 4D55 4747"            /* MUFFSMUFTIMUGG */	$"410D 4D55 4747 530D 4D55 4747 590D 4D55"            /* AMUGGSMUGGYMU */	$"484C 590D 4D55 4944 530D 4D55 494C 530D"            /* HLYMUIDSMUILS */	$"4D55 4952 530D 4D55 4953 540D 4D55 4A49"            /* MUIRSMUISTMUJI */	$"4B0D 4D55 4C43 540D 4D55 4C45 440D 4D55"            /* KMULCTMULEDMU */	$"4C45 530D 4D55 4C45 590D 4D55 4C47 410D"            /* LESMULEYMULGA */	$"4D55 4C49 450D 4D55 4C4C 410D 4D55 4C4C"            /* MULIEMULLAMULL */	$"530D 4D55 4C53 450D 4D55 4C53 480D 4D55"            /* SMULSEMULSHMU */	$"4D4D 530D 4D55 4D50 530D 4D55 4D53 590D"            /* MMSMUMPSMUMSY */	$"4D55 4D55 530D 4D55 4E47 410D 4D55 4E47"            /* MUMUSMUNGAMUNG */	$"450D 4D55 4E47 4F0D 4D55 4E47 530D 4D55"            /* EMUNGOMUNGSMU */	$"4E49 530D 4D55 4E54 530D 4D55 4E54 550D"            /* NISMUNTSMUNTU */	$"4D55 4F4E 530D 4D55 5241 530D 4D55 5245"            /* MUONSMURASMURE */	$"440D 4D55 5245 530D 4D55 5245 580D 4D55"            /* DMURESMUREXMU */	$"5249 440D 4D55 524B 530D 4D55 524C 530D"            /* RIDMURKSMURLS */	$"4D55 524C 590D 4D55 5252 410D 4D55 5252"            /* MURLYMURRAMURR */	$"450D 4D55 5252 490D 4D55 5252 530D 4D55"            /* EMURRIMURRSMU */	$"5252 590D 4D55 5254 490D 4D55 5256 410D"            /* RRYMURTIMURVA */	$"4D55 5341 520D 4D55 5343 410D 4D55 5345"            /* MUSARMUSCAMUSE */	$"440D 4D55 5345 520D 4D55 5345 530D 4D55"            /* DMUSERMUSESMU */	$"5345 540D 4D55 5348 410D 4D55 5349 540D"            /* SETMUSHAMUSIT */	$"4D55 534B 530D 4D55 534F 530D 4D55 5353"            /* MUSKSMUSOSMUSS */	$"450D 4D55 5353 590D 4D55 5354 480D 4D55"            /* EMUSSYMUSTHMU */	$"5354 530D 4D55 5443 480D 4D55 5445 440D"            /* STSMUTCHMUTED */	$"4D55 5445 520D 4D55 5445 530D 4D55 5448"            /* MUTERMUTESMUTH */	$"410D 4D55 5449 530D 4D55 544F 4E0D 4D55"            /* AMUTISMUTONMU */	$"5454 530D 4D55 5845 440D 4D55 5845 530D"            /* TTSMUXEDMUXES */	$"4D55 5A41 4B0D 4D55 5A5A 590D 4D56 554C"            /* MUZAKMUZZYMVUL */	$"450D 4D59 414C 4C0D 4D59 4C41 520D 4D59"            /* EMYALLMYLARMY */	$"4E41 480D 4D59 4E41 530D 4D59 4F49 440D"            /* NAHMYNASMYOID */	$"4D59 4F4D 410D 4D59 4F50 450D 4D59 4F50"            /* MYOMAMYOPEMYOP */	$"530D 4D59 4F50 590D 4D59 5349 440D 4D59"            /* SMYOPYMYSIDMY */	$"5448 490D 4D59 5448 530D 4D59 5448 590D"            /* THIMYTHSMYTHY */	$"4D59 584F 530D 4D5A 4545 530D 4E41 414D"            /* MYXOSMZEESNAAM */	$"530D 4E41 414E 530D 4E41 4245 530D 4E41"            /* SNAANSNABESNA */	$"4249 530D 4E41 424B 530D 4E41 424C 410D"            /* BISNABKSNABLA */	$"4E41 424F 420D 4E41 4348 450D 4E41 4348"            /* NABOBNACHENACH */	$"4F0D 4E41 4352 450D 4E41 4441 530D 4E41"            /* ONACRENADASNA */	$"4556 450D 4E41 4556 490D 4E41 4646 530D"            /* EVENAEVINAFFS */	$"4E41 4741 530D 4E41 4747 590D 4E41 474F"            /* NAGASNAGGYNAGO */	$"520D 4E41 4841 4C0D 4E41 4941 440D 4E41"            /* RNAHALNAIADNA */	$"4946 530D 4E41 494B 530D 4E41 494C 530D"            /* IFSNAIKSNAILS */	$"4E41 4952 410D 4E41 4952 550D 4E41 4B45"            /* NAIRANAIRUNAKE */	$"440D 4E41 4B45 520D 4E41 4B46 410D 4E41"            /* DNAKERNAKFANA */	$"4C41 530D 4E41 4C45 440D 4E41 4C4C 410D"            /* LASNALEDNALLA */	$"4E41 4D45 440D 4E41 4D45 520D 4E41 4D45"            /* NAMEDNAMERNAME */	$"530D 4E41 4D4D 410D 4E41 4D55 530D 4E41"            /* SNAMMANAMUSNA */	$"4E41 530D 4E41 4E43 450D 4E41 4E43 590D"            /* NASNANCENANCY */	$"4E41 4E44 550D 4E41 4E4E 410D 4E41 4E4F"            /* NANDUNANNANANO */	$"530D 4E41 4E55 410D 4E41 5041 530D 4E41"            /* SNANUANAPASNA */	$"5045 440D 4E41 5045 530D 4E41 504F 4F0D"            /* PEDNAPESNAPOO */	$"4E41 5050 410D 4E41 5050 450D 4E41 5050"            /* NAPPANAPPENAPP */	$"590D 4E41 5241 530D 4E41 5243 4F0D 4E41"            /* YNARASNARCONA */	$"5243 530D 4E41 5244 530D 4E41 5245 530D"            /* RCSNARDSNARES */	$"4E41 5249 430D 4E41 5249 530D 4E41 524B"            /* NARICNARISNARK */	$"530D 4E41 524B 590D 4E41 5252 450D 4E41"            /* SNARKYNARRENA */	$"5348 490D 4E41 5443 480D 4E41 5445 530D"            /* SHINATCHNATES */	$"4E41 5449 530D 4E41 5454 590D 4E41 5543"            /* NATISNATTYNAUC */	$"480D 4E41 554E 540D 4E41 5641 520D 4E41"            /* HNAUNTNAVARNA */	$"5645 530D 4E41 5645 570D 4E41 5656 590D"            /* VESNAVEWNAVVY */	$"4E41 5741 420D 4E41 5A45 530D 4E41 5A49"            /* NAWABNAZESNAZI */	$"520D 4E41 5A49 530D 4E44 554A 410D 4E45"            /* RNAZISNDUJANE */	$"4146 450D 4E45 414C 530D 4E45 4150 530D"            /* AFENEALSNEAPS */	$"4E45 4152 530D 4E45 4154 480D 4E45 4154"            /* NEARSNEATHNEAT */	$"530D 4E45 4245 4B0D 4E45 4245 4C0D 4E45"            /* SNEBEKNEBELNE */	$"434B 530D 4E45 4444 590D 4E45 4544 530D"            /* CKSNEDDYNEEDS */	$"4E45 454C 440D 4E45 454C 450D 4E45 454D"            /* NEELDNEELENEEM */	$"420D 4E45 454D 530D 4E45 4550 530D 4E45"            /* BNEEMSNEEPSNE */	$"4553 450D 4E45 455A 450D 4E45 4752 4F0D"            /* ESENEEZENEGRO */	$"4E45 4755 530D 4E45 4946 530D 4E45 4953"            /* NEGUSNEIFSNEIS */	$"540D 4E45 4956 450D 4E45 4C49 530D 4E45"            /* TNEIVENELISNE */	$"4C4C 590D 4E45 4D41 530D 4E45 4D4E 530D"            /* LLYNEMASNEMNS */	$"4E45 4D50 540D 4E45 4E45 530D 4E45 4F4E"            /* NEMPTNENESNEON */	$"530D 4E45 5045 520D 4E45 5049 540D 4E45"            /* SNEPERNEPITNE */	$"5241 4C0D 4E45 5244 530D 4E45 524B 410D"            /* RALNERDSNERKA */	$"4E45 524B 530D 4E45 524F 4C0D 4E45 5254"            /* NERKSNEROLNERT */	$"530D 4E45 5254 5A0D 4E45 5256 590D 4E45"            /* SNERTZNERVYNE */	$"5354 530D 4E45 5445 530D 4E45 544F 500D"            /* STSNETESNETOP */	$"4E45 5454 530D 4E45 5454 590D 4E45 554B"            /* NETTSNETTYNEUK */	$"530D 4E45 554D 450D 4E45 554D 530D 4E45"            /* SNEUMENEUMSNE */	$"5645 4C0D 4E45 5645 530D 4E45 5655 530D"            /* VELNEVESNEVUS */	$"4E45 5742 530D 4E45 5745 440D 4E45 5745"            /* NEWBSNEWEDNEWE */	$"4C0D 4E45 5749 450D 4E45 5753 590D 4E45"            /* LNEWIENEWSYNE */	$"5754 530D 4E45 5854 530D 4E45 5855 530D"            /* WTSNEXTSNEXUS */	$"4E47 4149 4F0D 4E47 414E 410D 4E47 4154"            /* NGAIONGANANGAT */	$"490D 4E47 4F4D 410D 4E47 5745 450D 4E49"            /* INGOMANGWEENI */	$"4341 440D 4E49 4348 540D 4E49 434B 530D"            /* CADNICHTNICKS */	$"4E49 434F 4C0D 4E49 4441 4C0D 4E49 4445"            /* NICOLNIDALNIDE */	$"440D 4E49 4445 530D 4E49 444F 520D 4E49"            /* DNIDESNIDORNI */	$"4455 530D 4E49 4546 530D 4E49 4556 450D"            /* DUSNIEFSNIEVE */	$"4E49 4645 530D 4E49 4646 530D 4E49 4646"            /* NIFESNIFFSNIFF */	$"590D 4E49 4654 590D 4E49 4745 520D 4E49"            /* YNIFTYNIGERNI */	$"4748 530D 4E49 4849 4C0D 4E49 4B41 420D"            /* GHSNIHILNIKAB */	$"4E49 4B41 480D 4E49 4B41 550D 4E49 4C4C"            /* NIKAHNIKAUNILL */	$"530D 4E49 4D42 490D 4E49 4D42 530D 4E49"            /* SNIMBINIMBSNI */	$"4D50 530D 4E49 4E45 520D 4E49 4E45 530D"            /* MPSNINERNINES */	$"4E49 4E4F 4E0D 4E49 5041 530D 4E49 5050"            /* NINONNIPASNIPP */	$"590D 4E49 5141 420D 4E49 524C 530D 4E49"            /* YNIQABNIRLSNI */	$"524C 590D 4E49 5345 490D 4E49 5353 450D"            /* RLYNISEINISSE */	$"4E49 5355 530D 4E49 5445 520D 4E49 5445"            /* NISUSNITERNITE */	$"530D 4E49 5449 440D 4E49 544F 4E0D 4E49"            /* SNITIDNITONNI */	$"5452 450D 4E49 5452 4F0D 4E49 5452 590D"            /* TRENITRONITRY */	$"4E49 5454 590D 4E49 5641 4C0D 4E49 5845"            /* NITTYNIVALNIXE */	$"440D 4E49 5845 520D 4E49 5845 530D 4E49"            /* DNIXERNIXESNI */	$"5849 450D 4E49 5A41 4D0D 4E4B 4F53 490D"            /* XIENIZAMNKOSI */	$"4E4F 4148 530D 4E4F 4242 590D 4E4F 434B"            /* NOAHSNOBBYNOCK */	$"530D 4E4F 4441 4C0D 4E4F 4444 590D 4E4F"            /* SNODALNODDYNO */	$"4445 530D 4E4F 4455 530D 4E4F 454C 530D"            /* DESNODUSNOELS */	$"4E4F 4747 530D 4E4F 484F 570D 4E4F 494C"            /* NOGGSNOHOWNOIL */	$"530D 4E4F 494C 590D 4E4F 494E 540D 4E4F"            /* SNOILYNOINTNO */	$"4952 530D 4E4F 4C45 530D 4E4F 4C4C 530D"            /* IRSNOLESNOLLS */	$"4E4F 4C4F 530D 4E4F 4D41 530D 4E4F 4D45"            /* NOLOSNOMASNOME */	$"4E0D 4E4F 4D45 530D 4E4F 4D49 430D 4E4F"            /* NNOMESNOMICNO */	$"4D4F 490D 4E4F 4D4F 530D 4E4F 4E41 530D"            /* MOINOMOSNONAS */	$"4E4F 4E43 450D 4E4F 4E45 530D 4E4F 4E45"            /* NONCENONESNONE */	$"540D 4E4F 4E47 530D 4E4F 4E49 530D 4E4F"            /* TNONGSNONISNO */	$"4E4E 590D 4E4F 4E59 4C0D 4E4F 4F42 530D"            /* NNYNONYLNOOBS */	$"4E4F 4F49 540D 4E4F 4F4B 530D 4E4F 4F4B"            /* NOOITNOOKSNOOK */	$"590D 4E4F 4F4E 530D 4E4F 4F50 530D 4E4F"            /* YNOONSNOOPSNO */	$"5041 4C0D 4E4F 5249 410D 4E4F 5249 530D"            /* PALNORIANORIS */	$"4E4F 524B 530D 4E4F 524D 410D 4E4F 524D"            /* NORKSNORMANORM */	$"530D 4E4F 5345 440D 4E4F 5345 520D 4E4F"            /* SNOSEDNOSERNO */	$"5345 530D 4E4F 5441 4C0D 4E4F 5445 440D"            /* SESNOTALNOTED */	$"4E4F 5445 520D 4E4F 5445 530D 4E4F 5455"            /* NOTERNOTESNOTU */	$"4D0D 4E4F 554C 440D 4E4F 554C 450D 4E4F"            /* MNOULDNOULENO */	$"554C 530D 4E4F 554E 530D 4E4F 554E 590D"            /* ULSNOUNSNOUNY */	$"4E4F 5550 530D 4E4F 5641 450D 4E4F 5641"            /* NOUPSNOVAENOVA */	$"530D 4E4F 5655 4D0D 4E4F 5741 590D 4E4F"            /* SNOVUMNOWAYNO */	$"5745 440D 4E4F 574C 530D 4E4F 5754 530D"            /* WEDNOWLSNOWTS */	$"4E4F 5754 590D 4E4F 5841 4C0D 4E4F 5845"            /* NOWTYNOXALNOXE */	$"530D 4E4F 5941 550D 4E4F 5945 440D 4E4F"            /* SNOYAUNOYEDNO */	$"5945 530D 4E55 4242 590D 4E55 4249 410D"            /* YESNUBBYNUBIA */	$"4E55 4348 410D 4E55 4444 590D 4E55 4445"            /* NUCHANUDDYNUDE */	$"520D 4E55 4445 530D 4E55 4449 450D 4E55"            /* RNUDESNUDIENU */	$"445A 480D 4E55 4646 530D 4E55 4741 450D"            /* DZHNUFFSNUGAE */	$"4E55 4B45 440D 4E55 4B45 530D 4E55 4C4C"            /* NUKEDNUKESNULL */	$"410D 4E55 4C4C 530D 4E55 4D42 530D 4E55"            /* ANULLSNUMBSNU */	$"4D45 4E0D 4E55 4D4D 590D 4E55 4E4E 590D"            /* MENNUMMYNUNNY */	$"4E55 5244 530D 4E55 5244 590D 4E55 524C"            /* NURDSNURDYNURL */	$"530D 4E55 5252 530D 4E55 5453 4F0D 4E55"            /* SNURRSNUTSONU */	$"5453 590D 4E59 4146 460D 4E59 414C 410D"            /* TSYNYAFFNYALA */	$"4E59 494E 470D 4E59 5353 410D 4F41 4B45"            /* NYINGNYSSAOAKE */	$"440D 4F41 4B45 520D 4F41 4B55 4D0D 4F41"            /* DOAKEROAKUMOA */	$"5245 440D 4F41 5345 530D 4F41 5349 530D"            /* REDOASESOASIS */	$"4F41 5354 530D 4F41 5445 4E0D 4F41 5445"            /* OASTSOATENOATE */	$"520D 4F41 5448 530D 4F41 5645 530D 4F42"            /* ROATHSOAVESOB */	$"414E 470D 4F42 4541 480D 4F42 454C 490D"            /* ANGOBEAHOBELI */	$"4F42 4559 530D 4F42 4941 530D 4F42 4945"            /* OBEYSOBIASOBIE */	$"440D 4F42 4949 540D 4F42 4954 530D 4F42"            /* DOBIITOBITSOB */	$"4A45 540D 4F42 4F45 530D 4F42 4F4C 450D"            /* JETOBOESOBOLE */	$"4F42 4F4C 490D 4F42 4F4C 530D 4F43 4341"            /* OBOLIOBOLSOCCA */	$"4D0D 4F43 4845 520D 4F43 4845 530D 4F43"            /* MOCHEROCHESOC */	$"4852 450D 4F43 4852 590D 4F43 4B45 520D"            /* HREOCHRYOCKER */	$"4F43 5245 410D 4F43 5441 440D 4F43 5441"            /* OCREAOCTADOCTA */	$"4E0D 4F43 5441 530D 4F43 5459 4C0D 4F43"            /* NOCTASOCTYLOC */	$"554C 490D 4F44 4148 530D 4F44 414C 530D"            /* ULIODAHSODALS */	$"4F44 454F 4E0D 4F44 4555 4D0D 4F44 4953"            /* ODEONODEUMODIS */	$"4D0D 4F44 4953 540D 4F44 4955 4D0D 4F44"            /* MODISTODIUMOD */	$"4F52 530D 4F44 4F55 520D 4F44 594C 450D"            /* ORSODOURODYLE */	$"4F44 594C 530D 4F46 4159 530D 4F46 4645"            /* ODYLSOFAYSOFFE */	$"440D 4F46 4649 450D 4F46 4C41 470D 4F46"            /* DOFFIEOFLAGOF */	$"5445 520D 4F47 414D 530D 4F47 4545 440D"            /* TEROGAMSOGEED */	$"4F47 4545 530D 4F47 4749 4E0D 4F47 4841"            /* OGEESOGGINOGHA */	$"4D0D 4F47 4956 450D 4F47 4C45 440D 4F47"            /* MOGIVEOGLEDOG */	$"4C45 520D 4F47 4C45 530D 4F47 4D49 430D"            /* LEROGLESOGMIC */	$"4F47 5245 530D 4F48 4941 530D 4F48 494E"            /* OGRESOHIASOHIN */	$"470D 4F48 4D49 430D 4F48 4F4E 450D 4F49"            /* GOHMICOHONEOI */	$"4449 410D 4F49 4C45 440D 4F49 4C45 520D"            /* DIAOILEDOILER */	$"4F49 4E4B 530D 4F49 4E54 530D 4F4A 494D"            /* OINKSOINTSOJIM */	$"450D 4F4B 4150 490D 4F4B 4159 530D 4F4B"            /* EOKAPIOKAYSOK */	$"4548 530D 4F4B 5241 530D 4F4B 5441 530D"            /* EHSOKRASOKTAS */	$"4F4C 4449 450D 4F4C 4549 430D 4F4C 4549"            /* OLDIEOLEICOLEI */	$"4E0D 4F4C 454E 540D 4F4C 454F 530D 4F4C"            /* NOLENTOLEOSOL */	$"4555 4D0D 4F4C 494F 530D 4F4C 4C41 530D"            /* EUMOLIOSOLLAS */	$"4F4C 4C41 560D 4F4C 4C45 520D 4F4C 4C49"            /* OLLAVOLLEROLLI */	$"450D 4F4C 4F47 590D 4F4C 5041 450D 4F4C"            /* EOLOGYOLPAEOL */	$"5045 530D 4F4D 4153 410D 4F4D 4245 520D"            /* PESOMASAOMBER */	$"4F4D 4255 530D 4F4D 454E 530D 4F4D 4552"            /* OMBUSOMENSOMER */	$"530D 4F4D 4954 530D 4F4D 4C41 480D 4F4D"            /* SOMITSOMLAHOM */	$"4F56 530D 4F4D 5241 480D 4F4E 4345 520D"            /* OVSOMRAHONCER */	$"4F4E 4345 530D 4F4E 4345 540D 4F4E 4355"            /* ONCESONCETONCU */	$"530D 4F4E 454C 590D 4F4E 4552 530D 4F4E"            /* SONELYONERSON */	$"4552 590D 4F4E 4955 4D0D 4F4E 4B55 530D"            /* ERYONIUMONKUS */	$"4F4E 4C41 590D 4F4E 4E45 440D 4F4E 5449"            /* ONLAYONNEDONTI */	$"430D 4F4F 4249 540D 4F4F 4845 440D 4F4F"            /* COOBITOOHEDOO */	$"4D50 480D 4F4F 4E54 530D 4F4F 5045 440D"            /* MPHOONTSOOPED */	$"4F4F 5249 450D 4F4F 5345 530D 4F4F 5449"            /* OORIEOOSESOOTI */	$"440D 4F4F 5A45 440D 4F4F 5A45 530D 4F50"            /* DOOZEDOOZESOP */	$"4148 530D 4F50 414C 530D 4F50 454E 530D"            /* AHSOPALSOPENS */	$"4F50 4550 450D 4F50 494E 470D 4F50 504F"            /* OPEPEOPINGOPPO */	$"530D 4F50 5349 4E0D 4F50 5445 440D 4F50"            /* SOPSINOPTEDOP */	$"5445 520D 4F52 4143 480D 4F52 4143 590D"            /* TERORACHORACY */	$"4F52 414C 530D 4F52 414E 470D 4F52 414E"            /* ORALSORANGORAN */	$"540D 4F52 4154 450D 4F52 4245 440D 4F52"            /* TORATEORBEDOR */	$"4341 530D 4F52 4349 4E0D 4F52 444F 530D"            /* CASORCINORDOS */	$"4F52 4541 440D 4F52 4645 530D 4F52 4749"            /* OREADORFESORGI */	$"410D 4F52 4749 430D 4F52 4755 450D 4F52"            /* AORGICORGUEOR */	$"4942 490D 4F52 4945 4C0D 4F52 4958 410D"            /* IBIORIELORIXA */	$"4F52 4C45 530D 4F52 4C4F 4E0D 4F52 4C4F"            /* ORLESORLONORLO */	$"500D 4F52 4D45 520D 4F52 4E49 530D 4F52"            /* PORMERORNISOR */	$"5049 4E0D 4F52 5249 530D 4F52 5448 4F0D"            /* PINORRISORTHO */	$"4F52 5641 4C0D 4F52 5A4F 530D 4F53 4341"            /* ORVALORZOSOSCA */	$"520D 4F53 4841 430D 4F53 4945 520D 4F53"            /* ROSHACOSIEROS */	$"4D49 430D 4F53 4D4F 4C0D 4F53 5349 410D"            /* MICOSMOLOSSIA */	$"4F53 5449 410D 4F54 414B 550D 4F54 4152"            /* OSTIAOTAKUOTAR */	$"590D 4F54 5441 520D 4F54 544F 530D 4F55"            /* YOTTAROTTOSOU */	$"4249 540D 4F55 4348 540D 4F55 454E 530D"            /* BITOUCHTOUENS */	$"4F55 494A 410D 4F55 4C4B 530D 4F55 4D41"            /* OUIJAOULKSOUMA */	$"530D 4F55 4E44 590D 4F55 5041 530D 4F55"            /* SOUNDYOUPASOU */	$"5045 440D 4F55 5048 450D 4F55 5048 530D"            /* PEDOUPHEOUPHS */	$"4F55 5249 450D 4F55 5345 4C0D 4F55 5354"            /* OURIEOUSELOUST */	$"530D 4F55 5442 590D 4F55 5445 440D 4F55"            /* SOUTBYOUTEDOU */	$"5452 450D 4F55 5452 4F0D 4F55 5454 410D"            /* TREOUTROOUTTA */	$"4F55 5A45 4C0D 4F55 5A4F 530D 4F56 414C"            /* OUZELOUZOSOVAL */	$"530D 4F56 454C 530D 4F56 454E 530D 4F56"            /* SOVELSOVENSOV */	$"4552 530D 4F56 4953 540D 4F56 4F4C 490D"            /* ERSOVISTOVOLI */	$"4F56 4F4C 4F0D 4F56 554C 450D 4F57 4348"            /* OVOLOOVULEOWCH */	$"450D 4F57 4945 530D 4F57 4C45 440D 4F57"            /* EOWIESOWLEDOW */	$"4C45 520D 4F57 4C45 540D 4F57 4E45 440D"            /* LEROWLETOWNED */	$"4F57 5245 530D 4F57 5249 450D 4F57 5345"            /* OWRESOWRIEOWSE */	$"4E0D 4F58 424F 570D 4F58 4552 530D 4F58"            /* NOXBOWOXERSOX */	$"4559 450D 4F58 4944 530D 4F58 4945 530D"            /* EYEOXIDSOXIES */	$"4F58 494D 450D 4F58 494D 530D 4F58 4C49"            /* OXIMEOXIMSOXLI */	$"500D 4F58 5445 520D 4F59 4552 530D 4F5A"            /* POXTEROYERSOZ */	$"454B 490D 4F5A 5A49 450D 5041 414C 530D"            /* EKIOZZIEPAALS */	$"5041 414E 530D 5041 4341 530D 5041 4345"            /* PAANSPACASPACE */	$"440D 5041 4345 520D 5041 4345 530D 5041"            /* DPACERPACESPA */	$"4345 590D 5041 4348 410D 5041 434B 530D"            /* CEYPACHAPACKS */	$"5041 434F 530D 5041 4354 410D 5041 4354"            /* PACOSPACTAPACT */	$"530D 5041 4449 530D 5041 444C 450D 5041"            /* SPADISPADLEPA */	$"444D 410D 5041 4452 450D 5041 4452 490D"            /* DMAPADREPADRI */	$"5041 4541 4E0D 5041 4544 4F0D 5041 454F"            /* PAEANPAEDOPAEO */	$"4E0D 5041 4745 440D 5041 4745 520D 5041"            /* NPAGEDPAGERPA */	$"4745 530D 5041 474C 450D 5041 474F 440D"            /* GESPAGLEPAGOD */	$"5041 4752 490D 5041 494B 530D 5041 494C"            /* PAGRIPAIKSPAIL */	$"530D 5041 494E 530D 5041 4952 450D 5041"            /* SPAINSPAIREPA */	$"4952 530D 5041 4953 410D 5041 4953 450D"            /* IRSPAISAPAISE */	$"5041 4B4B 410D 5041 4C41 530D 5041 4C41"            /* PAKKAPALASPALA */	$"590D 5041 4C45 410D 5041 4C45 440D 5041"            /* YPALEAPALEDPA */	$"4C45 530D 5041 4C45 540D 5041 4C49 530D"            /* LESPALETPALIS */	$"5041 4C4B 490D 5041 4C4C 410D 5041 4C4C"            /* PALKIPALLAPALL */	$"530D 5041 4C4C 590D 5041 4C4D 530D 5041"            /* SPALLYPALMSPA */	$"4C4D 590D 5041 4C50 490D 5041 4C50 530D"            /* LMYPALPIPALPS */	$"5041 4C53 410D 5041 4D50 410D 5041 4E41"            /* PALSAPAMPAPANA */	$"580D 5041 4E43 450D 5041 4E44 410D 5041"            /* XPANCEPANDAPA */	$"4E44 530D 5041 4E44 590D 5041 4E45 440D"            /* NDSPANDYPANED */	$"5041 4E45 530D 5041 4E47 410D 5041 4E47"            /* PANESPANGAPANG */	$"530D 5041 4E49 4D0D 5041 4E4B 4F0D 5041"            /* SPANIMPANKOPA */	$"4E4E 450D 5041 4E4E 490D 5041 4E54 4F0D"            /* NNEPANNIPANTO */	$"5041 4E54 530D 5041 4E54 590D 5041 4F4C"            /* PANTSPANTYPAOL */	$"490D 5041 4F4C 4F0D 5041 5041 530D 5041"            /* IPAOLOPAPASPA */	$"5041 570D 5041 5045 530D 5041 5050 490D"            /* PAWPAPESPAPPI */	$"5041 5050 590D 5041 5241 450D 5041 5241"            /* PAPPYPARAEPARA */	$"530D 5041 5243 480D 5041 5244 490D 5041"            /* SPARCHPARDIPA */	$"5244 530D 5041 5244 590D 5041 5245 440D"            /* RDSPARDYPARED */	$"5041 5245 4E0D 5041 5245 4F0D 5041 5245"            /* PARENPAREOPARE */	$"530D 5041 5245 550D 5041 5245 560D 5041"            /* SPAREUPAREVPA */	$"5247 450D 5041 5247 4F0D 5041 5249 530D"            /* RGEPARGOPARIS */	$"5041 524B 490D 5041 524B 530D 5041 524B"            /* PARKIPARKSPARK */	$"590D 5041 524C 450D 5041 524C 590D 5041"            /* YPARLEPARLYPA */	$"524D 410D 5041 524F 4C0D 5041 5250 530D"            /* RMAPAROLPARPS */	$"5041 5252 410D 5041 5252 530D 5041 5254"            /* PARRAPARRSPART */	$"490D 5041 5254 530D 5041 5256 450D 5041"            /* IPARTSPARVEPA */	$"5256 4F0D 5041 5345 4F0D 5041 5345 530D"            /* RVOPASEOPASES */	$"5041 5348 410D 5041 5348 4D0D 5041 534B"            /* PASHAPASHMPASK */	$"410D 5041 5350 590D 5041 5353 450D 5041"            /* APASPYPASSEPA */	$"5354 530D 5041 5445 440D 5041 5445 4E0D"            /* STSPATEDPATEN */	$"5041 5445 520D 5041 5445 530D 5041 5448"            /* PATERPATESPATH */	$"530D 5041 5449 4E0D 5041 544B 410D 5041"            /* SPATINPATKAPA */	$"544C 590D 5041 5454 450D 5041 5455 530D"            /* TLYPATTEPATUS */	$"5041 5541 530D 5041 554C 530D 5041 5641"            /* PAUASPAULSPAVA */	$"4E0D 5041 5645 440D 5041 5645 4E0D 5041"            /* NPAVEDPAVENPA */	$"5645 520D 5041 5645 530D 5041 5649 440D"            /* VERPAVESPAVID */	$"5041 5649 4E0D 5041 5649 530D 5041 5741"            /* PAVINPAVISPAWA */	$"530D 5041 5741 570D 5041 5745 440D 5041"            /* SPAWAWPAWEDPA */	$"5745 520D 5041 574B 530D 5041 574B 590D"            /* WERPAWKSPAWKY */	$"5041 574C 530D 5041 574E 530D 5041 5845"            /* PAWLSPAWNSPAXE */	$"530D 5041 5945 440D 5041 594F 520D 5041"            /* SPAYEDPAYORPA */	$"5953 440D 5045 4147 450D 5045 4147 530D"            /* YSDPEAGEPEAGS */	$"5045 414B 530D 5045 414B 590D 5045 414C"            /* PEAKSPEAKYPEAL */	$"530D 5045 414E 530D 5045 4152 450D 5045"            /* SPEANSPEAREPE */	$"4152 530D 5045 4152 540D 5045 4153 450D"            /* ARSPEARTPEASE */	$"5045 4154 530D 5045 4154 590D 5045 4156"            /* PEATSPEATYPEAV */	$"590D 5045 415A 450D 5045 4241 530D 5045"            /* YPEAZEPEBASPE */	$"4348 530D 5045 434B 450D 5045 434B 530D"            /* CHSPECKEPECKS */	$"5045 434B 590D 5045 4445 530D 5045 4449"            /* PECKYPEDESPEDI */	$"530D 5045 4452 4F0D 5045 4543 450D 5045"            /* SPEDROPEECEPE */	$"454B 530D 5045 454C 530D 5045 454E 530D"            /* EKSPEELSPEENS */	$"5045 454F 590D 5045 4550 450D 5045 4550"            /* PEEOYPEEPEPEEP */	$"530D 5045 4552 530D 5045 4552 590D 5045"            /* SPEERSPEERYPE */	$"4556 450D 5045 4747 590D 5045 4748 530D"            /* EVEPEGGYPEGHS */	$"5045 494E 530D 5045 4953 450D 5045 495A"            /* PEINSPEISEPEIZ */	$"450D 5045 4B41 4E0D 5045 4B45 530D 5045"            /* EPEKANPEKESPE */	$"4B49 4E0D 5045 4B4F 450D 5045 4C41 530D"            /* KINPEKOEPELAS */	$"5045 4C41 550D 5045 4C45 530D 5045 4C46"            /* PELAUPELESPELF */	$"530D 5045 4C4C 530D 5045 4C4D 410D 5045"            /* SPELLSPELMAPE */	$"4C4F 4E0D 5045 4C54 410D 5045 4C54 530D"            /* LONPELTAPELTS */	$"5045 4E44 530D 5045 4E44 550D 5045 4E45"            /* PENDSPENDUPENE */	$"440D 5045 4E45 530D 5045 4E47 4F0D 5045"            /* DPENESPENGOPE */	$"4E49 450D 5045 4E49 530D 5045 4E4B 530D"            /* NIEPENISPENKS */	$"5045 4E4E 410D 5045 4E4E 490D 5045 4E54"            /* PENNAPENNIPENT */	$"530D 5045 4F4E 530D 5045 4F4E 590D 5045"            /* SPEONSPEONYPE */	$"504C 410D 5045 504F 530D 5045 5050 590D"            /* PLAPEPOSPEPPY */	$"5045 5053 490D 5045 5241 490D 5045 5243"            /* PEPSIPERAIPERC */	$"450D 5045 5243 530D 5045 5244 550D 5045"            /* EPERCSPERDUPE */	$"5244 590D 5045 5245 410D 5045 5245 530D"            /* RDYPEREAPERES */	$"5045 5249 530D 5045 524B 530D 5045 524D"            /* PERISPERKSPERM */	$"530D 5045 524E 530D 5045 524F 470D 5045"            /* SPERNSPEROGPE */	$"5250 530D 5045 5252 590D 5045 5253 450D"            /* RPSPERRYPERSE */	$"5045 5253 540D 5045 5254 530D 5045 5256"            /* PERSTPERTSPERV */	$"450D 5045 5256 4F0D 5045 5256 530D 5045"            /* EPERVOPERVSPE */	$"5256 590D 5045 534F 530D 5045 5354 530D"            /* RVYPESOSPESTS */	$"5045 5354 590D 5045 5441 520D 5045 5445"            /* PESTYPETARPETE */	$"520D 5045 5449 540D 5045 5452 450D 5045"            /* RPETITPETREPE */	$"5452 490D 5045 5454 490D 5045 5454 4F0D"            /* TRIPETTIPETTO */	$"5045 5745 450D 5045 5749 540D 5045 5953"            /* PEWEEPEWITPEYS */	$"450D 5048 4147 450D 5048 414E 470D 5048"            /* EPHAGEPHANGPH */	$"4152 450D 5048 4152 4D0D 5048 4545 520D"            /* AREPHARMPHEER */	$"5048 454E 450D 5048 454F 4E0D 5048 4553"            /* PHENEPHEONPHES */	$"450D 5048 4941 4C0D 5048 4953 480D 5048"            /* EPHIALPHISHPH */	$"495A 5A0D 5048 4C4F 580D 5048 4F43 410D"            /* IZZPHLOXPHOCA */	$"5048 4F4E 4F0D 5048 4F4E 530D 5048 4F54"            /* PHONOPHONSPHOT */	$"530D 5048 5048 540D 5048 5554 530D 5048"            /* SPHPHTPHUTSPH */	$"594C 410D 5048 594C 450D 5049 414E 490D"            /* YLAPHYLEPIANI */	$"5049 414E 530D 5049 4241 4C0D 5049 4341"            /* PIANSPIBALPICA */	$"4C0D 5049 4341 530D 5049 4343 590D 5049"            /* LPICASPICCYPI */	$"434B 530D 5049 434F 540D 5049 4352 410D"            /* CKSPICOTPICRA */	$"5049 4355 4C0D 5049 454E 440D 5049 4552"            /* PICULPIENDPIER */	$"530D 5049 4552 540D 5049 4554 410D 5049"            /* SPIERTPIETAPI */	$"4554 530D 5049 455A 4F0D 5049 4748 540D"            /* ETSPIEZOPIGHT */	$"5049 474D 590D 5049 494E 470D 5049 4B41"            /* PIGMYPIINGPIKA */	$"530D 5049 4B41 550D 5049 4B45 440D 5049"            /* SPIKAUPIKEDPI */	$"4B45 520D 5049 4B45 530D 5049 4B45 590D"            /* KERPIKESPIKEY */	$"5049 4B49 530D 5049 4B55 4C0D 5049 4C41"            /* PIKISPIKULPILA */	$"450D 5049 4C41 460D 5049 4C41 4F0D 5049"            /* EPILAFPILAOPI */	$"4C41 520D 5049 4C41 550D 5049 4C41 570D"            /* LARPILAUPILAW */	$"5049 4C43 480D 5049 4C45 410D 5049 4C45"            /* PILCHPILEAPILE */	$"440D 5049 4C45 490D 5049 4C45 520D 5049"            /* DPILEIPILERPI */	$"4C45 530D 5049 4C49 530D 5049 4C4C 530D"            /* LESPILISPILLS */	$"5049 4C4F 570D 5049 4C55 4D0D 5049 4C55"            /* PILOWPILUMPILU */	$"530D 5049 4D41 530D 5049 4D50 530D 5049"            /* SPIMASPIMPSPI */	$"4E41 530D 5049 4E45 440D 5049 4E45 530D"            /* NASPINEDPINES */	$"5049 4E47 4F0D 5049 4E47 530D 5049 4E4B"            /* PINGOPINGSPINK */	$"4F0D 5049 4E4B 530D 5049 4E4E 410D 5049"            /* OPINKSPINNAPI */	$"4E4E 590D 5049 4E4F 4E0D 5049 4E4F 540D"            /* NNYPINONPINOT */	$"5049 4E54 410D 5049 4E54 530D 5049 4E55"            /* PINTAPINTSPINU */	$"500D 5049 4F4E 530D 5049 4F4E 590D 5049"            /* PPIONSPIONYPI */	$"4F55 530D 5049 4F59 450D 5049 4F59 530D"            /* OUSPIOYEPIOYS */	$"5049 5041 4C0D 5049 5041 530D 5049 5045"            /* PIPALPIPASPIPE */	$"440D 5049 5045 530D 5049 5045 540D 5049"            /* DPIPESPIPETPI */	$"5049 530D 5049 5049 540D 5049 5050 590D"            /* PISPIPITPIPPY */	$"5049 5055 4C0D 5049 5241 490D 5049 524C"            /* PIPULPIRAIPIRL */	$"530D 5049 524E 530D 5049 524F 470D 5049"            /* SPIRNSPIROGPI */	$"5343 4F0D 5049 5345 530D 5049 534B 590D"            /* SCOPISESPISKY */	$"5049 534F 530D 5049 5353 590D 5049 5354"            /* PISOSPISSYPIST */	$"450D 5049 5441 530D 5049 5448 530D 5049"            /* EPITASPITHSPI */	$"544F 4E0D 5049 544F 540D 5049 5454 410D"            /* TONPITOTPITTA */	$"5049 554D 530D 5049 5845 530D 5049 5A45"            /* PIUMSPIXESPIZE */	$"440D 5049 5A45 530D 504C 4141 530D 504C"            /* DPIZESPLAASPL */	$"4143 4B0D 504C 4147 450D 504C 414E 530D"            /* ACKPLAGEPLANS */	$"504C 4150 530D 504C 4153 480D 504C 4153"            /* PLAPSPLASHPLAS */	$"4D0D 504C 4153 540D 504C 4154 530D 504C"            /* MPLASTPLATSPL */	$"4154 540D 504C 4154 590D 504C 4159 410D"            /* ATTPLATYPLAYA */	$"504C 4159 530D 504C 4541 530D 504C 4542"            /* PLAYSPLEASPLEB */	$"450D 504C 4542 530D 504C 454E 410D 504C"            /* EPLEBSPLENAPL */	$"454F 4E0D 504C 4553 480D 504C 4557 530D"            /* EONPLESHPLEWS */	$"504C 4943 410D 504C 4945 530D 504C 494D"            /* PLICAPLIESPLIM */	$"530D 504C 494E 470D 504C 494E 4B0D 504C"            /* SPLINGPLINKPL */	$"4F41 540D 504C 4F44 530D 504C 4F4E 470D"            /* OATPLODSPLONG */	$"504C 4F4E 4B0D 504C 4F4F 4B0D 504C 4F50"            /* PLONKPLOOKPLOP */	$"530D 504C 4F54 530D 504C 4F54 5A0D 504C"            /* SPLOTSPLOTZPL */	$"4F55 4B0D 504C 4F57 530D 504C 4F59 450D"            /* OUKPLOWSPLOYE */	$"504C 4F59 530D 504C 5545 530D 504C 5546"            /* PLOYSPLUESPLUF */	$"460D 504C 5547 530D 504C 554D 530D 504C"            /* FPLUGSPLUMSPL */	$"554D 590D 504C 554F 540D 504C 5554 4F0D"            /* UMYPLUOTPLUTO */	$"504C 5945 520D 504F 4143 480D 504F 414B"            /* PLYERPOACHPOAK */	$"410D 504F 414B 450D 504F 424F 590D 504F"            /* APOAKEPOBOYPO */	$"434B 530D 504F 434B 590D 504F 4441 4C0D"            /* CKSPOCKYPODAL */	$"504F 4444 590D 504F 4445 580D 504F 4447"            /* PODDYPODEXPODG */	$"450D 504F 4447 590D 504F 4449 410D 504F"            /* EPODGYPODIAPO */	$"454D 530D 504F 4550 530D 504F 4554 530D"            /* EMSPOEPSPOETS */	$"504F 4745 590D 504F 4747 450D 504F 474F"            /* POGEYPOGGEPOGO */	$"530D 504F 4845 440D 504F 494C 550D 504F"            /* SPOHEDPOILUPO */	$"494E 440D 504F 4B41 4C0D 504F 4B45 440D"            /* INDPOKALPOKED */	$"504F 4B45 530D 504F 4B45 590D 504F 4B49"            /* POKESPOKEYPOKI */	$"450D 504F 4C45 440D 504F 4C45 520D 504F"            /* EPOLEDPOLERPO */	$"4C45 530D 504F 4C45 590D 504F 4C49 4F0D"            /* LESPOLEYPOLIO */	$"504F 4C49 530D 504F 4C4A 450D 504F 4C4B"            /* POLISPOLJEPOLK */	$"530D 504F 4C4C 530D 504F 4C4C 590D 504F"            /* SPOLLSPOLLYPO */	$"4C4F 530D 504F 4C54 530D 504F 4C59 530D"            /* LOSPOLTSPOLYS */	$"504F 4D42 450D 504F 4D45 530D 504F 4D4D"            /* POMBEPOMESPOMM */	$"590D 504F 4D4F 530D 504F 4D50 530D 504F"            /* YPOMOSPOMPSPO */	$"4E43 450D 504F 4E43 590D 504F 4E44 530D"            /* NCEPONCYPONDS */	$"504F 4E45 530D 504F 4E45 590D 504F 4E47"            /* PONESPONEYPONG */	$"410D 504F 4E47 4F0D 504F 4E47 530D 504F"            /* APONGOPONGSPO */	$"4E47 590D 504F 4E4B 530D 504F 4E54 530D"            /* NGYPONKSPONTS */	$"504F 4E54 590D 504F 4E5A 550D 504F 4F44"            /* PONTYPONZUPOOD */	$"530D 504F 4F45 440D 504F 4F46 530D 504F"            /* SPOOEDPOOFSPO */	$"4F46 590D 504F 4F48 530D 504F 4F4A 410D"            /* OFYPOOHSPOOJA */	$"504F 4F4B 410D 504F 4F4B 530D 504F 4F4C"            /* POOKAPOOKSPOOL */	$"530D 504F 4F4E 530D 504F 4F50 530D 504F"            /* SPOONSPOOPSPO */	$"4F50 590D 504F 4F52 490D 504F 4F52 540D"            /* OPYPOORIPOORT */	$"504F 4F54 530D 504F 4F56 450D 504F 4F56"            /* POOTSPOOVEPOOV */	$"590D 504F 5045 530D 504F 5050 410D 504F"            /* YPOPESPOPPAPO */	$"5053 590D 504F 5241 450D 504F 5241 4C0D"            /* PSYPORAEPORAL */	$"504F 5245 440D 504F 5245 520D 504F 5245"            /* POREDPORERPORE */	$"530D 504F 5247 450D 504F 5247 590D 504F"            /* SPORGEPORGYPO */	$"5249 4E0D 504F 524B 530D 504F 524B 590D"            /* RINPORKSPORKY */	$"504F 524E 4F0D 504F 524E 530D 504F 524E"            /* PORNOPORNSPORN */	$"590D 504F 5254 410D 504F 5254 530D 504F"            /* YPORTAPORTSPO */	$"5254 590D 504F 5345 440D 504F 5345 530D"            /* RTYPOSEDPOSES */	$"504F 5345 590D 504F 5348 4F0D 504F 5354"            /* POSEYPOSHOPOST */	$"530D 504F 5441 450D 504F 5443 480D 504F"            /* SPOTAEPOTCHPO */	$"5445 440D 504F 5445 530D 504F 5449 4E0D"            /* TEDPOTESPOTIN */	$"504F 544F 4F0D 504F 5453 590D 504F 5454"            /* POTOOPOTSYPOTT */	$"4F0D 504F 5454 530D 504F 5454 590D 504F"            /* OPOTTSPOTTYPO */	$"5546 460D 504F 5546 530D 504F 554B 450D"            /* UFFPOUFSPOUKE */	$"504F 554B 530D 504F 554C 450D 504F 554C"            /* POUKSPOULEPOUL */	$"500D 504F 554C 540D 504F 5550 450D 504F"            /* PPOULTPOUPEPO */	$"5550 540D 504F 5552 530D 504F 5554 530D"            /* UPTPOURSPOUTS */	$"504F 5741 4E0D 504F 5749 4E0D 504F 574E"            /* POWANPOWINPOWN */	$"440D 504F 574E 530D 504F 574E 590D 504F"            /* DPOWNSPOWNYPO */	$"5752 450D 504F 5845 440D 504F 5845 530D"            /* WREPOXEDPOXES */	$"504F 594E 540D 504F 594F 550D 504F 5953"            /* POYNTPOYOUPOYS */	$"450D 504F 5A5A 590D 5052 4141 4D0D 5052"            /* EPOZZYPRAAMPR */	$"4144 530D 5052 4148 550D 5052 414D 530D"            /* ADSPRAHUPRAMS */	$"5052 414E 410D 5052 414E 470D 5052 414F"            /* PRANAPRANGPRAO */	$"530D 5052 4153 450D 5052 4154 450D 5052"            /* SPRASEPRATEPR */	$"4154 530D 5052 4154 540D 5052 4154 590D"            /* ATSPRATTPRATY */	$"5052 4155 530D 5052 4159 530D 5052 4544"            /* PRAUSPRAYSPRED */	$"590D 5052 4545 440D 5052 4545 530D 5052"            /* YPREEDPREESPR */	$"4549 460D 5052 454D 530D 5052 454D 590D"            /* EIFPREMSPREMY */	$"5052 454E 540D 5052 454F 4E0D 5052 454F"            /* PRENTPREONPREO */	$"500D 5052 4550 530D 5052 4553 410D 5052"            /* PPREPSPRESAPR */	$"4553 450D 5052 4553 540D 5052 4556 450D"            /* ESEPRESTPREVE */	$"5052 4558 590D 5052 4559 530D 5052 4941"            /* PREXYPREYSPRIA */	$"4C0D 5052 4943 590D 5052 4945 460D 5052"            /* LPRICYPRIEFPR */	$"4945 520D 5052 4945 530D 5052 4947 530D"            /* IERPRIESPRIGS */	$"5052 494C 4C0D 5052 494D 410D 5052 494D"            /* PRILLPRIMAPRIM */	$"490D 5052 494D 500D 5052 494D 530D 5052"            /* IPRIMPPRIMSPR */	$"494D 590D 5052 494E 4B0D 5052 494F 4E0D"            /* IMYPRINKPRION */	$"5052 4953 450D 5052 4953 530D 5052 4F41"            /* PRISEPRISSPROA */	$"530D 5052 4F42 530D 5052 4F44 530D 5052"            /* SPROBSPRODSPR */	$"4F45 4D0D 5052 4F46 530D 5052 4F47 530D"            /* OEMPROFSPROGS */	$"5052 4F49 4E0D 5052 4F4B 450D 5052 4F4C"            /* PROINPROKEPROL */	$"450D 5052 4F4C 4C0D 5052 4F4D 4F0D 5052"            /* EPROLLPROMOPR */	$"4F4D 530D 5052 4F4E 4B0D 5052 4F50 530D"            /* OMSPRONKPROPS */	$"5052 4F52 450D 5052 4F53 4F0D 5052 4F53"            /* PROREPROSOPROS */	$"530D 5052 4F53 540D 5052 4F53 590D 5052"            /* SPROSTPROSYPR */	$"4F54 4F0D 5052 4F55 4C0D 5052 4F57 530D"            /* OTOPROULPROWS */	$"5052 4F59 4E0D 5052 554E 540D 5052 5554"            /* PROYNPRUNTPRUT */	$"410D 5052 5945 520D 5052 5953 450D 5053"            /* APRYERPRYSEPS */	$"4555 440D 5053 4841 570D 5053 494F 4E0D"            /* EUDPSHAWPSION */	$"5053 4F41 450D 5053 4F41 490D 5053 4F41"            /* PSOAEPSOAIPSOA */	$"530D 5053 4F52 410D 5053 5943 480D 5053"            /* SPSORAPSYCHPS */	$"594F 500D 5055 4243 4F0D 5055 4245 530D"            /* YOPPUBCOPUBES */	$"5055 4249 530D 5055 4341 4E0D 5055 4345"            /* PUBISPUCANPUCE */	$"520D 5055 4345 530D 5055 434B 410D 5055"            /* RPUCESPUCKAPU */	$"434B 530D 5055 4444 590D 5055 4447 450D"            /* CKSPUDDYPUDGE */	$"5055 4449 430D 5055 444F 520D 5055 4453"            /* PUDICPUDORPUDS */	$"590D 5055 4455 530D 5055 4552 530D 5055"            /* YPUDUSPUERSPU */	$"4646 410D 5055 4646 530D 5055 4747 590D"            /* FFAPUFFSPUGGY */	$"5055 4749 4C0D 5055 4841 530D 5055 4A41"            /* PUGILPUHASPUJA */	$"480D 5055 4A41 530D 5055 4B41 530D 5055"            /* HPUJASPUKASPU */	$"4B45 440D 5055 4B45 520D 5055 4B45 530D"            /* KEDPUKERPUKES */	$"5055 4B45 590D 5055 4B4B 410D 5055 4B55"            /* PUKEYPUKKAPUKU */	$"530D 5055 4C41 4F0D 5055 4C41 530D 5055"            /* SPULAOPULASPU */	$"4C45 440D 5055 4C45 520D 5055 4C45 530D"            /* LEDPULERPULES */	$"5055 4C49 4B0D 5055 4C49 530D 5055 4C4B"            /* PULIKPULISPULK */	$"410D 5055 4C4B 530D 5055 4C4C 490D 5055"            /* APULKSPULLIPU */	$"4C4C 530D 5055 4C4C 590D 5055 4C4D 4F0D"            /* LLSPULLYPULMO */	$"5055 4C50 530D 5055 4C55 530D 5055 4D41"            /* PULPSPULUSPUMA */	$"530D 5055 4D49 450D 5055 4D50 530D 5055"            /* SPUMIEPUMPSPU */	$"4E41 530D 5055 4E43 450D 5055 4E47 410D"            /* NASPUNCEPUNGA */	$"5055 4E47 530D 5055 4E4A 490D 5055 4E4B"            /* PUNGSPUNJIPUNK */	$"410D 5055 4E4B 530D 5055 4E4B 590D 5055"            /* APUNKSPUNKYPU */	$"4E4E 590D 5055 4E54 4F0D 5055 4E54 530D"            /* NNYPUNTOPUNTS */	$"5055 4E54 590D 5055 5041 450D 5055 5041"            /* PUNTYPUPAEPUPA */	$"4C0D 5055 5041 530D 5055 5055 530D 5055"            /* LPUPASPUPUSPU */	$"5244 410D 5055 5245 440D 5055 5245 530D"            /* RDAPUREDPURES */	$"5055 5249 4E0D 5055 5249 530D 5055 524C"            /* PURINPURISPURL */	$"530D 5055 5250 590D 5055 5252 530D 5055"            /* SPURPYPURRSPU */	$"5253 590D 5055 5254 590D 5055 5345 530D"            /* RSYPURTYPUSES */	$"5055 534C 450D 5055 5353 590D 5055 5449"            /* PUSLEPUSSYPUTI */	$"440D 5055 544F 4E0D 5055 5454 490D 5055"            /* DPUTONPUTTIPU */	$"5454 4F0D 5055 5454 530D 5055 5A45 4C0D"            /* TTOPUTTSPUZEL */	$"5057 4E45 440D 5059 4154 530D 5059 4554"            /* PWNEDPYATSPYET */	$"530D 5059 4741 4C0D 5059 494E 530D 5059"            /* SPYGALPYINSPY */	$"4C4F 4E0D 5059 4E45 440D 5059 4E45 530D"            /* LONPYNEDPYNES */	$"5059 4F49 440D 5059 4F54 530D 5059 5241"            /* PYOIDPYOTSPYRA */	$"4C0D 5059 5241 4E0D 5059 5245 530D 5059"            /* LPYRANPYRESPY */	$"5245 580D 5059 5249 430D 5059 524F 530D"            /* REXPYRICPYROS */	$"5059 5845 440D 5059 5845 530D 5059 5849"            /* PYXEDPYXESPYXI */	$"450D 5059 5849 530D 505A 415A 5A0D 5141"            /* EPYXISPZAZZQA */	$"4449 530D 5141 4944 530D 5141 4A41 510D"            /* DISQAIDSQAJAQ */	$"5141 4E41 540D 5141 5049 4B0D 5149 424C"            /* QANATQAPIKQIBL */	$"410D 514F 5048 530D 514F 524D 410D 5155"            /* AQOPHSQORMAQU */	$"4144 530D 5155 4146 460D 5155 4147 530D"            /* ADSQUAFFQUAGS */	$"5155 4149 520D 5155 4149 530D 5155 414B"            /* QUAIRQUAISQUAK */	$"590D 5155 414C 450D 5155 414E 540D 5155"            /* YQUALEQUANTQU */	$"4152 450D 5155 4153 530D 5155 4154 450D"            /* AREQUASSQUATE */	$"5155 4154 530D 5155 4159 440D 5155 4159"            /* QUATSQUAYDQUAY */	$"530D 5155 4249 540D 5155 4541 4E0D 5155"            /* SQUBITQUEANQU */	$"454D 450D 5155 454E 410D 5155 4552 4E0D"            /* EMEQUENAQUERN */	$"5155 4559 4E0D 5155 4559 530D 5155 4943"            /* QUEYNQUEYSQUIC */	$"480D 5155 4944 530D 5155 4946 460D 5155"            /* HQUIDSQUIFFQU */	$"494D 530D 5155 494E 410D 5155 494E 450D"            /* IMSQUINAQUINE */	$"5155 494E 4F0D 5155 494E 530D 5155 494E"            /* QUINOQUINSQUIN */	$"540D 5155 4950 4F0D 5155 4950 530D 5155"            /* TQUIPOQUIPSQU */	$"4950 550D 5155 4952 450D 5155 4952 540D"            /* IPUQUIREQUIRT */	$"5155 4953 540D 5155 4954 530D 5155 4F41"            /* QUISTQUITSQUOA */	$"440D 5155 4F44 530D 5155 4F49 460D 5155"            /* DQUODSQUOIFQU */	$"4F49 4E0D 5155 4F49 540D 5155 4F4C 4C0D"            /* OINQUOITQUOLL */	$"5155 4F4E 4B0D 5155 4F50 530D 5155 5253"            /* QUONKQUOPSQURS */	$"480D 5155 5954 450D 5241 4241 540D 5241"            /* HQUYTERABATRA */	$"4249 430D 5241 4249 530D 5241 4345 440D"            /* BICRABISRACED */	$"5241 4345 530D 5241 4348 450D 5241 434B"            /* RACESRACHERACK */	$"530D 5241 434F 4E0D 5241 4447 450D 5241"            /* SRACONRADGERA */	$"4449 580D 5241 444F 4E0D 5241 4646 530D"            /* DIXRADONRAFFS */	$"5241 4654 530D 5241 4741 530D 5241 4744"            /* RAFTSRAGASRAGD */	$"450D 5241 4745 440D 5241 4745 450D 5241"            /* ERAGEDRAGEERA */	$"4745 520D 5241 4745 530D 5241 4747 410D"            /* GERRAGESRAGGA */	$"5241 4747 530D 5241 4747 590D 5241 4749"            /* RAGGSRAGGYRAGI */	$"530D 5241 4755 530D 5241 4845 440D 5241"            /* SRAGUSRAHEDRA */	$"4855 490D 5241 4941 530D 5241 4944 530D"            /* HUIRAIASRAIDS */	$"5241 494B 530D 5241 494C 450D 5241 494C"            /* RAIKSRAILERAIL */	$"530D 5241 494E 450D 5241 494E 530D 5241"            /* SRAINERAINSRA */	$"4952 440D 5241 4954 410D 5241 4954 530D"            /* IRDRAITARAITS */	$"5241 4A41 530D 5241 4A45 530D 5241 4B45"            /* RAJASRAJESRAKE */	$"440D 5241 4B45 450D 5241 4B45 520D 5241"            /* DRAKEERAKERRA */	$"4B45 530D 5241 4B49 410D 5241 4B49 530D"            /* KESRAKIARAKIS */	$"5241 4B55 530D 5241 4C45 530D 5241 4D41"            /* RAKUSRALESRAMA */	$"4C0D 5241 4D45 450D 5241 4D45 540D 5241"            /* LRAMEERAMETRA */	$"4D49 450D 5241 4D49 4E0D 5241 4D49 530D"            /* MIERAMINRAMIS */	$"5241 4D4D 590D 5241 4D50 530D 5241 4D55"            /* RAMMYRAMPSRAMU */	$"530D 5241 4E41 530D 5241 4E43 450D 5241"            /* SRANASRANCERA */	$"4E44 530D 5241 4E45 450D 5241 4E47 410D"            /* NDSRANEERANGA */	$"5241 4E47 490D 5241 4E47 530D 5241 4E47"            /* RANGIRANGSRANG */	$"590D 5241 4E49 440D 5241 4E49 530D 5241"            /* YRANIDRANISRA */	$"4E4B 450D 5241 4E4B 530D 5241 4E54 530D"            /* NKERANKSRANTS */	$"5241 5045 440D 5241 5045 520D 5241 5045"            /* RAPEDRAPERRAPE */	$"530D 5241 5048 450D 5241 5050 450D 5241"            /* SRAPHERAPPERA */	$"5245 440D 5241 5245 450D 5241 5245 530D"            /* REDRAREERARES */	$"5241 524B 530D 5241 5345 440D 5241 5345"            /* RARKSRASEDRASE */	$"520D 5241 5345 530D 5241 5350 530D 5241"            /* RRASESRASPSRA */	$"5353 450D 5241 5354 410D 5241 5441 4C0D"            /* SSERASTARATAL */	$"5241 5441 4E0D 5241 5441 530D 5241 5443"            /* RATANRATASRATC */	$"480D 5241 5445 440D 5241 5445 4C0D 5241"            /* HRATEDRATELRA */	$"5445 520D 5241 5445 530D 5241 5448 410D"            /* TERRATESRATHA */	$"5241 5448 450D 5241 5448 530D 5241 544F"            /* RATHERATHSRATO */	$"4F0D 5241 544F 530D 5241 5455 530D 5241"            /* ORATOSRATUSRA */	$"554E 530D 5241 5550 4F0D 5241 5645 440D"            /* UNSRAUPORAVED */	$"5241 5645 4C0D 5241 5645 520D 5241 5645"            /* RAVELRAVERRAVE */	$"530D 5241 5645 590D 5241 5649 4E0D 5241"            /* SRAVEYRAVINRA */	$"5745 520D 5241 5749 4E0D 5241 574C 590D"            /* WERRAWINRAWLY */	$"5241 574E 530D 5241 5845 440D 5241 5845"            /* RAWNSRAXEDRAXE */	$"530D 5241 5941 480D 5241 5941 530D 5241"            /* SRAYAHRAYASRA */	$"5945 440D 5241 594C 450D 5241 594E 450D"            /* YEDRAYLERAYNE */	$"5241 5A45 440D 5241 5A45 450D 5241 5A45"            /* RAZEDRAZEERAZE */	$"520D 5241 5A45 530D 5241 5A4F 4F0D 5245"            /* RRAZESRAZOORE */	$"4144 440D 5245 4144 530D 5245 4149 530D"            /* ADDREADSREAIS */	$"5245 414B 530D 5245 414C 4F0D 5245 414C"            /* REAKSREALOREAL */	$"530D 5245 414D 450D 5245 414D 530D 5245"            /* SREAMEREAMSRE */	$"414D 590D 5245 414E 530D 5245 4150 530D"            /* AMYREANSREAPS */	$"5245 4152 530D 5245 4153 540D 5245 4154"            /* REARSREASTREAT */	$"410D 5245 4154 450D 5245 4156 450D 5245"            /* AREATEREAVERE */	$"4242 450D 5245 4245 430D 5245 4249 440D"            /* BBEREBECREBID */	$"5245 4249 540D 5245 424F 500D 5245 4255"            /* REBITREBOPREBU */	$"590D 5245 4341 4C0D 5245 4343 450D 5245"            /* YRECALRECCERE */	$"4343 4F0D 5245 4343 590D 5245 4349 540D"            /* CCORECCYRECIT */	$"5245 434B 530D 5245 434F 4E0D 5245 4354"            /* RECKSRECONRECT */	$"410D 5245 4354 490D 5245 4354 4F0D 5245"            /* ARECTIRECTORE */	$"4441 4E0D 5245 4444 530D 5245 4444 590D"            /* DANREDDSREDDY */	$"5245 4445 440D 5245 4445 530D 5245 4449"            /* REDEDREDESREDI */	$"410D 5245 4449 440D 5245 4449 500D 5245"            /* AREDIDREDIPRE */	$"444C 590D 5245 444F 4E0D 5245 444F 530D"            /* DLYREDONREDOS */	$"5245 444F 580D 5245 4452 590D 5245 4455"            /* REDOXREDRYREDU */	$"420D 5245 4455 580D 5245 4459 450D 5245"            /* BREDUXREDYERE */	$"4543 480D 5245 4544 450D 5245 4544 530D"            /* ECHREEDEREEDS */	$"5245 4546 530D 5245 4546 590D 5245 454B"            /* REEFSREEFYREEK */	$"530D 5245 454B 590D 5245 454C 530D 5245"            /* SREEKYREELSRE */	$"454E 530D 5245 4553 540D 5245 4556 450D"            /* ENSREESTREEVE */	$"5245 4645 440D 5245 4645 4C0D 5245 4646"            /* REFEDREFELREFF */	$"4F0D 5245 4649 530D 5245 4649 580D 5245"            /* OREFISREFIXRE */	$"464C 590D 5245 4652 590D 5245 4741 520D"            /* FLYREFRYREGAR */	$"5245 4745 530D 5245 4747 4F0D 5245 4749"            /* REGESREGGOREGI */	$"450D 5245 474D 410D 5245 474E 410D 5245"            /* EREGMAREGNARE */	$"474F 530D 5245 4755 520D 5245 4845 4D0D"            /* GOSREGURREHEM */	$"5245 4946 530D 5245 4946 590D 5245 494B"            /* REIFSREIFYREIK */	$"490D 5245 494B 530D 5245 494E 4B0D 5245"            /* IREIKSREINKRE */	$"494E 530D 5245 4952 440D 5245 4953 540D"            /* INSREIRDREIST */	$"5245 4956 450D 5245 4A49 470D 5245 4A4F"            /* REIVEREJIGREJO */	$"4E0D 5245 4B45 440D 5245 4B45 530D 5245"            /* NREKEDREKESRE */	$"4B45 590D 5245 4C45 540D 5245 4C49 450D"            /* KEYRELETRELIE */	$"5245 4C49 540D 5245 4C4C 4F0D 5245 4D41"            /* RELITRELLOREMA */	$"4E0D 5245 4D41 500D 5245 4D45 4E0D 5245"            /* NREMAPREMENRE */	$"4D45 540D 5245 4D45 580D 5245 4D49 580D"            /* METREMEXREMIX */	$"5245 4E41 590D 5245 4E44 530D 5245 4E45"            /* RENAYRENDSRENE */	$"590D 5245 4E47 410D 5245 4E49 470D 5245"            /* YRENGARENIGRE */	$"4E49 4E0D 5245 4E4E 450D 5245 4E4F 530D"            /* NINRENNERENOS */	$"5245 4E54 450D 5245 4E54 530D 5245 4F49"            /* RENTERENTSREOI */	$"4C0D 5245 4F52 470D 5245 5045 470D 5245"            /* LREORGREPEGRE */	$"5049 4E0D 5245 504C 410D 5245 504F 530D"            /* PINREPLAREPOS */	$"5245 504F 540D 5245 5050 530D 5245 5052"            /* REPOTREPPSREPR */	$"4F0D 5245 5241 4E0D 5245 5249 470D 5245"            /* ORERANRERIGRE */	$"5341 540D 5245 5341 570D 5245 5341 590D"            /* SATRESAWRESAY */	$"5245 5345 450D 5245 5345 530D 5245 5345"            /* RESEERESESRESE */	$"570D 5245 5349 440D 5245 5349 540D 5245"            /* WRESIDRESITRE */	$"534F 440D 5245 534F 570D 5245 5354 4F0D"            /* SODRESOWRESTO */	$"5245 5354 530D 5245 5354 590D 5245 5355"            /* RESTSRESTYRESU */	$"530D 5245 5441 470D 5245 5441 580D 5245"            /* SRETAGRETAXRE */	$"5445 4D0D 5245 5449 410D 5245 5449 450D"            /* TEMRETIARETIE */	$"5245 544F 580D 5245 5645 540D 5245 5649"            /* RETOXREVETREVI */	$"450D 5245 5741 4E0D 5245 5741 580D 5245"            /* EREWANREWAXRE */	$"5745 440D 5245 5745 540D 5245 5749 4E0D"            /* WEDREWETREWIN */	$"5245 574F 4E0D 5245 5754 480D 5245 5845"            /* REWONREWTHREXE */	$"530D 5245 5A45 530D 5248 4541 530D 5248"            /* SREZESRHEASRH */	$"454D 450D 5248 4555 4D0D 5248 4945 530D"            /* EMERHEUMRHIES */	$"5248 494D 450D 5248 494E 450D 5248 4F44"            /* RHIMERHINERHOD */	$"590D 5248 4F4D 420D 5248 4F4E 450D 5248"            /* YRHOMBRHONERH */	$"554D 420D 5248 594E 450D 5248 5954 410D"            /* UMBRHYNERHYTA */	$"5249 4144 530D 5249 414C 530D 5249 414E"            /* RIADSRIALSRIAN */	$"540D 5249 4154 410D 5249 4241 530D 5249"            /* TRIATARIBASRI */	$"4242 590D 5249 4245 530D 5249 4345 440D"            /* BBYRIBESRICED */	$"5249 4345 520D 5249 4345 530D 5249 4345"            /* RICERRICESRICE */	$"590D 5249 4348 540D 5249 4349 4E0D 5249"            /* YRICHTRICINRI */	$"434B 530D 5249 4445 530D 5249 4447 590D"            /* CKSRIDESRIDGY */	$"5249 4449 430D 5249 454C 530D 5249 454D"            /* RIDICRIELSRIEM */	$"530D 5249 4556 450D 5249 4645 520D 5249"            /* SRIEVERIFERRI */	$"4646 530D 5249 4654 450D 5249 4654 530D"            /* FFSRIFTERIFTS */	$"5249 4654 590D 5249 4747 530D 5249 474F"            /* RIFTYRIGGSRIGO */	$"4C0D 5249 4C45 440D 5249 4C45 530D 5249"            /* LRILEDRILESRI */	$"4C45 590D 5249 4C4C 450D 5249 4C4C 530D"            /* LEYRILLERILLS */	$"5249 4D41 450D 5249 4D45 440D 5249 4D45"            /* RIMAERIMEDRIME */	$"520D 5249 4D45 530D 5249 4D55 530D 5249"            /* RRIMESRIMUSRI */	$"4E44 530D 5249 4E44 590D 5249 4E45 530D"            /* NDSRINDYRINES */	$"5249 4E47 530D 5249 4E4B 530D 5249 4F4A"            /* RINGSRINKSRIOJ */	$"410D 5249 4F54 530D 5249 5045 440D 5249"            /* ARIOTSRIPEDRI */	$"5045 530D 5249 5050 530D 5249 5345 530D"            /* PESRIPPSRISES */	$"5249 5348 490D 5249 534B 530D 5249 5350"            /* RISHIRISKSRISP */	$"530D 5249 5355 530D 5249 5445 530D 5249"            /* SRISUSRITESRI */	$"5454 530D 5249 545A 590D 5249 5641 530D"            /* TTSRITZYRIVAS */	$"5249 5645 440D 5249 5645 4C0D 5249 5645"            /* RIVEDRIVELRIVE */	$"4E0D 5249 5645 530D 5249 5941 4C0D 5249"            /* NRIVESRIYALRI */	$"5A41 530D 524F 4144 530D 524F 414D 530D"            /* ZASROADSROAMS */	$"524F 414E 530D 524F 4152 530D 524F 4152"            /* ROANSROARSROAR */	$"590D 524F 4154 450D 524F 4245 440D 524F"            /* YROATEROBEDRO */	$"4245 530D 524F 424C 450D 524F 434B 530D"            /* BESROBLEROCKS */	$"524F 4445 440D 524F 4445 530D 524F 4755"            /* RODEDRODESROGU */	$"590D 524F 4845 530D 524F 4944 530D 524F"            /* YROHESROIDSRO */	$"494C 530D 524F 494C 590D 524F 494E 530D"            /* ILSROILYROINS */	$"524F 4953 540D 524F 4A41 4B0D 524F 4A49"            /* ROISTROJAKROJI */	$"530D 524F 4B45 440D 524F 4B45 520D 524F"            /* SROKEDROKERRO */	$"4B45 530D 524F 4C41 470D 524F 4C45 530D"            /* KESROLAGROLES */	$"524F 4C46 530D 524F 4C4C 530D 524F 4D41"            /* ROLFSROLLSROMA */	$"4C0D 524F 4D41 4E0D 524F 4D45 4F0D 524F"            /* LROMANROMEORO */	$"4D50 530D 524F 4E44 450D 524F 4E44 4F0D"            /* MPSRONDERONDO */	$"524F 4E45 4F0D 524F 4E45 530D 524F 4E49"            /* RONEORONESRONI */	$"4E0D 524F 4E4E 450D 524F 4E54 450D 524F"            /* NRONNERONTERO */	$"4E54 530D 524F 4F44 530D 524F 4F46 530D"            /* NTSROODSROOFS */	$"524F 4F46 590D 524F 4F4B 530D 524F 4F4B"            /* ROOFYROOKSROOK */	$"590D 524F 4F4D 530D 524F 4F4E 530D 524F"            /* YROOMSROONSRO */	$"4F50 530D 524F 4F50 590D 524F 4F53 410D"            /* OPSROOPYROOSA */	$"524F 4F53 450D 524F 4F54 530D 524F 4F54"            /* ROOSEROOTSROOT */	$"590D 524F 5045 440D 524F 5045 520D 524F"            /* YROPEDROPERRO */	$"5045 530D 524F 5045 590D 524F 5155 450D"            /* PESROPEYROQUE */	$"524F 5241 4C0D 524F 5245 530D 524F 5249"            /* RORALRORESRORI */	$"430D 524F 5249 440D 524F 5249 450D 524F"            /* CRORIDRORIERO */	$"5254 530D 524F 5254 590D 524F 5345 440D"            /* RTSRORTYROSED */	$"524F 5345 530D 524F 5345 540D 524F 5348"            /* ROSESROSETROSH */	$"490D 524F 5349 4E0D 524F 5349 540D 524F"            /* IROSINROSITRO */	$"5354 490D 524F 5354 530D 524F 5441 4C0D"            /* STIROSTSROTAL */	$"524F 5441 4E0D 524F 5441 530D 524F 5443"            /* ROTANROTASROTC */	$"480D 524F 5445 440D 524F 5445 530D 524F"            /* HROTEDROTESRO */	$"5449 530D 524F 544C 530D 524F 544F 4E0D"            /* TISROTLSROTON */	$"524F 544F 530D 524F 5454 450D 524F 5545"            /* ROTOSROTTEROUE */	$"4E0D 524F 5545 530D 524F 554C 450D 524F"            /* NROUESROULERO */	$"554C 530D 524F 554D 530D 524F 5550 530D"            /* ULSROUMSROUPS */	$"524F 5550 590D 524F 5553 540D 524F 5554"            /* ROUPYROUSTROUT */	$"480D 524F 5554 530D 524F 5645 440D 524F"            /* HROUTSROVEDRO */	$"5645 4E0D 524F 5645 530D 524F 5741 4E0D"            /* VENROVESROWAN */	$"524F 5745 440D 524F 5745 4C0D 524F 5745"            /* ROWEDROWELROWE */	$"4E0D 524F 5749 450D 524F 574D 450D 524F"            /* NROWIEROWMERO */	$"574E 440D 524F 5754 480D 524F 5754 530D"            /* WNDROWTHROWTS */	$"524F 594E 450D 524F 5953 540D 524F 5A45"            /* ROYNEROYSTROZE */	$"540D 524F 5A49 540D 5255 414E 410D 5255"            /* TROZITRUANARU */	$"4241 490D 5255 4242 590D 5255 4245 4C0D"            /* BAIRUBBYRUBEL */	$"5255 4245 530D 5255 4249 4E0D 5255 424C"            /* RUBESRUBINRUBL */	$"450D 5255 424C 490D 5255 4255 530D 5255"            /* ERUBLIRUBUSRU */	$"4348 450D 5255 434B 530D 5255 4441 530D"            /* CHERUCKSRUDAS */	$"5255 4444 530D 5255 4445 530D 5255 4449"            /* RUDDSRUDESRUDI */	$"450D 5255 4449 530D 5255 4544 410D 5255"            /* ERUDISRUEDARU */	$"4552 530D 5255 4646 450D 5255 4646 530D"            /* ERSRUFFERUFFS */	$"5255 4741 450D 5255 4741 4C0D 5255 4747"            /* RUGAERUGALRUGG */	$"590D 5255 494E 470D 5255 494E 530D 5255"            /* YRUINGRUINSRU */	$"4B48 530D 5255 4C45 440D 5255 4C45 530D"            /* KHSRULEDRULES */	$"5255 4D41 4C0D 5255 4D42 4F0D 5255 4D45"            /* RUMALRUMBORUME */	$"4E0D 5255 4D45 530D 5255 4D4C 590D 5255"            /* NRUMESRUMLYRU */	$"4D4D 590D 5255 4D50 4F0D 5255 4D50 530D"            /* MMYRUMPORUMPS */	$"5255 4D50 590D 5255 4E43 480D 5255 4E44"            /* RUMPYRUNCHRUND */	$"530D 5255 4E45 440D 5255 4E45 530D 5255"            /* SRUNEDRUNESRU */	$"4E47 530D 5255 4E49 430D 5255 4E4E 590D"            /* NGSRUNICRUNNY */	$"5255 4E54 530D 5255 4E54 590D 5255 5049"            /* RUNTSRUNTYRUPI */	$"410D 5255 5250 530D 5255 5255 530D 5255"            /* ARURPSRURUSRU */	$"5341 530D 5255 5345 530D 5255 5348 590D"            /* SASRUSESRUSHY */	$"5255 534B 530D 5255 534D 410D 5255 5353"            /* RUSKSRUSMARUSS */	$"450D 5255 5354 530D 5255 5448 530D 5255"            /* ERUSTSRUTHSRU */	$"5449 4E0D 5255 5454 590D 5259 414C 530D"            /* TINRUTTYRYALS */	$"5259 4241 540D 5259 4B45 440D 5259 4B45"            /* RYBATRYKEDRYKE */	$"530D 5259 4D4D 450D 5259 4E44 530D 5259"            /* SRYMMERYNDSRY */	$"4F54 530D 5259 5045 520D 5341 4147 530D"            /* OTSRYPERSAAGS */	$"5341 4241 4C0D 5341 4245 440D 5341 4245"            /* SABALSABEDSABE */	$"520D 5341 4245 530D 5341 4248 410D 5341"            /* RSABESSABHASA */	$"4249 4E0D 5341 4249 520D 5341 424C 450D"            /* BINSABIRSABLE */	$"5341 424F 540D 5341 4252 410D 5341 4252"            /* SABOTSABRASABR */	$"450D 5341 434B 530D 5341 4352 410D 5341"            /* ESACKSSACRASA */	$"4444 4F0D 5341 4445 530D 5341 4448 450D"            /* DDOSADESSADHE */	$"5341 4448 550D 5341 4449 530D 5341 444F"            /* SADHUSADISSADO */	$"530D 5341 445A 410D 5341 4645 440D 5341"            /* SSADZASAFEDSA */	$"4645 530D 5341 4741 530D 5341 4745 520D"            /* FESSAGASSAGER */	$"5341 4745 530D 5341 4747 590D 5341 474F"            /* SAGESSAGGYSAGO */	$"530D 5341 4755 4D0D 5341 4845 420D 5341"            /* SSAGUMSAHEBSA */	$"4849 420D 5341 4943 450D 5341 4943 4B0D"            /* HIBSAICESAICK */	$"5341 4943 530D 5341 4944 530D 5341 4947"            /* SAICSSAIDSSAIG */	$"410D 5341 494C 530D 5341 494D 530D 5341"            /* ASAILSSAIMSSA */	$"494E 450D 5341 494E 530D 5341 4952 530D"            /* INESAINSSAIRS */	$"5341 4953 540D 5341 4954 480D 5341 4A4F"            /* SAISTSAITHSAJO */	$"550D 5341 4B41 490D 5341 4B45 520D 5341"            /* USAKAISAKERSA */	$"4B45 530D 5341 4B49 410D 5341 4B49 530D"            /* KESSAKIASAKIS */	$"5341 4B54 490D 5341 4C41 4C0D 5341 4C41"            /* SAKTISALALSALA */	$"540D 5341 4C45 500D 5341 4C45 530D 5341"            /* TSALEPSALESSA */	$"4C45 540D 5341 4C49 430D 5341 4C49 580D"            /* LETSALICSALIX */	$"5341 4C4C 450D 5341 4C4D 490D 5341 4C4F"            /* SALLESALMISALO */	$"4C0D 5341 4C4F 500D 5341 4C50 410D 5341"            /* LSALOPSALPASA */	$"4C50 530D 5341 4C53 450D 5341 4C54 4F0D"            /* LPSSALSESALTO */	$"5341 4C54 530D 5341 4C55 450D 5341 4C55"            /* SALTSSALUESALU */	$"540D 5341 4D41 4E0D 5341 4D41 530D 5341"            /* TSAMANSAMASSA */	$"4D42 410D 5341 4D42 4F0D 5341 4D45 4B0D"            /* MBASAMBOSAMEK */	$"5341 4D45 4C0D 5341 4D45 4E0D 5341 4D45"            /* SAMELSAMENSAME */	$"530D 5341 4D45 590D 5341 4D46 550D 5341"            /* SSAMEYSAMFUSA */	$"4D4D 590D 5341 4D50 490D 5341 4D50 530D"            /* MMYSAMPISAMPS */	$"5341 4E44 530D 5341 4E45 440D 5341 4E45"            /* SANDSSANEDSANE */	$"530D 5341 4E47 410D 5341 4E47 480D 5341"            /* SSANGASANGHSA */	$"4E47 4F0D 5341 4E47 530D 5341 4E4B 4F0D"            /* NGOSANGSSANKO */	$"5341 4E53 410D 5341 4E54 4F0D 5341 4E54"            /* SANSASANTOSANT */	$"530D 5341 4F4C 410D 5341 5041 4E0D 5341"            /* SSAOLASAPANSA */	$"5049 440D 5341 504F 520D 5341 5241 4E0D"            /* PIDSAPORSARAN */	$"5341 5244 530D 5341 5245 440D 5341 5245"            /* SARDSSAREDSARE */	$"450D 5341 5247 450D 5341 5247 4F0D 5341"            /* ESARGESARGOSA */	$"5249 4E0D 5341 5249 530D 5341 524B 530D"            /* RINSARISSARKS */	$"5341 524B 590D 5341 524F 440D 5341 524F"            /* SARKYSARODSARO */	$"530D 5341 5255 530D 5341 5345 520D 5341"            /* SSARUSSASERSA */	$"5349 4E0D 5341 5353 450D 5341 5441 490D"            /* SINSASSESATAI */	$"5341 5441 590D 5341 5445 440D 5341 5445"            /* SATAYSATEDSATE */	$"4D0D 5341 5445 530D 5341 5449 530D 5341"            /* MSATESSATISSA */	$"5542 410D 5341 5543 480D 5341 5547 480D"            /* UBASAUCHSAUGH */	$"5341 554C 530D 5341 554C 540D 5341 554E"            /* SAULSSAULTSAUN */	$"540D 5341 5552 590D 5341 5554 530D 5341"            /* TSAURYSAUTSSA */	$"5645 440D 5341 5645 520D 5341 5645 530D"            /* VEDSAVERSAVES */	$"5341 5645 590D 5341 5649 4E0D 5341 5741"            /* SAVEYSAVINSAWA */	$"480D 5341 5745 440D 5341 5745 520D 5341"            /* HSAWEDSAWERSA */	$"5845 530D 5341 5945 440D 5341 5945 520D"            /* XESSAYEDSAYER */	$"5341 5949 440D 5341 594E 450D 5341 594F"            /* SAYIDSAYNESAYO */	$"4E0D 5341 5953 540D 5341 5A45 530D 5343"            /* NSAYSTSAZESSC */	$"4142 530D 5343 4144 530D 5343 4146 460D"            /* ABSSCADSSCAFF */	$"5343 4147 530D 5343 4149 4C0D 5343 414C"            /* SCAGSSCAILSCAL */	$"410D 5343 414C 4C0D 5343 414D 530D 5343"            /* ASCALLSCAMSSC */	$"414E 440D 5343 414E 530D 5343 4150 410D"            /* ANDSCANSSCAPA */	$"5343 4150 450D 5343 4150 490D 5343 4152"            /* SCAPESCAPISCAR */	$"500D 5343 4152 530D 5343 4152 540D 5343"            /* PSCARSSCARTSC */	$"4154 480D 5343 4154 530D 5343 4154 540D"            /* ATHSCATSSCATT */	$"5343 4155 440D 5343 4155 500D 5343 4155"            /* SCAUDSCAUPSCAU */	$"520D 5343 4157 530D 5343 4541 540D 5343"            /* RSCAWSSCEATSC */	$"454E 410D 5343 454E 440D 5343 4841 560D"            /* ENASCENDSCHAV */	$"5343 484D 4F0D 5343 4855 4C0D 5343 4857"            /* SCHMOSCHULSCHW */	$"410D 5343 4C49 4D0D 5343 4F44 590D 5343"            /* ASCLIMSCODYSC */	$"4F47 530D 5343 4F4F 470D 5343 4F4F 540D"            /* OGSSCOOGSCOOT */	$"5343 4F50 410D 5343 4F50 530D 5343 4F54"            /* SCOPASCOPSSCOT */	$"530D 5343 4F55 470D 5343 4F55 500D 5343"            /* SSCOUGSCOUPSC */	$"4F57 500D 5343 4F57 530D 5343 5241 420D"            /* OWPSCOWSSCRAB */	$"5343 5241 450D 5343 5241 470D 5343 5241"            /* SCRAESCRAGSCRA */	$"4E0D 5343 5241 540D 5343 5241 570D 5343"            /* NSCRATSCRAWSC */	$"5241 590D 5343 5249 4D0D 5343 5249 500D"            /* RAYSCRIMSCRIP */	$"5343 524F 420D 5343 524F 440D 5343 524F"            /* SCROBSCRODSCRO */	$"470D 5343 524F 570D 5343 5544 490D 5343"            /* GSCROWSCUDISC */	$"5544 4F0D 5343 5544 530D 5343 5546 460D"            /* UDOSCUDSSCUFF */	$"5343 5546 540D 5343 5547 530D 5343 554C"            /* SCUFTSCUGSSCUL */	$"4B0D 5343 554C 4C0D 5343 554C 500D 5343"            /* KSCULLSCULPSC */	$"554C 530D 5343 554D 530D 5343 5550 530D"            /* ULSSCUMSSCUPS */	$"5343 5552 460D 5343 5552 530D 5343 5553"            /* SCURFSCURSSCUS */	$"450D 5343 5554 410D 5343 5554 450D 5343"            /* ESCUTASCUTESC */	$"5554 530D 5343 555A 5A0D 5343 5945 530D"            /* UTSSCUZZSCYES */	$"5344 4159 4E0D 5344 4549 4E0D 5345 414C"            /* SDAYNSDEINSEAL */	$"530D 5345 414D 450D 5345 414D 530D 5345"            /* SSEAMESEAMSSE */	$"414D 590D 5345 414E 530D 5345 4152 450D"            /* AMYSEANSSEARE */	$"5345 4152 530D 5345 4153 450D 5345 4154"            /* SEARSSEASESEAT */	$"530D 5345 415A 450D 5345 4255 4D0D 5345"            /* SSEAZESEBUMSE */	$"4343 4F0D 5345 4348 530D 5345 4354 530D"            /* CCOSECHSSECTS */	$"5345 4445 520D 5345 4445 530D 5345 4447"            /* SEDERSEDESSEDG */	$"450D 5345 4447 590D 5345 4455 4D0D 5345"            /* ESEDGYSEDUMSE */	$"4544 530D 5345 454B 530D 5345 454C 440D"            /* EDSSEEKSSEELD */	$"5345 454C 530D 5345 454C 590D 5345 454D"            /* SEELSSEELYSEEM */	$"530D 5345 4550 530D 5345 4550 590D 5345"            /* SSEEPSSEEPYSE */	$"4552 530D 5345 4645 520D 5345 4741 520D"            /* ERSSEFERSEGAR */	$"5345 474E 490D 5345 474E 4F0D 5345 474F"            /* SEGNISEGNOSEGO */	$"4C0D 5345 474F 530D 5345 4852 490D 5345"            /* LSEGOSSEHRISE */	$"4946 530D 5345 494C 530D 5345 494E 450D"            /* IFSSEILSSEINE */	$"5345 4952 530D 5345 4953 450D 5345 4953"            /* SEIRSSEISESEIS */	$"4D0D 5345 4954 590D 5345 495A 410D 5345"            /* MSEITYSEIZASE */	$"4B4F 530D 5345 4B54 530D 5345 4C41 480D"            /* KOSSEKTSSELAH */	$"5345 4C45 530D 5345 4C46 530D 5345 4C4C"            /* SELESSELFSSELL */	$"410D 5345 4C4C 450D 5345 4C4C 530D 5345"            /* ASELLESELLSSE */	$"4C56 410D 5345 4D45 450D 5345 4D45 530D"            /* LVASEMEESEMES */	$"5345 4D49 450D 5345 4D49 530D 5345 4E41"            /* SEMIESEMISSENA */	$"530D 5345 4E44 530D 5345 4E45 530D 5345"            /* SSENDSSENESSE */	$"4E47 490D 5345 4E4E 410D 5345 4E4F 520D"            /* NGISENNASENOR */	$"5345 4E53 410D 5345 4E53 490D 5345 4E54"            /* SENSASENSISENT */	$"450D 5345 4E54 490D 5345 4E54 530D 5345"            /* ESENTISENTSSE */	$"4E56 590D 5345 4E5A 410D 5345 5041 440D"            /* NVYSENZASEPAD */	$"5345 5041 4C0D 5345 5049 430D 5345 504F"            /* SEPALSEPICSEPO */	$"590D 5345 5054 410D 5345 5054 530D 5345"            /* YSEPTASEPTSSE */	$"5241 430D 5345 5241 490D 5345 5241 4C0D"            /* RACSERAISERAL */	$"5345 5245 440D 5345 5245 520D 5345 5245"            /* SEREDSERERSERE */	$"530D 5345 5246 530D 5345 5247 450D 5345"            /* SSERFSSERGESE */	$"5249 430D 5345 5249 4E0D 5345 524B 530D"            /* RICSERINSERKS */	$"5345 524F 4E0D 5345 524F 570D 5345 5252"            /* SERONSEROWSERR */	$"410D 5345 5252 450D 5345 5252 530D 5345"            /* ASERRESERRSSE */	$"5252 590D 5345 5256 4F0D 5345 5345 590D"            /* RRYSERVOSESEY */	$"5345 5353 410D 5345 5441 450D 5345 5441"            /* SESSASETAESETA */	$"4C0D 5345 544F 4E0D 5345 5454 530D 5345"            /* LSETONSETTSSE */	$"5741 4E0D 5345 5741 520D 5345 5745 440D"            /* WANSEWARSEWED */	$"5345 5745 4C0D 5345 5745 4E0D 5345 5749"            /* SEWELSEWENSEWI */	$"4E0D 5345 5845 440D 5345 5845 520D 5345"            /* NSEXEDSEXERSE */	$"5845 530D 5345 5854 4F0D 5345 5854 530D"            /* XESSEXTOSEXTS */	$"5345 5945 4E0D 5348 4144 530D 5348 4147"            /* SEYENSHADSSHAG */	$"530D 5348 4148 530D 5348 414B 4F0D 5348"            /* SSHAHSSHAKOSH */	$"414B 540D 5348 414C 4D0D 5348 414C 590D"            /* AKTSHALMSHALY */	$"5348 414D 410D 5348 414D 530D 5348 414E"            /* SHAMASHAMSSHAN */	$"440D 5348 414E 530D 5348 4150 530D 5348"            /* DSHANSSHAPSSH */	$"4152 4E0D 5348 4153 480D 5348 4155 4C0D"            /* ARNSHASHSHAUL */	$"5348 4157 4D0D 5348 4157 4E0D 5348 4157"            /* SHAWMSHAWNSHAW */	$"530D 5348 4159 410D 5348 4159 530D 5348"            /* SSHAYASHAYSSH */	$"4348 490D 5348 4541 460D 5348 4541 4C0D"            /* CHISHEAFSHEAL */	$"5348 4541 530D 5348 4544 530D 5348 4545"            /* SHEASSHEDSSHEE */	$"4C0D 5348 454E 440D 5348 454E 540D 5348"            /* LSHENDSHENTSH */	$"454F 4C0D 5348 4552 440D 5348 4552 450D"            /* EOLSHERDSHERE */	$"5348 4552 4F0D 5348 4554 530D 5348 4556"            /* SHEROSHETSSHEV */	$"410D 5348 4557 4E0D 5348 4557 530D 5348"            /* ASHEWNSHEWSSH */	$"4941 490D 5348 4945 4C0D 5348 4945 520D"            /* IAISHIELSHIER */	$"5348 4945 530D 5348 494C 4C0D 5348 494C"            /* SHIESSHILLSHIL */	$"590D 5348 494D 530D 5348 494E 530D 5348"            /* YSHIMSSHINSSH */	$"4950 530D 5348 4952 520D 5348 4952 530D"            /* IPSSHIRRSHIRS */	$"5348 4953 480D 5348 4953 4F0D 5348 4953"            /* SHISHSHISOSHIS */	$"540D 5348 4954 450D 5348 4954 530D 5348"            /* TSHITESHITSSH */	$"4955 520D 5348 4956 410D 5348 4956 450D"            /* IURSHIVASHIVE */	$"5348 4956 530D 5348 4C45 500D 5348 4C55"            /* SHIVSSHLEPSHLU */	$"420D 5348 4D45 4B0D 5348 4D4F 450D 5348"            /* BSHMEKSHMOESH */	$"4F41 540D 5348 4F45 440D 5348 4F45 520D"            /* OATSHOEDSHOER */	$"5348 4F45 530D 5348 4F47 490D 5348 4F47"            /* SHOESSHOGISHOG */	$"530D 5348 4F4A 490D 5348 4F4A 4F0D 5348"            /* SSHOJISHOJOSH */	$"4F4C 410D 5348 4F4F 4C0D 5348 4F4F 4E0D"            /* OLASHOOLSHOON */	$"5348 4F4F 530D 5348 4F50 450D 5348 4F50"            /* SHOOSSHOPESHOP */	$"530D 5348 4F52 4C0D 5348 4F54 450D 5348"            /* SSHORLSHOTESH */	$"4F54 530D 5348 4F54 540D 5348 4F57 440D"            /* OTSSHOTTSHOWD */	$"5348 4F57 530D 5348 4F59 550D 5348 5245"            /* SHOWSSHOYUSHRE */	$"440D 5348 5249 530D 5348 524F 570D 5348"            /* DSHRISSHROWSH */	$"5449 4B0D 5348 5455 4D0D 5348 5455 500D"            /* TIKSHTUMSHTUP */	$"5348 554C 450D 5348 554C 4E0D 5348 554C"            /* SHULESHULNSHUL */	$"530D 5348 554E 530D 5348 5552 410D 5348"            /* SSHUNSSHURASH */	$"5554 450D 5348 5554 530D 5348 5741 530D"            /* UTESHUTSSHWAS */	$"5348 5945 520D 5349 414C 530D 5349 4242"            /* SHYERSIALSSIBB */	$"530D 5349 4259 4C0D 5349 4345 530D 5349"            /* SSIBYLSICESSI */	$"4348 540D 5349 434B 4F0D 5349 434B 530D"            /* CHTSICKOSICKS */	$"5349 434B 590D 5349 4441 530D 5349 4445"            /* SICKYSIDASSIDE */	$"440D 5349 4445 520D 5349 4445 530D 5349"            /* DSIDERSIDESSI */	$"4448 410D 5349 4448 450D 5349 444C 450D"            /* DHASIDHESIDLE */	$"5349 454C 440D 5349 454E 530D 5349 454E"            /* SIELDSIENSSIEN */	$"540D 5349 4554 480D 5349 4555 520D 5349"            /* TSIETHSIEURSI */	$"4654 530D 5349 4748 530D 5349 4749 4C0D"            /* FTSSIGHSSIGIL */	$"5349 474C 410D 5349 474E 410D 5349 474E"            /* SIGLASIGNASIGN */	$"530D 5349 4A4F 530D 5349 4B41 530D 5349"            /* SSIJOSSIKASSI */	$"4B45 520D 5349 4B45 530D 5349 4C44 530D"            /* KERSIKESSILDS */	$"5349 4C45 440D 5349 4C45 4E0D 5349 4C45"            /* SILEDSILENSILE */	$"520D 5349 4C45 530D 5349 4C45 580D 5349"            /* RSILESSILEXSI */	$"4C4B 530D 5349 4C4C 530D 5349 4C4F 530D"            /* LKSSILLSSILOS */	$"5349 4C54 530D 5349 4C54 590D 5349 4C56"            /* SILTSSILTYSILV */	$"410D 5349 4D41 520D 5349 4D41 530D 5349"            /* ASIMARSIMASSI */	$"4D42 410D 5349 4D49 530D 5349 4D50 530D"            /* MBASIMISSIMPS */	$"5349 4D55 4C0D 5349 4E44 530D 5349 4E45"            /* SIMULSINDSSINE */	$"440D 5349 4E45 530D 5349 4E47 530D 5349"            /* DSINESSINGSSI */	$"4E48 530D 5349 4E4B 530D 5349 4E4B 590D"            /* NHSSINKSSINKY */	$"5349 4E55 530D 5349 5045 440D 5349 5045"            /* SINUSSIPEDSIPE */	$"530D 5349 5050 590D 5349 5245 440D 5349"            /* SSIPPYSIREDSI */	$"5245 450D 5349 5245 530D 5349 5249 480D"            /* REESIRESSIRIH */	$"5349 5249 530D 5349 524F 430D 5349 5252"            /* SIRISSIROCSIRR */	$"410D 5349 5255 500D 5349 5341 4C0D 5349"            /* ASIRUPSISALSI */	$"5345 530D 5349 5354 410D 5349 5354 530D"            /* SESSISTASISTS */	$"5349 5441 520D 5349 5445 440D 5349 5445"            /* SITARSITEDSITE */	$"530D 5349 5448 450D 5349 544B 410D 5349"            /* SSITHESITKASI */	$"5455 500D 5349 5455 530D 5349 5645 520D"            /* TUPSITUSSIVER */	$"5349 5845 520D 5349 5845 530D 5349 584D"            /* SIXERSIXESSIXM */	$"4F0D 5349 5854 450D 5349 5A41 520D 5349"            /* OSIXTESIZARSI */	$"5A45 440D 5349 5A45 4C0D 5349 5A45 520D"            /* ZEDSIZELSIZER */	$"5349 5A45 530D 534B 4147 530D 534B 4149"            /* SIZESSKAGSSKAI */	$"4C0D 534B 414C 440D 534B 414E 4B0D 534B"            /* LSKALDSKANKSK */	$"4152 540D 534B 4154 530D 534B 4154 540D"            /* ARTSKATSSKATT */	$"534B 4157 530D 534B 4541 4E0D 534B 4541"            /* SKAWSSKEANSKEA */	$"520D 534B 4544 530D 534B 4545 440D 534B"            /* RSKEDSSKEEDSK */	$"4545 460D 534B 4545 4E0D 534B 4545 520D"            /* EEFSKEENSKEER */	$"534B 4545 530D 534B 4545 540D 534B 4547"            /* SKEESSKEETSKEG */	$"470D 534B 4547 530D 534B 4549 4E0D 534B"            /* GSKEGSSKEINSK */	$"454C 460D 534B 454C 4C0D 534B 454C 4D0D"            /* ELFSKELLSKELM */	$"534B 454C 500D 534B 454E 450D 534B 454E"            /* SKELPSKENESKEN */	$"530D 534B 454F 530D 534B 4550 530D 534B"            /* SSKEOSSKEPSSK */	$"4552 530D 534B 4554 530D 534B 4557 530D"            /* ERSSKETSSKEWS */	$"534B 4944 530D 534B 4945 440D 534B 4945"            /* SKIDSSKIEDSKIE */	$"530D 534B 4945 590D 534B 494D 4F0D 534B"            /* SSKIEYSKIMOSK */	$"494D 530D 534B 494E 4B0D 534B 494E 530D"            /* IMSSKINKSKINS */	$"534B 494E 540D 534B 494F 530D 534B 4950"            /* SKINTSKIOSSKIP */	$"530D 534B 4952 4C0D 534B 4952 520D 534B"            /* SSKIRLSKIRRSK */	$"4954 450D 534B 4954 530D 534B 4956 450D"            /* ITESKITSSKIVE */	$"534B 4956 590D 534B 4C49 4D0D 534B 4F41"            /* SKIVYSKLIMSKOA */	$"4C0D 534B 4F44 590D 534B 4F46 460D 534B"            /* LSKODYSKOFFSK */	$"4F47 530D 534B 4F4C 530D 534B 4F4F 4C0D"            /* OGSSKOLSSKOOL */	$"534B 4F52 540D 534B 4F53 480D 534B 5241"            /* SKORTSKOSHSKRA */	$"4E0D 534B 5249 4B0D 534B 5541 530D 534B"            /* NSKRIKSKUASSK */	$"5547 530D 534B 5945 440D 534B 5945 520D"            /* UGSSKYEDSKYER */	$"534B 5945 590D 534B 5946 530D 534B 5952"            /* SKYEYSKYFSSKYR */	$"450D 534B 5952 530D 534B 5954 450D 534C"            /* ESKYRSSKYTESL */	$"4142 530D 534C 4144 450D 534C 4145 530D"            /* ABSSLADESLAES */	$"534C 4147 530D 534C 4149 440D 534C 414B"            /* SLAGSSLAIDSLAK */	$"450D 534C 414D 530D 534C 414E 450D 534C"            /* ESLAMSSLANESL */	$"414E 4B0D 534C 4150 530D 534C 4152 540D"            /* ANKSLAPSSLART */	$"534C 4154 530D 534C 4154 590D 534C 4156"            /* SLATSSLATYSLAV */	$"450D 534C 4157 530D 534C 4159 530D 534C"            /* ESLAWSSLAYSSL */	$"4542 530D 534C 4544 530D 534C 4545 520D"            /* EBSSLEDSSLEER */	$"534C 4557 530D 534C 4559 530D 534C 4945"            /* SLEWSSLEYSSLIE */	$"520D 534C 494C 590D 534C 494D 530D 534C"            /* RSLILYSLIMSSL */	$"4950 450D 534C 4950 530D 534C 4950 540D"            /* IPESLIPSSLIPT */	$"534C 4953 480D 534C 4954 530D 534C 4956"            /* SLISHSLITSSLIV */	$"450D 534C 4F41 4E0D 534C 4F42 530D 534C"            /* ESLOANSLOBSSL */	$"4F45 530D 534C 4F47 530D 534C 4F49 440D"            /* OESSLOGSSLOID */	$"534C 4F4A 440D 534C 4F4D 4F0D 534C 4F4F"            /* SLOJDSLOMOSLOO */	$"4D0D 534C 4F4F 540D 534C 4F50 530D 534C"            /* MSLOOTSLOPSSL */	$"4F50 590D 534C 4F52 4D0D 534C 4F54 530D"            /* OPYSLORMSLOTS */	$"534C 4F56 450D 534C 4F57 530D 534C 4F59"            /* SLOVESLOWSSLOY */	$"440D 534C 5542 420D 534C 5542 530D 534C"            /* DSLUBBSLUBSSL */	$"5545 440D 534C 5545 530D 534C 5546 460D"            /* UEDSLUESSLUFF */	$"534C 5547 530D 534C 5549 540D 534C 554D"            /* SLUGSSLUITSLUM */	$"530D 534C 5552 420D 534C 5552 530D 534C"            /* SSLURBSLURSSL */	$"5553 450D 534C 5554 530D 534C 5945 520D"            /* USESLUTSSLYER */	$"534C 5950 450D 534D 4141 4B0D 534D 4149"            /* SLYPESMAAKSMAI */	$"4B0D 534D 414C 4D0D 534D 414C 540D 534D"            /* KSMALMSMALTSM */	$"4152 4D0D 534D 415A 450D 534D 4545 4B0D"            /* ARMSMAZESMEEK */	$"534D 4545 530D 534D 4549 4B0D 534D 454B"            /* SMEESSMEIKSMEK */	$"450D 534D 4552 4B0D 534D 4557 530D 534D"            /* ESMERKSMEWSSM */	$"4952 520D 534D 4952 530D 534D 4954 530D"            /* IRRSMIRSSMITS */	$"534D 4F47 530D 534D 4F4B 4F0D 534D 4F4C"            /* SMOGSSMOKOSMOL */	$"540D 534D 4F4F 520D 534D 4F4F 540D 534D"            /* TSMOORSMOOTSM */	$"4F52 450D 534D 4F52 470D 534D 4F55 540D"            /* ORESMORGSMOUT */	$"534D 4F57 540D 534D 5547 530D 534D 5552"            /* SMOWTSMUGSSMUR */	$"530D 534D 5553 480D 534D 5554 530D 534E"            /* SSMUSHSMUTSSN */	$"4142 530D 534E 4146 550D 534E 4147 530D"            /* ABSSNAFUSNAGS */	$"534E 4150 530D 534E 4152 460D 534E 4152"            /* SNAPSSNARFSNAR */	$"4B0D 534E 4152 530D 534E 4152 590D 534E"            /* KSNARSSNARYSN */	$"4153 480D 534E 4154 480D 534E 4157 530D"            /* ASHSNATHSNAWS */	$"534E 4541 440D 534E 4541 500D 534E 4542"            /* SNEADSNEAPSNEB */	$"530D 534E 4543 4B0D 534E 4544 530D 534E"            /* SSNECKSNEDSSN */	$"4545 440D 534E 4545 530D 534E 454C 4C0D"            /* EEDSNEESSNELL */	$"534E 4942 530D 534E 4943 4B0D 534E 4945"            /* SNIBSSNICKSNIE */	$"530D 534E 4946 540D 534E 4947 530D 534E"            /* SSNIFTSNIGSSN */	$"4950 530D 534E 4950 590D 534E 4952 540D"            /* IPSSNIPYSNIRT */	$"534E 4954 530D 534E 4F42 530D 534E 4F44"            /* SNITSSNOBSSNOD */	$"530D 534E 4F45 4B0D 534E 4F45 500D 534E"            /* SSNOEKSNOEPSN */	$"4F47 530D 534E 4F4B 450D 534E 4F4F 440D"            /* OGSSNOKESNOOD */	$"534E 4F4F 4B0D 534E 4F4F 4C0D 534E 4F4F"            /* SNOOKSNOOLSNOO */	$"540D 534E 4F54 530D 534E 4F57 4B0D 534E"            /* TSNOTSSNOWKSN */	$"4F57 530D 534E 5542 530D 534E 5547 530D"            /* OWSSNUBSSNUGS */	$"534E 5553 480D 534E 5945 530D 534F 414B"            /* SNUSHSNYESSOAK */	$"530D 534F 4150 530D 534F 4152 450D 534F"            /* SSOAPSSOARESO */	$"4152 530D 534F 4156 450D 534F 4241 530D"            /* ARSSOAVESOBAS */	$"534F 4341 530D 534F 4345 530D 534F 434B"            /* SOCASSOCESSOCK */	$"4F0D 534F 434B 530D 534F 434C 450D 534F"            /* OSOCKSSOCLESO */	$"4441 530D 534F 4444 590D 534F 4449 430D"            /* DASSODDYSODIC */	$"534F 444F 4D0D 534F 4641 520D 534F 4641"            /* SODOMSOFARSOFA */	$"530D 534F 4654 410D 534F 4654 530D 534F"            /* SSOFTASOFTSSO */	$"4654 590D 534F 4745 520D 534F 4855 520D"            /* FTYSOGERSOHUR */	$"534F 494C 530D 534F 494C 590D 534F 4A41"            /* SOILSSOILYSOJA */	$"530D 534F 4A55 530D 534F 4B41 480D 534F"            /* SSOJUSSOKAHSO */	$"4B45 4E0D 534F 4B45 530D 534F 4B4F 4C0D"            /* KENSOKESSOKOL */	$"534F 4C41 480D 534F 4C41 4E0D 534F 4C41"            /* SOLAHSOLANSOLA */	$"530D 534F 4C44 450D 534F 4C44 490D 534F"            /* SSOLDESOLDISO */	$"4C44 4F0D 534F 4C44 530D 534F 4C45 440D"            /* LDOSOLDSSOLED */	$"534F 4C45 490D 534F 4C45 520D 534F 4C45"            /* SOLEISOLERSOLE */	$"530D 534F 4C4F 4E0D 534F 4C4F 530D 534F"            /* SSOLONSOLOSSO */	$"4C55 4D0D 534F 4C55 530D 534F 4D41 4E0D"            /* LUMSOLUSSOMAN */	$"534F 4D41 530D 534F 4E43 450D 534F 4E44"            /* SOMASSONCESOND */	$"450D 534F 4E45 530D 534F 4E47 530D 534F"            /* ESONESSONGSSO */	$"4E4C 590D 534F 4E4E 450D 534F 4E4E 590D"            /* NLYSONNESONNY */	$"534F 4E53 450D 534F 4E53 590D 534F 4F45"            /* SONSESONSYSOOE */	$"590D 534F 4F4B 530D 534F 4F4B 590D 534F"            /* YSOOKSSOOKYSO */	$"4F4C 450D 534F 4F4C 530D 534F 4F4D 530D"            /* OLESOOLSSOOMS */	$"534F 4F50 530D 534F 4F54 450D 534F 4F54"            /* SOOPSSOOTESOOT */	$"530D 534F 5048 530D 534F 5048 590D 534F"            /* SSOPHSSOPHYSO */	$"504F 520D 534F 5050 590D 534F 5052 410D"            /* PORSOPPYSOPRA */	$"534F 5241 4C0D 534F 5241 530D 534F 5242"            /* SORALSORASSORB */	$"4F0D 534F 5242 530D 534F 5244 410D 534F"            /* OSORBSSORDASO */	$"5244 4F0D 534F 5244 530D 534F 5245 440D"            /* RDOSORDSSORED */	$"534F 5245 450D 534F 5245 4C0D 534F 5245"            /* SOREESORELSORE */	$"520D 534F 5245 530D 534F 5245 580D 534F"            /* RSORESSOREXSO */	$"5247 4F0D 534F 524E 530D 534F 5252 410D"            /* RGOSORNSSORRA */	$"534F 5254 410D 534F 5254 530D 534F 5255"            /* SORTASORTSSORU */	$"530D 534F 5448 530D 534F 544F 4C0D 534F"            /* SSOTHSSOTOLSO */	$"5543 450D 534F 5543 540D 534F 5547 480D"            /* UCESOUCTSOUGH */	$"534F 554B 530D 534F 554C 530D 534F 554D"            /* SOUKSSOULSSOUM */	$"530D 534F 5550 530D 534F 5550 590D 534F"            /* SSOUPSSOUPYSO */	$"5552 530D 534F 5553 450D 534F 5554 530D"            /* URSSOUSESOUTS */	$"534F 5741 520D 534F 5743 450D 534F 5745"            /* SOWARSOWCESOWE */	$"440D 534F 5746 460D 534F 5746 530D 534F"            /* DSOWFFSOWFSSO */	$"574C 450D 534F 574C 530D 534F 574D 530D"            /* WLESOWLSSOWMS */	$"534F 574E 440D 534F 574E 450D 534F 5750"            /* SOWNDSOWNESOWP */	$"530D 534F 5753 450D 534F 5754 480D 534F"            /* SSOWSESOWTHSO */	$"5941 530D 534F 594C 450D 534F 5955 5A0D"            /* YASSOYLESOYUZ */	$"534F 5A49 4E0D 5350 4143 590D 5350 4144"            /* SOZINSPACYSPAD */	$"4F0D 5350 4145 440D 5350 4145 520D 5350"            /* OSPAEDSPAERSP */	$"4145 530D 5350 4147 530D 5350 4148 490D"            /* AESSPAGSSPAHI */	$"5350 4149 4C0D 5350 4149 4E0D 5350 4149"            /* SPAILSPAINSPAI */	$"540D 5350 414B 450D 5350 414C 440D 5350"            /* TSPAKESPALDSP */	$"414C 450D 5350 414C 4C0D 5350 414C 540D"            /* ALESPALLSPALT */	$"5350 414D 530D 5350 414E 450D 5350 414E"            /* SPAMSSPANESPAN */	$"470D 5350 414E 530D 5350 4152 440D 5350"            /* GSPANSSPARDSP */	$"4152 530D 5350 4152 540D 5350 4154 450D"            /* ARSSPARTSPATE */	$"5350 4154 530D 5350 4155 4C0D 5350 4157"            /* SPATSSPAULSPAW */	$"4C0D 5350 4157 530D 5350 4159 440D 5350"            /* LSPAWSSPAYDSP */	$"4159 530D 5350 415A 410D 5350 415A 5A0D"            /* AYSSPAZASPAZZ */	$"5350 4541 4C0D 5350 4541 4E0D 5350 4541"            /* SPEALSPEANSPEA */	$"540D 5350 4543 530D 5350 4543 540D 5350"            /* TSPECSSPECTSP */	$"4545 4C0D 5350 4545 520D 5350 4549 4C0D"            /* EELSPEERSPEIL */	$"5350 4549 520D 5350 454B 530D 5350 454C"            /* SPEIRSPEKSSPEL */	$"440D 5350 454C 4B0D 5350 454F 530D 5350"            /* DSPELKSPEOSSP */	$"4554 530D 5350 4555 470D 5350 4557 530D"            /* ETSSPEUGSPEWS */	$"5350 4557 590D 5350 4941 4C0D 5350 4943"            /* SPEWYSPIALSPIC */	$"410D 5350 4943 4B0D 5350 4943 530D 5350"            /* ASPICKSPICSSP */	$"4944 450D 5350 4945 520D 5350 4945 530D"            /* IDESPIERSPIES */	$"5350 4946 460D 5350 4946 530D 5350 494B"            /* SPIFFSPIFSSPIK */	$"530D 5350 494C 450D 5350 494D 530D 5350"            /* SSPILESPIMSSP */	$"494E 410D 5350 494E 4B0D 5350 494E 530D"            /* INASPINKSPINS */	$"5350 4952 540D 5350 4952 590D 5350 4954"            /* SPIRTSPIRYSPIT */	$"530D 5350 4954 5A0D 5350 4956 530D 5350"            /* SSPITZSPIVSSP */	$"4C41 590D 5350 4C4F 470D 5350 4F44 450D"            /* LAYSPLOGSPODE */	$"5350 4F44 530D 5350 4F4F 4D0D 5350 4F4F"            /* SPODSSPOOMSPOO */	$"520D 5350 4F4F 540D 5350 4F52 4B0D 5350"            /* RSPOOTSPORKSP */	$"4F53 480D 5350 4F54 530D 5350 5241 440D"            /* OSHSPOTSSPRAD */	$"5350 5241 470D 5350 5241 540D 5350 5245"            /* SPRAGSPRATSPRE */	$"440D 5350 5245 570D 5350 5249 540D 5350"            /* DSPREWSPRITSP */	$"524F 440D 5350 524F 470D 5350 5255 450D"            /* RODSPROGSPRUE */	$"5350 5255 470D 5350 5544 530D 5350 5545"            /* SPRUGSPUDSSPUE */	$"440D 5350 5545 520D 5350 5545 530D 5350"            /* DSPUERSPUESSP */	$"5547 530D 5350 554C 450D 5350 554D 450D"            /* UGSSPULESPUME */	$"5350 554D 590D 5350 5552 530D 5350 5554"            /* SPUMYSPURSSPUT */	$"410D 5350 5941 4C0D 5350 5952 450D 5351"            /* ASPYALSPYRESQ */	$"5541 420D 5351 5541 570D 5351 5545 470D"            /* UABSQUAWSQUEG */	$"5351 5549 440D 5351 5549 540D 5351 5549"            /* SQUIDSQUITSQUI */	$"5A0D 5354 4142 530D 5354 4144 450D 5354"            /* ZSTABSSTADEST */	$"4147 530D 5354 4147 590D 5354 4149 470D"            /* AGSSTAGYSTAIG */	$"5354 414E 450D 5354 414E 470D 5354 4150"            /* STANESTANGSTAP */	$"480D 5354 4150 530D 5354 4152 4E0D 5354"            /* HSTAPSSTARNST */	$"4152 520D 5354 4152 530D 5354 4154 530D"            /* ARRSTARSSTATS */	$"5354 4155 4E0D 5354 4157 530D 5354 4159"            /* STAUNSTAWSSTAY */	$"530D 5354 4541 4E0D 5354 4541 520D 5354"            /* SSTEANSTEARST */	$"4544 440D 5354 4544 450D 5354 4544 530D"            /* EDDSTEDESTEDS */	$"5354 4545 4B0D 5354 4545 4D0D 5354 4545"            /* STEEKSTEEMSTEE */	$"4E0D 5354 4549 4C0D 5354 454C 410D 5354"            /* NSTEILSTELAST */	$"454C 450D 5354 454C 4C0D 5354 454D 450D"            /* ELESTELLSTEME */	$"5354 454D 530D 5354 454E 440D 5354 454E"            /* STEMSSTENDSTEN */	$"4F0D 5354 454E 530D 5354 454E 540D 5354"            /* OSTENSSTENTST */	$"4550 530D 5354 4550 540D 5354 4552 450D"            /* EPSSTEPTSTERE */	$"5354 4554 530D 5354 4557 530D 5354 4557"            /* STETSSTEWSSTEW */	$"590D 5354 4559 530D 5354 4943 480D 5354"            /* YSTEYSSTICHST */	$"4945 440D 5354 4945 530D 5354 494C 420D"            /* IEDSTIESSTILB */	$"5354 494C 450D 5354 494D 450D 5354 494D"            /* STILESTIMESTIM */	$"530D 5354 494D 590D 5354 4950 410D 5354"            /* SSTIMYSTIPAST */	$"4950 450D 5354 4952 450D 5354 4952 4B0D"            /* IPESTIRESTIRK */	$"5354 4952 500D 5354 4952 530D 5354 4956"            /* STIRPSTIRSSTIV */	$"450D 5354 4956 590D 5354 4F41 450D 5354"            /* ESTIVYSTOAEST */	$"4F41 490D 5354 4F41 530D 5354 4F41 540D"            /* OAISTOASSTOAT */	$"5354 4F42 530D 5354 4F45 500D 5354 4F47"            /* STOBSSTOEPSTOG */	$"590D 5354 4F49 540D 5354 4F4C 4E0D 5354"            /* YSTOITSTOLNST */	$"4F4D 410D 5354 4F4E 440D 5354 4F4E 470D"            /* OMASTONDSTONG */	$"5354 4F4E 4B0D 5354 4F4E 4E0D 5354 4F4F"            /* STONKSTONNSTOO */	$"4B0D 5354 4F4F 520D 5354 4F50 450D 5354"            /* KSTOORSTOPEST */	$"4F50 530D 5354 4F50 540D 5354 4F53 530D"            /* OPSSTOPTSTOSS */	$"5354 4F54 530D 5354 4F54 540D 5354 4F55"            /* STOTSSTOTTSTOU */	$"4E0D 5354 4F55 500D 5354 4F55 520D 5354"            /* NSTOUPSTOURST */	$"4F57 4E0D 5354 4F57 500D 5354 4F57 530D"            /* OWNSTOWPSTOWS */	$"5354 5241 440D 5354 5241 450D 5354 5241"            /* STRADSTRAESTRA */	$"470D 5354 5241 4B0D 5354 5245 500D 5354"            /* GSTRAKSTREPST */	$"5245 570D 5354 5249 410D 5354 5249 470D"            /* REWSTRIASTRIG */	$"5354 5249 4D0D 5354 524F 500D 5354 524F"            /* STRIMSTROPSTRO */	$"570D 5354 524F 590D 5354 5255 4D0D 5354"            /* WSTROYSTRUMST */	$"5542 530D 5354 5544 450D 5354 5544 530D"            /* UBSSTUDESTUDS */	$"5354 554C 4C0D 5354 554C 4D0D 5354 554D"            /* STULLSTULMSTUM */	$"4D0D 5354 554D 530D 5354 554E 530D 5354"            /* MSTUMSSTUNSST */	$"5550 410D 5354 5550 450D 5354 5552 450D"            /* UPASTUPESTURE */	$"5354 5552 540D 5354 5945 440D 5354 5945"            /* STURTSTYEDSTYE */	$"530D 5354 594C 490D 5354 594C 4F0D 5354"            /* SSTYLISTYLOST */	$"594D 450D 5354 594D 590D 5354 5952 450D"            /* YMESTYMYSTYRE */	$"5354 5954 450D 5355 4241 480D 5355 4241"            /* STYTESUBAHSUBA */	$"530D 5355 4242 590D 5355 4245 520D 5355"            /* SSUBBYSUBERSU */	$"4248 410D 5355 4343 490D 5355 434B 530D"            /* BHASUCCISUCKS */	$"5355 434B 590D 5355 4352 450D 5355 4444"            /* SUCKYSUCRESUDD */	$"530D 5355 444F 520D 5355 4453 590D 5355"            /* SSUDORSUDSYSU */	$"4544 450D 5355 454E 540D 5355 4552 530D"            /* EDESUENTSUERS */	$"5355 4554 450D 5355 4554 530D 5355 4554"            /* SUETESUETSSUET */	$"590D 5355 4741 4E0D 5355 4748 530D 5355"            /* YSUGANSUGHSSU */	$"474F 530D 5355 4855 520D 5355 4944 530D"            /* GOSSUHURSUIDS */	$"5355 494E 540D 5355 4954 530D 5355 4A45"            /* SUINTSUITSSUJE */	$"450D 5355 4B48 530D 5355 4B55 4B0D 5355"            /* ESUKHSSUKUKSU */	$"4C43 490D 5355 4C46 410D 5355 4C46 4F0D"            /* LCISULFASULFO */	$"5355 4C4B 530D 5355 4C50 480D 5355 4C55"            /* SULKSSULPHSULU */	$"530D 5355 4D49 530D 5355 4D4D 410D 5355"            /* SSUMISSUMMASU */	$"4D4F 530D 5355 4D50 480D 5355 4D50 530D"            /* MOSSUMPHSUMPS */	$"5355 4E49 530D 5355 4E4B 530D 5355 4E4E"            /* SUNISSUNKSSUNN */	$"410D 5355 4E4E 530D 5355 4E55 500D 5355"            /* ASUNNSSUNUPSU */	$"5045 530D 5355 5052 410D 5355 5241 480D"            /* PESSUPRASURAH */	$"5355 5241 4C0D 5355 5241 530D 5355 5241"            /* SURALSURASSURA */	$"540D 5355 5244 530D 5355 5245 440D 5355"            /* TSURDSSUREDSU */	$"5245 530D 5355 5246 530D 5355 5246 590D"            /* RESSURFSSURFY */	$"5355 5247 590D 5355 5252 410D 5355 5345"            /* SURGYSURRASUSE */	$"440D 5355 5345 530D 5355 5355 530D 5355"            /* DSUSESSUSUSSU */	$"544F 520D 5355 5452 410D 5355 5454 410D"            /* TORSUTRASUTTA */	$"5357 4142 530D 5357 4143 4B0D 5357 4144"            /* SWABSSWACKSWAD */	$"530D 5357 4147 450D 5357 4147 530D 5357"            /* SSWAGESWAGSSW */	$"4149 4C0D 5357 4149 4E0D 5357 414C 450D"            /* AILSWAINSWALE */	$"5357 414C 590D 5357 414D 590D 5357 414E"            /* SWALYSWAMYSWAN */	$"470D 5357 414E 4B0D 5357 414E 530D 5357"            /* GSWANKSWANSSW */	$"4150 530D 5357 4150 540D 5357 4152 440D"            /* APSSWAPTSWARD */	$"5357 4152 450D 5357 4152 460D 5357 4152"            /* SWARESWARFSWAR */	$"540D 5357 4154 530D 5357 4159 4C0D 5357"            /* TSWATSSWAYLSW */	$"4159 530D 5357 4541 4C0D 5357 4544 450D"            /* AYSSWEALSWEDE */	$"5357 4545 440D 5357 4545 4C0D 5357 4545"            /* SWEEDSWEELSWEE */	$"520D 5357 4545 530D 5357 4549 520D 5357"            /* RSWEESSWEIRSW */	$"454C 540D 5357 4552 460D 5357 4559 530D"            /* ELTSWERFSWEYS */	$"5357 4945 530D 5357 4947 530D 5357 494C"            /* SWIESSWIGSSWIL */	$"450D 5357 494D 530D 5357 494E 4B0D 5357"            /* ESWIMSSWINKSW */	$"4950 450D 5357 4952 450D 5357 4953 530D"            /* IPESWIRESWISS */	$"5357 4954 480D 5357 4954 530D 5357 4956"            /* SWITHSWITSSWIV */	$"450D 5357 495A 5A0D 5357 4F42 530D 5357"            /* ESWIZZSWOBSSW */	$"4F4C 450D 5357 4F4C 4E0D 5357 4F50 530D"            /* OLESWOLNSWOPS */	$"5357 4F50 540D 5357 4F54 530D 5357 4F55"            /* SWOPTSWOTSSWOU */	$"4E0D 5359 4242 450D 5359 4249 4C0D 5359"            /* NSYBBESYBILSY */	$"424F 450D 5359 424F 570D 5359 4345 450D"            /* BOESYBOWSYCEE */	$"5359 4345 530D 5359 434F 4E0D 5359 454E"            /* SYCESSYCONSYEN */	$"530D 5359 4B45 520D 5359 4B45 530D 5359"            /* SSYKERSYKESSY */	$"4C49 530D 5359 4C50 480D 5359 4C56 410D"            /* LISSYLPHSYLVA */	$"5359 4D41 520D 5359 4E43 480D 5359 4E43"            /* SYMARSYNCHSYNC */	$"530D 5359 4E44 530D 5359 4E45 440D 5359"            /* SSYNDSSYNEDSY */	$"4E45 530D 5359 4E54 480D 5359 5045 440D"            /* NESSYNTHSYPED */	$"5359 5045 530D 5359 5048 530D 5359 5241"            /* SYPESSYPHSSYRA */	$"480D 5359 5245 4E0D 5359 534F 500D 5359"            /* HSYRENSYSOPSY */	$"5448 450D 5359 5645 520D 5441 414C 530D"            /* THESYVERTAALS */	$"5441 4154 410D 5441 4245 520D 5441 4245"            /* TAATATABERTABE */	$"530D 5441 4249 440D 5441 4249 530D 5441"            /* STABIDTABISTA */	$"424C 410D 5441 424F 520D 5441 4255 4E0D"            /* BLATABORTABUN */	$"5441 4255 530D 5441 4341 4E0D 5441 4345"            /* TABUSTACANTACE */	$"530D 5441 4345 540D 5441 4348 450D 5441"            /* STACETTACHETA */	$"4348 4F0D 5441 4348 530D 5441 434B 530D"            /* CHOTACHSTACKS */	$"5441 434F 530D 5441 4354 530D 5441 454C"            /* TACOSTACTSTAEL */	$"530D 5441 4649 410D 5441 4747 590D 5441"            /* STAFIATAGGYTA */	$"474D 410D 5441 4841 530D 5441 4852 530D"            /* GMATAHASTAHRS */	$"5441 4947 410D 5441 4947 530D 5441 494B"            /* TAIGATAIGSTAIK */	$"4F0D 5441 494C 530D 5441 494E 530D 5441"            /* OTAILSTAINSTA */	$"4952 410D 5441 4953 480D 5441 4954 530D"            /* IRATAISHTAITS */	$"5441 4A45 530D 5441 4B41 530D 5441 4B45"            /* TAJESTAKASTAKE */	$"530D 5441 4B48 490D 5441 4B49 4E0D 5441"            /* STAKHITAKINTA */	$"4B49 530D 5441 4B4B 590D 5441 4C41 4B0D"            /* KISTAKKYTALAK */	$"5441 4C41 510D 5441 4C41 520D 5441 4C41"            /* TALAQTALARTALA */	$"530D 5441 4C43 530D 5441 4C43 590D 5441"            /* STALCSTALCYTA */	$"4C45 410D 5441 4C45 520D 5441 4C45 530D"            /* LEATALERTALES */	$"5441 4C4B 530D 5441 4C4B 590D 5441 4C4C"            /* TALKSTALKYTALL */	$"530D 5441 4C4D 410D 5441 4C50 410D 5441"            /* STALMATALPATA */	$"4C55 4B0D 5441 4C55 530D 5441 4D41 4C0D"            /* LUKTALUSTAMAL */	$"5441 4D45 440D 5441 4D45 530D 5441 4D49"            /* TAMEDTAMESTAMI */	$"4E0D 5441 4D49 530D 5441 4D4D 590D 5441"            /* NTAMISTAMMYTA */	$"4D50 530D 5441 4E41 530D 5441 4E47 410D"            /* MPSTANASTANGA */	$"5441 4E47 490D 5441 4E47 530D 5441 4E48"            /* TANGITANGSTANH */	$"530D 5441 4E4B 410D 5441 4E4B 530D 5441"            /* STANKATANKSTA */	$"4E4B 590D 5441 4E4E 410D 5441 4E53 590D"            /* NKYTANNATANSY */	$"5441 4E54 490D 5441 4E54 4F0D 5441 4E54"            /* TANTITANTOTANT */	$"590D 5441 5041 530D 5441 5045 440D 5441"            /* YTAPASTAPEDTA */	$"5045 4E0D 5441 5045 530D 5441 5045 540D"            /* PENTAPESTAPET */	$"5441 5049 530D 5441 5050 410D 5441 5055"            /* TAPISTAPPATAPU */	$"530D 5441 5241 530D 5441 5244 4F0D 5441"            /* STARASTARDOTA */	$"5245 440D 5441 5245 530D 5441 5247 410D"            /* REDTARESTARGA */	$"5441 5247 450D 5441 524E 530D 5441 524F"            /* TARGETARNSTARO */	$"430D 5441 524F 4B0D 5441 524F 530D 5441"            /* CTAROKTAROSTA */	$"5250 530D 5441 5252 450D 5441 5252 590D"            /* RPSTARRETARRY */	$"5441 5253 490D 5441 5254 530D 5441 5254"            /* TARSITARTSTART */	$"590D 5441 5341 520D 5441 5345 440D 5441"            /* YTASARTASEDTA */	$"5345 520D 5441 5345 530D 5441 534B 530D"            /* SERTASESTASKS */	$"5441 5353 410D 5441 5353 450D 5441 5353"            /* TASSATASSETASS */	$"4F0D 5441 5441 520D 5441 5445 520D 5441"            /* OTATARTATERTA */	$"5445 530D 5441 5448 530D 5441 5449 450D"            /* TESTATHSTATIE */	$"5441 544F 550D 5441 5454 530D 5441 5455"            /* TATOUTATTSTATU */	$"530D 5441 5542 450D 5441 554C 440D 5441"            /* STAUBETAULDTA */	$"554F 4E0D 5441 5550 450D 5441 5554 530D"            /* UONTAUPETAUTS */	$"5441 5641 480D 5441 5641 530D 5441 5645"            /* TAVAHTAVASTAVE */	$"520D 5441 5741 490D 5441 5741 530D 5441"            /* RTAWAITAWASTA */	$"5745 440D 5441 5745 520D 5441 5749 450D"            /* WEDTAWERTAWIE */	$"5441 5753 450D 5441 5754 530D 5441 5845"            /* TAWSETAWTSTAXE */	$"440D 5441 5845 520D 5441 5845 530D 5441"            /* DTAXERTAXESTA */	$"5849 530D 5441 584F 4C0D 5441 584F 4E0D"            /* XISTAXOLTAXON */	$"5441 584F 520D 5441 5855 530D 5441 5952"            /* TAXORTAXUSTAYR */	$"410D 5441 5A5A 410D 5441 5A5A 450D 5445"            /* ATAZZATAZZETE */	$"4144 450D 5445 4144 530D 5445 4145 440D"            /* ADETEADSTEAED */	$"5445 414B 530D 5445 414C 530D 5445 414D"            /* TEAKSTEALSTEAM */	$"530D 5445 4152 530D 5445 4154 530D 5445"            /* STEARSTEATSTE */	$"415A 450D 5445 4348 530D 5445 4348 590D"            /* AZETECHSTECHY */	$"5445 4354 410D 5445 454C 530D 5445 454D"            /* TECTATEELSTEEM */	$"530D 5445 454E 440D 5445 454E 450D 5445"            /* STEENDTEENETE */	$"454E 530D 5445 454E 590D 5445 4552 530D"            /* ENSTEENYTEERS */	$"5445 4646 530D 5445 4747 530D 5445 4755"            /* TEFFSTEGGSTEGU */	$"410D 5445 4755 530D 5445 4852 530D 5445"            /* ATEGUSTEHRSTE */	$"4949 440D 5445 494C 530D 5445 494E 440D"            /* IIDTEILSTEIND */	$"5445 494E 530D 5445 4C41 450D 5445 4C43"            /* TEINSTELAETELC */	$"4F0D 5445 4C45 530D 5445 4C45 580D 5445"            /* OTELESTELEXTE */	$"4C49 410D 5445 4C49 430D 5445 4C4C 530D"            /* LIATELICTELLS */	$"5445 4C4C 590D 5445 4C4F 490D 5445 4C4F"            /* TELLYTELOITELO */	$"530D 5445 4D45 440D 5445 4D45 530D 5445"            /* STEMEDTEMESTE */	$"4D50 490D 5445 4D50 530D 5445 4D50 540D"            /* MPITEMPSTEMPT */	$"5445 4D53 450D 5445 4E43 480D 5445 4E44"            /* TEMSETENCHTEND */	$"530D 5445 4E44 550D 5445 4E45 530D 5445"            /* STENDUTENESTE */	$"4E47 450D 5445 4E49 410D 5445 4E4E 450D"            /* NGETENIATENNE */	$"5445 4E4E 4F0D 5445 4E4E 590D 5445 4E4F"            /* TENNOTENNYTENO */	$"4E0D 5445 4E54 530D 5445 4E54 590D 5445"            /* NTENTSTENTYTE */	$"4E55 450D 5445 5041 4C0D 5445 5041 530D"            /* NUETEPALTEPAS */	$"5445 504F 590D 5445 5241 490D 5445 5241"            /* TEPOYTERAITERA */	$"530D 5445 5243 450D 5445 5245 4B0D 5445"            /* STERCETEREKTE */	$"5245 530D 5445 5246 450D 5445 5246 530D"            /* RESTERFETERFS */	$"5445 5247 410D 5445 524D 530D 5445 524E"            /* TERGATERMSTERN */	$"450D 5445 524E 530D 5445 5252 590D 5445"            /* ETERNSTERRYTE */	$"5254 530D 5445 534C 410D 5445 5354 410D"            /* RTSTESLATESTA */	$"5445 5354 450D 5445 5354 530D 5445 5445"            /* TESTETESTSTETE */	$"530D 5445 5448 530D 5445 5452 410D 5445"            /* STETHSTETRATE */	$"5452 490D 5445 5543 480D 5445 5547 480D"            /* TRITEUCHTEUGH */	$"5445 5745 440D 5445 5745 4C0D 5445 5749"            /* TEWEDTEWELTEWI */	$"540D 5445 5841 530D 5445 5845 530D 5445"            /* TTEXASTEXESTE */	$"5854 530D 5448 4143 4B0D 5448 4147 490D"            /* XTSTHACKTHAGI */	$"5448 4149 4D0D 5448 414C 450D 5448 414C"            /* THAIMTHALETHAL */	$"490D 5448 414E 410D 5448 414E 450D 5448"            /* ITHANATHANETH */	$"414E 470D 5448 414E 530D 5448 414E 580D"            /* ANGTHANSTHANX */	$"5448 4152 4D0D 5448 4152 530D 5448 4157"            /* THARMTHARSTHAW */	$"530D 5448 4157 590D 5448 4542 450D 5448"            /* STHAWYTHEBETH */	$"4543 410D 5448 4545 440D 5448 4545 4B0D"            /* ECATHEEDTHEEK */	$"5448 4545 530D 5448 4547 4E0D 5448 4549"            /* THEESTHEGNTHEI */	$"430D 5448 4549 4E0D 5448 454C 460D 5448"            /* CTHEINTHELFTH */	$"454D 410D 5448 454E 530D 5448 454F 570D"            /* EMATHENSTHEOW */	$"5448 4552 4D0D 5448 4553 500D 5448 4554"            /* THERMTHESPTHET */	$"450D 5448 4557 530D 5448 4557 590D 5448"            /* ETHEWSTHEWYTH */	$"4947 530D 5448 494C 4B0D 5448 494C 4C0D"            /* IGSTHILKTHILL */	$"5448 494E 450D 5448 494E 530D 5448 494F"            /* THINETHINSTHIO */	$"4C0D 5448 4952 4C0D 5448 4F46 540D 5448"            /* LTHIRLTHOFTTH */	$"4F4C 450D 5448 4F4C 490D 5448 4F52 4F0D"            /* OLETHOLITHORO */	$"5448 4F52 500D 5448 4F55 530D 5448 4F57"            /* THORPTHOUSTHOW */	$"4C0D 5448 5241 450D 5448 5241 570D 5448"            /* LTHRAETHRAWTH */	$"5249 440D 5448 5249 500D 5448 524F 450D"            /* RIDTHRIPTHROE */	$"5448 5544 530D 5448 5547 530D 5448 554A"            /* THUDSTHUGSTHUJ */	$"410D 5448 554E 4B0D 5448 5552 4C0D 5448"            /* ATHUNKTHURLTH */	$"5559 410D 5448 594D 490D 5448 594D 590D"            /* UYATHYMITHYMY */	$"5449 414E 530D 5449 4152 530D 5449 4341"            /* TIANSTIARSTICA */	$"4C0D 5449 4343 410D 5449 4345 440D 5449"            /* LTICCATICEDTI */	$"4345 530D 5449 4348 590D 5449 434B 530D"            /* CESTICHYTICKS */	$"5449 434B 590D 5449 4444 590D 5449 4445"            /* TICKYTIDDYTIDE */	$"440D 5449 4445 530D 5449 4552 530D 5449"            /* DTIDESTIERSTI */	$"4646 530D 5449 464F 530D 5449 4654 530D"            /* FFSTIFOSTIFTS */	$"5449 4745 530D 5449 474F 4E0D 5449 4B41"            /* TIGESTIGONTIKA */	$"530D 5449 4B45 530D 5449 4B49 530D 5449"            /* STIKESTIKISTI */	$"4B4B 410D 5449 4C41 4B0D 5449 4C45 440D"            /* KKATILAKTILED */	$"5449 4C45 520D 5449 4C45 530D 5449 4C4C"            /* TILERTILESTILL */	$"530D 5449 4C4C 590D 5449 4C54 480D 5449"            /* STILLYTILTHTI */	$"4C54 530D 5449 4D42 4F0D 5449 4D45 440D"            /* LTSTIMBOTIMED */	$"5449 4D45 530D 5449 4D4F 4E0D 5449 4D50"            /* TIMESTIMONTIMP */	$"530D 5449 4E41 530D 5449 4E43 540D 5449"            /* STINASTINCTTI */	$"4E44 530D 5449 4E45 410D 5449 4E45 440D"            /* NDSTINEATINED */	$"5449 4E45 530D 5449 4E47 450D 5449 4E47"            /* TINESTINGETING */	$"530D 5449 4E4B 530D 5449 4E4E 590D 5449"            /* STINKSTINNYTI */	$"4E54 530D 5449 4E54 590D 5449 5049 530D"            /* NTSTINTYTIPIS */	$"5449 5050 590D 5449 5245 440D 5449 5245"            /* TIPPYTIREDTIRE */	$"530D 5449 524C 530D 5449 524F 530D 5449"            /* STIRLSTIROSTI */	$"5252 530D 5449 5443 480D 5449 5445 520D"            /* RRSTITCHTITER */	$"5449 5449 530D 5449 5452 450D 5449 5454"            /* TITISTITRETITT */	$"590D 5449 5455 500D 5449 5949 4E0D 5449"            /* YTITUPTIYINTI */	$"594E 530D 5449 5A45 530D 5449 5A5A 590D"            /* YNSTIZESTIZZY */	$"544F 4144 530D 544F 4144 590D 544F 415A"            /* TOADSTOADYTOAZ */	$"450D 544F 434B 530D 544F 434B 590D 544F"            /* ETOCKSTOCKYTO */	$"434F 530D 544F 4444 450D 544F 4541 530D"            /* COSTODDETOEAS */	$"544F 4646 530D 544F 4646 590D 544F 4654"            /* TOFFSTOFFYTOFT */	$"530D 544F 4655 530D 544F 4741 450D 544F"            /* STOFUSTOGAETO */	$"4741 530D 544F 4745 440D 544F 4745 530D"            /* GASTOGEDTOGES */	$"544F 4755 450D 544F 484F 530D 544F 494C"            /* TOGUETOHOSTOIL */	$"450D 544F 494C 530D 544F 494E 470D 544F"            /* ETOILSTOINGTO */	$"4953 450D 544F 4954 530D 544F 4B41 590D"            /* ISETOITSTOKAY */	$"544F 4B45 440D 544F 4B45 520D 544F 4B45"            /* TOKEDTOKERTOKE */	$"530D 544F 4B4F 530D 544F 4C41 4E0D 544F"            /* STOKOSTOLANTO */	$"4C41 520D 544F 4C41 530D 544F 4C45 440D"            /* LARTOLASTOLED */	$"544F 4C45 530D 544F 4C4C 530D 544F 4C4C"            /* TOLESTOLLSTOLL */	$"590D 544F 4C54 530D 544F 4C55 530D 544F"            /* YTOLTSTOLUSTO */	$"4C59 4C0D 544F 4D41 4E0D 544F 4D42 530D"            /* LYLTOMANTOMBS */	$"544F 4D45 530D 544F 4D49 410D 544F 4D4D"            /* TOMESTOMIATOMM */	$"590D 544F 4D4F 530D 544F 4E44 490D 544F"            /* YTOMOSTONDITO */	$"4E44 4F0D 544F 4E45 440D 544F 4E45 520D"            /* NDOTONEDTONER */	$"544F 4E45 530D 544F 4E45 590D 544F 4E47"            /* TONESTONEYTONG */	$"530D 544F 4E4B 410D 544F 4E4B 530D 544F"            /* STONKATONKSTO */	$"4E4E 450D 544F 4E55 530D 544F 4F4C 530D"            /* NNETONUSTOOLS */	$"544F 4F4D 530D 544F 4F4E 530D 544F 4F54"            /* TOOMSTOONSTOOT */	$"530D 544F 5045 440D 544F 5045 450D 544F"            /* STOPEDTOPEETO */	$"5045 4B0D 544F 5045 520D 544F 5045 530D"            /* PEKTOPERTOPES */	$"544F 5048 450D 544F 5048 490D 544F 5048"            /* TOPHETOPHITOPH */	$"530D 544F 5049 530D 544F 504F 490D 544F"            /* STOPISTOPOITO */	$"504F 530D 544F 5050 590D 544F 5155 450D"            /* POSTOPPYTOQUE */	$"544F 5241 480D 544F 5241 4E0D 544F 5241"            /* TORAHTORANTORA */	$"530D 544F 5243 530D 544F 5245 530D 544F"            /* STORCSTORESTO */	$"5249 430D 544F 5249 490D 544F 524F 530D"            /* RICTORIITOROS */	$"544F 524F 540D 544F 5252 530D 544F 5253"            /* TOROTTORRSTORS */	$"450D 544F 5253 490D 544F 5253 4B0D 544F"            /* ETORSITORSKTO */	$"5254 410D 544F 5254 450D 544F 5254 530D"            /* RTATORTETORTS */	$"544F 5341 530D 544F 5345 440D 544F 5345"            /* TOSASTOSEDTOSE */	$"530D 544F 5348 590D 544F 5353 590D 544F"            /* STOSHYTOSSYTO */	$"5445 440D 544F 5445 520D 544F 5445 530D"            /* TEDTOTERTOTES */	$"544F 5454 590D 544F 554B 530D 544F 554E"            /* TOTTYTOUKSTOUN */	$"530D 544F 5552 530D 544F 5553 450D 544F"            /* STOURSTOUSETO */	$"5553 590D 544F 5554 530D 544F 555A 450D"            /* USYTOUTSTOUZE */	$"544F 555A 590D 544F 5745 440D 544F 5749"            /* TOUZYTOWEDTOWI */	$"450D 544F 574E 530D 544F 574E 590D 544F"            /* ETOWNSTOWNYTO */	$"5753 450D 544F 5753 590D 544F 5754 530D"            /* WSETOWSYTOWTS */	$"544F 575A 450D 544F 575A 590D 544F 5945"            /* TOWZETOWZYTOYE */	$"440D 544F 5945 520D 544F 594F 4E0D 544F"            /* DTOYERTOYONTO */	$"594F 530D 544F 5A45 440D 544F 5A45 530D"            /* YOSTOZEDTOZES */	$"544F 5A49 450D 5452 4142 530D 5452 4144"            /* TOZIETRABSTRAD */	$"530D 5452 4147 490D 5452 4149 4B0D 5452"            /* STRAGITRAIKTR */	$"414D 530D 5452 414E 4B0D 5452 414E 510D"            /* AMSTRANKTRANQ */	$"5452 414E 530D 5452 414E 540D 5452 4150"            /* TRANSTRANTTRAP */	$"450D 5452 4150 530D 5452 4150 540D 5452"            /* ETRAPSTRAPTTR */	$"4153 530D 5452 4154 530D 5452 4154 540D"            /* ASSTRATSTRATT */	$"5452 4156 450D 5452 4159 460D 5452 4159"            /* TRAVETRAYFTRAY */	$"530D 5452 4543 4B0D 5452 4545 440D 5452"            /* STRECKTREEDTR */	$"4545 4E0D 5452 4545 530D 5452 4546 410D"            /* EENTREESTREFA */	$"5452 4549 460D 5452 454B 530D 5452 454D"            /* TREIFTREKSTREM */	$"410D 5452 454D 530D 5452 4553 530D 5452"            /* ATREMSTRESSTR */	$"4553 540D 5452 4554 530D 5452 4557 530D"            /* ESTTRETSTREWS */	$"5452 4559 460D 5452 4559 530D 5452 4941"            /* TREYFTREYSTRIA */	$"430D 5452 4944 450D 5452 4945 520D 5452"            /* CTRIDETRIERTR */	$"4945 530D 5452 4946 460D 5452 4947 4F0D"            /* IESTRIFFTRIGO */	$"5452 4947 530D 5452 494B 450D 5452 494C"            /* TRIGSTRIKETRIL */	$"440D 5452 494C 4C0D 5452 494D 530D 5452"            /* DTRILLTRIMSTR */	$"494E 450D 5452 494E 530D 5452 494F 4C0D"            /* INETRINSTRIOL */	$"5452 494F 520D 5452 494F 530D 5452 4950"            /* TRIORTRIOSTRIP */	$"530D 5452 4950 590D 5452 4953 540D 5452"            /* STRIPYTRISTTR */	$"4F41 440D 5452 4F41 4B0D 5452 4F41 540D"            /* OADTROAKTROAT */	$"5452 4F43 4B0D 5452 4F44 450D 5452 4F44"            /* TROCKTRODETROD */	$"530D 5452 4F47 530D 5452 4F49 530D 5452"            /* STROGSTROISTR */	$"4F4B 450D 5452 4F4D 500D 5452 4F4E 410D"            /* OKETROMPTRONA */	$"5452 4F4E 430D 5452 4F4E 450D 5452 4F4E"            /* TRONCTRONETRON */	$"4B0D 5452 4F4E 530D 5452 4F4F 5A0D 5452"            /* KTRONSTROOZTR */	$"4F54 480D 5452 4F54 530D 5452 4F57 530D"            /* OTHTROTSTROWS */	$"5452 4F59 530D 5452 5545 440D 5452 5545"            /* TROYSTRUEDTRUE */	$"530D 5452 5547 4F0D 5452 5547 530D 5452"            /* STRUGOTRUGSTR */	$"554C 4C0D 5452 5945 520D 5452 594B 450D"            /* ULLTRYERTRYKE */	$"5452 594D 410D 5452 5950 530D 5453 4144"            /* TRYMATRYPSTSAD */	$"450D 5453 4144 490D 5453 4152 530D 5453"            /* ETSADITSARSTS */	$"4B45 440D 5453 5542 410D 5453 5542 4F0D"            /* KEDTSUBATSUBO */	$"5455 414E 530D 5455 4152 540D 5455 4154"            /* TUANSTUARTTUAT */	$"480D 5455 4241 450D 5455 4241 520D 5455"            /* HTUBAETUBARTU */	$"4241 530D 5455 4242 590D 5455 4245 440D"            /* BASTUBBYTUBED */	$"5455 4245 530D 5455 434B 530D 5455 4641"            /* TUBESTUCKSTUFA */	$"530D 5455 4646 450D 5455 4646 530D 5455"            /* STUFFETUFFSTU */	$"4654 530D 5455 4654 590D 5455 4752 410D"            /* FTSTUFTYTUGRA */	$"5455 494C 450D 5455 494E 410D 5455 4953"            /* TUILETUINATUIS */	$"4D0D 5455 4B54 550D 5455 4C45 530D 5455"            /* MTUKTUTULESTU */	$"4C50 410D 5455 4C53 490D 5455 4D49 440D"            /* LPATULSITUMID */	$"5455 4D4D 590D 5455 4D50 530D 5455 4D50"            /* TUMMYTUMPSTUMP */	$"590D 5455 4E41 530D 5455 4E44 530D 5455"            /* YTUNASTUNDSTU */	$"4E45 440D 5455 4E45 520D 5455 4E45 530D"            /* NEDTUNERTUNES */	$"5455 4E47 530D 5455 4E4E 590D 5455 5045"            /* TUNGSTUNNYTUPE */	$"4B0D 5455 5049 4B0D 5455 504C 450D 5455"            /* KTUPIKTUPLETU */	$"5155 450D 5455 5244 530D 5455 5246 530D"            /* QUETURDSTURFS */	$"5455 5246 590D 5455 524B 530D 5455 524D"            /* TURFYTURKSTURM */	$"450D 5455 524D 530D 5455 524E 530D 5455"            /* ETURMSTURNSTU */	$"524E 540D 5455 5250 530D 5455 5252 530D"            /* RNTTURPSTURRS */	$"5455 5348 590D 5455 534B 530D 5455 534B"            /* TUSHYTUSKSTUSK */	$"590D 5455 5445 450D 5455 5454 490D 5455"            /* YTUTEETUTTITU */	$"5454 590D 5455 5455 530D 5455 5845 530D"            /* TTYTUTUSTUXES */	$"5455 5945 520D 5457 4145 530D 5457 4149"            /* TUYERTWAESTWAI */	$"4E0D 5457 414C 530D 5457 414E 4B0D 5457"            /* NTWALSTWANKTW */	$"4154 530D 5457 4159 530D 5457 4545 4C0D"            /* ATSTWAYSTWEEL */	$"5457 4545 4E0D 5457 4545 500D 5457 4545"            /* TWEENTWEEPTWEE */	$"520D 5457 4552 4B0D 5457 4552 500D 5457"            /* RTWERKTWERPTW */	$"4945 520D 5457 4947 530D 5457 494C 4C0D"            /* IERTWIGSTWILL */	$"5457 494C 540D 5457 494E 4B0D 5457 494E"            /* TWILTTWINKTWIN */	$"530D 5457 494E 590D 5457 4952 450D 5457"            /* STWINYTWIRETW */	$"4952 500D 5457 4954 450D 5457 4954 530D"            /* IRPTWITETWITS */	$"5457 4F45 520D 5457 5945 520D 5459 4545"            /* TWOERTWYERTYEE */	$"530D 5459 4552 530D 5459 4959 4E0D 5459"            /* STYERSTYIYNTY */	$"4B45 530D 5459 4C45 520D 5459 4D50 530D"            /* KESTYLERTYMPS */	$"5459 4E44 450D 5459 4E45 440D 5459 4E45"            /* TYNDETYNEDTYNE */	$"530D 5459 5041 4C0D 5459 5045 440D 5459"            /* STYPALTYPEDTY */	$"5045 530D 5459 5045 590D 5459 5049 430D"            /* PESTYPEYTYPIC */	$"5459 504F 530D 5459 5050 530D 5459 5054"            /* TYPOSTYPPSTYPT */	$"4F0D 5459 5241 4E0D 5459 5245 440D 5459"            /* OTYRANTYREDTY */	$"5245 530D 5459 524F 530D 5459 5448 450D"            /* RESTYROSTYTHE */	$"545A 4152 530D 5544 414C 530D 5544 4F4E"            /* TZARSUDALSUDON */	$"530D 5547 414C 490D 5547 4745 440D 5548"            /* SUGALIUGGEDUH */	$"4C41 4E0D 5548 5552 550D 554B 4153 450D"            /* LANUHURUUKASE */	$"554C 414D 410D 554C 414E 530D 554C 454D"            /* ULAMAULANSULEM */	$"410D 554C 4D49 4E0D 554C 4E41 440D 554C"            /* AULMINULNADUL */	$"4E41 450D 554C 4E41 520D 554C 4E41 530D"            /* NAEULNARULNAS */	$"554C 5041 4E0D 554C 5641 530D 554C 5949"            /* ULPANULVASULYI */	$"450D 554C 5A49 450D 554D 414D 490D 554D"            /* EULZIEUMAMIUM */	$"4245 4C0D 554D 4245 520D 554D 424C 450D"            /* BELUMBERUMBLE */	$"554D 424F 530D 554D 4252 450D 554D 4941"            /* UMBOSUMBREUMIA */	$"430D 554D 4941 4B0D 554D 4941 510D 554D"            /* CUMIAKUMIAQUM */	$"4D41 480D 554D 4D41 530D 554D 4D45 440D"            /* MAHUMMASUMMED */	$"554D 5045 440D 554D 5048 530D 554D 5049"            /* UMPEDUMPHSUMPI */	$"450D 554D 5054 590D 554D 5241 480D 554D"            /* EUMPTYUMRAHUM */	$"5241 530D 554E 4149 530D 554E 4150 540D"            /* RASUNAISUNAPT */	$"554E 4152 4D0D 554E 4152 590D 554E 4155"            /* UNARMUNARYUNAU */	$"530D 554E 4241 470D 554E 4241 4E0D 554E"            /* SUNBAGUNBANUN */	$"4241 520D 554E 4245 440D 554E 4249 440D"            /* BARUNBEDUNBID */	$"554E 424F 580D 554E 4341 500D 554E 4345"            /* UNBOXUNCAPUNCE */	$"530D 554E 4349 410D 554E 434F 530D 554E"            /* SUNCIAUNCOSUN */	$"434F 590D 554E 4355 530D 554E 4441 4D0D"            /* COYUNCUSUNDAM */	$"554E 4445 450D 554E 444F 530D 554E 4455"            /* UNDEEUNDOSUNDU */	$"470D 554E 4554 480D 554E 4649 580D 554E"            /* GUNETHUNFIXUN */	$"4741 470D 554E 4745 540D 554E 474F 440D"            /* GAGUNGETUNGOD */	$"554E 474F 540D 554E 4755 4D0D 554E 4841"            /* UNGOTUNGUMUNHA */	$"540D 554E 4849 500D 554E 4943 410D 554E"            /* TUNHIPUNICAUN */	$"4954 530D 554E 4A41 4D0D 554E 4B45 440D"            /* ITSUNJAMUNKED */	$"554E 4B45 540D 554E 4B49 440D 554E 4C41"            /* UNKETUNKIDUNLA */	$"570D 554E 4C41 590D 554E 4C45 440D 554E"            /* WUNLAYUNLEDUN */	$"4C45 540D 554E 4C49 440D 554E 4D41 4E0D"            /* LETUNLIDUNMAN */	$"554E 4D45 570D 554E 4D49 580D 554E 5041"            /* UNMEWUNMIXUNPA */	$"590D 554E 5045 470D 554E 5045 4E0D 554E"            /* YUNPEGUNPENUN */	$"5049 4E0D 554E 5245 440D 554E 5249 440D"            /* PINUNREDUNRID */	$"554E 5249 470D 554E 5249 500D 554E 5341"            /* UNRIGUNRIPUNSA */	$"570D 554E 5341 590D 554E 5345 450D 554E"            /* WUNSAYUNSEEUN */	$"5345 570D 554E 5345 580D 554E 534F 440D"            /* SEWUNSEXUNSOD */	$"554E 5441 580D 554E 5449 4E0D 554E 5745"            /* UNTAXUNTINUNWE */	$"540D 554E 5749 540D 554E 574F 4E0D 5550"            /* TUNWITUNWONUP */	$"424F 570D 5550 4259 450D 5550 444F 530D"            /* BOWUPBYEUPDOS */	$"5550 4452 590D 5550 454E 440D 5550 4A45"            /* UPDRYUPENDUPJE */	$"540D 5550 4C41 590D 5550 4C45 440D 5550"            /* TUPLAYUPLEDUP */	$"4C49 540D 5550 5045 440D 5550 5241 4E0D"            /* LITUPPEDUPRAN */	$"5550 5255 4E0D 5550 5345 450D 5550 5345"            /* UPRUNUPSEEUPSE */	$"590D 5550 5441 4B0D 5550 5445 520D 5550"            /* YUPTAKUPTERUP */	$"5449 450D 5552 4145 490D 5552 414C 490D"            /* TIEURAEIURALI */	$"5552 414F 530D 5552 4152 450D 5552 4152"            /* URAOSURAREURAR */	$"490D 5552 4153 450D 5552 4154 450D 5552"            /* IURASEURATEUR */	$"4245 580D 5552 4249 410D 5552 4445 450D"            /* BEXURBIAURDEE */	$"5552 4541 4C0D 5552 4541 530D 5552 4544"            /* UREALUREASURED */	$"4F0D 5552 4549 430D 5552 454E 410D 5552"            /* OUREICURENAUR */	$"454E 540D 5552 4745 440D 5552 4745 520D"            /* ENTURGEDURGER */	$"5552 4745 530D 5552 4941 4C0D 5552 4954"            /* URGESURIALURIT */	$"450D 5552 4D41 4E0D 5552 4E41 4C0D 5552"            /* EURMANURNALUR */	$"4E45 440D 5552 5045 440D 5552 5341 450D"            /* NEDURPEDURSAE */	$"5552 5349 440D 5552 534F 4E0D 5552 5542"            /* URSIDURSONURUB */	$"550D 5552 5641 530D 5553 4552 530D 5553"            /* UURVASUSERSUS */	$"4E45 410D 5553 5155 450D 5553 5552 450D"            /* NEAUSQUEUSURE */	$"5553 5552 590D 5554 4552 490D 5556 4541"            /* USURYUTERIUVEA */	$"4C0D 5556 4541 530D 5556 554C 410D 5641"            /* LUVEASUVULAVA */	$"4355 410D 5641 4445 440D 5641 4445 530D"            /* CUAVADEDVADES */	$"5641 4741 4C0D 5641 4755 530D 5641 494C"            /* VAGALVAGUSVAIL */	$"530D 5641 4952 450D 5641 4952 530D 5641"            /* SVAIREVAIRSVA */	$"4952 590D 5641 4B41 530D 5641 4B49 4C0D"            /* IRYVAKASVAKIL */	$"5641 4C45 530D 5641 4C49 530D 5641 4C53"            /* VALESVALISVALS */	$"450D 5641 4D50 530D 5641 4D50 590D 5641"            /* EVAMPSVAMPYVA */	$"4E44 410D 5641 4E45 440D 5641 4E45 530D"            /* NDAVANEDVANES */	$"5641 4E47 530D 5641 4E54 530D 5641 5045"            /* VANGSVANTSVAPE */	$"440D 5641 5045 520D 5641 5045 530D 5641"            /* DVAPERVAPESVA */	$"5241 4E0D 5641 5241 530D 5641 5244 590D"            /* RANVARASVARDY */	$"5641 5245 430D 5641 5245 530D 5641 5249"            /* VARECVARESVARI */	$"410D 5641 5249 580D 5641 524E 410D 5641"            /* AVARIXVARNAVA */	$"5255 530D 5641 5256 450D 5641 5341 4C0D"            /* RUSVARVEVASAL */	$"5641 5345 530D 5641 5354 530D 5641 5354"            /* VASESVASTSVAST */	$"590D 5641 5449 430D 5641 5455 530D 5641"            /* YVATICVATUSVA */	$"5543 480D 5641 5554 450D 5641 5554 530D"            /* UCHVAUTEVAUTS */	$"5641 5754 450D 5641 5845 530D 5645 414C"            /* VAWTEVAXESVEAL */	$"450D 5645 414C 530D 5645 414C 590D 5645"            /* EVEALSVEALYVE */	$"454E 410D 5645 4550 530D 5645 4552 530D"            /* ENAVEEPSVEERS */	$"5645 4552 590D 5645 4741 530D 5645 4745"            /* VEERYVEGASVEGE */	$"530D 5645 4749 450D 5645 474F 530D 5645"            /* SVEGIEVEGOSVE */	$"484D 450D 5645 494C 530D 5645 494C 590D"            /* HMEVEILSVEILY */	$"5645 494E 530D 5645 494E 590D 5645 4C41"            /* VEINSVEINYVELA */	$"520D 5645 4C44 530D 5645 4C44 540D 5645"            /* RVELDSVELDTVE */	$"4C45 530D 5645 4C4C 530D 5645 4C55 4D0D"            /* LESVELLSVELUM */	$"5645 4E41 450D 5645 4E41 4C0D 5645 4E44"            /* VENAEVENALVEND */	$"530D 5645 4E44 550D 5645 4E45 590D 5645"            /* SVENDUVENEYVE */	$"4E47 450D 5645 4E49 4E0D 5645 4E54 530D"            /* NGEVENINVENTS */	$"5645 4E55 530D 5645 5242 530D 5645 5252"            /* VENUSVERBSVERR */	$"410D 5645 5252 590D 5645 5253 540D 5645"            /* AVERRYVERSTVE */	$"5254 530D 5645 5254 550D 5645 5350 410D"            /* RTSVERTUVESPA */	$"5645 5354 410D 5645 5354 530D 5645 5443"            /* VESTAVESTSVETC */	$"480D 5645 5845 440D 5645 5845 520D 5645"            /* HVEXEDVEXERVE */	$"5845 530D 5645 5849 4C0D 5645 5A49 520D"            /* XESVEXILVEZIR */	$"5649 414C 530D 5649 414E 440D 5649 4245"            /* VIALSVIANDVIBE */	$"530D 5649 4245 580D 5649 4245 590D 5649"            /* SVIBEXVIBEYVI */	$"4345 440D 5649 4345 530D 5649 4348 590D"            /* CEDVICESVICHY */	$"5649 4552 530D 5649 4557 530D 5649 4557"            /* VIERSVIEWSVIEW */	$"590D 5649 4644 410D 5649 4646 530D 5649"            /* YVIFDAVIFFSVI */	$"4741 530D 5649 4749 410D 5649 4C44 450D"            /* GASVIGIAVILDE */	$"5649 4C45 520D 5649 4C4C 490D 5649 4C4C"            /* VILERVILLIVILL */	$"530D 5649 4D45 4E0D 5649 4E41 4C0D 5649"            /* SVIMENVINALVI */	$"4E41 530D 5649 4E43 410D 5649 4E45 440D"            /* NASVINCAVINED */	$"5649 4E45 520D 5649 4E45 530D 5649 4E45"            /* VINERVINESVINE */	$"570D 5649 4E49 430D 5649 4E4F 530D 5649"            /* WVINICVINOSVI */	$"4E54 530D 5649 4F4C 440D 5649 4F4C 530D"            /* NTSVIOLDVIOLS */	$"5649 5245 440D 5649 5245 4F0D 5649 5245"            /* VIREDVIREOVIRE */	$"530D 5649 5247 410D 5649 5247 450D 5649"            /* SVIRGAVIRGEVI */	$"5249 440D 5649 524C 530D 5649 5254 550D"            /* RIDVIRLSVIRTU */	$"5649 5341 530D 5649 5345 440D 5649 5345"            /* VISASVISEDVISE */	$"530D 5649 5349 450D 5649 534E 450D 5649"            /* SVISIEVISNEVI */	$"534F 4E0D 5649 5354 4F0D 5649 5441 450D"            /* SONVISTOVITAE */	$"5649 5441 530D 5649 5445 580D 5649 5452"            /* VITASVITEXVITR */	$"4F0D 5649 5454 410D 5649 5641 530D 5649"            /* OVITTAVIVASVI */	$"5641 540D 5649 5644 410D 5649 5645 520D"            /* VATVIVDAVIVER */	$"5649 5645 530D 5649 5A49 520D 5649 5A4F"            /* VIVESVIZIRVIZO */	$"520D 564C 4549 530D 564C 4945 530D 564C"            /* RVLEISVLIESVL */	$"4F47 530D 564F 4152 530D 564F 4341 420D"            /* OGSVOARSVOCAB */	$"564F 4345 530D 564F 4444 590D 564F 444F"            /* VOCESVODDYVODO */	$"550D 564F 4455 4E0D 564F 454D 410D 564F"            /* UVODUNVOEMAVO */	$"4749 450D 564F 4944 530D 564F 494C 450D"            /* GIEVOIDSVOILE */	$"564F 4950 530D 564F 4C41 450D 564F 4C41"            /* VOIPSVOLAEVOLA */	$"520D 564F 4C45 440D 564F 4C45 530D 564F"            /* RVOLEDVOLESVO */	$"4C45 540D 564F 4C4B 530D 564F 4C54 410D"            /* LETVOLKSVOLTA */	$"564F 4C54 450D 564F 4C54 490D 564F 4C54"            /* VOLTEVOLTIVOLT */	$"530D 564F 4C56 410D 564F 4C56 450D 564F"            /* SVOLVAVOLVEVO */	$"4D45 520D 564F 5445 440D 564F 5445 530D"            /* MERVOTEDVOTES */	$"564F 5547 450D 564F 554C 550D 564F 5745"            /* VOUGEVOULUVOWE */	$"440D 564F 5745 520D 564F 5845 4C0D 564F"            /* DVOWERVOXELVO */	$"5A48 440D 5652 4149 430D 5652 494C 530D"            /* ZHDVRAICVRILS */	$"5652 4F4F 4D0D 5652 4F55 530D 5652 4F55"            /* VROOMVROUSVROU */	$"570D 5652 4F57 530D 5655 4747 530D 5655"            /* WVROWSVUGGSVU */	$"4747 590D 5655 4748 530D 5655 4748 590D"            /* GGYVUGHSVUGHY */	$"5655 4C47 4F0D 5655 4C4E 530D 5655 4C56"            /* VULGOVULNSVULV */	$"410D 5655 5454 590D 5741 4143 530D 5741"            /* AVUTTYWAACSWA */	$"434B 450D 5741 434B 4F0D 5741 434B 530D"            /* CKEWACKOWACKS */	$"5741 4444 530D 5741 4444 590D 5741 4445"            /* WADDSWADDYWADE */	$"440D 5741 4445 520D 5741 4445 530D 5741"            /* DWADERWADESWA */	$"4447 450D 5741 4449 530D 5741 4454 530D"            /* DGEWADISWADTS */	$"5741 4646 530D 5741 4654 530D 5741 4745"            /* WAFFSWAFTSWAGE */	$"440D 5741 4745 530D 5741 4747 410D 5741"            /* DWAGESWAGGAWA */	$"4759 550D 5741 484F 4F0D 5741 4944 450D"            /* GYUWAHOOWAIDE */	$"5741 4946 530D 5741 4946 540D 5741 494C"            /* WAIFSWAIFTWAIL */	$"530D 5741 494E 530D 5741 4952 530D 5741"            /* SWAINSWAIRSWA */	$"4954 450D 5741 4954 530D 5741 4B41 530D"            /* ITEWAITSWAKAS */	$"5741 4B45 440D 5741 4B45 4E0D 5741 4B45"            /* WAKEDWAKENWAKE */	$"520D 5741 4B45 530D 5741 4B46 530D 5741"            /* RWAKESWAKFSWA */	$"4C44 4F0D 5741 4C44 530D 5741 4C45 440D"            /* LDOWALDSWALED */	$"5741 4C45 520D 5741 4C45 530D 5741 4C49"            /* WALERWALESWALI */	$"450D 5741 4C49 530D 5741 4C4B 530D 5741"            /* EWALISWALKSWA */	$"4C4C 410D 5741 4C4C 530D 5741 4C4C 590D"            /* LLAWALLSWALLY */	$"5741 4C54 590D 5741 4D45 440D 5741 4D45"            /* WALTYWAMEDWAME */	$"530D 5741 4D55 530D 5741 4E44 530D 5741"            /* SWAMUSWANDSWA */	$"4E45 440D 5741 4E45 530D 5741 4E45 590D"            /* NEDWANESWANEY */	$"5741 4E47 530D 5741 4E4B 530D 5741 4E4B"            /* WANGSWANKSWANK */	$"590D 5741 4E4C 450D 5741 4E4C 590D 5741"            /* YWANLEWANLYWA */	$"4E4E 410D 5741 4E54 530D 5741 4E54 590D"            /* NNAWANTSWANTY */	$"5741 4E5A 450D 5741 5146 530D 5741 5242"            /* WANZEWAQFSWARB */	$"530D 5741 5242 590D 5741 5244 530D 5741"            /* SWARBYWARDSWA */	$"5245 440D 5741 5245 530D 5741 5245 5A0D"            /* REDWARESWAREZ */	$"5741 524B 530D 5741 524D 530D 5741 524E"            /* WARKSWARMSWARN */	$"530D 5741 5250 530D 5741 5252 450D 5741"            /* SWARPSWARREWA */	$"5253 540D 5741 5254 530D 5741 5345 530D"            /* RSTWARTSWASES */	$"5741 5348 590D 5741 534D 530D 5741 5350"            /* WASHYWASMSWASP */	$"530D 5741 5350 590D 5741 5354 530D 5741"            /* SWASPYWASTSWA */	$"5441 500D 5741 5454 530D 5741 5546 460D"            /* TAPWATTSWAUFF */	$"5741 5547 480D 5741 554B 530D 5741 554C"            /* WAUGHWAUKSWAUL */	$"4B0D 5741 554C 530D 5741 5552 530D 5741"            /* KWAULSWAURSWA */	$"5645 440D 5741 5645 530D 5741 5645 590D"            /* VEDWAVESWAVEY */	$"5741 5741 530D 5741 5745 530D 5741 574C"            /* WAWASWAWESWAWL */	$"530D 5741 5845 440D 5741 5845 520D 5741"            /* SWAXEDWAXERWA */	$"5845 530D 5741 5945 440D 5741 5A49 520D"            /* XESWAYEDWAZIR */	$"5741 5A4F 4F0D 5745 414C 440D 5745 414C"            /* WAZOOWEALDWEAL */	$"530D 5745 414D 420D 5745 414E 530D 5745"            /* SWEAMBWEANSWE */	$"4152 530D 5745 4242 590D 5745 4245 520D"            /* ARSWEBBYWEBER */	$"5745 4348 540D 5745 4445 4C0D 5745 4447"            /* WECHTWEDELWEDG */	$"590D 5745 4544 530D 5745 454B 450D 5745"            /* YWEEDSWEEKEWE */	$"454B 530D 5745 454C 530D 5745 454D 530D"            /* EKSWEELSWEEMS */	$"5745 454E 530D 5745 454E 590D 5745 4550"            /* WEENSWEENYWEEP */	$"530D 5745 4550 590D 5745 4553 540D 5745"            /* SWEEPYWEESTWE */	$"4554 450D 5745 4554 530D 5745 4654 450D"            /* ETEWEETSWEFTE */	$"5745 4654 530D 5745 4944 530D 5745 494C"            /* WEFTSWEIDSWEIL */	$"530D 5745 4952 530D 5745 4953 450D 5745"            /* SWEIRSWEISEWE */	$"495A 450D 5745 4B41 530D 5745 4C44 530D"            /* IZEWEKASWELDS */	$"5745 4C4B 450D 5745 4C4B 530D 5745 4C4B"            /* WELKEWELKSWELK */	$"540D 5745 4C4C 530D 5745 4C4C 590D 5745"            /* TWELLSWELLYWE */	$"4C54 530D 5745 4D42 530D 5745 4E43 480D"            /* LTSWEMBSWENCH */	$"5745 4E44 530D 5745 4E47 450D 5745 4E4E"            /* WENDSWENGEWENN */	$"590D 5745 4E54 530D 5745 524F 530D 5745"            /* YWENTSWEROSWE */	$"5253 480D 5745 5354 530D 5745 5441 530D"            /* RSHWESTSWETAS */	$"5745 544C 590D 5745 5845 440D 5745 5845"            /* WETLYWEXEDWEXE */	$"530D 5748 414D 4F0D 5748 414D 530D 5748"            /* SWHAMOWHAMSWH */	$"414E 470D 5748 4150 530D 5748 4152 450D"            /* ANGWHAPSWHARE */	$"5748 4154 410D 5748 4154 530D 5748 4155"            /* WHATAWHATSWHAU */	$"500D 5748 4155 520D 5748 4541 4C0D 5748"            /* PWHAURWHEALWH */	$"4541 520D 5748 4545 4E0D 5748 4545 500D"            /* EARWHEENWHEEP */	$"5748 4546 540D 5748 454C 4B0D 5748 454C"            /* WHEFTWHELKWHEL */	$"4D0D 5748 454E 530D 5748 4554 530D 5748"            /* MWHENSWHETSWH */	$"4557 530D 5748 4559 530D 5748 4944 530D"            /* EWSWHEYSWHIDS */	$"5748 4946 540D 5748 4947 530D 5748 494C"            /* WHIFTWHIGSWHIL */	$"4B0D 5748 494D 530D 5748 494E 530D 5748"            /* KWHIMSWHINSWH */	$"494F 530D 5748 4950 530D 5748 4950 540D"            /* IOSWHIPSWHIPT */	$"5748 4952 520D 5748 4952 530D 5748 4953"            /* WHIRRWHIRSWHIS */	$"480D 5748 4953 530D 5748 4953 540D 5748"            /* HWHISSWHISTWH */	$"4954 530D 5748 4954 590D 5748 495A 5A0D"            /* ITSWHITYWHIZZ */	$"5748 4F4D 500D 5748 4F4F 460D 5748 4F4F"            /* WHOMPWHOOFWHOO */	$"540D 5748 4F50 530D 5748 4F52 450D 5748"            /* TWHOPSWHOREWH */	$"4F52 4C0D 5748 4F52 540D 5748 4F53 4F0D"            /* ORLWHORTWHOSO */	$"5748 4F57 530D 5748 554D 500D 5748 5550"            /* WHOWSWHUMPWHUP */	$"530D 5748 5944 410D 5749 4343 410D 5749"            /* SWHYDAWICCAWI */	$"434B 530D 5749 434B 590D 5749 4444 590D"            /* CKSWICKYWIDDY */	$"5749 4445 530D 5749 454C 530D 5749 4645"            /* WIDESWIELSWIFE */	$"440D 5749 4645 530D 5749 4645 590D 5749"            /* DWIFESWIFEYWI */	$"4649 450D 5749 4654 590D 5749 4741 4E0D"            /* FIEWIFTYWIGAN */	$"5749 4747 410D 5749 4747 590D 5749 4B49"            /* WIGGAWIGGYWIKI */	$"530D 5749 4C43 4F0D 5749 4C44 530D 5749"            /* SWILCOWILDSWI */	$"4C45 440D 5749 4C45 530D 5749 4C47 410D"            /* LEDWILESWILGA */	$"5749 4C49 530D 5749 4C4A 410D 5749 4C4C"            /* WILISWILJAWILL */	$"530D 5749 4C54 530D 5749 4D50 530D 5749"            /* SWILTSWIMPSWI */	$"4E44 530D 5749 4E45 440D 5749 4E45 530D"            /* NDSWINEDWINES */	$"5749 4E45 590D 5749 4E47 450D 5749 4E47"            /* WINEYWINGEWING */	$"530D 5749 4E47 590D 5749 4E4B 530D 5749"            /* SWINGYWINKSWI */	$"4E4E 410D 5749 4E4E 530D 5749 4E4F 530D"            /* NNAWINNSWINOS */	$"5749 4E5A 450D 5749 5045 440D 5749 5045"            /* WINZEWIPEDWIPE */	$"520D 5749 5045 530D 5749 5245 440D 5749"            /* RWIPESWIREDWI */	$"5245 520D 5749 5245 530D 5749 5252 410D"            /* RERWIRESWIRRA */	$"5749 5345 440D 5749 5345 530D 5749 5348"            /* WISEDWISESWISH */	$"410D 5749 5348 540D 5749 5350 530D 5749"            /* AWISHTWISPSWI */	$"5354 530D 5749 5441 4E0D 5749 5445 440D"            /* STSWITANWITED */	$"5749 5445 530D 5749 5448 450D 5749 5448"            /* WITESWITHEWITH */	$"530D 5749 5448 590D 5749 5645 440D 5749"            /* SWITHYWIVEDWI */	$"5645 520D 5749 5645 530D 5749 5A45 4E0D"            /* VERWIVESWIZEN */	$"5749 5A45 530D 574F 4144 530D 574F 414C"            /* WIZESWOADSWOAL */	$"440D 574F 434B 530D 574F 4447 450D 574F"            /* DWOCKSWODGEWO */	$"4655 4C0D 574F 4A55 530D 574F 4B45 520D"            /* FULWOJUSWOKER */	$"574F 4B4B 410D 574F 4C44 530D 574F 4C46"            /* WOKKAWOLDSWOLF */	$"530D 574F 4C4C 590D 574F 4C56 450D 574F"            /* SWOLLYWOLVEWO */	$"4D42 530D 574F 4D42 590D 574F 4D59 4E0D"            /* MBSWOMBYWOMYN */	$"574F 4E47 410D 574F 4E47 490D 574F 4E4B"            /* WONGAWONGIWONK */	$"530D 574F 4E4B 590D 574F 4E54 530D 574F"            /* SWONKYWONTSWO */	$"4F44 530D 574F 4F45 440D 574F 4F46 530D"            /* ODSWOOEDWOOFS */	$"574F 4F46 590D 574F 4F4C 440D 574F 4F4C"            /* WOOFYWOOLDWOOL */	$"530D 574F 4F4E 530D 574F 4F50 530D 574F"            /* SWOONSWOOPSWO */	$"4F50 590D 574F 4F53 450D 574F 4F53 480D"            /* OPYWOOSEWOOSH */	$"574F 4F54 5A0D 574F 5244 530D 574F 524B"            /* WOOTZWORDSWORK */	$"530D 574F 524D 530D 574F 524D 590D 574F"            /* SWORMSWORMYWO */	$"5254 530D 574F 5745 440D 574F 5745 450D"            /* RTSWOWEDWOWEE */	$"574F 5845 4E0D 5752 414E 470D 5752 4150"            /* WOXENWRANGWRAP */	$"530D 5752 4150 540D 5752 4153 540D 5752"            /* SWRAPTWRASTWR */	$"4154 450D 5752 4157 4C0D 5752 454E 530D"            /* ATEWRAWLWRENS */	$"5752 4943 4B0D 5752 4945 440D 5752 4945"            /* WRICKWRIEDWRIE */	$"520D 5752 4945 530D 5752 4954 530D 5752"            /* RWRIESWRITSWR */	$"4F4B 450D 5752 4F4F 540D 5752 4F54 480D"            /* OKEWROOTWROTH */	$"5752 5945 520D 5755 4444 590D 5755 4455"            /* WRYERWUDDYWUDU */	$"530D 5755 4C4C 530D 5755 5253 540D 5755"            /* SWULLSWURSTWU */	$"5345 530D 5755 5348 550D 5755 5353 590D"            /* SESWUSHUWUSSY */	$"5755 5849 410D 5759 4C45 440D 5759 4C45"            /* WUXIAWYLEDWYLE */	$"530D 5759 4E44 530D 5759 4E4E 530D 5759"            /* SWYNDSWYNNSWY */	$"5445 440D 5759 5445 530D 5845 4245 430D"            /* TEDWYTESXEBEC */	$"5845 4E49 410D 5845 4E49 430D 5845 4E4F"            /* XENIAXENICXENO */	$"4E0D 5845 5249 430D 5845 524F 580D 5845"            /* NXERICXEROXXE */	$"5255 530D 584F 414E 410D 5852 4159 530D"            /* RUSXOANAXRAYS */	$"5859 4C41 4E0D 5859 4C45 4D0D 5859 4C49"            /* XYLANXYLEMXYLI */	$"430D 5859 4C4F 4C0D 5859 4C59 4C0D 5859"            /* CXYLOLXYLYLXY */	$"5354 490D 5859 5354 530D 5941 4152 530D"            /* STIXYSTSYAARS */	$"5941 4241 530D 5941 4242 410D 5941 4242"            /* YABASYABBAYABB */	$"590D 5941 4343 410D 5941 434B 410D 5941"            /* YYACCAYACKAYA */	$"434B 530D 5941 4646 530D 5941 4745 520D"            /* CKSYAFFSYAGER */	$"5941 4745 530D 5941 4749 530D 5941 484F"            /* YAGESYAGISYAHO */	$"4F0D 5941 4952 440D 5941 4B4B 410D 5941"            /* OYAIRDYAKKAYA */	$"4B4F 570D 5941 4C45 530D 5941 4D45 4E0D"            /* KOWYALESYAMEN */	$"5941 4D50 590D 5941 4D55 4E0D 5941 4E47"            /* YAMPYYAMUNYANG */	$"530D 5941 4E4B 530D 5941 504F 4B0D 5941"            /* SYANKSYAPOKYA */	$"504F 4E0D 5941 5050 530D 5941 5050 590D"            /* PONYAPPSYAPPY */	$"5941 5241 4B0D 5941 5243 4F0D 5941 5244"            /* YARAKYARCOYARD */	$"530D 5941 5245 520D 5941 5246 410D 5941"            /* SYARERYARFAYA */	$"524B 530D 5941 524E 530D 5941 5252 530D"            /* RKSYARNSYARRS */	$"5941 5254 410D 5941 5254 4F0D 5941 5445"            /* YARTAYARTOYATE */	$"530D 5941 5544 530D 5941 554C 440D 5941"            /* SYAUDSYAULDYA */	$"5550 530D 5941 5745 440D 5941 5745 590D"            /* UPSYAWEDYAWEY */	$"5941 574C 530D 5941 574E 530D 5941 574E"            /* YAWLSYAWNSYAWN */	$"590D 5941 5750 530D 5942 4F52 450D 5943"            /* YYAWPSYBOREYC */	$"4C41 440D 5943 4C45 440D 5943 4F4E 440D"            /* LADYCLEDYCOND */	$"5944 5241 440D 5944 5245 440D 5945 4144"            /* YDRADYDREDYEAD */	$"530D 5945 4148 530D 5945 414C 4D0D 5945"            /* SYEAHSYEALMYE */	$"414E 530D 5945 4152 440D 5945 4152 530D"            /* ANSYEARDYEARS */	$"5945 4343 480D 5945 4348 530D 5945 4348"            /* YECCHYECHSYECH */	$"590D 5945 4445 530D 5945 4544 530D 5945"            /* YYEDESYEEDSYE */	$"4553 480D 5945 4747 530D 5945 4C4B 530D"            /* ESHYEGGSYELKS */	$"5945 4C4C 530D 5945 4C4D 530D 5945 4C50"            /* YELLSYELMSYELP */	$"530D 5945 4C54 530D 5945 4E54 410D 5945"            /* SYELTSYENTAYE */	$"4E54 450D 5945 5242 410D 5945 5244 530D"            /* NTEYERBAYERDS */	$"5945 524B 530D 5945 5345 530D 5945 534B"            /* YERKSYESESYESK */	$"530D 5945 5354 530D 5945 5354 590D 5945"            /* SYESTSYESTYYE */	$"5449 530D 5945 5454 530D 5945 554B 530D"            /* TISYETTSYEUKS */	$"5945 554B 590D 5945 5645 4E0D 5945 5645"            /* YEUKYYEVENYEVE */	$"530D 5945 5745 4E0D 5945 5845 440D 5945"            /* SYEWENYEXEDYE */	$"5845 530D 5946 4552 450D 5949 4B45 440D"            /* XESYFEREYIKED */	$"5949 4B45 530D 5949 4C4C 530D 5949 4E43"            /* YIKESYILLSYINC */	$"450D 5949 5045 530D 5949 5050 590D 5949"            /* EYIPESYIPPYYI */	$"5244 530D 5949 524B 530D 5949 5252 530D"            /* RDSYIRKSYIRRS */	$"5949 5254 480D 5949 5445 530D 5949 5449"            /* YIRTHYITESYITI */	$"450D 594C 454D 530D 594C 494B 450D 594C"            /* EYLEMSYLIKEYL */	$"4B45 530D 594D 4F4C 540D 594D 5045 530D"            /* KESYMOLTYMPES */	$"594F 4242 4F0D 594F 4242 590D 594F 434B"            /* YOBBOYOBBYYOCK */	$"530D 594F 4445 4C0D 594F 4448 530D 594F"            /* SYODELYODHSYO */	$"444C 450D 594F 4741 530D 594F 4745 450D"            /* DLEYOGASYOGEE */	$"594F 4748 530D 594F 4749 430D 594F 4749"            /* YOGHSYOGICYOGI */	$"4E0D 594F 4749 530D 594F 4943 4B0D 594F"            /* NYOGISYOICKYO */	$"4A41 4E0D 594F 4B45 440D 594F 4B45 4C0D"            /* JANYOKEDYOKEL */	$"594F 4B45 520D 594F 4B45 530D 594F 4B55"            /* YOKERYOKESYOKU */	$"4C0D 594F 4C4B 530D 594F 4C4B 590D 594F"            /* LYOLKSYOLKYYO */	$"4D49 4D0D 594F 4D50 530D 594F 4E49 430D"            /* MIMYOMPSYONIC */	$"594F 4E49 530D 594F 4E4B 530D 594F 4F46"            /* YONISYONKSYOOF */	$"530D 594F 4F50 530D 594F 5245 530D 594F"            /* SYOOPSYORESYO */	$"524B 530D 594F 5250 530D 594F 554B 530D"            /* RKSYORPSYOUKS */	$"594F 5552 4E0D 594F 5552 530D 594F 5552"            /* YOURNYOURSYOUR */	$"540D 594F 5553 450D 594F 5745 440D 594F"            /* TYOUSEYOWEDYO */	$"5745 530D 594F 5749 450D 594F 574C 530D"            /* WESYOWIEYOWLS */	$"594F 575A 410D 5952 4150 540D 5952 454E"            /* YOWZAYRAPTYREN */	$"540D 5952 4956 440D 5952 4E45 480D 5953"            /* TYRIVDYRNEHYS */	$"414D 450D 5954 4F53 540D 5955 414E 530D"            /* AMEYTOSTYUANS */	$"5955 4341 530D 5955 4343 410D 5955 4343"            /* YUCASYUCCAYUCC */	$"480D 5955 434B 4F0D 5955 434B 530D 5955"            /* HYUCKOYUCKSYU */	$"434B 590D 5955 4654 530D 5955 4741 530D"            /* CKYYUFTSYUGAS */	$"5955 4B45 440D 5955 4B45 530D 5955 4B4B"            /* YUKEDYUKESYUKK */	$"590D 5955 4B4F 530D 5955 4C41 4E0D 5955"            /* YYUKOSYULANYU */	$"4C45 530D 5955 4D4D 4F0D 5955 4D4D 590D"            /* LESYUMMOYUMMY */	$"5955 4D50 530D 5955 504F 4E0D 5955 5050"            /* YUMPSYUPONYUPP */	$"590D 5955 5254 410D 5955 5254 530D 5955"            /* YYURTAYURTSYU */	$"5A55 530D 5A41 4252 410D 5A41 434B 530D"            /* ZUSZABRAZACKS */	$"5A41 4944 410D 5A41 4944 590D 5A41 4952"            /* ZAIDAZAIDYZAIR */	$"450D 5A41 4B41 540D 5A41 4D41 4E0D 5A41"            /* EZAKATZAMANZA */	$"4D42 4F0D 5A41 4D49 410D 5A41 4E4A 410D"            /* MBOZAMIAZANJA */	$"5A41 4E54 450D 5A41 4E5A 410D 5A41 4E5A"            /* ZANTEZANZAZANZ */	$"450D 5A41 5050 590D 5A41 5246 530D 5A41"            /* EZAPPYZARFSZA */	$"5249 530D 5A41 5449 530D 5A41 5845 530D"            /* RISZATISZAXES */	$"5A41 5949 4E0D 5A41 5A45 4E0D 5A45 414C"            /* ZAYINZAZENZEAL */	$"530D 5A45 4245 430D 5A45 4255 420D 5A45"            /* SZEBECZEBUBZE */	$"4255 530D 5A45 4441 530D 5A45 494E 530D"            /* BUSZEDASZEINS */	$"5A45 4E44 4F0D 5A45 5244 410D 5A45 524B"            /* ZENDOZERDAZERK */	$"530D 5A45 524F 530D 5A45 5354 530D 5A45"            /* SZEROSZESTSZE */	$"5441 530D 5A45 5845 530D 5A45 5A45 530D"            /* TASZEXESZEZES */	$"5A48 4F4D 4F0D 5A49 4245 540D 5A49 4646"            /* ZHOMOZIBETZIFF */	$"530D 5A49 4741 4E0D 5A49 4C41 530D 5A49"            /* SZIGANZILASZI */	$"4C43 480D 5A49 4C4C 410D 5A49 4C4C 530D"            /* LCHZILLAZILLS */	$"5A49 4D42 490D 5A49 4D42 530D 5A49 4E43"            /* ZIMBIZIMBSZINC */	$"4F0D 5A49 4E43 530D 5A49 4E43 590D 5A49"            /* OZINCSZINCYZI */	$"4E45 420D 5A49 4E45 530D 5A49 4E47 530D"            /* NEBZINESZINGS */	$"5A49 4E47 590D 5A49 4E4B 450D 5A49 4E4B"            /* ZINGYZINKEZINK */	$"590D 5A49 5050 4F0D 5A49 5050 590D 5A49"            /* YZIPPOZIPPYZI */	$"5241 4D0D 5A49 5449 530D 5A49 5A45 4C0D"            /* RAMZITISZIZEL */	$"5A49 5A49 540D 5A4C 4F54 450D 5A4C 4F54"            /* ZIZITZLOTEZLOT */	$"590D 5A4F 4145 410D 5A4F 424F 530D 5A4F"            /* YZOAEAZOBOSZO */	$"4255 530D 5A4F 4343 4F0D 5A4F 4541 450D"            /* BUSZOCCOZOEAE */	$"5A4F 4541 4C0D 5A4F 4541 530D 5A4F 4953"            /* ZOEALZOEASZOIS */	$"4D0D 5A4F 4953 540D 5A4F 4D42 490D 5A4F"            /* MZOISTZOMBIZO */	$"4E41 450D 5A4F 4E44 410D 5A4F 4E45 440D"            /* NAEZONDAZONED */	$"5A4F 4E45 520D 5A4F 4E45 530D 5A4F 4E4B"            /* ZONERZONESZONK */	$"530D 5A4F 4F45 410D 5A4F 4F45 590D 5A4F"            /* SZOOEAZOOEYZO */	$"4F49 440D 5A4F 4F4B 530D 5A4F 4F4D 530D"            /* OIDZOOKSZOOMS */	$"5A4F 4F4E 530D 5A4F 4F54 590D 5A4F 5050"            /* ZOONSZOOTYZOPP */	$"410D 5A4F 5050 4F0D 5A4F 5249 4C0D 5A4F"            /* AZOPPOZORILZO */	$"5249 530D 5A4F 5252 4F0D 5A4F 554B 530D"            /* RISZORROZOUKS */	$"5A4F 5745 450D 5A4F 5749 450D 5A55 4C55"            /* ZOWEEZOWIEZULU */	$"530D 5A55 5041 4E0D 5A55 5041 530D 5A55"            /* SZUPANZUPASZU */	$"5050 410D 5A55 5246 530D 5A55 5A49 4D0D"            /* PPAZURFSZUZIM */	$"5A59 4741 4C0D 5A59 474F 4E0D 5A59 4D45"            /* ZYGALZYGONZYME */	$"530D 5A59 4D49 43"                                  /* SZYMIC */};data 'TEXT' (128) {	$"4142 4143 4B0D 4142 4153 450D 4142 4154"            /* ABACKABASEABAT */	$"450D 4142 4245 590D 4142 424F 540D 4142"            /* EABBEYABBOTAB */	$"484F 520D 4142 4944 450D 4142 4C45 440D"            /* HORABIDEABLED */	$"4142 4F44 450D 4142 4F52 540D 4142 4F55"            /* ABODEABORTABOU */	$"540D 4142 4F56 450D 4142 5553 450D 4142"            /* TABOVEABUSEAB */	$"5953 530D 4143 4F52 4E0D 4143 5249 440D"            /* YSSACORNACRID */	$"4143 544F 520D 4143 5554 450D 4144 4147"            /* ACTORACUTEADAG */	$"450D 4144 4150 540D 4144 4550 540D 4144"            /* EADAPTADEPTAD */	$"4D49 4E0D 4144 4D49 540D 4144 4F42 450D"            /* MINADMITADOBE */	$"4144 4F50 540D 4144 4F52 450D 4144 4F52"            /* ADOPTADOREADOR */	$"4E0D 4144 554C 540D 4146 4649 580D 4146"            /* NADULTAFFIXAF */	$"4952 450D 4146 4F4F 540D 4146 4F55 4C0D"            /* IREAFOOTAFOUL */	$"4146 5445 520D 4147 4149 4E0D 4147 4150"            /* AFTERAGAINAGAP */	$"450D 4147 4154 450D 4147 454E 540D 4147"            /* EAGATEAGENTAG */	$"494C 450D 4147 494E 470D 4147 4C4F 570D"            /* ILEAGINGAGLOW */	$"4147 4F4E 590D 4147 5245 450D 4148 4541"            /* AGONYAGREEAHEA */	$"440D 4149 4445 520D 4149 534C 450D 414C"            /* DAIDERAISLEAL */	$"4152 4D0D 414C 4255 4D0D 414C 4552 540D"            /* ARMALBUMALERT */	$"414C 4741 450D 414C 4942 490D 414C 4945"            /* ALGAEALIBIALIE */	$"4E0D 414C 4947 4E0D 414C 494B 450D 414C"            /* NALIGNALIKEAL */	$"4956 450D 414C 4C41 590D 414C 4C45 590D"            /* IVEALLAYALLEY */	$"414C 4C4F 540D 414C 4C4F 570D 414C 4C4F"            /* ALLOTALLOWALLO */	$"590D 414C 4F46 540D 414C 4F4E 450D 414C"            /* YALOFTALONEAL */	$"4F4E 470D 414C 4F4F 460D 414C 4F55 440D"            /* ONGALOOFALOUD */	$"414C 5048 410D 414C 5441 520D 414C 5445"            /* ALPHAALTARALTE */	$"520D 414D 4153 530D 414D 415A 450D 414D"            /* RAMASSAMAZEAM */	$"4245 520D 414D 424C 450D 414D 454E 440D"            /* BERAMBLEAMEND */	$"414D 4953 530D 414D 4954 590D 414D 4F4E"            /* AMISSAMITYAMON */	$"470D 414D 504C 450D 414D 504C 590D 414D"            /* GAMPLEAMPLYAM */	$"5553 450D 414E 4745 4C0D 414E 4745 520D"            /* USEANGELANGER */	$"414E 474C 450D 414E 4752 590D 414E 4753"            /* ANGLEANGRYANGS */	$"540D 414E 494D 450D 414E 4B4C 450D 414E"            /* TANIMEANKLEAN */	$"4E45 580D 414E 4E4F 590D 414E 4E55 4C0D"            /* NEXANNOYANNUL */	$"414E 4F44 450D 414E 5449 430D 414E 5649"            /* ANODEANTICANVI */	$"4C0D 414F 5254 410D 4150 4152 540D 4150"            /* LAORTAAPARTAP */	$"4849 440D 4150 494E 470D 4150 4E45 410D"            /* HIDAPINGAPNEA */	$"4150 504C 450D 4150 504C 590D 4150 524F"            /* APPLEAPPLYAPRO */	$"4E0D 4150 544C 590D 4152 424F 520D 4152"            /* NAPTLYARBORAR */	$"444F 520D 4152 454E 410D 4152 4755 450D"            /* DORARENAARGUE */	$"4152 4953 450D 4152 4D4F 520D 4152 4F4D"            /* ARISEARMORAROM */	$"410D 4152 4F53 450D 4152 5241 590D 4152"            /* AAROSEARRAYAR */	$"524F 570D 4152 534F 4E0D 4152 5453 590D"            /* ROWARSONARTSY */	$"4153 434F 540D 4153 4845 4E0D 4153 4944"            /* ASCOTASHENASID */	$"450D 4153 4B45 570D 4153 5341 590D 4153"            /* EASKEWASSAYAS */	$"5345 540D 4154 4F4C 4C0D 4154 4F4E 450D"            /* SETATOLLATONE */	$"4154 5449 430D 4155 4449 4F0D 4155 4449"            /* ATTICAUDIOAUDI */	$"540D 4155 4755 520D 4155 4E54 590D 4156"            /* TAUGURAUNTYAV */	$"4149 4C0D 4156 4552 540D 4156 4941 4E0D"            /* AILAVERTAVIAN */	$"4156 4F49 440D 4157 4149 540D 4157 414B"            /* AVOIDAWAITAWAK */	$"450D 4157 4152 440D 4157 4152 450D 4157"            /* EAWARDAWAREAW */	$"4153 480D 4157 4655 4C0D 4157 4F4B 450D"            /* ASHAWFULAWOKE */	$"4158 4941 4C0D 4158 494F 4D0D 4158 494F"            /* AXIALAXIOMAXIO */	$"4E0D 415A 5552 450D 4241 434F 4E0D 4241"            /* NAZUREBACONBA */	$"4447 450D 4241 444C 590D 4241 4745 4C0D"            /* DGEBADLYBAGEL */	$"4241 4747 590D 4241 4B45 520D 4241 4C45"            /* BAGGYBAKERBALE */	$"520D 4241 4C4D 590D 4241 4E41 4C0D 4241"            /* RBALMYBANALBA */	$"4E4A 4F0D 4241 5247 450D 4241 524F 4E0D"            /* NJOBARGEBARON */	$"4241 5341 4C0D 4241 5349 430D 4241 5349"            /* BASALBASICBASI */	$"4C0D 4241 5349 4E0D 4241 5349 530D 4241"            /* LBASINBASISBA */	$"5354 450D 4241 5443 480D 4241 5448 450D"            /* STEBATCHBATHE */	$"4241 544F 4E0D 4241 5454 590D 4241 5744"            /* BATONBATTYBAWD */	$"590D 4241 594F 550D 4245 4143 480D 4245"            /* YBAYOUBEACHBE */	$"4144 590D 4245 4152 440D 4245 4153 540D"            /* ADYBEARDBEAST */	$"4245 4543 480D 4245 4546 590D 4245 4649"            /* BEECHBEEFYBEFI */	$"540D 4245 4741 4E0D 4245 4741 540D 4245"            /* TBEGANBEGATBE */	$"4745 540D 4245 4749 4E0D 4245 4755 4E0D"            /* GETBEGINBEGUN */	$"4245 494E 470D 4245 4C43 480D 4245 4C49"            /* BEINGBELCHBELI */	$"450D 4245 4C4C 450D 4245 4C4C 590D 4245"            /* EBELLEBELLYBE */	$"4C4F 570D 4245 4E43 480D 4245 5245 540D"            /* LOWBENCHBERET */	$"4245 5252 590D 4245 5254 480D 4245 5345"            /* BERRYBERTHBESE */	$"540D 4245 5445 4C0D 4245 5645 4C0D 4245"            /* TBETELBEVELBE */	$"5A45 4C0D 4249 424C 450D 4249 4345 500D"            /* ZELBIBLEBICEP */	$"4249 4444 590D 4249 474F 540D 4249 4C47"            /* BIDDYBIGOTBILG */	$"450D 4249 4C4C 590D 4249 4E47 450D 4249"            /* EBILLYBINGEBI */	$"4E47 4F0D 4249 4F4D 450D 4249 5243 480D"            /* NGOBIOMEBIRCH */	$"4249 5254 480D 4249 534F 4E0D 4249 5454"            /* BIRTHBISONBITT */	$"590D 424C 4143 4B0D 424C 4144 450D 424C"            /* YBLACKBLADEBL */	$"414D 450D 424C 414E 440D 424C 414E 4B0D"            /* AMEBLANDBLANK */	$"424C 4152 450D 424C 4153 540D 424C 415A"            /* BLAREBLASTBLAZ */	$"450D 424C 4541 4B0D 424C 4541 540D 424C"            /* EBLEAKBLEATBL */	$"4545 440D 424C 4545 500D 424C 454E 440D"            /* EEDBLEEPBLEND */	$"424C 4553 530D 424C 494D 500D 424C 494E"            /* BLESSBLIMPBLIN */	$"440D 424C 494E 4B0D 424C 4953 530D 424C"            /* DBLINKBLISSBL */	$"4954 5A0D 424C 4F41 540D 424C 4F43 4B0D"            /* ITZBLOATBLOCK */	$"424C 4F4B 450D 424C 4F4E 440D 424C 4F4F"            /* BLOKEBLONDBLOO */	$"440D 424C 4F4F 4D0D 424C 4F57 4E0D 424C"            /* DBLOOMBLOWNBL */	$"5545 520D 424C 5546 460D 424C 554E 540D"            /* UERBLUFFBLUNT */	$"424C 5552 420D 424C 5552 540D 424C 5553"            /* BLURBBLURTBLUS */	$"480D 424F 4152 440D 424F 4153 540D 424F"            /* HBOARDBOASTBO */	$"4242 590D 424F 4E45 590D 424F 4E47 4F0D"            /* BBYBONEYBONGO */	$"424F 4E55 530D 424F 4F42 590D 424F 4F53"            /* BONUSBOOBYBOOS */	$"540D 424F 4F54 480D 424F 4F54 590D 424F"            /* TBOOTHBOOTYBO */	$"4F5A 450D 424F 4F5A 590D 424F 5241 580D"            /* OZEBOOZYBORAX */	$"424F 524E 450D 424F 534F 4D0D 424F 5353"            /* BORNEBOSOMBOSS */	$"590D 424F 5443 480D 424F 5547 480D 424F"            /* YBOTCHBOUGHBO */	$"554C 450D 424F 554E 440D 424F 5745 4C0D"            /* ULEBOUNDBOWEL */	$"424F 5845 520D 4252 4143 450D 4252 4149"            /* BOXERBRACEBRAI */	$"440D 4252 4149 4E0D 4252 414B 450D 4252"            /* DBRAINBRAKEBR */	$"414E 440D 4252 4153 480D 4252 4153 530D"            /* ANDBRASHBRASS */	$"4252 4156 450D 4252 4156 4F0D 4252 4157"            /* BRAVEBRAVOBRAW */	$"4C0D 4252 4157 4E0D 4252 4541 440D 4252"            /* LBRAWNBREADBR */	$"4541 4B0D 4252 4545 440D 4252 4941 520D"            /* EAKBREEDBRIAR */	$"4252 4942 450D 4252 4943 4B0D 4252 4944"            /* BRIBEBRICKBRID */	$"450D 4252 4945 460D 4252 494E 450D 4252"            /* EBRIEFBRINEBR */	$"494E 470D 4252 494E 4B0D 4252 494E 590D"            /* INGBRINKBRINY */	$"4252 4953 4B0D 4252 4F41 440D 4252 4F49"            /* BRISKBROADBROI */	$"4C0D 4252 4F4B 450D 4252 4F4F 440D 4252"            /* LBROKEBROODBR */	$"4F4F 4B0D 4252 4F4F 4D0D 4252 4F54 480D"            /* OOKBROOMBROTH */	$"4252 4F57 4E0D 4252 554E 540D 4252 5553"            /* BROWNBRUNTBRUS */	$"480D 4252 5554 450D 4255 4444 590D 4255"            /* HBRUTEBUDDYBU */	$"4447 450D 4255 4747 590D 4255 474C 450D"            /* DGEBUGGYBUGLE */	$"4255 494C 440D 4255 494C 540D 4255 4C47"            /* BUILDBUILTBULG */	$"450D 4255 4C4B 590D 4255 4C4C 590D 4255"            /* EBULKYBULLYBU */	$"4E43 480D 4255 4E4E 590D 4255 524C 590D"            /* NCHBUNNYBURLY */	$"4255 524E 540D 4255 5253 540D 4255 5345"            /* BURNTBURSTBUSE */	$"440D 4255 5348 590D 4255 5443 480D 4255"            /* DBUSHYBUTCHBU */	$"5454 450D 4255 584F 4D0D 4255 5945 520D"            /* TTEBUXOMBUYER */	$"4259 4C41 570D 4341 4241 4C0D 4341 4242"            /* BYLAWCABALCABB */	$"590D 4341 4249 4E0D 4341 424C 450D 4341"            /* YCABINCABLECA */	$"4341 4F0D 4341 4348 450D 4341 4354 490D"            /* CAOCACHECACTI */	$"4341 4444 590D 4341 4445 540D 4341 4745"            /* CADDYCADETCAGE */	$"590D 4341 4952 4E0D 4341 4D45 4C0D 4341"            /* YCAIRNCAMELCA */	$"4D45 4F0D 4341 4E41 4C0D 4341 4E44 590D"            /* MEOCANALCANDY */	$"4341 4E4E 590D 4341 4E4F 450D 4341 4E4F"            /* CANNYCANOECANO */	$"4E0D 4341 5045 520D 4341 5055 540D 4341"            /* NCAPERCAPUTCA */	$"5241 540D 4341 5247 4F0D 4341 524F 4C0D"            /* RATCARGOCAROL */	$"4341 5252 590D 4341 5256 450D 4341 5354"            /* CARRYCARVECAST */	$"450D 4341 5443 480D 4341 5445 520D 4341"            /* ECATCHCATERCA */	$"5454 590D 4341 554C 4B0D 4341 5553 450D"            /* TTYCAULKCAUSE */	$"4341 5649 4C0D 4345 4153 450D 4345 4441"            /* CAVILCEASECEDA */	$"520D 4345 4C4C 4F0D 4348 4146 450D 4348"            /* RCELLOCHAFECH */	$"4146 460D 4348 4149 4E0D 4348 4149 520D"            /* AFFCHAINCHAIR */	$"4348 414C 4B0D 4348 414D 500D 4348 414E"            /* CHALKCHAMPCHAN */	$"540D 4348 414F 530D 4348 4152 440D 4348"            /* TCHAOSCHARDCH */	$"4152 4D0D 4348 4152 540D 4348 4153 450D"            /* ARMCHARTCHASE */	$"4348 4153 4D0D 4348 4541 500D 4348 4541"            /* CHASMCHEAPCHEA */	$"540D 4348 4543 4B0D 4348 4545 4B0D 4348"            /* TCHECKCHEEKCH */	$"4545 520D 4348 4553 530D 4348 4553 540D"            /* EERCHESSCHEST */	$"4348 4943 4B0D 4348 4944 450D 4348 4945"            /* CHICKCHIDECHIE */	$"460D 4348 494C 440D 4348 494C 490D 4348"            /* FCHILDCHILICH */	$"494C 4C0D 4348 494D 450D 4348 494E 410D"            /* ILLCHIMECHINA */	$"4348 4952 500D 4348 4F43 4B0D 4348 4F49"            /* CHIRPCHOCKCHOI */	$"520D 4348 4F4B 450D 4348 4F52 440D 4348"            /* RCHOKECHORDCH */	$"4F52 450D 4348 4F53 450D 4348 5543 4B0D"            /* ORECHOSECHUCK */	$"4348 554D 500D 4348 554E 4B0D 4348 5552"            /* CHUMPCHUNKCHUR */	$"4E0D 4348 5554 450D 4349 4445 520D 4349"            /* NCHUTECIDERCI */	$"4741 520D 4349 4E43 480D 4349 5243 410D"            /* GARCINCHCIRCA */	$"4349 5649 430D 4349 5649 4C0D 434C 4143"            /* CIVICCIVILCLAC */	$"4B0D 434C 4149 4D0D 434C 414D 500D 434C"            /* KCLAIMCLAMPCL */	$"414E 470D 434C 414E 4B0D 434C 4153 480D"            /* ANGCLANKCLASH */	$"434C 4153 500D 434C 4153 530D 434C 4541"            /* CLASPCLASSCLEA */	$"4E0D 434C 4541 520D 434C 4541 540D 434C"            /* NCLEARCLEATCL */	$"4546 540D 434C 4552 4B0D 434C 4943 4B0D"            /* EFTCLERKCLICK */	$"434C 4946 460D 434C 494D 420D 434C 494E"            /* CLIFFCLIMBCLIN */	$"470D 434C 494E 4B0D 434C 4F41 4B0D 434C"            /* GCLINKCLOAKCL */	$"4F43 4B0D 434C 4F4E 450D 434C 4F53 450D"            /* OCKCLONECLOSE */	$"434C 4F54 480D 434C 4F55 440D 434C 4F55"            /* CLOTHCLOUDCLOU */	$"540D 434C 4F56 450D 434C 4F57 4E0D 434C"            /* TCLOVECLOWNCL */	$"5543 4B0D 434C 5545 440D 434C 554D 500D"            /* UCKCLUEDCLUMP */	$"434C 554E 470D 434F 4143 480D 434F 4153"            /* CLUNGCOACHCOAS */	$"540D 434F 4252 410D 434F 434F 410D 434F"            /* TCOBRACOCOACO */	$"4C4F 4E0D 434F 4C4F 520D 434F 4D45 540D"            /* LONCOLORCOMET */	$"434F 4D46 590D 434F 4D49 430D 434F 4D4D"            /* COMFYCOMICCOMM */	$"410D 434F 4E43 480D 434F 4E44 4F0D 434F"            /* ACONCHCONDOCO */	$"4E49 430D 434F 5053 450D 434F 5241 4C0D"            /* NICCOPSECORAL */	$"434F 5245 520D 434F 524E 590D 434F 5543"            /* CORERCORNYCOUC */	$"480D 434F 5547 480D 434F 554C 440D 434F"            /* HCOUGHCOULDCO */	$"554E 540D 434F 5550 450D 434F 5552 540D"            /* UNTCOUPECOURT */	$"434F 5645 4E0D 434F 5645 520D 434F 5645"            /* COVENCOVERCOVE */	$"540D 434F 5645 590D 434F 5745 520D 434F"            /* TCOVEYCOWERCO */	$"594C 590D 4352 4143 4B0D 4352 4146 540D"            /* YLYCRACKCRAFT */	$"4352 414D 500D 4352 414E 450D 4352 414E"            /* CRAMPCRANECRAN */	$"4B0D 4352 4153 480D 4352 4153 530D 4352"            /* KCRASHCRASSCR */	$"4154 450D 4352 4156 450D 4352 4157 4C0D"            /* ATECRAVECRAWL */	$"4352 415A 450D 4352 415A 590D 4352 4541"            /* CRAZECRAZYCREA */	$"4B0D 4352 4541 4D0D 4352 4544 4F0D 4352"            /* KCREAMCREDOCR */	$"4545 440D 4352 4545 4B0D 4352 4545 500D"            /* EEDCREEKCREEP */	$"4352 454D 450D 4352 4550 450D 4352 4550"            /* CREMECREPECREP */	$"540D 4352 4553 530D 4352 4553 540D 4352"            /* TCRESSCRESTCR */	$"4943 4B0D 4352 4945 440D 4352 4945 520D"            /* ICKCRIEDCRIER */	$"4352 494D 450D 4352 494D 500D 4352 4953"            /* CRIMECRIMPCRIS */	$"500D 4352 4F41 4B0D 4352 4F43 4B0D 4352"            /* PCROAKCROCKCR */	$"4F4E 450D 4352 4F4E 590D 4352 4F4F 4B0D"            /* ONECRONYCROOK */	$"4352 4F53 530D 4352 4F55 500D 4352 4F57"            /* CROSSCROUPCROW */	$"440D 4352 4F57 4E0D 4352 5544 450D 4352"            /* DCROWNCRUDECR */	$"5545 4C0D 4352 554D 420D 4352 554D 500D"            /* UELCRUMBCRUMP */	$"4352 5553 480D 4352 5553 540D 4352 5950"            /* CRUSHCRUSTCRYP */	$"540D 4355 4249 430D 4355 4D49 4E0D 4355"            /* TCUBICCUMINCU */	$"5249 4F0D 4355 524C 590D 4355 5252 590D"            /* RIOCURLYCURRY */	$"4355 5253 450D 4355 5256 450D 4355 5256"            /* CURSECURVECURV */	$"590D 4355 5449 450D 4359 4245 520D 4359"            /* YCUTIECYBERCY */	$"434C 450D 4359 4E49 430D 4441 4444 590D"            /* CLECYNICDADDY */	$"4441 494C 590D 4441 4952 590D 4441 4953"            /* DAILYDAIRYDAIS */	$"590D 4441 4C4C 590D 4441 4E43 450D 4441"            /* YDALLYDANCEDA */	$"4E44 590D 4441 5455 4D0D 4441 554E 540D"            /* NDYDATUMDAUNT */	$"4445 414C 540D 4445 4154 480D 4445 4241"            /* DEALTDEATHDEBA */	$"520D 4445 4249 540D 4445 4255 470D 4445"            /* RDEBITDEBUGDE */	$"4255 540D 4445 4341 4C0D 4445 4341 590D"            /* BUTDECALDECAY */	$"4445 434F 520D 4445 434F 590D 4445 4352"            /* DECORDECOYDECR */	$"590D 4445 4645 520D 4445 4947 4E0D 4445"            /* YDEFERDEIGNDE */	$"4954 590D 4445 4C41 590D 4445 4C54 410D"            /* ITYDELAYDELTA */	$"4445 4C56 450D 4445 4D4F 4E0D 4445 4D55"            /* DELVEDEMONDEMU */	$"520D 4445 4E49 4D0D 4445 4E53 450D 4445"            /* RDENIMDENSEDE */	$"504F 540D 4445 5054 480D 4445 5242 590D"            /* POTDEPTHDERBY */	$"4445 5445 520D 4445 544F 580D 4445 5543"            /* DETERDETOXDEUC */	$"450D 4445 5649 4C0D 4449 4152 590D 4449"            /* EDEVILDIARYDI */	$"4345 590D 4449 4749 540D 4449 4C4C 590D"            /* CEYDIGITDILLY */	$"4449 4D4C 590D 4449 4E45 520D 4449 4E47"            /* DIMLYDINERDING */	$"4F0D 4449 4E47 590D 4449 4F44 450D 4449"            /* ODINGYDIODEDI */	$"5247 450D 4449 5254 590D 4449 5343 4F0D"            /* RGEDIRTYDISCO */	$"4449 5443 480D 4449 5454 4F0D 4449 5454"            /* DITCHDITTODITT */	$"590D 4449 5645 520D 4449 5A5A 590D 444F"            /* YDIVERDIZZYDO */	$"4447 450D 444F 4447 590D 444F 474D 410D"            /* DGEDODGYDOGMA */	$"444F 494E 470D 444F 4C4C 590D 444F 4E4F"            /* DOINGDOLLYDONO */	$"520D 444F 4E55 540D 444F 5045 590D 444F"            /* RDONUTDOPEYDO */	$"5542 540D 444F 5547 480D 444F 5744 590D"            /* UBTDOUGHDOWDY */	$"444F 5745 4C0D 444F 574E 590D 444F 5752"            /* DOWELDOWNYDOWR */	$"590D 444F 5A45 4E0D 4452 4146 540D 4452"            /* YDOZENDRAFTDR */	$"4149 4E0D 4452 414B 450D 4452 414D 410D"            /* AINDRAKEDRAMA */	$"4452 414E 4B0D 4452 4150 450D 4452 4157"            /* DRANKDRAPEDRAW */	$"4C0D 4452 4157 4E0D 4452 4541 440D 4452"            /* LDRAWNDREADDR */	$"4541 4D0D 4452 4553 530D 4452 4945 440D"            /* EAMDRESSDRIED */	$"4452 4945 520D 4452 4946 540D 4452 494C"            /* DRIERDRIFTDRIL */	$"4C0D 4452 494E 4B0D 4452 4956 450D 4452"            /* LDRINKDRIVEDR */	$"4F49 540D 4452 4F4C 4C0D 4452 4F4E 450D"            /* OITDROLLDRONE */	$"4452 4F4F 4C0D 4452 4F4F 500D 4452 4F53"            /* DROOLDROOPDROS */	$"530D 4452 4F56 450D 4452 4F57 4E0D 4452"            /* SDROVEDROWNDR */	$"5549 440D 4452 554E 4B0D 4452 5945 520D"            /* UIDDRUNKDRYER */	$"4452 594C 590D 4455 4348 590D 4455 4C4C"            /* DRYLYDUCHYDULL */	$"590D 4455 4D4D 590D 4455 4D50 590D 4455"            /* YDUMMYDUMPYDU */	$"4E43 450D 4455 534B 590D 4455 5354 590D"            /* NCEDUSKYDUSTY */	$"4455 5443 480D 4455 5645 540D 4457 4152"            /* DUTCHDUVETDWAR */	$"460D 4457 454C 4C0D 4457 454C 540D 4459"            /* FDWELLDWELTDY */	$"494E 470D 4541 4745 520D 4541 474C 450D"            /* INGEAGEREAGLE */	$"4541 524C 590D 4541 5254 480D 4541 5345"            /* EARLYEARTHEASE */	$"4C0D 4541 5445 4E0D 4541 5445 520D 4542"            /* LEATENEATEREB */	$"4F4E 590D 4543 4C41 540D 4544 4943 540D"            /* ONYECLATEDICT */	$"4544 4946 590D 4545 5249 450D 4547 5245"            /* EDIFYEERIEEGRE */	$"540D 4549 4748 540D 454A 4543 540D 454B"            /* TEIGHTEJECTEK */	$"494E 470D 454C 4154 450D 454C 424F 570D"            /* INGELATEELBOW */	$"454C 4445 520D 454C 4543 540D 454C 4547"            /* ELDERELECTELEG */	$"590D 454C 4649 4E0D 454C 4944 450D 454C"            /* YELFINELIDEEL */	$"4954 450D 454C 4F50 450D 454C 5544 450D"            /* ITEELOPEELUDE */	$"454D 4149 4C0D 454D 4245 440D 454D 4245"            /* EMAILEMBEDEMBE */	$"520D 454D 4345 450D 454D 5054 590D 454E"            /* REMCEEEMPTYEN */	$"4143 540D 454E 444F 570D 454E 454D 410D"            /* ACTENDOWENEMA */	$"454E 454D 590D 454E 4A4F 590D 454E 4E55"            /* ENEMYENJOYENNU */	$"490D 454E 5355 450D 454E 5445 520D 454E"            /* IENSUEENTEREN */	$"5452 590D 454E 564F 590D 4550 4F43 480D"            /* TRYENVOYEPOCH */	$"4550 4F58 590D 4551 5541 4C0D 4551 5549"            /* EPOXYEQUALEQUI */	$"500D 4552 4153 450D 4552 4543 540D 4552"            /* PERASEERECTER */	$"4F44 450D 4552 524F 520D 4552 5550 540D"            /* ODEERRORERUPT */	$"4553 5341 590D 4553 5445 520D 4554 4845"            /* ESSAYESTERETHE */	$"520D 4554 4849 430D 4554 484F 530D 4554"            /* RETHICETHOSET */	$"5544 450D 4556 4144 450D 4556 454E 540D"            /* UDEEVADEEVENT */	$"4556 4552 590D 4556 4943 540D 4556 4F4B"            /* EVERYEVICTEVOK */	$"450D 4558 4143 540D 4558 414C 540D 4558"            /* EEXACTEXALTEX */	$"4345 4C0D 4558 4552 540D 4558 494C 450D"            /* CELEXERTEXILE */	$"4558 4953 540D 4558 5045 4C0D 4558 544F"            /* EXISTEXPELEXTO */	$"4C0D 4558 5452 410D 4558 554C 540D 4559"            /* LEXTRAEXULTEY */	$"494E 470D 4641 424C 450D 4641 4345 540D"            /* INGFABLEFACET */	$"4641 494E 540D 4641 4952 590D 4641 4954"            /* FAINTFAIRYFAIT */	$"480D 4641 4C53 450D 4641 4E43 590D 4641"            /* HFALSEFANCYFA */	$"4E4E 590D 4641 5243 450D 4641 5441 4C0D"            /* NNYFARCEFATAL */	$"4641 5454 590D 4641 554C 540D 4641 554E"            /* FATTYFAULTFAUN */	$"410D 4641 564F 520D 4645 4153 540D 4645"            /* AFAVORFEASTFE */	$"4341 4C0D 4645 4947 4E0D 4645 4C4C 410D"            /* CALFEIGNFELLA */	$"4645 4C4F 4E0D 4645 4D4D 450D 4645 4D55"            /* FELONFEMMEFEMU */	$"520D 4645 4E43 450D 4645 5241 4C0D 4645"            /* RFENCEFERALFE */	$"5252 590D 4645 5441 4C0D 4645 5443 480D"            /* RRYFETALFETCH */	$"4645 5449 440D 4645 5455 530D 4645 5645"            /* FETIDFETUSFEVE */	$"520D 4645 5745 520D 4649 4245 520D 4649"            /* RFEWERFIBERFI */	$"4355 530D 4649 454C 440D 4649 454E 440D"            /* CUSFIELDFIEND */	$"4649 4552 590D 4649 4654 480D 4649 4654"            /* FIERYFIFTHFIFT */	$"590D 4649 4748 540D 4649 4C45 520D 4649"            /* YFIGHTFILERFI */	$"4C45 540D 4649 4C4C 590D 4649 4C4D 590D"            /* LETFILLYFILMY */	$"4649 4C54 480D 4649 4E41 4C0D 4649 4E43"            /* FILTHFINALFINC */	$"480D 4649 4E45 520D 4649 5253 540D 4649"            /* HFINERFIRSTFI */	$"5348 590D 4649 5845 520D 4649 5A5A 590D"            /* SHYFIXERFIZZY */	$"464A 4F52 440D 464C 4143 4B0D 464C 4149"            /* FJORDFLACKFLAI */	$"4C0D 464C 4149 520D 464C 414B 450D 464C"            /* LFLAIRFLAKEFL */	$"414B 590D 464C 414D 450D 464C 414E 4B0D"            /* AKYFLAMEFLANK */	$"464C 4152 450D 464C 4153 480D 464C 4153"            /* FLAREFLASHFLAS */	$"4B0D 464C 4543 4B0D 464C 4545 540D 464C"            /* KFLECKFLEETFL */	$"4553 480D 464C 4943 4B0D 464C 4945 520D"            /* ESHFLICKFLIER */	$"464C 494E 470D 464C 494E 540D 464C 4952"            /* FLINGFLINTFLIR */	$"540D 464C 4F41 540D 464C 4F43 4B0D 464C"            /* TFLOATFLOCKFL */	$"4F4F 440D 464C 4F4F 520D 464C 4F52 410D"            /* OODFLOORFLORA */	$"464C 4F53 530D 464C 4F55 520D 464C 4F55"            /* FLOSSFLOURFLOU */	$"540D 464C 4F57 4E0D 464C 5546 460D 464C"            /* TFLOWNFLUFFFL */	$"5549 440D 464C 554B 450D 464C 554D 450D"            /* UIDFLUKEFLUME */	$"464C 554E 470D 464C 554E 4B0D 464C 5553"            /* FLUNGFLUNKFLUS */	$"480D 464C 5554 450D 464C 5945 520D 464F"            /* HFLUTEFLYERFO */	$"414D 590D 464F 4341 4C0D 464F 4355 530D"            /* AMYFOCALFOCUS */	$"464F 4747 590D 464F 4953 540D 464F 4C49"            /* FOGGYFOISTFOLI */	$"4F0D 464F 4C4C 590D 464F 5241 590D 464F"            /* OFOLLYFORAYFO */	$"5243 450D 464F 5247 450D 464F 5247 4F0D"            /* RCEFORGEFORGO */	$"464F 5254 450D 464F 5254 480D 464F 5254"            /* FORTEFORTHFORT */	$"590D 464F 5255 4D0D 464F 554E 440D 464F"            /* YFORUMFOUNDFO */	$"5945 520D 4652 4149 4C0D 4652 414D 450D"            /* YERFRAILFRAME */	$"4652 414E 4B0D 4652 4155 440D 4652 4541"            /* FRANKFRAUDFREA */	$"4B0D 4652 4545 440D 4652 4545 520D 4652"            /* KFREEDFREERFR */	$"4553 480D 4652 4941 520D 4652 4945 440D"            /* ESHFRIARFRIED */	$"4652 494C 4C0D 4652 4953 4B0D 4652 4954"            /* FRILLFRISKFRIT */	$"5A0D 4652 4F43 4B0D 4652 4F4E 440D 4652"            /* ZFROCKFRONDFR */	$"4F4E 540D 4652 4F53 540D 4652 4F54 480D"            /* ONTFROSTFROTH */	$"4652 4F57 4E0D 4652 4F5A 450D 4652 5549"            /* FROWNFROZEFRUI */	$"540D 4655 4447 450D 4655 4755 450D 4655"            /* TFUDGEFUGUEFU */	$"4C4C 590D 4655 4E47 490D 4655 4E4B 590D"            /* LLYFUNGIFUNKY */	$"4655 4E4E 590D 4655 524F 520D 4655 5252"            /* FUNNYFURORFURR */	$"590D 4655 5353 590D 4655 5A5A 590D 4741"            /* YFUSSYFUZZYGA */	$"4646 450D 4741 494C 590D 4741 4D45 520D"            /* FFEGAILYGAMER */	$"4741 4D4D 410D 4741 4D55 540D 4741 5353"            /* GAMMAGAMUTGASS */	$"590D 4741 5544 590D 4741 5547 450D 4741"            /* YGAUDYGAUGEGA */	$"554E 540D 4741 555A 450D 4741 5645 4C0D"            /* UNTGAUZEGAVEL */	$"4741 574B 590D 4741 5945 520D 4741 594C"            /* GAWKYGAYERGAYL */	$"590D 4741 5A45 520D 4745 434B 4F0D 4745"            /* YGAZERGECKOGE */	$"454B 590D 4745 4553 450D 4745 4E49 450D"            /* EKYGEESEGENIE */	$"4745 4E52 450D 4748 4F53 540D 4748 4F55"            /* GENREGHOSTGHOU */	$"4C0D 4749 414E 540D 4749 4444 590D 4749"            /* LGIANTGIDDYGI */	$"5053 590D 4749 524C 590D 4749 5254 480D"            /* PSYGIRLYGIRTH */	$"4749 5645 4E0D 4749 5645 520D 474C 4144"            /* GIVENGIVERGLAD */	$"450D 474C 414E 440D 474C 4152 450D 474C"            /* EGLANDGLAREGL */	$"4153 530D 474C 415A 450D 474C 4541 4D0D"            /* ASSGLAZEGLEAM */	$"474C 4541 4E0D 474C 4944 450D 474C 494E"            /* GLEANGLIDEGLIN */	$"540D 474C 4F41 540D 474C 4F42 450D 474C"            /* TGLOATGLOBEGL */	$"4F4F 4D0D 474C 4F52 590D 474C 4F53 530D"            /* OOMGLORYGLOSS */	$"474C 4F56 450D 474C 5950 480D 474E 4153"            /* GLOVEGLYPHGNAS */	$"480D 474E 4F4D 450D 474F 444C 590D 474F"            /* HGNOMEGODLYGO */	$"494E 470D 474F 4C45 4D0D 474F 4C4C 590D"            /* INGGOLEMGOLLY */	$"474F 4E41 440D 474F 4E45 520D 474F 4F44"            /* GONADGONERGOOD */	$"590D 474F 4F45 590D 474F 4F46 590D 474F"            /* YGOOEYGOOFYGO */	$"4F53 450D 474F 5247 450D 474F 5547 450D"            /* OSEGORGEGOUGE */	$"474F 5552 440D 4752 4143 450D 4752 4144"            /* GOURDGRACEGRAD */	$"450D 4752 4146 540D 4752 4149 4C0D 4752"            /* EGRAFTGRAILGR */	$"4149 4E0D 4752 414E 440D 4752 414E 540D"            /* AINGRANDGRANT */	$"4752 4150 450D 4752 4150 480D 4752 4153"            /* GRAPEGRAPHGRAS */	$"500D 4752 4153 530D 4752 4154 450D 4752"            /* PGRASSGRATEGR */	$"4156 450D 4752 4156 590D 4752 415A 450D"            /* AVEGRAVYGRAZE */	$"4752 4541 540D 4752 4545 440D 4752 4545"            /* GREATGREEDGREE */	$"4E0D 4752 4545 540D 4752 4945 460D 4752"            /* NGREETGRIEFGR */	$"494C 4C0D 4752 494D 450D 4752 494D 590D"            /* ILLGRIMEGRIMY */	$"4752 494E 440D 4752 4950 450D 4752 4F41"            /* GRINDGRIPEGROA */	$"4E0D 4752 4F49 4E0D 4752 4F4F 4D0D 4752"            /* NGROINGROOMGR */	$"4F50 450D 4752 4F53 530D 4752 4F55 500D"            /* OPEGROSSGROUP */	$"4752 4F55 540D 4752 4F56 450D 4752 4F57"            /* GROUTGROVEGROW */	$"4C0D 4752 4F57 4E0D 4752 5545 4C0D 4752"            /* LGROWNGRUELGR */	$"5546 460D 4752 554E 540D 4755 4152 440D"            /* UFFGRUNTGUARD */	$"4755 4156 410D 4755 4553 530D 4755 4553"            /* GUAVAGUESSGUES */	$"540D 4755 4944 450D 4755 494C 440D 4755"            /* TGUIDEGUILDGU */	$"494C 450D 4755 494C 540D 4755 4953 450D"            /* ILEGUILTGUISE */	$"4755 4C43 480D 4755 4C4C 590D 4755 4D42"            /* GULCHGULLYGUMB */	$"4F0D 4755 4D4D 590D 4755 5050 590D 4755"            /* OGUMMYGUPPYGU */	$"5354 4F0D 4755 5354 590D 4759 5053 590D"            /* STOGUSTYGYPSY */	$"4841 4249 540D 4841 4952 590D 4841 4C56"            /* HABITHAIRYHALV */	$"450D 4841 4E44 590D 4841 5050 590D 4841"            /* EHANDYHAPPYHA */	$"5244 590D 4841 5245 4D0D 4841 5250 590D"            /* RDYHAREMHARPY */	$"4841 5252 590D 4841 5253 480D 4841 5354"            /* HARRYHARSHHAST */	$"450D 4841 5354 590D 4841 5443 480D 4841"            /* EHASTYHATCHHA */	$"5445 520D 4841 554E 540D 4841 5554 450D"            /* TERHAUNTHAUTE */	$"4841 5645 4E0D 4841 564F 430D 4841 5A45"            /* HAVENHAVOCHAZE */	$"4C0D 4845 4144 590D 4845 4152 440D 4845"            /* LHEADYHEARDHE */	$"4152 540D 4845 4154 480D 4845 4156 450D"            /* ARTHEATHHEAVE */	$"4845 4156 590D 4845 4447 450D 4845 4654"            /* HEAVYHEDGEHEFT */	$"590D 4845 4953 540D 4845 4C49 580D 4845"            /* YHEISTHELIXHE */	$"4C4C 4F0D 4845 4E43 450D 4845 524F 4E0D"            /* LLOHENCEHERON */	$"4849 4C4C 590D 4849 4E47 450D 4849 5050"            /* HILLYHINGEHIPP */	$"4F0D 4849 5050 590D 4849 5443 480D 484F"            /* OHIPPYHITCHHO */	$"4152 440D 484F 4242 590D 484F 4953 540D"            /* ARDHOBBYHOIST */	$"484F 4C4C 590D 484F 4D45 520D 484F 4E45"            /* HOLLYHOMERHONE */	$"590D 484F 4E4F 520D 484F 5244 450D 484F"            /* YHONORHORDEHO */	$"524E 590D 484F 5253 450D 484F 5445 4C0D"            /* RNYHORSEHOTEL */	$"484F 544C 590D 484F 554E 440D 484F 5553"            /* HOTLYHOUNDHOUS */	$"450D 484F 5645 4C0D 484F 5645 520D 484F"            /* EHOVELHOVERHO */	$"5744 590D 4855 4D41 4E0D 4855 4D49 440D"            /* WDYHUMANHUMID */	$"4855 4D4F 520D 4855 4D50 480D 4855 4D55"            /* HUMORHUMPHHUMU */	$"530D 4855 4E43 480D 4855 4E4B 590D 4855"            /* SHUNCHHUNKYHU */	$"5252 590D 4855 534B 590D 4855 5353 590D"            /* RRYHUSKYHUSSY */	$"4855 5443 480D 4859 4452 4F0D 4859 454E"            /* HUTCHHYDROHYEN */	$"410D 4859 4D45 4E0D 4859 5045 520D 4943"            /* AHYMENHYPERIC */	$"494C 590D 4943 494E 470D 4944 4541 4C0D"            /* ILYICINGIDEAL */	$"4944 494F 4D0D 4944 494F 540D 4944 4C45"            /* IDIOMIDIOTIDLE */	$"520D 4944 594C 4C0D 4947 4C4F 4F0D 494C"            /* RIDYLLIGLOOIL */	$"4941 430D 494D 4147 450D 494D 4255 450D"            /* IACIMAGEIMBUE */	$"494D 5045 4C0D 494D 504C 590D 494E 414E"            /* IMPELIMPLYINAN */	$"450D 494E 424F 580D 494E 4355 520D 494E"            /* EINBOXINCURIN */	$"4445 580D 494E 4550 540D 494E 4552 540D"            /* DEXINEPTINERT */	$"494E 4645 520D 494E 474F 540D 494E 4C41"            /* INFERINGOTINLA */	$"590D 494E 4C45 540D 494E 4E45 520D 494E"            /* YINLETINNERIN */	$"5055 540D 494E 5445 520D 494E 5452 4F0D"            /* PUTINTERINTRO */	$"494F 4E49 430D 4952 4154 450D 4952 4F4E"            /* IONICIRATEIRON */	$"590D 4953 4C45 540D 4953 5355 450D 4954"            /* YISLETISSUEIT */	$"4348 590D 4956 4F52 590D 4A41 554E 540D"            /* CHYIVORYJAUNT */	$"4A41 5A5A 590D 4A45 4C4C 590D 4A45 524B"            /* JAZZYJELLYJERK */	$"590D 4A45 5454 590D 4A45 5745 4C0D 4A49"            /* YJETTYJEWELJI */	$"4646 590D 4A4F 494E 540D 4A4F 4953 540D"            /* FFYJOINTJOIST */	$"4A4F 4B45 520D 4A4F 4C4C 590D 4A4F 5553"            /* JOKERJOLLYJOUS */	$"540D 4A55 4447 450D 4A55 4943 450D 4A55"            /* TJUDGEJUICEJU */	$"4943 590D 4A55 4D42 4F0D 4A55 4D50 590D"            /* ICYJUMBOJUMPY */	$"4A55 4E54 410D 4A55 4E54 4F0D 4A55 524F"            /* JUNTAJUNTOJURO */	$"520D 4B41 5050 410D 4B41 524D 410D 4B41"            /* RKAPPAKARMAKA */	$"5941 4B0D 4B45 4241 420D 4B48 414B 490D"            /* YAKKEBABKHAKI */	$"4B49 4E4B 590D 4B49 4F53 4B0D 4B49 5454"            /* KINKYKIOSKKITT */	$"590D 4B4E 4143 4B0D 4B4E 4156 450D 4B4E"            /* YKNACKKNAVEKN */	$"4541 440D 4B4E 4545 440D 4B4E 4545 4C0D"            /* EADKNEEDKNEEL */	$"4B4E 454C 540D 4B4E 4946 450D 4B4E 4F43"            /* KNELTKNIFEKNOC */	$"4B0D 4B4E 4F4C 4C0D 4B4E 4F57 4E0D 4B4F"            /* KKNOLLKNOWNKO */	$"414C 410D 4B52 494C 4C0D 4C41 4245 4C0D"            /* ALAKRILLLABEL */	$"4C41 424F 520D 4C41 4445 4E0D 4C41 444C"            /* LABORLADENLADL */	$"450D 4C41 4745 520D 4C41 4E43 450D 4C41"            /* ELAGERLANCELA */	$"4E4B 590D 4C41 5045 4C0D 4C41 5053 450D"            /* NKYLAPELLAPSE */	$"4C41 5247 450D 4C41 5256 410D 4C41 5353"            /* LARGELARVALASS */	$"4F0D 4C41 5443 480D 4C41 5445 520D 4C41"            /* OLATCHLATERLA */	$"5448 450D 4C41 5454 450D 4C41 5547 480D"            /* THELATTELAUGH */	$"4C41 5945 520D 4C45 4143 480D 4C45 4146"            /* LAYERLEACHLEAF */	$"590D 4C45 414B 590D 4C45 414E 540D 4C45"            /* YLEAKYLEANTLE */	$"4150 540D 4C45 4152 4E0D 4C45 4153 450D"            /* APTLEARNLEASE */	$"4C45 4153 480D 4C45 4153 540D 4C45 4156"            /* LEASHLEASTLEAV */	$"450D 4C45 4447 450D 4C45 4543 480D 4C45"            /* ELEDGELEECHLE */	$"4552 590D 4C45 4654 590D 4C45 4741 4C0D"            /* ERYLEFTYLEGAL */	$"4C45 4747 590D 4C45 4D4F 4E0D 4C45 4D55"            /* LEGGYLEMONLEMU */	$"520D 4C45 5045 520D 4C45 5645 4C0D 4C45"            /* RLEPERLEVELLE */	$"5645 520D 4C49 4245 4C0D 4C49 4547 450D"            /* VERLIBELLIEGE */	$"4C49 4748 540D 4C49 4B45 4E0D 4C49 4C41"            /* LIGHTLIKENLILA */	$"430D 4C49 4D42 4F0D 4C49 4D49 540D 4C49"            /* CLIMBOLIMITLI */	$"4E45 4E0D 4C49 4E45 520D 4C49 4E47 4F0D"            /* NENLINERLINGO */	$"4C49 5049 440D 4C49 5448 450D 4C49 5645"            /* LIPIDLITHELIVE */	$"520D 4C49 5649 440D 4C4C 414D 410D 4C4F"            /* RLIVIDLLAMALO */	$"414D 590D 4C4F 4154 480D 4C4F 4242 590D"            /* AMYLOATHLOBBY */	$"4C4F 4341 4C0D 4C4F 4355 530D 4C4F 4447"            /* LOCALLOCUSLODG */	$"450D 4C4F 4654 590D 4C4F 4749 430D 4C4F"            /* ELOFTYLOGICLO */	$"4749 4E0D 4C4F 4F50 590D 4C4F 4F53 450D"            /* GINLOOPYLOOSE */	$"4C4F 5252 590D 4C4F 5345 520D 4C4F 5553"            /* LORRYLOSERLOUS */	$"450D 4C4F 5553 590D 4C4F 5645 520D 4C4F"            /* ELOUSYLOVERLO */	$"5745 520D 4C4F 574C 590D 4C4F 5941 4C0D"            /* WERLOWLYLOYAL */	$"4C55 4349 440D 4C55 434B 590D 4C55 4D45"            /* LUCIDLUCKYLUME */	$"4E0D 4C55 4D50 590D 4C55 4E41 520D 4C55"            /* NLUMPYLUNARLU */	$"4E43 480D 4C55 4E47 450D 4C55 5055 530D"            /* NCHLUNGELUPUS */	$"4C55 5243 480D 4C55 5249 440D 4C55 5354"            /* LURCHLURIDLUST */	$"590D 4C59 494E 470D 4C59 4D50 480D 4C59"            /* YLYINGLYMPHLY */	$"5249 430D 4D41 4341 570D 4D41 4348 4F0D"            /* RICMACAWMACHO */	$"4D41 4352 4F0D 4D41 4441 4D0D 4D41 444C"            /* MACROMADAMMADL */	$"590D 4D41 4649 410D 4D41 4749 430D 4D41"            /* YMAFIAMAGICMA */	$"474D 410D 4D41 495A 450D 4D41 4A4F 520D"            /* GMAMAIZEMAJOR */	$"4D41 4B45 520D 4D41 4D42 4F0D 4D41 4D4D"            /* MAKERMAMBOMAMM */	$"410D 4D41 4D4D 590D 4D41 4E47 410D 4D41"            /* AMAMMYMANGAMA */	$"4E47 450D 4D41 4E47 4F0D 4D41 4E47 590D"            /* NGEMANGOMANGY */	$"4D41 4E49 410D 4D41 4E49 430D 4D41 4E4C"            /* MANIAMANICMANL */	$"590D 4D41 4E4F 520D 4D41 504C 450D 4D41"            /* YMANORMAPLEMA */	$"5243 480D 4D41 5252 590D 4D41 5253 480D"            /* RCHMARRYMARSH */	$"4D41 534F 4E0D 4D41 5353 450D 4D41 5443"            /* MASONMASSEMATC */	$"480D 4D41 5445 590D 4D41 5556 450D 4D41"            /* HMATEYMAUVEMA */	$"5849 4D0D 4D41 5942 450D 4D41 594F 520D"            /* XIMMAYBEMAYOR */	$"4D45 414C 590D 4D45 414E 540D 4D45 4154"            /* MEALYMEANTMEAT */	$"590D 4D45 4343 410D 4D45 4441 4C0D 4D45"            /* YMECCAMEDALME */	$"4449 410D 4D45 4449 430D 4D45 4C45 450D"            /* DIAMEDICMELEE */	$"4D45 4C4F 4E0D 4D45 5243 590D 4D45 5247"            /* MELONMERCYMERG */	$"450D 4D45 5249 540D 4D45 5252 590D 4D45"            /* EMERITMERRYME */	$"5441 4C0D 4D45 5445 520D 4D45 5452 4F0D"            /* TALMETERMETRO */	$"4D49 4352 4F0D 4D49 4447 450D 4D49 4453"            /* MICROMIDGEMIDS */	$"540D 4D49 4748 540D 4D49 4C4B 590D 4D49"            /* TMIGHTMILKYMI */	$"4D49 430D 4D49 4E43 450D 4D49 4E45 520D"            /* MICMINCEMINER */	$"4D49 4E49 4D0D 4D49 4E4F 520D 4D49 4E54"            /* MINIMMINORMINT */	$"590D 4D49 4E55 530D 4D49 5254 480D 4D49"            /* YMINUSMIRTHMI */	$"5345 520D 4D49 5353 590D 4D4F 4348 410D"            /* SERMISSYMOCHA */	$"4D4F 4441 4C0D 4D4F 4445 4C0D 4D4F 4445"            /* MODALMODELMODE */	$"4D0D 4D4F 4755 4C0D 4D4F 4953 540D 4D4F"            /* MMOGULMOISTMO */	$"4C41 520D 4D4F 4C44 590D 4D4F 4E45 590D"            /* LARMOLDYMONEY */	$"4D4F 4E54 480D 4D4F 4F44 590D 4D4F 4F53"            /* MONTHMOODYMOOS */	$"450D 4D4F 5241 4C0D 4D4F 524F 4E0D 4D4F"            /* EMORALMORONMO */	$"5250 480D 4D4F 5353 590D 4D4F 5445 4C0D"            /* RPHMOSSYMOTEL */	$"4D4F 5449 460D 4D4F 544F 520D 4D4F 5454"            /* MOTIFMOTORMOTT */	$"4F0D 4D4F 554C 540D 4D4F 554E 440D 4D4F"            /* OMOULTMOUNDMO */	$"554E 540D 4D4F 5552 4E0D 4D4F 5553 450D"            /* UNTMOURNMOUSE */	$"4D4F 5554 480D 4D4F 5645 520D 4D4F 5649"            /* MOUTHMOVERMOVI */	$"450D 4D4F 5745 520D 4D55 434B 590D 4D55"            /* EMOWERMUCKYMU */	$"4355 530D 4D55 4444 590D 4D55 4C43 480D"            /* CUSMUDDYMULCH */	$"4D55 4D4D 590D 4D55 4E43 480D 4D55 5241"            /* MUMMYMUNCHMURA */	$"4C0D 4D55 524B 590D 4D55 5348 590D 4D55"            /* LMURKYMUSHYMU */	$"5349 430D 4D55 534B 590D 4D55 5354 590D"            /* SICMUSKYMUSTY */	$"4D59 5252 480D 4E41 4449 520D 4E41 4956"            /* MYRRHNADIRNAIV */	$"450D 4E41 4E4E 590D 4E41 5341 4C0D 4E41"            /* ENANNYNASALNA */	$"5354 590D 4E41 5441 4C0D 4E41 5641 4C0D"            /* STYNATALNAVAL */	$"4E41 5645 4C0D 4E45 4544 590D 4E45 4947"            /* NAVELNEEDYNEIG */	$"480D 4E45 5244 590D 4E45 5256 450D 4E45"            /* HNERDYNERVENE */	$"5645 520D 4E45 5745 520D 4E45 574C 590D"            /* VERNEWERNEWLY */	$"4E49 4345 520D 4E49 4348 450D 4E49 4543"            /* NICERNICHENIEC */	$"450D 4E49 4748 540D 4E49 4E4A 410D 4E49"            /* ENIGHTNINJANI */	$"4E4E 590D 4E49 4E54 480D 4E4F 424C 450D"            /* NNYNINTHNOBLE */	$"4E4F 424C 590D 4E4F 4953 450D 4E4F 4953"            /* NOBLYNOISENOIS */	$"590D 4E4F 4D41 440D 4E4F 4F53 450D 4E4F"            /* YNOMADNOOSENO */	$"5254 480D 4E4F 5345 590D 4E4F 5443 480D"            /* RTHNOSEYNOTCH */	$"4E4F 5645 4C0D 4E55 4447 450D 4E55 5253"            /* NOVELNUDGENURS */	$"450D 4E55 5454 590D 4E59 4C4F 4E0D 4E59"            /* ENUTTYNYLONNY */	$"4D50 480D 4F41 4B45 4E0D 4F42 4553 450D"            /* MPHOAKENOBESE */	$"4F43 4355 520D 4F43 4541 4E0D 4F43 5441"            /* OCCUROCEANOCTA */	$"4C0D 4F43 5445 540D 4F44 4445 520D 4F44"            /* LOCTETODDEROD */	$"444C 590D 4F46 4641 4C0D 4F46 4645 520D"            /* DLYOFFALOFFER */	$"4F46 5445 4E0D 4F4C 4445 4E0D 4F4C 4445"            /* OFTENOLDENOLDE */	$"520D 4F4C 4956 450D 4F4D 4252 450D 4F4D"            /* ROLIVEOMBREOM */	$"4547 410D 4F4E 494F 4E0D 4F4E 5345 540D"            /* EGAONIONONSET */	$"4F50 4552 410D 4F50 494E 450D 4F50 4955"            /* OPERAOPINEOPIU */	$"4D0D 4F50 5449 430D 4F52 4249 540D 4F52"            /* MOPTICORBITOR */	$"4445 520D 4F52 4741 4E0D 4F54 4845 520D"            /* DERORGANOTHER */	$"4F54 5445 520D 4F55 4748 540D 4F55 4E43"            /* OTTEROUGHTOUNC */	$"450D 4F55 5444 4F0D 4F55 5445 520D 4F55"            /* EOUTDOOUTEROU */	$"5447 4F0D 4F56 4152 590D 4F56 4154 450D"            /* TGOOVARYOVATE */	$"4F56 4552 540D 4F56 494E 450D 4F56 4F49"            /* OVERTOVINEOVOI */	$"440D 4F57 494E 470D 4F57 4E45 520D 4F58"            /* DOWINGOWNEROX */	$"4944 450D 4F5A 4F4E 450D 5041 4444 590D"            /* IDEOZONEPADDY */	$"5041 4741 4E0D 5041 494E 540D 5041 4C45"            /* PAGANPAINTPALE */	$"520D 5041 4C53 590D 5041 4E45 4C0D 5041"            /* RPALSYPANELPA */	$"4E49 430D 5041 4E53 590D 5041 5041 4C0D"            /* NICPANSYPAPAL */	$"5041 5045 520D 5041 5245 520D 5041 524B"            /* PAPERPARERPARK */	$"410D 5041 5252 590D 5041 5253 450D 5041"            /* APARRYPARSEPA */	$"5254 590D 5041 5354 410D 5041 5354 450D"            /* RTYPASTAPASTE */	$"5041 5354 590D 5041 5443 480D 5041 5449"            /* PASTYPATCHPATI */	$"4F0D 5041 5453 590D 5041 5454 590D 5041"            /* OPATSYPATTYPA */	$"5553 450D 5041 5945 450D 5041 5945 520D"            /* USEPAYEEPAYER */	$"5045 4143 450D 5045 4143 480D 5045 4152"            /* PEACEPEACHPEAR */	$"4C0D 5045 4341 4E0D 5045 4441 4C0D 5045"            /* LPECANPEDALPE */	$"4E41 4C0D 5045 4E43 450D 5045 4E4E 450D"            /* NALPENCEPENNE */	$"5045 4E4E 590D 5045 5243 480D 5045 5249"            /* PENNYPERCHPERI */	$"4C0D 5045 524B 590D 5045 534B 590D 5045"            /* LPERKYPESKYPE */	$"5354 4F0D 5045 5441 4C0D 5045 5454 590D"            /* STOPETALPETTY */	$"5048 4153 450D 5048 4F4E 450D 5048 4F4E"            /* PHASEPHONEPHON */	$"590D 5048 4F54 4F0D 5049 414E 4F0D 5049"            /* YPHOTOPIANOPI */	$"434B 590D 5049 4543 450D 5049 4554 590D"            /* CKYPIECEPIETY */	$"5049 4747 590D 5049 4C4F 540D 5049 4E43"            /* PIGGYPILOTPINC */	$"480D 5049 4E45 590D 5049 4E4B 590D 5049"            /* HPINEYPINKYPI */	$"4E54 4F0D 5049 5045 520D 5049 5155 450D"            /* NTOPIPERPIQUE */	$"5049 5443 480D 5049 5448 590D 5049 564F"            /* PITCHPITHYPIVO */	$"540D 5049 5845 4C0D 5049 5849 450D 5049"            /* TPIXELPIXIEPI */	$"5A5A 410D 504C 4143 450D 504C 4149 440D"            /* ZZAPLACEPLAID */	$"504C 4149 4E0D 504C 4149 540D 504C 414E"            /* PLAINPLAITPLAN */	$"450D 504C 414E 4B0D 504C 414E 540D 504C"            /* EPLANKPLANTPL */	$"4154 450D 504C 415A 410D 504C 4541 440D"            /* ATEPLAZAPLEAD */	$"504C 4541 540D 504C 4945 440D 504C 4945"            /* PLEATPLIEDPLIE */	$"520D 504C 5543 4B0D 504C 554D 420D 504C"            /* RPLUCKPLUMBPL */	$"554D 450D 504C 554D 500D 504C 554E 4B0D"            /* UMEPLUMPPLUNK */	$"504C 5553 480D 504F 4553 590D 504F 494E"            /* PLUSHPOESYPOIN */	$"540D 504F 4953 450D 504F 4B45 520D 504F"            /* TPOISEPOKERPO */	$"4C41 520D 504F 4C4B 410D 504F 4C59 500D"            /* LARPOLKAPOLYP */	$"504F 4F43 480D 504F 5050 590D 504F 5243"            /* POOCHPOPPYPORC */	$"480D 504F 5345 520D 504F 5349 540D 504F"            /* HPOSERPOSITPO */	$"5353 450D 504F 5543 480D 504F 554E 440D"            /* SSEPOUCHPOUND */	$"504F 5554 590D 504F 5745 520D 5052 414E"            /* POUTYPOWERPRAN */	$"4B0D 5052 4157 4E0D 5052 4545 4E0D 5052"            /* KPRAWNPREENPR */	$"4553 530D 5052 4943 450D 5052 4943 4B0D"            /* ESSPRICEPRICK */	$"5052 4944 450D 5052 4945 440D 5052 494D"            /* PRIDEPRIEDPRIM */	$"450D 5052 494D 4F0D 5052 494E 540D 5052"            /* EPRIMOPRINTPR */	$"494F 520D 5052 4953 4D0D 5052 4956 590D"            /* IORPRISMPRIVY */	$"5052 495A 450D 5052 4F42 450D 5052 4F4E"            /* PRIZEPROBEPRON */	$"450D 5052 4F4E 470D 5052 4F4F 460D 5052"            /* EPRONGPROOFPR */	$"4F53 450D 5052 4F55 440D 5052 4F56 450D"            /* OSEPROUDPROVE */	$"5052 4F57 4C0D 5052 4F58 590D 5052 5544"            /* PROWLPROXYPRUD */	$"450D 5052 554E 450D 5053 414C 4D0D 5055"            /* EPRUNEPSALMPU */	$"4249 430D 5055 4447 590D 5055 4646 590D"            /* BICPUDGYPUFFY */	$"5055 4C50 590D 5055 4C53 450D 5055 4E43"            /* PULPYPULSEPUNC */	$"480D 5055 5049 4C0D 5055 5050 590D 5055"            /* HPUPILPUPPYPU */	$"5245 450D 5055 5245 520D 5055 5247 450D"            /* REEPURERPURGE */	$"5055 5253 450D 5055 5348 590D 5055 5454"            /* PURSEPUSHYPUTT */	$"590D 5059 474D 590D 5155 4143 4B0D 5155"            /* YPYGMYQUACKQU */	$"4149 4C0D 5155 414B 450D 5155 414C 4D0D"            /* AILQUAKEQUALM */	$"5155 4152 4B0D 5155 4152 540D 5155 4153"            /* QUARKQUARTQUAS */	$"480D 5155 4153 490D 5155 4545 4E0D 5155"            /* HQUASIQUEENQU */	$"4545 520D 5155 454C 4C0D 5155 4552 590D"            /* EERQUELLQUERY */	$"5155 4553 540D 5155 4555 450D 5155 4943"            /* QUESTQUEUEQUIC */	$"4B0D 5155 4945 540D 5155 494C 4C0D 5155"            /* KQUIETQUILLQU */	$"494C 540D 5155 4952 4B0D 5155 4954 450D"            /* ILTQUIRKQUITE */	$"5155 4F54 410D 5155 4F54 450D 5155 4F54"            /* QUOTAQUOTEQUOT */	$"480D 5241 4242 490D 5241 4249 440D 5241"            /* HRABBIRABIDRA */	$"4345 520D 5241 4441 520D 5241 4449 490D"            /* CERRADARRADII */	$"5241 4449 4F0D 5241 494E 590D 5241 4953"            /* RADIORAINYRAIS */	$"450D 5241 4A41 480D 5241 4C4C 590D 5241"            /* ERAJAHRALLYRA */	$"4C50 480D 5241 4D45 4E0D 5241 4E43 480D"            /* LPHRAMENRANCH */	$"5241 4E44 590D 5241 4E47 450D 5241 5049"            /* RANDYRANGERAPI */	$"440D 5241 5245 520D 5241 5350 590D 5241"            /* DRARERRASPYRA */	$"5449 4F0D 5241 5454 590D 5241 5645 4E0D"            /* TIORATTYRAVEN */	$"5241 594F 4E0D 5241 5A4F 520D 5245 4143"            /* RAYONRAZORREAC */	$"480D 5245 4143 540D 5245 4144 590D 5245"            /* HREACTREADYRE */	$"414C 4D0D 5245 4152 4D0D 5245 4241 520D"            /* ALMREARMREBAR */	$"5245 4245 4C0D 5245 4255 530D 5245 4255"            /* REBELREBUSREBU */	$"540D 5245 4341 500D 5245 4355 520D 5245"            /* TRECAPRECURRE */	$"4355 540D 5245 4544 590D 5245 4645 520D"            /* CUTREEDYREFER */	$"5245 4649 540D 5245 4741 4C0D 5245 4841"            /* REFITREGALREHA */	$"420D 5245 4947 4E0D 5245 4C41 580D 5245"            /* BREIGNRELAXRE */	$"4C41 590D 5245 4C49 430D 5245 4D49 540D"            /* LAYRELICREMIT */	$"5245 4E41 4C0D 5245 4E45 570D 5245 5041"            /* RENALRENEWREPA */	$"590D 5245 5045 4C0D 5245 504C 590D 5245"            /* YREPELREPLYRE */	$"5255 4E0D 5245 5345 540D 5245 5349 4E0D"            /* RUNRESETRESIN */	$"5245 5443 480D 5245 5452 4F0D 5245 5452"            /* RETCHRETRORETR */	$"590D 5245 5553 450D 5245 5645 4C0D 5245"            /* YREUSEREVELRE */	$"5655 450D 5248 494E 4F0D 5248 594D 450D"            /* VUERHINORHYME */	$"5249 4445 520D 5249 4447 450D 5249 464C"            /* RIDERRIDGERIFL */	$"450D 5249 4748 540D 5249 4749 440D 5249"            /* ERIGHTRIGIDRI */	$"474F 520D 5249 4E53 450D 5249 5045 4E0D"            /* GORRINSERIPEN */	$"5249 5045 520D 5249 5345 4E0D 5249 5345"            /* RIPERRISENRISE */	$"520D 5249 534B 590D 5249 5641 4C0D 5249"            /* RRISKYRIVALRI */	$"5645 520D 5249 5645 540D 524F 4143 480D"            /* VERRIVETROACH */	$"524F 4153 540D 524F 4249 4E0D 524F 424F"            /* ROASTROBINROBO */	$"540D 524F 434B 590D 524F 4445 4F0D 524F"            /* TROCKYRODEORO */	$"4745 520D 524F 4755 450D 524F 4F4D 590D"            /* GERROGUEROOMY */	$"524F 4F53 540D 524F 544F 520D 524F 5547"            /* ROOSTROTORROUG */	$"450D 524F 5547 480D 524F 554E 440D 524F"            /* EROUGHROUNDRO */	$"5553 450D 524F 5554 450D 524F 5645 520D"            /* USEROUTEROVER */	$"524F 5744 590D 524F 5745 520D 524F 5941"            /* ROWDYROWERROYA */	$"4C0D 5255 4444 590D 5255 4445 520D 5255"            /* LRUDDYRUDERRU */	$"4742 590D 5255 4C45 520D 5255 4D42 410D"            /* GBYRULERRUMBA */	$"5255 4D4F 520D 5255 5045 450D 5255 5241"            /* RUMORRUPEERURA */	$"4C0D 5255 5354 590D 5341 444C 590D 5341"            /* LRUSTYSADLYSA */	$"4645 520D 5341 494E 540D 5341 4C41 440D"            /* FERSAINTSALAD */	$"5341 4C4C 590D 5341 4C4F 4E0D 5341 4C53"            /* SALLYSALONSALS */	$"410D 5341 4C54 590D 5341 4C56 450D 5341"            /* ASALTYSALVESA */	$"4C56 4F0D 5341 4E44 590D 5341 4E45 520D"            /* LVOSANDYSANER */	$"5341 5050 590D 5341 5353 590D 5341 5449"            /* SAPPYSASSYSATI */	$"4E0D 5341 5459 520D 5341 5543 450D 5341"            /* NSATYRSAUCESA */	$"5543 590D 5341 554E 410D 5341 5554 450D"            /* UCYSAUNASAUTE */	$"5341 564F 520D 5341 564F 590D 5341 5656"            /* SAVORSAVOYSAVV */	$"590D 5343 414C 440D 5343 414C 450D 5343"            /* YSCALDSCALESC */	$"414C 500D 5343 414C 590D 5343 414D 500D"            /* ALPSCALYSCAMP */	$"5343 414E 540D 5343 4152 450D 5343 4152"            /* SCANTSCARESCAR */	$"460D 5343 4152 590D 5343 454E 450D 5343"            /* FSCARYSCENESC */	$"454E 540D 5343 494F 4E0D 5343 4F46 460D"            /* ENTSCIONSCOFF */	$"5343 4F4C 440D 5343 4F4E 450D 5343 4F4F"            /* SCOLDSCONESCOO */	$"500D 5343 4F50 450D 5343 4F52 450D 5343"            /* PSCOPESCORESC */	$"4F52 4E0D 5343 4F55 520D 5343 4F55 540D"            /* ORNSCOURSCOUT */	$"5343 4F57 4C0D 5343 5241 4D0D 5343 5241"            /* SCOWLSCRAMSCRA */	$"500D 5343 5245 450D 5343 5245 570D 5343"            /* PSCREESCREWSC */	$"5255 420D 5343 5255 4D0D 5343 5542 410D"            /* RUBSCRUMSCUBA */	$"5345 4441 4E0D 5345 4544 590D 5345 4755"            /* SEDANSEEDYSEGU */	$"450D 5345 495A 450D 5345 4D45 4E0D 5345"            /* ESEIZESEMENSE */	$"4E53 450D 5345 5049 410D 5345 5249 460D"            /* NSESEPIASERIF */	$"5345 5255 4D0D 5345 5256 450D 5345 5455"            /* SERUMSERVESETU */	$"500D 5345 5645 4E0D 5345 5645 520D 5345"            /* PSEVENSEVERSE */	$"5745 520D 5348 4143 4B0D 5348 4144 450D"            /* WERSHACKSHADE */	$"5348 4144 590D 5348 4146 540D 5348 414B"            /* SHADYSHAFTSHAK */	$"450D 5348 414B 590D 5348 414C 450D 5348"            /* ESHAKYSHALESH */	$"414C 4C0D 5348 414C 540D 5348 414D 450D"            /* ALLSHALTSHAME */	$"5348 414E 4B0D 5348 4150 450D 5348 4152"            /* SHANKSHAPESHAR */	$"440D 5348 4152 450D 5348 4152 4B0D 5348"            /* DSHARESHARKSH */	$"4152 500D 5348 4156 450D 5348 4157 4C0D"            /* ARPSHAVESHAWL */	$"5348 4541 520D 5348 4545 4E0D 5348 4545"            /* SHEARSHEENSHEE */	$"500D 5348 4545 520D 5348 4545 540D 5348"            /* PSHEERSHEETSH */	$"4549 4B0D 5348 454C 460D 5348 454C 4C0D"            /* EIKSHELFSHELL */	$"5348 4945 440D 5348 4946 540D 5348 494E"            /* SHIEDSHIFTSHIN */	$"450D 5348 494E 590D 5348 4952 450D 5348"            /* ESHINYSHIRESH */	$"4952 4B0D 5348 4952 540D 5348 4F41 4C0D"            /* IRKSHIRTSHOAL */	$"5348 4F43 4B0D 5348 4F4E 450D 5348 4F4F"            /* SHOCKSHONESHOO */	$"4B0D 5348 4F4F 540D 5348 4F52 450D 5348"            /* KSHOOTSHORESH */	$"4F52 4E0D 5348 4F52 540D 5348 4F55 540D"            /* ORNSHORTSHOUT */	$"5348 4F56 450D 5348 4F57 4E0D 5348 4F57"            /* SHOVESHOWNSHOW */	$"590D 5348 5245 570D 5348 5255 420D 5348"            /* YSHREWSHRUBSH */	$"5255 470D 5348 5543 4B0D 5348 554E 540D"            /* RUGSHUCKSHUNT */	$"5348 5553 480D 5348 594C 590D 5349 4547"            /* SHUSHSHYLYSIEG */	$"450D 5349 4556 450D 5349 4748 540D 5349"            /* ESIEVESIGHTSI */	$"474D 410D 5349 4C4B 590D 5349 4C4C 590D"            /* GMASILKYSILLY */	$"5349 4E43 450D 5349 4E45 570D 5349 4E47"            /* SINCESINEWSING */	$"450D 5349 5245 4E0D 5349 5353 590D 5349"            /* ESIRENSISSYSI */	$"5854 480D 5349 5854 590D 534B 4154 450D"            /* XTHSIXTYSKATE */	$"534B 4945 520D 534B 4946 460D 534B 494C"            /* SKIERSKIFFSKIL */	$"4C0D 534B 494D 500D 534B 4952 540D 534B"            /* LSKIMPSKIRTSK */	$"554C 4B0D 534B 554C 4C0D 534B 554E 4B0D"            /* ULKSKULLSKUNK */	$"534C 4143 4B0D 534C 4149 4E0D 534C 414E"            /* SLACKSLAINSLAN */	$"470D 534C 414E 540D 534C 4153 480D 534C"            /* GSLANTSLASHSL */	$"4154 450D 534C 4545 4B0D 534C 4545 500D"            /* ATESLEEKSLEEP */	$"534C 4545 540D 534C 4550 540D 534C 4943"            /* SLEETSLEPTSLIC */	$"450D 534C 4943 4B0D 534C 4944 450D 534C"            /* ESLICKSLIDESL */	$"494D 450D 534C 494D 590D 534C 494E 470D"            /* IMESLIMYSLING */	$"534C 494E 4B0D 534C 4F4F 500D 534C 4F50"            /* SLINKSLOOPSLOP */	$"450D 534C 4F53 480D 534C 4F54 480D 534C"            /* ESLOSHSLOTHSL */	$"554D 500D 534C 554E 470D 534C 554E 4B0D"            /* UMPSLUNGSLUNK */	$"534C 5552 500D 534C 5553 480D 534C 594C"            /* SLURPSLUSHSLYL */	$"590D 534D 4143 4B0D 534D 414C 4C0D 534D"            /* YSMACKSMALLSM */	$"4152 540D 534D 4153 480D 534D 4541 520D"            /* ARTSMASHSMEAR */	$"534D 454C 4C0D 534D 454C 540D 534D 494C"            /* SMELLSMELTSMIL */	$"450D 534D 4952 4B0D 534D 4954 450D 534D"            /* ESMIRKSMITESM */	$"4954 480D 534D 4F43 4B0D 534D 4F4B 450D"            /* ITHSMOCKSMOKE */	$"534D 4F4B 590D 534D 4F54 450D 534E 4143"            /* SMOKYSMOTESNAC */	$"4B0D 534E 4149 4C0D 534E 414B 450D 534E"            /* KSNAILSNAKESN */	$"414B 590D 534E 4152 450D 534E 4152 4C0D"            /* AKYSNARESNARL */	$"534E 4541 4B0D 534E 4545 520D 534E 4944"            /* SNEAKSNEERSNID */	$"450D 534E 4946 460D 534E 4950 450D 534E"            /* ESNIFFSNIPESN */	$"4F4F 500D 534E 4F52 450D 534E 4F52 540D"            /* OOPSNORESNORT */	$"534E 4F55 540D 534E 4F57 590D 534E 5543"            /* SNOUTSNOWYSNUC */	$"4B0D 534E 5546 460D 534F 4150 590D 534F"            /* KSNUFFSOAPYSO */	$"4245 520D 534F 4747 590D 534F 4C41 520D"            /* BERSOGGYSOLAR */	$"534F 4C49 440D 534F 4C56 450D 534F 4E41"            /* SOLIDSOLVESONA */	$"520D 534F 4E49 430D 534F 4F54 480D 534F"            /* RSONICSOOTHSO */	$"4F54 590D 534F 5252 590D 534F 554E 440D"            /* OTYSORRYSOUND */	$"534F 5554 480D 534F 5745 520D 5350 4143"            /* SOUTHSOWERSPAC */	$"450D 5350 4144 450D 5350 414E 4B0D 5350"            /* ESPADESPANKSP */	$"4152 450D 5350 4152 4B0D 5350 4153 4D0D"            /* ARESPARKSPASM */	$"5350 4157 4E0D 5350 4541 4B0D 5350 4541"            /* SPAWNSPEAKSPEA */	$"520D 5350 4543 4B0D 5350 4545 440D 5350"            /* RSPECKSPEEDSP */	$"454C 4C0D 5350 454C 540D 5350 454E 440D"            /* ELLSPELTSPEND */	$"5350 454E 540D 5350 4552 4D0D 5350 4943"            /* SPENTSPERMSPIC */	$"450D 5350 4943 590D 5350 4945 440D 5350"            /* ESPICYSPIEDSP */	$"4945 4C0D 5350 494B 450D 5350 494B 590D"            /* IELSPIKESPIKY */	$"5350 494C 4C0D 5350 494C 540D 5350 494E"            /* SPILLSPILTSPIN */	$"450D 5350 494E 590D 5350 4952 450D 5350"            /* ESPINYSPIRESP */	$"4954 450D 5350 4C41 540D 5350 4C49 540D"            /* ITESPLATSPLIT */	$"5350 4F49 4C0D 5350 4F4B 450D 5350 4F4F"            /* SPOILSPOKESPOO */	$"460D 5350 4F4F 4B0D 5350 4F4F 4C0D 5350"            /* FSPOOKSPOOLSP */	$"4F4F 4E0D 5350 4F52 450D 5350 4F52 540D"            /* OONSPORESPORT */	$"5350 4F55 540D 5350 5241 590D 5350 5245"            /* SPOUTSPRAYSPRE */	$"450D 5350 5249 470D 5350 554E 4B0D 5350"            /* ESPRIGSPUNKSP */	$"5552 4E0D 5350 5552 540D 5351 5541 440D"            /* URNSPURTSQUAD */	$"5351 5541 540D 5351 5549 420D 5354 4143"            /* SQUATSQUIBSTAC */	$"4B0D 5354 4146 460D 5354 4147 450D 5354"            /* KSTAFFSTAGEST */	$"4149 440D 5354 4149 4E0D 5354 4149 520D"            /* AIDSTAINSTAIR */	$"5354 414B 450D 5354 414C 450D 5354 414C"            /* STAKESTALESTAL */	$"4B0D 5354 414C 4C0D 5354 414D 500D 5354"            /* KSTALLSTAMPST */	$"414E 440D 5354 414E 4B0D 5354 4152 450D"            /* ANDSTANKSTARE */	$"5354 4152 4B0D 5354 4152 540D 5354 4153"            /* STARKSTARTSTAS */	$"480D 5354 4154 450D 5354 4156 450D 5354"            /* HSTATESTAVEST */	$"4541 440D 5354 4541 4B0D 5354 4541 4C0D"            /* EADSTEAKSTEAL */	$"5354 4541 4D0D 5354 4545 440D 5354 4545"            /* STEAMSTEEDSTEE */	$"4C0D 5354 4545 500D 5354 4545 520D 5354"            /* LSTEEPSTEERST */	$"4549 4E0D 5354 4552 4E0D 5354 4943 4B0D"            /* EINSTERNSTICK */	$"5354 4946 460D 5354 494C 4C0D 5354 494C"            /* STIFFSTILLSTIL */	$"540D 5354 494E 470D 5354 494E 4B0D 5354"            /* TSTINGSTINKST */	$"494E 540D 5354 4F43 4B0D 5354 4F49 430D"            /* INTSTOCKSTOIC */	$"5354 4F4B 450D 5354 4F4C 450D 5354 4F4D"            /* STOKESTOLESTOM */	$"500D 5354 4F4E 450D 5354 4F4E 590D 5354"            /* PSTONESTONYST */	$"4F4F 440D 5354 4F4F 4C0D 5354 4F4F 500D"            /* OODSTOOLSTOOP */	$"5354 4F52 450D 5354 4F52 4B0D 5354 4F52"            /* STORESTORKSTOR */	$"4D0D 5354 4F52 590D 5354 4F55 540D 5354"            /* MSTORYSTOUTST */	$"4F56 450D 5354 5241 500D 5354 5241 570D"            /* OVESTRAPSTRAW */	$"5354 5241 590D 5354 5249 500D 5354 5255"            /* STRAYSTRIPSTRU */	$"540D 5354 5543 4B0D 5354 5544 590D 5354"            /* TSTUCKSTUDYST */	$"5546 460D 5354 554D 500D 5354 554E 470D"            /* UFFSTUMPSTUNG */	$"5354 554E 4B0D 5354 554E 540D 5354 594C"            /* STUNKSTUNTSTYL */	$"450D 5355 4156 450D 5355 4741 520D 5355"            /* ESUAVESUGARSU */	$"494E 470D 5355 4954 450D 5355 4C4B 590D"            /* INGSUITESULKY */	$"5355 4C4C 590D 5355 4D41 430D 5355 4E4E"            /* SULLYSUMACSUNN */	$"590D 5355 5045 520D 5355 5245 520D 5355"            /* YSUPERSURERSU */	$"5247 450D 5355 524C 590D 5355 5348 490D"            /* RGESURLYSUSHI */	$"5357 414D 490D 5357 414D 500D 5357 4152"            /* SWAMISWAMPSWAR */	$"4D0D 5357 4153 480D 5357 4154 480D 5357"            /* MSWASHSWATHSW */	$"4541 520D 5357 4541 540D 5357 4545 500D"            /* EARSWEATSWEEP */	$"5357 4545 540D 5357 454C 4C0D 5357 4550"            /* SWEETSWELLSWEP */	$"540D 5357 4946 540D 5357 494C 4C0D 5357"            /* TSWIFTSWILLSW */	$"494E 450D 5357 494E 470D 5357 4952 4C0D"            /* INESWINGSWIRL */	$"5357 4953 480D 5357 4F4F 4E0D 5357 4F4F"            /* SWISHSWOONSWOO */	$"500D 5357 4F52 440D 5357 4F52 450D 5357"            /* PSWORDSWORESW */	$"4F52 4E0D 5357 554E 470D 5359 4E4F 440D"            /* ORNSWUNGSYNOD */	$"5359 5255 500D 5441 4242 590D 5441 424C"            /* SYRUPTABBYTABL */	$"450D 5441 424F 4F0D 5441 4349 540D 5441"            /* ETABOOTACITTA */	$"434B 590D 5441 4646 590D 5441 494E 540D"            /* CKYTAFFYTAINT */	$"5441 4B45 4E0D 5441 4B45 520D 5441 4C4C"            /* TAKENTAKERTALL */	$"590D 5441 4C4F 4E0D 5441 4D45 520D 5441"            /* YTALONTAMERTA */	$"4E47 4F0D 5441 4E47 590D 5441 5045 520D"            /* NGOTANGYTAPER */	$"5441 5049 520D 5441 5244 590D 5441 524F"            /* TAPIRTARDYTARO */	$"540D 5441 5354 450D 5441 5354 590D 5441"            /* TTASTETASTYTA */	$"5454 590D 5441 554E 540D 5441 574E 590D"            /* TTYTAUNTTAWNY */	$"5445 4143 480D 5445 4152 590D 5445 4153"            /* TEACHTEARYTEAS */	$"450D 5445 4444 590D 5445 4554 480D 5445"            /* ETEDDYTEETHTE */	$"4D50 4F0D 5445 4E45 540D 5445 4E4F 520D"            /* MPOTENETTENOR */	$"5445 4E53 450D 5445 4E54 480D 5445 5045"            /* TENSETENTHTEPE */	$"450D 5445 5049 440D 5445 5252 410D 5445"            /* ETEPIDTERRATE */	$"5253 450D 5445 5354 590D 5448 414E 4B0D"            /* RSETESTYTHANK */	$"5448 4546 540D 5448 4549 520D 5448 454D"            /* THEFTTHEIRTHEM */	$"450D 5448 4552 450D 5448 4553 450D 5448"            /* ETHERETHESETH */	$"4554 410D 5448 4943 4B0D 5448 4945 460D"            /* ETATHICKTHIEF */	$"5448 4947 480D 5448 494E 470D 5448 494E"            /* THIGHTHINGTHIN */	$"4B0D 5448 4952 440D 5448 4F4E 470D 5448"            /* KTHIRDTHONGTH */	$"4F52 4E0D 5448 4F53 450D 5448 5245 450D"            /* ORNTHOSETHREE */	$"5448 5245 570D 5448 524F 420D 5448 524F"            /* THREWTHROBTHRO */	$"570D 5448 5255 4D0D 5448 554D 420D 5448"            /* WTHRUMTHUMBTH */	$"554D 500D 5448 594D 450D 5449 4152 410D"            /* UMPTHYMETIARA */	$"5449 4249 410D 5449 4441 4C0D 5449 4745"            /* TIBIATIDALTIGE */	$"520D 5449 4748 540D 5449 4C44 450D 5449"            /* RTIGHTTILDETI */	$"4D45 520D 5449 4D49 440D 5449 5053 590D"            /* MERTIMIDTIPSY */	$"5449 5441 4E0D 5449 5448 450D 5449 544C"            /* TITANTITHETITL */	$"450D 544F 4153 540D 544F 4441 590D 544F"            /* ETOASTTODAYTO */	$"4444 590D 544F 4B45 4E0D 544F 4E41 4C0D"            /* DDYTOKENTONAL */	$"544F 4E47 410D 544F 4E49 430D 544F 4F54"            /* TONGATONICTOOT */	$"480D 544F 5041 5A0D 544F 5049 430D 544F"            /* HTOPAZTOPICTO */	$"5243 480D 544F 5253 4F0D 544F 5255 530D"            /* RCHTORSOTORUS */	$"544F 5441 4C0D 544F 5445 4D0D 544F 5543"            /* TOTALTOTEMTOUC */	$"480D 544F 5547 480D 544F 5745 4C0D 544F"            /* HTOUGHTOWELTO */	$"5745 520D 544F 5849 430D 544F 5849 4E0D"            /* WERTOXICTOXIN */	$"5452 4143 450D 5452 4143 4B0D 5452 4143"            /* TRACETRACKTRAC */	$"540D 5452 4144 450D 5452 4149 4C0D 5452"            /* TTRADETRAILTR */	$"4149 4E0D 5452 4149 540D 5452 414D 500D"            /* AINTRAITTRAMP */	$"5452 4153 480D 5452 4157 4C0D 5452 4541"            /* TRASHTRAWLTREA */	$"440D 5452 4541 540D 5452 454E 440D 5452"            /* DTREATTRENDTR */	$"4941 440D 5452 4941 4C0D 5452 4942 450D"            /* IADTRIALTRIBE */	$"5452 4943 450D 5452 4943 4B0D 5452 4945"            /* TRICETRICKTRIE */	$"440D 5452 4950 450D 5452 4954 450D 5452"            /* DTRIPETRITETR */	$"4F4C 4C0D 5452 4F4F 500D 5452 4F50 450D"            /* OLLTROOPTROPE */	$"5452 4F55 540D 5452 4F56 450D 5452 5543"            /* TROUTTROVETRUC */	$"450D 5452 5543 4B0D 5452 5545 520D 5452"            /* ETRUCKTRUERTR */	$"554C 590D 5452 554D 500D 5452 554E 4B0D"            /* ULYTRUMPTRUNK */	$"5452 5553 530D 5452 5553 540D 5452 5554"            /* TRUSSTRUSTTRUT */	$"480D 5452 5953 540D 5455 4241 4C0D 5455"            /* HTRYSTTUBALTU */	$"4245 520D 5455 4C49 500D 5455 4C4C 450D"            /* BERTULIPTULLE */	$"5455 4D4F 520D 5455 4E49 430D 5455 5242"            /* TUMORTUNICTURB */	$"4F0D 5455 544F 520D 5457 414E 470D 5457"            /* OTUTORTWANGTW */	$"4541 4B0D 5457 4545 440D 5457 4545 540D"            /* EAKTWEEDTWEET */	$"5457 4943 450D 5457 494E 450D 5457 4952"            /* TWICETWINETWIR */	$"4C0D 5457 4953 540D 5457 4958 540D 5459"            /* LTWISTTWIXTTY */	$"494E 470D 5544 4445 520D 554C 4345 520D"            /* INGUDDERULCER */	$"554C 5452 410D 554D 4252 410D 554E 434C"            /* ULTRAUMBRAUNCL */	$"450D 554E 4355 540D 554E 4445 520D 554E"            /* EUNCUTUNDERUN */	$"4449 440D 554E 4455 450D 554E 4645 440D"            /* DIDUNDUEUNFED */	$"554E 4649 540D 554E 4946 590D 554E 494F"            /* UNFITUNIFYUNIO */	$"4E0D 554E 4954 450D 554E 4954 590D 554E"            /* NUNITEUNITYUN */	$"4C49 540D 554E 4D45 540D 554E 5345 540D"            /* LITUNMETUNSET */	$"554E 5449 450D 554E 5449 4C0D 554E 5745"            /* UNTIEUNTILUNWE */	$"440D 554E 5A49 500D 5550 5045 520D 5550"            /* DUNZIPUPPERUP */	$"5345 540D 5552 4241 4E0D 5552 494E 450D"            /* SETURBANURINE */	$"5553 4147 450D 5553 4845 520D 5553 494E"            /* USAGEUSHERUSIN */	$"470D 5553 5541 4C0D 5553 5552 500D 5554"            /* GUSUALUSURPUT */	$"494C 450D 5554 5445 520D 5641 4755 450D"            /* ILEUTTERVAGUE */	$"5641 4C45 540D 5641 4C49 440D 5641 4C4F"            /* VALETVALIDVALO */	$"520D 5641 4C55 450D 5641 4C56 450D 5641"            /* RVALUEVALVEVA */	$"5049 440D 5641 504F 520D 5641 554C 540D"            /* PIDVAPORVAULT */	$"5641 554E 540D 5645 4741 4E0D 5645 4E4F"            /* VAUNTVEGANVENO */	$"4D0D 5645 4E55 450D 5645 5247 450D 5645"            /* MVENUEVERGEVE */	$"5253 450D 5645 5253 4F0D 5645 5256 450D"            /* RSEVERSOVERVE */	$"5649 4341 520D 5649 4445 4F0D 5649 4749"            /* VICARVIDEOVIGI */	$"4C0D 5649 474F 520D 5649 4C4C 410D 5649"            /* LVIGORVILLAVI */	$"4E59 4C0D 5649 4F4C 410D 5649 5045 520D"            /* NYLVIOLAVIPER */	$"5649 5241 4C0D 5649 5255 530D 5649 5349"            /* VIRALVIRUSVISI */	$"540D 5649 534F 520D 5649 5354 410D 5649"            /* TVISORVISTAVI */	$"5441 4C0D 5649 5649 440D 5649 5845 4E0D"            /* TALVIVIDVIXEN */	$"564F 4341 4C0D 564F 444B 410D 564F 4755"            /* VOCALVODKAVOGU */	$"450D 564F 4943 450D 564F 494C 410D 564F"            /* EVOICEVOILAVO */	$"4D49 540D 564F 5445 520D 564F 5543 480D"            /* MITVOTERVOUCH */	$"564F 5745 4C0D 5659 494E 470D 5741 434B"            /* VOWELVYINGWACK */	$"590D 5741 4645 520D 5741 4745 520D 5741"            /* YWAFERWAGERWA */	$"474F 4E0D 5741 4953 540D 5741 4956 450D"            /* GONWAISTWAIVE */	$"5741 4C54 5A0D 5741 5254 590D 5741 5354"            /* WALTZWARTYWAST */	$"450D 5741 5443 480D 5741 5445 520D 5741"            /* EWATCHWATERWA */	$"5645 520D 5741 5845 4E0D 5745 4152 590D"            /* VERWAXENWEARY */	$"5745 4156 450D 5745 4447 450D 5745 4544"            /* WEAVEWEDGEWEED */	$"590D 5745 4947 480D 5745 4952 440D 5745"            /* YWEIGHWEIRDWE */	$"4C43 480D 5745 4C53 480D 5748 4143 4B0D"            /* LCHWELSHWHACK */	$"5748 414C 450D 5748 4152 460D 5748 4541"            /* WHALEWHARFWHEA */	$"540D 5748 4545 4C0D 5748 454C 500D 5748"            /* TWHEELWHELPWH */	$"4552 450D 5748 4943 480D 5748 4946 460D"            /* EREWHICHWHIFF */	$"5748 494C 450D 5748 494E 450D 5748 494E"            /* WHILEWHINEWHIN */	$"590D 5748 4952 4C0D 5748 4953 4B0D 5748"            /* YWHIRLWHISKWH */	$"4954 450D 5748 4F4C 450D 5748 4F4F 500D"            /* ITEWHOLEWHOOP */	$"5748 4F53 450D 5749 4445 4E0D 5749 4445"            /* WHOSEWIDENWIDE */	$"520D 5749 444F 570D 5749 4454 480D 5749"            /* RWIDOWWIDTHWI */	$"454C 440D 5749 4748 540D 5749 4C4C 590D"            /* ELDWIGHTWILLY */	$"5749 4D50 590D 5749 4E43 450D 5749 4E43"            /* WIMPYWINCEWINC */	$"480D 5749 4E44 590D 5749 5345 520D 5749"            /* HWINDYWISERWI */	$"5350 590D 5749 5443 480D 5749 5454 590D"            /* SPYWITCHWITTY */	$"574F 4B45 4E0D 574F 4D41 4E0D 574F 4D45"            /* WOKENWOMANWOME */	$"4E0D 574F 4F44 590D 574F 4F45 520D 574F"            /* NWOODYWOOERWO */	$"4F4C 590D 574F 4F5A 590D 574F 5244 590D"            /* OLYWOOZYWORDY */	$"574F 524C 440D 574F 5252 590D 574F 5253"            /* WORLDWORRYWORS */	$"450D 574F 5253 540D 574F 5254 480D 574F"            /* EWORSTWORTHWO */	$"554C 440D 574F 554E 440D 574F 5645 4E0D"            /* ULDWOUNDWOVEN */	$"5752 4143 4B0D 5752 4154 480D 5752 4541"            /* WRACKWRATHWREA */	$"4B0D 5752 4543 4B0D 5752 4553 540D 5752"            /* KWRECKWRESTWR */	$"494E 470D 5752 4953 540D 5752 4954 450D"            /* INGWRISTWRITE */	$"5752 4F4E 470D 5752 4F54 450D 5752 554E"            /* WRONGWROTEWRUN */	$"470D 5752 594C 590D 5941 4348 540D 5945"            /* GWRYLYYACHTYE */	$"4152 4E0D 5945 4153 540D 5949 454C 440D"            /* ARNYEASTYIELD */	$"594F 554E 470D 594F 5554 480D 5A45 4252"            /* YOUNGYOUTHZEBR */	$"410D 5A45 5354 590D 5A4F 4E41 4C"                   /* AZESTYZONAL */};data 'TEXT' (129) {	$"4141 4845 440D 4141 4C49 490D 4141 5247"            /* AAHEDAALIIAARG */	$"480D 4141 5254 490D 4142 4143 410D 4142"            /* HAARTIABACAAB */	$"4143 490D 4142 4143 530D 4142 4146 540D"            /* ACIABACSABAFT */	$"4142 414B 410D 4142 414D 500D 4142 414E"            /* ABAKAABAMPABAN */	$"440D 4142 4153 480D 4142 4153 4B0D 4142"            /* DABASHABASKAB */	$"4159 410D 4142 4241 530D 4142 4245 440D"            /* AYAABBASABBED */	$"4142 4245 530D 4142 4345 450D 4142 4541"            /* ABBESABCEEABEA */	$"4D0D 4142 4541 520D 4142 454C 450D 4142"            /* MABEARABELEAB */	$"4552 530D 4142 4554 530D 4142 4945 530D"            /* ERSABETSABIES */	$"4142 4C45 520D 4142 4C45 530D 4142 4C45"            /* ABLERABLESABLE */	$"540D 4142 4C4F 570D 4142 4D48 4F0D 4142"            /* TABLOWABMHOAB */	$"4F48 4D0D 4142 4F49 4C0D 4142 4F4D 410D"            /* OHMABOILABOMA */	$"4142 4F4F 4E0D 4142 4F52 440D 4142 4F52"            /* ABOONABORDABOR */	$"450D 4142 5241 4D0D 4142 5241 590D 4142"            /* EABRAMABRAYAB */	$"5249 4D0D 4142 5249 4E0D 4142 5249 530D"            /* RIMABRINABRIS */	$"4142 5345 590D 4142 5349 540D 4142 554E"            /* ABSEYABSITABUN */	$"410D 4142 554E 450D 4142 5554 530D 4142"            /* AABUNEABUTSAB */	$"555A 5A0D 4142 5945 530D 4142 5953 4D0D"            /* UZZABYESABYSM */	$"4143 4149 530D 4143 4152 490D 4143 4341"            /* ACAISACARIACCA */	$"530D 4143 434F 590D 4143 4552 420D 4143"            /* SACCOYACERBAC */	$"4552 530D 4143 4554 410D 4143 4841 520D"            /* ERSACETAACHAR */	$"4143 4845 440D 4143 4845 530D 4143 484F"            /* ACHEDACHESACHO */	$"4F0D 4143 4944 530D 4143 4944 590D 4143"            /* OACIDSACIDYAC */	$"494E 470D 4143 494E 490D 4143 4B45 450D"            /* INGACINIACKEE */	$"4143 4B45 520D 4143 4D45 530D 4143 4D49"            /* ACKERACMESACMI */	$"430D 4143 4E45 440D 4143 4E45 530D 4143"            /* CACNEDACNESAC */	$"4F43 4B0D 4143 4F4C 440D 4143 5245 440D"            /* OCKACOLDACRED */	$"4143 5245 530D 4143 524F 530D 4143 5445"            /* ACRESACROSACTE */	$"440D 4143 5449 4E0D 4143 544F 4E0D 4143"            /* DACTINACTONAC */	$"594C 530D 4144 4157 530D 4144 4159 530D"            /* YLSADAWSADAYS */	$"4144 424F 540D 4144 4441 580D 4144 4445"            /* ADBOTADDAXADDE */	$"440D 4144 4445 520D 4144 4449 4F0D 4144"            /* DADDERADDIOAD */	$"444C 450D 4144 4545 4D0D 4144 4841 4E0D"            /* DLEADEEMADHAN */	$"4144 4945 550D 4144 494F 530D 4144 4954"            /* ADIEUADIOSADIT */	$"530D 4144 4D41 4E0D 4144 4D45 4E0D 4144"            /* SADMANADMENAD */	$"4D49 580D 4144 4F42 4F0D 4144 4F57 4E0D"            /* MIXADOBOADOWN */	$"4144 4F5A 450D 4144 5241 440D 4144 5245"            /* ADOZEADRADADRE */	$"440D 4144 5355 4D0D 4144 554B 490D 4144"            /* DADSUMADUKIAD */	$"554E 430D 4144 5553 540D 4144 5645 570D"            /* UNCADUSTADVEW */	$"4144 5954 410D 4144 5A45 440D 4144 5A45"            /* ADYTAADZEDADZE */	$"530D 4145 4349 410D 4145 4445 530D 4145"            /* SAECIAAEDESAE */	$"4749 530D 4145 4F4E 530D 4145 5249 450D"            /* GISAEONSAERIE */	$"4145 524F 530D 4145 5349 520D 4146 414C"            /* AEROSAESIRAFAL */	$"440D 4146 4152 410D 4146 4152 530D 4146"            /* DAFARAAFARSAF */	$"4541 520D 4146 4C41 4A0D 4146 4F52 450D"            /* EARAFLAJAFORE */	$"4146 5249 540D 4146 524F 530D 4147 414D"            /* AFRITAFROSAGAM */	$"410D 4147 414D 490D 4147 4152 530D 4147"            /* AAGAMIAGARSAG */	$"4153 540D 4147 4156 450D 4147 415A 450D"            /* ASTAGAVEAGAZE */	$"4147 454E 450D 4147 4552 530D 4147 4745"            /* AGENEAGERSAGGE */	$"520D 4147 4749 450D 4147 4752 490D 4147"            /* RAGGIEAGGRIAG */	$"4752 4F0D 4147 4752 590D 4147 4841 530D"            /* GROAGGRYAGHAS */	$"4147 494C 410D 4147 494F 530D 4147 4953"            /* AGILAAGIOSAGIS */	$"4D0D 4147 4953 540D 4147 4954 410D 4147"            /* MAGISTAGITAAG */	$"4C45 450D 4147 4C45 540D 4147 4C45 590D"            /* LEEAGLETAGLEY */	$"4147 4C4F 4F0D 4147 4C55 530D 4147 4D41"            /* AGLOOAGLUSAGMA */	$"530D 4147 4F47 450D 4147 4F4E 450D 4147"            /* SAGOGEAGONEAG */	$"4F4E 530D 4147 4F4F 440D 4147 4F52 410D"            /* ONSAGOODAGORA */	$"4147 5249 410D 4147 5249 4E0D 4147 524F"            /* AGRIAAGRINAGRO */	$"530D 4147 5545 440D 4147 5545 530D 4147"            /* SAGUEDAGUESAG */	$"554E 410D 4147 5554 490D 4148 4541 500D"            /* UNAAGUTIAHEAP */	$"4148 454E 540D 4148 4947 480D 4148 494E"            /* AHENTAHIGHAHIN */	$"440D 4148 494E 470D 4148 494E 540D 4148"            /* DAHINGAHINTAH */	$"4F4C 440D 4148 554C 4C0D 4148 5552 550D"            /* OLDAHULLAHURU */	$"4149 4441 530D 4149 4445 440D 4149 4445"            /* AIDASAIDEDAIDE */	$"530D 4149 444F 490D 4149 444F 530D 4149"            /* SAIDOIAIDOSAI */	$"4552 590D 4149 4741 530D 4149 4748 540D"            /* ERYAIGASAIGHT */	$"4149 4C45 440D 4149 4D45 440D 4149 4D45"            /* AILEDAIMEDAIME */	$"520D 4149 4E45 450D 4149 4E47 410D 4149"            /* RAINEEAINGAAI */	$"4F4C 490D 4149 5245 440D 4149 5245 520D"            /* OLIAIREDAIRER */	$"4149 524E 530D 4149 5254 480D 4149 5254"            /* AIRNSAIRTHAIRT */	$"530D 4149 5443 480D 4149 5455 530D 4149"            /* SAITCHAITUSAI */	$"5645 520D 4149 5945 450D 4149 5A4C 450D"            /* VERAIYEEAIZLE */	$"414A 4945 530D 414A 4956 410D 414A 5547"            /* AJIESAJIVAAJUG */	$"410D 414A 5741 4E0D 414B 4545 530D 414B"            /* AAJWANAKEESAK */	$"454C 410D 414B 454E 450D 414B 494E 470D"            /* ELAAKENEAKING */	$"414B 4954 410D 414B 4B41 530D 414C 4141"            /* AKITAAKKASALAA */	$"500D 414C 4143 4B0D 414C 414D 4F0D 414C"            /* PALACKALAMOAL */	$"414E 440D 414C 414E 450D 414C 414E 470D"            /* ANDALANEALANG */	$"414C 414E 530D 414C 414E 540D 414C 4150"            /* ALANSALANTALAP */	$"410D 414C 4150 530D 414C 4152 590D 414C"            /* AALAPSALARYAL */	$"4154 450D 414C 4159 530D 414C 4241 530D"            /* ATEALAYSALBAS */	$"414C 4245 450D 414C 4349 440D 414C 434F"            /* ALBEEALCIDALCO */	$"530D 414C 4445 410D 414C 4445 520D 414C"            /* SALDEAALDERAL */	$"444F 4C0D 414C 4543 4B0D 414C 4543 530D"            /* DOLALECKALECS */	$"414C 4546 530D 414C 4546 540D 414C 4550"            /* ALEFSALEFTALEP */	$"480D 414C 4557 530D 414C 4559 450D 414C"            /* HALEWSALEYEAL */	$"4641 530D 414C 4741 4C0D 414C 4741 530D"            /* FASALGALALGAS */	$"414C 4749 440D 414C 4749 4E0D 414C 474F"            /* ALGIDALGINALGO */	$"520D 414C 4755 4D0D 414C 4941 530D 414C"            /* RALGUMALIASAL */	$"4946 530D 414C 494E 450D 414C 4953 540D"            /* IFSALINEALIST */	$"414C 4959 410D 414C 4B49 450D 414C 4B4F"            /* ALIYAALKIEALKO */	$"530D 414C 4B59 440D 414C 4B59 4C0D 414C"            /* SALKYDALKYLAL */	$"4C45 450D 414C 4C45 4C0D 414C 4C49 530D"            /* LEEALLELALLIS */	$"414C 4C4F 440D 414C 4C59 4C0D 414C 4D41"            /* ALLODALLYLALMA */	$"480D 414C 4D41 530D 414C 4D45 480D 414C"            /* HALMASALMEHAL */	$"4D45 530D 414C 4D55 440D 414C 4D55 470D"            /* MESALMUDALMUG */	$"414C 4F44 530D 414C 4F45 440D 414C 4F45"            /* ALODSALOEDALOE */	$"530D 414C 4F48 410D 414C 4F49 4E0D 414C"            /* SALOHAALOINAL */	$"4F4F 530D 414C 4F57 450D 414C 5448 4F0D"            /* OOSALOWEALTHO */	$"414C 544F 530D 414C 554C 410D 414C 554D"            /* ALTOSALULAALUM */	$"530D 414C 5552 450D 414C 5641 520D 414C"            /* SALUREALVARAL */	$"5741 590D 414D 4148 530D 414D 4149 4E0D"            /* WAYAMAHSAMAIN */	$"414D 4154 450D 414D 4155 540D 414D 4241"            /* AMATEAMAUTAMBA */	$"4E0D 414D 4249 540D 414D 424F 530D 414D"            /* NAMBITAMBOSAM */	$"4252 590D 414D 4542 410D 414D 4545 520D"            /* BRYAMEBAAMEER */	$"414D 454E 450D 414D 454E 530D 414D 454E"            /* AMENEAMENSAMEN */	$"540D 414D 4941 530D 414D 4943 450D 414D"            /* TAMIASAMICEAM */	$"4943 490D 414D 4944 450D 414D 4944 4F0D"            /* ICIAMIDEAMIDO */	$"414D 4944 530D 414D 4945 530D 414D 4947"            /* AMIDSAMIESAMIG */	$"410D 414D 4947 4F0D 414D 494E 450D 414D"            /* AAMIGOAMINEAM */	$"494E 4F0D 414D 494E 530D 414D 4952 530D"            /* INOAMINSAMIRS */	$"414D 4C41 530D 414D 4D41 4E0D 414D 4D4F"            /* AMLASAMMANAMMO */	$"4E0D 414D 4D4F 530D 414D 4E49 410D 414D"            /* NAMMOSAMNIAAM */	$"4E49 430D 414D 4E49 4F0D 414D 4F4B 530D"            /* NICAMNIOAMOKS */	$"414D 4F4C 450D 414D 4F52 540D 414D 4F55"            /* AMOLEAMORTAMOU */	$"520D 414D 4F56 450D 414D 4F57 540D 414D"            /* RAMOVEAMOWTAM */	$"5045 440D 414D 5055 4C0D 414D 5249 540D"            /* PEDAMPULAMRIT */	$"414D 5543 4B0D 414D 594C 530D 414E 414E"            /* AMUCKAMYLSANAN */	$"410D 414E 4154 410D 414E 4348 4F0D 414E"            /* AANATAANCHOAN */	$"434C 450D 414E 434F 4E0D 414E 4452 4F0D"            /* CLEANCONANDRO */	$"414E 4541 520D 414E 454C 450D 414E 454E"            /* ANEARANELEANEN */	$"540D 414E 4741 530D 414E 474C 4F0D 414E"            /* TANGASANGLOAN */	$"4947 480D 414E 494C 450D 414E 494C 530D"            /* IGHANILEANILS */	$"414E 494D 410D 414E 494D 490D 414E 494F"            /* ANIMAANIMIANIO */	$"4E0D 414E 4953 450D 414E 4B45 520D 414E"            /* NANISEANKERAN */	$"4B48 530D 414E 4B55 530D 414E 4C41 530D"            /* KHSANKUSANLAS */	$"414E 4E41 4C0D 414E 4E41 530D 414E 4E41"            /* ANNALANNASANNA */	$"540D 414E 4F41 530D 414E 4F4C 450D 414E"            /* TANOASANOLEAN */	$"4F4D 590D 414E 5341 450D 414E 5441 450D"            /* OMYANSAEANTAE */	$"414E 5441 520D 414E 5441 530D 414E 5445"            /* ANTARANTASANTE */	$"440D 414E 5445 530D 414E 5449 530D 414E"            /* DANTESANTISAN */	$"5452 410D 414E 5452 450D 414E 5453 590D"            /* TRAANTREANTSY */	$"414E 5552 410D 414E 594F 4E0D 4150 4143"            /* ANURAANYONAPAC */	$"450D 4150 4147 450D 4150 4149 440D 4150"            /* EAPAGEAPAIDAP */	$"4159 440D 4150 4159 530D 4150 4541 4B0D"            /* AYDAPAYSAPEAK */	$"4150 4545 4B0D 4150 4552 530D 4150 4552"            /* APEEKAPERSAPER */	$"540D 4150 4552 590D 4150 4741 520D 4150"            /* TAPERYAPGARAP */	$"4849 530D 4150 4941 4E0D 4150 494F 4C0D"            /* HISAPIANAPIOL */	$"4150 4953 480D 4150 4953 4D0D 4150 4F44"            /* APISHAPISMAPOD */	$"450D 4150 4F44 530D 4150 4F4F 500D 4150"            /* EAPODSAPOOPAP */	$"4F52 540D 4150 5041 4C0D 4150 5041 590D"            /* ORTAPPALAPPAY */	$"4150 5045 4C0D 4150 5052 4F0D 4150 5055"            /* APPELAPPROAPPU */	$"490D 4150 5055 590D 4150 5245 530D 4150"            /* IAPPUYAPRESAP */	$"5345 530D 4150 5349 530D 4150 534F 530D"            /* SESAPSISAPSOS */	$"4150 5445 440D 4150 5445 520D 4151 5541"            /* APTEDAPTERAQUA */	$"450D 4151 5541 530D 4152 4142 410D 4152"            /* EAQUASARABAAR */	$"414B 530D 4152 414D 450D 4152 4152 530D"            /* AKSARAMEARARS */	$"4152 4241 530D 4152 4345 440D 4152 4348"            /* ARBASARCEDARCH */	$"490D 4152 434F 530D 4152 4355 530D 4152"            /* IARCOSARCUSAR */	$"4445 420D 4152 4452 490D 4152 4541 440D"            /* DEBARDRIAREAD */	$"4152 4541 450D 4152 4541 4C0D 4152 4541"            /* AREAEAREALAREA */	$"520D 4152 4541 530D 4152 4543 410D 4152"            /* RAREASARECAAR */	$"4544 440D 4152 4544 450D 4152 4546 590D"            /* EDDAREDEAREFY */	$"4152 4549 430D 4152 454E 450D 4152 4550"            /* AREICARENEAREP */	$"410D 4152 4552 450D 4152 4554 450D 4152"            /* AAREREARETEAR */	$"4554 530D 4152 4554 540D 4152 4741 4C0D"            /* ETSARETTARGAL */	$"4152 4741 4E0D 4152 4749 4C0D 4152 474C"            /* ARGANARGILARGL */	$"450D 4152 474F 4C0D 4152 474F 4E0D 4152"            /* EARGOLARGONAR */	$"474F 540D 4152 4755 530D 4152 4841 540D"            /* GOTARGUSARHAT */	$"4152 4941 530D 4152 4945 4C0D 4152 494B"            /* ARIASARIELARIK */	$"490D 4152 494C 530D 4152 494F 540D 4152"            /* IARILSARIOTAR */	$"4953 480D 4152 4B45 440D 4152 4C45 440D"            /* ISHARKEDARLED */	$"4152 4C45 530D 4152 4D45 440D 4152 4D45"            /* ARLESARMEDARME */	$"520D 4152 4D45 540D 4152 4D49 4C0D 4152"            /* RARMETARMILAR */	$"4E41 530D 4152 4E55 540D 4152 4F42 410D"            /* NASARNUTAROBA */	$"4152 4F48 410D 4152 4F49 440D 4152 5041"            /* AROHAAROIDARPA */	$"530D 4152 5045 4E0D 4152 5241 480D 4152"            /* SARPENARRAHAR */	$"5241 530D 4152 5245 540D 4152 5249 530D"            /* RASARRETARRIS */	$"4152 524F 5A0D 4152 5345 440D 4152 5345"            /* ARROZARSEDARSE */	$"530D 4152 5345 590D 4152 5349 530D 4152"            /* SARSEYARSISAR */	$"5441 4C0D 4152 5445 4C0D 4152 5449 430D"            /* TALARTELARTIC */	$"4152 5449 530D 4152 5548 450D 4152 554D"            /* ARTISARUHEARUM */	$"530D 4152 5641 4C0D 4152 5645 450D 4152"            /* SARVALARVEEAR */	$"564F 530D 4152 594C 530D 4153 414E 410D"            /* VOSARYLSASANA */	$"4153 434F 4E0D 4153 4355 530D 4153 4449"            /* ASCONASCUSASDI */	$"430D 4153 4845 440D 4153 4845 530D 4153"            /* CASHEDASHESAS */	$"4845 540D 4153 4B45 440D 4153 4B45 520D"            /* HETASKEDASKER */	$"4153 4B4F 490D 4153 4B4F 530D 4153 5045"            /* ASKOIASKOSASPE */	$"4E0D 4153 5045 520D 4153 5049 430D 4153"            /* NASPERASPICAS */	$"5049 450D 4153 5049 530D 4153 5052 4F0D"            /* PIEASPISASPRO */	$"4153 5341 490D 4153 5341 4D0D 4153 5345"            /* ASSAIASSAMASSE */	$"530D 4153 5345 5A0D 4153 534F 540D 4153"            /* SASSEZASSOTAS */	$"5445 520D 4153 5449 520D 4153 5455 4E0D"            /* TERASTIRASTUN */	$"4153 5552 410D 4153 5741 590D 4153 5749"            /* ASURAASWAYASWI */	$"4D0D 4153 594C 410D 4154 4150 530D 4154"            /* MASYLAATAPSAT */	$"4158 590D 4154 4947 490D 4154 494C 540D"            /* AXYATIGIATILT */	$"4154 494D 590D 4154 4C41 530D 4154 4D41"            /* ATIMYATLASATMA */	$"4E0D 4154 4D41 530D 4154 4D4F 530D 4154"            /* NATMASATMOSAT */	$"4F43 530D 4154 4F4B 450D 4154 4F4B 530D"            /* OCSATOKEATOKS */	$"4154 4F4D 530D 4154 4F4D 590D 4154 4F4E"            /* ATOMSATOMYATON */	$"590D 4154 4F50 590D 4154 5249 410D 4154"            /* YATOPYATRIAAT */	$"5249 500D 4154 5441 500D 4154 5441 520D"            /* RIPATTAPATTAR */	$"4154 5541 530D 4155 4441 440D 4155 4745"            /* ATUASAUDADAUGE */	$"520D 4155 4748 540D 4155 4C41 530D 4155"            /* RAUGHTAULASAU */	$"4C49 430D 4155 4C4F 490D 4155 4C4F 530D"            /* LICAULOIAULOS */	$"4155 4D49 4C0D 4155 4E45 530D 4155 4E54"            /* AUMILAUNESAUNT */	$"530D 4155 5241 450D 4155 5241 4C0D 4155"            /* SAURAEAURALAU */	$"5241 520D 4155 5241 530D 4155 5245 490D"            /* RARAURASAUREI */	$"4155 5245 530D 4155 5249 430D 4155 5249"            /* AURESAURICAURI */	$"530D 4155 5255 4D0D 4155 544F 530D 4155"            /* SAURUMAUTOSAU */	$"5849 4E0D 4156 414C 450D 4156 414E 540D"            /* XINAVALEAVANT */	$"4156 4153 540D 4156 454C 530D 4156 454E"            /* AVASTAVELSAVEN */	$"530D 4156 4552 530D 4156 4741 530D 4156"            /* SAVERSAVGASAV */	$"494E 450D 4156 494F 4E0D 4156 4953 450D"            /* INEAVIONAVISE */	$"4156 4953 4F0D 4156 495A 450D 4156 4F57"            /* AVISOAVIZEAVOW */	$"530D 4156 595A 450D 4157 4152 4E0D 4157"            /* SAVYZEAWARNAW */	$"4154 4F0D 4157 4156 450D 4157 4159 530D"            /* ATOAWAVEAWAYS */	$"4157 444C 530D 4157 4545 4C0D 4157 4554"            /* AWDLSAWEELAWET */	$"4F0D 4157 494E 470D 4157 4D52 590D 4157"            /* OAWINGAWMRYAW */	$"4E45 440D 4157 4E45 520D 4157 4F4C 530D"            /* NEDAWNERAWOLS */	$"4157 4F52 4B0D 4158 454C 530D 4158 494C"            /* AWORKAXELSAXIL */	$"450D 4158 494C 530D 4158 494E 470D 4158"            /* EAXILSAXINGAX */	$"4954 450D 4158 4C45 440D 4158 4C45 530D"            /* ITEAXLEDAXLES */	$"4158 4D41 4E0D 4158 4D45 4E0D 4158 4F49"            /* AXMANAXMENAXOI */	$"440D 4158 4F4E 450D 4158 4F4E 530D 4159"            /* DAXONEAXONSAY */	$"4148 530D 4159 4159 410D 4159 454C 500D"            /* AHSAYAYAAYELP */	$"4159 4752 450D 4159 494E 530D 4159 4F4E"            /* AYGREAYINSAYON */	$"540D 4159 5245 530D 4159 5249 450D 415A"            /* TAYRESAYRIEAZ */	$"414E 530D 415A 4944 450D 415A 4944 4F0D"            /* ANSAZIDEAZIDO */	$"415A 494E 450D 415A 4C4F 4E0D 415A 4F49"            /* AZINEAZLONAZOI */	$"430D 415A 4F4C 450D 415A 4F4E 530D 415A"            /* CAZOLEAZONSAZ */	$"4F54 450D 415A 4F54 480D 415A 554B 490D"            /* OTEAZOTHAZUKI */	$"415A 5552 4E0D 415A 5552 590D 415A 5947"            /* AZURNAZURYAZYG */	$"590D 415A 594D 450D 415A 594D 530D 4241"            /* YAZYMEAZYMSBA */	$"4145 440D 4241 414C 530D 4241 4241 530D"            /* AEDBAALSBABAS */	$"4241 4245 4C0D 4241 4245 530D 4241 424B"            /* BABELBABESBABK */	$"410D 4241 424F 4F0D 4241 4255 4C0D 4241"            /* ABABOOBABULBA */	$"4255 530D 4241 4343 410D 4241 4343 4F0D"            /* BUSBACCABACCO */	$"4241 4343 590D 4241 4348 410D 4241 4348"            /* BACCYBACHABACH */	$"530D 4241 434B 530D 4241 4444 590D 4241"            /* SBACKSBADDYBA */	$"454C 530D 4241 4646 530D 4241 4646 590D"            /* ELSBAFFSBAFFY */	$"4241 4654 530D 4241 4748 530D 4241 4749"            /* BAFTSBAGHSBAGI */	$"450D 4241 4854 530D 4241 4855 530D 4241"            /* EBAHTSBAHUSBA */	$"4855 540D 4241 494C 530D 4241 4952 4E0D"            /* HUTBAILSBAIRN */	$"4241 4953 410D 4241 4954 480D 4241 4954"            /* BAISABAITHBAIT */	$"530D 4241 495A 410D 4241 495A 450D 4241"            /* SBAIZABAIZEBA */	$"4A41 4E0D 4241 4A52 410D 4241 4A52 490D"            /* JANBAJRABAJRI */	$"4241 4A55 530D 4241 4B45 440D 4241 4B45"            /* BAJUSBAKEDBAKE */	$"4E0D 4241 4B45 530D 4241 4B52 410D 4241"            /* NBAKESBAKRABA */	$"4C41 530D 4241 4C44 530D 4241 4C44 590D"            /* LASBALDSBALDY */	$"4241 4C45 440D 4241 4C45 530D 4241 4C4B"            /* BALEDBALESBALK */	$"530D 4241 4C4B 590D 4241 4C4C 530D 4241"            /* SBALKYBALLSBA */	$"4C4C 590D 4241 4C4D 530D 4241 4C4F 4F0D"            /* LLYBALMSBALOO */	$"4241 4C53 410D 4241 4C54 490D 4241 4C55"            /* BALSABALTIBALU */	$"4E0D 4241 4C55 530D 4241 4D42 490D 4241"            /* NBALUSBAMBIBA */	$"4E41 4B0D 4241 4E43 4F0D 4241 4E43 530D"            /* NAKBANCOBANCS */	$"4241 4E44 410D 4241 4E44 480D 4241 4E44"            /* BANDABANDHBAND */	$"530D 4241 4E44 590D 4241 4E45 440D 4241"            /* SBANDYBANEDBA */	$"4E45 530D 4241 4E47 530D 4241 4E49 410D"            /* NESBANGSBANIA */	$"4241 4E4B 530D 4241 4E4E 530D 4241 4E54"            /* BANKSBANNSBANT */	$"530D 4241 4E54 550D 4241 4E54 590D 4241"            /* SBANTUBANTYBA */	$"4E59 410D 4241 5055 530D 4241 5242 450D"            /* NYABAPUSBARBE */	$"4241 5242 530D 4241 5242 590D 4241 5243"            /* BARBSBARBYBARC */	$"410D 4241 5244 450D 4241 5244 4F0D 4241"            /* ABARDEBARDOBA */	$"5244 530D 4241 5244 590D 4241 5245 440D"            /* RDSBARDYBARED */	$"4241 5245 520D 4241 5245 530D 4241 5246"            /* BARERBARESBARF */	$"490D 4241 5246 530D 4241 5249 430D 4241"            /* IBARFSBARICBA */	$"524B 530D 4241 524B 590D 4241 524D 530D"            /* RKSBARKYBARMS */	$"4241 524D 590D 4241 524E 530D 4241 524E"            /* BARMYBARNSBARN */	$"590D 4241 5250 530D 4241 5252 410D 4241"            /* YBARPSBARRABA */	$"5252 450D 4241 5252 4F0D 4241 5252 590D"            /* RREBARROBARRY */	$"4241 5259 450D 4241 5341 4E0D 4241 5345"            /* BARYEBASANBASE */	$"440D 4241 5345 4E0D 4241 5345 520D 4241"            /* DBASENBASERBA */	$"5345 530D 4241 5348 4F0D 4241 5349 4A0D"            /* SESBASHOBASIJ */	$"4241 534B 530D 4241 534F 4E0D 4241 5353"            /* BASKSBASONBASS */	$"450D 4241 5353 490D 4241 5353 4F0D 4241"            /* EBASSIBASSOBA */	$"5353 590D 4241 5354 410D 4241 5354 490D"            /* SSYBASTABASTI */	$"4241 5354 4F0D 4241 5354 530D 4241 5445"            /* BASTOBASTSBATE */	$"440D 4241 5445 530D 4241 5448 530D 4241"            /* DBATESBATHSBA */	$"5449 4B0D 4241 5454 410D 4241 5454 530D"            /* TIKBATTABATTS */	$"4241 5454 550D 4241 5544 530D 4241 554B"            /* BATTUBAUDSBAUK */	$"530D 4241 554C 4B0D 4241 5552 530D 4241"            /* SBAULKBAURSBA */	$"5649 4E0D 4241 5744 530D 4241 574B 530D"            /* VINBAWDSBAWKS */	$"4241 574C 530D 4241 574E 530D 4241 5752"            /* BAWLSBAWNSBAWR */	$"530D 4241 5754 590D 4241 5945 440D 4241"            /* SBAWTYBAYEDBA */	$"5945 520D 4241 5945 530D 4241 594C 450D"            /* YERBAYESBAYLE */	$"4241 5954 530D 4241 5A41 520D 4241 5A4F"            /* BAYTSBAZARBAZO */	$"4F0D 4245 4144 530D 4245 414B 530D 4245"            /* OBEADSBEAKSBE */	$"414B 590D 4245 414C 530D 4245 414D 530D"            /* AKYBEALSBEAMS */	$"4245 414D 590D 4245 414E 4F0D 4245 414E"            /* BEAMYBEANOBEAN */	$"530D 4245 414E 590D 4245 4152 450D 4245"            /* SBEANYBEAREBE */	$"4152 530D 4245 4154 480D 4245 4154 530D"            /* ARSBEATHBEATS */	$"4245 4154 590D 4245 4155 530D 4245 4155"            /* BEATYBEAUSBEAU */	$"540D 4245 4155 580D 4245 424F 500D 4245"            /* TBEAUXBEBOPBE */	$"4341 500D 4245 434B 450D 4245 434B 530D"            /* CAPBECKEBECKS */	$"4245 4441 440D 4245 4445 4C0D 4245 4445"            /* BEDADBEDELBEDE */	$"530D 4245 4445 570D 4245 4449 4D0D 4245"            /* SBEDEWBEDIMBE */	$"4459 450D 4245 4544 490D 4245 4546 530D"            /* DYEBEEDIBEEFS */	$"4245 4550 530D 4245 4552 530D 4245 4552"            /* BEEPSBEERSBEER */	$"590D 4245 4554 530D 4245 464F 470D 4245"            /* YBEETSBEFOGBE */	$"4741 440D 4245 4741 520D 4245 4745 4D0D"            /* GADBEGARBEGEM */	$"4245 474F 540D 4245 4755 4D0D 4245 4947"            /* BEGOTBEGUMBEIG */	$"450D 4245 4947 590D 4245 494E 530D 4245"            /* EBEIGYBEINSBE */	$"4B41 480D 4245 4C41 480D 4245 4C41 520D"            /* KAHBELAHBELAR */	$"4245 4C41 590D 4245 4C45 450D 4245 4C47"            /* BELAYBELEEBELG */	$"410D 4245 4C4C 530D 4245 4C4F 4E0D 4245"            /* ABELLSBELONBE */	$"4C54 530D 4245 4D41 440D 4245 4D41 530D"            /* LTSBEMADBEMAS */	$"4245 4D49 580D 4245 4D55 440D 4245 4E44"            /* BEMIXBEMUDBEND */	$"530D 4245 4E44 590D 4245 4E45 530D 4245"            /* SBENDYBENESBE */	$"4E45 540D 4245 4E47 410D 4245 4E49 530D"            /* NETBENGABENIS */	$"4245 4E4E 450D 4245 4E4E 490D 4245 4E4E"            /* BENNEBENNIBENN */	$"590D 4245 4E54 4F0D 4245 4E54 530D 4245"            /* YBENTOBENTSBE */	$"4E54 590D 4245 5041 540D 4245 5241 590D"            /* NTYBEPATBERAY */	$"4245 5245 530D 4245 5247 530D 4245 524B"            /* BERESBERGSBERK */	$"4F0D 4245 524B 530D 4245 524D 450D 4245"            /* OBERKSBERMEBE */	$"524D 530D 4245 524F 420D 4245 5259 4C0D"            /* RMSBEROBBERYL */	$"4245 5341 540D 4245 5341 570D 4245 5345"            /* BESATBESAWBESE */	$"450D 4245 5345 530D 4245 5349 540D 4245"            /* EBESESBESITBE */	$"534F 4D0D 4245 534F 540D 4245 5354 490D"            /* SOMBESOTBESTI */	$"4245 5354 530D 4245 5441 530D 4245 5445"            /* BESTSBETASBETE */	$"440D 4245 5445 530D 4245 5448 530D 4245"            /* DBETESBETHSBE */	$"5449 440D 4245 544F 4E0D 4245 5454 410D"            /* TIDBETONBETTA */	$"4245 5454 590D 4245 5645 520D 4245 564F"            /* BETTYBEVERBEVO */	$"520D 4245 5655 450D 4245 5656 590D 4245"            /* RBEVUEBEVVYBE */	$"5745 540D 4245 5749 470D 4245 5A45 530D"            /* WETBEWIGBEZES */	$"4245 5A49 4C0D 4245 5A5A 590D 4248 4149"            /* BEZILBEZZYBHAI */	$"530D 4248 414A 490D 4248 414E 470D 4248"            /* SBHAJIBHANGBH */	$"4154 530D 4248 454C 530D 4248 4F4F 540D"            /* ATSBHELSBHOOT */	$"4248 554E 410D 4248 5554 530D 4249 4143"            /* BHUNABHUTSBIAC */	$"480D 4249 414C 490D 4249 414C 590D 4249"            /* HBIALIBIALYBI */	$"4242 530D 4249 4245 530D 4249 4343 590D"            /* BBSBIBESBICCY */	$"4249 4345 530D 4249 4445 440D 4249 4445"            /* BICESBIDEDBIDE */	$"520D 4249 4445 530D 4249 4445 540D 4249"            /* RBIDESBIDETBI */	$"4449 530D 4249 444F 4E0D 4249 454C 440D"            /* DISBIDONBIELD */	$"4249 4552 530D 4249 4646 4F0D 4249 4646"            /* BIERSBIFFOBIFF */	$"530D 4249 4646 590D 4249 4649 440D 4249"            /* SBIFFYBIFIDBI */	$"4741 450D 4249 4747 530D 4249 4747 590D"            /* GAEBIGGSBIGGY */	$"4249 4748 410D 4249 4748 540D 4249 474C"            /* BIGHABIGHTBIGL */	$"590D 4249 474F 530D 4249 4A4F 550D 4249"            /* YBIGOSBIJOUBI */	$"4B45 440D 4249 4B45 520D 4249 4B45 530D"            /* KEDBIKERBIKES */	$"4249 4B49 450D 4249 4C42 4F0D 4249 4C42"            /* BIKIEBILBOBILB */	$"590D 4249 4C45 440D 4249 4C45 530D 4249"            /* YBILEDBILESBI */	$"4C47 590D 4249 4C4B 530D 4249 4C4C 530D"            /* LGYBILKSBILLS */	$"4249 4D41 480D 4249 4D41 530D 4249 4D42"            /* BIMAHBIMASBIMB */	$"4F0D 4249 4E41 4C0D 4249 4E44 490D 4249"            /* OBINALBINDIBI */	$"4E44 530D 4249 4E45 520D 4249 4E45 530D"            /* NDSBINERBINES */	$"4249 4E47 530D 4249 4E47 590D 4249 4E49"            /* BINGSBINGYBINI */	$"540D 4249 4E4B 530D 4249 4E54 530D 4249"            /* TBINKSBINTSBI */	$"4F47 530D 4249 4F4E 540D 4249 4F54 410D"            /* OGSBIONTBIOTA */	$"4249 5045 440D 4249 504F 440D 4249 5244"            /* BIPEDBIPODBIRD */	$"530D 4249 524B 530D 4249 524C 450D 4249"            /* SBIRKSBIRLEBI */	$"524C 530D 4249 524F 530D 4249 5252 530D"            /* RLSBIROSBIRRS */	$"4249 5253 450D 4249 5253 590D 4249 5345"            /* BIRSEBIRSYBISE */	$"530D 4249 534B 530D 4249 534F 4D0D 4249"            /* SBISKSBISOMBI */	$"5443 480D 4249 5445 520D 4249 5445 530D"            /* TCHBITERBITES */	$"4249 544F 530D 4249 544F 550D 4249 5453"            /* BITOSBITOUBITS */	$"590D 4249 5454 450D 4249 5454 530D 4249"            /* YBITTEBITTSBI */	$"5649 410D 4249 5656 590D 4249 5A45 530D"            /* VIABIVVYBIZES */	$"4249 5A5A 4F0D 4249 5A5A 590D 424C 4142"            /* BIZZOBIZZYBLAB */	$"530D 424C 4144 530D 424C 4144 590D 424C"            /* SBLADSBLADYBL */	$"4145 520D 424C 4145 530D 424C 4146 460D"            /* AERBLAESBLAFF */	$"424C 4147 530D 424C 4148 530D 424C 4149"            /* BLAGSBLAHSBLAI */	$"4E0D 424C 414D 530D 424C 4152 540D 424C"            /* NBLAMSBLARTBL */	$"4153 450D 424C 4153 480D 424C 4154 450D"            /* ASEBLASHBLATE */	$"424C 4154 530D 424C 4154 540D 424C 4155"            /* BLATSBLATTBLAU */	$"440D 424C 4157 4E0D 424C 4157 530D 424C"            /* DBLAWNBLAWSBL */	$"4159 530D 424C 4541 520D 424C 4542 530D"            /* AYSBLEARBLEBS */	$"424C 4543 480D 424C 4545 530D 424C 454E"            /* BLECHBLEESBLEN */	$"540D 424C 4552 540D 424C 4553 540D 424C"            /* TBLERTBLESTBL */	$"4554 530D 424C 4559 530D 424C 494D 590D"            /* ETSBLEYSBLIMY */	$"424C 494E 470D 424C 494E 490D 424C 494E"            /* BLINGBLINIBLIN */	$"530D 424C 494E 590D 424C 4950 530D 424C"            /* SBLINYBLIPSBL */	$"4953 540D 424C 4954 450D 424C 4954 530D"            /* ISTBLITEBLITS */	$"424C 4956 450D 424C 4F42 530D 424C 4F43"            /* BLIVEBLOBSBLOC */	$"530D 424C 4F47 530D 424C 4F4F 4B0D 424C"            /* SBLOGSBLOOKBL */	$"4F4F 500D 424C 4F52 450D 424C 4F54 530D"            /* OOPBLOREBLOTS */	$"424C 4F57 530D 424C 4F57 590D 424C 5542"            /* BLOWSBLOWYBLUB */	$"530D 424C 5544 450D 424C 5544 530D 424C"            /* SBLUDEBLUDSBL */	$"5544 590D 424C 5545 440D 424C 5545 530D"            /* UDYBLUEDBLUES */	$"424C 5545 540D 424C 5545 590D 424C 5549"            /* BLUETBLUEYBLUI */	$"440D 424C 554D 450D 424C 554E 4B0D 424C"            /* DBLUMEBLUNKBL */	$"5552 530D 424C 5950 450D 424F 4142 530D"            /* URSBLYPEBOABS */	$"424F 414B 530D 424F 4152 530D 424F 4152"            /* BOAKSBOARSBOAR */	$"540D 424F 4154 530D 424F 4241 430D 424F"            /* TBOATSBOBACBO */	$"4241 4B0D 424F 4241 530D 424F 424F 4C0D"            /* BAKBOBASBOBOL */	$"424F 424F 530D 424F 4343 410D 424F 4343"            /* BOBOSBOCCABOCC */	$"450D 424F 4343 490D 424F 4348 450D 424F"            /* EBOCCIBOCHEBO */	$"434B 530D 424F 4445 440D 424F 4445 530D"            /* CKSBODEDBODES */	$"424F 4447 450D 424F 4448 490D 424F 444C"            /* BODGEBODHIBODL */	$"450D 424F 4550 530D 424F 4554 530D 424F"            /* EBOEPSBOETSBO */	$"4555 460D 424F 4646 4F0D 424F 4646 530D"            /* EUFBOFFOBOFFS */	$"424F 4741 4E0D 424F 4745 590D 424F 4747"            /* BOGANBOGEYBOGG */	$"590D 424F 4749 450D 424F 474C 450D 424F"            /* YBOGIEBOGLEBO */	$"4755 450D 424F 4755 530D 424F 4845 410D"            /* GUEBOGUSBOHEA */	$"424F 484F 530D 424F 494C 530D 424F 494E"            /* BOHOSBOILSBOIN */	$"470D 424F 494E 4B0D 424F 4954 450D 424F"            /* GBOINKBOITEBO */	$"4B45 440D 424F 4B45 480D 424F 4B45 530D"            /* KEDBOKEHBOKES */	$"424F 4B4F 530D 424F 4C41 520D 424F 4C41"            /* BOKOSBOLARBOLA */	$"530D 424F 4C44 530D 424F 4C45 530D 424F"            /* SBOLDSBOLESBO */	$"4C49 580D 424F 4C4C 530D 424F 4C4F 530D"            /* LIXBOLLSBOLOS */	$"424F 4C54 530D 424F 4C55 530D 424F 4D41"            /* BOLTSBOLUSBOMA */	$"530D 424F 4D42 450D 424F 4D42 4F0D 424F"            /* SBOMBEBOMBOBO */	$"4D42 530D 424F 4E43 450D 424F 4E44 530D"            /* MBSBONCEBONDS */	$"424F 4E45 440D 424F 4E45 520D 424F 4E45"            /* BONEDBONERBONE */	$"530D 424F 4E47 530D 424F 4E49 450D 424F"            /* SBONGSBONIEBO */	$"4E4B 530D 424F 4E4E 450D 424F 4E4E 590D"            /* NKSBONNEBONNY */	$"424F 4E5A 410D 424F 4E5A 450D 424F 4F41"            /* BONZABONZEBOOA */	$"490D 424F 4F41 590D 424F 4F42 530D 424F"            /* IBOOAYBOOBSBO */	$"4F44 590D 424F 4F45 440D 424F 4F46 590D"            /* ODYBOOEDBOOFY */	$"424F 4F47 590D 424F 4F48 530D 424F 4F4B"            /* BOOGYBOOHSBOOK */	$"530D 424F 4F4B 590D 424F 4F4C 530D 424F"            /* SBOOKYBOOLSBO */	$"4F4D 530D 424F 4F4D 590D 424F 4F4E 470D"            /* OMSBOOMYBOONG */	$"424F 4F4E 530D 424F 4F52 440D 424F 4F52"            /* BOONSBOORDBOOR */	$"530D 424F 4F53 450D 424F 4F54 530D 424F"            /* SBOOSEBOOTSBO */	$"5050 590D 424F 5241 4B0D 424F 5241 4C0D"            /* PPYBORAKBORAL */	$"424F 5241 530D 424F 5244 450D 424F 5244"            /* BORASBORDEBORD */	$"530D 424F 5245 440D 424F 5245 450D 424F"            /* SBOREDBOREEBO */	$"5245 4C0D 424F 5245 520D 424F 5245 530D"            /* RELBORERBORES */	$"424F 5247 4F0D 424F 5249 430D 424F 524B"            /* BORGOBORICBORK */	$"530D 424F 524D 530D 424F 524E 410D 424F"            /* SBORMSBORNABO */	$"524F 4E0D 424F 5254 530D 424F 5254 590D"            /* RONBORTSBORTY */	$"424F 5254 5A0D 424F 5349 450D 424F 534B"            /* BORTZBOSIEBOSK */	$"530D 424F 534B 590D 424F 534F 4E0D 424F"            /* SBOSKYBOSONBO */	$"5355 4E0D 424F 5441 530D 424F 5445 4C0D"            /* SUNBOTASBOTEL */	$"424F 5445 530D 424F 5448 590D 424F 5454"            /* BOTESBOTHYBOTT */	$"450D 424F 5454 530D 424F 5454 590D 424F"            /* EBOTTSBOTTYBO */	$"5547 450D 424F 554B 530D 424F 554C 540D"            /* UGEBOUKSBOULT */	$"424F 554E 530D 424F 5552 440D 424F 5552"            /* BOUNSBOURDBOUR */	$"470D 424F 5552 4E0D 424F 5553 450D 424F"            /* GBOURNBOUSEBO */	$"5553 590D 424F 5554 530D 424F 5649 440D"            /* USYBOUTSBOVID */	$"424F 5741 540D 424F 5745 440D 424F 5745"            /* BOWATBOWEDBOWE */	$"520D 424F 5745 530D 424F 5745 540D 424F"            /* RBOWESBOWETBO */	$"5749 450D 424F 574C 530D 424F 574E 450D"            /* WIEBOWLSBOWNE */	$"424F 5752 530D 424F 5753 450D 424F 5845"            /* BOWRSBOWSEBOXE */	$"440D 424F 5845 4E0D 424F 5845 530D 424F"            /* DBOXENBOXESBO */	$"584C 410D 424F 5854 590D 424F 5941 520D"            /* XLABOXTYBOYAR */	$"424F 5941 550D 424F 5945 440D 424F 5946"            /* BOYAUBOYEDBOYF */	$"530D 424F 5947 530D 424F 594C 410D 424F"            /* SBOYGSBOYLABO */	$"594F 530D 424F 5953 590D 424F 5A4F 530D"            /* YOSBOYSYBOZOS */	$"4252 4141 490D 4252 4143 480D 4252 4143"            /* BRAAIBRACHBRAC */	$"4B0D 4252 4143 540D 4252 4144 530D 4252"            /* KBRACTBRADSBR */	$"4145 530D 4252 4147 530D 4252 4149 4C0D"            /* AESBRAGSBRAIL */	$"4252 414B 530D 4252 414B 590D 4252 414D"            /* BRAKSBRAKYBRAM */	$"450D 4252 414E 450D 4252 414E 4B0D 4252"            /* EBRANEBRANKBR */	$"414E 530D 4252 414E 540D 4252 4153 540D"            /* ANSBRANTBRAST */	$"4252 4154 530D 4252 4156 410D 4252 4156"            /* BRATSBRAVABRAV */	$"490D 4252 4157 530D 4252 4158 590D 4252"            /* IBRAWSBRAXYBR */	$"4159 530D 4252 415A 410D 4252 415A 450D"            /* AYSBRAZABRAZE */	$"4252 4541 4D0D 4252 4544 450D 4252 4544"            /* BREAMBREDEBRED */	$"530D 4252 4545 4D0D 4252 4545 520D 4252"            /* SBREEMBREERBR */	$"4545 530D 4252 4549 440D 4252 4549 530D"            /* EESBREIDBREIS */	$"4252 454D 450D 4252 454E 530D 4252 454E"            /* BREMEBRENSBREN */	$"540D 4252 4552 450D 4252 4552 530D 4252"            /* TBREREBRERSBR */	$"4556 450D 4252 4557 530D 4252 4559 530D"            /* EVEBREWSBREYS */	$"4252 4945 520D 4252 4945 530D 4252 4947"            /* BRIERBRIESBRIG */	$"530D 4252 494B 490D 4252 494B 530D 4252"            /* SBRIKIBRIKSBR */	$"494C 4C0D 4252 494D 530D 4252 494E 530D"            /* ILLBRIMSBRINS */	$"4252 494F 530D 4252 4953 450D 4252 4953"            /* BRIOSBRISEBRIS */	$"530D 4252 4954 480D 4252 4954 530D 4252"            /* SBRITHBRITSBR */	$"4954 540D 4252 495A 450D 4252 4F43 480D"            /* ITTBRIZEBROCH */	$"4252 4F43 4B0D 4252 4F44 530D 4252 4F47"            /* BROCKBRODSBROG */	$"480D 4252 4F47 530D 4252 4F4D 450D 4252"            /* HBROGSBROMEBR */	$"4F4D 4F0D 4252 4F4E 430D 4252 4F4E 440D"            /* OMOBRONCBROND */	$"4252 4F4F 4C0D 4252 4F4F 530D 4252 4F53"            /* BROOLBROOSBROS */	$"450D 4252 4F53 590D 4252 4F57 530D 4252"            /* EBROSYBROWSBR */	$"5547 480D 4252 5549 4E0D 4252 5549 540D"            /* UGHBRUINBRUIT */	$"4252 554C 450D 4252 554D 450D 4252 554E"            /* BRULEBRUMEBRUN */	$"470D 4252 5553 4B0D 4252 5553 540D 4252"            /* GBRUSKBRUSTBR */	$"5554 530D 4255 4154 530D 4255 415A 450D"            /* UTSBUATSBUAZE */	$"4255 4241 4C0D 4255 4241 530D 4255 4242"            /* BUBALBUBASBUBB */	$"410D 4255 4242 450D 4255 4242 590D 4255"            /* ABUBBEBUBBYBU */	$"4255 530D 4255 4348 550D 4255 434B 4F0D"            /* BUSBUCHUBUCKO */	$"4255 434B 530D 4255 434B 550D 4255 4441"            /* BUCKSBUCKUBUDA */	$"530D 4255 4449 530D 4255 444F 530D 4255"            /* SBUDISBUDOSBU */	$"4646 410D 4255 4646 450D 4255 4646 490D"            /* FFABUFFEBUFFI */	$"4255 4646 4F0D 4255 4646 530D 4255 4646"            /* BUFFOBUFFSBUFF */	$"590D 4255 464F 530D 4255 4654 590D 4255"            /* YBUFOSBUFTYBU */	$"484C 530D 4255 4852 530D 4255 494B 530D"            /* HLSBUHRSBUIKS */	$"4255 4953 540D 4255 4B45 530D 4255 4C42"            /* BUISTBUKESBULB */	$"530D 4255 4C47 590D 4255 4C4B 530D 4255"            /* SBULGYBULKSBU */	$"4C4C 410D 4255 4C4C 530D 4255 4C53 450D"            /* LLABULLSBULSE */	$"4255 4D42 4F0D 4255 4D46 530D 4255 4D50"            /* BUMBOBUMFSBUMP */	$"480D 4255 4D50 530D 4255 4D50 590D 4255"            /* HBUMPSBUMPYBU */	$"4E41 530D 4255 4E43 450D 4255 4E43 4F0D"            /* NASBUNCEBUNCO */	$"4255 4E44 450D 4255 4E44 480D 4255 4E44"            /* BUNDEBUNDHBUND */	$"530D 4255 4E44 540D 4255 4E44 550D 4255"            /* SBUNDTBUNDUBU */	$"4E44 590D 4255 4E47 530D 4255 4E47 590D"            /* NDYBUNGSBUNGY */	$"4255 4E49 410D 4255 4E4A 450D 4255 4E4A"            /* BUNIABUNJEBUNJ */	$"590D 4255 4E4B 4F0D 4255 4E4B 530D 4255"            /* YBUNKOBUNKSBU */	$"4E4E 530D 4255 4E54 530D 4255 4E54 590D"            /* NNSBUNTSBUNTY */	$"4255 4E59 410D 4255 4F59 530D 4255 5050"            /* BUNYABUOYSBUPP */	$"590D 4255 5241 4E0D 4255 5241 530D 4255"            /* YBURANBURASBU */	$"5242 530D 4255 5244 530D 4255 5245 540D"            /* RBSBURDSBURET */	$"4255 5246 490D 4255 5247 480D 4255 5247"            /* BURFIBURGHBURG */	$"530D 4255 5249 4E0D 4255 524B 410D 4255"            /* SBURINBURKABU */	$"524B 450D 4255 524B 530D 4255 524C 530D"            /* RKEBURKSBURLS */	$"4255 524E 530D 4255 524F 4F0D 4255 5250"            /* BURNSBUROOBURP */	$"530D 4255 5251 410D 4255 5252 4F0D 4255"            /* SBURQABURROBU */	$"5252 530D 4255 5252 590D 4255 5253 410D"            /* RRSBURRYBURSA */	$"4255 5253 450D 4255 5342 590D 4255 5345"            /* BURSEBUSBYBUSE */	$"530D 4255 534B 530D 4255 534B 590D 4255"            /* SBUSKSBUSKYBU */	$"5353 550D 4255 5354 490D 4255 5354 530D"            /* SSUBUSTIBUSTS */	$"4255 5354 590D 4255 5445 4F0D 4255 5445"            /* BUSTYBUTEOBUTE */	$"530D 4255 544C 450D 4255 544F 480D 4255"            /* SBUTLEBUTOHBU */	$"5454 530D 4255 5454 590D 4255 5455 540D"            /* TTSBUTTYBUTUT */	$"4255 5459 4C0D 4255 5A5A 590D 4257 414E"            /* BUTYLBUZZYBWAN */	$"410D 4257 415A 490D 4259 4445 440D 4259"            /* ABWAZIBYDEDBY */	$"4445 530D 4259 4B45 440D 4259 4B45 530D"            /* DESBYKEDBYKES */	$"4259 5245 530D 4259 524C 530D 4259 5353"            /* BYRESBYRLSBYSS */	$"490D 4259 5445 530D 4259 5741 590D 4341"            /* IBYTESBYWAYCA */	$"4145 440D 4341 4241 530D 4341 4245 520D"            /* AEDCABASCABER */	$"4341 424F 420D 4341 424F 430D 4341 4252"            /* CABOBCABOCCABR */	$"450D 4341 4341 530D 4341 434B 530D 4341"            /* ECACASCACKSCA */	$"434B 590D 4341 4445 450D 4341 4445 530D"            /* CKYCADEECADES */	$"4341 4447 450D 4341 4447 590D 4341 4449"            /* CADGECADGYCADI */	$"450D 4341 4449 530D 4341 4452 450D 4341"            /* ECADISCADRECA */	$"4543 410D 4341 4553 450D 4341 4645 530D"            /* ECACAESECAFES */	$"4341 4646 530D 4341 4745 440D 4341 4745"            /* CAFFSCAGEDCAGE */	$"520D 4341 4745 530D 4341 474F 540D 4341"            /* RCAGESCAGOTCA */	$"484F 570D 4341 4944 530D 4341 494E 530D"            /* HOWCAIDSCAINS */	$"4341 4952 440D 4341 4A4F 4E0D 4341 4A55"            /* CAIRDCAJONCAJU */	$"4E0D 4341 4B45 440D 4341 4B45 530D 4341"            /* NCAKEDCAKESCA */	$"4B45 590D 4341 4C46 530D 4341 4C49 440D"            /* KEYCALFSCALID */	$"4341 4C49 460D 4341 4C49 580D 4341 4C4B"            /* CALIFCALIXCALK */	$"530D 4341 4C4C 410D 4341 4C4C 530D 4341"            /* SCALLACALLSCA */	$"4C4D 530D 4341 4C4D 590D 4341 4C4F 530D"            /* LMSCALMYCALOS */	$"4341 4C50 410D 4341 4C50 530D 4341 4C56"            /* CALPACALPSCALV */	$"450D 4341 4C59 580D 4341 4D41 4E0D 4341"            /* ECALYXCAMANCA */	$"4D41 530D 4341 4D45 530D 4341 4D49 530D"            /* MASCAMESCAMIS */	$"4341 4D4F 530D 4341 4D50 490D 4341 4D50"            /* CAMOSCAMPICAMP */	$"4F0D 4341 4D50 530D 4341 4D50 590D 4341"            /* OCAMPSCAMPYCA */	$"4D55 530D 4341 4E45 440D 4341 4E45 480D"            /* MUSCANEDCANEH */	$"4341 4E45 520D 4341 4E45 530D 4341 4E47"            /* CANERCANESCANG */	$"530D 4341 4E49 440D 4341 4E4E 410D 4341"            /* SCANIDCANNACA */	$"4E4E 530D 4341 4E53 4F0D 4341 4E53 540D"            /* NNSCANSOCANST */	$"4341 4E54 4F0D 4341 4E54 530D 4341 4E54"            /* CANTOCANTSCANT */	$"590D 4341 5041 530D 4341 5045 440D 4341"            /* YCAPASCAPEDCA */	$"5045 530D 4341 5045 580D 4341 5048 530D"            /* PESCAPEXCAPHS */	$"4341 5049 5A0D 4341 504C 450D 4341 504F"            /* CAPIZCAPLECAPO */	$"4E0D 4341 504F 530D 4341 504F 540D 4341"            /* NCAPOSCAPOTCA */	$"5052 490D 4341 5055 4C0D 4341 5241 500D"            /* PRICAPULCARAP */	$"4341 5242 4F0D 4341 5242 530D 4341 5242"            /* CARBOCARBSCARB */	$"590D 4341 5244 490D 4341 5244 530D 4341"            /* YCARDICARDSCA */	$"5244 590D 4341 5245 440D 4341 5245 520D"            /* RDYCAREDCARER */	$"4341 5245 530D 4341 5245 540D 4341 5245"            /* CARESCARETCARE */	$"580D 4341 524B 530D 4341 524C 450D 4341"            /* XCARKSCARLECA */	$"524C 530D 4341 524E 530D 4341 524E 590D"            /* RLSCARNSCARNY */	$"4341 524F 420D 4341 524F 4D0D 4341 524F"            /* CAROBCAROMCARO */	$"4E0D 4341 5250 490D 4341 5250 530D 4341"            /* NCARPICARPSCA */	$"5252 530D 4341 5253 450D 4341 5254 410D"            /* RRSCARSECARTA */	$"4341 5254 450D 4341 5254 530D 4341 5256"            /* CARTECARTSCARV */	$"590D 4341 5341 530D 4341 5343 4F0D 4341"            /* YCASASCASCOCA */	$"5345 440D 4341 5345 530D 4341 534B 530D"            /* SEDCASESCASKS */	$"4341 534B 590D 4341 5354 530D 4341 5355"            /* CASKYCASTSCASU */	$"530D 4341 5445 530D 4341 5544 410D 4341"            /* SCATESCAUDACA */	$"554B 530D 4341 554C 440D 4341 554C 530D"            /* UKSCAULDCAULS */	$"4341 554D 530D 4341 5550 530D 4341 5552"            /* CAUMSCAUPSCAUR */	$"490D 4341 5553 410D 4341 5641 530D 4341"            /* ICAUSACAVASCA */	$"5645 440D 4341 5645 4C0D 4341 5645 520D"            /* VEDCAVELCAVER */	$"4341 5645 530D 4341 5649 450D 4341 5745"            /* CAVESCAVIECAWE */	$"440D 4341 574B 530D 4341 584F 4E0D 4345"            /* DCAWKSCAXONCE */	$"415A 450D 4345 4249 440D 4345 4341 4C0D"            /* AZECEBIDCECAL */	$"4345 4355 4D0D 4345 4445 440D 4345 4445"            /* CECUMCEDEDCEDE */	$"520D 4345 4445 530D 4345 4449 530D 4345"            /* RCEDESCEDISCE */	$"4942 410D 4345 494C 490D 4345 494C 530D"            /* IBACEILICEILS */	$"4345 4C45 420D 4345 4C4C 410D 4345 4C4C"            /* CELEBCELLACELL */	$"490D 4345 4C4C 530D 4345 4C4F 4D0D 4345"            /* ICELLSCELOMCE */	$"4C54 530D 4345 4E53 450D 4345 4E54 4F0D"            /* LTSCENSECENTO */	$"4345 4E54 530D 4345 4E54 550D 4345 4F52"            /* CENTSCENTUCEOR */	$"4C0D 4345 5045 530D 4345 5243 490D 4345"            /* LCEPESCERCICE */	$"5245 440D 4345 5245 530D 4345 5247 450D"            /* REDCERESCERGE */	$"4345 5249 410D 4345 5249 430D 4345 524E"            /* CERIACERICCERN */	$"450D 4345 524F 430D 4345 524F 530D 4345"            /* ECEROCCEROSCE */	$"5254 530D 4345 5254 590D 4345 5353 450D"            /* RTSCERTYCESSE */	$"4345 5354 410D 4345 5354 490D 4345 5445"            /* CESTACESTICETE */	$"530D 4345 5459 4C0D 4345 5A56 450D 4348"            /* SCETYLCEZVECH */	$"4143 450D 4348 4143 4B0D 4348 4143 4F0D"            /* ACECHACKCHACO */	$"4348 4144 4F0D 4348 4144 530D 4348 4146"            /* CHADOCHADSCHAF */	$"540D 4348 4149 530D 4348 414C 530D 4348"            /* TCHAISCHALSCH */	$"414D 530D 4348 414E 410D 4348 414E 470D"            /* AMSCHANACHANG */	$"4348 414E 4B0D 4348 4150 450D 4348 4150"            /* CHANKCHAPECHAP */	$"530D 4348 4150 540D 4348 4152 410D 4348"            /* SCHAPTCHARACH */	$"4152 450D 4348 4152 4B0D 4348 4152 520D"            /* ARECHARKCHARR */	$"4348 4152 530D 4348 4152 590D 4348 4154"            /* CHARSCHARYCHAT */	$"530D 4348 4156 450D 4348 4156 530D 4348"            /* SCHAVECHAVSCH */	$"4157 4B0D 4348 4157 530D 4348 4159 410D"            /* AWKCHAWSCHAYA */	$"4348 4159 530D 4348 4545 500D 4348 4546"            /* CHAYSCHEEPCHEF */	$"530D 4348 454B 410D 4348 454C 410D 4348"            /* SCHEKACHELACH */	$"454C 500D 4348 454D 4F0D 4348 454D 530D"            /* ELPCHEMOCHEMS */	$"4348 4552 450D 4348 4552 540D 4348 4554"            /* CHERECHERTCHET */	$"480D 4348 4556 590D 4348 4557 530D 4348"            /* HCHEVYCHEWSCH */	$"4557 590D 4348 4941 4F0D 4348 4941 530D"            /* EWYCHIAOCHIAS */	$"4348 4942 530D 4348 4943 410D 4348 4943"            /* CHIBSCHICACHIC */	$"480D 4348 4943 4F0D 4348 4943 530D 4348"            /* HCHICOCHICSCH */	$"4945 4C0D 4348 494B 530D 4348 494C 450D"            /* IELCHIKSCHILE */	$"4348 494D 420D 4348 494D 4F0D 4348 494D"            /* CHIMBCHIMOCHIM */	$"500D 4348 494E 450D 4348 494E 470D 4348"            /* PCHINECHINGCH */	$"494E 4B0D 4348 494E 4F0D 4348 494E 530D"            /* INKCHINOCHINS */	$"4348 4950 530D 4348 4952 4B0D 4348 4952"            /* CHIPSCHIRKCHIR */	$"4C0D 4348 4952 4D0D 4348 4952 4F0D 4348"            /* LCHIRMCHIROCH */	$"4952 520D 4348 4952 540D 4348 4952 550D"            /* IRRCHIRTCHIRU */	$"4348 4954 530D 4348 4956 450D 4348 4956"            /* CHITSCHIVECHIV */	$"530D 4348 4956 590D 4348 495A 5A0D 4348"            /* SCHIVYCHIZZCH */	$"4F43 4F0D 4348 4F43 530D 4348 4F44 450D"            /* OCOCHOCSCHODE */	$"4348 4F47 530D 4348 4F49 4C0D 4348 4F4B"            /* CHOGSCHOILCHOK */	$"4F0D 4348 4F4B 590D 4348 4F4C 410D 4348"            /* OCHOKYCHOLACH */	$"4F4C 490D 4348 4F4C 4F0D 4348 4F4D 500D"            /* OLICHOLOCHOMP */	$"4348 4F4E 530D 4348 4F4F 460D 4348 4F4F"            /* CHONSCHOOFCHOO */	$"4B0D 4348 4F4F 4D0D 4348 4F4F 4E0D 4348"            /* KCHOOMCHOONCH */	$"4F50 530D 4348 4F54 410D 4348 4F54 540D"            /* OPSCHOTACHOTT */	$"4348 4F55 540D 4348 4F55 580D 4348 4F57"            /* CHOUTCHOUXCHOW */	$"4B0D 4348 4F57 530D 4348 5542 530D 4348"            /* KCHOWSCHUBSCH */	$"5546 410D 4348 5546 460D 4348 5547 530D"            /* UFACHUFFCHUGS */	$"4348 554D 530D 4348 5552 4C0D 4348 5552"            /* CHUMSCHURLCHUR */	$"520D 4348 5553 450D 4348 5554 530D 4348"            /* RCHUSECHUTSCH */	$"594C 450D 4348 594D 450D 4348 594E 440D"            /* YLECHYMECHYND */	$"4349 424F 4C0D 4349 4445 440D 4349 4445"            /* CIBOLCIDEDCIDE */	$"530D 4349 454C 530D 4349 4747 590D 4349"            /* SCIELSCIGGYCI */	$"4C49 410D 4349 4C4C 530D 4349 4D41 520D"            /* LIACILLSCIMAR */	$"4349 4D45 580D 4349 4E43 540D 4349 4E45"            /* CIMEXCINCTCINE */	$"530D 4349 4E51 530D 4349 4F4E 530D 4349"            /* SCINQSCIONSCI */	$"5050 490D 4349 5243 530D 4349 5245 530D"            /* PPICIRCSCIRES */	$"4349 524C 530D 4349 5252 490D 4349 5343"            /* CIRLSCIRRICISC */	$"4F0D 4349 5353 590D 4349 5354 530D 4349"            /* OCISSYCISTSCI */	$"5441 4C0D 4349 5445 440D 4349 5445 520D"            /* TALCITEDCITER */	$"4349 5445 530D 4349 5645 530D 4349 5645"            /* CITESCIVESCIVE */	$"540D 4349 5649 450D 4349 5656 590D 434C"            /* TCIVIECIVVYCL */	$"4143 480D 434C 4144 450D 434C 4144 530D"            /* ACHCLADECLADS */	$"434C 4145 530D 434C 4147 530D 434C 414D"            /* CLAESCLAGSCLAM */	$"450D 434C 414D 530D 434C 414E 530D 434C"            /* ECLAMSCLANSCL */	$"4150 530D 434C 4150 540D 434C 4152 4F0D"            /* APSCLAPTCLARO */	$"434C 4152 540D 434C 4152 590D 434C 4153"            /* CLARTCLARYCLAS */	$"540D 434C 4154 530D 434C 4155 540D 434C"            /* TCLATSCLAUTCL */	$"4156 450D 434C 4156 490D 434C 4157 530D"            /* AVECLAVICLAWS */	$"434C 4159 530D 434C 4543 4B0D 434C 4545"            /* CLAYSCLECKCLEE */	$"4B0D 434C 4545 500D 434C 4546 530D 434C"            /* KCLEEPCLEFSCL */	$"4547 530D 434C 4549 4B0D 434C 454D 530D"            /* EGSCLEIKCLEMS */	$"434C 4550 450D 434C 4550 540D 434C 4556"            /* CLEPECLEPTCLEV */	$"450D 434C 4557 530D 434C 4945 440D 434C"            /* ECLEWSCLIEDCL */	$"4945 530D 434C 4946 540D 434C 494D 450D"            /* IESCLIFTCLIME */	$"434C 494E 450D 434C 494E 540D 434C 4950"            /* CLINECLINTCLIP */	$"450D 434C 4950 530D 434C 4950 540D 434C"            /* ECLIPSCLIPTCL */	$"4954 530D 434C 4F41 4D0D 434C 4F44 530D"            /* ITSCLOAMCLODS */	$"434C 4F46 460D 434C 4F47 530D 434C 4F4B"            /* CLOFFCLOGSCLOK */	$"450D 434C 4F4D 420D 434C 4F4D 500D 434C"            /* ECLOMBCLOMPCL */	$"4F4E 4B0D 434C 4F4E 530D 434C 4F4F 500D"            /* ONKCLONSCLOOP */	$"434C 4F4F 540D 434C 4F50 530D 434C 4F54"            /* CLOOTCLOPSCLOT */	$"450D 434C 4F54 530D 434C 4F55 520D 434C"            /* ECLOTSCLOURCL */	$"4F55 530D 434C 4F57 530D 434C 4F59 450D"            /* OUSCLOWSCLOYE */	$"434C 4F59 530D 434C 4F5A 450D 434C 5542"            /* CLOYSCLOZECLUB */	$"530D 434C 5545 530D 434C 5545 590D 434C"            /* SCLUESCLUEYCL */	$"554E 4B0D 434C 5950 450D 434E 4944 410D"            /* UNKCLYPECNIDA */	$"434F 4143 540D 434F 4144 590D 434F 414C"            /* COACTCOADYCOAL */	$"410D 434F 414C 530D 434F 414C 590D 434F"            /* ACOALSCOALYCO */	$"4150 540D 434F 4152 420D 434F 4154 450D"            /* APTCOARBCOATE */	$"434F 4154 490D 434F 4154 530D 434F 4242"            /* COATICOATSCOBB */	$"530D 434F 4242 590D 434F 4249 410D 434F"            /* SCOBBYCOBIACO */	$"424C 450D 434F 425A 410D 434F 4341 530D"            /* BLECOBZACOCAS */	$"434F 4343 490D 434F 4343 4F0D 434F 434B"            /* COCCICOCCOCOCK */	$"530D 434F 434B 590D 434F 434F 530D 434F"            /* SCOCKYCOCOSCO */	$"4441 530D 434F 4445 430D 434F 4445 440D"            /* DASCODECCODED */	$"434F 4445 4E0D 434F 4445 520D 434F 4445"            /* CODENCODERCODE */	$"530D 434F 4445 580D 434F 444F 4E0D 434F"            /* SCODEXCODONCO */	$"4544 530D 434F 4646 530D 434F 4749 450D"            /* EDSCOFFSCOGIE */	$"434F 474F 4E0D 434F 4755 450D 434F 4841"            /* COGONCOGUECOHA */	$"420D 434F 4845 4E0D 434F 484F 450D 434F"            /* BCOHENCOHOECO */	$"484F 470D 434F 484F 530D 434F 4946 530D"            /* HOGCOHOSCOIFS */	$"434F 4947 4E0D 434F 494C 530D 434F 494E"            /* COIGNCOILSCOIN */	$"530D 434F 4952 530D 434F 4954 530D 434F"            /* SCOIRSCOITSCO */	$"4B45 440D 434F 4B45 530D 434F 4C41 530D"            /* KEDCOKESCOLAS */	$"434F 4C42 590D 434F 4C44 530D 434F 4C45"            /* COLBYCOLDSCOLE */	$"440D 434F 4C45 530D 434F 4C45 590D 434F"            /* DCOLESCOLEYCO */	$"4C49 430D 434F 4C49 4E0D 434F 4C4C 530D"            /* LICCOLINCOLLS */	$"434F 4C4C 590D 434F 4C4F 470D 434F 4C54"            /* COLLYCOLOGCOLT */	$"530D 434F 4C5A 410D 434F 4D41 450D 434F"            /* SCOLZACOMAECO */	$"4D41 4C0D 434F 4D41 530D 434F 4D42 450D"            /* MALCOMASCOMBE */	$"434F 4D42 490D 434F 4D42 4F0D 434F 4D42"            /* COMBICOMBOCOMB */	$"530D 434F 4D42 590D 434F 4D45 520D 434F"            /* SCOMBYCOMERCO */	$"4D45 530D 434F 4D49 580D 434F 4D4D 4F0D"            /* MESCOMIXCOMMO */	$"434F 4D4D 530D 434F 4D4D 590D 434F 4D50"            /* COMMSCOMMYCOMP */	$"4F0D 434F 4D50 530D 434F 4D50 540D 434F"            /* OCOMPSCOMPTCO */	$"4D54 450D 434F 4D55 530D 434F 4E45 440D"            /* MTECOMUSCONED */	$"434F 4E45 530D 434F 4E45 590D 434F 4E46"            /* CONESCONEYCONF */	$"530D 434F 4E47 410D 434F 4E47 450D 434F"            /* SCONGACONGECO */	$"4E47 4F0D 434F 4E49 410D 434F 4E49 4E0D"            /* NGOCONIACONIN */	$"434F 4E4B 530D 434F 4E4B 590D 434F 4E4E"            /* CONKSCONKYCONN */	$"450D 434F 4E4E 530D 434F 4E54 450D 434F"            /* ECONNSCONTECO */	$"4E54 4F0D 434F 4E55 530D 434F 4E56 4F0D"            /* NTOCONUSCONVO */	$"434F 4F43 480D 434F 4F45 440D 434F 4F45"            /* COOCHCOOEDCOOE */	$"450D 434F 4F45 520D 434F 4F45 590D 434F"            /* ECOOERCOOEYCO */	$"4F46 530D 434F 4F4B 530D 434F 4F4B 590D"            /* OFSCOOKSCOOKY */	$"434F 4F4C 530D 434F 4F4C 590D 434F 4F4D"            /* COOLSCOOLYCOOM */	$"420D 434F 4F4D 530D 434F 4F4D 590D 434F"            /* BCOOMSCOOMYCO */	$"4F4E 530D 434F 4F50 530D 434F 4F50 540D"            /* ONSCOOPSCOOPT */	$"434F 4F53 540D 434F 4F54 530D 434F 4F5A"            /* COOSTCOOTSCOOZ */	$"450D 434F 5041 4C0D 434F 5041 590D 434F"            /* ECOPALCOPAYCO */	$"5045 440D 434F 5045 4E0D 434F 5045 520D"            /* PEDCOPENCOPER */	$"434F 5045 530D 434F 5050 590D 434F 5052"            /* COPESCOPPYCOPR */	$"410D 434F 5053 590D 434F 5155 490D 434F"            /* ACOPSYCOQUICO */	$"5241 4D0D 434F 5242 450D 434F 5242 590D"            /* RAMCORBECORBY */	$"434F 5244 530D 434F 5245 440D 434F 5245"            /* CORDSCOREDCORE */	$"530D 434F 5245 590D 434F 5247 490D 434F"            /* SCOREYCORGICO */	$"5249 410D 434F 524B 530D 434F 524B 590D"            /* RIACORKSCORKY */	$"434F 524D 530D 434F 524E 490D 434F 524E"            /* CORMSCORNICORN */	$"4F0D 434F 524E 530D 434F 524E 550D 434F"            /* OCORNSCORNUCO */	$"5250 530D 434F 5253 450D 434F 5253 4F0D"            /* RPSCORSECORSO */	$"434F 5345 430D 434F 5345 440D 434F 5345"            /* COSECCOSEDCOSE */	$"530D 434F 5345 540D 434F 5345 590D 434F"            /* SCOSETCOSEYCO */	$"5349 450D 434F 5354 410D 434F 5354 450D"            /* SIECOSTACOSTE */	$"434F 5354 530D 434F 5441 4E0D 434F 5445"            /* COSTSCOTANCOTE */	$"440D 434F 5445 530D 434F 5448 530D 434F"            /* DCOTESCOTHSCO */	$"5454 410D 434F 5454 530D 434F 5544 450D"            /* TTACOTTSCOUDE */	$"434F 5550 530D 434F 5552 420D 434F 5552"            /* COUPSCOURBCOUR */	$"440D 434F 5552 450D 434F 5552 530D 434F"            /* DCOURECOURSCO */	$"5554 410D 434F 5554 480D 434F 5645 440D"            /* UTACOUTHCOVED */	$"434F 5645 530D 434F 5649 4E0D 434F 5741"            /* COVESCOVINCOWA */	$"4C0D 434F 5741 4E0D 434F 5745 440D 434F"            /* LCOWANCOWEDCO */	$"574B 530D 434F 574C 530D 434F 5750 530D"            /* WKSCOWLSCOWPS */	$"434F 5752 590D 434F 5841 450D 434F 5841"            /* COWRYCOXAECOXA */	$"4C0D 434F 5845 440D 434F 5845 530D 434F"            /* LCOXEDCOXESCO */	$"5849 420D 434F 5941 550D 434F 5945 440D"            /* XIBCOYAUCOYED */	$"434F 5945 520D 434F 5950 550D 434F 5A45"            /* COYERCOYPUCOZE */	$"440D 434F 5A45 4E0D 434F 5A45 530D 434F"            /* DCOZENCOZESCO */	$"5A45 590D 434F 5A49 450D 4352 4141 4C0D"            /* ZEYCOZIECRAAL */	$"4352 4142 530D 4352 4147 530D 4352 4149"            /* CRABSCRAGSCRAI */	$"430D 4352 4149 470D 4352 414B 450D 4352"            /* CCRAIGCRAKECR */	$"414D 450D 4352 414D 530D 4352 414E 530D"            /* AMECRAMSCRANS */	$"4352 4150 450D 4352 4150 530D 4352 4150"            /* CRAPECRAPSCRAP */	$"590D 4352 4152 450D 4352 4157 530D 4352"            /* YCRARECRAWSCR */	$"4159 530D 4352 4544 530D 4352 4545 4C0D"            /* AYSCREDSCREEL */	$"4352 4545 530D 4352 454D 530D 4352 454E"            /* CREESCREMSCREN */	$"410D 4352 4550 530D 4352 4550 590D 4352"            /* ACREPSCREPYCR */	$"4557 450D 4352 4557 530D 4352 4941 530D"            /* EWECREWSCRIAS */	$"4352 4942 530D 4352 4945 530D 4352 494D"            /* CRIBSCRIESCRIM */	$"530D 4352 494E 450D 4352 494F 530D 4352"            /* SCRINECRIOSCR */	$"4950 450D 4352 4950 530D 4352 4953 450D"            /* IPECRIPSCRISE */	$"4352 4954 480D 4352 4954 530D 4352 4F43"            /* CRITHCRITSCROC */	$"490D 4352 4F43 530D 4352 4F46 540D 4352"            /* ICROCSCROFTCR */	$"4F47 530D 4352 4F4D 420D 4352 4F4D 450D"            /* OGSCROMBCROME */	$"4352 4F4E 4B0D 4352 4F4E 530D 4352 4F4F"            /* CRONKCRONSCROO */	$"4C0D 4352 4F4F 4E0D 4352 4F50 530D 4352"            /* LCROONCROPSCR */	$"4F52 450D 4352 4F53 540D 4352 4F55 540D"            /* ORECROSTCROUT */	$"4352 4F57 530D 4352 4F5A 450D 4352 5543"            /* CROWSCROZECRUC */	$"4B0D 4352 5544 4F0D 4352 5544 530D 4352"            /* KCRUDOCRUDSCR */	$"5544 590D 4352 5545 530D 4352 5545 540D"            /* UDYCRUESCRUET */	$"4352 5546 540D 4352 554E 4B0D 4352 554F"            /* CRUFTCRUNKCRUO */	$"520D 4352 5552 410D 4352 5553 450D 4352"            /* RCRURACRUSECR */	$"5553 590D 4352 5556 450D 4352 5754 480D"            /* USYCRUVECRWTH */	$"4352 5945 520D 4354 454E 450D 4355 4242"            /* CRYERCTENECUBB */	$"590D 4355 4245 420D 4355 4245 440D 4355"            /* YCUBEBCUBEDCU */	$"4245 520D 4355 4245 530D 4355 4249 540D"            /* BERCUBESCUBIT */	$"4355 4444 590D 4355 4646 4F0D 4355 4646"            /* CUDDYCUFFOCUFF */	$"530D 4355 4946 530D 4355 494E 470D 4355"            /* SCUIFSCUINGCU */	$"4953 480D 4355 4954 530D 4355 4B45 530D"            /* ISHCUITSCUKES */	$"4355 4C43 480D 4355 4C45 540D 4355 4C45"            /* CULCHCULETCULE */	$"580D 4355 4C4C 530D 4355 4C4C 590D 4355"            /* XCULLSCULLYCU */	$"4C4D 530D 4355 4C50 410D 4355 4C54 490D"            /* LMSCULPACULTI */	$"4355 4C54 530D 4355 4C54 590D 4355 4D45"            /* CULTSCULTYCUME */	$"430D 4355 4E44 590D 4355 4E45 490D 4355"            /* CCUNDYCUNEICU */	$"4E49 540D 4355 4E54 530D 4355 5045 4C0D"            /* NITCUNTSCUPEL */	$"4355 5049 440D 4355 5050 410D 4355 5050"            /* CUPIDCUPPACUPP */	$"590D 4355 5241 540D 4355 5242 530D 4355"            /* YCURATCURBSCU */	$"5243 480D 4355 5244 530D 4355 5244 590D"            /* RCHCURDSCURDY */	$"4355 5245 440D 4355 5245 520D 4355 5245"            /* CUREDCURERCURE */	$"530D 4355 5245 540D 4355 5246 530D 4355"            /* SCURETCURFSCU */	$"5249 410D 4355 5249 450D 4355 524C 490D"            /* RIACURIECURLI */	$"4355 524C 530D 4355 524E 530D 4355 524E"            /* CURLSCURNSCURN */	$"590D 4355 5252 530D 4355 5253 490D 4355"            /* YCURRSCURSICU */	$"5253 540D 4355 5345 430D 4355 5348 590D"            /* RSTCUSECCUSHY */	$"4355 534B 530D 4355 5350 530D 4355 5350"            /* CUSKSCUSPSCUSP */	$"590D 4355 5353 4F0D 4355 5355 4D0D 4355"            /* YCUSSOCUSUMCU */	$"5443 480D 4355 5445 520D 4355 5445 530D"            /* TCHCUTERCUTES */	$"4355 5445 590D 4355 5449 4E0D 4355 5449"            /* CUTEYCUTINCUTI */	$"530D 4355 5454 4F0D 4355 5454 590D 4355"            /* SCUTTOCUTTYCU */	$"5455 500D 4355 5645 450D 4355 5A45 530D"            /* TUPCUVEECUZES */	$"4357 5443 480D 4359 414E 4F0D 4359 414E"            /* CWTCHCYANOCYAN */	$"530D 4359 4341 440D 4359 4341 530D 4359"            /* SCYCADCYCASCY */	$"434C 4F0D 4359 4445 520D 4359 4C49 580D"            /* CLOCYDERCYLIX */	$"4359 4D41 450D 4359 4D41 520D 4359 4D41"            /* CYMAECYMARCYMA */	$"530D 4359 4D45 530D 4359 4D4F 4C0D 4359"            /* SCYMESCYMOLCY */	$"5354 530D 4359 5445 530D 4359 544F 4E0D"            /* STSCYTESCYTON */	$"435A 4152 530D 4441 414C 530D 4441 4242"            /* CZARSDAALSDABB */	$"410D 4441 4345 530D 4441 4348 410D 4441"            /* ADACESDACHADA */	$"434B 530D 4441 4441 480D 4441 4441 530D"            /* CKSDADAHDADAS */	$"4441 444F 530D 4441 4646 530D 4441 4646"            /* DADOSDAFFSDAFF */	$"590D 4441 4747 410D 4441 4747 590D 4441"            /* YDAGGADAGGYDA */	$"474F 530D 4441 484C 530D 4441 494B 4F0D"            /* GOSDAHLSDAIKO */	$"4441 494E 450D 4441 494E 540D 4441 4B45"            /* DAINEDAINTDAKE */	$"520D 4441 4C45 440D 4441 4C45 530D 4441"            /* RDALEDDALESDA */	$"4C49 530D 4441 4C4C 450D 4441 4C54 530D"            /* LISDALLEDALTS */	$"4441 4D41 4E0D 4441 4D41 520D 4441 4D45"            /* DAMANDAMARDAME */	$"530D 4441 4D4D 450D 4441 4D4E 530D 4441"            /* SDAMMEDAMNSDA */	$"4D50 530D 4441 4D50 590D 4441 4E43 590D"            /* MPSDAMPYDANCY */	$"4441 4E47 530D 4441 4E49 4F0D 4441 4E4B"            /* DANGSDANIODANK */	$"530D 4441 4E4E 590D 4441 4E54 530D 4441"            /* SDANNYDANTSDA */	$"5241 460D 4441 5242 530D 4441 5243 590D"            /* RAFDARBSDARCY */	$"4441 5245 440D 4441 5245 520D 4441 5245"            /* DAREDDARERDARE */	$"530D 4441 5247 410D 4441 5247 530D 4441"            /* SDARGADARGSDA */	$"5249 430D 4441 5249 530D 4441 524B 530D"            /* RICDARISDARKS */	$"4441 524B 590D 4441 524E 530D 4441 5252"            /* DARKYDARNSDARR */	$"450D 4441 5254 530D 4441 525A 490D 4441"            /* EDARTSDARZIDA */	$"5348 490D 4441 5348 590D 4441 5441 4C0D"            /* SHIDASHYDATAL */	$"4441 5445 440D 4441 5445 520D 4441 5445"            /* DATEDDATERDATE */	$"530D 4441 544F 530D 4441 5454 4F0D 4441"            /* SDATOSDATTODA */	$"5542 450D 4441 5542 530D 4441 5542 590D"            /* UBEDAUBSDAUBY */	$"4441 5544 530D 4441 554C 540D 4441 5552"            /* DAUDSDAULTDAUR */	$"530D 4441 5554 530D 4441 5645 4E0D 4441"            /* SDAUTSDAVENDA */	$"5649 540D 4441 5741 480D 4441 5744 530D"            /* VITDAWAHDAWDS */	$"4441 5745 440D 4441 5745 4E0D 4441 574B"            /* DAWEDDAWENDAWK */	$"530D 4441 574E 530D 4441 5754 530D 4441"            /* SDAWNSDAWTSDA */	$"5941 4E0D 4441 5943 480D 4441 594E 540D"            /* YANDAYCHDAYNT */	$"4441 5A45 440D 4441 5A45 520D 4441 5A45"            /* DAZEDDAZERDAZE */	$"530D 4445 4144 530D 4445 4149 520D 4445"            /* SDEADSDEAIRDE */	$"414C 530D 4445 414E 530D 4445 4152 450D"            /* ALSDEANSDEARE */	$"4445 4152 4E0D 4445 4152 530D 4445 4152"            /* DEARNDEARSDEAR */	$"590D 4445 4153 480D 4445 4156 450D 4445"            /* YDEASHDEAVEDE */	$"4157 530D 4445 4157 590D 4445 4241 470D"            /* AWSDEAWYDEBAG */	$"4445 4242 590D 4445 4245 4C0D 4445 4245"            /* DEBBYDEBELDEBE */	$"530D 4445 4254 530D 4445 4255 440D 4445"            /* SDEBTSDEBUDDE */	$"4255 520D 4445 4255 530D 4445 4259 450D"            /* BURDEBUSDEBYE */	$"4445 4341 440D 4445 4341 460D 4445 4341"            /* DECADDECAFDECA */	$"4E0D 4445 434B 4F0D 4445 434B 530D 4445"            /* NDECKODECKSDE */	$"434F 530D 4445 4441 4C0D 4445 4544 530D"            /* COSDEDALDEEDS */	$"4445 4544 590D 4445 454C 590D 4445 454D"            /* DEEDYDEELYDEEM */	$"530D 4445 454E 530D 4445 4550 530D 4445"            /* SDEENSDEEPSDE */	$"4552 450D 4445 4552 530D 4445 4554 530D"            /* EREDEERSDEETS */	$"4445 4556 450D 4445 4556 530D 4445 4641"            /* DEEVEDEEVSDEFA */	$"540D 4445 4646 4F0D 4445 4649 530D 4445"            /* TDEFFODEFISDE */	$"464F 470D 4445 4741 530D 4445 4755 4D0D"            /* FOGDEGASDEGUM */	$"4445 4755 530D 4445 4943 450D 4445 4944"            /* DEGUSDEICEDEID */	$"530D 4445 4946 590D 4445 494C 530D 4445"            /* SDEIFYDEILSDE */	$"4953 4D0D 4445 4953 540D 4445 4B45 440D"            /* ISMDEISTDEKED */	$"4445 4B45 530D 4445 4B4B 4F0D 4445 4C45"            /* DEKESDEKKODELE */	$"440D 4445 4C45 530D 4445 4C46 530D 4445"            /* DDELESDELFSDE */	$"4C46 540D 4445 4C49 530D 4445 4C4C 530D"            /* LFTDELISDELLS */	$"4445 4C4C 590D 4445 4C4F 530D 4445 4C50"            /* DELLYDELOSDELP */	$"480D 4445 4C54 530D 4445 4D41 4E0D 4445"            /* HDELTSDEMANDE */	$"4D45 530D 4445 4D49 430D 4445 4D49 540D"            /* MESDEMICDEMIT */	$"4445 4D4F 420D 4445 4D4F 490D 4445 4D4F"            /* DEMOBDEMOIDEMO */	$"530D 4445 4D50 540D 4445 4E41 520D 4445"            /* SDEMPTDENARDE */	$"4E41 590D 4445 4E43 480D 4445 4E45 530D"            /* NAYDENCHDENES */	$"4445 4E45 540D 4445 4E49 530D 4445 4E54"            /* DENETDENISDENT */	$"530D 4445 4F58 590D 4445 5241 540D 4445"            /* SDEOXYDERATDE */	$"5241 590D 4445 5245 440D 4445 5245 530D"            /* RAYDEREDDERES */	$"4445 5249 470D 4445 524D 410D 4445 524D"            /* DERIGDERMADERM */	$"530D 4445 524E 530D 4445 524E 590D 4445"            /* SDERNSDERNYDE */	$"524F 530D 4445 5252 4F0D 4445 5252 590D"            /* ROSDERRODERRY */	$"4445 5254 480D 4445 5256 530D 4445 5345"            /* DERTHDERVSDESE */	$"580D 4445 5348 490D 4445 5349 530D 4445"            /* XDESHIDESISDE */	$"534B 530D 4445 5353 450D 4445 5641 530D"            /* SKSDESSEDEVAS */	$"4445 5645 4C0D 4445 5649 530D 4445 564F"            /* DEVELDEVISDEVO */	$"4E0D 4445 564F 530D 4445 564F 540D 4445"            /* NDEVOSDEVOTDE */	$"5741 4E0D 4445 5741 520D 4445 5741 580D"            /* WANDEWARDEWAX */	$"4445 5745 440D 4445 5845 530D 4445 5849"            /* DEWEDDEXESDEXI */	$"450D 4448 4142 410D 4448 414B 530D 4448"            /* EDHABADHAKSDH */	$"414C 530D 4448 494B 520D 4448 4F42 490D"            /* ALSDHIKRDHOBI */	$"4448 4F4C 450D 4448 4F4C 4C0D 4448 4F4C"            /* DHOLEDHOLLDHOL */	$"530D 4448 4F54 490D 4448 4F57 530D 4448"            /* SDHOTIDHOWSDH */	$"5554 490D 4449 4143 540D 4449 414C 530D"            /* UTIDIACTDIALS */	$"4449 414E 450D 4449 415A 4F0D 4449 4242"            /* DIANEDIAZODIBB */	$"530D 4449 4345 440D 4449 4345 520D 4449"            /* SDICEDDICERDI */	$"4345 530D 4449 4348 540D 4449 434B 530D"            /* CESDICHTDICKS */	$"4449 434B 590D 4449 434F 540D 4449 4354"            /* DICKYDICOTDICT */	$"410D 4449 4354 530D 4449 4354 590D 4449"            /* ADICTSDICTYDI */	$"4444 590D 4449 4449 450D 4449 444F 530D"            /* DDYDIDIEDIDOS */	$"4449 4453 540D 4449 4542 530D 4449 454C"            /* DIDSTDIEBSDIEL */	$"530D 4449 454E 450D 4449 4554 530D 4449"            /* SDIENEDIETSDI */	$"4646 530D 4449 4748 540D 4449 4B41 530D"            /* FFSDIGHTDIKAS */	$"4449 4B45 440D 4449 4B45 520D 4449 4B45"            /* DIKEDDIKERDIKE */	$"530D 4449 4B45 590D 4449 4C44 4F0D 4449"            /* SDIKEYDILDODI */	$"4C4C 490D 4449 4C4C 530D 4449 4D42 4F0D"            /* LLIDILLSDIMBO */	$"4449 4D45 520D 4449 4D45 530D 4449 4D50"            /* DIMERDIMESDIMP */	$"530D 4449 4E41 520D 4449 4E45 440D 4449"            /* SDINARDINEDDI */	$"4E45 530D 4449 4E47 450D 4449 4E47 530D"            /* NESDINGEDINGS */	$"4449 4E49 430D 4449 4E4B 530D 4449 4E4B"            /* DINICDINKSDINK */	$"590D 4449 4E4E 410D 4449 4E4F 530D 4449"            /* YDINNADINOSDI */	$"4E54 530D 4449 4F4C 530D 4449 4F54 410D"            /* NTSDIOLSDIOTA */	$"4449 5050 590D 4449 5053 4F0D 4449 5241"            /* DIPPYDIPSODIRA */	$"4D0D 4449 5245 520D 4449 524B 450D 4449"            /* MDIRERDIRKEDI */	$"524B 530D 4449 524C 530D 4449 5254 530D"            /* RKSDIRLSDIRTS */	$"4449 5341 530D 4449 5343 490D 4449 5343"            /* DISASDISCIDISC */	$"530D 4449 5348 590D 4449 534B 530D 4449"            /* SDISHYDISKSDI */	$"534D 450D 4449 5441 4C0D 4449 5441 530D"            /* SMEDITALDITAS */	$"4449 5445 440D 4449 5445 530D 4449 5453"            /* DITEDDITESDITS */	$"590D 4449 5454 530D 4449 545A 590D 4449"            /* YDITTSDITZYDI */	$"5641 4E0D 4449 5641 530D 4449 5645 440D"            /* VANDIVASDIVED */	$"4449 5645 530D 4449 5649 530D 4449 564E"            /* DIVESDIVISDIVN */	$"410D 4449 564F 530D 4449 564F 540D 4449"            /* ADIVOSDIVOTDI */	$"5656 590D 4449 5741 4E0D 4449 5849 450D"            /* VVYDIWANDIXIE */	$"4449 5849 540D 4449 5941 530D 4449 5A45"            /* DIXITDIYASDIZE */	$"4E0D 444A 494E 4E0D 444A 494E 530D 444F"            /* NDJINNDJINSDO */	$"4142 530D 444F 4154 530D 444F 4242 590D"            /* ABSDOATSDOBBY */	$"444F 4245 530D 444F 4249 450D 444F 424C"            /* DOBESDOBIEDOBL */	$"410D 444F 4252 410D 444F 4252 4F0D 444F"            /* ADOBRADOBRODO */	$"4348 540D 444F 434B 530D 444F 434F 530D"            /* CHTDOCKSDOCOS */	$"444F 4355 530D 444F 4444 590D 444F 444F"            /* DOCUSDODDYDODO */	$"530D 444F 454B 530D 444F 4552 530D 444F"            /* SDOEKSDOERSDO */	$"4553 540D 444F 4554 480D 444F 4646 530D"            /* ESTDOETHDOFFS */	$"444F 4741 4E0D 444F 4745 530D 444F 4745"            /* DOGANDOGESDOGE */	$"590D 444F 4747 4F0D 444F 4747 590D 444F"            /* YDOGGODOGGYDO */	$"4749 450D 444F 4859 4F0D 444F 494C 540D"            /* GIEDOHYODOILT */	$"444F 494C 590D 444F 4954 530D 444F 4A4F"            /* DOILYDOITSDOJO */	$"530D 444F 4C43 450D 444F 4C43 490D 444F"            /* SDOLCEDOLCIDO */	$"4C45 440D 444F 4C45 530D 444F 4C49 410D"            /* LEDDOLESDOLIA */	$"444F 4C4C 530D 444F 4C4D 410D 444F 4C4F"            /* DOLLSDOLMADOLO */	$"520D 444F 4C4F 530D 444F 4C54 530D 444F"            /* RDOLOSDOLTSDO */	$"4D41 4C0D 444F 4D45 440D 444F 4D45 530D"            /* MALDOMEDDOMES */	$"444F 4D49 430D 444F 4E41 480D 444F 4E41"            /* DOMICDONAHDONA */	$"530D 444F 4E45 450D 444F 4E45 520D 444F"            /* SDONEEDONERDO */	$"4E47 410D 444F 4E47 530D 444F 4E4B 4F0D"            /* NGADONGSDONKO */	$"444F 4E4E 410D 444F 4E4E 450D 444F 4E4E"            /* DONNADONNEDONN */	$"590D 444F 4E53 590D 444F 4F42 530D 444F"            /* YDONSYDOOBSDO */	$"4F43 450D 444F 4F44 590D 444F 4F4B 530D"            /* OCEDOODYDOOKS */	$"444F 4F4C 450D 444F 4F4C 530D 444F 4F4C"            /* DOOLEDOOLSDOOL */	$"590D 444F 4F4D 530D 444F 4F4D 590D 444F"            /* YDOOMSDOOMYDO */	$"4F4E 410D 444F 4F52 4E0D 444F 4F52 530D"            /* ONADOORNDOORS */	$"444F 4F5A 590D 444F 5041 530D 444F 5045"            /* DOOZYDOPASDOPE */	$"440D 444F 5045 520D 444F 5045 530D 444F"            /* DDOPERDOPESDO */	$"5241 440D 444F 5242 410D 444F 5242 530D"            /* RADDORBADORBS */	$"444F 5245 450D 444F 5245 530D 444F 5249"            /* DOREEDORESDORI */	$"430D 444F 5249 530D 444F 524B 530D 444F"            /* CDORISDORKSDO */	$"524B 590D 444F 524D 530D 444F 524D 590D"            /* RKYDORMSDORMY */	$"444F 5250 530D 444F 5252 530D 444F 5253"            /* DORPSDORRSDORS */	$"410D 444F 5253 450D 444F 5254 530D 444F"            /* ADORSEDORTSDO */	$"5254 590D 444F 5341 490D 444F 5341 530D"            /* RTYDOSAIDOSAS */	$"444F 5345 440D 444F 5345 480D 444F 5345"            /* DOSEDDOSEHDOSE */	$"520D 444F 5345 530D 444F 5348 410D 444F"            /* RDOSESDOSHADO */	$"5441 4C0D 444F 5445 440D 444F 5445 520D"            /* TALDOTEDDOTER */	$"444F 5445 530D 444F 5454 590D 444F 5541"            /* DOTESDOTTYDOUA */	$"520D 444F 5543 450D 444F 5543 530D 444F"            /* RDOUCEDOUCSDO */	$"554B 530D 444F 554C 410D 444F 554D 410D"            /* UKSDOULADOUMA */	$"444F 554D 530D 444F 5550 530D 444F 5552"            /* DOUMSDOUPSDOUR */	$"410D 444F 5553 450D 444F 5554 530D 444F"            /* ADOUSEDOUTSDO */	$"5645 440D 444F 5645 4E0D 444F 5645 520D"            /* VEDDOVENDOVER */	$"444F 5645 530D 444F 5649 450D 444F 5741"            /* DOVESDOVIEDOWA */	$"520D 444F 5744 530D 444F 5745 440D 444F"            /* RDOWDSDOWEDDO */	$"5745 520D 444F 5749 450D 444F 574C 450D"            /* WERDOWIEDOWLE */	$"444F 574C 530D 444F 574C 590D 444F 574E"            /* DOWLSDOWLYDOWN */	$"410D 444F 574E 530D 444F 5750 530D 444F"            /* ADOWNSDOWPSDO */	$"5753 450D 444F 5754 530D 444F 5845 440D"            /* WSEDOWTSDOXED */	$"444F 5845 530D 444F 5849 450D 444F 5945"            /* DOXESDOXIEDOYE */	$"4E0D 444F 594C 590D 444F 5A45 440D 444F"            /* NDOYLYDOZEDDO */	$"5A45 520D 444F 5A45 530D 4452 4142 530D"            /* ZERDOZESDRABS */	$"4452 4143 4B0D 4452 4143 4F0D 4452 4146"            /* DRACKDRACODRAF */	$"460D 4452 4147 530D 4452 4149 4C0D 4452"            /* FDRAGSDRAILDR */	$"414D 530D 4452 414E 540D 4452 4150 530D"            /* AMSDRANTDRAPS */	$"4452 4154 530D 4452 4156 450D 4452 4157"            /* DRATSDRAVEDRAW */	$"530D 4452 4159 530D 4452 4541 520D 4452"            /* SDRAYSDREARDR */	$"4543 4B0D 4452 4545 440D 4452 4545 520D"            /* ECKDREEDDREER */	$"4452 4545 530D 4452 4547 530D 4452 454B"            /* DREESDREGSDREK */	$"530D 4452 454E 540D 4452 4552 450D 4452"            /* SDRENTDREREDR */	$"4553 540D 4452 4559 530D 4452 4942 530D"            /* ESTDREYSDRIBS */	$"4452 4943 450D 4452 4945 530D 4452 494C"            /* DRICEDRIESDRIL */	$"590D 4452 4950 530D 4452 4950 540D 4452"            /* YDRIPSDRIPTDR */	$"4F49 440D 4452 4F49 4C0D 4452 4F4B 450D"            /* OIDDROILDROKE */	$"4452 4F4C 450D 4452 4F4D 450D 4452 4F4E"            /* DROLEDROMEDRON */	$"590D 4452 4F4F 420D 4452 4F4F 470D 4452"            /* YDROOBDROOGDR */	$"4F4F 4B0D 4452 4F50 530D 4452 4F50 540D"            /* OOKDROPSDROPT */	$"4452 4F55 4B0D 4452 4F57 530D 4452 5542"            /* DROUKDROWSDRUB */	$"530D 4452 5547 530D 4452 554D 530D 4452"            /* SDRUGSDRUMSDR */	$"5550 450D 4452 5553 450D 4452 5553 590D"            /* UPEDRUSEDRUSY */	$"4452 5558 590D 4452 5941 440D 4452 5941"            /* DRUXYDRYADDRYA */	$"530D 4453 4F42 4F0D 4453 4F4D 4F0D 4455"            /* SDSOBODSOMODU */	$"4144 530D 4455 414C 530D 4455 414E 530D"            /* ADSDUALSDUANS */	$"4455 4152 530D 4455 4242 4F0D 4455 4341"            /* DUARSDUBBODUCA */	$"4C0D 4455 4341 540D 4455 4345 530D 4455"            /* LDUCATDUCESDU */	$"434B 530D 4455 434B 590D 4455 4354 530D"            /* CKSDUCKYDUCTS */	$"4455 4444 590D 4455 4445 440D 4455 4445"            /* DUDDYDUDEDDUDE */	$"530D 4455 454C 530D 4455 4554 530D 4455"            /* SDUELSDUETSDU */	$"4554 540D 4455 4646 530D 4455 4655 530D"            /* ETTDUFFSDUFUS */	$"4455 494E 470D 4455 4954 530D 4455 4B41"            /* DUINGDUITSDUKA */	$"530D 4455 4B45 440D 4455 4B45 530D 4455"            /* SDUKEDDUKESDU */	$"4B4B 410D 4455 4C43 450D 4455 4C45 530D"            /* KKADULCEDULES */	$"4455 4C49 410D 4455 4C4C 530D 4455 4C53"            /* DULIADULLSDULS */	$"450D 4455 4D41 530D 4455 4D42 4F0D 4455"            /* EDUMASDUMBODU */	$"4D42 530D 4455 4D4B 410D 4455 4D4B 590D"            /* MBSDUMKADUMKY */	$"4455 4D50 530D 4455 4E41 4D0D 4455 4E43"            /* DUMPSDUNAMDUNC */	$"480D 4455 4E45 530D 4455 4E47 530D 4455"            /* HDUNESDUNGSDU */	$"4E47 590D 4455 4E4B 530D 4455 4E4E 4F0D"            /* NGYDUNKSDUNNO */	$"4455 4E4E 590D 4455 4E53 480D 4455 4E54"            /* DUNNYDUNSHDUNT */	$"530D 4455 4F4D 490D 4455 4F4D 4F0D 4455"            /* SDUOMIDUOMODU */	$"5045 440D 4455 5045 520D 4455 5045 530D"            /* PEDDUPERDUPES */	$"4455 504C 450D 4455 504C 590D 4455 5050"            /* DUPLEDUPLYDUPP */	$"590D 4455 5241 4C0D 4455 5241 530D 4455"            /* YDURALDURASDU */	$"5245 440D 4455 5245 530D 4455 5247 590D"            /* REDDURESDURGY */	$"4455 524E 530D 4455 524F 430D 4455 524F"            /* DURNSDUROCDURO */	$"530D 4455 524F 590D 4455 5252 410D 4455"            /* SDUROYDURRADU */	$"5252 530D 4455 5252 590D 4455 5253 540D"            /* RRSDURRYDURST */	$"4455 5255 4D0D 4455 525A 490D 4455 534B"            /* DURUMDURZIDUSK */	$"530D 4455 5354 530D 4455 5845 530D 4457"            /* SDUSTSDUXESDW */	$"4141 4C0D 4457 414C 450D 4457 414C 4D0D"            /* AALDWALEDWALM */	$"4457 414D 530D 4457 414E 470D 4457 4155"            /* DWAMSDWANGDWAU */	$"4D0D 4457 4545 420D 4457 494C 450D 4457"            /* MDWEEBDWILEDW */	$"494E 450D 4459 4144 530D 4459 4552 530D"            /* INEDYADSDYERS */	$"4459 4B45 440D 4459 4B45 530D 4459 4B45"            /* DYKEDDYKESDYKE */	$"590D 4459 4B4F 4E0D 4459 4E45 4C0D 4459"            /* YDYKONDYNELDY */	$"4E45 530D 445A 484F 530D 4541 4752 450D"            /* NESDZHOSEAGRE */	$"4541 4C45 440D 4541 4C45 530D 4541 4E45"            /* EALEDEALESEANE */	$"440D 4541 5244 530D 4541 5245 440D 4541"            /* DEARDSEAREDEA */	$"524C 530D 4541 524E 530D 4541 524E 540D"            /* RLSEARNSEARNT */	$"4541 5253 540D 4541 5345 440D 4541 5345"            /* EARSTEASEDEASE */	$"520D 4541 5345 530D 4541 534C 450D 4541"            /* REASESEASLEEA */	$"5354 530D 4541 5448 450D 4541 5645 440D"            /* STSEATHEEAVED */	$"4541 5645 530D 4542 4245 440D 4542 4245"            /* EAVESEBBEDEBBE */	$"540D 4542 4F4E 530D 4542 4F4F 4B0D 4543"            /* TEBONSEBOOKEC */	$"4144 530D 4543 4845 440D 4543 4845 530D"            /* ADSECHEDECHES */	$"4543 484F 530D 4543 5255 530D 4544 454D"            /* ECHOSECRUSEDEM */	$"410D 4544 4745 440D 4544 4745 520D 4544"            /* AEDGEDEDGERED */	$"4745 530D 4544 494C 450D 4544 4954 530D"            /* GESEDILEEDITS */	$"4544 5543 450D 4544 5543 540D 4545 4A49"            /* EDUCEEDUCTEEJI */	$"540D 4545 4E53 590D 4545 5645 4E0D 4545"            /* TEENSYEEVENEE */	$"564E 530D 4546 4645 440D 4547 4144 530D"            /* VNSEFFEDEGADS */	$"4547 4552 530D 4547 4553 540D 4547 4741"            /* EGERSEGESTEGGA */	$"520D 4547 4745 440D 4547 4745 520D 4547"            /* REGGEDEGGEREG */	$"4D41 530D 4548 494E 470D 4549 4445 520D"            /* MASEHINGEIDER */	$"4549 444F 530D 4549 474E 450D 4549 4B45"            /* EIDOSEIGNEEIKE */	$"440D 4549 4B4F 4E0D 4549 4C44 530D 4549"            /* DEIKONEILDSEI */	$"5345 4C0D 454A 4944 4F0D 454B 4B41 530D"            /* SELEJIDOEKKAS */	$"454C 4149 4E0D 454C 414E 440D 454C 414E"            /* ELAINELANDELAN */	$"530D 454C 4348 490D 454C 4449 4E0D 454C"            /* SELCHIELDINEL */	$"454D 490D 454C 4645 440D 454C 4941 440D"            /* EMIELFEDELIAD */	$"454C 494E 540D 454C 4D45 4E0D 454C 4F47"            /* ELINTELMENELOG */	$"450D 454C 4F47 590D 454C 4F49 4E0D 454C"            /* EELOGYELOINEL */	$"4F50 530D 454C 5045 450D 454C 5349 4E0D"            /* OPSELPEEELSIN */	$"454C 5554 450D 454C 5641 4E0D 454C 5645"            /* ELUTEELVANELVE */	$"4E0D 454C 5645 520D 454C 5645 530D 454D"            /* NELVERELVESEM */	$"4143 530D 454D 4241 520D 454D 4241 590D"            /* ACSEMBAREMBAY */	$"454D 424F 470D 454D 424F 570D 454D 424F"            /* EMBOGEMBOWEMBO */	$"580D 454D 4255 530D 454D 4545 520D 454D"            /* XEMBUSEMEEREM */	$"454E 440D 454D 4552 470D 454D 4552 590D"            /* ENDEMERGEMERY */	$"454D 4555 530D 454D 4943 530D 454D 4952"            /* EMEUSEMICSEMIR */	$"530D 454D 4954 530D 454D 4D41 530D 454D"            /* SEMITSEMMASEM */	$"4D45 520D 454D 4D45 540D 454D 4D45 570D"            /* MEREMMETEMMEW */	$"454D 4D59 530D 454D 4F4A 490D 454D 4F4E"            /* EMMYSEMOJIEMON */	$"470D 454D 4F54 450D 454D 4F56 450D 454D"            /* GEMOTEEMOVEEM */	$"5054 530D 454D 554C 450D 454D 5552 450D"            /* PTSEMULEEMURE */	$"454D 5944 450D 454D 5944 530D 454E 4152"            /* EMYDEEMYDSENAR */	$"4D0D 454E 4154 450D 454E 4445 440D 454E"            /* MENATEENDEDEN */	$"4445 520D 454E 4445 570D 454E 4455 450D"            /* DERENDEWENDUE */	$"454E 4557 530D 454E 4649 580D 454E 4941"            /* ENEWSENFIXENIA */	$"430D 454E 4C49 540D 454E 4D45 570D 454E"            /* CENLITENMEWEN */	$"4E4F 470D 454E 4F4B 490D 454E 4F4C 530D"            /* NOGENOKIENOLS */	$"454E 4F52 4D0D 454E 4F57 530D 454E 524F"            /* ENORMENOWSENRO */	$"4C0D 454E 5345 570D 454E 534B 590D 454E"            /* LENSEWENSKYEN */	$"5449 410D 454E 5552 450D 454E 5552 4E0D"            /* TIAENUREENURN */	$"454E 564F 490D 454E 5A59 4D0D 454F 524C"            /* ENVOIENZYMEORL */	$"530D 454F 5349 4E0D 4550 4143 540D 4550"            /* SEOSINEPACTEP */	$"4545 530D 4550 4841 480D 4550 4841 530D"            /* EESEPHAHEPHAS */	$"4550 484F 440D 4550 484F 520D 4550 4943"            /* EPHODEPHOREPIC */	$"530D 4550 4F44 450D 4550 4F50 540D 4550"            /* SEPODEEPOPTEP */	$"5249 530D 4551 5545 530D 4551 5549 440D"            /* RISEQUESEQUID */	$"4552 4249 410D 4552 4556 530D 4552 474F"            /* ERBIAEREVSERGO */	$"4E0D 4552 474F 530D 4552 474F 540D 4552"            /* NERGOSERGOTER */	$"4855 530D 4552 4943 410D 4552 4943 4B0D"            /* HUSERICAERICK */	$"4552 4943 530D 4552 494E 470D 4552 4E45"            /* ERICSERINGERNE */	$"440D 4552 4E45 530D 4552 4F53 450D 4552"            /* DERNESEROSEER */	$"5245 440D 4552 5345 530D 4552 5543 540D"            /* REDERSESERUCT */	$"4552 5547 4F0D 4552 5556 530D 4552 5645"            /* ERUGOERUVSERVE */	$"4E0D 4552 5649 4C0D 4553 4341 520D 4553"            /* NERVILESCARES */	$"434F 540D 4553 494C 450D 4553 4B41 520D"            /* COTESILEESKAR */	$"4553 4B45 520D 4553 4E45 530D 4553 5345"            /* ESKERESNESESSE */	$"530D 4553 544F 430D 4553 544F 500D 4553"            /* SESTOCESTOPES */	$"5452 4F0D 4554 4147 450D 4554 4150 450D"            /* TROETAGEETAPE */	$"4554 4154 530D 4554 454E 530D 4554 4841"            /* ETATSETENSETHA */	$"4C0D 4554 484E 450D 4554 4859 4C0D 4554"            /* LETHNEETHYLET */	$"4943 530D 4554 4E41 530D 4554 5449 4E0D"            /* ICSETNASETTIN */	$"4554 544C 450D 4554 5549 530D 4554 5745"            /* ETTLEETUISETWE */	$"450D 4554 594D 410D 4555 4748 530D 4555"            /* EETYMAEUGHSEU */	$"4B45 440D 4555 5041 440D 4555 524F 530D"            /* KEDEUPADEUROS */	$"4555 534F 4C0D 4556 454E 530D 4556 4552"            /* EUSOLEVENSEVER */	$"540D 4556 4554 530D 4556 484F 450D 4556"            /* TEVETSEVHOEEV */	$"494C 530D 4556 4954 450D 4556 4F48 450D"            /* ILSEVITEEVOHE */	$"4557 4552 530D 4557 4553 540D 4557 484F"            /* EWERSEWESTEWHO */	$"570D 4557 4B45 440D 4558 414D 530D 4558"            /* WEWKEDEXAMSEX */	$"4541 540D 4558 4543 530D 4558 4545 4D0D"            /* EATEXECSEXEEM */	$"4558 454D 450D 4558 4649 4C0D 4558 4945"            /* EXEMEEXFILEXIE */	$"530D 4558 494E 450D 4558 494E 470D 4558"            /* SEXINEEXINGEX */	$"4954 530D 4558 4F44 450D 4558 4F4D 450D"            /* ITSEXODEEXOME */	$"4558 4F4E 530D 4558 5041 540D 4558 504F"            /* EXONSEXPATEXPO */	$"530D 4558 5544 450D 4558 554C 530D 4558"            /* SEXUDEEXULSEX */	$"5552 420D 4559 4153 530D 4559 4552 530D"            /* URBEYASSEYERS */	$"4559 4F54 530D 4559 5241 530D 4559 5245"            /* EYOTSEYRASEYRE */	$"530D 4559 5249 450D 4559 5249 520D 455A"            /* SEYRIEEYRIREZ */	$"494E 450D 4641 4242 590D 4641 4345 440D"            /* INEFABBYFACED */	$"4641 4345 520D 4641 4345 530D 4641 4349"            /* FACERFACESFACI */	$"410D 4641 4354 410D 4641 4354 530D 4641"            /* AFACTAFACTSFA */	$"4444 590D 4641 4445 440D 4641 4445 520D"            /* DDYFADEDFADER */	$"4641 4445 530D 4641 4447 450D 4641 444F"            /* FADESFADGEFADO */	$"530D 4641 454E 410D 4641 4552 590D 4641"            /* SFAENAFAERYFA */	$"4646 530D 4641 4646 590D 4641 4747 590D"            /* FFSFAFFYFAGGY */	$"4641 4749 4E0D 4641 474F 540D 4641 494B"            /* FAGINFAGOTFAIK */	$"530D 4641 494C 530D 4641 494E 450D 4641"            /* SFAILSFAINEFA */	$"494E 530D 4641 4952 530D 4641 4B45 440D"            /* INSFAIRSFAKED */	$"4641 4B45 520D 4641 4B45 530D 4641 4B45"            /* FAKERFAKESFAKE */	$"590D 4641 4B49 450D 4641 4B49 520D 4641"            /* YFAKIEFAKIRFA */	$"4C41 4A0D 4641 4C4C 530D 4641 4D45 440D"            /* LAJFALLSFAMED */	$"4641 4D45 530D 4641 4E41 4C0D 4641 4E44"            /* FAMESFANALFAND */	$"530D 4641 4E45 530D 4641 4E47 410D 4641"            /* SFANESFANGAFA */	$"4E47 4F0D 4641 4E47 530D 4641 4E4B 530D"            /* NGOFANGSFANKS */	$"4641 4E4F 4E0D 4641 4E4F 530D 4641 4E55"            /* FANONFANOSFANU */	$"4D0D 4641 5149 520D 4641 5241 440D 4641"            /* MFAQIRFARADFA */	$"5243 490D 4641 5243 590D 4641 5244 530D"            /* RCIFARCYFARDS */	$"4641 5245 440D 4641 5245 520D 4641 5245"            /* FAREDFARERFARE */	$"530D 4641 524C 450D 4641 524C 530D 4641"            /* SFARLEFARLSFA */	$"524D 530D 4641 524F 530D 4641 5252 4F0D"            /* RMSFAROSFARRO */	$"4641 5253 450D 4641 5254 530D 4641 5343"            /* FARSEFARTSFASC */	$"490D 4641 5354 490D 4641 5354 530D 4641"            /* IFASTIFASTSFA */	$"5445 440D 4641 5445 530D 4641 544C 590D"            /* TEDFATESFATLY */	$"4641 5453 4F0D 4641 5457 410D 4641 5547"            /* FATSOFATWAFAUG */	$"480D 4641 554C 440D 4641 554E 530D 4641"            /* HFAULDFAUNSFA */	$"5552 440D 4641 5554 530D 4641 5556 450D"            /* URDFAUTSFAUVE */	$"4641 5641 530D 4641 5645 4C0D 4641 5645"            /* FAVASFAVELFAVE */	$"520D 4641 5645 530D 4641 5655 530D 4641"            /* RFAVESFAVUSFA */	$"574E 530D 4641 574E 590D 4641 5845 440D"            /* WNSFAWNYFAXED */	$"4641 5845 530D 4641 5945 440D 4641 5945"            /* FAXESFAYEDFAYE */	$"520D 4641 594E 450D 4641 5952 450D 4641"            /* RFAYNEFAYREFA */	$"5A45 440D 4641 5A45 530D 4645 414C 530D"            /* ZEDFAZESFEALS */	$"4645 4152 450D 4645 4152 530D 4645 4152"            /* FEAREFEARSFEAR */	$"540D 4645 4153 450D 4645 4154 530D 4645"            /* TFEASEFEATSFE */	$"415A 450D 4645 4345 530D 4645 4348 540D"            /* AZEFECESFECHT */	$"4645 4349 540D 4645 434B 530D 4645 4445"            /* FECITFECKSFEDE */	$"580D 4645 4542 530D 4645 4544 530D 4645"            /* XFEEBSFEEDSFE */	$"454C 530D 4645 454E 530D 4645 4552 530D"            /* ELSFEENSFEERS */	$"4645 4553 450D 4645 455A 450D 4645 484D"            /* FEESEFEEZEFEHM */	$"450D 4645 494E 540D 4645 4953 540D 4645"            /* EFEINTFEISTFE */	$"4C43 480D 4645 4C49 440D 4645 4C4C 530D"            /* LCHFELIDFELLS */	$"4645 4C4C 590D 4645 4C54 530D 4645 4C54"            /* FELLYFELTSFELT */	$"590D 4645 4D41 4C0D 4645 4D45 530D 4645"            /* YFEMALFEMESFE */	$"4D4D 590D 4645 4E44 530D 4645 4E44 590D"            /* MMYFENDSFENDY */	$"4645 4E49 530D 4645 4E4B 530D 4645 4E4E"            /* FENISFENKSFENN */	$"590D 4645 4E54 530D 4645 4F44 530D 4645"            /* YFENTSFEODSFE */	$"4F46 460D 4645 5245 520D 4645 5245 530D"            /* OFFFERERFERES */	$"4645 5249 410D 4645 524C 590D 4645 524D"            /* FERIAFERLYFERM */	$"490D 4645 524D 530D 4645 524E 530D 4645"            /* IFERMSFERNSFE */	$"524E 590D 4645 5353 450D 4645 5354 410D"            /* RNYFESSEFESTA */	$"4645 5354 530D 4645 5354 590D 4645 5441"            /* FESTSFESTYFETA */	$"530D 4645 5445 440D 4645 5445 530D 4645"            /* SFETEDFETESFE */	$"544F 520D 4645 5454 410D 4645 5454 530D"            /* TORFETTAFETTS */	$"4645 5457 410D 4645 5541 520D 4645 5544"            /* FETWAFEUARFEUD */	$"530D 4645 5545 440D 4645 5945 440D 4645"            /* SFEUEDFEYEDFE */	$"5945 520D 4645 594C 590D 4645 5A45 530D"            /* YERFEYLYFEZES */	$"4645 5A5A 590D 4649 4152 530D 4649 4154"            /* FEZZYFIARSFIAT */	$"530D 4649 4252 450D 4649 4252 4F0D 4649"            /* SFIBREFIBROFI */	$"4345 530D 4649 4348 450D 4649 4348 550D"            /* CESFICHEFICHU */	$"4649 4349 4E0D 4649 434F 530D 4649 4445"            /* FICINFICOSFIDE */	$"530D 4649 4447 450D 4649 444F 530D 4649"            /* SFIDGEFIDOSFI */	$"4546 530D 4649 454E 540D 4649 4552 450D"            /* EFSFIENTFIERE */	$"4649 4552 530D 4649 4553 540D 4649 4645"            /* FIERSFIESTFIFE */	$"440D 4649 4645 520D 4649 4645 530D 4649"            /* DFIFERFIFESFI */	$"4649 530D 4649 4747 590D 4649 474F 530D"            /* FISFIGGYFIGOS */	$"4649 4B45 440D 4649 4B45 530D 4649 4C41"            /* FIKEDFIKESFILA */	$"520D 4649 4C43 480D 4649 4C45 440D 4649"            /* RFILCHFILEDFI */	$"4C45 530D 4649 4C49 490D 4649 4C4B 530D"            /* LESFILIIFILKS */	$"4649 4C4C 450D 4649 4C4C 4F0D 4649 4C4C"            /* FILLEFILLOFILL */	$"530D 4649 4C4D 490D 4649 4C4D 530D 4649"            /* SFILMIFILMSFI */	$"4C4F 530D 4649 4C55 4D0D 4649 4E43 410D"            /* LOSFILUMFINCA */	$"4649 4E44 530D 4649 4E45 440D 4649 4E45"            /* FINDSFINEDFINE */	$"530D 4649 4E49 530D 4649 4E4B 530D 4649"            /* SFINISFINKSFI */	$"4E4E 590D 4649 4E4F 530D 4649 4F52 440D"            /* NNYFINOSFIORD */	$"4649 5148 530D 4649 5155 450D 4649 5245"            /* FIQHSFIQUEFIRE */	$"440D 4649 5245 520D 4649 5245 530D 4649"            /* DFIRERFIRESFI */	$"5249 450D 4649 524B 530D 4649 524D 530D"            /* RIEFIRKSFIRMS */	$"4649 524E 530D 4649 5252 590D 4649 5254"            /* FIRNSFIRRYFIRT */	$"480D 4649 5343 530D 4649 534B 530D 4649"            /* HFISCSFISKSFI */	$"5354 530D 4649 5354 590D 4649 5443 480D"            /* STSFISTYFITCH */	$"4649 544C 590D 4649 544E 410D 4649 5454"            /* FITLYFITNAFITT */	$"450D 4649 5454 530D 4649 5645 520D 4649"            /* EFITTSFIVERFI */	$"5645 530D 4649 5845 440D 4649 5845 530D"            /* VESFIXEDFIXES */	$"4649 5849 540D 464A 454C 440D 464C 4142"            /* FIXITFJELDFLAB */	$"530D 464C 4146 460D 464C 4147 530D 464C"            /* SFLAFFFLAGSFL */	$"414B 530D 464C 414D 4D0D 464C 414D 530D"            /* AKSFLAMMFLAMS */	$"464C 414D 590D 464C 414E 450D 464C 414E"            /* FLAMYFLANEFLAN */	$"530D 464C 4150 530D 464C 4152 590D 464C"            /* SFLAPSFLARYFL */	$"4154 530D 464C 4156 410D 464C 4157 4E0D"            /* ATSFLAVAFLAWN */	$"464C 4157 530D 464C 4157 590D 464C 4158"            /* FLAWSFLAWYFLAX */	$"590D 464C 4159 530D 464C 4541 4D0D 464C"            /* YFLAYSFLEAMFL */	$"4541 530D 464C 4545 4B0D 464C 4545 520D"            /* EASFLEEKFLEER */	$"464C 4545 530D 464C 4547 530D 464C 454D"            /* FLEESFLEGSFLEM */	$"450D 464C 4555 520D 464C 4557 530D 464C"            /* EFLEURFLEWSFL */	$"4558 490D 464C 4558 4F0D 464C 4559 530D"            /* EXIFLEXOFLEYS */	$"464C 4943 530D 464C 4945 440D 464C 4945"            /* FLICSFLIEDFLIE */	$"530D 464C 494D 500D 464C 494D 530D 464C"            /* SFLIMPFLIMSFL */	$"4950 530D 464C 4952 530D 464C 4953 4B0D"            /* IPSFLIRSFLISK */	$"464C 4954 450D 464C 4954 530D 464C 4954"            /* FLITEFLITSFLIT */	$"540D 464C 4F42 530D 464C 4F43 530D 464C"            /* TFLOBSFLOCSFL */	$"4F45 530D 464C 4F47 530D 464C 4F4E 470D"            /* OESFLOGSFLONG */	$"464C 4F50 530D 464C 4F52 530D 464C 4F52"            /* FLOPSFLORSFLOR */	$"590D 464C 4F53 480D 464C 4F54 410D 464C"            /* YFLOSHFLOTAFL */	$"4F54 450D 464C 4F57 530D 464C 5542 530D"            /* OTEFLOWSFLUBS */	$"464C 5545 440D 464C 5545 530D 464C 5545"            /* FLUEDFLUESFLUE */	$"590D 464C 554B 590D 464C 554D 500D 464C"            /* YFLUKYFLUMPFL */	$"554F 520D 464C 5552 520D 464C 5554 590D"            /* UORFLURRFLUTY */	$"464C 5559 540D 464C 5942 590D 464C 5950"            /* FLUYTFLYBYFLYP */	$"450D 464C 5954 450D 464F 414C 530D 464F"            /* EFLYTEFOALSFO */	$"414D 530D 464F 4548 4E0D 464F 4745 590D"            /* AMSFOEHNFOGEY */	$"464F 4749 450D 464F 474C 450D 464F 474F"            /* FOGIEFOGLEFOGO */	$"550D 464F 484E 530D 464F 4944 530D 464F"            /* UFOHNSFOIDSFO */	$"494C 530D 464F 494E 530D 464F 4C44 530D"            /* ILSFOINSFOLDS */	$"464F 4C45 590D 464F 4C49 410D 464F 4C49"            /* FOLEYFOLIAFOLI */	$"430D 464F 4C49 450D 464F 4C4B 530D 464F"            /* CFOLIEFOLKSFO */	$"4C4B 590D 464F 4D45 530D 464F 4E44 410D"            /* LKYFOMESFONDA */	$"464F 4E44 530D 464F 4E44 550D 464F 4E45"            /* FONDSFONDUFONE */	$"530D 464F 4E4C 590D 464F 4E54 530D 464F"            /* SFONLYFONTSFO */	$"4F44 530D 464F 4F44 590D 464F 4F4C 530D"            /* ODSFOODYFOOLS */	$"464F 4F54 530D 464F 4F54 590D 464F 5241"            /* FOOTSFOOTYFORA */	$"4D0D 464F 5242 530D 464F 5242 590D 464F"            /* MFORBSFORBYFO */	$"5244 4F0D 464F 5244 530D 464F 5245 4C0D"            /* RDOFORDSFOREL */	$"464F 5245 530D 464F 5245 580D 464F 524B"            /* FORESFOREXFORK */	$"530D 464F 524B 590D 464F 524D 450D 464F"            /* SFORKYFORMEFO */	$"524D 530D 464F 5254 530D 464F 525A 410D"            /* RMSFORTSFORZA */	$"464F 525A 450D 464F 5353 410D 464F 5353"            /* FORZEFOSSAFOSS */	$"450D 464F 5541 540D 464F 5544 530D 464F"            /* EFOUATFOUDSFO */	$"5545 520D 464F 5545 540D 464F 554C 450D"            /* UERFOUETFOULE */	$"464F 554C 530D 464F 554E 540D 464F 5552"            /* FOULSFOUNTFOUR */	$"530D 464F 5554 480D 464F 5645 410D 464F"            /* SFOUTHFOVEAFO */	$"574C 530D 464F 5754 480D 464F 5845 440D"            /* WLSFOWTHFOXED */	$"464F 5845 530D 464F 5849 450D 464F 594C"            /* FOXESFOXIEFOYL */	$"450D 464F 594E 450D 4652 4142 530D 4652"            /* EFOYNEFRABSFR */	$"4143 4B0D 4652 4143 540D 4652 4147 530D"            /* ACKFRACTFRAGS */	$"4652 4149 4D0D 4652 414E 430D 4652 4150"            /* FRAIMFRANCFRAP */	$"450D 4652 4150 530D 4652 4153 530D 4652"            /* EFRAPSFRASSFR */	$"4154 450D 4652 4154 490D 4652 4154 530D"            /* ATEFRATIFRATS */	$"4652 4155 530D 4652 4159 530D 4652 4545"            /* FRAUSFRAYSFREE */	$"530D 4652 4545 540D 4652 4549 540D 4652"            /* SFREETFREITFR */	$"454D 440D 4652 454E 410D 4652 454F 4E0D"            /* EMDFRENAFREON */	$"4652 4552 450D 4652 4554 530D 4652 4942"            /* FREREFRETSFRIB */	$"530D 4652 4945 520D 4652 4945 530D 4652"            /* SFRIERFRIESFR */	$"4947 530D 4652 4953 450D 4652 4953 540D"            /* IGSFRISEFRIST */	$"4652 4954 480D 4652 4954 530D 4652 4954"            /* FRITHFRITSFRIT */	$"540D 4652 495A 450D 4652 495A 5A0D 4652"            /* TFRIZEFRIZZFR */	$"4F45 530D 4652 4F47 530D 4652 4F4E 530D"            /* OESFROGSFRONS */	$"4652 4F52 450D 4652 4F52 4E0D 4652 4F52"            /* FROREFRORNFROR */	$"590D 4652 4F53 480D 4652 4F57 530D 4652"            /* YFROSHFROWSFR */	$"4F57 590D 4652 5547 530D 4652 554D 500D"            /* OWYFRUGSFRUMP */	$"4652 5553 480D 4652 5553 540D 4652 5945"            /* FRUSHFRUSTFRYE */	$"520D 4655 4241 520D 4655 4242 590D 4655"            /* RFUBARFUBBYFU */	$"4253 590D 4655 434B 530D 4655 4355 530D"            /* BSYFUCKSFUCUS */	$"4655 4444 590D 4655 4447 590D 4655 454C"            /* FUDDYFUDGYFUEL */	$"530D 4655 4552 4F0D 4655 4646 530D 4655"            /* SFUEROFUFFSFU */	$"4646 590D 4655 4741 4C0D 4655 4747 590D"            /* FFYFUGALFUGGY */	$"4655 4749 450D 4655 4749 4F0D 4655 474C"            /* FUGIEFUGIOFUGL */	$"450D 4655 474C 590D 4655 4755 530D 4655"            /* EFUGLYFUGUSFU */	$"4A49 530D 4655 4C4C 530D 4655 4D45 440D"            /* JISFULLSFUMED */	$"4655 4D45 520D 4655 4D45 530D 4655 4D45"            /* FUMERFUMESFUME */	$"540D 4655 4E44 490D 4655 4E44 530D 4655"            /* TFUNDIFUNDSFU */	$"4E44 590D 4655 4E47 4F0D 4655 4E47 530D"            /* NDYFUNGOFUNGS */	$"4655 4E4B 530D 4655 5241 4C0D 4655 5241"            /* FUNKSFURALFURA */	$"4E0D 4655 5243 410D 4655 524C 530D 4655"            /* NFURCAFURLSFU */	$"524F 4C0D 4655 5252 530D 4655 5254 480D"            /* ROLFURRSFURTH */	$"4655 525A 450D 4655 525A 590D 4655 5345"            /* FURZEFURZYFUSE */	$"440D 4655 5345 450D 4655 5345 4C0D 4655"            /* DFUSEEFUSELFU */	$"5345 530D 4655 5349 4C0D 4655 534B 530D"            /* SESFUSILFUSKS */	$"4655 5354 530D 4655 5354 590D 4655 544F"            /* FUSTSFUSTYFUTO */	$"4E0D 4655 5A45 440D 4655 5A45 450D 4655"            /* NFUZEDFUZEEFU */	$"5A45 530D 4655 5A49 4C0D 4659 4345 530D"            /* ZESFUZILFYCES */	$"4659 4B45 440D 4659 4B45 530D 4659 4C45"            /* FYKEDFYKESFYLE */	$"530D 4659 5244 530D 4659 5454 450D 4741"            /* SFYRDSFYTTEGA */	$"4242 410D 4741 4242 590D 4741 424C 450D"            /* BBAGABBYGABLE */	$"4741 4444 490D 4741 4445 530D 4741 4447"            /* GADDIGADESGADG */	$"450D 4741 4449 440D 4741 4449 530D 4741"            /* EGADIDGADISGA */	$"444A 450D 4741 444A 4F0D 4741 4453 4F0D"            /* DJEGADJOGADSO */	$"4741 4646 530D 4741 4745 440D 4741 4745"            /* GAFFSGAGEDGAGE */	$"520D 4741 4745 530D 4741 4944 530D 4741"            /* RGAGESGAIDSGA */	$"494E 530D 4741 4952 530D 4741 4954 410D"            /* INSGAIRSGAITA */	$"4741 4954 530D 4741 4954 540D 4741 4A4F"            /* GAITSGAITTGAJO */	$"530D 4741 4C41 480D 4741 4C41 530D 4741"            /* SGALAHGALASGA */	$"4C41 580D 4741 4C45 410D 4741 4C45 440D"            /* LAXGALEAGALED */	$"4741 4C45 530D 4741 4C4C 530D 4741 4C4C"            /* GALESGALLSGALL */	$"590D 4741 4C4F 500D 4741 4C55 540D 4741"            /* YGALOPGALUTGA */	$"4C56 4F0D 4741 4D41 530D 4741 4D41 590D"            /* LVOGAMASGAMAY */	$"4741 4D42 410D 4741 4D42 450D 4741 4D42"            /* GAMBAGAMBEGAMB */	$"4F0D 4741 4D42 530D 4741 4D45 440D 4741"            /* OGAMBSGAMEDGA */	$"4D45 530D 4741 4D45 590D 4741 4D49 430D"            /* MESGAMEYGAMIC */	$"4741 4D49 4E0D 4741 4D4D 450D 4741 4D4D"            /* GAMINGAMMEGAMM */	$"590D 4741 4D50 530D 4741 4E43 480D 4741"            /* YGAMPSGANCHGA */	$"4E44 590D 4741 4E45 460D 4741 4E45 560D"            /* NDYGANEFGANEV */	$"4741 4E47 530D 4741 4E4A 410D 4741 4E4F"            /* GANGSGANJAGANO */	$"460D 4741 4E54 530D 4741 4F4C 530D 4741"            /* FGANTSGAOLSGA */	$"5045 440D 4741 5045 520D 4741 5045 530D"            /* PEDGAPERGAPES */	$"4741 504F 530D 4741 5050 590D 4741 5242"            /* GAPOSGAPPYGARB */	$"450D 4741 5242 4F0D 4741 5242 530D 4741"            /* EGARBOGARBSGA */	$"5244 410D 4741 5245 530D 4741 5249 530D"            /* RDAGARESGARIS */	$"4741 524D 530D 4741 524E 490D 4741 5252"            /* GARMSGARNIGARR */	$"450D 4741 5254 480D 4741 5255 4D0D 4741"            /* EGARTHGARUMGA */	$"5345 530D 4741 5350 530D 4741 5350 590D"            /* SESGASPSGASPY */	$"4741 5354 530D 4741 5443 480D 4741 5445"            /* GASTSGATCHGATE */	$"440D 4741 5445 520D 4741 5445 530D 4741"            /* DGATERGATESGA */	$"5448 530D 4741 544F 520D 4741 5543 480D"            /* THSGATORGAUCH */	$"4741 5543 590D 4741 5544 530D 4741 554A"            /* GAUCYGAUDSGAUJ */	$"450D 4741 554C 540D 4741 554D 530D 4741"            /* EGAULTGAUMSGA */	$"554D 590D 4741 5550 530D 4741 5552 530D"            /* UMYGAUPSGAURS */	$"4741 5553 530D 4741 555A 590D 4741 564F"            /* GAUSSGAUZYGAVO */	$"540D 4741 5743 590D 4741 5744 530D 4741"            /* TGAWCYGAWDSGA */	$"574B 530D 4741 5750 530D 4741 5753 590D"            /* WKSGAWPSGAWSY */	$"4741 5941 4C0D 4741 5A41 4C0D 4741 5A41"            /* GAYALGAZALGAZA */	$"520D 4741 5A45 440D 4741 5A45 530D 4741"            /* RGAZEDGAZESGA */	$"5A4F 4E0D 4741 5A4F 4F0D 4745 414C 530D"            /* ZONGAZOOGEALS */	$"4745 414E 530D 4745 4152 450D 4745 4152"            /* GEANSGEAREGEAR */	$"530D 4745 4154 530D 4745 4255 520D 4745"            /* SGEATSGEBURGE */	$"434B 530D 4745 454B 530D 4745 4550 530D"            /* CKSGEEKSGEEPS */	$"4745 4553 540D 4745 4953 540D 4745 4954"            /* GEESTGEISTGEIT */	$"530D 4745 4C44 530D 4745 4C45 450D 4745"            /* SGELDSGELEEGE */	$"4C49 440D 4745 4C4C 590D 4745 4C54 530D"            /* LIDGELLYGELTS */	$"4745 4D45 4C0D 4745 4D4D 410D 4745 4D4D"            /* GEMELGEMMAGEMM */	$"590D 4745 4D4F 540D 4745 4E41 4C0D 4745"            /* YGEMOTGENALGE */	$"4E41 530D 4745 4E45 530D 4745 4E45 540D"            /* NASGENESGENET */	$"4745 4E49 430D 4745 4E49 490D 4745 4E49"            /* GENICGENIIGENI */	$"500D 4745 4E4E 590D 4745 4E4F 410D 4745"            /* PGENNYGENOAGE */	$"4E4F 4D0D 4745 4E52 4F0D 4745 4E54 530D"            /* NOMGENROGENTS */	$"4745 4E54 590D 4745 4E55 410D 4745 4E55"            /* GENTYGENUAGENU */	$"530D 4745 4F44 450D 4745 4F49 440D 4745"            /* SGEODEGEOIDGE */	$"5241 480D 4745 5242 450D 4745 5245 530D"            /* RAHGERBEGERES */	$"4745 524C 450D 4745 524D 530D 4745 524D"            /* GERLEGERMSGERM */	$"590D 4745 524E 450D 4745 5353 450D 4745"            /* YGERNEGESSEGE */	$"5353 4F0D 4745 5354 450D 4745 5354 530D"            /* SSOGESTEGESTS */	$"4745 5441 530D 4745 5455 500D 4745 554D"            /* GETASGETUPGEUM */	$"530D 4745 5941 4E0D 4745 5945 520D 4748"            /* SGEYANGEYERGH */	$"4153 540D 4748 4154 530D 4748 4155 540D"            /* ASTGHATSGHAUT */	$"4748 415A 490D 4748 4545 530D 4748 4553"            /* GHAZIGHEESGHES */	$"540D 4748 594C 4C0D 4749 4245 440D 4749"            /* TGHYLLGIBEDGI */	$"4245 4C0D 4749 4245 520D 4749 4245 530D"            /* BELGIBERGIBES */	$"4749 424C 490D 4749 4255 530D 4749 4654"            /* GIBLIGIBUSGIFT */	$"530D 4749 4741 530D 4749 4748 450D 4749"            /* SGIGASGIGHEGI */	$"474F 540D 4749 4755 450D 4749 4C41 530D"            /* GOTGIGUEGILAS */	$"4749 4C44 530D 4749 4C45 540D 4749 4C4C"            /* GILDSGILETGILL */	$"530D 4749 4C4C 590D 4749 4C50 590D 4749"            /* SGILLYGILPYGI */	$"4C54 530D 4749 4D45 4C0D 4749 4D4D 450D"            /* LTSGIMELGIMME */	$"4749 4D50 530D 4749 4D50 590D 4749 4E43"            /* GIMPSGIMPYGINC */	$"480D 4749 4E47 450D 4749 4E47 530D 4749"            /* HGINGEGINGSGI */	$"4E4B 530D 4749 4E4E 590D 4749 4E5A 4F0D"            /* NKSGINNYGINZO */	$"4749 504F 4E0D 4749 5050 4F0D 4749 5050"            /* GIPONGIPPOGIPP */	$"590D 4749 5244 530D 4749 524C 530D 4749"            /* YGIRDSGIRLSGI */	$"524E 530D 4749 524F 4E0D 4749 524F 530D"            /* RNSGIRONGIROS */	$"4749 5252 530D 4749 5253 480D 4749 5254"            /* GIRRSGIRSHGIRT */	$"530D 4749 534D 4F0D 4749 534D 530D 4749"            /* SGISMOGISMSGI */	$"5354 530D 4749 5443 480D 4749 5445 530D"            /* STSGITCHGITES */	$"4749 5553 540D 4749 5645 440D 4749 5645"            /* GIUSTGIVEDGIVE */	$"530D 4749 5A4D 4F0D 474C 4143 450D 474C"            /* SGIZMOGLACEGL */	$"4144 530D 474C 4144 590D 474C 4149 4B0D"            /* ADSGLADYGLAIK */	$"474C 4149 520D 474C 414D 530D 474C 414E"            /* GLAIRGLAMSGLAN */	$"530D 474C 4152 590D 474C 4155 4D0D 474C"            /* SGLARYGLAUMGL */	$"4155 520D 474C 415A 590D 474C 4542 410D"            /* AURGLAZYGLEBA */	$"474C 4542 450D 474C 4542 590D 474C 4544"            /* GLEBEGLEBYGLED */	$"450D 474C 4544 530D 474C 4545 440D 474C"            /* EGLEDSGLEEDGL */	$"4545 4B0D 474C 4545 530D 474C 4545 540D"            /* EEKGLEESGLEET */	$"474C 4549 530D 474C 454E 530D 474C 454E"            /* GLEISGLENSGLEN */	$"540D 474C 4559 530D 474C 4941 4C0D 474C"            /* TGLEYSGLIALGL */	$"4941 530D 474C 4942 530D 474C 4946 460D"            /* IASGLIBSGLIFF */	$"474C 4946 540D 474C 494B 450D 474C 494D"            /* GLIFTGLIKEGLIM */	$"450D 474C 494D 530D 474C 4953 4B0D 474C"            /* EGLIMSGLISKGL */	$"4954 530D 474C 4954 5A0D 474C 4F41 4D0D"            /* ITSGLITZGLOAM */	$"474C 4F42 490D 474C 4F42 530D 474C 4F42"            /* GLOBIGLOBSGLOB */	$"590D 474C 4F44 450D 474C 4F47 470D 474C"            /* YGLODEGLOGGGL */	$"4F4D 530D 474C 4F4F 500D 474C 4F50 530D"            /* OMSGLOOPGLOPS */	$"474C 4F53 540D 474C 4F55 540D 474C 4F57"            /* GLOSTGLOUTGLOW */	$"530D 474C 4F5A 450D 474C 5545 440D 474C"            /* SGLOZEGLUEDGL */	$"5545 520D 474C 5545 530D 474C 5545 590D"            /* UERGLUESGLUEY */	$"474C 5547 530D 474C 554D 450D 474C 554D"            /* GLUGSGLUMEGLUM */	$"530D 474C 554F 4E0D 474C 5554 450D 474C"            /* SGLUONGLUTEGL */	$"5554 530D 474E 4152 4C0D 474E 4152 520D"            /* UTSGNARLGNARR */	$"474E 4152 530D 474E 4154 530D 474E 4157"            /* GNARSGNATSGNAW */	$"4E0D 474E 4157 530D 474E 4F57 530D 474F"            /* NGNAWSGNOWSGO */	$"4144 530D 474F 4146 530D 474F 414C 530D"            /* ADSGOAFSGOALS */	$"474F 4152 590D 474F 4154 530D 474F 4154"            /* GOARYGOATSGOAT */	$"590D 474F 4241 4E0D 474F 4241 520D 474F"            /* YGOBANGOBARGO */	$"4242 490D 474F 4242 4F0D 474F 4242 590D"            /* BBIGOBBOGOBBY */	$"474F 4249 530D 474F 424F 530D 474F 4445"            /* GOBISGOBOSGODE */	$"540D 474F 4453 4F0D 474F 454C 530D 474F"            /* TGODSOGOELSGO */	$"4552 530D 474F 4553 540D 474F 4554 480D"            /* ERSGOESTGOETH */	$"474F 4554 590D 474F 4645 520D 474F 4646"            /* GOETYGOFERGOFF */	$"530D 474F 4747 410D 474F 474F 530D 474F"            /* SGOGGAGOGOSGO */	$"4945 520D 474F 4A49 530D 474F 4C44 530D"            /* IERGOJISGOLDS */	$"474F 4C44 590D 474F 4C45 530D 474F 4C46"            /* GOLDYGOLESGOLF */	$"530D 474F 4C50 450D 474F 4C50 530D 474F"            /* SGOLPEGOLPSGO */	$"4D42 4F0D 474F 4D45 520D 474F 4D50 410D"            /* MBOGOMERGOMPA */	$"474F 4E43 480D 474F 4E45 460D 474F 4E47"            /* GONCHGONEFGONG */	$"530D 474F 4E49 410D 474F 4E49 460D 474F"            /* SGONIAGONIFGO */	$"4E4B 530D 474F 4E4E 410D 474F 4E4F 460D"            /* NKSGONNAGONOF */	$"474F 4E59 530D 474F 4E5A 4F0D 474F 4F42"            /* GONYSGONZOGOOB */	$"590D 474F 4F44 530D 474F 4F46 530D 474F"            /* YGOODSGOOFSGO */	$"4F47 530D 474F 4F4B 530D 474F 4F4B 590D"            /* OGSGOOKSGOOKY */	$"474F 4F4C 440D 474F 4F4C 530D 474F 4F4C"            /* GOOLDGOOLSGOOL */	$"590D 474F 4F4E 530D 474F 4F4E 590D 474F"            /* YGOONSGOONYGO */	$"4F50 530D 474F 4F50 590D 474F 4F52 530D"            /* OPSGOOPYGOORS */	$"474F 4F52 590D 474F 4F53 590D 474F 5041"            /* GOORYGOOSYGOPA */	$"4B0D 474F 5049 4B0D 474F 5241 4C0D 474F"            /* KGOPIKGORALGO */	$"5241 530D 474F 5245 440D 474F 5245 530D"            /* RASGOREDGORES */	$"474F 5249 530D 474F 524D 530D 474F 524D"            /* GORISGORMSGORM */	$"590D 474F 5250 530D 474F 5253 450D 474F"            /* YGORPSGORSEGO */	$"5253 590D 474F 5348 540D 474F 5353 450D"            /* RSYGOSHTGOSSE */	$"474F 5443 480D 474F 5448 530D 474F 5448"            /* GOTCHGOTHSGOTH */	$"590D 474F 5454 410D 474F 5543 480D 474F"            /* YGOTTAGOUCHGO */	$"554B 530D 474F 5552 410D 474F 5554 530D"            /* UKSGOURAGOUTS */	$"474F 5554 590D 474F 5741 4E0D 474F 5744"            /* GOUTYGOWANGOWD */	$"530D 474F 5746 530D 474F 574B 530D 474F"            /* SGOWFSGOWKSGO */	$"574C 530D 474F 574E 530D 474F 5845 530D"            /* WLSGOWNSGOXES */	$"474F 5949 4D0D 474F 594C 450D 4752 4141"            /* GOYIMGOYLEGRAA */	$"4C0D 4752 4142 530D 4752 4144 530D 4752"            /* LGRABSGRADSGR */	$"4146 460D 4752 4149 500D 4752 414D 410D"            /* AFFGRAIPGRAMA */	$"4752 414D 450D 4752 414D 500D 4752 414D"            /* GRAMEGRAMPGRAM */	$"530D 4752 414E 410D 4752 414E 530D 4752"            /* SGRANAGRANSGR */	$"4150 590D 4752 4156 530D 4752 4159 530D"            /* APYGRAVSGRAYS */	$"4752 4542 450D 4752 4542 4F0D 4752 4543"            /* GREBEGREBOGREC */	$"450D 4752 4545 4B0D 4752 4545 530D 4752"            /* EGREEKGREESGR */	$"4547 450D 4752 4547 4F0D 4752 4549 4E0D"            /* EGEGREGOGREIN */	$"4752 454E 530D 4752 4553 450D 4752 4556"            /* GRENSGRESEGREV */	$"450D 4752 4557 530D 4752 4559 530D 4752"            /* EGREWSGREYSGR */	$"4943 450D 4752 4944 450D 4752 4944 530D"            /* ICEGRIDEGRIDS */	$"4752 4946 460D 4752 4946 540D 4752 4947"            /* GRIFFGRIFTGRIG */	$"530D 4752 494B 450D 4752 494E 530D 4752"            /* SGRIKEGRINSGR */	$"494F 540D 4752 4950 530D 4752 4950 540D"            /* IOTGRIPSGRIPT */	$"4752 4950 590D 4752 4953 450D 4752 4953"            /* GRIPYGRISEGRIS */	$"540D 4752 4953 590D 4752 4954 480D 4752"            /* TGRISYGRITHGR */	$"4954 530D 4752 495A 450D 4752 4F41 540D"            /* ITSGRIZEGROAT */	$"4752 4F44 590D 4752 4F47 530D 4752 4F4B"            /* GRODYGROGSGROK */	$"530D 4752 4F4D 410D 4752 4F4E 450D 4752"            /* SGROMAGRONEGR */	$"4F4F 460D 4752 4F53 5A0D 4752 4F54 530D"            /* OOFGROSZGROTS */	$"4752 4F55 460D 4752 4F56 590D 4752 4F57"            /* GROUFGROVYGROW */	$"530D 4752 524C 530D 4752 5252 4C0D 4752"            /* SGRRLSGRRRLGR */	$"5542 530D 4752 5545 440D 4752 5545 530D"            /* UBSGRUEDGRUES */	$"4752 5546 450D 4752 554D 450D 4752 554D"            /* GRUFEGRUMEGRUM */	$"500D 4752 554E 440D 4752 5943 450D 4752"            /* PGRUNDGRYCEGR */	$"5944 450D 4752 594B 450D 4752 5950 450D"            /* YDEGRYKEGRYPE */	$"4752 5950 540D 4755 4143 4F0D 4755 414E"            /* GRYPTGUACOGUAN */	$"410D 4755 414E 4F0D 4755 414E 530D 4755"            /* AGUANOGUANSGU */	$"4152 530D 4755 434B 530D 4755 434B 590D"            /* ARSGUCKSGUCKY */	$"4755 4445 530D 4755 4646 530D 4755 4741"            /* GUDESGUFFSGUGA */	$"530D 4755 4944 530D 4755 494D 500D 4755"            /* SGUIDSGUIMPGU */	$"4952 4F0D 4755 4C41 470D 4755 4C41 520D"            /* IROGULAGGULAR */	$"4755 4C41 530D 4755 4C45 530D 4755 4C45"            /* GULASGULESGULE */	$"540D 4755 4C46 530D 4755 4C46 590D 4755"            /* TGULFSGULFYGU */	$"4C4C 530D 4755 4C50 480D 4755 4C50 530D"            /* LLSGULPHGULPS */	$"4755 4C50 590D 4755 4D4D 410D 4755 4D4D"            /* GULPYGUMMAGUMM */	$"490D 4755 4D50 530D 4755 4E44 590D 4755"            /* IGUMPSGUNDYGU */	$"4E47 450D 4755 4E47 590D 4755 4E4B 530D"            /* NGEGUNGYGUNKS */	$"4755 4E4B 590D 4755 4E4E 590D 4755 5149"            /* GUNKYGUNNYGUQI */	$"4E0D 4755 5244 590D 4755 5247 450D 4755"            /* NGURDYGURGEGU */	$"524C 530D 4755 524C 590D 4755 524E 530D"            /* RLSGURLYGURNS */	$"4755 5252 590D 4755 5253 480D 4755 5255"            /* GURRYGURSHGURU */	$"530D 4755 5348 590D 4755 534C 410D 4755"            /* SGUSHYGUSLAGU */	$"534C 450D 4755 534C 490D 4755 5353 590D"            /* SLEGUSLIGUSSY */	$"4755 5354 530D 4755 5453 590D 4755 5454"            /* GUSTSGUTSYGUTT */	$"410D 4755 5454 590D 4755 5945 440D 4755"            /* AGUTTYGUYEDGU */	$"594C 450D 4755 594F 540D 4755 5953 450D"            /* YLEGUYOTGUYSE */	$"4757 494E 450D 4759 414C 530D 4759 414E"            /* GWINEGYALSGYAN */	$"530D 4759 4245 440D 4759 4245 530D 4759"            /* SGYBEDGYBESGY */	$"454C 440D 4759 4D50 530D 4759 4E41 450D"            /* ELDGYMPSGYNAE */	$"4759 4E49 450D 4759 4E4E 590D 4759 4E4F"            /* GYNIEGYNNYGYNO */	$"530D 4759 4F5A 410D 4759 504F 530D 4759"            /* SGYOZAGYPOSGY */	$"5050 4F0D 4759 5050 590D 4759 5241 4C0D"            /* PPOGYPPYGYRAL */	$"4759 5245 440D 4759 5245 530D 4759 524F"            /* GYREDGYRESGYRO */	$"4E0D 4759 524F 530D 4759 5255 530D 4759"            /* NGYROSGYRUSGY */	$"5445 530D 4759 5645 440D 4759 5645 530D"            /* TESGYVEDGYVES */	$"4841 4146 530D 4841 4152 530D 4841 424C"            /* HAAFSHAARSHABL */	$"450D 4841 4255 530D 4841 4345 4B0D 4841"            /* EHABUSHACEKHA */	$"434B 530D 4841 4441 4C0D 4841 4445 440D"            /* CKSHADALHADED */	$"4841 4445 530D 4841 444A 490D 4841 4453"            /* HADESHADJIHADS */	$"540D 4841 454D 530D 4841 4554 530D 4841"            /* THAEMSHAETSHA */	$"4646 530D 4841 4649 5A0D 4841 4654 530D"            /* FFSHAFIZHAFTS */	$"4841 4747 530D 4841 4841 530D 4841 4943"            /* HAGGSHAHASHAIC */	$"4B0D 4841 494B 410D 4841 494B 530D 4841"            /* KHAIKAHAIKSHA */	$"494B 550D 4841 494C 530D 4841 494C 590D"            /* IKUHAILSHAILY */	$"4841 494E 530D 4841 494E 540D 4841 4952"            /* HAINSHAINTHAIR */	$"530D 4841 4954 480D 4841 4A45 530D 4841"            /* SHAITHHAJESHA */	$"4A49 530D 4841 4A4A 490D 4841 4B41 4D0D"            /* JISHAJJIHAKAM */	$"4841 4B41 530D 4841 4B45 410D 4841 4B45"            /* HAKASHAKEAHAKE */	$"530D 4841 4B49 4D0D 4841 4B55 530D 4841"            /* SHAKIMHAKUSHA */	$"4C41 4C0D 4841 4C45 440D 4841 4C45 520D"            /* LALHALEDHALER */	$"4841 4C45 530D 4841 4C46 410D 4841 4C46"            /* HALESHALFAHALF */	$"530D 4841 4C49 440D 4841 4C4C 4F0D 4841"            /* SHALIDHALLOHA */	$"4C4C 530D 4841 4C4D 410D 4841 4C4D 530D"            /* LLSHALMAHALMS */	$"4841 4C4F 4E0D 4841 4C4F 530D 4841 4C53"            /* HALONHALOSHALS */	$"450D 4841 4C54 530D 4841 4C56 410D 4841"            /* EHALTSHALVAHA */	$"4C57 410D 4841 4D41 4C0D 4841 4D42 410D"            /* LWAHAMALHAMBA */	$"4841 4D45 440D 4841 4D45 530D 4841 4D4D"            /* HAMEDHAMESHAMM */	$"590D 4841 4D5A 410D 4841 4E41 500D 4841"            /* YHAMZAHANAPHA */	$"4E43 450D 4841 4E43 480D 4841 4E44 530D"            /* NCEHANCHHANDS */	$"4841 4E47 490D 4841 4E47 530D 4841 4E4B"            /* HANGIHANGSHANK */	$"530D 4841 4E4B 590D 4841 4E53 410D 4841"            /* SHANKYHANSAHA */	$"4E53 450D 4841 4E54 530D 4841 4F4C 450D"            /* NSEHANTSHAOLE */	$"4841 4F4D 410D 4841 5041 580D 4841 504C"            /* HAOMAHAPAXHAPL */	$"590D 4841 5050 490D 4841 5055 530D 4841"            /* YHAPPIHAPUSHA */	$"5241 4D0D 4841 5244 530D 4841 5245 440D"            /* RAMHARDSHARED */	$"4841 5245 530D 4841 5249 4D0D 4841 524B"            /* HARESHARIMHARK */	$"530D 4841 524C 530D 4841 524D 530D 4841"            /* SHARLSHARMSHA */	$"524E 530D 4841 524F 530D 4841 5250 530D"            /* RNSHAROSHARPS */	$"4841 5254 530D 4841 5348 590D 4841 534B"            /* HARTSHASHYHASK */	$"530D 4841 5350 530D 4841 5354 410D 4841"            /* SHASPSHASTAHA */	$"5445 440D 4841 5445 530D 4841 5448 410D"            /* TEDHATESHATHA */	$"4841 5544 530D 4841 5546 530D 4841 5547"            /* HAUDSHAUFSHAUG */	$"480D 4841 554C 440D 4841 554C 4D0D 4841"            /* HHAULDHAULMHA */	$"554C 530D 4841 554C 540D 4841 554E 530D"            /* ULSHAULTHAUNS */	$"4841 5553 450D 4841 5645 520D 4841 5645"            /* HAUSEHAVERHAVE */	$"530D 4841 5745 440D 4841 574B 530D 4841"            /* SHAWEDHAWKSHA */	$"574D 530D 4841 5753 450D 4841 5945 440D"            /* WMSHAWSEHAYED */	$"4841 5945 520D 4841 5945 590D 4841 594C"            /* HAYERHAYEYHAYL */	$"450D 4841 5A41 4E0D 4841 5A45 440D 4841"            /* EHAZANHAZEDHA */	$"5A45 520D 4841 5A45 530D 4845 4144 530D"            /* ZERHAZESHEADS */	$"4845 414C 440D 4845 414C 530D 4845 414D"            /* HEALDHEALSHEAM */	$"450D 4845 4150 530D 4845 4150 590D 4845"            /* EHEAPSHEAPYHE */	$"4152 450D 4845 4152 530D 4845 4153 540D"            /* AREHEARSHEAST */	$"4845 4154 530D 4845 4245 4E0D 4845 4245"            /* HEATSHEBENHEBE */	$"530D 4845 4348 540D 4845 434B 530D 4845"            /* SHECHTHECKSHE */	$"4445 520D 4845 4447 590D 4845 4544 530D"            /* DERHEDGYHEEDS */	$"4845 4544 590D 4845 454C 530D 4845 455A"            /* HEEDYHEELSHEEZ */	$"450D 4845 4654 450D 4845 4654 530D 4845"            /* EHEFTEHEFTSHE */	$"4944 530D 4845 4947 480D 4845 494C 530D"            /* IDSHEIGHHEILS */	$"4845 4952 530D 4845 4A41 420D 4845 4A52"            /* HEIRSHEJABHEJR */	$"410D 4845 4C45 440D 4845 4C45 530D 4845"            /* AHELEDHELESHE */	$"4C49 4F0D 4845 4C4C 530D 4845 4C4D 530D"            /* LIOHELLSHELMS */	$"4845 4C4F 530D 4845 4C4F 540D 4845 4C50"            /* HELOSHELOTHELP */	$"530D 4845 4C56 450D 4845 4D41 4C0D 4845"            /* SHELVEHEMALHE */	$"4D45 530D 4845 4D49 430D 4845 4D49 4E0D"            /* MESHEMICHEMIN */	$"4845 4D50 530D 4845 4D50 590D 4845 4E43"            /* HEMPSHEMPYHENC */	$"480D 4845 4E44 530D 4845 4E47 450D 4845"            /* HHENDSHENGEHE */	$"4E4E 410D 4845 4E4E 590D 4845 4E52 590D"            /* NNAHENNYHENRY */	$"4845 4E54 530D 4845 5041 520D 4845 5242"            /* HENTSHEPARHERB */	$"530D 4845 5242 590D 4845 5244 530D 4845"            /* SHERBYHERDSHE */	$"5245 530D 4845 524C 530D 4845 524D 410D"            /* RESHERLSHERMA */	$"4845 524D 530D 4845 524E 530D 4845 524F"            /* HERMSHERNSHERO */	$"530D 4845 5252 590D 4845 5253 450D 4845"            /* SHERRYHERSEHE */	$"5254 5A0D 4845 5259 450D 4845 5350 530D"            /* RTZHERYEHESPS */	$"4845 5354 530D 4845 5445 530D 4845 5448"            /* HESTSHETESHETH */	$"530D 4845 5543 480D 4845 5547 480D 4845"            /* SHEUCHHEUGHHE */	$"5645 410D 4845 5745 440D 4845 5745 520D"            /* VEAHEWEDHEWER */	$"4845 5747 480D 4845 5841 440D 4845 5845"            /* HEWGHHEXADHEXE */	$"440D 4845 5845 520D 4845 5845 530D 4845"            /* DHEXERHEXESHE */	$"5859 4C0D 4845 5945 440D 4849 414E 540D"            /* XYLHEYEDHIANT */	$"4849 434B 530D 4849 4445 440D 4849 4445"            /* HICKSHIDEDHIDE */	$"520D 4849 4445 530D 4849 454D 530D 4849"            /* RHIDESHIEMSHI */	$"4748 530D 4849 4748 540D 4849 4A41 420D"            /* GHSHIGHTHIJAB */	$"4849 4A52 410D 4849 4B45 440D 4849 4B45"            /* HIJRAHIKEDHIKE */	$"520D 4849 4B45 530D 4849 4B4F 490D 4849"            /* RHIKESHIKOIHI */	$"4C41 520D 4849 4C43 480D 4849 4C4C 4F0D"            /* LARHILCHHILLO */	$"4849 4C4C 530D 4849 4C54 530D 4849 4C55"            /* HILLSHILTSHILU */	$"4D0D 4849 4C55 530D 4849 4D42 4F0D 4849"            /* MHILUSHIMBOHI */	$"4E41 550D 4849 4E44 530D 4849 4E47 530D"            /* NAUHINDSHINGS */	$"4849 4E4B 590D 4849 4E4E 590D 4849 4E54"            /* HINKYHINNYHINT */	$"530D 4849 4F49 530D 4849 504C 590D 4849"            /* SHIOISHIPLYHI */	$"5245 440D 4849 5245 450D 4849 5245 520D"            /* REDHIREEHIRER */	$"4849 5245 530D 4849 5353 590D 4849 5354"            /* HIRESHISSYHIST */	$"530D 4849 5448 450D 4849 5645 440D 4849"            /* SHITHEHIVEDHI */	$"5645 520D 4849 5645 530D 4849 5A45 4E0D"            /* VERHIVESHIZEN */	$"484F 4145 440D 484F 4147 590D 484F 4152"            /* HOAEDHOAGYHOAR */	$"530D 484F 4152 590D 484F 4153 540D 484F"            /* SHOARYHOASTHO */	$"424F 530D 484F 434B 530D 484F 4355 530D"            /* BOSHOCKSHOCUS */	$"484F 4441 440D 484F 444A 410D 484F 4552"            /* HODADHODJAHOER */	$"530D 484F 4741 4E0D 484F 4745 4E0D 484F"            /* SHOGANHOGENHO */	$"4747 530D 484F 4748 530D 484F 4845 440D"            /* GGSHOGHSHOHED */	$"484F 4943 4B0D 484F 4945 440D 484F 494B"            /* HOICKHOIEDHOIK */	$"530D 484F 494E 470D 484F 4953 450D 484F"            /* SHOINGHOISEHO */	$"4B41 530D 484F 4B45 440D 484F 4B45 530D"            /* KASHOKEDHOKES */	$"484F 4B45 590D 484F 4B49 530D 484F 4B4B"            /* HOKEYHOKISHOKK */	$"550D 484F 4B55 4D0D 484F 4C44 530D 484F"            /* UHOKUMHOLDSHO */	$"4C45 440D 484F 4C45 530D 484F 4C45 590D"            /* LEDHOLESHOLEY */	$"484F 4C4B 530D 484F 4C4C 410D 484F 4C4C"            /* HOLKSHOLLAHOLL */	$"4F0D 484F 4C4D 450D 484F 4C4D 530D 484F"            /* OHOLMEHOLMSHO */	$"4C4F 4E0D 484F 4C4F 530D 484F 4C54 530D"            /* LONHOLOSHOLTS */	$"484F 4D41 530D 484F 4D45 440D 484F 4D45"            /* HOMASHOMEDHOME */	$"530D 484F 4D45 590D 484F 4D49 450D 484F"            /* SHOMEYHOMIEHO */	$"4D4D 450D 484F 4D4F 530D 484F 4E41 4E0D"            /* MMEHOMOSHONAN */	$"484F 4E44 410D 484F 4E44 530D 484F 4E45"            /* HONDAHONDSHONE */	$"440D 484F 4E45 520D 484F 4E45 530D 484F"            /* DHONERHONESHO */	$"4E47 490D 484F 4E47 530D 484F 4E4B 530D"            /* NGIHONGSHONKS */	$"484F 4E4B 590D 484F 4F43 480D 484F 4F44"            /* HONKYHOOCHHOOD */	$"530D 484F 4F44 590D 484F 4F45 590D 484F"            /* SHOODYHOOEYHO */	$"4F46 530D 484F 4F4B 410D 484F 4F4B 530D"            /* OFSHOOKAHOOKS */	$"484F 4F4B 590D 484F 4F4C 590D 484F 4F4E"            /* HOOKYHOOLYHOON */	$"530D 484F 4F50 530D 484F 4F52 440D 484F"            /* SHOOPSHOORDHO */	$"4F52 530D 484F 4F53 480D 484F 4F54 530D"            /* ORSHOOSHHOOTS */	$"484F 4F54 590D 484F 4F56 450D 484F 5041"            /* HOOTYHOOVEHOPA */	$"4B0D 484F 5045 440D 484F 5045 520D 484F"            /* KHOPEDHOPERHO */	$"5045 530D 484F 5050 590D 484F 5241 480D"            /* PESHOPPYHORAH */	$"484F 5241 4C0D 484F 5241 530D 484F 5249"            /* HORALHORASHORI */	$"530D 484F 524B 530D 484F 524D 450D 484F"            /* SHORKSHORMEHO */	$"524E 530D 484F 5253 540D 484F 5253 590D"            /* RNSHORSTHORSY */	$"484F 5345 440D 484F 5345 4C0D 484F 5345"            /* HOSEDHOSELHOSE */	$"4E0D 484F 5345 520D 484F 5345 530D 484F"            /* NHOSERHOSESHO */	$"5345 590D 484F 5354 410D 484F 5354 530D"            /* SEYHOSTAHOSTS */	$"484F 5443 480D 484F 5445 4E0D 484F 5454"            /* HOTCHHOTENHOTT */	$"590D 484F 5546 460D 484F 5546 530D 484F"            /* YHOUFFHOUFSHO */	$"5547 480D 484F 5552 490D 484F 5552 530D"            /* UGHHOURIHOURS */	$"484F 5554 530D 484F 5645 410D 484F 5645"            /* HOUTSHOVEAHOVE */	$"440D 484F 5645 4E0D 484F 5645 530D 484F"            /* DHOVENHOVESHO */	$"5742 450D 484F 5745 530D 484F 5746 460D"            /* WBEHOWESHOWFF */	$"484F 5746 530D 484F 574B 530D 484F 574C"            /* HOWFSHOWKSHOWL */	$"530D 484F 5752 450D 484F 5753 4F0D 484F"            /* SHOWREHOWSOHO */	$"5845 440D 484F 5845 530D 484F 5941 530D"            /* XEDHOXESHOYAS */	$"484F 5945 440D 484F 594C 450D 4855 4242"            /* HOYEDHOYLEHUBB */	$"590D 4855 434B 530D 4855 444E 410D 4855"            /* YHUCKSHUDNAHU */	$"4455 440D 4855 4552 530D 4855 4646 530D"            /* DUDHUERSHUFFS */	$"4855 4646 590D 4855 4745 520D 4855 4747"            /* HUFFYHUGERHUGG */	$"590D 4855 4855 530D 4855 4941 530D 4855"            /* YHUHUSHUIASHU */	$"4C41 530D 4855 4C45 530D 4855 4C4B 530D"            /* LASHULESHULKS */	$"4855 4C4B 590D 4855 4C4C 4F0D 4855 4C4C"            /* HULKYHULLOHULL */	$"530D 4855 4C4C 590D 4855 4D41 530D 4855"            /* SHULLYHUMASHU */	$"4D46 530D 4855 4D49 430D 4855 4D50 530D"            /* MFSHUMICHUMPS */	$"4855 4D50 590D 4855 4E4B 530D 4855 4E54"            /* HUMPYHUNKSHUNT */	$"530D 4855 5244 530D 4855 524C 530D 4855"            /* SHURDSHURLSHU */	$"524C 590D 4855 5252 410D 4855 5253 540D"            /* RLYHURRAHURST */	$"4855 5254 530D 4855 5348 590D 4855 534B"            /* HURTSHUSHYHUSK */	$"530D 4855 534F 530D 4855 5449 410D 4855"            /* SHUSOSHUTIAHU */	$"5A5A 410D 4855 5A5A 590D 4857 594C 530D"            /* ZZAHUZZYHWYLS */	$"4859 4452 410D 4859 454E 530D 4859 4747"            /* HYDRAHYENSHYGG */	$"450D 4859 494E 470D 4859 4B45 530D 4859"            /* EHYINGHYKESHY */	$"4C41 530D 4859 4C45 470D 4859 4C45 530D"            /* LASHYLEGHYLES */	$"4859 4C49 430D 4859 4D4E 530D 4859 4E44"            /* HYLICHYMNSHYND */	$"450D 4859 4F49 440D 4859 5045 440D 4859"            /* EHYOIDHYPEDHY */	$"5045 530D 4859 5048 410D 4859 5048 590D"            /* PESHYPHAHYPHY */	$"4859 504F 530D 4859 5241 580D 4859 534F"            /* HYPOSHYRAXHYSO */	$"4E0D 4859 5448 450D 4941 4D42 490D 4941"            /* NHYTHEIAMBIIA */	$"4D42 530D 4942 5249 4B0D 4943 4552 530D"            /* MBSIBRIKICERS */	$"4943 4845 440D 4943 4845 530D 4943 484F"            /* ICHEDICHESICHO */	$"520D 4943 4945 520D 4943 4B45 520D 4943"            /* RICIERICKERIC */	$"4B4C 450D 4943 4F4E 530D 4943 5441 4C0D"            /* KLEICONSICTAL */	$"4943 5449 430D 4943 5455 530D 4944 414E"            /* ICTICICTUSIDAN */	$"540D 4944 4541 530D 4944 4545 530D 4944"            /* TIDEASIDEESID */	$"454E 540D 4944 4C45 440D 4944 4C45 530D"            /* ENTIDLEDIDLES */	$"4944 4F4C 410D 4944 4F4C 530D 4944 594C"            /* IDOLAIDOLSIDYL */	$"530D 4946 5441 520D 4947 4150 4F0D 4947"            /* SIFTARIGAPOIG */	$"4745 440D 4947 4C55 530D 4948 5241 4D0D"            /* GEDIGLUSIHRAM */	$"494B 414E 530D 494B 4154 530D 494B 4F4E"            /* IKANSIKATSIKON */	$"530D 494C 4541 430D 494C 4541 4C0D 494C"            /* SILEACILEALIL */	$"4555 4D0D 494C 4555 530D 494C 4941 440D"            /* EUMILEUSILIAD */	$"494C 4941 4C0D 494C 4955 4D0D 494C 4C45"            /* ILIALILIUMILLE */	$"520D 494C 4C54 480D 494D 4147 4F0D 494D"            /* RILLTHIMAGOIM */	$"414D 530D 494D 4152 490D 494D 4155 4D0D"            /* AMSIMARIIMAUM */	$"494D 4241 520D 494D 4245 440D 494D 4944"            /* IMBARIMBEDIMID */	$"450D 494D 4944 4F0D 494D 4944 530D 494D"            /* EIMIDOIMIDSIM */	$"494E 450D 494D 494E 4F0D 494D 4D45 570D"            /* INEIMINOIMMEW */	$"494D 4D49 540D 494D 4D49 580D 494D 5045"            /* IMMITIMMIXIMPE */	$"440D 494D 5049 530D 494D 504F 540D 494D"            /* DIMPISIMPOTIM */	$"5052 4F0D 494D 5348 490D 494D 5348 590D"            /* PROIMSHIIMSHY */	$"494E 4150 540D 494E 4152 4D0D 494E 4259"            /* INAPTINARMINBY */	$"450D 494E 4345 4C0D 494E 434C 450D 494E"            /* EINCELINCLEIN */	$"434F 470D 494E 4355 530D 494E 4355 540D"            /* COGINCUSINCUT */	$"494E 4445 570D 494E 4449 410D 494E 4449"            /* INDEWINDIAINDI */	$"450D 494E 444F 4C0D 494E 444F 570D 494E"            /* EINDOLINDOWIN */	$"4452 490D 494E 4455 450D 494E 4552 4D0D"            /* DRIINDUEINERM */	$"494E 4649 580D 494E 464F 530D 494E 4652"            /* INFIXINFOSINFR */	$"410D 494E 4741 4E0D 494E 474C 450D 494E"            /* AINGANINGLEIN */	$"494F 4E0D 494E 4B45 440D 494E 4B45 520D"            /* IONINKEDINKER */	$"494E 4B4C 450D 494E 4E45 440D 494E 4E49"            /* INKLEINNEDINNI */	$"540D 494E 4F52 420D 494E 5255 4E0D 494E"            /* TINORBINRUNIN */	$"5345 540D 494E 5350 4F0D 494E 5445 4C0D"            /* SETINSPOINTEL */	$"494E 5449 4C0D 494E 5449 530D 494E 5452"            /* INTILINTISINTR */	$"410D 494E 554C 410D 494E 5552 450D 494E"            /* AINULAINUREIN */	$"5552 4E0D 494E 5553 540D 494E 5641 520D"            /* URNINUSTINVAR */	$"494E 5749 540D 494F 4449 430D 494F 4449"            /* INWITIODICIODI */	$"440D 494F 4449 4E0D 494F 5441 530D 4950"            /* DIODINIOTASIP */	$"504F 4E0D 4952 4144 450D 4952 4944 530D"            /* PONIRADEIRIDS */	$"4952 494E 470D 4952 4B45 440D 4952 4F4B"            /* IRINGIRKEDIROK */	$"4F0D 4952 4F4E 450D 4952 4F4E 530D 4953"            /* OIRONEIRONSIS */	$"4241 530D 4953 4845 530D 4953 4C45 440D"            /* BASISHESISLED */	$"4953 4C45 530D 4953 4E41 450D 4953 5345"            /* ISLESISNAEISSE */	$"490D 4953 544C 450D 4954 454D 530D 4954"            /* IISTLEITEMSIT */	$"4845 520D 4956 4945 440D 4956 4945 530D"            /* HERIVIEDIVIES */	$"4958 4941 530D 4958 4E41 590D 4958 4F52"            /* IXIASIXNAYIXOR */	$"410D 4958 544C 450D 495A 4152 440D 495A"            /* AIXTLEIZARDIZ */	$"4152 530D 495A 5A41 540D 4A41 4150 530D"            /* ARSIZZATJAAPS */	$"4A41 424F 540D 4A41 4341 4C0D 4A41 434B"            /* JABOTJACALJACK */	$"530D 4A41 434B 590D 4A41 4445 440D 4A41"            /* SJACKYJADEDJA */	$"4445 530D 4A41 4641 530D 4A41 4646 410D"            /* DESJAFASJAFFA */	$"4A41 4741 530D 4A41 4745 520D 4A41 4747"            /* JAGASJAGERJAGG */	$"530D 4A41 4747 590D 4A41 4749 520D 4A41"            /* SJAGGYJAGIRJA */	$"4752 410D 4A41 494C 530D 4A41 4B45 520D"            /* GRAJAILSJAKER */	$"4A41 4B45 530D 4A41 4B45 590D 4A41 4C41"            /* JAKESJAKEYJALA */	$"500D 4A41 4C4F 500D 4A41 4D42 450D 4A41"            /* PJALOPJAMBEJA */	$"4D42 4F0D 4A41 4D42 530D 4A41 4D42 550D"            /* MBOJAMBSJAMBU */	$"4A41 4D45 530D 4A41 4D4D 590D 4A41 4D4F"            /* JAMESJAMMYJAMO */	$"4E0D 4A41 4E45 530D 4A41 4E4E 530D 4A41"            /* NJANESJANNSJA */	$"4E4E 590D 4A41 4E54 590D 4A41 5041 4E0D"            /* NNYJANTYJAPAN */	$"4A41 5045 440D 4A41 5045 520D 4A41 5045"            /* JAPEDJAPERJAPE */	$"530D 4A41 524B 530D 4A41 524C 530D 4A41"            /* SJARKSJARLSJA */	$"5250 530D 4A41 5254 410D 4A41 5255 4C0D"            /* RPSJARTAJARUL */	$"4A41 5345 590D 4A41 5350 450D 4A41 5350"            /* JASEYJASPEJASP */	$"530D 4A41 544F 530D 4A41 554B 530D 4A41"            /* SJATOSJAUKSJA */	$"5550 530D 4A41 5641 530D 4A41 5645 4C0D"            /* UPSJAVASJAVEL */	$"4A41 5741 4E0D 4A41 5745 440D 4A41 5849"            /* JAWANJAWEDJAXI */	$"450D 4A45 414E 530D 4A45 4154 530D 4A45"            /* EJEANSJEATSJE */	$"4245 4C0D 4A45 4449 530D 4A45 454C 530D"            /* BELJEDISJEELS */	$"4A45 454C 590D 4A45 4550 530D 4A45 4552"            /* JEELYJEEPSJEER */	$"530D 4A45 455A 450D 4A45 4645 530D 4A45"            /* SJEEZEJEFESJE */	$"4646 530D 4A45 4841 440D 4A45 4855 530D"            /* FFSJEHADJEHUS */	$"4A45 4C41 420D 4A45 4C4C 4F0D 4A45 4C4C"            /* JELABJELLOJELL */	$"530D 4A45 4D42 450D 4A45 4D4D 590D 4A45"            /* SJEMBEJEMMYJE */	$"4E4E 590D 4A45 4F4E 530D 4A45 5249 440D"            /* NNYJEONSJERID */	$"4A45 524B 530D 4A45 5252 590D 4A45 5353"            /* JERKSJERRYJESS */	$"450D 4A45 5354 530D 4A45 5355 530D 4A45"            /* EJESTSJESUSJE */	$"5445 530D 4A45 544F 4E0D 4A45 554E 450D"            /* TESJETONJEUNE */	$"4A45 5745 440D 4A45 5749 450D 4A48 414C"            /* JEWEDJEWIEJHAL */	$"410D 4A49 414F 530D 4A49 4242 410D 4A49"            /* AJIAOSJIBBAJI */	$"4242 530D 4A49 4245 440D 4A49 4245 520D"            /* BBSJIBEDJIBER */	$"4A49 4245 530D 4A49 4646 530D 4A49 4747"            /* JIBESJIFFSJIGG */	$"590D 4A49 474F 540D 4A49 4841 440D 4A49"            /* YJIGOTJIHADJI */	$"4C4C 530D 4A49 4C54 530D 4A49 4D4D 590D"            /* LLSJILTSJIMMY */	$"4A49 4D50 590D 4A49 4E47 4F0D 4A49 4E4B"            /* JIMPYJINGOJINK */	$"530D 4A49 4E4E 450D 4A49 4E4E 490D 4A49"            /* SJINNEJINNIJI */	$"4E4E 530D 4A49 5244 530D 4A49 5247 410D"            /* NNSJIRDSJIRGA */	$"4A49 5252 450D 4A49 534D 530D 4A49 5645"            /* JIRREJISMSJIVE */	$"440D 4A49 5645 520D 4A49 5645 530D 4A49"            /* DJIVERJIVESJI */	$"5645 590D 4A4E 414E 410D 4A4F 4245 440D"            /* VEYJNANAJOBED */	$"4A4F 4245 530D 4A4F 434B 4F0D 4A4F 434B"            /* JOBESJOCKOJOCK */	$"530D 4A4F 434B 590D 4A4F 434F 530D 4A4F"            /* SJOCKYJOCOSJO */	$"4445 4C0D 4A4F 4559 530D 4A4F 484E 530D"            /* DELJOEYSJOHNS */	$"4A4F 494E 530D 4A4F 4B45 440D 4A4F 4B45"            /* JOINSJOKEDJOKE */	$"530D 4A4F 4B45 590D 4A4F 4B4F 4C0D 4A4F"            /* SJOKEYJOKOLJO */	$"4C45 440D 4A4F 4C45 530D 4A4F 4C4C 530D"            /* LEDJOLESJOLLS */	$"4A4F 4C54 530D 4A4F 4C54 590D 4A4F 4D4F"            /* JOLTSJOLTYJOMO */	$"4E0D 4A4F 4D4F 530D 4A4F 4E45 530D 4A4F"            /* NJOMOSJONESJO */	$"4E47 530D 4A4F 4E54 590D 4A4F 4F4B 530D"            /* NGSJONTYJOOKS */	$"4A4F 5241 4D0D 4A4F 5255 4D0D 4A4F 5441"            /* JORAMJORUMJOTA */	$"530D 4A4F 5454 590D 4A4F 5455 4E0D 4A4F"            /* SJOTTYJOTUNJO */	$"5541 4C0D 4A4F 5547 530D 4A4F 554B 530D"            /* UALJOUGSJOUKS */	$"4A4F 554C 450D 4A4F 5552 530D 4A4F 5741"            /* JOULEJOURSJOWA */	$"520D 4A4F 5745 440D 4A4F 574C 530D 4A4F"            /* RJOWEDJOWLSJO */	$"574C 590D 4A4F 5945 440D 4A55 4241 530D"            /* WLYJOYEDJUBAS */	$"4A55 4245 530D 4A55 434F 530D 4A55 4441"            /* JUBESJUCOSJUDA */	$"530D 4A55 4447 590D 4A55 444F 530D 4A55"            /* SJUDGYJUDOSJU */	$"4741 4C0D 4A55 4755 4D0D 4A55 4A55 530D"            /* GALJUGUMJUJUS */	$"4A55 4B45 440D 4A55 4B45 530D 4A55 4B55"            /* JUKEDJUKESJUKU */	$"530D 4A55 4C45 500D 4A55 4D41 520D 4A55"            /* SJULEPJUMARJU */	$"4D42 590D 4A55 4D50 530D 4A55 4E43 4F0D"            /* MBYJUMPSJUNCO */	$"4A55 4E4B 530D 4A55 4E4B 590D 4A55 5045"            /* JUNKSJUNKYJUPE */	$"530D 4A55 504F 4E0D 4A55 5241 4C0D 4A55"            /* SJUPONJURALJU */	$"5241 540D 4A55 5245 4C0D 4A55 5245 530D"            /* RATJURELJURES */	$"4A55 5354 530D 4A55 5445 530D 4A55 5454"            /* JUSTSJUTESJUTT */	$"590D 4A55 5645 530D 4A55 5649 450D 4B41"            /* YJUVESJUVIEKA */	$"414D 410D 4B41 4241 420D 4B41 4241 520D"            /* AMAKABABKABAR */	$"4B41 424F 420D 4B41 4348 410D 4B41 434B"            /* KABOBKACHAKACK */	$"530D 4B41 4441 490D 4B41 4445 530D 4B41"            /* SKADAIKADESKA */	$"4449 530D 4B41 4649 520D 4B41 474F 530D"            /* DISKAFIRKAGOS */	$"4B41 4755 530D 4B41 4841 4C0D 4B41 4941"            /* KAGUSKAHALKAIA */	$"4B0D 4B41 4944 530D 4B41 4945 530D 4B41"            /* KKAIDSKAIESKA */	$"4946 530D 4B41 494B 410D 4B41 494B 530D"            /* IFSKAIKAKAIKS */	$"4B41 494C 530D 4B41 494D 530D 4B41 494E"            /* KAILSKAIMSKAIN */	$"470D 4B41 494E 530D 4B41 4B41 530D 4B41"            /* GKAINSKAKASKA */	$"4B49 530D 4B41 4C41 4D0D 4B41 4C45 530D"            /* KISKALAMKALES */	$"4B41 4C49 460D 4B41 4C49 530D 4B41 4C50"            /* KALIFKALISKALP */	$"410D 4B41 4D41 530D 4B41 4D45 530D 4B41"            /* AKAMASKAMESKA */	$"4D49 4B0D 4B41 4D49 530D 4B41 4D4D 450D"            /* MIKKAMISKAMME */	$"4B41 4E41 450D 4B41 4E41 530D 4B41 4E44"            /* KANAEKANASKAND */	$"590D 4B41 4E45 480D 4B41 4E45 530D 4B41"            /* YKANEHKANESKA */	$"4E47 410D 4B41 4E47 530D 4B41 4E4A 490D"            /* NGAKANGSKANJI */	$"4B41 4E54 530D 4B41 4E5A 550D 4B41 4F4E"            /* KANTSKANZUKAON */	$"530D 4B41 5041 530D 4B41 5048 530D 4B41"            /* SKAPASKAPHSKA */	$"504F 4B0D 4B41 504F 570D 4B41 5055 530D"            /* POKKAPOWKAPUS */	$"4B41 5055 540D 4B41 5241 530D 4B41 5241"            /* KAPUTKARASKARA */	$"540D 4B41 524B 530D 4B41 524E 530D 4B41"            /* TKARKSKARNSKA */	$"524F 4F0D 4B41 524F 530D 4B41 5252 490D"            /* ROOKAROSKARRI */	$"4B41 5253 540D 4B41 5253 590D 4B41 5254"            /* KARSTKARSYKART */	$"530D 4B41 525A 590D 4B41 5348 410D 4B41"            /* SKARZYKASHAKA */	$"534D 450D 4B41 5441 4C0D 4B41 5441 530D"            /* SMEKATALKATAS */	$"4B41 5449 530D 4B41 5454 490D 4B41 5547"            /* KATISKATTIKAUG */	$"480D 4B41 5552 490D 4B41 5552 550D 4B41"            /* HKAURIKAURUKA */	$"5552 590D 4B41 5641 4C0D 4B41 5641 530D"            /* URYKAVALKAVAS */	$"4B41 5741 530D 4B41 5741 550D 4B41 5745"            /* KAWASKAWAUKAWE */	$"440D 4B41 594C 450D 4B41 594F 530D 4B41"            /* DKAYLEKAYOSKA */	$"5A49 530D 4B41 5A4F 4F0D 4B42 4152 530D"            /* ZISKAZOOKBARS */	$"4B45 4241 520D 4B45 424F 420D 4B45 434B"            /* KEBARKEBOBKECK */	$"530D 4B45 4447 450D 4B45 4447 590D 4B45"            /* SKEDGEKEDGYKE */	$"4543 480D 4B45 4546 530D 4B45 454B 530D"            /* ECHKEEFSKEEKS */	$"4B45 454C 530D 4B45 454D 410D 4B45 454E"            /* KEELSKEEMAKEEN */	$"4F0D 4B45 454E 530D 4B45 4550 530D 4B45"            /* OKEENSKEEPSKE */	$"4554 530D 4B45 4556 450D 4B45 4649 520D"            /* ETSKEEVEKEFIR */	$"4B45 4855 410D 4B45 4952 530D 4B45 4C45"            /* KEHUAKEIRSKELE */	$"500D 4B45 4C49 4D0D 4B45 4C4C 530D 4B45"            /* PKELIMKELLSKE */	$"4C4C 590D 4B45 4C50 530D 4B45 4C50 590D"            /* LLYKELPSKELPY */	$"4B45 4C54 530D 4B45 4C54 590D 4B45 4D42"            /* KELTSKELTYKEMB */	$"4F0D 4B45 4D42 530D 4B45 4D50 530D 4B45"            /* OKEMBSKEMPSKE */	$"4D50 540D 4B45 4D50 590D 4B45 4E41 460D"            /* MPTKEMPYKENAF */	$"4B45 4E43 480D 4B45 4E44 4F0D 4B45 4E4F"            /* KENCHKENDOKENO */	$"530D 4B45 4E54 450D 4B45 4E54 530D 4B45"            /* SKENTEKENTSKE */	$"5049 530D 4B45 5242 530D 4B45 5245 4C0D"            /* PISKERBSKEREL */	$"4B45 5246 530D 4B45 524B 590D 4B45 524D"            /* KERFSKERKYKERM */	$"410D 4B45 524E 450D 4B45 524E 530D 4B45"            /* AKERNEKERNSKE */	$"524F 530D 4B45 5252 590D 4B45 5256 450D"            /* ROSKERRYKERVE */	$"4B45 5341 520D 4B45 5354 530D 4B45 5441"            /* KESARKESTSKETA */	$"530D 4B45 5443 480D 4B45 5445 530D 4B45"            /* SKETCHKETESKE */	$"544F 4C0D 4B45 5645 4C0D 4B45 5649 4C0D"            /* TOLKEVELKEVIL */	$"4B45 5845 530D 4B45 5945 440D 4B45 5945"            /* KEXESKEYEDKEYE */	$"520D 4B48 4144 490D 4B48 4146 530D 4B48"            /* RKHADIKHAFSKH */	$"414E 530D 4B48 4150 480D 4B48 4154 530D"            /* ANSKHAPHKHATS */	$"4B48 4159 410D 4B48 415A 490D 4B48 4544"            /* KHAYAKHAZIKHED */	$"410D 4B48 4554 480D 4B48 4554 530D 4B48"            /* AKHETHKHETSKH */	$"4F4A 410D 4B48 4F52 530D 4B48 4F55 4D0D"            /* OJAKHORSKHOUM */	$"4B48 5544 530D 4B49 4141 540D 4B49 4143"            /* KHUDSKIAATKIAC */	$"4B0D 4B49 414E 470D 4B49 4242 450D 4B49"            /* KKIANGKIBBEKI */	$"4242 490D 4B49 4245 490D 4B49 4245 530D"            /* BBIKIBEIKIBES */	$"4B49 424C 410D 4B49 434B 530D 4B49 434B"            /* KIBLAKICKSKICK */	$"590D 4B49 4444 4F0D 4B49 4444 590D 4B49"            /* YKIDDOKIDDYKI */	$"4445 4C0D 4B49 4447 450D 4B49 4546 530D"            /* DELKIDGEKIEFS */	$"4B49 4552 530D 4B49 4556 450D 4B49 4556"            /* KIERSKIEVEKIEV */	$"530D 4B49 4748 540D 4B49 4B45 530D 4B49"            /* SKIGHTKIKESKI */	$"4B4F 490D 4B49 4C45 590D 4B49 4C49 4D0D"            /* KOIKILEYKILIM */	$"4B49 4C4C 530D 4B49 4C4E 530D 4B49 4C4F"            /* KILLSKILNSKILO */	$"530D 4B49 4C50 530D 4B49 4C54 530D 4B49"            /* SKILPSKILTSKI */	$"4C54 590D 4B49 4D42 4F0D 4B49 4E41 530D"            /* LTYKIMBOKINAS */	$"4B49 4E44 410D 4B49 4E44 530D 4B49 4E44"            /* KINDAKINDSKIND */	$"590D 4B49 4E45 530D 4B49 4E47 530D 4B49"            /* YKINESKINGSKI */	$"4E49 4E0D 4B49 4E4B 530D 4B49 4E4F 530D"            /* NINKINKSKINOS */	$"4B49 4F52 450D 4B49 5045 530D 4B49 5050"            /* KIOREKIPESKIPP */	$"410D 4B49 5050 530D 4B49 5242 590D 4B49"            /* AKIPPSKIRBYKI */	$"524B 530D 4B49 524E 530D 4B49 5252 490D"            /* RKSKIRNSKIRRI */	$"4B49 5341 4E0D 4B49 5353 590D 4B49 5354"            /* KISANKISSYKIST */	$"530D 4B49 5445 440D 4B49 5445 520D 4B49"            /* SKITEDKITERKI */	$"5445 530D 4B49 5448 450D 4B49 5448 530D"            /* TESKITHEKITHS */	$"4B49 5455 4C0D 4B49 5641 530D 4B49 5749"            /* KITULKIVASKIWI */	$"530D 4B4C 414E 470D 4B4C 4150 530D 4B4C"            /* SKLANGKLAPSKL */	$"4554 540D 4B4C 4943 4B0D 4B4C 4945 470D"            /* ETTKLICKKLIEG */	$"4B4C 494B 530D 4B4C 4F4E 470D 4B4C 4F4F"            /* KLIKSKLONGKLOO */	$"460D 4B4C 5547 450D 4B4C 5554 5A0D 4B4E"            /* FKLUGEKLUTZKN */	$"4147 530D 4B4E 4150 530D 4B4E 4152 4C0D"            /* AGSKNAPSKNARL */	$"4B4E 4152 530D 4B4E 4155 520D 4B4E 4157"            /* KNARSKNAURKNAW */	$"450D 4B4E 4545 530D 4B4E 454C 4C0D 4B4E"            /* EKNEESKNELLKN */	$"4953 480D 4B4E 4954 530D 4B4E 4956 450D"            /* ISHKNITSKNIVE */	$"4B4E 4F42 530D 4B4E 4F50 530D 4B4E 4F53"            /* KNOBSKNOPSKNOS */	$"500D 4B4E 4F54 530D 4B4E 4F55 540D 4B4E"            /* PKNOTSKNOUTKN */	$"4F57 450D 4B4E 4F57 530D 4B4E 5542 530D"            /* OWEKNOWSKNUBS */	$"4B4E 5552 4C0D 4B4E 5552 520D 4B4E 5552"            /* KNURLKNURRKNUR */	$"530D 4B4E 5554 530D 4B4F 414E 530D 4B4F"            /* SKNUTSKOANSKO */	$"4150 530D 4B4F 4241 4E0D 4B4F 424F 530D"            /* APSKOBANKOBOS */	$"4B4F 454C 530D 4B4F 4646 530D 4B4F 4654"            /* KOELSKOFFSKOFT */	$"410D 4B4F 4741 4C0D 4B4F 4841 530D 4B4F"            /* AKOGALKOHASKO */	$"4845 4E0D 4B4F 484C 530D 4B4F 494E 450D"            /* HENKOHLSKOINE */	$"4B4F 4A49 530D 4B4F 4B41 4D0D 4B4F 4B41"            /* KOJISKOKAMKOKA */	$"530D 4B4F 4B45 520D 4B4F 4B52 410D 4B4F"            /* SKOKERKOKRAKO */	$"4B55 4D0D 4B4F 4C41 530D 4B4F 4C4F 530D"            /* KUMKOLASKOLOS */	$"4B4F 4D42 550D 4B4F 4E42 550D 4B4F 4E44"            /* KOMBUKONBUKOND */	$"4F0D 4B4F 4E4B 530D 4B4F 4F4B 530D 4B4F"            /* OKONKSKOOKSKO */	$"4F4B 590D 4B4F 4F52 490D 4B4F 5045 4B0D"            /* OKYKOORIKOPEK */	$"4B4F 5048 530D 4B4F 504A 450D 4B4F 5050"            /* KOPHSKOPJEKOPP */	$"410D 4B4F 5241 490D 4B4F 5241 530D 4B4F"            /* AKORAIKORASKO */	$"5241 540D 4B4F 5245 530D 4B4F 524D 410D"            /* RATKORESKORMA */	$"4B4F 524F 530D 4B4F 5255 4E0D 4B4F 5255"            /* KOROSKORUNKORU */	$"530D 4B4F 5345 530D 4B4F 5443 480D 4B4F"            /* SKOSESKOTCHKO */	$"544F 530D 4B4F 544F 570D 4B4F 5552 410D"            /* TOSKOTOWKOURA */	$"4B52 4141 4C0D 4B52 4142 530D 4B52 4146"            /* KRAALKRABSKRAF */	$"540D 4B52 4149 530D 4B52 4149 540D 4B52"            /* TKRAISKRAITKR */	$"414E 470D 4B52 414E 530D 4B52 414E 5A0D"            /* ANGKRANSKRANZ */	$"4B52 4155 540D 4B52 4159 530D 4B52 4545"            /* KRAUTKRAYSKREE */	$"500D 4B52 454E 470D 4B52 4557 450D 4B52"            /* PKRENGKREWEKR */	$"4F4E 410D 4B52 4F4E 450D 4B52 4F4F 4E0D"            /* ONAKRONEKROON */	$"4B52 5542 490D 4B52 554E 4B0D 4B53 4152"            /* KRUBIKRUNKKSAR */	$"530D 4B55 4249 450D 4B55 444F 530D 4B55"            /* SKUBIEKUDOSKU */	$"4455 530D 4B55 445A 550D 4B55 4649 530D"            /* DUSKUDZUKUFIS */	$"4B55 4745 4C0D 4B55 4941 530D 4B55 4B52"            /* KUGELKUIASKUKR */	$"490D 4B55 4B55 530D 4B55 4C41 4B0D 4B55"            /* IKUKUSKULAKKU */	$"4C41 4E0D 4B55 4C41 530D 4B55 4C46 490D"            /* LANKULASKULFI */	$"4B55 4D49 530D 4B55 4D59 530D 4B55 5249"            /* KUMISKUMYSKURI */	$"530D 4B55 5252 450D 4B55 5254 410D 4B55"            /* SKURREKURTAKU */	$"5255 530D 4B55 5353 4F0D 4B55 5441 530D"            /* RUSKUSSOKUTAS */	$"4B55 5443 480D 4B55 5449 530D 4B55 5455"            /* KUTCHKUTISKUTU */	$"530D 4B55 5A55 530D 4B56 4153 530D 4B56"            /* SKUZUSKVASSKV */	$"454C 4C0D 4B57 454C 410D 4B59 4143 4B0D"            /* ELLKWELAKYACK */	$"4B59 414B 530D 4B59 414E 470D 4B59 4152"            /* KYAKSKYANGKYAR */	$"530D 4B59 4154 530D 4B59 424F 530D 4B59"            /* SKYATSKYBOSKY */	$"4453 540D 4B59 4C45 530D 4B59 4C49 450D"            /* DSTKYLESKYLIE */	$"4B59 4C49 4E0D 4B59 4C49 580D 4B59 4C4F"            /* KYLINKYLIXKYLO */	$"450D 4B59 4E44 450D 4B59 4E44 530D 4B59"            /* EKYNDEKYNDSKY */	$"5045 530D 4B59 5249 450D 4B59 5445 530D"            /* PESKYRIEKYTES */	$"4B59 5448 450D 4C41 4152 490D 4C41 4244"            /* KYTHELAARILABD */	$"410D 4C41 4249 410D 4C41 4249 530D 4C41"            /* ALABIALABISLA */	$"4252 410D 4C41 4345 440D 4C41 4345 520D"            /* BRALACEDLACER */	$"4C41 4345 530D 4C41 4345 540D 4C41 4345"            /* LACESLACETLACE */	$"590D 4C41 434B 530D 4C41 4444 590D 4C41"            /* YLACKSLADDYLA */	$"4445 440D 4C41 4445 520D 4C41 4445 530D"            /* DEDLADERLADES */	$"4C41 4552 530D 4C41 4556 4F0D 4C41 4741"            /* LAERSLAEVOLAGA */	$"4E0D 4C41 4841 4C0D 4C41 4841 520D 4C41"            /* NLAHALLAHARLA */	$"4943 480D 4C41 4943 530D 4C41 4944 530D"            /* ICHLAICSLAIDS */	$"4C41 4947 480D 4C41 494B 410D 4C41 494B"            /* LAIGHLAIKALAIK */	$"530D 4C41 4952 440D 4C41 4952 530D 4C41"            /* SLAIRDLAIRSLA */	$"4952 590D 4C41 4954 480D 4C41 4954 590D"            /* IRYLAITHLAITY */	$"4C41 4B45 440D 4C41 4B45 520D 4C41 4B45"            /* LAKEDLAKERLAKE */	$"530D 4C41 4B48 530D 4C41 4B49 4E0D 4C41"            /* SLAKHSLAKINLA */	$"4B53 410D 4C41 4C44 590D 4C41 4C4C 530D"            /* KSALALDYLALLS */	$"4C41 4D41 530D 4C41 4D42 530D 4C41 4D42"            /* LAMASLAMBSLAMB */	$"590D 4C41 4D45 440D 4C41 4D45 520D 4C41"            /* YLAMEDLAMERLA */	$"4D45 530D 4C41 4D49 410D 4C41 4D4D 590D"            /* MESLAMIALAMMY */	$"4C41 4D50 530D 4C41 4E41 490D 4C41 4E41"            /* LAMPSLANAILANA */	$"530D 4C41 4E43 480D 4C41 4E44 450D 4C41"            /* SLANCHLANDELA */	$"4E44 530D 4C41 4E45 530D 4C41 4E4B 530D"            /* NDSLANESLANKS */	$"4C41 4E54 530D 4C41 5049 4E0D 4C41 5049"            /* LANTSLAPINLAPI */	$"530D 4C41 504A 450D 4C41 5243 480D 4C41"            /* SLAPJELARCHLA */	$"5244 530D 4C41 5244 590D 4C41 5245 450D"            /* RDSLARDYLAREE */	$"4C41 5245 530D 4C41 5247 4F0D 4C41 5249"            /* LARESLARGOLARI */	$"530D 4C41 524B 530D 4C41 524B 590D 4C41"            /* SLARKSLARKYLA */	$"524E 530D 4C41 524E 540D 4C41 5255 4D0D"            /* RNSLARNTLARUM */	$"4C41 5345 440D 4C41 5345 520D 4C41 5345"            /* LASEDLASERLASE */	$"530D 4C41 5353 490D 4C41 5353 550D 4C41"            /* SLASSILASSULA */	$"5353 590D 4C41 5354 530D 4C41 5441 480D"            /* SSYLASTSLATAH */	$"4C41 5445 440D 4C41 5445 4E0D 4C41 5445"            /* LATEDLATENLATE */	$"580D 4C41 5448 490D 4C41 5448 530D 4C41"            /* XLATHILATHSLA */	$"5448 590D 4C41 544B 450D 4C41 5455 530D"            /* THYLATKELATUS */	$"4C41 5541 4E0D 4C41 5543 480D 4C41 5544"            /* LAUANLAUCHLAUD */	$"530D 4C41 5546 530D 4C41 554E 440D 4C41"            /* SLAUFSLAUNDLA */	$"5552 410D 4C41 5641 4C0D 4C41 5641 530D"            /* URALAVALLAVAS */	$"4C41 5645 440D 4C41 5645 520D 4C41 5645"            /* LAVEDLAVERLAVE */	$"530D 4C41 5652 410D 4C41 5656 590D 4C41"            /* SLAVRALAVVYLA */	$"5745 440D 4C41 5745 520D 4C41 5749 4E0D"            /* WEDLAWERLAWIN */	$"4C41 574B 530D 4C41 574E 530D 4C41 574E"            /* LAWKSLAWNSLAWN */	$"590D 4C41 5845 440D 4C41 5845 520D 4C41"            /* YLAXEDLAXERLA */	$"5845 530D 4C41 584C 590D 4C41 5945 440D"            /* XESLAXLYLAYED */	$"4C41 5949 4E0D 4C41 5955 500D 4C41 5A41"            /* LAYINLAYUPLAZA */	$"520D 4C41 5A45 440D 4C41 5A45 530D 4C41"            /* RLAZEDLAZESLA */	$"5A4F 530D 4C41 5A5A 490D 4C41 5A5A 4F0D"            /* ZOSLAZZILAZZO */	$"4C45 4144 530D 4C45 4144 590D 4C45 4146"            /* LEADSLEADYLEAF */	$"530D 4C45 414B 530D 4C45 414D 530D 4C45"            /* SLEAKSLEAMSLE */	$"414E 530D 4C45 414E 590D 4C45 4150 530D"            /* ANSLEANYLEAPS */	$"4C45 4152 450D 4C45 4152 530D 4C45 4152"            /* LEARELEARSLEAR */	$"590D 4C45 4154 530D 4C45 4156 590D 4C45"            /* YLEATSLEAVYLE */	$"415A 450D 4C45 4245 4E0D 4C45 4343 590D"            /* AZELEBENLECCY */	$"4C45 4445 530D 4C45 4447 590D 4C45 4455"            /* LEDESLEDGYLEDU */	$"4D0D 4C45 4541 520D 4C45 454B 530D 4C45"            /* MLEEARLEEKSLE */	$"4550 530D 4C45 4552 530D 4C45 4553 450D"            /* EPSLEERSLEESE */	$"4C45 4554 530D 4C45 455A 450D 4C45 4654"            /* LEETSLEEZELEFT */	$"450D 4C45 4654 530D 4C45 4745 520D 4C45"            /* ELEFTSLEGERLE */	$"4745 530D 4C45 4747 450D 4C45 4747 4F0D"            /* GESLEGGELEGGO */	$"4C45 4749 540D 4C45 4852 530D 4C45 4855"            /* LEGITLEHRSLEHU */	$"410D 4C45 4952 530D 4C45 4953 480D 4C45"            /* ALEIRSLEISHLE */	$"4D41 4E0D 4C45 4D45 440D 4C45 4D45 4C0D"            /* MANLEMEDLEMEL */	$"4C45 4D45 530D 4C45 4D4D 410D 4C45 4D4D"            /* LEMESLEMMALEMM */	$"450D 4C45 4E44 530D 4C45 4E45 530D 4C45"            /* ELENDSLENESLE */	$"4E47 530D 4C45 4E49 530D 4C45 4E4F 530D"            /* NGSLENISLENOS */	$"4C45 4E53 450D 4C45 4E54 490D 4C45 4E54"            /* LENSELENTILENT */	$"4F0D 4C45 4F4E 450D 4C45 5049 440D 4C45"            /* OLEONELEPIDLE */	$"5052 410D 4C45 5054 410D 4C45 5245 440D"            /* PRALEPTALERED */	$"4C45 5245 530D 4C45 5250 530D 4C45 5342"            /* LERESLERPSLESB */	$"4F0D 4C45 5345 530D 4C45 5354 530D 4C45"            /* OLESESLESTSLE */	$"5443 480D 4C45 5448 450D 4C45 5455 500D"            /* TCHLETHELETUP */	$"4C45 5543 480D 4C45 5543 4F0D 4C45 5544"            /* LEUCHLEUCOLEUD */	$"530D 4C45 5547 480D 4C45 5641 530D 4C45"            /* SLEUGHLEVASLE */	$"5645 450D 4C45 5645 530D 4C45 5649 4E0D"            /* VEELEVESLEVIN */	$"4C45 5649 530D 4C45 5749 530D 4C45 5845"            /* LEVISLEWISLEXE */	$"530D 4C45 5849 530D 4C45 5A45 530D 4C45"            /* SLEXISLEZESLE */	$"5A5A 410D 4C45 5A5A 590D 4C49 414E 410D"            /* ZZALEZZYLIANA */	$"4C49 414E 450D 4C49 414E 470D 4C49 4152"            /* LIANELIANGLIAR */	$"440D 4C49 4152 530D 4C49 4152 540D 4C49"            /* DLIARSLIARTLI */	$"4245 520D 4C49 4252 410D 4C49 4252 490D"            /* BERLIBRALIBRI */	$"4C49 4348 490D 4C49 4348 540D 4C49 4349"            /* LICHILICHTLICI */	$"540D 4C49 434B 530D 4C49 4441 520D 4C49"            /* TLICKSLIDARLI */	$"444F 530D 4C49 4546 530D 4C49 454E 530D"            /* DOSLIEFSLIENS */	$"4C49 4552 530D 4C49 4555 530D 4C49 4556"            /* LIERSLIEUSLIEV */	$"450D 4C49 4645 520D 4C49 4645 530D 4C49"            /* ELIFERLIFESLI */	$"4654 530D 4C49 4741 4E0D 4C49 4745 520D"            /* FTSLIGANLIGER */	$"4C49 4747 450D 4C49 474E 450D 4C49 4B45"            /* LIGGELIGNELIKE */	$"440D 4C49 4B45 520D 4C49 4B45 530D 4C49"            /* DLIKERLIKESLI */	$"4B49 4E0D 4C49 4C4C 530D 4C49 4C4F 530D"            /* KINLILLSLILOS */	$"4C49 4C54 530D 4C49 4D41 4E0D 4C49 4D41"            /* LILTSLIMANLIMA */	$"530D 4C49 4D41 580D 4C49 4D42 410D 4C49"            /* SLIMAXLIMBALI */	$"4D42 490D 4C49 4D42 530D 4C49 4D42 590D"            /* MBILIMBSLIMBY */	$"4C49 4D45 440D 4C49 4D45 4E0D 4C49 4D45"            /* LIMEDLIMENLIME */	$"530D 4C49 4D45 590D 4C49 4D4D 410D 4C49"            /* SLIMEYLIMMALI */	$"4D4E 530D 4C49 4D4F 530D 4C49 4D50 410D"            /* MNSLIMOSLIMPA */	$"4C49 4D50 530D 4C49 4E41 430D 4C49 4E43"            /* LIMPSLINACLINC */	$"480D 4C49 4E44 530D 4C49 4E44 590D 4C49"            /* HLINDSLINDYLI */	$"4E45 440D 4C49 4E45 530D 4C49 4E45 590D"            /* NEDLINESLINEY */	$"4C49 4E47 410D 4C49 4E47 530D 4C49 4E47"            /* LINGALINGSLING */	$"590D 4C49 4E49 4E0D 4C49 4E4B 530D 4C49"            /* YLININLINKSLI */	$"4E4B 590D 4C49 4E4E 530D 4C49 4E4E 590D"            /* NKYLINNSLINNY */	$"4C49 4E4F 530D 4C49 4E54 530D 4C49 4E54"            /* LINOSLINTSLINT */	$"590D 4C49 4E55 4D0D 4C49 4E55 580D 4C49"            /* YLINUMLINUXLI */	$"4F4E 530D 4C49 5041 530D 4C49 5045 530D"            /* ONSLIPASLIPES */	$"4C49 5049 4E0D 4C49 504F 530D 4C49 5050"            /* LIPINLIPOSLIPP */	$"590D 4C49 5241 530D 4C49 524B 530D 4C49"            /* YLIRASLIRKSLI */	$"524F 540D 4C49 534B 530D 4C49 534C 450D"            /* ROTLISKSLISLE */	$"4C49 5350 530D 4C49 5354 530D 4C49 5441"            /* LISPSLISTSLITA */	$"490D 4C49 5441 530D 4C49 5445 440D 4C49"            /* ILITASLITEDLI */	$"5445 520D 4C49 5445 530D 4C49 5448 4F0D"            /* TERLITESLITHO */	$"4C49 5448 530D 4C49 5452 450D 4C49 5645"            /* LITHSLITRELIVE */	$"440D 4C49 5645 4E0D 4C49 5645 530D 4C49"            /* DLIVENLIVESLI */	$"564F 520D 4C49 5652 450D 4C4C 414E 4F0D"            /* VORLIVRELLANO */	$"4C4F 4143 480D 4C4F 4144 530D 4C4F 4146"            /* LOACHLOADSLOAF */	$"530D 4C4F 414D 530D 4C4F 414E 530D 4C4F"            /* SLOAMSLOANSLO */	$"4153 540D 4C4F 4156 450D 4C4F 4241 520D"            /* ASTLOAVELOBAR */	$"4C4F 4245 440D 4C4F 4245 530D 4C4F 424F"            /* LOBEDLOBESLOBO */	$"530D 4C4F 4255 530D 4C4F 4348 450D 4C4F"            /* SLOBUSLOCHELO */	$"4348 530D 4C4F 4349 450D 4C4F 4349 530D"            /* CHSLOCIELOCIS */	$"4C4F 434B 530D 4C4F 434F 530D 4C4F 4355"            /* LOCKSLOCOSLOCU */	$"4D0D 4C4F 4445 4E0D 4C4F 4445 530D 4C4F"            /* MLODENLODESLO */	$"4553 530D 4C4F 4654 530D 4C4F 4741 4E0D"            /* ESSLOFTSLOGAN */	$"4C4F 4745 530D 4C4F 4747 590D 4C4F 4749"            /* LOGESLOGGYLOGI */	$"410D 4C4F 4749 450D 4C4F 474F 490D 4C4F"            /* ALOGIELOGOILO */	$"474F 4E0D 4C4F 474F 530D 4C4F 4841 4E0D"            /* GONLOGOSLOHAN */	$"4C4F 4944 530D 4C4F 494E 530D 4C4F 4950"            /* LOIDSLOINSLOIP */	$"450D 4C4F 4952 530D 4C4F 4B45 530D 4C4F"            /* ELOIRSLOKESLO */	$"4C4C 530D 4C4F 4C4C 590D 4C4F 4C4F 470D"            /* LLSLOLLYLOLOG */	$"4C4F 4D41 530D 4C4F 4D45 440D 4C4F 4D45"            /* LOMASLOMEDLOME */	$"530D 4C4F 4E45 520D 4C4F 4E47 410D 4C4F"            /* SLONERLONGALO */	$"4E47 450D 4C4F 4E47 530D 4C4F 4F42 590D"            /* NGELONGSLOOBY */	$"4C4F 4F45 440D 4C4F 4F45 590D 4C4F 4F46"            /* LOOEDLOOEYLOOF */	$"410D 4C4F 4F46 530D 4C4F 4F49 450D 4C4F"            /* ALOOFSLOOIELO */	$"4F4B 530D 4C4F 4F4B 590D 4C4F 4F4D 530D"            /* OKSLOOKYLOOMS */	$"4C4F 4F4E 530D 4C4F 4F4E 590D 4C4F 4F50"            /* LOONSLOONYLOOP */	$"530D 4C4F 4F52 440D 4C4F 4F54 530D 4C4F"            /* SLOORDLOOTSLO */	$"5045 440D 4C4F 5045 520D 4C4F 5045 530D"            /* PEDLOPERLOPES */	$"4C4F 5050 590D 4C4F 5241 4C0D 4C4F 5241"            /* LOPPYLORALLORA */	$"4E0D 4C4F 5244 530D 4C4F 5244 590D 4C4F"            /* NLORDSLORDYLO */	$"5245 4C0D 4C4F 5245 530D 4C4F 5249 430D"            /* RELLORESLORIC */	$"4C4F 5249 530D 4C4F 5345 440D 4C4F 5345"            /* LORISLOSEDLOSE */	$"4C0D 4C4F 5345 4E0D 4C4F 5345 530D 4C4F"            /* LLOSENLOSESLO */	$"5353 590D 4C4F 5441 480D 4C4F 5441 530D"            /* SSYLOTAHLOTAS */	$"4C4F 5445 530D 4C4F 5449 430D 4C4F 544F"            /* LOTESLOTICLOTO */	$"530D 4C4F 5453 410D 4C4F 5454 410D 4C4F"            /* SLOTSALOTTALO */	$"5454 450D 4C4F 5454 4F0D 4C4F 5455 530D"            /* TTELOTTOLOTUS */	$"4C4F 5545 440D 4C4F 5547 480D 4C4F 5549"            /* LOUEDLOUGHLOUI */	$"450D 4C4F 5549 530D 4C4F 554D 410D 4C4F"            /* ELOUISLOUMALO */	$"554E 440D 4C4F 554E 530D 4C4F 5550 450D"            /* UNDLOUNSLOUPE */	$"4C4F 5550 530D 4C4F 5552 450D 4C4F 5552"            /* LOUPSLOURELOUR */	$"53"                                                 /* S */};data 'vers' (128) {	$"0120 8000 0000 0531 2E32 2E30 1976 312E"            /* . ....1.2.0.v1. */	$"322E 3020 5472 6576 6F72 2047 616C 6520"            /* 2.0 Trevor Gale  */	$"2832 3032 3429"                                     /* (2024) */};data 'SIZE' (-1) {	$"00C8 004C 4B40 004C 4B40"                           /* ..LK@.LK@ */};
\ No newline at end of file
+data 'MBAR' (128) {	$"0004 0080 0081 0082 0083"                           /* ...... */};data 'MENU' (128) {	$"0080 0000 0000 0000 0000 FFFF FFFB 0114"            /* ........... */	$"0E41 626F 7574 204D 6163 576F 7264 7300"            /* .About MacWords. */	$"0000 0001 2D00 0000 0000"                           /* ....-..... */};data 'MENU' (129) {	$"0081 0000 0000 0000 0000 FFFF FFF7 0446"            /* ..........F */	$"696C 650A 5361 7665 2054 7261 6365 0000"            /* ile.Save Trace.. */	$"0000 0C53 6176 6520 4C61 7465 6E63 7900"            /* ...Save Latency. */	$"0000 0001 2D00 0000 0004 5175 6974 0051"            /* ....-.....Quit.Q */	$"0000 00"                                            /* ... */};data 'MENU' (130) {	$"0082 0000 0000 0000 0000 FFFF FFFF 0445"            /* ..........E */	$"6469 7404 436F 7079 0043 0000 0543 6C65"            /* dit.Copy.C...Cle */	$"6172 0000 0000 00"                                  /* ar..... */};data 'MENU' (131) {	$"0083 0000 0000 0000 0000 FFFF FBAF 0447"            /* ..........G */	$"616D 6508 4E65 7720 4761 6D65 0042 0000"            /* ame.New Game.B.. */	$"0F4E 6577 2047 616D 6520 5769 6E64 6F77"            /* .New Game Window */	$"004E 0000 0C43 6C6F 7365 2057 696E 646F"            /* .N...Close Windo */	$"7700 5700 0001 2D00 0000 0016 5265 6475"            /* w.W...-.....Redu */	$"6365 6420 436F 6C6F 7572 2042 7566 6665"            /* ced Colour Buffe */	$"7273 0000 0000 012D 0000 0000 1053 7461"            /* rs.....-.....Sta */	$"6E64 6172 6420 436F 6C6F 7572 7300 0000"            /* ndard Colours... */	$"0015 4869 6768 2043 6F6E 7472 6173 7420"            /* ..High Contrast  */	$"436F 6C6F 7572 7300 0000 0014 436F 6C6F"            /* Colours.....Colo */	$"7572 2D42 6C69 6E64 2043 6F6C 6F75 7273"            /* ur-Blind Colours */	$"0000 0000 012D 0000 0000 0C46 7261 6D65"            /* .....-.....Frame */	$"2054 696D 696E 6700 0000 0000"                      /*  Timing..... */};data 'WIND' (129) {	$"0028 0028 00BE 00FF 0002 0100 0000 0000"            /* .(.(.......... */	$"0000 0A4E 6577 2057 696E 646F 77"                   /* ...New Window */};data 'WIND' (130) {	$"0040 0020 011C 0142 0004 0100 0100 0000"            /* .@. ...B........ */	$"0000 0A4E 6577 2057 696E 646F 77"                   /* ...New Window */};data 'WIND' (128) {	$"002C 0028 0154 0128 0000 0100 0100 0000"            /* .,.(.T.(........ */	$"0000 0A4E 6577 2057 696E 646F 77"                   /* ...New Window */};data 'ALRT' (128) {	$"003C 003C 00A0 0190 0080 5555 300A"                 /* .<.<......UU0. */};data 'DITL' (128) {	$"0001 0000 0000 0044 010E 0058 014A 0402"            /* .......D...X.J.. */	$"4F4B 0000 0000 000A 003C 003C 014A 885B"            /* OK.......<.<.J.[ */	$"5468 6572 6520 6973 6E27 7420 656E 6F75"            /* There isn't enou */	$"6768 206D 656D 6F72 7920 746F 206D 616B"            /* gh memory to mak */	$"6520 7468 6973 2077 696E 646F 7720 7468"            /* e this window th */	$"6174 2073 697A 652E 2043 6C6F 7365 206F"            /* at size. Close o */	$"7468 6572 2077 696E 646F 7773 2061 6E64"            /* ther windows and */	$"2074 7279 2061 6761 696E 2E00"                      /*  try again.. */};data 'TEXT' (130) {	$"4C4F 5552 590D 4C4F 5554 530D 4C4F 5641"            /* LOURYLOUTSLOVA */	$"540D 4C4F 5645 440D 4C4F 5645 530D 4C4F"            /* TLOVEDLOVESLO */	$"5645 590D 4C4F 5649 450D 4C4F 5741 4E0D"            /* VEYLOVIELOWAN */	$"4C4F 5745 440D 4C4F 5745 530D 4C4F 574E"            /* LOWEDLOWESLOWN */	$"440D 4C4F 574E 450D 4C4F 574E 530D 4C4F"            /* DLOWNELOWNSLO */	$"5750 530D 4C4F 5752 590D 4C4F 5753 450D"            /* WPSLOWRYLOWSE */	$"4C4F 5754 530D 4C4F 5845 440D 4C4F 5845"            /* LOWTSLOXEDLOXE */	$"530D 4C4F 5A45 4E0D 4C55 4143 480D 4C55"            /* SLOZENLUACHLU */	$"4155 530D 4C55 4245 440D 4C55 4245 530D"            /* AUSLUBEDLUBES */	$"4C55 4252 410D 4C55 4345 530D 4C55 434B"            /* LUBRALUCESLUCK */	$"530D 4C55 4352 450D 4C55 4445 530D 4C55"            /* SLUCRELUDESLU */	$"4449 430D 4C55 444F 530D 4C55 4646 410D"            /* DICLUDOSLUFFA */	$"4C55 4646 530D 4C55 4745 440D 4C55 4745"            /* LUFFSLUGEDLUGE */	$"520D 4C55 4745 530D 4C55 4C4C 530D 4C55"            /* RLUGESLULLSLU */	$"4C55 530D 4C55 4D41 530D 4C55 4D42 490D"            /* LUSLUMASLUMBI */	$"4C55 4D4D 450D 4C55 4D4D 590D 4C55 4D50"            /* LUMMELUMMYLUMP */	$"530D 4C55 4E41 530D 4C55 4E45 530D 4C55"            /* SLUNASLUNESLU */	$"4E45 540D 4C55 4E47 490D 4C55 4E47 530D"            /* NETLUNGILUNGS */	$"4C55 4E4B 530D 4C55 4E54 530D 4C55 5049"            /* LUNKSLUNTSLUPI */	$"4E0D 4C55 5245 440D 4C55 5245 520D 4C55"            /* NLUREDLURERLU */	$"5245 530D 4C55 5245 580D 4C55 5247 490D"            /* RESLUREXLURGI */	$"4C55 5247 590D 4C55 524B 530D 4C55 5252"            /* LURGYLURKSLURR */	$"590D 4C55 5256 450D 4C55 5345 520D 4C55"            /* YLURVELUSERLU */	$"5348 590D 4C55 534B 530D 4C55 5354 530D"            /* SHYLUSKSLUSTS */	$"4C55 5355 530D 4C55 5445 410D 4C55 5445"            /* LUSUSLUTEALUTE */	$"440D 4C55 5445 520D 4C55 5445 530D 4C55"            /* DLUTERLUTESLU */	$"5656 590D 4C55 5845 440D 4C55 5845 520D"            /* VVYLUXEDLUXER */	$"4C55 5845 530D 4C57 4549 530D 4C59 414D"            /* LUXESLWEISLYAM */	$"530D 4C59 4152 440D 4C59 4152 540D 4C59"            /* SLYARDLYARTLY */	$"4153 450D 4C59 4345 410D 4C59 4345 450D"            /* ASELYCEALYCEE */	$"4C59 4352 410D 4C59 4D45 530D 4C59 4E43"            /* LYCRALYMESLYNC */	$"480D 4C59 4E45 530D 4C59 5245 530D 4C59"            /* HLYNESLYRESLY */	$"5345 440D 4C59 5345 530D 4C59 5349 4E0D"            /* SEDLYSESLYSIN */	$"4C59 5349 530D 4C59 534F 4C0D 4C59 5353"            /* LYSISLYSOLLYSS */	$"410D 4C59 5445 440D 4C59 5445 530D 4C59"            /* ALYTEDLYTESLY */	$"5448 450D 4C59 5449 430D 4C59 5454 410D"            /* THELYTICLYTTA */	$"4D41 4145 440D 4D41 4152 450D 4D41 4152"            /* MAAEDMAAREMAAR */	$"530D 4D41 4245 530D 4D41 4341 530D 4D41"            /* SMABESMACASMA */	$"4345 440D 4D41 4345 520D 4D41 4345 530D"            /* CEDMACERMACES */	$"4D41 4348 450D 4D41 4348 490D 4D41 4348"            /* MACHEMACHIMACH */	$"530D 4D41 434B 530D 4D41 434C 450D 4D41"            /* SMACKSMACLEMA */	$"434F 4E0D 4D41 4447 450D 4D41 4449 440D"            /* CONMADGEMADID */	$"4D41 4452 450D 4D41 4552 4C0D 4D41 4649"            /* MADREMAERLMAFI */	$"430D 4D41 4745 530D 4D41 4747 530D 4D41"            /* CMAGESMAGGSMA */	$"474F 540D 4D41 4755 530D 4D41 484F 450D"            /* GOTMAGUSMAHOE */	$"4D41 4855 410D 4D41 4857 410D 4D41 4944"            /* MAHUAMAHWAMAID */	$"530D 4D41 494B 4F0D 4D41 494B 530D 4D41"            /* SMAIKOMAIKSMA */	$"494C 450D 4D41 494C 4C0D 4D41 494C 530D"            /* ILEMAILLMAILS */	$"4D41 494D 530D 4D41 494E 530D 4D41 4952"            /* MAIMSMAINSMAIR */	$"450D 4D41 4952 530D 4D41 4953 450D 4D41"            /* EMAIRSMAISEMA */	$"4953 540D 4D41 4B41 520D 4D41 4B45 530D"            /* ISTMAKARMAKES */	$"4D41 4B49 530D 4D41 4B4F 530D 4D41 4C41"            /* MAKISMAKOSMALA */	$"4D0D 4D41 4C41 520D 4D41 4C41 530D 4D41"            /* MMALARMALASMA */	$"4C41 580D 4D41 4C45 530D 4D41 4C49 430D"            /* LAXMALESMALIC */	$"4D41 4C49 4B0D 4D41 4C49 530D 4D41 4C4C"            /* MALIKMALISMALL */	$"530D 4D41 4C4D 530D 4D41 4C4D 590D 4D41"            /* SMALMSMALMYMA */	$"4C54 530D 4D41 4C54 590D 4D41 4C55 530D"            /* LTSMALTYMALUS */	$"4D41 4C56 410D 4D41 4C57 410D 4D41 4D41"            /* MALVAMALWAMAMA */	$"530D 4D41 4D42 410D 4D41 4D45 450D 4D41"            /* SMAMBAMAMEEMA */	$"4D45 590D 4D41 4D49 450D 4D41 4E41 530D"            /* MEYMAMIEMANAS */	$"4D41 4E41 540D 4D41 4E44 490D 4D41 4E45"            /* MANATMANDIMANE */	$"420D 4D41 4E45 440D 4D41 4E45 480D 4D41"            /* BMANEDMANEHMA */	$"4E45 530D 4D41 4E45 540D 4D41 4E47 530D"            /* NESMANETMANGS */	$"4D41 4E49 530D 4D41 4E4B 590D 4D41 4E4E"            /* MANISMANKYMANN */	$"410D 4D41 4E4F 530D 4D41 4E53 450D 4D41"            /* AMANOSMANSEMA */	$"4E54 410D 4D41 4E54 4F0D 4D41 4E54 590D"            /* NTAMANTOMANTY */	$"4D41 4E55 4C0D 4D41 4E55 530D 4D41 5041"            /* MANULMANUSMAPA */	$"550D 4D41 5155 490D 4D41 5241 450D 4D41"            /* UMAQUIMARAEMA */	$"5241 480D 4D41 5241 530D 4D41 5243 530D"            /* RAHMARASMARCS */	$"4D41 5244 590D 4D41 5245 530D 4D41 5247"            /* MARDYMARESMARG */	$"450D 4D41 5247 530D 4D41 5249 410D 4D41"            /* EMARGSMARIAMA */	$"5249 440D 4D41 524B 410D 4D41 524B 530D"            /* RIDMARKAMARKS */	$"4D41 524C 450D 4D41 524C 530D 4D41 524C"            /* MARLEMARLSMARL */	$"590D 4D41 524D 530D 4D41 524F 4E0D 4D41"            /* YMARMSMARONMA */	$"524F 520D 4D41 5252 410D 4D41 5252 490D"            /* RORMARRAMARRI */	$"4D41 5253 450D 4D41 5254 530D 4D41 5256"            /* MARSEMARTSMARV */	$"590D 4D41 5341 530D 4D41 5345 440D 4D41"            /* YMASASMASEDMA */	$"5345 520D 4D41 5345 530D 4D41 5348 590D"            /* SERMASESMASHY */	$"4D41 534B 530D 4D41 5353 410D 4D41 5353"            /* MASKSMASSAMASS */	$"590D 4D41 5354 530D 4D41 5354 590D 4D41"            /* YMASTSMASTYMA */	$"5355 530D 4D41 5441 490D 4D41 5445 440D"            /* SUSMATAIMATED */	$"4D41 5445 520D 4D41 5445 530D 4D41 5448"            /* MATERMATESMATH */	$"530D 4D41 5449 4E0D 4D41 544C 4F0D 4D41"            /* SMATINMATLOMA */	$"5454 450D 4D41 5454 530D 4D41 545A 410D"            /* TTEMATTSMATZA */	$"4D41 545A 4F0D 4D41 5542 590D 4D41 5544"            /* MATZOMAUBYMAUD */	$"530D 4D41 554C 530D 4D41 554E 440D 4D41"            /* SMAULSMAUNDMA */	$"5552 490D 4D41 5553 590D 4D41 5554 530D"            /* URIMAUSYMAUTS */	$"4D41 555A 590D 4D41 5645 4E0D 4D41 5649"            /* MAUZYMAVENMAVI */	$"450D 4D41 5649 4E0D 4D41 5649 530D 4D41"            /* EMAVINMAVISMA */	$"5745 440D 4D41 574B 530D 4D41 574B 590D"            /* WEDMAWKSMAWKY */	$"4D41 574E 530D 4D41 5752 530D 4D41 5845"            /* MAWNSMAWRSMAXE */	$"440D 4D41 5845 530D 4D41 5849 530D 4D41"            /* DMAXESMAXISMA */	$"5941 4E0D 4D41 5941 530D 4D41 5945 440D"            /* YANMAYASMAYED */	$"4D41 594F 530D 4D41 5953 540D 4D41 5A45"            /* MAYOSMAYSTMAZE */	$"440D 4D41 5A45 520D 4D41 5A45 530D 4D41"            /* DMAZERMAZESMA */	$"5A45 590D 4D41 5A55 540D 4D42 4952 410D"            /* ZEYMAZUTMBIRA */	$"4D45 4144 530D 4D45 414C 530D 4D45 414E"            /* MEADSMEALSMEAN */	$"450D 4D45 414E 530D 4D45 414E 590D 4D45"            /* EMEANSMEANYME */	$"4152 450D 4D45 4153 450D 4D45 4154 480D"            /* AREMEASEMEATH */	$"4D45 4154 530D 4D45 424F 530D 4D45 4348"            /* MEATSMEBOSMECH */	$"530D 4D45 434B 530D 4D45 4449 490D 4D45"            /* SMECKSMEDIIME */	$"444C 450D 4D45 4544 530D 4D45 4552 530D"            /* DLEMEEDSMEERS */	$"4D45 4554 530D 4D45 4646 530D 4D45 494E"            /* MEETSMEFFSMEIN */	$"530D 4D45 494E 540D 4D45 494E 590D 4D45"            /* SMEINTMEINYME */	$"4954 480D 4D45 4B4B 410D 4D45 4C41 530D"            /* ITHMEKKAMELAS */	$"4D45 4C42 410D 4D45 4C44 530D 4D45 4C49"            /* MELBAMELDSMELI */	$"430D 4D45 4C49 4B0D 4D45 4C4C 530D 4D45"            /* CMELIKMELLSME */	$"4C54 530D 4D45 4C54 590D 4D45 4D45 530D"            /* LTSMELTYMEMES */	$"4D45 4D4F 530D 4D45 4E41 440D 4D45 4E44"            /* MEMOSMENADMEND */	$"530D 4D45 4E45 440D 4D45 4E45 530D 4D45"            /* SMENEDMENESME */	$"4E47 450D 4D45 4E47 530D 4D45 4E53 410D"            /* NGEMENGSMENSA */	$"4D45 4E53 450D 4D45 4E53 480D 4D45 4E54"            /* MENSEMENSHMENT */	$"410D 4D45 4E54 4F0D 4D45 4E55 530D 4D45"            /* AMENTOMENUSME */	$"4F55 530D 4D45 4F57 530D 4D45 5243 480D"            /* OUSMEOWSMERCH */	$"4D45 5243 530D 4D45 5244 450D 4D45 5245"            /* MERCSMERDEMERE */	$"440D 4D45 5245 4C0D 4D45 5245 520D 4D45"            /* DMERELMERERME */	$"5245 530D 4D45 5249 4C0D 4D45 5249 530D"            /* RESMERILMERIS */	$"4D45 524B 530D 4D45 524C 450D 4D45 524C"            /* MERKSMERLEMERL */	$"530D 4D45 5253 450D 4D45 5341 4C0D 4D45"            /* SMERSEMESALME */	$"5341 530D 4D45 5345 4C0D 4D45 5345 530D"            /* SASMESELMESES */	$"4D45 5348 590D 4D45 5349 430D 4D45 534E"            /* MESHYMESICMESN */	$"450D 4D45 534F 4E0D 4D45 5353 590D 4D45"            /* EMESONMESSYME */	$"5354 4F0D 4D45 5445 440D 4D45 5445 530D"            /* STOMETEDMETES */	$"4D45 5448 4F0D 4D45 5448 530D 4D45 5449"            /* METHOMETHSMETI */	$"430D 4D45 5449 460D 4D45 5449 530D 4D45"            /* CMETIFMETISME */	$"544F 4C0D 4D45 5452 450D 4D45 5553 450D"            /* TOLMETREMEUSE */	$"4D45 5645 440D 4D45 5645 530D 4D45 5745"            /* MEVEDMEVESMEWE */	$"440D 4D45 574C 530D 4D45 594E 540D 4D45"            /* DMEWLSMEYNTME */	$"5A45 530D 4D45 5A5A 450D 4D45 5A5A 4F0D"            /* ZESMEZZEMEZZO */	$"4D48 4F52 520D 4D49 414F 550D 4D49 414F"            /* MHORRMIAOUMIAO */	$"570D 4D49 4153 4D0D 4D49 4155 4C0D 4D49"            /* WMIASMMIAULMI */	$"4341 530D 4D49 4348 450D 4D49 4348 540D"            /* CASMICHEMICHT */	$"4D49 434B 530D 4D49 434B 590D 4D49 434F"            /* MICKSMICKYMICO */	$"530D 4D49 4352 410D 4D49 4444 590D 4D49"            /* SMICRAMIDDYMI */	$"4447 590D 4D49 4449 530D 4D49 454E 530D"            /* DGYMIDISMIENS */	$"4D49 4556 450D 4D49 4646 530D 4D49 4646"            /* MIEVEMIFFSMIFF */	$"590D 4D49 4654 590D 4D49 4747 530D 4D49"            /* YMIFTYMIGGSMI */	$"4841 530D 4D49 4849 530D 4D49 4B45 440D"            /* HASMIHISMIKED */	$"4D49 4B45 530D 4D49 4B52 410D 4D49 4B56"            /* MIKESMIKRAMIKV */	$"410D 4D49 4C43 480D 4D49 4C44 530D 4D49"            /* AMILCHMILDSMI */	$"4C45 520D 4D49 4C45 530D 4D49 4C46 530D"            /* LERMILESMILFS */	$"4D49 4C49 410D 4D49 4C4B 4F0D 4D49 4C4B"            /* MILIAMILKOMILK */	$"530D 4D49 4C4C 450D 4D49 4C4C 530D 4D49"            /* SMILLEMILLSMI */	$"4C4F 520D 4D49 4C4F 530D 4D49 4C50 410D"            /* LORMILOSMILPA */	$"4D49 4C54 530D 4D49 4C54 590D 4D49 4C54"            /* MILTSMILTYMILT */	$"5A0D 4D49 4D45 440D 4D49 4D45 4F0D 4D49"            /* ZMIMEDMIMEOMI */	$"4D45 520D 4D49 4D45 530D 4D49 4D53 590D"            /* MERMIMESMIMSY */	$"4D49 4E41 450D 4D49 4E41 520D 4D49 4E41"            /* MINAEMINARMINA */	$"530D 4D49 4E43 590D 4D49 4E44 530D 4D49"            /* SMINCYMINDSMI */	$"4E45 440D 4D49 4E45 530D 4D49 4E47 450D"            /* NEDMINESMINGE */	$"4D49 4E47 530D 4D49 4E47 590D 4D49 4E49"            /* MINGSMINGYMINI */	$"530D 4D49 4E4B 450D 4D49 4E4B 530D 4D49"            /* SMINKEMINKSMI */	$"4E4E 590D 4D49 4E4F 530D 4D49 4E54 530D"            /* NNYMINOSMINTS */	$"4D49 5245 440D 4D49 5245 530D 4D49 5245"            /* MIREDMIRESMIRE */	$"580D 4D49 5249 440D 4D49 5249 4E0D 4D49"            /* XMIRIDMIRINMI */	$"524B 530D 4D49 524B 590D 4D49 524C 590D"            /* RKSMIRKYMIRLY */	$"4D49 524F 530D 4D49 5256 530D 4D49 525A"            /* MIROSMIRVSMIRZ */	$"410D 4D49 5343 480D 4D49 5344 4F0D 4D49"            /* AMISCHMISDOMI */	$"5345 530D 4D49 5347 4F0D 4D49 534F 530D"            /* SESMISGOMISOS */	$"4D49 5353 410D 4D49 5354 530D 4D49 5354"            /* MISSAMISTSMIST */	$"590D 4D49 5443 480D 4D49 5445 520D 4D49"            /* YMITCHMITERMI */	$"5445 530D 4D49 5449 530D 4D49 5452 450D"            /* TESMITISMITRE */	$"4D49 5454 530D 4D49 5845 440D 4D49 5845"            /* MITTSMIXEDMIXE */	$"4E0D 4D49 5845 520D 4D49 5845 530D 4D49"            /* NMIXERMIXESMI */	$"5854 450D 4D49 5855 500D 4D49 5A45 4E0D"            /* XTEMIXUPMIZEN */	$"4D49 5A5A 590D 4D4E 454D 450D 4D4F 414E"            /* MIZZYMNEMEMOAN */	$"530D 4D4F 4154 530D 4D4F 4242 590D 4D4F"            /* SMOATSMOBBYMO */	$"4245 530D 4D4F 4245 590D 4D4F 4249 450D"            /* BESMOBEYMOBIE */	$"4D4F 424C 450D 4D4F 4348 490D 4D4F 4348"            /* MOBLEMOCHIMOCH */	$"530D 4D4F 4348 590D 4D4F 434B 530D 4D4F"            /* SMOCHYMOCKSMO */	$"4445 520D 4D4F 4445 530D 4D4F 4447 450D"            /* DERMODESMODGE */	$"4D4F 4449 490D 4D4F 4455 530D 4D4F 4552"            /* MODIIMODUSMOER */	$"530D 4D4F 464F 530D 4D4F 4747 590D 4D4F"            /* SMOFOSMOGGYMO */	$"4845 4C0D 4D4F 484F 530D 4D4F 4852 530D"            /* HELMOHOSMOHRS */	$"4D4F 4855 410D 4D4F 4855 520D 4D4F 494C"            /* MOHUAMOHURMOIL */	$"450D 4D4F 494C 530D 4D4F 4952 410D 4D4F"            /* EMOILSMOIRAMO */	$"4952 450D 4D4F 4954 530D 4D4F 4A4F 530D"            /* IREMOITSMOJOS */	$"4D4F 4B45 530D 4D4F 4B49 530D 4D4F 4B4F"            /* MOKESMOKISMOKO */	$"530D 4D4F 4C41 4C0D 4D4F 4C41 530D 4D4F"            /* SMOLALMOLASMO */	$"4C44 530D 4D4F 4C45 440D 4D4F 4C45 530D"            /* LDSMOLEDMOLES */	$"4D4F 4C4C 410D 4D4F 4C4C 530D 4D4F 4C4C"            /* MOLLAMOLLSMOLL */	$"590D 4D4F 4C54 4F0D 4D4F 4C54 530D 4D4F"            /* YMOLTOMOLTSMO */	$"4C59 530D 4D4F 4D45 530D 4D4F 4D4D 410D"            /* LYSMOMESMOMMA */	$"4D4F 4D4D 590D 4D4F 4D55 530D 4D4F 4E41"            /* MOMMYMOMUSMONA */	$"440D 4D4F 4E41 4C0D 4D4F 4E41 530D 4D4F"            /* DMONALMONASMO */	$"4E44 450D 4D4F 4E44 4F0D 4D4F 4E45 520D"            /* NDEMONDOMONER */	$"4D4F 4E47 4F0D 4D4F 4E47 530D 4D4F 4E49"            /* MONGOMONGSMONI */	$"430D 4D4F 4E49 450D 4D4F 4E4B 530D 4D4F"            /* CMONIEMONKSMO */	$"4E4F 530D 4D4F 4E54 450D 4D4F 4E54 590D"            /* NOSMONTEMONTY */	$"4D4F 4F42 530D 4D4F 4F43 480D 4D4F 4F44"            /* MOOBSMOOCHMOOD */	$"530D 4D4F 4F45 440D 4D4F 4F4B 530D 4D4F"            /* SMOOEDMOOKSMO */	$"4F4C 410D 4D4F 4F4C 490D 4D4F 4F4C 530D"            /* OLAMOOLIMOOLS */	$"4D4F 4F4C 590D 4D4F 4F4E 470D 4D4F 4F4E"            /* MOOLYMOONGMOON */	$"530D 4D4F 4F4E 590D 4D4F 4F50 530D 4D4F"            /* SMOONYMOOPSMO */	$"4F52 530D 4D4F 4F52 590D 4D4F 4F54 530D"            /* ORSMOORYMOOTS */	$"4D4F 4F56 450D 4D4F 5045 440D 4D4F 5045"            /* MOOVEMOPEDMOPE */	$"520D 4D4F 5045 530D 4D4F 5045 590D 4D4F"            /* RMOPESMOPEYMO */	$"5050 590D 4D4F 5053 590D 4D4F 5055 530D"            /* PPYMOPSYMOPUS */	$"4D4F 5241 450D 4D4F 5241 530D 4D4F 5241"            /* MORAEMORASMORA */	$"540D 4D4F 5241 590D 4D4F 5245 4C0D 4D4F"            /* TMORAYMORELMO */	$"5245 530D 4D4F 5249 410D 4D4F 524E 450D"            /* RESMORIAMORNE */	$"4D4F 524E 530D 4D4F 5252 410D 4D4F 5252"            /* MORNSMORRAMORR */	$"4F0D 4D4F 5253 450D 4D4F 5254 530D 4D4F"            /* OMORSEMORTSMO */	$"5345 440D 4D4F 5345 530D 4D4F 5345 590D"            /* SEDMOSESMOSEY */	$"4D4F 534B 530D 4D4F 5353 4F0D 4D4F 5354"            /* MOSKSMOSSOMOST */	$"450D 4D4F 5354 530D 4D4F 5445 440D 4D4F"            /* EMOSTSMOTEDMO */	$"5445 4E0D 4D4F 5445 530D 4D4F 5445 540D"            /* TENMOTESMOTET */	$"4D4F 5445 590D 4D4F 5448 530D 4D4F 5448"            /* MOTEYMOTHSMOTH */	$"590D 4D4F 5449 530D 4D4F 5454 450D 4D4F"            /* YMOTISMOTTEMO */	$"5454 530D 4D4F 5454 590D 4D4F 5455 530D"            /* TTSMOTTYMOTUS */	$"4D4F 545A 410D 4D4F 5543 480D 4D4F 5545"            /* MOTZAMOUCHMOUE */	$"530D 4D4F 554C 440D 4D4F 554C 530D 4D4F"            /* SMOULDMOULSMO */	$"5550 530D 4D4F 5553 540D 4D4F 5553 590D"            /* UPSMOUSTMOUSY */	$"4D4F 5645 440D 4D4F 5645 530D 4D4F 5741"            /* MOVEDMOVESMOWA */	$"530D 4D4F 5745 440D 4D4F 5752 410D 4D4F"            /* SMOWEDMOWRAMO */	$"5841 530D 4D4F 5849 450D 4D4F 5941 530D"            /* XASMOXIEMOYAS */	$"4D4F 594C 450D 4D4F 594C 530D 4D4F 5A45"            /* MOYLEMOYLSMOZE */	$"440D 4D4F 5A45 530D 4D4F 5A4F 530D 4D50"            /* DMOZESMOZOSMP */	$"5245 540D 4D55 4348 4F0D 4D55 4349 430D"            /* RETMUCHOMUCIC */	$"4D55 4349 440D 4D55 4349 4E0D 4D55 434B"            /* MUCIDMUCINMUCK */	$"530D 4D55 434F 520D 4D55 4352 4F0D 4D55"            /* SMUCORMUCROMU */	$"4447 450D 4D55 4449 520D 4D55 4452 410D"            /* DGEMUDIRMUDRA */	$"4D55 4646 530D 4D55 4654 490D 4D55 4747"            /* MUFFSMUFTIMUGG */	$"410D 4D55 4747 530D 4D55 4747 590D 4D55"            /* AMUGGSMUGGYMU */	$"484C 590D 4D55 4944 530D 4D55 494C 530D"            /* HLYMUIDSMUILS */	$"4D55 4952 530D 4D55 4953 540D 4D55 4A49"            /* MUIRSMUISTMUJI */	$"4B0D 4D55 4C43 540D 4D55 4C45 440D 4D55"            /* KMULCTMULEDMU */	$"4C45 530D 4D55 4C45 590D 4D55 4C47 410D"            /* LESMULEYMULGA */	$"4D55 4C49 450D 4D55 4C4C 410D 4D55 4C4C"            /* MULIEMULLAMULL */	$"530D 4D55 4C53 450D 4D55 4C53 480D 4D55"            /* SMULSEMULSHMU */	$"4D4D 530D 4D55 4D50 530D 4D55 4D53 590D"            /* MMSMUMPSMUMSY */	$"4D55 4D55 530D 4D55 4E47 410D 4D55 4E47"            /* MUMUSMUNGAMUNG */	$"450D 4D55 4E47 4F0D 4D55 4E47 530D 4D55"            /* EMUNGOMUNGSMU */	$"4E49 530D 4D55 4E54 530D 4D55 4E54 550D"            /* NISMUNTSMUNTU */	$"4D55 4F4E 530D 4D55 5241 530D 4D55 5245"            /* MUONSMURASMURE */	$"440D 4D55 5245 530D 4D55 5245 580D 4D55"            /* DMURESMUREXMU */	$"5249 440D 4D55 524B 530D 4D55 524C 530D"            /* RIDMURKSMURLS */	$"4D55 524C 590D 4D55 5252 410D 4D55 5252"            /* MURLYMURRAMURR */	$"450D 4D55 5252 490D 4D55 5252 530D 4D55"            /* EMURRIMURRSMU */	$"5252 590D 4D55 5254 490D 4D55 5256 410D"            /* RRYMURTIMURVA */	$"4D55 5341 520D 4D55 5343 410D 4D55 5345"            /* MUSARMUSCAMUSE */	$"440D 4D55 5345 520D 4D55 5345 530D 4D55"            /* DMUSERMUSESMU */	$"5345 540D 4D55 5348 410D 4D55 5349 540D"            /* SETMUSHAMUSIT */	$"4D55 534B 530D 4D55 534F 530D 4D55 5353"            /* MUSKSMUSOSMUSS */	$"450D 4D55 5353 590D 4D55 5354 480D 4D55"            /* EMUSSYMUSTHMU */	$"5354 530D 4D55 5443 480D 4D55 5445 440D"            /* STSMUTCHMUTED */	$"4D55 5445 520D 4D55 5445 530D 4D55 5448"            /* MUTERMUTESMUTH */	$"410D 4D55 5449 530D 4D55 544F 4E0D 4D55"            /* AMUTISMUTONMU */	$"5454 530D 4D55 5845 440D 4D55 5845 530D"            /* TTSMUXEDMUXES */	$"4D55 5A41 4B0D 4D55 5A5A 590D 4D56 554C"            /* MUZAKMUZZYMVUL */	$"450D 4D59 414C 4C0D 4D59 4C41 520D 4D59"            /* EMYALLMYLARMY */	$"4E41 480D 4D59 4E41 530D 4D59 4F49 440D"            /* NAHMYNASMYOID */	$"4D59 4F4D 410D 4D59 4F50 450D 4D59 4F50"            /* MYOMAMYOPEMYOP */	$"530D 4D59 4F50 590D 4D59 5349 440D 4D59"            /* SMYOPYMYSIDMY */	$"5448 490D 4D59 5448 530D 4D59 5448 590D"            /* THIMYTHSMYTHY */	$"4D59 584F 530D 4D5A 4545 530D 4E41 414D"            /* MYXOSMZEESNAAM */	$"530D 4E41 414E 530D 4E41 4245 530D 4E41"            /* SNAANSNABESNA */	$"4249 530D 4E41 424B 530D 4E41 424C 410D"            /* BISNABKSNABLA */	$"4E41 424F 420D 4E41 4348 450D 4E41 4348"            /* NABOBNACHENACH */	$"4F0D 4E41 4352 450D 4E41 4441 530D 4E41"            /* ONACRENADASNA */	$"4556 450D 4E41 4556 490D 4E41 4646 530D"            /* EVENAEVINAFFS */	$"4E41 4741 530D 4E41 4747 590D 4E41 474F"            /* NAGASNAGGYNAGO */	$"520D 4E41 4841 4C0D 4E41 4941 440D 4E41"            /* RNAHALNAIADNA */	$"4946 530D 4E41 494B 530D 4E41 494C 530D"            /* IFSNAIKSNAILS */	$"4E41 4952 410D 4E41 4952 550D 4E41 4B45"            /* NAIRANAIRUNAKE */	$"440D 4E41 4B45 520D 4E41 4B46 410D 4E41"            /* DNAKERNAKFANA */	$"4C41 530D 4E41 4C45 440D 4E41 4C4C 410D"            /* LASNALEDNALLA */	$"4E41 4D45 440D 4E41 4D45 520D 4E41 4D45"            /* NAMEDNAMERNAME */	$"530D 4E41 4D4D 410D 4E41 4D55 530D 4E41"            /* SNAMMANAMUSNA */	$"4E41 530D 4E41 4E43 450D 4E41 4E43 590D"            /* NASNANCENANCY */	$"4E41 4E44 550D 4E41 4E4E 410D 4E41 4E4F"            /* NANDUNANNANANO */	$"530D 4E41 4E55 410D 4E41 5041 530D 4E41"            /* SNANUANAPASNA */	$"5045 440D 4E41 5045 530D 4E41 504F 4F0D"            /* PEDNAPESNAPOO */	$"4E41 5050 410D 4E41 5050 450D 4E41 5050"            /* NAPPANAPPENAPP */	$"590D 4E41 5241 530D 4E41 5243 4F0D 4E41"            /* YNARASNARCONA */	$"5243 530D 4E41 5244 530D 4E41 5245 530D"            /* RCSNARDSNARES */	$"4E41 5249 430D 4E41 5249 530D 4E41 524B"            /* NARICNARISNARK */	$"530D 4E41 524B 590D 4E41 5252 450D 4E41"            /* SNARKYNARRENA */	$"5348 490D 4E41 5443 480D 4E41 5445 530D"            /* SHINATCHNATES */	$"4E41 5449 530D 4E41 5454 590D 4E41 5543"            /* NATISNATTYNAUC */	$"480D 4E41 554E 540D 4E41 5641 520D 4E41"            /* HNAUNTNAVARNA */	$"5645 530D 4E41 5645 570D 4E41 5656 590D"            /* VESNAVEWNAVVY */	$"4E41 5741 420D 4E41 5A45 530D 4E41 5A49"            /* NAWABNAZESNAZI */	$"520D 4E41 5A49 530D 4E44 554A 410D 4E45"            /* RNAZISNDUJANE */	$"4146 450D 4E45 414C 530D 4E45 4150 530D"            /* AFENEALSNEAPS */	$"4E45 4152 530D 4E45 4154 480D 4E45 4154"            /* NEARSNEATHNEAT */	$"530D 4E45 4245 4B0D 4E45 4245 4C0D 4E45"            /* SNEBEKNEBELNE */	$"434B 530D 4E45 4444 590D 4E45 4544 530D"            /* CKSNEDDYNEEDS */	$"4E45 454C 440D 4E45 454C 450D 4E45 454D"            /* NEELDNEELENEEM */	$"420D 4E45 454D 530D 4E45 4550 530D 4E45"            /* BNEEMSNEEPSNE */	$"4553 450D 4E45 455A 450D 4E45 4752 4F0D"            /* ESENEEZENEGRO */	$"4E45 4755 530D 4E45 4946 530D 4E45 4953"            /* NEGUSNEIFSNEIS */	$"540D 4E45 4956 450D 4E45 4C49 530D 4E45"            /* TNEIVENELISNE */	$"4C4C 590D 4E45 4D41 530D 4E45 4D4E 530D"            /* LLYNEMASNEMNS */	$"4E45 4D50 540D 4E45 4E45 530D 4E45 4F4E"            /* NEMPTNENESNEON */	$"530D 4E45 5045 520D 4E45 5049 540D 4E45"            /* SNEPERNEPITNE */	$"5241 4C0D 4E45 5244 530D 4E45 524B 410D"            /* RALNERDSNERKA */	$"4E45 524B 530D 4E45 524F 4C0D 4E45 5254"            /* NERKSNEROLNERT */	$"530D 4E45 5254 5A0D 4E45 5256 590D 4E45"            /* SNERTZNERVYNE */	$"5354 530D 4E45 5445 530D 4E45 544F 500D"            /* STSNETESNETOP */	$"4E45 5454 530D 4E45 5454 590D 4E45 554B"            /* NETTSNETTYNEUK */	$"530D 4E45 554D 450D 4E45 554D 530D 4E45"            /* SNEUMENEUMSNE */	$"5645 4C0D 4E45 5645 530D 4E45 5655 530D"            /* VELNEVESNEVUS */	$"4E45 5742 530D 4E45 5745 440D 4E45 5745"            /* NEWBSNEWEDNEWE */	$"4C0D 4E45 5749 450D 4E45 5753 590D 4E45"            /* LNEWIENEWSYNE */	$"5754 530D 4E45 5854 530D 4E45 5855 530D"            /* WTSNEXTSNEXUS */	$"4E47 4149 4F0D 4E47 414E 410D 4E47 4154"            /* NGAIONGANANGAT */	$"490D 4E47 4F4D 410D 4E47 5745 450D 4E49"            /* INGOMANGWEENI */	$"4341 440D 4E49 4348 540D 4E49 434B 530D"            /* CADNICHTNICKS */	$"4E49 434F 4C0D 4E49 4441 4C0D 4E49 4445"            /* NICOLNIDALNIDE */	$"440D 4E49 4445 530D 4E49 444F 520D 4E49"            /* DNIDESNIDORNI */	$"4455 530D 4E49 4546 530D 4E49 4556 450D"            /* DUSNIEFSNIEVE */	$"4E49 4645 530D 4E49 4646 530D 4E49 4646"            /* NIFESNIFFSNIFF */	$"590D 4E49 4654 590D 4E49 4745 520D 4E49"            /* YNIFTYNIGERNI */	$"4748 530D 4E49 4849 4C0D 4E49 4B41 420D"            /* GHSNIHILNIKAB */	$"4E49 4B41 480D 4E49 4B41 550D 4E49 4C4C"            /* NIKAHNIKAUNILL */	$"530D 4E49 4D42 490D 4E49 4D42 530D 4E49"            /* SNIMBINIMBSNI */	$"4D50 530D 4E49 4E45 520D 4E49 4E45 530D"            /* MPSNINERNINES */	$"4E49 4E4F 4E0D 4E49 5041 530D 4E49 5050"            /* NINONNIPASNIPP */	$"590D 4E49 5141 420D 4E49 524C 530D 4E49"            /* YNIQABNIRLSNI */	$"524C 590D 4E49 5345 490D 4E49 5353 450D"            /* RLYNISEINISSE */	$"4E49 5355 530D 4E49 5445 520D 4E49 5445"            /* NISUSNITERNITE */	$"530D 4E49 5449 440D 4E49 544F 4E0D 4E49"            /* SNITIDNITONNI */	$"5452 450D 4E49 5452 4F0D 4E49 5452 590D"            /* TRENITRONITRY */	$"4E49 5454 590D 4E49 5641 4C0D 4E49 5845"            /* NITTYNIVALNIXE */	$"440D 4E49 5845 520D 4E49 5845 530D 4E49"            /* DNIXERNIXESNI */	$"5849 450D 4E49 5A41 4D0D 4E4B 4F53 490D"            /* XIENIZAMNKOSI */	$"4E4F 4148 530D 4E4F 4242 590D 4E4F 434B"            /* NOAHSNOBBYNOCK */	$"530D 4E4F 4441 4C0D 4E4F 4444 590D 4E4F"            /* SNODALNODDYNO */	$"4445 530D 4E4F 4455 530D 4E4F 454C 530D"            /* DESNODUSNOELS */	$"4E4F 4747 530D 4E4F 484F 570D 4E4F 494C"            /* NOGGSNOHOWNOIL */	$"530D 4E4F 494C 590D 4E4F 494E 540D 4E4F"            /* SNOILYNOINTNO */	$"4952 530D 4E4F 4C45 530D 4E4F 4C4C 530D"            /* IRSNOLESNOLLS */	$"4E4F 4C4F 530D 4E4F 4D41 530D 4E4F 4D45"            /* NOLOSNOMASNOME */	$"4E0D 4E4F 4D45 530D 4E4F 4D49 430D 4E4F"            /* NNOMESNOMICNO */	$"4D4F 490D 4E4F 4D4F 530D 4E4F 4E41 530D"            /* MOINOMOSNONAS */	$"4E4F 4E43 450D 4E4F 4E45 530D 4E4F 4E45"            /* NONCENONESNONE */	$"540D 4E4F 4E47 530D 4E4F 4E49 530D 4E4F"            /* TNONGSNONISNO */	$"4E4E 590D 4E4F 4E59 4C0D 4E4F 4F42 530D"            /* NNYNONYLNOOBS */	$"4E4F 4F49 540D 4E4F 4F4B 530D 4E4F 4F4B"            /* NOOITNOOKSNOOK */	$"590D 4E4F 4F4E 530D 4E4F 4F50 530D 4E4F"            /* YNOONSNOOPSNO */	$"5041 4C0D 4E4F 5249 410D 4E4F 5249 530D"            /* PALNORIANORIS */	$"4E4F 524B 530D 4E4F 524D 410D 4E4F 524D"            /* NORKSNORMANORM */	$"530D 4E4F 5345 440D 4E4F 5345 520D 4E4F"            /* SNOSEDNOSERNO */	$"5345 530D 4E4F 5441 4C0D 4E4F 5445 440D"            /* SESNOTALNOTED */	$"4E4F 5445 520D 4E4F 5445 530D 4E4F 5455"            /* NOTERNOTESNOTU */	$"4D0D 4E4F 554C 440D 4E4F 554C 450D 4E4F"            /* MNOULDNOULENO */	$"554C 530D 4E4F 554E 530D 4E4F 554E 590D"            /* ULSNOUNSNOUNY */	$"4E4F 5550 530D 4E4F 5641 450D 4E4F 5641"            /* NOUPSNOVAENOVA */	$"530D 4E4F 5655 4D0D 4E4F 5741 590D 4E4F"            /* SNOVUMNOWAYNO */	$"5745 440D 4E4F 574C 530D 4E4F 5754 530D"            /* WEDNOWLSNOWTS */	$"4E4F 5754 590D 4E4F 5841 4C0D 4E4F 5845"            /* NOWTYNOXALNOXE */	$"530D 4E4F 5941 550D 4E4F 5945 440D 4E4F"            /* SNOYAUNOYEDNO */	$"5945 530D 4E55 4242 590D 4E55 4249 410D"            /* YESNUBBYNUBIA */	$"4E55 4348 410D 4E55 4444 590D 4E55 4445"            /* NUCHANUDDYNUDE */	$"520D 4E55 4445 530D 4E55 4449 450D 4E55"            /* RNUDESNUDIENU */	$"445A 480D 4E55 4646 530D 4E55 4741 450D"            /* DZHNUFFSNUGAE */	$"4E55 4B45 440D 4E55 4B45 530D 4E55 4C4C"            /* NUKEDNUKESNULL */	$"410D 4E55 4C4C 530D 4E55 4D42 530D 4E55"            /* ANULLSNUMBSNU */	$"4D45 4E0D 4E55 4D4D 590D 4E55 4E4E 590D"            /* MENNUMMYNUNNY */	$"4E55 5244 530D 4E55 5244 590D 4E55 524C"            /* NURDSNURDYNURL */	$"530D 4E55 5252 530D 4E55 5453 4F0D 4E55"            /* SNURRSNUTSONU */	$"5453 590D 4E59 4146 460D 4E59 414C 410D"            /* TSYNYAFFNYALA */	$"4E59 494E 470D 4E59 5353 410D 4F41 4B45"            /* NYINGNYSSAOAKE */	$"440D 4F41 4B45 520D 4F41 4B55 4D0D 4F41"            /* DOAKEROAKUMOA */	$"5245 440D 4F41 5345 530D 4F41 5349 530D"            /* REDOASESOASIS */	$"4F41 5354 530D 4F41 5445 4E0D 4F41 5445"            /* OASTSOATENOATE */	$"520D 4F41 5448 530D 4F41 5645 530D 4F42"            /* ROATHSOAVESOB */	$"414E 470D 4F42 4541 480D 4F42 454C 490D"            /* ANGOBEAHOBELI */	$"4F42 4559 530D 4F42 4941 530D 4F42 4945"            /* OBEYSOBIASOBIE */	$"440D 4F42 4949 540D 4F42 4954 530D 4F42"            /* DOBIITOBITSOB */	$"4A45 540D 4F42 4F45 530D 4F42 4F4C 450D"            /* JETOBOESOBOLE */	$"4F42 4F4C 490D 4F42 4F4C 530D 4F43 4341"            /* OBOLIOBOLSOCCA */	$"4D0D 4F43 4845 520D 4F43 4845 530D 4F43"            /* MOCHEROCHESOC */	$"4852 450D 4F43 4852 590D 4F43 4B45 520D"            /* HREOCHRYOCKER */	$"4F43 5245 410D 4F43 5441 440D 4F43 5441"            /* OCREAOCTADOCTA */	$"4E0D 4F43 5441 530D 4F43 5459 4C0D 4F43"            /* NOCTASOCTYLOC */	$"554C 490D 4F44 4148 530D 4F44 414C 530D"            /* ULIODAHSODALS */	$"4F44 454F 4E0D 4F44 4555 4D0D 4F44 4953"            /* ODEONODEUMODIS */	$"4D0D 4F44 4953 540D 4F44 4955 4D0D 4F44"            /* MODISTODIUMOD */	$"4F52 530D 4F44 4F55 520D 4F44 594C 450D"            /* ORSODOURODYLE */	$"4F44 594C 530D 4F46 4159 530D 4F46 4645"            /* ODYLSOFAYSOFFE */	$"440D 4F46 4649 450D 4F46 4C41 470D 4F46"            /* DOFFIEOFLAGOF */	$"5445 520D 4F47 414D 530D 4F47 4545 440D"            /* TEROGAMSOGEED */	$"4F47 4545 530D 4F47 4749 4E0D 4F47 4841"            /* OGEESOGGINOGHA */	$"4D0D 4F47 4956 450D 4F47 4C45 440D 4F47"            /* MOGIVEOGLEDOG */	$"4C45 520D 4F47 4C45 530D 4F47 4D49 430D"            /* LEROGLESOGMIC */	$"4F47 5245 530D 4F48 4941 530D 4F48 494E"            /* OGRESOHIASOHIN */	$"470D 4F48 4D49 430D 4F48 4F4E 450D 4F49"            /* GOHMICOHONEOI */	$"4449 410D 4F49 4C45 440D 4F49 4C45 520D"            /* DIAOILEDOILER */	$"4F49 4E4B 530D 4F49 4E54 530D 4F4A 494D"            /* OINKSOINTSOJIM */	$"450D 4F4B 4150 490D 4F4B 4159 530D 4F4B"            /* EOKAPIOKAYSOK */	$"4548 530D 4F4B 5241 530D 4F4B 5441 530D"            /* EHSOKRASOKTAS */	$"4F4C 4449 450D 4F4C 4549 430D 4F4C 4549"            /* OLDIEOLEICOLEI */	$"4E0D 4F4C 454E 540D 4F4C 454F 530D 4F4C"            /* NOLENTOLEOSOL */	$"4555 4D0D 4F4C 494F 530D 4F4C 4C41 530D"            /* EUMOLIOSOLLAS */	$"4F4C 4C41 560D 4F4C 4C45 520D 4F4C 4C49"            /* OLLAVOLLEROLLI */	$"450D 4F4C 4F47 590D 4F4C 5041 450D 4F4C"            /* EOLOGYOLPAEOL */	$"5045 530D 4F4D 4153 410D 4F4D 4245 520D"            /* PESOMASAOMBER */	$"4F4D 4255 530D 4F4D 454E 530D 4F4D 4552"            /* OMBUSOMENSOMER */	$"530D 4F4D 4954 530D 4F4D 4C41 480D 4F4D"            /* SOMITSOMLAHOM */	$"4F56 530D 4F4D 5241 480D 4F4E 4345 520D"            /* OVSOMRAHONCER */	$"4F4E 4345 530D 4F4E 4345 540D 4F4E 4355"            /* ONCESONCETONCU */	$"530D 4F4E 454C 590D 4F4E 4552 530D 4F4E"            /* SONELYONERSON */	$"4552 590D 4F4E 4955 4D0D 4F4E 4B55 530D"            /* ERYONIUMONKUS */	$"4F4E 4C41 590D 4F4E 4E45 440D 4F4E 5449"            /* ONLAYONNEDONTI */	$"430D 4F4F 4249 540D 4F4F 4845 440D 4F4F"            /* COOBITOOHEDOO */	$"4D50 480D 4F4F 4E54 530D 4F4F 5045 440D"            /* MPHOONTSOOPED */	$"4F4F 5249 450D 4F4F 5345 530D 4F4F 5449"            /* OORIEOOSESOOTI */	$"440D 4F4F 5A45 440D 4F4F 5A45 530D 4F50"            /* DOOZEDOOZESOP */	$"4148 530D 4F50 414C 530D 4F50 454E 530D"            /* AHSOPALSOPENS */	$"4F50 4550 450D 4F50 494E 470D 4F50 504F"            /* OPEPEOPINGOPPO */	$"530D 4F50 5349 4E0D 4F50 5445 440D 4F50"            /* SOPSINOPTEDOP */	$"5445 520D 4F52 4143 480D 4F52 4143 590D"            /* TERORACHORACY */	$"4F52 414C 530D 4F52 414E 470D 4F52 414E"            /* ORALSORANGORAN */	$"540D 4F52 4154 450D 4F52 4245 440D 4F52"            /* TORATEORBEDOR */	$"4341 530D 4F52 4349 4E0D 4F52 444F 530D"            /* CASORCINORDOS */	$"4F52 4541 440D 4F52 4645 530D 4F52 4749"            /* OREADORFESORGI */	$"410D 4F52 4749 430D 4F52 4755 450D 4F52"            /* AORGICORGUEOR */	$"4942 490D 4F52 4945 4C0D 4F52 4958 410D"            /* IBIORIELORIXA */	$"4F52 4C45 530D 4F52 4C4F 4E0D 4F52 4C4F"            /* ORLESORLONORLO */	$"500D 4F52 4D45 520D 4F52 4E49 530D 4F52"            /* PORMERORNISOR */	$"5049 4E0D 4F52 5249 530D 4F52 5448 4F0D"            /* PINORRISORTHO */	$"4F52 5641 4C0D 4F52 5A4F 530D 4F53 4341"            /* ORVALORZOSOSCA */	$"520D 4F53 4841 430D 4F53 4945 520D 4F53"            /* ROSHACOSIEROS */	$"4D49 430D 4F53 4D4F 4C0D 4F53 5349 410D"            /* MICOSMOLOSSIA */	$"4F53 5449 410D 4F54 414B 550D 4F54 4152"            /* OSTIAOTAKUOTAR */	$"590D 4F54 5441 520D 4F54 544F 530D 4F55"            /* YOTTAROTTOSOU */	$"4249 540D 4F55 4348 540D 4F55 454E 530D"            /* BITOUCHTOUENS */	$"4F55 494A 410D 4F55 4C4B 530D 4F55 4D41"            /* OUIJAOULKSOUMA */	$"530D 4F55 4E44 590D 4F55 5041 530D 4F55"            /* SOUNDYOUPASOU */	$"5045 440D 4F55 5048 450D 4F55 5048 530D"            /* PEDOUPHEOUPHS */	$"4F55 5249 450D 4F55 5345 4C0D 4F55 5354"            /* OURIEOUSELOUST */	$"530D 4F55 5442 590D 4F55 5445 440D 4F55"            /* SOUTBYOUTEDOU */	$"5452 450D 4F55 5452 4F0D 4F55 5454 410D"            /* TREOUTROOUTTA */	$"4F55 5A45 4C0D 4F55 5A4F 530D 4F56 414C"            /* OUZELOUZOSOVAL */	$"530D 4F56 454C 530D 4F56 454E 530D 4F56"            /* SOVELSOVENSOV */	$"4552 530D 4F56 4953 540D 4F56 4F4C 490D"            /* ERSOVISTOVOLI */	$"4F56 4F4C 4F0D 4F56 554C 450D 4F57 4348"            /* OVOLOOVULEOWCH */	$"450D 4F57 4945 530D 4F57 4C45 440D 4F57"            /* EOWIESOWLEDOW */	$"4C45 520D 4F57 4C45 540D 4F57 4E45 440D"            /* LEROWLETOWNED */	$"4F57 5245 530D 4F57 5249 450D 4F57 5345"            /* OWRESOWRIEOWSE */	$"4E0D 4F58 424F 570D 4F58 4552 530D 4F58"            /* NOXBOWOXERSOX */	$"4559 450D 4F58 4944 530D 4F58 4945 530D"            /* EYEOXIDSOXIES */	$"4F58 494D 450D 4F58 494D 530D 4F58 4C49"            /* OXIMEOXIMSOXLI */	$"500D 4F58 5445 520D 4F59 4552 530D 4F5A"            /* POXTEROYERSOZ */	$"454B 490D 4F5A 5A49 450D 5041 414C 530D"            /* EKIOZZIEPAALS */	$"5041 414E 530D 5041 4341 530D 5041 4345"            /* PAANSPACASPACE */	$"440D 5041 4345 520D 5041 4345 530D 5041"            /* DPACERPACESPA */	$"4345 590D 5041 4348 410D 5041 434B 530D"            /* CEYPACHAPACKS */	$"5041 434F 530D 5041 4354 410D 5041 4354"            /* PACOSPACTAPACT */	$"530D 5041 4449 530D 5041 444C 450D 5041"            /* SPADISPADLEPA */	$"444D 410D 5041 4452 450D 5041 4452 490D"            /* DMAPADREPADRI */	$"5041 4541 4E0D 5041 4544 4F0D 5041 454F"            /* PAEANPAEDOPAEO */	$"4E0D 5041 4745 440D 5041 4745 520D 5041"            /* NPAGEDPAGERPA */	$"4745 530D 5041 474C 450D 5041 474F 440D"            /* GESPAGLEPAGOD */	$"5041 4752 490D 5041 494B 530D 5041 494C"            /* PAGRIPAIKSPAIL */	$"530D 5041 494E 530D 5041 4952 450D 5041"            /* SPAINSPAIREPA */	$"4952 530D 5041 4953 410D 5041 4953 450D"            /* IRSPAISAPAISE */	$"5041 4B4B 410D 5041 4C41 530D 5041 4C41"            /* PAKKAPALASPALA */	$"590D 5041 4C45 410D 5041 4C45 440D 5041"            /* YPALEAPALEDPA */	$"4C45 530D 5041 4C45 540D 5041 4C49 530D"            /* LESPALETPALIS */	$"5041 4C4B 490D 5041 4C4C 410D 5041 4C4C"            /* PALKIPALLAPALL */	$"530D 5041 4C4C 590D 5041 4C4D 530D 5041"            /* SPALLYPALMSPA */	$"4C4D 590D 5041 4C50 490D 5041 4C50 530D"            /* LMYPALPIPALPS */	$"5041 4C53 410D 5041 4D50 410D 5041 4E41"            /* PALSAPAMPAPANA */	$"580D 5041 4E43 450D 5041 4E44 410D 5041"            /* XPANCEPANDAPA */	$"4E44 530D 5041 4E44 590D 5041 4E45 440D"            /* NDSPANDYPANED */	$"5041 4E45 530D 5041 4E47 410D 5041 4E47"            /* PANESPANGAPANG */	$"530D 5041 4E49 4D0D 5041 4E4B 4F0D 5041"            /* SPANIMPANKOPA */	$"4E4E 450D 5041 4E4E 490D 5041 4E54 4F0D"            /* NNEPANNIPANTO */	$"5041 4E54 530D 5041 4E54 590D 5041 4F4C"            /* PANTSPANTYPAOL */	$"490D 5041 4F4C 4F0D 5041 5041 530D 5041"            /* IPAOLOPAPASPA */	$"5041 570D 5041 5045 530D 5041 5050 490D"            /* PAWPAPESPAPPI */	$"5041 5050 590D 5041 5241 450D 5041 5241"            /* PAPPYPARAEPARA */	$"530D 5041 5243 480D 5041 5244 490D 5041"            /* SPARCHPARDIPA */	$"5244 530D 5041 5244 590D 5041 5245 440D"            /* RDSPARDYPARED */	$"5041 5245 4E0D 5041 5245 4F0D 5041 5245"            /* PARENPAREOPARE */	$"530D 5041 5245 550D 5041 5245 560D 5041"            /* SPAREUPAREVPA */	$"5247 450D 5041 5247 4F0D 5041 5249 530D"            /* RGEPARGOPARIS */	$"5041 524B 490D 5041 524B 530D 5041 524B"            /* PARKIPARKSPARK */	$"590D 5041 524C 450D 5041 524C 590D 5041"            /* YPARLEPARLYPA */	$"524D 410D 5041 524F 4C0D 5041 5250 530D"            /* RMAPAROLPARPS */	$"5041 5252 410D 5041 5252 530D 5041 5254"            /* PARRAPARRSPART */	$"490D 5041 5254 530D 5041 5256 450D 5041"            /* IPARTSPARVEPA */	$"5256 4F0D 5041 5345 4F0D 5041 5345 530D"            /* RVOPASEOPASES */	$"5041 5348 410D 5041 5348 4D0D 5041 534B"            /* PASHAPASHMPASK */	$"410D 5041 5350 590D 5041 5353 450D 5041"            /* APASPYPASSEPA */	$"5354 530D 5041 5445 440D 5041 5445 4E0D"            /* STSPATEDPATEN */	$"5041 5445 520D 5041 5445 530D 5041 5448"            /* PATERPATESPATH */	$"530D 5041 5449 4E0D 5041 544B 410D 5041"            /* SPATINPATKAPA */	$"544C 590D 5041 5454 450D 5041 5455 530D"            /* TLYPATTEPATUS */	$"5041 5541 530D 5041 554C 530D 5041 5641"            /* PAUASPAULSPAVA */	$"4E0D 5041 5645 440D 5041 5645 4E0D 5041"            /* NPAVEDPAVENPA */	$"5645 520D 5041 5645 530D 5041 5649 440D"            /* VERPAVESPAVID */	$"5041 5649 4E0D 5041 5649 530D 5041 5741"            /* PAVINPAVISPAWA */	$"530D 5041 5741 570D 5041 5745 440D 5041"            /* SPAWAWPAWEDPA */	$"5745 520D 5041 574B 530D 5041 574B 590D"            /* WERPAWKSPAWKY */	$"5041 574C 530D 5041 574E 530D 5041 5845"            /* PAWLSPAWNSPAXE */	$"530D 5041 5945 440D 5041 594F 520D 5041"            /* SPAYEDPAYORPA */	$"5953 440D 5045 4147 450D 5045 4147 530D"            /* YSDPEAGEPEAGS */	$"5045 414B 530D 5045 414B 590D 5045 414C"            /* PEAKSPEAKYPEAL */	$"530D 5045 414E 530D 5045 4152 450D 5045"            /* SPEANSPEAREPE */	$"4152 530D 5045 4152 540D 5045 4153 450D"            /* ARSPEARTPEASE */	$"5045 4154 530D 5045 4154 590D 5045 4156"            /* PEATSPEATYPEAV */	$"590D 5045 415A 450D 5045 4241 530D 5045"            /* YPEAZEPEBASPE */	$"4348 530D 5045 434B 450D 5045 434B 530D"            /* CHSPECKEPECKS */	$"5045 434B 590D 5045 4445 530D 5045 4449"            /* PECKYPEDESPEDI */	$"530D 5045 4452 4F0D 5045 4543 450D 5045"            /* SPEDROPEECEPE */	$"454B 530D 5045 454C 530D 5045 454E 530D"            /* EKSPEELSPEENS */	$"5045 454F 590D 5045 4550 450D 5045 4550"            /* PEEOYPEEPEPEEP */	$"530D 5045 4552 530D 5045 4552 590D 5045"            /* SPEERSPEERYPE */	$"4556 450D 5045 4747 590D 5045 4748 530D"            /* EVEPEGGYPEGHS */	$"5045 494E 530D 5045 4953 450D 5045 495A"            /* PEINSPEISEPEIZ */	$"450D 5045 4B41 4E0D 5045 4B45 530D 5045"            /* EPEKANPEKESPE */	$"4B49 4E0D 5045 4B4F 450D 5045 4C41 530D"            /* KINPEKOEPELAS */	$"5045 4C41 550D 5045 4C45 530D 5045 4C46"            /* PELAUPELESPELF */	$"530D 5045 4C4C 530D 5045 4C4D 410D 5045"            /* SPELLSPELMAPE */	$"4C4F 4E0D 5045 4C54 410D 5045 4C54 530D"            /* LONPELTAPELTS */	$"5045 4E44 530D 5045 4E44 550D 5045 4E45"            /* PENDSPENDUPENE */	$"440D 5045 4E45 530D 5045 4E47 4F0D 5045"            /* DPENESPENGOPE */	$"4E49 450D 5045 4E49 530D 5045 4E4B 530D"            /* NIEPENISPENKS */	$"5045 4E4E 410D 5045 4E4E 490D 5045 4E54"            /* PENNAPENNIPENT */	$"530D 5045 4F4E 530D 5045 4F4E 590D 5045"            /* SPEONSPEONYPE */	$"504C 410D 5045 504F 530D 5045 5050 590D"            /* PLAPEPOSPEPPY */	$"5045 5053 490D 5045 5241 490D 5045 5243"            /* PEPSIPERAIPERC */	$"450D 5045 5243 530D 5045 5244 550D 5045"            /* EPERCSPERDUPE */	$"5244 590D 5045 5245 410D 5045 5245 530D"            /* RDYPEREAPERES */	$"5045 5249 530D 5045 524B 530D 5045 524D"            /* PERISPERKSPERM */	$"530D 5045 524E 530D 5045 524F 470D 5045"            /* SPERNSPEROGPE */	$"5250 530D 5045 5252 590D 5045 5253 450D"            /* RPSPERRYPERSE */	$"5045 5253 540D 5045 5254 530D 5045 5256"            /* PERSTPERTSPERV */	$"450D 5045 5256 4F0D 5045 5256 530D 5045"            /* EPERVOPERVSPE */	$"5256 590D 5045 534F 530D 5045 5354 530D"            /* RVYPESOSPESTS */	$"5045 5354 590D 5045 5441 520D 5045 5445"            /* PESTYPETARPETE */	$"520D 5045 5449 540D 5045 5452 450D 5045"            /* RPETITPETREPE */	$"5452 490D 5045 5454 490D 5045 5454 4F0D"            /* TRIPETTIPETTO */	$"5045 5745 450D 5045 5749 540D 5045 5953"            /* PEWEEPEWITPEYS */	$"450D 5048 4147 450D 5048 414E 470D 5048"            /* EPHAGEPHANGPH */	$"4152 450D 5048 4152 4D0D 5048 4545 520D"            /* AREPHARMPHEER */	$"5048 454E 450D 5048 454F 4E0D 5048 4553"            /* PHENEPHEONPHES */	$"450D 5048 4941 4C0D 5048 4953 480D 5048"            /* EPHIALPHISHPH */	$"495A 5A0D 5048 4C4F 580D 5048 4F43 410D"            /* IZZPHLOXPHOCA */	$"5048 4F4E 4F0D 5048 4F4E 530D 5048 4F54"            /* PHONOPHONSPHOT */	$"530D 5048 5048 540D 5048 5554 530D 5048"            /* SPHPHTPHUTSPH */	$"594C 410D 5048 594C 450D 5049 414E 490D"            /* YLAPHYLEPIANI */	$"5049 414E 530D 5049 4241 4C0D 5049 4341"            /* PIANSPIBALPICA */	$"4C0D 5049 4341 530D 5049 4343 590D 5049"            /* LPICASPICCYPI */	$"434B 530D 5049 434F 540D 5049 4352 410D"            /* CKSPICOTPICRA */	$"5049 4355 4C0D 5049 454E 440D 5049 4552"            /* PICULPIENDPIER */	$"530D 5049 4552 540D 5049 4554 410D 5049"            /* SPIERTPIETAPI */	$"4554 530D 5049 455A 4F0D 5049 4748 540D"            /* ETSPIEZOPIGHT */	$"5049 474D 590D 5049 494E 470D 5049 4B41"            /* PIGMYPIINGPIKA */	$"530D 5049 4B41 550D 5049 4B45 440D 5049"            /* SPIKAUPIKEDPI */	$"4B45 520D 5049 4B45 530D 5049 4B45 590D"            /* KERPIKESPIKEY */	$"5049 4B49 530D 5049 4B55 4C0D 5049 4C41"            /* PIKISPIKULPILA */	$"450D 5049 4C41 460D 5049 4C41 4F0D 5049"            /* EPILAFPILAOPI */	$"4C41 520D 5049 4C41 550D 5049 4C41 570D"            /* LARPILAUPILAW */	$"5049 4C43 480D 5049 4C45 410D 5049 4C45"            /* PILCHPILEAPILE */	$"440D 5049 4C45 490D 5049 4C45 520D 5049"            /* DPILEIPILERPI */	$"4C45 530D 5049 4C49 530D 5049 4C4C 530D"            /* LESPILISPILLS */	$"5049 4C4F 570D 5049 4C55 4D0D 5049 4C55"            /* PILOWPILUMPILU */	$"530D 5049 4D41 530D 5049 4D50 530D 5049"            /* SPIMASPIMPSPI */	$"4E41 530D 5049 4E45 440D 5049 4E45 530D"            /* NASPINEDPINES */	$"5049 4E47 4F0D 5049 4E47 530D 5049 4E4B"            /* PINGOPINGSPINK */	$"4F0D 5049 4E4B 530D 5049 4E4E 410D 5049"            /* OPINKSPINNAPI */	$"4E4E 590D 5049 4E4F 4E0D 5049 4E4F 540D"            /* NNYPINONPINOT */	$"5049 4E54 410D 5049 4E54 530D 5049 4E55"            /* PINTAPINTSPINU */	$"500D 5049 4F4E 530D 5049 4F4E 590D 5049"            /* PPIONSPIONYPI */	$"4F55 530D 5049 4F59 450D 5049 4F59 530D"            /* OUSPIOYEPIOYS */	$"5049 5041 4C0D 5049 5041 530D 5049 5045"            /* PIPALPIPASPIPE */	$"440D 5049 5045 530D 5049 5045 540D 5049"            /* DPIPESPIPETPI */	$"5049 530D 5049 5049 540D 5049 5050 590D"            /* PISPIPITPIPPY */	$"5049 5055 4C0D 5049 5241 490D 5049 524C"            /* PIPULPIRAIPIRL */	$"530D 5049 524E 530D 5049 524F 470D 5049"            /* SPIRNSPIROGPI */	$"5343 4F0D 5049 5345 530D 5049 534B 590D"            /* SCOPISESPISKY */	$"5049 534F 530D 5049 5353 590D 5049 5354"            /* PISOSPISSYPIST */	$"450D 5049 5441 530D 5049 5448 530D 5049"            /* EPITASPITHSPI */	$"544F 4E0D 5049 544F 540D 5049 5454 410D"            /* TONPITOTPITTA */	$"5049 554D 530D 5049 5845 530D 5049 5A45"            /* PIUMSPIXESPIZE */	$"440D 5049 5A45 530D 504C 4141 530D 504C"            /* DPIZESPLAASPL */	$"4143 4B0D 504C 4147 450D 504C 414E 530D"            /* ACKPLAGEPLANS */	$"504C 4150 530D 504C 4153 480D 504C 4153"            /* PLAPSPLASHPLAS */	$"4D0D 504C 4153 540D 504C 4154 530D 504C"            /* MPLASTPLATSPL */	$"4154 540D 504C 4154 590D 504C 4159 410D"            /* ATTPLATYPLAYA */	$"504C 4159 530D 504C 4541 530D 504C 4542"            /* PLAYSPLEASPLEB */	$"450D 504C 4542 530D 504C 454E 410D 504C"            /* EPLEBSPLENAPL */	$"454F 4E0D 504C 4553 480D 504C 4557 530D"            /* EONPLESHPLEWS */	$"504C 4943 410D 504C 4945 530D 504C 494D"            /* PLICAPLIESPLIM */	$"530D 504C 494E 470D 504C 494E 4B0D 504C"            /* SPLINGPLINKPL */	$"4F41 540D 504C 4F44 530D 504C 4F4E 470D"            /* OATPLODSPLONG */	$"504C 4F4E 4B0D 504C 4F4F 4B0D 504C 4F50"            /* PLONKPLOOKPLOP */	$"530D 504C 4F54 530D 504C 4F54 5A0D 504C"            /* SPLOTSPLOTZPL */	$"4F55 4B0D 504C 4F57 530D 504C 4F59 450D"            /* OUKPLOWSPLOYE */	$"504C 4F59 530D 504C 5545 530D 504C 5546"            /* PLOYSPLUESPLUF */	$"460D 504C 5547 530D 504C 554D 530D 504C"            /* FPLUGSPLUMSPL */	$"554D 590D 504C 554F 540D 504C 5554 4F0D"            /* UMYPLUOTPLUTO */	$"504C 5945 520D 504F 4143 480D 504F 414B"            /* PLYERPOACHPOAK */	$"410D 504F 414B 450D 504F 424F 590D 504F"            /* APOAKEPOBOYPO */	$"434B 530D 504F 434B 590D 504F 4441 4C0D"            /* CKSPOCKYPODAL */	$"504F 4444 590D 504F 4445 580D 504F 4447"            /* PODDYPODEXPODG */	$"450D 504F 4447 590D 504F 4449 410D 504F"            /* EPODGYPODIAPO */	$"454D 530D 504F 4550 530D 504F 4554 530D"            /* EMSPOEPSPOETS */	$"504F 4745 590D 504F 4747 450D 504F 474F"            /* POGEYPOGGEPOGO */	$"530D 504F 4845 440D 504F 494C 550D 504F"            /* SPOHEDPOILUPO */	$"494E 440D 504F 4B41 4C0D 504F 4B45 440D"            /* INDPOKALPOKED */	$"504F 4B45 530D 504F 4B45 590D 504F 4B49"            /* POKESPOKEYPOKI */	$"450D 504F 4C45 440D 504F 4C45 520D 504F"            /* EPOLEDPOLERPO */	$"4C45 530D 504F 4C45 590D 504F 4C49 4F0D"            /* LESPOLEYPOLIO */	$"504F 4C49 530D 504F 4C4A 450D 504F 4C4B"            /* POLISPOLJEPOLK */	$"530D 504F 4C4C 530D 504F 4C4C 590D 504F"            /* SPOLLSPOLLYPO */	$"4C4F 530D 504F 4C54 530D 504F 4C59 530D"            /* LOSPOLTSPOLYS */	$"504F 4D42 450D 504F 4D45 530D 504F 4D4D"            /* POMBEPOMESPOMM */	$"590D 504F 4D4F 530D 504F 4D50 530D 504F"            /* YPOMOSPOMPSPO */	$"4E43 450D 504F 4E43 590D 504F 4E44 530D"            /* NCEPONCYPONDS */	$"504F 4E45 530D 504F 4E45 590D 504F 4E47"            /* PONESPONEYPONG */	$"410D 504F 4E47 4F0D 504F 4E47 530D 504F"            /* APONGOPONGSPO */	$"4E47 590D 504F 4E4B 530D 504F 4E54 530D"            /* NGYPONKSPONTS */	$"504F 4E54 590D 504F 4E5A 550D 504F 4F44"            /* PONTYPONZUPOOD */	$"530D 504F 4F45 440D 504F 4F46 530D 504F"            /* SPOOEDPOOFSPO */	$"4F46 590D 504F 4F48 530D 504F 4F4A 410D"            /* OFYPOOHSPOOJA */	$"504F 4F4B 410D 504F 4F4B 530D 504F 4F4C"            /* POOKAPOOKSPOOL */	$"530D 504F 4F4E 530D 504F 4F50 530D 504F"            /* SPOONSPOOPSPO */	$"4F50 590D 504F 4F52 490D 504F 4F52 540D"            /* OPYPOORIPOORT */	$"504F 4F54 530D 504F 4F56 450D 504F 4F56"            /* POOTSPOOVEPOOV */	$"590D 504F 5045 530D 504F 5050 410D 504F"            /* YPOPESPOPPAPO */	$"5053 590D 504F 5241 450D 504F 5241 4C0D"            /* PSYPORAEPORAL */	$"504F 5245 440D 504F 5245 520D 504F 5245"            /* POREDPORERPORE */	$"530D 504F 5247 450D 504F 5247 590D 504F"            /* SPORGEPORGYPO */	$"5249 4E0D 504F 524B 530D 504F 524B 590D"            /* RINPORKSPORKY */	$"504F 524E 4F0D 504F 524E 530D 504F 524E"            /* PORNOPORNSPORN */	$"590D 504F 5254 410D 504F 5254 530D 504F"            /* YPORTAPORTSPO */	$"5254 590D 504F 5345 440D 504F 5345 530D"            /* RTYPOSEDPOSES */	$"504F 5345 590D 504F 5348 4F0D 504F 5354"            /* POSEYPOSHOPOST */	$"530D 504F 5441 450D 504F 5443 480D 504F"            /* SPOTAEPOTCHPO */	$"5445 440D 504F 5445 530D 504F 5449 4E0D"            /* TEDPOTESPOTIN */	$"504F 544F 4F0D 504F 5453 590D 504F 5454"            /* POTOOPOTSYPOTT */	$"4F0D 504F 5454 530D 504F 5454 590D 504F"            /* OPOTTSPOTTYPO */	$"5546 460D 504F 5546 530D 504F 554B 450D"            /* UFFPOUFSPOUKE */	$"504F 554B 530D 504F 554C 450D 504F 554C"            /* POUKSPOULEPOUL */	$"500D 504F 554C 540D 504F 5550 450D 504F"            /* PPOULTPOUPEPO */	$"5550 540D 504F 5552 530D 504F 5554 530D"            /* UPTPOURSPOUTS */	$"504F 5741 4E0D 504F 5749 4E0D 504F 574E"            /* POWANPOWINPOWN */	$"440D 504F 574E 530D 504F 574E 590D 504F"            /* DPOWNSPOWNYPO */	$"5752 450D 504F 5845 440D 504F 5845 530D"            /* WREPOXEDPOXES */	$"504F 594E 540D 504F 594F 550D 504F 5953"            /* POYNTPOYOUPOYS */	$"450D 504F 5A5A 590D 5052 4141 4D0D 5052"            /* EPOZZYPRAAMPR */	$"4144 530D 5052 4148 550D 5052 414D 530D"            /* ADSPRAHUPRAMS */	$"5052 414E 410D 5052 414E 470D 5052 414F"            /* PRANAPRANGPRAO */	$"530D 5052 4153 450D 5052 4154 450D 5052"            /* SPRASEPRATEPR */	$"4154 530D 5052 4154 540D 5052 4154 590D"            /* ATSPRATTPRATY */	$"5052 4155 530D 5052 4159 530D 5052 4544"            /* PRAUSPRAYSPRED */	$"590D 5052 4545 440D 5052 4545 530D 5052"            /* YPREEDPREESPR */	$"4549 460D 5052 454D 530D 5052 454D 590D"            /* EIFPREMSPREMY */	$"5052 454E 540D 5052 454F 4E0D 5052 454F"            /* PRENTPREONPREO */	$"500D 5052 4550 530D 5052 4553 410D 5052"            /* PPREPSPRESAPR */	$"4553 450D 5052 4553 540D 5052 4556 450D"            /* ESEPRESTPREVE */	$"5052 4558 590D 5052 4559 530D 5052 4941"            /* PREXYPREYSPRIA */	$"4C0D 5052 4943 590D 5052 4945 460D 5052"            /* LPRICYPRIEFPR */	$"4945 520D 5052 4945 530D 5052 4947 530D"            /* IERPRIESPRIGS */	$"5052 494C 4C0D 5052 494D 410D 5052 494D"            /* PRILLPRIMAPRIM */	$"490D 5052 494D 500D 5052 494D 530D 5052"            /* IPRIMPPRIMSPR */	$"494D 590D 5052 494E 4B0D 5052 494F 4E0D"            /* IMYPRINKPRION */	$"5052 4953 450D 5052 4953 530D 5052 4F41"            /* PRISEPRISSPROA */	$"530D 5052 4F42 530D 5052 4F44 530D 5052"            /* SPROBSPRODSPR */	$"4F45 4D0D 5052 4F46 530D 5052 4F47 530D"            /* OEMPROFSPROGS */	$"5052 4F49 4E0D 5052 4F4B 450D 5052 4F4C"            /* PROINPROKEPROL */	$"450D 5052 4F4C 4C0D 5052 4F4D 4F0D 5052"            /* EPROLLPROMOPR */	$"4F4D 530D 5052 4F4E 4B0D 5052 4F50 530D"            /* OMSPRONKPROPS */	$"5052 4F52 450D 5052 4F53 4F0D 5052 4F53"            /* PROREPROSOPROS */	$"530D 5052 4F53 540D 5052 4F53 590D 5052"            /* SPROSTPROSYPR */	$"4F54 4F0D 5052 4F55 4C0D 5052 4F57 530D"            /* OTOPROULPROWS */	$"5052 4F59 4E0D 5052 554E 540D 5052 5554"            /* PROYNPRUNTPRUT */	$"410D 5052 5945 520D 5052 5953 450D 5053"            /* APRYERPRYSEPS */	$"4555 440D 5053 4841 570D 5053 494F 4E0D"            /* EUDPSHAWPSION */	$"5053 4F41 450D 5053 4F41 490D 5053 4F41"            /* PSOAEPSOAIPSOA */	$"530D 5053 4F52 410D 5053 5943 480D 5053"            /* SPSORAPSYCHPS */	$"594F 500D 5055 4243 4F0D 5055 4245 530D"            /* YOPPUBCOPUBES */	$"5055 4249 530D 5055 4341 4E0D 5055 4345"            /* PUBISPUCANPUCE */	$"520D 5055 4345 530D 5055 434B 410D 5055"            /* RPUCESPUCKAPU */	$"434B 530D 5055 4444 590D 5055 4447 450D"            /* CKSPUDDYPUDGE */	$"5055 4449 430D 5055 444F 520D 5055 4453"            /* PUDICPUDORPUDS */	$"590D 5055 4455 530D 5055 4552 530D 5055"            /* YPUDUSPUERSPU */	$"4646 410D 5055 4646 530D 5055 4747 590D"            /* FFAPUFFSPUGGY */	$"5055 4749 4C0D 5055 4841 530D 5055 4A41"            /* PUGILPUHASPUJA */	$"480D 5055 4A41 530D 5055 4B41 530D 5055"            /* HPUJASPUKASPU */	$"4B45 440D 5055 4B45 520D 5055 4B45 530D"            /* KEDPUKERPUKES */	$"5055 4B45 590D 5055 4B4B 410D 5055 4B55"            /* PUKEYPUKKAPUKU */	$"530D 5055 4C41 4F0D 5055 4C41 530D 5055"            /* SPULAOPULASPU */	$"4C45 440D 5055 4C45 520D 5055 4C45 530D"            /* LEDPULERPULES */	$"5055 4C49 4B0D 5055 4C49 530D 5055 4C4B"            /* PULIKPULISPULK */	$"410D 5055 4C4B 530D 5055 4C4C 490D 5055"            /* APULKSPULLIPU */	$"4C4C 530D 5055 4C4C 590D 5055 4C4D 4F0D"            /* LLSPULLYPULMO */	$"5055 4C50 530D 5055 4C55 530D 5055 4D41"            /* PULPSPULUSPUMA */	$"530D 5055 4D49 450D 5055 4D50 530D 5055"            /* SPUMIEPUMPSPU */	$"4E41 530D 5055 4E43 450D 5055 4E47 410D"            /* NASPUNCEPUNGA */	$"5055 4E47 530D 5055 4E4A 490D 5055 4E4B"            /* PUNGSPUNJIPUNK */	$"410D 5055 4E4B 530D 5055 4E4B 590D 5055"            /* APUNKSPUNKYPU */	$"4E4E 590D 5055 4E54 4F0D 5055 4E54 530D"            /* NNYPUNTOPUNTS */	$"5055 4E54 590D 5055 5041 450D 5055 5041"            /* PUNTYPUPAEPUPA */	$"4C0D 5055 5041 530D 5055 5055 530D 5055"            /* LPUPASPUPUSPU */	$"5244 410D 5055 5245 440D 5055 5245 530D"            /* RDAPUREDPURES */	$"5055 5249 4E0D 5055 5249 530D 5055 524C"            /* PURINPURISPURL */	$"530D 5055 5250 590D 5055 5252 530D 5055"            /* SPURPYPURRSPU */	$"5253 590D 5055 5254 590D 5055 5345 530D"            /* RSYPURTYPUSES */	$"5055 534C 450D 5055 5353 590D 5055 5449"            /* PUSLEPUSSYPUTI */	$"440D 5055 544F 4E0D 5055 5454 490D 5055"            /* DPUTONPUTTIPU */	$"5454 4F0D 5055 5454 530D 5055 5A45 4C0D"            /* TTOPUTTSPUZEL */	$"5057 4E45 440D 5059 4154 530D 5059 4554"            /* PWNEDPYATSPYET */	$"530D 5059 4741 4C0D 5059 494E 530D 5059"            /* SPYGALPYINSPY */	$"4C4F 4E0D 5059 4E45 440D 5059 4E45 530D"            /* LONPYNEDPYNES */	$"5059 4F49 440D 5059 4F54 530D 5059 5241"            /* PYOIDPYOTSPYRA */	$"4C0D 5059 5241 4E0D 5059 5245 530D 5059"            /* LPYRANPYRESPY */	$"5245 580D 5059 5249 430D 5059 524F 530D"            /* REXPYRICPYROS */	$"5059 5845 440D 5059 5845 530D 5059 5849"            /* PYXEDPYXESPYXI */	$"450D 5059 5849 530D 505A 415A 5A0D 5141"            /* EPYXISPZAZZQA */	$"4449 530D 5141 4944 530D 5141 4A41 510D"            /* DISQAIDSQAJAQ */	$"5141 4E41 540D 5141 5049 4B0D 5149 424C"            /* QANATQAPIKQIBL */	$"410D 514F 5048 530D 514F 524D 410D 5155"            /* AQOPHSQORMAQU */	$"4144 530D 5155 4146 460D 5155 4147 530D"            /* ADSQUAFFQUAGS */	$"5155 4149 520D 5155 4149 530D 5155 414B"            /* QUAIRQUAISQUAK */	$"590D 5155 414C 450D 5155 414E 540D 5155"            /* YQUALEQUANTQU */	$"4152 450D 5155 4153 530D 5155 4154 450D"            /* AREQUASSQUATE */	$"5155 4154 530D 5155 4159 440D 5155 4159"            /* QUATSQUAYDQUAY */	$"530D 5155 4249 540D 5155 4541 4E0D 5155"            /* SQUBITQUEANQU */	$"454D 450D 5155 454E 410D 5155 4552 4E0D"            /* EMEQUENAQUERN */	$"5155 4559 4E0D 5155 4559 530D 5155 4943"            /* QUEYNQUEYSQUIC */	$"480D 5155 4944 530D 5155 4946 460D 5155"            /* HQUIDSQUIFFQU */	$"494D 530D 5155 494E 410D 5155 494E 450D"            /* IMSQUINAQUINE */	$"5155 494E 4F0D 5155 494E 530D 5155 494E"            /* QUINOQUINSQUIN */	$"540D 5155 4950 4F0D 5155 4950 530D 5155"            /* TQUIPOQUIPSQU */	$"4950 550D 5155 4952 450D 5155 4952 540D"            /* IPUQUIREQUIRT */	$"5155 4953 540D 5155 4954 530D 5155 4F41"            /* QUISTQUITSQUOA */	$"440D 5155 4F44 530D 5155 4F49 460D 5155"            /* DQUODSQUOIFQU */	$"4F49 4E0D 5155 4F49 540D 5155 4F4C 4C0D"            /* OINQUOITQUOLL */	$"5155 4F4E 4B0D 5155 4F50 530D 5155 5253"            /* QUONKQUOPSQURS */	$"480D 5155 5954 450D 5241 4241 540D 5241"            /* HQUYTERABATRA */	$"4249 430D 5241 4249 530D 5241 4345 440D"            /* BICRABISRACED */	$"5241 4345 530D 5241 4348 450D 5241 434B"            /* RACESRACHERACK */	$"530D 5241 434F 4E0D 5241 4447 450D 5241"            /* SRACONRADGERA */	$"4449 580D 5241 444F 4E0D 5241 4646 530D"            /* DIXRADONRAFFS */	$"5241 4654 530D 5241 4741 530D 5241 4744"            /* RAFTSRAGASRAGD */	$"450D 5241 4745 440D 5241 4745 450D 5241"            /* ERAGEDRAGEERA */	$"4745 520D 5241 4745 530D 5241 4747 410D"            /* GERRAGESRAGGA */	$"5241 4747 530D 5241 4747 590D 5241 4749"            /* RAGGSRAGGYRAGI */	$"530D 5241 4755 530D 5241 4845 440D 5241"            /* SRAGUSRAHEDRA */	$"4855 490D 5241 4941 530D 5241 4944 530D"            /* HUIRAIASRAIDS */	$"5241 494B 530D 5241 494C 450D 5241 494C"            /* RAIKSRAILERAIL */	$"530D 5241 494E 450D 5241 494E 530D 5241"            /* SRAINERAINSRA */	$"4952 440D 5241 4954 410D 5241 4954 530D"            /* IRDRAITARAITS */	$"5241 4A41 530D 5241 4A45 530D 5241 4B45"            /* RAJASRAJESRAKE */	$"440D 5241 4B45 450D 5241 4B45 520D 5241"            /* DRAKEERAKERRA */	$"4B45 530D 5241 4B49 410D 5241 4B49 530D"            /* KESRAKIARAKIS */	$"5241 4B55 530D 5241 4C45 530D 5241 4D41"            /* RAKUSRALESRAMA */	$"4C0D 5241 4D45 450D 5241 4D45 540D 5241"            /* LRAMEERAMETRA */	$"4D49 450D 5241 4D49 4E0D 5241 4D49 530D"            /* MIERAMINRAMIS */	$"5241 4D4D 590D 5241 4D50 530D 5241 4D55"            /* RAMMYRAMPSRAMU */	$"530D 5241 4E41 530D 5241 4E43 450D 5241"            /* SRANASRANCERA */	$"4E44 530D 5241 4E45 450D 5241 4E47 410D"            /* NDSRANEERANGA */	$"5241 4E47 490D 5241 4E47 530D 5241 4E47"            /* RANGIRANGSRANG */	$"590D 5241 4E49 440D 5241 4E49 530D 5241"            /* YRANIDRANISRA */	$"4E4B 450D 5241 4E4B 530D 5241 4E54 530D"            /* NKERANKSRANTS */	$"5241 5045 440D 5241 5045 520D 5241 5045"            /* RAPEDRAPERRAPE */	$"530D 5241 5048 450D 5241 5050 450D 5241"            /* SRAPHERAPPERA */	$"5245 440D 5241 5245 450D 5241 5245 530D"            /* REDRAREERARES */	$"5241 524B 530D 5241 5345 440D 5241 5345"            /* RARKSRASEDRASE */	$"520D 5241 5345 530D 5241 5350 530D 5241"            /* RRASESRASPSRA */	$"5353 450D 5241 5354 410D 5241 5441 4C0D"            /* SSERASTARATAL */	$"5241 5441 4E0D 5241 5441 530D 5241 5443"            /* RATANRATASRATC */	$"480D 5241 5445 440D 5241 5445 4C0D 5241"            /* HRATEDRATELRA */	$"5445 520D 5241 5445 530D 5241 5448 410D"            /* TERRATESRATHA */	$"5241 5448 450D 5241 5448 530D 5241 544F"            /* RATHERATHSRATO */	$"4F0D 5241 544F 530D 5241 5455 530D 5241"            /* ORATOSRATUSRA */	$"554E 530D 5241 5550 4F0D 5241 5645 440D"            /* UNSRAUPORAVED */	$"5241 5645 4C0D 5241 5645 520D 5241 5645"            /* RAVELRAVERRAVE */	$"530D 5241 5645 590D 5241 5649 4E0D 5241"            /* SRAVEYRAVINRA */	$"5745 520D 5241 5749 4E0D 5241 574C 590D"            /* WERRAWINRAWLY */	$"5241 574E 530D 5241 5845 440D 5241 5845"            /* RAWNSRAXEDRAXE */	$"530D 5241 5941 480D 5241 5941 530D 5241"            /* SRAYAHRAYASRA */	$"5945 440D 5241 594C 450D 5241 594E 450D"            /* YEDRAYLERAYNE */	$"5241 5A45 440D 5241 5A45 450D 5241 5A45"            /* RAZEDRAZEERAZE */	$"520D 5241 5A45 530D 5241 5A4F 4F0D 5245"            /* RRAZESRAZOORE */	$"4144 440D 5245 4144 530D 5245 4149 530D"            /* ADDREADSREAIS */	$"5245 414B 530D 5245 414C 4F0D 5245 414C"            /* REAKSREALOREAL */	$"530D 5245 414D 450D 5245 414D 530D 5245"            /* SREAMEREAMSRE */	$"414D 590D 5245 414E 530D 5245 4150 530D"            /* AMYREANSREAPS */	$"5245 4152 530D 5245 4153 540D 5245 4154"            /* REARSREASTREAT */	$"410D 5245 4154 450D 5245 4156 450D 5245"            /* AREATEREAVERE */	$"4242 450D 5245 4245 430D 5245 4249 440D"            /* BBEREBECREBID */	$"5245 4249 540D 5245 424F 500D 5245 4255"            /* REBITREBOPREBU */	$"590D 5245 4341 4C0D 5245 4343 450D 5245"            /* YRECALRECCERE */	$"4343 4F0D 5245 4343 590D 5245 4349 540D"            /* CCORECCYRECIT */	$"5245 434B 530D 5245 434F 4E0D 5245 4354"            /* RECKSRECONRECT */	$"410D 5245 4354 490D 5245 4354 4F0D 5245"            /* ARECTIRECTORE */	$"4441 4E0D 5245 4444 530D 5245 4444 590D"            /* DANREDDSREDDY */	$"5245 4445 440D 5245 4445 530D 5245 4449"            /* REDEDREDESREDI */	$"410D 5245 4449 440D 5245 4449 500D 5245"            /* AREDIDREDIPRE */	$"444C 590D 5245 444F 4E0D 5245 444F 530D"            /* DLYREDONREDOS */	$"5245 444F 580D 5245 4452 590D 5245 4455"            /* REDOXREDRYREDU */	$"420D 5245 4455 580D 5245 4459 450D 5245"            /* BREDUXREDYERE */	$"4543 480D 5245 4544 450D 5245 4544 530D"            /* ECHREEDEREEDS */	$"5245 4546 530D 5245 4546 590D 5245 454B"            /* REEFSREEFYREEK */	$"530D 5245 454B 590D 5245 454C 530D 5245"            /* SREEKYREELSRE */	$"454E 530D 5245 4553 540D 5245 4556 450D"            /* ENSREESTREEVE */	$"5245 4645 440D 5245 4645 4C0D 5245 4646"            /* REFEDREFELREFF */	$"4F0D 5245 4649 530D 5245 4649 580D 5245"            /* OREFISREFIXRE */	$"464C 590D 5245 4652 590D 5245 4741 520D"            /* FLYREFRYREGAR */	$"5245 4745 530D 5245 4747 4F0D 5245 4749"            /* REGESREGGOREGI */	$"450D 5245 474D 410D 5245 474E 410D 5245"            /* EREGMAREGNARE */	$"474F 530D 5245 4755 520D 5245 4845 4D0D"            /* GOSREGURREHEM */	$"5245 4946 530D 5245 4946 590D 5245 494B"            /* REIFSREIFYREIK */	$"490D 5245 494B 530D 5245 494E 4B0D 5245"            /* IREIKSREINKRE */	$"494E 530D 5245 4952 440D 5245 4953 540D"            /* INSREIRDREIST */	$"5245 4956 450D 5245 4A49 470D 5245 4A4F"            /* REIVEREJIGREJO */	$"4E0D 5245 4B45 440D 5245 4B45 530D 5245"            /* NREKEDREKESRE */	$"4B45 590D 5245 4C45 540D 5245 4C49 450D"            /* KEYRELETRELIE */	$"5245 4C49 540D 5245 4C4C 4F0D 5245 4D41"            /* RELITRELLOREMA */	$"4E0D 5245 4D41 500D 5245 4D45 4E0D 5245"            /* NREMAPREMENRE */	$"4D45 540D 5245 4D45 580D 5245 4D49 580D"            /* METREMEXREMIX */	$"5245 4E41 590D 5245 4E44 530D 5245 4E45"            /* RENAYRENDSRENE */	$"590D 5245 4E47 410D 5245 4E49 470D 5245"            /* YRENGARENIGRE */	$"4E49 4E0D 5245 4E4E 450D 5245 4E4F 530D"            /* NINRENNERENOS */	$"5245 4E54 450D 5245 4E54 530D 5245 4F49"            /* RENTERENTSREOI */	$"4C0D 5245 4F52 470D 5245 5045 470D 5245"            /* LREORGREPEGRE */	$"5049 4E0D 5245 504C 410D 5245 504F 530D"            /* PINREPLAREPOS */	$"5245 504F 540D 5245 5050 530D 5245 5052"            /* REPOTREPPSREPR */	$"4F0D 5245 5241 4E0D 5245 5249 470D 5245"            /* ORERANRERIGRE */	$"5341 540D 5245 5341 570D 5245 5341 590D"            /* SATRESAWRESAY */	$"5245 5345 450D 5245 5345 530D 5245 5345"            /* RESEERESESRESE */	$"570D 5245 5349 440D 5245 5349 540D 5245"            /* WRESIDRESITRE */	$"534F 440D 5245 534F 570D 5245 5354 4F0D"            /* SODRESOWRESTO */	$"5245 5354 530D 5245 5354 590D 5245 5355"            /* RESTSRESTYRESU */	$"530D 5245 5441 470D 5245 5441 580D 5245"            /* SRETAGRETAXRE */	$"5445 4D0D 5245 5449 410D 5245 5449 450D"            /* TEMRETIARETIE */	$"5245 544F 580D 5245 5645 540D 5245 5649"            /* RETOXREVETREVI */	$"450D 5245 5741 4E0D 5245 5741 580D 5245"            /* EREWANREWAXRE */	$"5745 440D 5245 5745 540D 5245 5749 4E0D"            /* WEDREWETREWIN */	$"5245 574F 4E0D 5245 5754 480D 5245 5845"            /* REWONREWTHREXE */	$"530D 5245 5A45 530D 5248 4541 530D 5248"            /* SREZESRHEASRH */	$"454D 450D 5248 4555 4D0D 5248 4945 530D"            /* EMERHEUMRHIES */	$"5248 494D 450D 5248 494E 450D 5248 4F44"            /* RHIMERHINERHOD */	$"590D 5248 4F4D 420D 5248 4F4E 450D 5248"            /* YRHOMBRHONERH */	$"554D 420D 5248 594E 450D 5248 5954 410D"            /* UMBRHYNERHYTA */	$"5249 4144 530D 5249 414C 530D 5249 414E"            /* RIADSRIALSRIAN */	$"540D 5249 4154 410D 5249 4241 530D 5249"            /* TRIATARIBASRI */	$"4242 590D 5249 4245 530D 5249 4345 440D"            /* BBYRIBESRICED */	$"5249 4345 520D 5249 4345 530D 5249 4345"            /* RICERRICESRICE */	$"590D 5249 4348 540D 5249 4349 4E0D 5249"            /* YRICHTRICINRI */	$"434B 530D 5249 4445 530D 5249 4447 590D"            /* CKSRIDESRIDGY */	$"5249 4449 430D 5249 454C 530D 5249 454D"            /* RIDICRIELSRIEM */	$"530D 5249 4556 450D 5249 4645 520D 5249"            /* SRIEVERIFERRI */	$"4646 530D 5249 4654 450D 5249 4654 530D"            /* FFSRIFTERIFTS */	$"5249 4654 590D 5249 4747 530D 5249 474F"            /* RIFTYRIGGSRIGO */	$"4C0D 5249 4C45 440D 5249 4C45 530D 5249"            /* LRILEDRILESRI */	$"4C45 590D 5249 4C4C 450D 5249 4C4C 530D"            /* LEYRILLERILLS */	$"5249 4D41 450D 5249 4D45 440D 5249 4D45"            /* RIMAERIMEDRIME */	$"520D 5249 4D45 530D 5249 4D55 530D 5249"            /* RRIMESRIMUSRI */	$"4E44 530D 5249 4E44 590D 5249 4E45 530D"            /* NDSRINDYRINES */	$"5249 4E47 530D 5249 4E4B 530D 5249 4F4A"            /* RINGSRINKSRIOJ */	$"410D 5249 4F54 530D 5249 5045 440D 5249"            /* ARIOTSRIPEDRI */	$"5045 530D 5249 5050 530D 5249 5345 530D"            /* PESRIPPSRISES */	$"5249 5348 490D 5249 534B 530D 5249 5350"            /* RISHIRISKSRISP */	$"530D 5249 5355 530D 5249 5445 530D 5249"            /* SRISUSRITESRI */	$"5454 530D 5249 545A 590D 5249 5641 530D"            /* TTSRITZYRIVAS */	$"5249 5645 440D 5249 5645 4C0D 5249 5645"            /* RIVEDRIVELRIVE */	$"4E0D 5249 5645 530D 5249 5941 4C0D 5249"            /* NRIVESRIYALRI */	$"5A41 530D 524F 4144 530D 524F 414D 530D"            /* ZASROADSROAMS */	$"524F 414E 530D 524F 4152 530D 524F 4152"            /* ROANSROARSROAR */	$"590D 524F 4154 450D 524F 4245 440D 524F"            /* YROATEROBEDRO */	$"4245 530D 524F 424C 450D 524F 434B 530D"            /* BESROBLEROCKS */	$"524F 4445 440D 524F 4445 530D 524F 4755"            /* RODEDRODESROGU */	$"590D 524F 4845 530D 524F 4944 530D 524F"            /* YROHESROIDSRO */	$"494C 530D 524F 494C 590D 524F 494E 530D"            /* ILSROILYROINS */	$"524F 4953 540D 524F 4A41 4B0D 524F 4A49"            /* ROISTROJAKROJI */	$"530D 524F 4B45 440D 524F 4B45 520D 524F"            /* SROKEDROKERRO */	$"4B45 530D 524F 4C41 470D 524F 4C45 530D"            /* KESROLAGROLES */	$"524F 4C46 530D 524F 4C4C 530D 524F 4D41"            /* ROLFSROLLSROMA */	$"4C0D 524F 4D41 4E0D 524F 4D45 4F0D 524F"            /* LROMANROMEORO */	$"4D50 530D 524F 4E44 450D 524F 4E44 4F0D"            /* MPSRONDERONDO */	$"524F 4E45 4F0D 524F 4E45 530D 524F 4E49"            /* RONEORONESRONI */	$"4E0D 524F 4E4E 450D 524F 4E54 450D 524F"            /* NRONNERONTERO */	$"4E54 530D 524F 4F44 530D 524F 4F46 530D"            /* NTSROODSROOFS */	$"524F 4F46 590D 524F 4F4B 530D 524F 4F4B"            /* ROOFYROOKSROOK */	$"590D 524F 4F4D 530D 524F 4F4E 530D 524F"            /* YROOMSROONSRO */	$"4F50 530D 524F 4F50 590D 524F 4F53 410D"            /* OPSROOPYROOSA */	$"524F 4F53 450D 524F 4F54 530D 524F 4F54"            /* ROOSEROOTSROOT */	$"590D 524F 5045 440D 524F 5045 520D 524F"            /* YROPEDROPERRO */	$"5045 530D 524F 5045 590D 524F 5155 450D"            /* PESROPEYROQUE */	$"524F 5241 4C0D 524F 5245 530D 524F 5249"            /* RORALRORESRORI */	$"430D 524F 5249 440D 524F 5249 450D 524F"            /* CRORIDRORIERO */	$"5254 530D 524F 5254 590D 524F 5345 440D"            /* RTSRORTYROSED */	$"524F 5345 530D 524F 5345 540D 524F 5348"            /* ROSESROSETROSH */	$"490D 524F 5349 4E0D 524F 5349 540D 524F"            /* IROSINROSITRO */	$"5354 490D 524F 5354 530D 524F 5441 4C0D"            /* STIROSTSROTAL */	$"524F 5441 4E0D 524F 5441 530D 524F 5443"            /* ROTANROTASROTC */	$"480D 524F 5445 440D 524F 5445 530D 524F"            /* HROTEDROTESRO */	$"5449 530D 524F 544C 530D 524F 544F 4E0D"            /* TISROTLSROTON */	$"524F 544F 530D 524F 5454 450D 524F 5545"            /* ROTOSROTTEROUE */	$"4E0D 524F 5545 530D 524F 554C 450D 524F"            /* NROUESROULERO */	$"554C 530D 524F 554D 530D 524F 5550 530D"            /* ULSROUMSROUPS */	$"524F 5550 590D 524F 5553 540D 524F 5554"            /* ROUPYROUSTROUT */	$"480D 524F 5554 530D 524F 5645 440D 524F"            /* HROUTSROVEDRO */	$"5645 4E0D 524F 5645 530D 524F 5741 4E0D"            /* VENROVESROWAN */	$"524F 5745 440D 524F 5745 4C0D 524F 5745"            /* ROWEDROWELROWE */	$"4E0D 524F 5749 450D 524F 574D 450D 524F"            /* NROWIEROWMERO */	$"574E 440D 524F 5754 480D 524F 5754 530D"            /* WNDROWTHROWTS */	$"524F 594E 450D 524F 5953 540D 524F 5A45"            /* ROYNEROYSTROZE */	$"540D 524F 5A49 540D 5255 414E 410D 5255"            /* TROZITRUANARU */	$"4241 490D 5255 4242 590D 5255 4245 4C0D"            /* BAIRUBBYRUBEL */	$"5255 4245 530D 5255 4249 4E0D 5255 424C"            /* RUBESRUBINRUBL */	$"450D 5255 424C 490D 5255 4255 530D 5255"            /* ERUBLIRUBUSRU */	$"4348 450D 5255 434B 530D 5255 4441 530D"            /* CHERUCKSRUDAS */	$"5255 4444 530D 5255 4445 530D 5255 4449"            /* RUDDSRUDESRUDI */	$"450D 5255 4449 530D 5255 4544 410D 5255"            /* ERUDISRUEDARU */	$"4552 530D 5255 4646 450D 5255 4646 530D"            /* ERSRUFFERUFFS */	$"5255 4741 450D 5255 4741 4C0D 5255 4747"            /* RUGAERUGALRUGG */	$"590D 5255 494E 470D 5255 494E 530D 5255"            /* YRUINGRUINSRU */	$"4B48 530D 5255 4C45 440D 5255 4C45 530D"            /* KHSRULEDRULES */	$"5255 4D41 4C0D 5255 4D42 4F0D 5255 4D45"            /* RUMALRUMBORUME */	$"4E0D 5255 4D45 530D 5255 4D4C 590D 5255"            /* NRUMESRUMLYRU */	$"4D4D 590D 5255 4D50 4F0D 5255 4D50 530D"            /* MMYRUMPORUMPS */	$"5255 4D50 590D 5255 4E43 480D 5255 4E44"            /* RUMPYRUNCHRUND */	$"530D 5255 4E45 440D 5255 4E45 530D 5255"            /* SRUNEDRUNESRU */	$"4E47 530D 5255 4E49 430D 5255 4E4E 590D"            /* NGSRUNICRUNNY */	$"5255 4E54 530D 5255 4E54 590D 5255 5049"            /* RUNTSRUNTYRUPI */	$"410D 5255 5250 530D 5255 5255 530D 5255"            /* ARURPSRURUSRU */	$"5341 530D 5255 5345 530D 5255 5348 590D"            /* SASRUSESRUSHY */	$"5255 534B 530D 5255 534D 410D 5255 5353"            /* RUSKSRUSMARUSS */	$"450D 5255 5354 530D 5255 5448 530D 5255"            /* ERUSTSRUTHSRU */	$"5449 4E0D 5255 5454 590D 5259 414C 530D"            /* TINRUTTYRYALS */	$"5259 4241 540D 5259 4B45 440D 5259 4B45"            /* RYBATRYKEDRYKE */	$"530D 5259 4D4D 450D 5259 4E44 530D 5259"            /* SRYMMERYNDSRY */	$"4F54 530D 5259 5045 520D 5341 4147 530D"            /* OTSRYPERSAAGS */	$"5341 4241 4C0D 5341 4245 440D 5341 4245"            /* SABALSABEDSABE */	$"520D 5341 4245 530D 5341 4248 410D 5341"            /* RSABESSABHASA */	$"4249 4E0D 5341 4249 520D 5341 424C 450D"            /* BINSABIRSABLE */	$"5341 424F 540D 5341 4252 410D 5341 4252"            /* SABOTSABRASABR */	$"450D 5341 434B 530D 5341 4352 410D 5341"            /* ESACKSSACRASA */	$"4444 4F0D 5341 4445 530D 5341 4448 450D"            /* DDOSADESSADHE */	$"5341 4448 550D 5341 4449 530D 5341 444F"            /* SADHUSADISSADO */	$"530D 5341 445A 410D 5341 4645 440D 5341"            /* SSADZASAFEDSA */	$"4645 530D 5341 4741 530D 5341 4745 520D"            /* FESSAGASSAGER */	$"5341 4745 530D 5341 4747 590D 5341 474F"            /* SAGESSAGGYSAGO */	$"530D 5341 4755 4D0D 5341 4845 420D 5341"            /* SSAGUMSAHEBSA */	$"4849 420D 5341 4943 450D 5341 4943 4B0D"            /* HIBSAICESAICK */	$"5341 4943 530D 5341 4944 530D 5341 4947"            /* SAICSSAIDSSAIG */	$"410D 5341 494C 530D 5341 494D 530D 5341"            /* ASAILSSAIMSSA */	$"494E 450D 5341 494E 530D 5341 4952 530D"            /* INESAINSSAIRS */	$"5341 4953 540D 5341 4954 480D 5341 4A4F"            /* SAISTSAITHSAJO */	$"550D 5341 4B41 490D 5341 4B45 520D 5341"            /* USAKAISAKERSA */	$"4B45 530D 5341 4B49 410D 5341 4B49 530D"            /* KESSAKIASAKIS */	$"5341 4B54 490D 5341 4C41 4C0D 5341 4C41"            /* SAKTISALALSALA */	$"540D 5341 4C45 500D 5341 4C45 530D 5341"            /* TSALEPSALESSA */	$"4C45 540D 5341 4C49 430D 5341 4C49 580D"            /* LETSALICSALIX */	$"5341 4C4C 450D 5341 4C4D 490D 5341 4C4F"            /* SALLESALMISALO */	$"4C0D 5341 4C4F 500D 5341 4C50 410D 5341"            /* LSALOPSALPASA */	$"4C50 530D 5341 4C53 450D 5341 4C54 4F0D"            /* LPSSALSESALTO */	$"5341 4C54 530D 5341 4C55 450D 5341 4C55"            /* SALTSSALUESALU */	$"540D 5341 4D41 4E0D 5341 4D41 530D 5341"            /* TSAMANSAMASSA */	$"4D42 410D 5341 4D42 4F0D 5341 4D45 4B0D"            /* MBASAMBOSAMEK */	$"5341 4D45 4C0D 5341 4D45 4E0D 5341 4D45"            /* SAMELSAMENSAME */	$"530D 5341 4D45 590D 5341 4D46 550D 5341"            /* SSAMEYSAMFUSA */	$"4D4D 590D 5341 4D50 490D 5341 4D50 530D"            /* MMYSAMPISAMPS */	$"5341 4E44 530D 5341 4E45 440D 5341 4E45"            /* SANDSSANEDSANE */	$"530D 5341 4E47 410D 5341 4E47 480D 5341"            /* SSANGASANGHSA */	$"4E47 4F0D 5341 4E47 530D 5341 4E4B 4F0D"            /* NGOSANGSSANKO */	$"5341 4E53 410D 5341 4E54 4F0D 5341 4E54"            /* SANSASANTOSANT */	$"530D 5341 4F4C 410D 5341 5041 4E0D 5341"            /* SSAOLASAPANSA */	$"5049 440D 5341 504F 520D 5341 5241 4E0D"            /* PIDSAPORSARAN */	$"5341 5244 530D 5341 5245 440D 5341 5245"            /* SARDSSAREDSARE */	$"450D 5341 5247 450D 5341 5247 4F0D 5341"            /* ESARGESARGOSA */	$"5249 4E0D 5341 5249 530D 5341 524B 530D"            /* RINSARISSARKS */	$"5341 524B 590D 5341 524F 440D 5341 524F"            /* SARKYSARODSARO */	$"530D 5341 5255 530D 5341 5345 520D 5341"            /* SSARUSSASERSA */	$"5349 4E0D 5341 5353 450D 5341 5441 490D"            /* SINSASSESATAI */	$"5341 5441 590D 5341 5445 440D 5341 5445"            /* SATAYSATEDSATE */	$"4D0D 5341 5445 530D 5341 5449 530D 5341"            /* MSATESSATISSA */	$"5542 410D 5341 5543 480D 5341 5547 480D"            /* UBASAUCHSAUGH */	$"5341 554C 530D 5341 554C 540D 5341 554E"            /* SAULSSAULTSAUN */	$"540D 5341 5552 590D 5341 5554 530D 5341"            /* TSAURYSAUTSSA */	$"5645 440D 5341 5645 520D 5341 5645 530D"            /* VEDSAVERSAVES */	$"5341 5645 590D 5341 5649 4E0D 5341 5741"            /* SAVEYSAVINSAWA */	$"480D 5341 5745 440D 5341 5745 520D 5341"            /* HSAWEDSAWERSA */	$"5845 530D 5341 5945 440D 5341 5945 520D"            /* XESSAYEDSAYER */	$"5341 5949 440D 5341 594E 450D 5341 594F"            /* SAYIDSAYNESAYO */	$"4E0D 5341 5953 540D 5341 5A45 530D 5343"            /* NSAYSTSAZESSC */	$"4142 530D 5343 4144 530D 5343 4146 460D"            /* ABSSCADSSCAFF */	$"5343 4147 530D 5343 4149 4C0D 5343 414C"            /* SCAGSSCAILSCAL */	$"410D 5343 414C 4C0D 5343 414D 530D 5343"            /* ASCALLSCAMSSC */	$"414E 440D 5343 414E 530D 5343 4150 410D"            /* ANDSCANSSCAPA */	$"5343 4150 450D 5343 4150 490D 5343 4152"            /* SCAPESCAPISCAR */	$"500D 5343 4152 530D 5343 4152 540D 5343"            /* PSCARSSCARTSC */	$"4154 480D 5343 4154 530D 5343 4154 540D"            /* ATHSCATSSCATT */	$"5343 4155 440D 5343 4155 500D 5343 4155"            /* SCAUDSCAUPSCAU */	$"520D 5343 4157 530D 5343 4541 540D 5343"            /* RSCAWSSCEATSC */	$"454E 410D 5343 454E 440D 5343 4841 560D"            /* ENASCENDSCHAV */	$"5343 484D 4F0D 5343 4855 4C0D 5343 4857"            /* SCHMOSCHULSCHW */	$"410D 5343 4C49 4D0D 5343 4F44 590D 5343"            /* ASCLIMSCODYSC */	$"4F47 530D 5343 4F4F 470D 5343 4F4F 540D"            /* OGSSCOOGSCOOT */	$"5343 4F50 410D 5343 4F50 530D 5343 4F54"            /* SCOPASCOPSSCOT */	$"530D 5343 4F55 470D 5343 4F55 500D 5343"            /* SSCOUGSCOUPSC */	$"4F57 500D 5343 4F57 530D 5343 5241 420D"            /* OWPSCOWSSCRAB */	$"5343 5241 450D 5343 5241 470D 5343 5241"            /* SCRAESCRAGSCRA */	$"4E0D 5343 5241 540D 5343 5241 570D 5343"            /* NSCRATSCRAWSC */	$"5241 590D 5343 5249 4D0D 5343 5249 500D"            /* RAYSCRIMSCRIP */	$"5343 524F 420D 5343 524F 440D 5343 524F"            /* SCROBSCRODSCRO */	$"470D 5343 524F 570D 5343 5544 490D 5343"            /* GSCROWSCUDISC */	$"5544 4F0D 5343 5544 530D 5343 5546 460D"            /* UDOSCUDSSCUFF */	$"5343 5546 540D 5343 5547 530D 5343 554C"            /* SCUFTSCUGSSCUL */	$"4B0D 5343 554C 4C0D 5343 554C 500D 5343"            /* KSCULLSCULPSC */	$"554C 530D 5343 554D 530D 5343 5550 530D"            /* ULSSCUMSSCUPS */	$"5343 5552 460D 5343 5552 530D 5343 5553"            /* SCURFSCURSSCUS */	$"450D 5343 5554 410D 5343 5554 450D 5343"            /* ESCUTASCUTESC */	$"5554 530D 5343 555A 5A0D 5343 5945 530D"            /* UTSSCUZZSCYES */	$"5344 4159 4E0D 5344 4549 4E0D 5345 414C"            /* SDAYNSDEINSEAL */	$"530D 5345 414D 450D 5345 414D 530D 5345"            /* SSEAMESEAMSSE */	$"414D 590D 5345 414E 530D 5345 4152 450D"            /* AMYSEANSSEARE */	$"5345 4152 530D 5345 4153 450D 5345 4154"            /* SEARSSEASESEAT */	$"530D 5345 415A 450D 5345 4255 4D0D 5345"            /* SSEAZESEBUMSE */	$"4343 4F0D 5345 4348 530D 5345 4354 530D"            /* CCOSECHSSECTS */	$"5345 4445 520D 5345 4445 530D 5345 4447"            /* SEDERSEDESSEDG */	$"450D 5345 4447 590D 5345 4455 4D0D 5345"            /* ESEDGYSEDUMSE */	$"4544 530D 5345 454B 530D 5345 454C 440D"            /* EDSSEEKSSEELD */	$"5345 454C 530D 5345 454C 590D 5345 454D"            /* SEELSSEELYSEEM */	$"530D 5345 4550 530D 5345 4550 590D 5345"            /* SSEEPSSEEPYSE */	$"4552 530D 5345 4645 520D 5345 4741 520D"            /* ERSSEFERSEGAR */	$"5345 474E 490D 5345 474E 4F0D 5345 474F"            /* SEGNISEGNOSEGO */	$"4C0D 5345 474F 530D 5345 4852 490D 5345"            /* LSEGOSSEHRISE */	$"4946 530D 5345 494C 530D 5345 494E 450D"            /* IFSSEILSSEINE */	$"5345 4952 530D 5345 4953 450D 5345 4953"            /* SEIRSSEISESEIS */	$"4D0D 5345 4954 590D 5345 495A 410D 5345"            /* MSEITYSEIZASE */	$"4B4F 530D 5345 4B54 530D 5345 4C41 480D"            /* KOSSEKTSSELAH */	$"5345 4C45 530D 5345 4C46 530D 5345 4C4C"            /* SELESSELFSSELL */	$"410D 5345 4C4C 450D 5345 4C4C 530D 5345"            /* ASELLESELLSSE */	$"4C56 410D 5345 4D45 450D 5345 4D45 530D"            /* LVASEMEESEMES */	$"5345 4D49 450D 5345 4D49 530D 5345 4E41"            /* SEMIESEMISSENA */	$"530D 5345 4E44 530D 5345 4E45 530D 5345"            /* SSENDSSENESSE */	$"4E47 490D 5345 4E4E 410D 5345 4E4F 520D"            /* NGISENNASENOR */	$"5345 4E53 410D 5345 4E53 490D 5345 4E54"            /* SENSASENSISENT */	$"450D 5345 4E54 490D 5345 4E54 530D 5345"            /* ESENTISENTSSE */	$"4E56 590D 5345 4E5A 410D 5345 5041 440D"            /* NVYSENZASEPAD */	$"5345 5041 4C0D 5345 5049 430D 5345 504F"            /* SEPALSEPICSEPO */	$"590D 5345 5054 410D 5345 5054 530D 5345"            /* YSEPTASEPTSSE */	$"5241 430D 5345 5241 490D 5345 5241 4C0D"            /* RACSERAISERAL */	$"5345 5245 440D 5345 5245 520D 5345 5245"            /* SEREDSERERSERE */	$"530D 5345 5246 530D 5345 5247 450D 5345"            /* SSERFSSERGESE */	$"5249 430D 5345 5249 4E0D 5345 524B 530D"            /* RICSERINSERKS */	$"5345 524F 4E0D 5345 524F 570D 5345 5252"            /* SERONSEROWSERR */	$"410D 5345 5252 450D 5345 5252 530D 5345"            /* ASERRESERRSSE */	$"5252 590D 5345 5256 4F0D 5345 5345 590D"            /* RRYSERVOSESEY */	$"5345 5353 410D 5345 5441 450D 5345 5441"            /* SESSASETAESETA */	$"4C0D 5345 544F 4E0D 5345 5454 530D 5345"            /* LSETONSETTSSE */	$"5741 4E0D 5345 5741 520D 5345 5745 440D"            /* WANSEWARSEWED */	$"5345 5745 4C0D 5345 5745 4E0D 5345 5749"            /* SEWELSEWENSEWI */	$"4E0D 5345 5845 440D 5345 5845 520D 5345"            /* NSEXEDSEXERSE */	$"5845 530D 5345 5854 4F0D 5345 5854 530D"            /* XESSEXTOSEXTS */	$"5345 5945 4E0D 5348 4144 530D 5348 4147"            /* SEYENSHADSSHAG */	$"530D 5348 4148 530D 5348 414B 4F0D 5348"            /* SSHAHSSHAKOSH */	$"414B 540D 5348 414C 4D0D 5348 414C 590D"            /* AKTSHALMSHALY */	$"5348 414D 410D 5348 414D 530D 5348 414E"            /* SHAMASHAMSSHAN */	$"440D 5348 414E 530D 5348 4150 530D 5348"            /* DSHANSSHAPSSH */	$"4152 4E0D 5348 4153 480D 5348 4155 4C0D"            /* ARNSHASHSHAUL */	$"5348 4157 4D0D 5348 4157 4E0D 5348 4157"            /* SHAWMSHAWNSHAW */	$"530D 5348 4159 410D 5348 4159 530D 5348"            /* SSHAYASHAYSSH */	$"4348 490D 5348 4541 460D 5348 4541 4C0D"            /* CHISHEAFSHEAL */	$"5348 4541 530D 5348 4544 530D 5348 4545"            /* SHEASSHEDSSHEE */	$"4C0D 5348 454E 440D 5348 454E 540D 5348"            /* LSHENDSHENTSH */	$"454F 4C0D 5348 4552 440D 5348 4552 450D"            /* EOLSHERDSHERE */	$"5348 4552 4F0D 5348 4554 530D 5348 4556"            /* SHEROSHETSSHEV */	$"410D 5348 4557 4E0D 5348 4557 530D 5348"            /* ASHEWNSHEWSSH */	$"4941 490D 5348 4945 4C0D 5348 4945 520D"            /* IAISHIELSHIER */	$"5348 4945 530D 5348 494C 4C0D 5348 494C"            /* SHIESSHILLSHIL */	$"590D 5348 494D 530D 5348 494E 530D 5348"            /* YSHIMSSHINSSH */	$"4950 530D 5348 4952 520D 5348 4952 530D"            /* IPSSHIRRSHIRS */	$"5348 4953 480D 5348 4953 4F0D 5348 4953"            /* SHISHSHISOSHIS */	$"540D 5348 4954 450D 5348 4954 530D 5348"            /* TSHITESHITSSH */	$"4955 520D 5348 4956 410D 5348 4956 450D"            /* IURSHIVASHIVE */	$"5348 4956 530D 5348 4C45 500D 5348 4C55"            /* SHIVSSHLEPSHLU */	$"420D 5348 4D45 4B0D 5348 4D4F 450D 5348"            /* BSHMEKSHMOESH */	$"4F41 540D 5348 4F45 440D 5348 4F45 520D"            /* OATSHOEDSHOER */	$"5348 4F45 530D 5348 4F47 490D 5348 4F47"            /* SHOESSHOGISHOG */	$"530D 5348 4F4A 490D 5348 4F4A 4F0D 5348"            /* SSHOJISHOJOSH */	$"4F4C 410D 5348 4F4F 4C0D 5348 4F4F 4E0D"            /* OLASHOOLSHOON */	$"5348 4F4F 530D 5348 4F50 450D 5348 4F50"            /* SHOOSSHOPESHOP */	$"530D 5348 4F52 4C0D 5348 4F54 450D 5348"            /* SSHORLSHOTESH */	$"4F54 530D 5348 4F54 540D 5348 4F57 440D"            /* OTSSHOTTSHOWD */	$"5348 4F57 530D 5348 4F59 550D 5348 5245"            /* SHOWSSHOYUSHRE */	$"440D 5348 5249 530D 5348 524F 570D 5348"            /* DSHRISSHROWSH */	$"5449 4B0D 5348 5455 4D0D 5348 5455 500D"            /* TIKSHTUMSHTUP */	$"5348 554C 450D 5348 554C 4E0D 5348 554C"            /* SHULESHULNSHUL */	$"530D 5348 554E 530D 5348 5552 410D 5348"            /* SSHUNSSHURASH */	$"5554 450D 5348 5554 530D 5348 5741 530D"            /* UTESHUTSSHWAS */	$"5348 5945 520D 5349 414C 530D 5349 4242"            /* SHYERSIALSSIBB */	$"530D 5349 4259 4C0D 5349 4345 530D 5349"            /* SSIBYLSICESSI */	$"4348 540D 5349 434B 4F0D 5349 434B 530D"            /* CHTSICKOSICKS */	$"5349 434B 590D 5349 4441 530D 5349 4445"            /* SICKYSIDASSIDE */	$"440D 5349 4445 520D 5349 4445 530D 5349"            /* DSIDERSIDESSI */	$"4448 410D 5349 4448 450D 5349 444C 450D"            /* DHASIDHESIDLE */	$"5349 454C 440D 5349 454E 530D 5349 454E"            /* SIELDSIENSSIEN */	$"540D 5349 4554 480D 5349 4555 520D 5349"            /* TSIETHSIEURSI */	$"4654 530D 5349 4748 530D 5349 4749 4C0D"            /* FTSSIGHSSIGIL */	$"5349 474C 410D 5349 474E 410D 5349 474E"            /* SIGLASIGNASIGN */	$"530D 5349 4A4F 530D 5349 4B41 530D 5349"            /* SSIJOSSIKASSI */	$"4B45 520D 5349 4B45 530D 5349 4C44 530D"            /* KERSIKESSILDS */	$"5349 4C45 440D 5349 4C45 4E0D 5349 4C45"            /* SILEDSILENSILE */	$"520D 5349 4C45 530D 5349 4C45 580D 5349"            /* RSILESSILEXSI */	$"4C4B 530D 5349 4C4C 530D 5349 4C4F 530D"            /* LKSSILLSSILOS */	$"5349 4C54 530D 5349 4C54 590D 5349 4C56"            /* SILTSSILTYSILV */	$"410D 5349 4D41 520D 5349 4D41 530D 5349"            /* ASIMARSIMASSI */	$"4D42 410D 5349 4D49 530D 5349 4D50 530D"            /* MBASIMISSIMPS */	$"5349 4D55 4C0D 5349 4E44 530D 5349 4E45"            /* SIMULSINDSSINE */	$"440D 5349 4E45 530D 5349 4E47 530D 5349"            /* DSINESSINGSSI */	$"4E48 530D 5349 4E4B 530D 5349 4E4B 590D"            /* NHSSINKSSINKY */	$"5349 4E55 530D 5349 5045 440D 5349 5045"            /* SINUSSIPEDSIPE */	$"530D 5349 5050 590D 5349 5245 440D 5349"            /* SSIPPYSIREDSI */	$"5245 450D 5349 5245 530D 5349 5249 480D"            /* REESIRESSIRIH */	$"5349 5249 530D 5349 524F 430D 5349 5252"            /* SIRISSIROCSIRR */	$"410D 5349 5255 500D 5349 5341 4C0D 5349"            /* ASIRUPSISALSI */	$"5345 530D 5349 5354 410D 5349 5354 530D"            /* SESSISTASISTS */	$"5349 5441 520D 5349 5445 440D 5349 5445"            /* SITARSITEDSITE */	$"530D 5349 5448 450D 5349 544B 410D 5349"            /* SSITHESITKASI */	$"5455 500D 5349 5455 530D 5349 5645 520D"            /* TUPSITUSSIVER */	$"5349 5845 520D 5349 5845 530D 5349 584D"            /* SIXERSIXESSIXM */	$"4F0D 5349 5854 450D 5349 5A41 520D 5349"            /* OSIXTESIZARSI */	$"5A45 440D 5349 5A45 4C0D 5349 5A45 520D"            /* ZEDSIZELSIZER */	$"5349 5A45 530D 534B 4147 530D 534B 4149"            /* SIZESSKAGSSKAI */	$"4C0D 534B 414C 440D 534B 414E 4B0D 534B"            /* LSKALDSKANKSK */	$"4152 540D 534B 4154 530D 534B 4154 540D"            /* ARTSKATSSKATT */	$"534B 4157 530D 534B 4541 4E0D 534B 4541"            /* SKAWSSKEANSKEA */	$"520D 534B 4544 530D 534B 4545 440D 534B"            /* RSKEDSSKEEDSK */	$"4545 460D 534B 4545 4E0D 534B 4545 520D"            /* EEFSKEENSKEER */	$"534B 4545 530D 534B 4545 540D 534B 4547"            /* SKEESSKEETSKEG */	$"470D 534B 4547 530D 534B 4549 4E0D 534B"            /* GSKEGSSKEINSK */	$"454C 460D 534B 454C 4C0D 534B 454C 4D0D"            /* ELFSKELLSKELM */	$"534B 454C 500D 534B 454E 450D 534B 454E"            /* SKELPSKENESKEN */	$"530D 534B 454F 530D 534B 4550 530D 534B"            /* SSKEOSSKEPSSK */	$"4552 530D 534B 4554 530D 534B 4557 530D"            /* ERSSKETSSKEWS */	$"534B 4944 530D 534B 4945 440D 534B 4945"            /* SKIDSSKIEDSKIE */	$"530D 534B 4945 590D 534B 494D 4F0D 534B"            /* SSKIEYSKIMOSK */	$"494D 530D 534B 494E 4B0D 534B 494E 530D"            /* IMSSKINKSKINS */	$"534B 494E 540D 534B 494F 530D 534B 4950"            /* SKINTSKIOSSKIP */	$"530D 534B 4952 4C0D 534B 4952 520D 534B"            /* SSKIRLSKIRRSK */	$"4954 450D 534B 4954 530D 534B 4956 450D"            /* ITESKITSSKIVE */	$"534B 4956 590D 534B 4C49 4D0D 534B 4F41"            /* SKIVYSKLIMSKOA */	$"4C0D 534B 4F44 590D 534B 4F46 460D 534B"            /* LSKODYSKOFFSK */	$"4F47 530D 534B 4F4C 530D 534B 4F4F 4C0D"            /* OGSSKOLSSKOOL */	$"534B 4F52 540D 534B 4F53 480D 534B 5241"            /* SKORTSKOSHSKRA */	$"4E0D 534B 5249 4B0D 534B 5541 530D 534B"            /* NSKRIKSKUASSK */	$"5547 530D 534B 5945 440D 534B 5945 520D"            /* UGSSKYEDSKYER */	$"534B 5945 590D 534B 5946 530D 534B 5952"            /* SKYEYSKYFSSKYR */	$"450D 534B 5952 530D 534B 5954 450D 534C"            /* ESKYRSSKYTESL */	$"4142 530D 534C 4144 450D 534C 4145 530D"            /* ABSSLADESLAES */	$"534C 4147 530D 534C 4149 440D 534C 414B"            /* SLAGSSLAIDSLAK */	$"450D 534C 414D 530D 534C 414E 450D 534C"            /* ESLAMSSLANESL */	$"414E 4B0D 534C 4150 530D 534C 4152 540D"            /* ANKSLAPSSLART */	$"534C 4154 530D 534C 4154 590D 534C 4156"            /* SLATSSLATYSLAV */	$"450D 534C 4157 530D 534C 4159 530D 534C"            /* ESLAWSSLAYSSL */	$"4542 530D 534C 4544 530D 534C 4545 520D"            /* EBSSLEDSSLEER */	$"534C 4557 530D 534C 4559 530D 534C 4945"            /* SLEWSSLEYSSLIE */	$"520D 534C 494C 590D 534C 494D 530D 534C"            /* RSLILYSLIMSSL */	$"4950 450D 534C 4950 530D 534C 4950 540D"            /* IPESLIPSSLIPT */	$"534C 4953 480D 534C 4954 530D 534C 4956"            /* SLISHSLITSSLIV */	$"450D 534C 4F41 4E0D 534C 4F42 530D 534C"            /* ESLOANSLOBSSL */	$"4F45 530D 534C 4F47 530D 534C 4F49 440D"            /* OESSLOGSSLOID */	$"534C 4F4A 440D 534C 4F4D 4F0D 534C 4F4F"            /* SLOJDSLOMOSLOO */	$"4D0D 534C 4F4F 540D 534C 4F50 530D 534C"            /* MSLOOTSLOPSSL */	$"4F50 590D 534C 4F52 4D0D 534C 4F54 530D"            /* OPYSLORMSLOTS */	$"534C 4F56 450D 534C 4F57 530D 534C 4F59"            /* SLOVESLOWSSLOY */	$"440D 534C 5542 420D 534C 5542 530D 534C"            /* DSLUBBSLUBSSL */	$"5545 440D 534C 5545 530D 534C 5546 460D"            /* UEDSLUESSLUFF */	$"534C 5547 530D 534C 5549 540D 534C 554D"            /* SLUGSSLUITSLUM */	$"530D 534C 5552 420D 534C 5552 530D 534C"            /* SSLURBSLURSSL */	$"5553 450D 534C 5554 530D 534C 5945 520D"            /* USESLUTSSLYER */	$"534C 5950 450D 534D 4141 4B0D 534D 4149"            /* SLYPESMAAKSMAI */	$"4B0D 534D 414C 4D0D 534D 414C 540D 534D"            /* KSMALMSMALTSM */	$"4152 4D0D 534D 415A 450D 534D 4545 4B0D"            /* ARMSMAZESMEEK */	$"534D 4545 530D 534D 4549 4B0D 534D 454B"            /* SMEESSMEIKSMEK */	$"450D 534D 4552 4B0D 534D 4557 530D 534D"            /* ESMERKSMEWSSM */	$"4952 520D 534D 4952 530D 534D 4954 530D"            /* IRRSMIRSSMITS */	$"534D 4F47 530D 534D 4F4B 4F0D 534D 4F4C"            /* SMOGSSMOKOSMOL */	$"540D 534D 4F4F 520D 534D 4F4F 540D 534D"            /* TSMOORSMOOTSM */	$"4F52 450D 534D 4F52 470D 534D 4F55 540D"            /* ORESMORGSMOUT */	$"534D 4F57 540D 534D 5547 530D 534D 5552"            /* SMOWTSMUGSSMUR */	$"530D 534D 5553 480D 534D 5554 530D 534E"            /* SSMUSHSMUTSSN */	$"4142 530D 534E 4146 550D 534E 4147 530D"            /* ABSSNAFUSNAGS */	$"534E 4150 530D 534E 4152 460D 534E 4152"            /* SNAPSSNARFSNAR */	$"4B0D 534E 4152 530D 534E 4152 590D 534E"            /* KSNARSSNARYSN */	$"4153 480D 534E 4154 480D 534E 4157 530D"            /* ASHSNATHSNAWS */	$"534E 4541 440D 534E 4541 500D 534E 4542"            /* SNEADSNEAPSNEB */	$"530D 534E 4543 4B0D 534E 4544 530D 534E"            /* SSNECKSNEDSSN */	$"4545 440D 534E 4545 530D 534E 454C 4C0D"            /* EEDSNEESSNELL */	$"534E 4942 530D 534E 4943 4B0D 534E 4945"            /* SNIBSSNICKSNIE */	$"530D 534E 4946 540D 534E 4947 530D 534E"            /* SSNIFTSNIGSSN */	$"4950 530D 534E 4950 590D 534E 4952 540D"            /* IPSSNIPYSNIRT */	$"534E 4954 530D 534E 4F42 530D 534E 4F44"            /* SNITSSNOBSSNOD */	$"530D 534E 4F45 4B0D 534E 4F45 500D 534E"            /* SSNOEKSNOEPSN */	$"4F47 530D 534E 4F4B 450D 534E 4F4F 440D"            /* OGSSNOKESNOOD */	$"534E 4F4F 4B0D 534E 4F4F 4C0D 534E 4F4F"            /* SNOOKSNOOLSNOO */	$"540D 534E 4F54 530D 534E 4F57 4B0D 534E"            /* TSNOTSSNOWKSN */	$"4F57 530D 534E 5542 530D 534E 5547 530D"            /* OWSSNUBSSNUGS */	$"534E 5553 480D 534E 5945 530D 534F 414B"            /* SNUSHSNYESSOAK */	$"530D 534F 4150 530D 534F 4152 450D 534F"            /* SSOAPSSOARESO */	$"4152 530D 534F 4156 450D 534F 4241 530D"            /* ARSSOAVESOBAS */	$"534F 4341 530D 534F 4345 530D 534F 434B"            /* SOCASSOCESSOCK */	$"4F0D 534F 434B 530D 534F 434C 450D 534F"            /* OSOCKSSOCLESO */	$"4441 530D 534F 4444 590D 534F 4449 430D"            /* DASSODDYSODIC */	$"534F 444F 4D0D 534F 4641 520D 534F 4641"            /* SODOMSOFARSOFA */	$"530D 534F 4654 410D 534F 4654 530D 534F"            /* SSOFTASOFTSSO */	$"4654 590D 534F 4745 520D 534F 4855 520D"            /* FTYSOGERSOHUR */	$"534F 494C 530D 534F 494C 590D 534F 4A41"            /* SOILSSOILYSOJA */	$"530D 534F 4A55 530D 534F 4B41 480D 534F"            /* SSOJUSSOKAHSO */	$"4B45 4E0D 534F 4B45 530D 534F 4B4F 4C0D"            /* KENSOKESSOKOL */	$"534F 4C41 480D 534F 4C41 4E0D 534F 4C41"            /* SOLAHSOLANSOLA */	$"530D 534F 4C44 450D 534F 4C44 490D 534F"            /* SSOLDESOLDISO */	$"4C44 4F0D 534F 4C44 530D 534F 4C45 440D"            /* LDOSOLDSSOLED */	$"534F 4C45 490D 534F 4C45 520D 534F 4C45"            /* SOLEISOLERSOLE */	$"530D 534F 4C4F 4E0D 534F 4C4F 530D 534F"            /* SSOLONSOLOSSO */	$"4C55 4D0D 534F 4C55 530D 534F 4D41 4E0D"            /* LUMSOLUSSOMAN */	$"534F 4D41 530D 534F 4E43 450D 534F 4E44"            /* SOMASSONCESOND */	$"450D 534F 4E45 530D 534F 4E47 530D 534F"            /* ESONESSONGSSO */	$"4E4C 590D 534F 4E4E 450D 534F 4E4E 590D"            /* NLYSONNESONNY */	$"534F 4E53 450D 534F 4E53 590D 534F 4F45"            /* SONSESONSYSOOE */	$"590D 534F 4F4B 530D 534F 4F4B 590D 534F"            /* YSOOKSSOOKYSO */	$"4F4C 450D 534F 4F4C 530D 534F 4F4D 530D"            /* OLESOOLSSOOMS */	$"534F 4F50 530D 534F 4F54 450D 534F 4F54"            /* SOOPSSOOTESOOT */	$"530D 534F 5048 530D 534F 5048 590D 534F"            /* SSOPHSSOPHYSO */	$"504F 520D 534F 5050 590D 534F 5052 410D"            /* PORSOPPYSOPRA */	$"534F 5241 4C0D 534F 5241 530D 534F 5242"            /* SORALSORASSORB */	$"4F0D 534F 5242 530D 534F 5244 410D 534F"            /* OSORBSSORDASO */	$"5244 4F0D 534F 5244 530D 534F 5245 440D"            /* RDOSORDSSORED */	$"534F 5245 450D 534F 5245 4C0D 534F 5245"            /* SOREESORELSORE */	$"520D 534F 5245 530D 534F 5245 580D 534F"            /* RSORESSOREXSO */	$"5247 4F0D 534F 524E 530D 534F 5252 410D"            /* RGOSORNSSORRA */	$"534F 5254 410D 534F 5254 530D 534F 5255"            /* SORTASORTSSORU */	$"530D 534F 5448 530D 534F 544F 4C0D 534F"            /* SSOTHSSOTOLSO */	$"5543 450D 534F 5543 540D 534F 5547 480D"            /* UCESOUCTSOUGH */	$"534F 554B 530D 534F 554C 530D 534F 554D"            /* SOUKSSOULSSOUM */	$"530D 534F 5550 530D 534F 5550 590D 534F"            /* SSOUPSSOUPYSO */	$"5552 530D 534F 5553 450D 534F 5554 530D"            /* URSSOUSESOUTS */	$"534F 5741 520D 534F 5743 450D 534F 5745"            /* SOWARSOWCESOWE */	$"440D 534F 5746 460D 534F 5746 530D 534F"            /* DSOWFFSOWFSSO */	$"574C 450D 534F 574C 530D 534F 574D 530D"            /* WLESOWLSSOWMS */	$"534F 574E 440D 534F 574E 450D 534F 5750"            /* SOWNDSOWNESOWP */	$"530D 534F 5753 450D 534F 5754 480D 534F"            /* SSOWSESOWTHSO */	$"5941 530D 534F 594C 450D 534F 5955 5A0D"            /* YASSOYLESOYUZ */	$"534F 5A49 4E0D 5350 4143 590D 5350 4144"            /* SOZINSPACYSPAD */	$"4F0D 5350 4145 440D 5350 4145 520D 5350"            /* OSPAEDSPAERSP */	$"4145 530D 5350 4147 530D 5350 4148 490D"            /* AESSPAGSSPAHI */	$"5350 4149 4C0D 5350 4149 4E0D 5350 4149"            /* SPAILSPAINSPAI */	$"540D 5350 414B 450D 5350 414C 440D 5350"            /* TSPAKESPALDSP */	$"414C 450D 5350 414C 4C0D 5350 414C 540D"            /* ALESPALLSPALT */	$"5350 414D 530D 5350 414E 450D 5350 414E"            /* SPAMSSPANESPAN */	$"470D 5350 414E 530D 5350 4152 440D 5350"            /* GSPANSSPARDSP */	$"4152 530D 5350 4152 540D 5350 4154 450D"            /* ARSSPARTSPATE */	$"5350 4154 530D 5350 4155 4C0D 5350 4157"            /* SPATSSPAULSPAW */	$"4C0D 5350 4157 530D 5350 4159 440D 5350"            /* LSPAWSSPAYDSP */	$"4159 530D 5350 415A 410D 5350 415A 5A0D"            /* AYSSPAZASPAZZ */	$"5350 4541 4C0D 5350 4541 4E0D 5350 4541"            /* SPEALSPEANSPEA */	$"540D 5350 4543 530D 5350 4543 540D 5350"            /* TSPECSSPECTSP */	$"4545 4C0D 5350 4545 520D 5350 4549 4C0D"            /* EELSPEERSPEIL */	$"5350 4549 520D 5350 454B 530D 5350 454C"            /* SPEIRSPEKSSPEL */	$"440D 5350 454C 4B0D 5350 454F 530D 5350"            /* DSPELKSPEOSSP */	$"4554 530D 5350 4555 470D 5350 4557 530D"            /* ETSSPEUGSPEWS */	$"5350 4557 590D 5350 4941 4C0D 5350 4943"            /* SPEWYSPIALSPIC */	$"410D 5350 4943 4B0D 5350 4943 530D 5350"            /* ASPICKSPICSSP */	$"4944 450D 5350 4945 520D 5350 4945 530D"            /* IDESPIERSPIES */	$"5350 4946 460D 5350 4946 530D 5350 494B"            /* SPIFFSPIFSSPIK */	$"530D 5350 494C 450D 5350 494D 530D 5350"            /* SSPILESPIMSSP */	$"494E 410D 5350 494E 4B0D 5350 494E 530D"            /* INASPINKSPINS */	$"5350 4952 540D 5350 4952 590D 5350 4954"            /* SPIRTSPIRYSPIT */	$"530D 5350 4954 5A0D 5350 4956 530D 5350"            /* SSPITZSPIVSSP */	$"4C41 590D 5350 4C4F 470D 5350 4F44 450D"            /* LAYSPLOGSPODE */	$"5350 4F44 530D 5350 4F4F 4D0D 5350 4F4F"            /* SPODSSPOOMSPOO */	$"520D 5350 4F4F 540D 5350 4F52 4B0D 5350"            /* RSPOOTSPORKSP */	$"4F53 480D 5350 4F54 530D 5350 5241 440D"            /* OSHSPOTSSPRAD */	$"5350 5241 470D 5350 5241 540D 5350 5245"            /* SPRAGSPRATSPRE */	$"440D 5350 5245 570D 5350 5249 540D 5350"            /* DSPREWSPRITSP */	$"524F 440D 5350 524F 470D 5350 5255 450D"            /* RODSPROGSPRUE */	$"5350 5255 470D 5350 5544 530D 5350 5545"            /* SPRUGSPUDSSPUE */	$"440D 5350 5545 520D 5350 5545 530D 5350"            /* DSPUERSPUESSP */	$"5547 530D 5350 554C 450D 5350 554D 450D"            /* UGSSPULESPUME */	$"5350 554D 590D 5350 5552 530D 5350 5554"            /* SPUMYSPURSSPUT */	$"410D 5350 5941 4C0D 5350 5952 450D 5351"            /* ASPYALSPYRESQ */	$"5541 420D 5351 5541 570D 5351 5545 470D"            /* UABSQUAWSQUEG */	$"5351 5549 440D 5351 5549 540D 5351 5549"            /* SQUIDSQUITSQUI */	$"5A0D 5354 4142 530D 5354 4144 450D 5354"            /* ZSTABSSTADEST */	$"4147 530D 5354 4147 590D 5354 4149 470D"            /* AGSSTAGYSTAIG */	$"5354 414E 450D 5354 414E 470D 5354 4150"            /* STANESTANGSTAP */	$"480D 5354 4150 530D 5354 4152 4E0D 5354"            /* HSTAPSSTARNST */	$"4152 520D 5354 4152 530D 5354 4154 530D"            /* ARRSTARSSTATS */	$"5354 4155 4E0D 5354 4157 530D 5354 4159"            /* STAUNSTAWSSTAY */	$"530D 5354 4541 4E0D 5354 4541 520D 5354"            /* SSTEANSTEARST */	$"4544 440D 5354 4544 450D 5354 4544 530D"            /* EDDSTEDESTEDS */	$"5354 4545 4B0D 5354 4545 4D0D 5354 4545"            /* STEEKSTEEMSTEE */	$"4E0D 5354 4549 4C0D 5354 454C 410D 5354"            /* NSTEILSTELAST */	$"454C 450D 5354 454C 4C0D 5354 454D 450D"            /* ELESTELLSTEME */	$"5354 454D 530D 5354 454E 440D 5354 454E"            /* STEMSSTENDSTEN */	$"4F0D 5354 454E 530D 5354 454E 540D 5354"            /* OSTENSSTENTST */	$"4550 530D 5354 4550 540D 5354 4552 450D"            /* EPSSTEPTSTERE */	$"5354 4554 530D 5354 4557 530D 5354 4557"            /* STETSSTEWSSTEW */	$"590D 5354 4559 530D 5354 4943 480D 5354"            /* YSTEYSSTICHST */	$"4945 440D 5354 4945 530D 5354 494C 420D"            /* IEDSTIESSTILB */	$"5354 494C 450D 5354 494D 450D 5354 494D"            /* STILESTIMESTIM */	$"530D 5354 494D 590D 5354 4950 410D 5354"            /* SSTIMYSTIPAST */	$"4950 450D 5354 4952 450D 5354 4952 4B0D"            /* IPESTIRESTIRK */	$"5354 4952 500D 5354 4952 530D 5354 4956"            /* STIRPSTIRSSTIV */	$"450D 5354 4956 590D 5354 4F41 450D 5354"            /* ESTIVYSTOAEST */	$"4F41 490D 5354 4F41 530D 5354 4F41 540D"            /* OAISTOASSTOAT */	$"5354 4F42 530D 5354 4F45 500D 5354 4F47"            /* STOBSSTOEPSTOG */	$"590D 5354 4F49 540D 5354 4F4C 4E0D 5354"            /* YSTOITSTOLNST */	$"4F4D 410D 5354 4F4E 440D 5354 4F4E 470D"            /* OMASTONDSTONG */	$"5354 4F4E 4B0D 5354 4F4E 4E0D 5354 4F4F"            /* STONKSTONNSTOO */	$"4B0D 5354 4F4F 520D 5354 4F50 450D 5354"            /* KSTOORSTOPEST */	$"4F50 530D 5354 4F50 540D 5354 4F53 530D"            /* OPSSTOPTSTOSS */	$"5354 4F54 530D 5354 4F54 540D 5354 4F55"            /* STOTSSTOTTSTOU */	$"4E0D 5354 4F55 500D 5354 4F55 520D 5354"            /* NSTOUPSTOURST */	$"4F57 4E0D 5354 4F57 500D 5354 4F57 530D"            /* OWNSTOWPSTOWS */	$"5354 5241 440D 5354 5241 450D 5354 5241"            /* STRADSTRAESTRA */	$"470D 5354 5241 4B0D 5354 5245 500D 5354"            /* GSTRAKSTREPST */	$"5245 570D 5354 5249 410D 5354 5249 470D"            /* REWSTRIASTRIG */	$"5354 5249 4D0D 5354 524F 500D 5354 524F"            /* STRIMSTROPSTRO */	$"570D 5354 524F 590D 5354 5255 4D0D 5354"            /* WSTROYSTRUMST */	$"5542 530D 5354 5544 450D 5354 5544 530D"            /* UBSSTUDESTUDS */	$"5354 554C 4C0D 5354 554C 4D0D 5354 554D"            /* STULLSTULMSTUM */	$"4D0D 5354 554D 530D 5354 554E 530D 5354"            /* MSTUMSSTUNSST */	$"5550 410D 5354 5550 450D 5354 5552 450D"            /* UPASTUPESTURE */	$"5354 5552 540D 5354 5945 440D 5354 5945"            /* STURTSTYEDSTYE */	$"530D 5354 594C 490D 5354 594C 4F0D 5354"            /* SSTYLISTYLOST */	$"594D 450D 5354 594D 590D 5354 5952 450D"            /* YMESTYMYSTYRE */	$"5354 5954 450D 5355 4241 480D 5355 4241"            /* STYTESUBAHSUBA */	$"530D 5355 4242 590D 5355 4245 520D 5355"            /* SSUBBYSUBERSU */	$"4248 410D 5355 4343 490D 5355 434B 530D"            /* BHASUCCISUCKS */	$"5355 434B 590D 5355 4352 450D 5355 4444"            /* SUCKYSUCRESUDD */	$"530D 5355 444F 520D 5355 4453 590D 5355"            /* SSUDORSUDSYSU */	$"4544 450D 5355 454E 540D 5355 4552 530D"            /* EDESUENTSUERS */	$"5355 4554 450D 5355 4554 530D 5355 4554"            /* SUETESUETSSUET */	$"590D 5355 4741 4E0D 5355 4748 530D 5355"            /* YSUGANSUGHSSU */	$"474F 530D 5355 4855 520D 5355 4944 530D"            /* GOSSUHURSUIDS */	$"5355 494E 540D 5355 4954 530D 5355 4A45"            /* SUINTSUITSSUJE */	$"450D 5355 4B48 530D 5355 4B55 4B0D 5355"            /* ESUKHSSUKUKSU */	$"4C43 490D 5355 4C46 410D 5355 4C46 4F0D"            /* LCISULFASULFO */	$"5355 4C4B 530D 5355 4C50 480D 5355 4C55"            /* SULKSSULPHSULU */	$"530D 5355 4D49 530D 5355 4D4D 410D 5355"            /* SSUMISSUMMASU */	$"4D4F 530D 5355 4D50 480D 5355 4D50 530D"            /* MOSSUMPHSUMPS */	$"5355 4E49 530D 5355 4E4B 530D 5355 4E4E"            /* SUNISSUNKSSUNN */	$"410D 5355 4E4E 530D 5355 4E55 500D 5355"            /* ASUNNSSUNUPSU */	$"5045 530D 5355 5052 410D 5355 5241 480D"            /* PESSUPRASURAH */	$"5355 5241 4C0D 5355 5241 530D 5355 5241"            /* SURALSURASSURA */	$"540D 5355 5244 530D 5355 5245 440D 5355"            /* TSURDSSUREDSU */	$"5245 530D 5355 5246 530D 5355 5246 590D"            /* RESSURFSSURFY */	$"5355 5247 590D 5355 5252 410D 5355 5345"            /* SURGYSURRASUSE */	$"440D 5355 5345 530D 5355 5355 530D 5355"            /* DSUSESSUSUSSU */	$"544F 520D 5355 5452 410D 5355 5454 410D"            /* TORSUTRASUTTA */	$"5357 4142 530D 5357 4143 4B0D 5357 4144"            /* SWABSSWACKSWAD */	$"530D 5357 4147 450D 5357 4147 530D 5357"            /* SSWAGESWAGSSW */	$"4149 4C0D 5357 4149 4E0D 5357 414C 450D"            /* AILSWAINSWALE */	$"5357 414C 590D 5357 414D 590D 5357 414E"            /* SWALYSWAMYSWAN */	$"470D 5357 414E 4B0D 5357 414E 530D 5357"            /* GSWANKSWANSSW */	$"4150 530D 5357 4150 540D 5357 4152 440D"            /* APSSWAPTSWARD */	$"5357 4152 450D 5357 4152 460D 5357 4152"            /* SWARESWARFSWAR */	$"540D 5357 4154 530D 5357 4159 4C0D 5357"            /* TSWATSSWAYLSW */	$"4159 530D 5357 4541 4C0D 5357 4544 450D"            /* AYSSWEALSWEDE */	$"5357 4545 440D 5357 4545 4C0D 5357 4545"            /* SWEEDSWEELSWEE */	$"520D 5357 4545 530D 5357 4549 520D 5357"            /* RSWEESSWEIRSW */	$"454C 540D 5357 4552 460D 5357 4559 530D"            /* ELTSWERFSWEYS */	$"5357 4945 530D 5357 4947 530D 5357 494C"            /* SWIESSWIGSSWIL */	$"450D 5357 494D 530D 5357 494E 4B0D 5357"            /* ESWIMSSWINKSW */	$"4950 450D 5357 4952 450D 5357 4953 530D"            /* IPESWIRESWISS */	$"5357 4954 480D 5357 4954 530D 5357 4956"            /* SWITHSWITSSWIV */	$"450D 5357 495A 5A0D 5357 4F42 530D 5357"            /* ESWIZZSWOBSSW */	$"4F4C 450D 5357 4F4C 4E0D 5357 4F50 530D"            /* OLESWOLNSWOPS */	$"5357 4F50 540D 5357 4F54 530D 5357 4F55"            /* SWOPTSWOTSSWOU */	$"4E0D 5359 4242 450D 5359 4249 4C0D 5359"            /* NSYBBESYBILSY */	$"424F 450D 5359 424F 570D 5359 4345 450D"            /* BOESYBOWSYCEE */	$"5359 4345 530D 5359 434F 4E0D 5359 454E"            /* SYCESSYCONSYEN */	$"530D 5359 4B45 520D 5359 4B45 530D 5359"            /* SSYKERSYKESSY */	$"4C49 530D 5359 4C50 480D 5359 4C56 410D"            /* LISSYLPHSYLVA */	$"5359 4D41 520D 5359 4E43 480D 5359 4E43"            /* SYMARSYNCHSYNC */	$"530D 5359 4E44 530D 5359 4E45 440D 5359"            /* SSYNDSSYNEDSY */	$"4E45 530D 5359 4E54 480D 5359 5045 440D"            /* NESSYNTHSYPED */	$"5359 5045 530D 5359 5048 530D 5359 5241"            /* SYPESSYPHSSYRA */	$"480D 5359 5245 4E0D 5359 534F 500D 5359"            /* HSYRENSYSOPSY */	$"5448 450D 5359 5645 520D 5441 414C 530D"            /* THESYVERTAALS */	$"5441 4154 410D 5441 4245 520D 5441 4245"            /* TAATATABERTABE */	$"530D 5441 4249 440D 5441 4249 530D 5441"            /* STABIDTABISTA */	$"424C 410D 5441 424F 520D 5441 4255 4E0D"            /* BLATABORTABUN */	$"5441 4255 530D 5441 4341 4E0D 5441 4345"            /* TABUSTACANTACE */	$"530D 5441 4345 540D 5441 4348 450D 5441"            /* STACETTACHETA */	$"4348 4F0D 5441 4348 530D 5441 434B 530D"            /* CHOTACHSTACKS */	$"5441 434F 530D 5441 4354 530D 5441 454C"            /* TACOSTACTSTAEL */	$"530D 5441 4649 410D 5441 4747 590D 5441"            /* STAFIATAGGYTA */	$"474D 410D 5441 4841 530D 5441 4852 530D"            /* GMATAHASTAHRS */	$"5441 4947 410D 5441 4947 530D 5441 494B"            /* TAIGATAIGSTAIK */	$"4F0D 5441 494C 530D 5441 494E 530D 5441"            /* OTAILSTAINSTA */	$"4952 410D 5441 4953 480D 5441 4954 530D"            /* IRATAISHTAITS */	$"5441 4A45 530D 5441 4B41 530D 5441 4B45"            /* TAJESTAKASTAKE */	$"530D 5441 4B48 490D 5441 4B49 4E0D 5441"            /* STAKHITAKINTA */	$"4B49 530D 5441 4B4B 590D 5441 4C41 4B0D"            /* KISTAKKYTALAK */	$"5441 4C41 510D 5441 4C41 520D 5441 4C41"            /* TALAQTALARTALA */	$"530D 5441 4C43 530D 5441 4C43 590D 5441"            /* STALCSTALCYTA */	$"4C45 410D 5441 4C45 520D 5441 4C45 530D"            /* LEATALERTALES */	$"5441 4C4B 530D 5441 4C4B 590D 5441 4C4C"            /* TALKSTALKYTALL */	$"530D 5441 4C4D 410D 5441 4C50 410D 5441"            /* STALMATALPATA */	$"4C55 4B0D 5441 4C55 530D 5441 4D41 4C0D"            /* LUKTALUSTAMAL */	$"5441 4D45 440D 5441 4D45 530D 5441 4D49"            /* TAMEDTAMESTAMI */	$"4E0D 5441 4D49 530D 5441 4D4D 590D 5441"            /* NTAMISTAMMYTA */	$"4D50 530D 5441 4E41 530D 5441 4E47 410D"            /* MPSTANASTANGA */	$"5441 4E47 490D 5441 4E47 530D 5441 4E48"            /* TANGITANGSTANH */	$"530D 5441 4E4B 410D 5441 4E4B 530D 5441"            /* STANKATANKSTA */	$"4E4B 590D 5441 4E4E 410D 5441 4E53 590D"            /* NKYTANNATANSY */	$"5441 4E54 490D 5441 4E54 4F0D 5441 4E54"            /* TANTITANTOTANT */	$"590D 5441 5041 530D 5441 5045 440D 5441"            /* YTAPASTAPEDTA */	$"5045 4E0D 5441 5045 530D 5441 5045 540D"            /* PENTAPESTAPET */	$"5441 5049 530D 5441 5050 410D 5441 5055"            /* TAPISTAPPATAPU */	$"530D 5441 5241 530D 5441 5244 4F0D 5441"            /* STARASTARDOTA */	$"5245 440D 5441 5245 530D 5441 5247 410D"            /* REDTARESTARGA */	$"5441 5247 450D 5441 524E 530D 5441 524F"            /* TARGETARNSTARO */	$"430D 5441 524F 4B0D 5441 524F 530D 5441"            /* CTAROKTAROSTA */	$"5250 530D 5441 5252 450D 5441 5252 590D"            /* RPSTARRETARRY */	$"5441 5253 490D 5441 5254 530D 5441 5254"            /* TARSITARTSTART */	$"590D 5441 5341 520D 5441 5345 440D 5441"            /* YTASARTASEDTA */	$"5345 520D 5441 5345 530D 5441 534B 530D"            /* SERTASESTASKS */	$"5441 5353 410D 5441 5353 450D 5441 5353"            /* TASSATASSETASS */	$"4F0D 5441 5441 520D 5441 5445 520D 5441"            /* OTATARTATERTA */	$"5445 530D 5441 5448 530D 5441 5449 450D"            /* TESTATHSTATIE */	$"5441 544F 550D 5441 5454 530D 5441 5455"            /* TATOUTATTSTATU */	$"530D 5441 5542 450D 5441 554C 440D 5441"            /* STAUBETAULDTA */	$"554F 4E0D 5441 5550 450D 5441 5554 530D"            /* UONTAUPETAUTS */	$"5441 5641 480D 5441 5641 530D 5441 5645"            /* TAVAHTAVASTAVE */	$"520D 5441 5741 490D 5441 5741 530D 5441"            /* RTAWAITAWASTA */	$"5745 440D 5441 5745 520D 5441 5749 450D"            /* WEDTAWERTAWIE */	$"5441 5753 450D 5441 5754 530D 5441 5845"            /* TAWSETAWTSTAXE */	$"440D 5441 5845 520D 5441 5845 530D 5441"            /* DTAXERTAXESTA */	$"5849 530D 5441 584F 4C0D 5441 584F 4E0D"            /* XISTAXOLTAXON */	$"5441 584F 520D 5441 5855 530D 5441 5952"            /* TAXORTAXUSTAYR */	$"410D 5441 5A5A 410D 5441 5A5A 450D 5445"            /* ATAZZATAZZETE */	$"4144 450D 5445 4144 530D 5445 4145 440D"            /* ADETEADSTEAED */	$"5445 414B 530D 5445 414C 530D 5445 414D"            /* TEAKSTEALSTEAM */	$"530D 5445 4152 530D 5445 4154 530D 5445"            /* STEARSTEATSTE */	$"415A 450D 5445 4348 530D 5445 4348 590D"            /* AZETECHSTECHY */	$"5445 4354 410D 5445 454C 530D 5445 454D"            /* TECTATEELSTEEM */	$"530D 5445 454E 440D 5445 454E 450D 5445"            /* STEENDTEENETE */	$"454E 530D 5445 454E 590D 5445 4552 530D"            /* ENSTEENYTEERS */	$"5445 4646 530D 5445 4747 530D 5445 4755"            /* TEFFSTEGGSTEGU */	$"410D 5445 4755 530D 5445 4852 530D 5445"            /* ATEGUSTEHRSTE */	$"4949 440D 5445 494C 530D 5445 494E 440D"            /* IIDTEILSTEIND */	$"5445 494E 530D 5445 4C41 450D 5445 4C43"            /* TEINSTELAETELC */	$"4F0D 5445 4C45 530D 5445 4C45 580D 5445"            /* OTELESTELEXTE */	$"4C49 410D 5445 4C49 430D 5445 4C4C 530D"            /* LIATELICTELLS */	$"5445 4C4C 590D 5445 4C4F 490D 5445 4C4F"            /* TELLYTELOITELO */	$"530D 5445 4D45 440D 5445 4D45 530D 5445"            /* STEMEDTEMESTE */	$"4D50 490D 5445 4D50 530D 5445 4D50 540D"            /* MPITEMPSTEMPT */	$"5445 4D53 450D 5445 4E43 480D 5445 4E44"            /* TEMSETENCHTEND */	$"530D 5445 4E44 550D 5445 4E45 530D 5445"            /* STENDUTENESTE */	$"4E47 450D 5445 4E49 410D 5445 4E4E 450D"            /* NGETENIATENNE */	$"5445 4E4E 4F0D 5445 4E4E 590D 5445 4E4F"            /* TENNOTENNYTENO */	$"4E0D 5445 4E54 530D 5445 4E54 590D 5445"            /* NTENTSTENTYTE */	$"4E55 450D 5445 5041 4C0D 5445 5041 530D"            /* NUETEPALTEPAS */	$"5445 504F 590D 5445 5241 490D 5445 5241"            /* TEPOYTERAITERA */	$"530D 5445 5243 450D 5445 5245 4B0D 5445"            /* STERCETEREKTE */	$"5245 530D 5445 5246 450D 5445 5246 530D"            /* RESTERFETERFS */	$"5445 5247 410D 5445 524D 530D 5445 524E"            /* TERGATERMSTERN */	$"450D 5445 524E 530D 5445 5252 590D 5445"            /* ETERNSTERRYTE */	$"5254 530D 5445 534C 410D 5445 5354 410D"            /* RTSTESLATESTA */	$"5445 5354 450D 5445 5354 530D 5445 5445"            /* TESTETESTSTETE */	$"530D 5445 5448 530D 5445 5452 410D 5445"            /* STETHSTETRATE */	$"5452 490D 5445 5543 480D 5445 5547 480D"            /* TRITEUCHTEUGH */	$"5445 5745 440D 5445 5745 4C0D 5445 5749"            /* TEWEDTEWELTEWI */	$"540D 5445 5841 530D 5445 5845 530D 5445"            /* TTEXASTEXESTE */	$"5854 530D 5448 4143 4B0D 5448 4147 490D"            /* XTSTHACKTHAGI */	$"5448 4149 4D0D 5448 414C 450D 5448 414C"            /* THAIMTHALETHAL */	$"490D 5448 414E 410D 5448 414E 450D 5448"            /* ITHANATHANETH */	$"414E 470D 5448 414E 530D 5448 414E 580D"            /* ANGTHANSTHANX */	$"5448 4152 4D0D 5448 4152 530D 5448 4157"            /* THARMTHARSTHAW */	$"530D 5448 4157 590D 5448 4542 450D 5448"            /* STHAWYTHEBETH */	$"4543 410D 5448 4545 440D 5448 4545 4B0D"            /* ECATHEEDTHEEK */	$"5448 4545 530D 5448 4547 4E0D 5448 4549"            /* THEESTHEGNTHEI */	$"430D 5448 4549 4E0D 5448 454C 460D 5448"            /* CTHEINTHELFTH */	$"454D 410D 5448 454E 530D 5448 454F 570D"            /* EMATHENSTHEOW */	$"5448 4552 4D0D 5448 4553 500D 5448 4554"            /* THERMTHESPTHET */	$"450D 5448 4557 530D 5448 4557 590D 5448"            /* ETHEWSTHEWYTH */	$"4947 530D 5448 494C 4B0D 5448 494C 4C0D"            /* IGSTHILKTHILL */	$"5448 494E 450D 5448 494E 530D 5448 494F"            /* THINETHINSTHIO */	$"4C0D 5448 4952 4C0D 5448 4F46 540D 5448"            /* LTHIRLTHOFTTH */	$"4F4C 450D 5448 4F4C 490D 5448 4F52 4F0D"            /* OLETHOLITHORO */	$"5448 4F52 500D 5448 4F55 530D 5448 4F57"            /* THORPTHOUSTHOW */	$"4C0D 5448 5241 450D 5448 5241 570D 5448"            /* LTHRAETHRAWTH */	$"5249 440D 5448 5249 500D 5448 524F 450D"            /* RIDTHRIPTHROE */	$"5448 5544 530D 5448 5547 530D 5448 554A"            /* THUDSTHUGSTHUJ */	$"410D 5448 554E 4B0D 5448 5552 4C0D 5448"            /* ATHUNKTHURLTH */	$"5559 410D 5448 594D 490D 5448 594D 590D"            /* UYATHYMITHYMY */	$"5449 414E 530D 5449 4152 530D 5449 4341"            /* TIANSTIARSTICA */	$"4C0D 5449 4343 410D 5449 4345 440D 5449"            /* LTICCATICEDTI */	$"4345 530D 5449 4348 590D 5449 434B 530D"            /* CESTICHYTICKS */	$"5449 434B 590D 5449 4444 590D 5449 4445"            /* TICKYTIDDYTIDE */	$"440D 5449 4445 530D 5449 4552 530D 5449"            /* DTIDESTIERSTI */	$"4646 530D 5449 464F 530D 5449 4654 530D"            /* FFSTIFOSTIFTS */	$"5449 4745 530D 5449 474F 4E0D 5449 4B41"            /* TIGESTIGONTIKA */	$"530D 5449 4B45 530D 5449 4B49 530D 5449"            /* STIKESTIKISTI */	$"4B4B 410D 5449 4C41 4B0D 5449 4C45 440D"            /* KKATILAKTILED */	$"5449 4C45 520D 5449 4C45 530D 5449 4C4C"            /* TILERTILESTILL */	$"530D 5449 4C4C 590D 5449 4C54 480D 5449"            /* STILLYTILTHTI */	$"4C54 530D 5449 4D42 4F0D 5449 4D45 440D"            /* LTSTIMBOTIMED */	$"5449 4D45 530D 5449 4D4F 4E0D 5449 4D50"            /* TIMESTIMONTIMP */	$"530D 5449 4E41 530D 5449 4E43 540D 5449"            /* STINASTINCTTI */	$"4E44 530D 5449 4E45 410D 5449 4E45 440D"            /* NDSTINEATINED */	$"5449 4E45 530D 5449 4E47 450D 5449 4E47"            /* TINESTINGETING */	$"530D 5449 4E4B 530D 5449 4E4E 590D 5449"            /* STINKSTINNYTI */	$"4E54 530D 5449 4E54 590D 5449 5049 530D"            /* NTSTINTYTIPIS */	$"5449 5050 590D 5449 5245 440D 5449 5245"            /* TIPPYTIREDTIRE */	$"530D 5449 524C 530D 5449 524F 530D 5449"            /* STIRLSTIROSTI */	$"5252 530D 5449 5443 480D 5449 5445 520D"            /* RRSTITCHTITER */	$"5449 5449 530D 5449 5452 450D 5449 5454"            /* TITISTITRETITT */	$"590D 5449 5455 500D 5449 5949 4E0D 5449"            /* YTITUPTIYINTI */	$"594E 530D 5449 5A45 530D 5449 5A5A 590D"            /* YNSTIZESTIZZY */	$"544F 4144 530D 544F 4144 590D 544F 415A"            /* TOADSTOADYTOAZ */	$"450D 544F 434B 530D 544F 434B 590D 544F"            /* ETOCKSTOCKYTO */	$"434F 530D 544F 4444 450D 544F 4541 530D"            /* COSTODDETOEAS */	$"544F 4646 530D 544F 4646 590D 544F 4654"            /* TOFFSTOFFYTOFT */	$"530D 544F 4655 530D 544F 4741 450D 544F"            /* STOFUSTOGAETO */	$"4741 530D 544F 4745 440D 544F 4745 530D"            /* GASTOGEDTOGES */	$"544F 4755 450D 544F 484F 530D 544F 494C"            /* TOGUETOHOSTOIL */	$"450D 544F 494C 530D 544F 494E 470D 544F"            /* ETOILSTOINGTO */	$"4953 450D 544F 4954 530D 544F 4B41 590D"            /* ISETOITSTOKAY */	$"544F 4B45 440D 544F 4B45 520D 544F 4B45"            /* TOKEDTOKERTOKE */	$"530D 544F 4B4F 530D 544F 4C41 4E0D 544F"            /* STOKOSTOLANTO */	$"4C41 520D 544F 4C41 530D 544F 4C45 440D"            /* LARTOLASTOLED */	$"544F 4C45 530D 544F 4C4C 530D 544F 4C4C"            /* TOLESTOLLSTOLL */	$"590D 544F 4C54 530D 544F 4C55 530D 544F"            /* YTOLTSTOLUSTO */	$"4C59 4C0D 544F 4D41 4E0D 544F 4D42 530D"            /* LYLTOMANTOMBS */	$"544F 4D45 530D 544F 4D49 410D 544F 4D4D"            /* TOMESTOMIATOMM */	$"590D 544F 4D4F 530D 544F 4E44 490D 544F"            /* YTOMOSTONDITO */	$"4E44 4F0D 544F 4E45 440D 544F 4E45 520D"            /* NDOTONEDTONER */	$"544F 4E45 530D 544F 4E45 590D 544F 4E47"            /* TONESTONEYTONG */	$"530D 544F 4E4B 410D 544F 4E4B 530D 544F"            /* STONKATONKSTO */	$"4E4E 450D 544F 4E55 530D 544F 4F4C 530D"            /* NNETONUSTOOLS */	$"544F 4F4D 530D 544F 4F4E 530D 544F 4F54"            /* TOOMSTOONSTOOT */	$"530D 544F 5045 440D 544F 5045 450D 544F"            /* STOPEDTOPEETO */	$"5045 4B0D 544F 5045 520D 544F 5045 530D"            /* PEKTOPERTOPES */	$"544F 5048 450D 544F 5048 490D 544F 5048"            /* TOPHETOPHITOPH */	$"530D 544F 5049 530D 544F 504F 490D 544F"            /* STOPISTOPOITO */	$"504F 530D 544F 5050 590D 544F 5155 450D"            /* POSTOPPYTOQUE */	$"544F 5241 480D 544F 5241 4E0D 544F 5241"            /* TORAHTORANTORA */	$"530D 544F 5243 530D 544F 5245 530D 544F"            /* STORCSTORESTO */	$"5249 430D 544F 5249 490D 544F 524F 530D"            /* RICTORIITOROS */	$"544F 524F 540D 544F 5252 530D 544F 5253"            /* TOROTTORRSTORS */	$"450D 544F 5253 490D 544F 5253 4B0D 544F"            /* ETORSITORSKTO */	$"5254 410D 544F 5254 450D 544F 5254 530D"            /* RTATORTETORTS */	$"544F 5341 530D 544F 5345 440D 544F 5345"            /* TOSASTOSEDTOSE */	$"530D 544F 5348 590D 544F 5353 590D 544F"            /* STOSHYTOSSYTO */	$"5445 440D 544F 5445 520D 544F 5445 530D"            /* TEDTOTERTOTES */	$"544F 5454 590D 544F 554B 530D 544F 554E"            /* TOTTYTOUKSTOUN */	$"530D 544F 5552 530D 544F 5553 450D 544F"            /* STOURSTOUSETO */	$"5553 590D 544F 5554 530D 544F 555A 450D"            /* USYTOUTSTOUZE */	$"544F 555A 590D 544F 5745 440D 544F 5749"            /* TOUZYTOWEDTOWI */	$"450D 544F 574E 530D 544F 574E 590D 544F"            /* ETOWNSTOWNYTO */	$"5753 450D 544F 5753 590D 544F 5754 530D"            /* WSETOWSYTOWTS */	$"544F 575A 450D 544F 575A 590D 544F 5945"            /* TOWZETOWZYTOYE */	$"440D 544F 5945 520D 544F 594F 4E0D 544F"            /* DTOYERTOYONTO */	$"594F 530D 544F 5A45 440D 544F 5A45 530D"            /* YOSTOZEDTOZES */	$"544F 5A49 450D 5452 4142 530D 5452 4144"            /* TOZIETRABSTRAD */	$"530D 5452 4147 490D 5452 4149 4B0D 5452"            /* STRAGITRAIKTR */	$"414D 530D 5452 414E 4B0D 5452 414E 510D"            /* AMSTRANKTRANQ */	$"5452 414E 530D 5452 414E 540D 5452 4150"            /* TRANSTRANTTRAP */	$"450D 5452 4150 530D 5452 4150 540D 5452"            /* ETRAPSTRAPTTR */	$"4153 530D 5452 4154 530D 5452 4154 540D"            /* ASSTRATSTRATT */	$"5452 4156 450D 5452 4159 460D 5452 4159"            /* TRAVETRAYFTRAY */	$"530D 5452 4543 4B0D 5452 4545 440D 5452"            /* STRECKTREEDTR */	$"4545 4E0D 5452 4545 530D 5452 4546 410D"            /* EENTREESTREFA */	$"5452 4549 460D 5452 454B 530D 5452 454D"            /* TREIFTREKSTREM */	$"410D 5452 454D 530D 5452 4553 530D 5452"            /* ATREMSTRESSTR */	$"4553 540D 5452 4554 530D 5452 4557 530D"            /* ESTTRETSTREWS */	$"5452 4559 460D 5452 4559 530D 5452 4941"            /* TREYFTREYSTRIA */	$"430D 5452 4944 450D 5452 4945 520D 5452"            /* CTRIDETRIERTR */	$"4945 530D 5452 4946 460D 5452 4947 4F0D"            /* IESTRIFFTRIGO */	$"5452 4947 530D 5452 494B 450D 5452 494C"            /* TRIGSTRIKETRIL */	$"440D 5452 494C 4C0D 5452 494D 530D 5452"            /* DTRILLTRIMSTR */	$"494E 450D 5452 494E 530D 5452 494F 4C0D"            /* INETRINSTRIOL */	$"5452 494F 520D 5452 494F 530D 5452 4950"            /* TRIORTRIOSTRIP */	$"530D 5452 4950 590D 5452 4953 540D 5452"            /* STRIPYTRISTTR */	$"4F41 440D 5452 4F41 4B0D 5452 4F41 540D"            /* OADTROAKTROAT */	$"5452 4F43 4B0D 5452 4F44 450D 5452 4F44"            /* TROCKTRODETROD */	$"530D 5452 4F47 530D 5452 4F49 530D 5452"            /* STROGSTROISTR */	$"4F4B 450D 5452 4F4D 500D 5452 4F4E 410D"            /* OKETROMPTRONA */	$"5452 4F4E 430D 5452 4F4E 450D 5452 4F4E"            /* TRONCTRONETRON */	$"4B0D 5452 4F4E 530D 5452 4F4F 5A0D 5452"            /* KTRONSTROOZTR */	$"4F54 480D 5452 4F54 530D 5452 4F57 530D"            /* OTHTROTSTROWS */	$"5452 4F59 530D 5452 5545 440D 5452 5545"            /* TROYSTRUEDTRUE */	$"530D 5452 5547 4F0D 5452 5547 530D 5452"            /* STRUGOTRUGSTR */	$"554C 4C0D 5452 5945 520D 5452 594B 450D"            /* ULLTRYERTRYKE */	$"5452 594D 410D 5452 5950 530D 5453 4144"            /* TRYMATRYPSTSAD */	$"450D 5453 4144 490D 5453 4152 530D 5453"            /* ETSADITSARSTS */	$"4B45 440D 5453 5542 410D 5453 5542 4F0D"            /* KEDTSUBATSUBO */	$"5455 414E 530D 5455 4152 540D 5455 4154"            /* TUANSTUARTTUAT */	$"480D 5455 4241 450D 5455 4241 520D 5455"            /* HTUBAETUBARTU */	$"4241 530D 5455 4242 590D 5455 4245 440D"            /* BASTUBBYTUBED */	$"5455 4245 530D 5455 434B 530D 5455 4641"            /* TUBESTUCKSTUFA */	$"530D 5455 4646 450D 5455 4646 530D 5455"            /* STUFFETUFFSTU */	$"4654 530D 5455 4654 590D 5455 4752 410D"            /* FTSTUFTYTUGRA */	$"5455 494C 450D 5455 494E 410D 5455 4953"            /* TUILETUINATUIS */	$"4D0D 5455 4B54 550D 5455 4C45 530D 5455"            /* MTUKTUTULESTU */	$"4C50 410D 5455 4C53 490D 5455 4D49 440D"            /* LPATULSITUMID */	$"5455 4D4D 590D 5455 4D50 530D 5455 4D50"            /* TUMMYTUMPSTUMP */	$"590D 5455 4E41 530D 5455 4E44 530D 5455"            /* YTUNASTUNDSTU */	$"4E45 440D 5455 4E45 520D 5455 4E45 530D"            /* NEDTUNERTUNES */	$"5455 4E47 530D 5455 4E4E 590D 5455 5045"            /* TUNGSTUNNYTUPE */	$"4B0D 5455 5049 4B0D 5455 504C 450D 5455"            /* KTUPIKTUPLETU */	$"5155 450D 5455 5244 530D 5455 5246 530D"            /* QUETURDSTURFS */	$"5455 5246 590D 5455 524B 530D 5455 524D"            /* TURFYTURKSTURM */	$"450D 5455 524D 530D 5455 524E 530D 5455"            /* ETURMSTURNSTU */	$"524E 540D 5455 5250 530D 5455 5252 530D"            /* RNTTURPSTURRS */	$"5455 5348 590D 5455 534B 530D 5455 534B"            /* TUSHYTUSKSTUSK */	$"590D 5455 5445 450D 5455 5454 490D 5455"            /* YTUTEETUTTITU */	$"5454 590D 5455 5455 530D 5455 5845 530D"            /* TTYTUTUSTUXES */	$"5455 5945 520D 5457 4145 530D 5457 4149"            /* TUYERTWAESTWAI */	$"4E0D 5457 414C 530D 5457 414E 4B0D 5457"            /* NTWALSTWANKTW */	$"4154 530D 5457 4159 530D 5457 4545 4C0D"            /* ATSTWAYSTWEEL */	$"5457 4545 4E0D 5457 4545 500D 5457 4545"            /* TWEENTWEEPTWEE */	$"520D 5457 4552 4B0D 5457 4552 500D 5457"            /* RTWERKTWERPTW */	$"4945 520D 5457 4947 530D 5457 494C 4C0D"            /* IERTWIGSTWILL */	$"5457 494C 540D 5457 494E 4B0D 5457 494E"            /* TWILTTWINKTWIN */	$"530D 5457 494E 590D 5457 4952 450D 5457"            /* STWINYTWIRETW */	$"4952 500D 5457 4954 450D 5457 4954 530D"            /* IRPTWITETWITS */	$"5457 4F45 520D 5457 5945 520D 5459 4545"            /* TWOERTWYERTYEE */	$"530D 5459 4552 530D 5459 4959 4E0D 5459"            /* STYERSTYIYNTY */	$"4B45 530D 5459 4C45 520D 5459 4D50 530D"            /* KESTYLERTYMPS */	$"5459 4E44 450D 5459 4E45 440D 5459 4E45"            /* TYNDETYNEDTYNE */	$"530D 5459 5041 4C0D 5459 5045 440D 5459"            /* STYPALTYPEDTY */	$"5045 530D 5459 5045 590D 5459 5049 430D"            /* PESTYPEYTYPIC */	$"5459 504F 530D 5459 5050 530D 5459 5054"            /* TYPOSTYPPSTYPT */	$"4F0D 5459 5241 4E0D 5459 5245 440D 5459"            /* OTYRANTYREDTY */	$"5245 530D 5459 524F 530D 5459 5448 450D"            /* RESTYROSTYTHE */	$"545A 4152 530D 5544 414C 530D 5544 4F4E"            /* TZARSUDALSUDON */	$"530D 5547 414C 490D 5547 4745 440D 5548"            /* SUGALIUGGEDUH */	$"4C41 4E0D 5548 5552 550D 554B 4153 450D"            /* LANUHURUUKASE */	$"554C 414D 410D 554C 414E 530D 554C 454D"            /* ULAMAULANSULEM */	$"410D 554C 4D49 4E0D 554C 4E41 440D 554C"            /* AULMINULNADUL */	$"4E41 450D 554C 4E41 520D 554C 4E41 530D"            /* NAEULNARULNAS */	$"554C 5041 4E0D 554C 5641 530D 554C 5949"            /* ULPANULVASULYI */	$"450D 554C 5A49 450D 554D 414D 490D 554D"            /* EULZIEUMAMIUM */	$"4245 4C0D 554D 4245 520D 554D 424C 450D"            /* BELUMBERUMBLE */	$"554D 424F 530D 554D 4252 450D 554D 4941"            /* UMBOSUMBREUMIA */	$"430D 554D 4941 4B0D 554D 4941 510D 554D"            /* CUMIAKUMIAQUM */	$"4D41 480D 554D 4D41 530D 554D 4D45 440D"            /* MAHUMMASUMMED */	$"554D 5045 440D 554D 5048 530D 554D 5049"            /* UMPEDUMPHSUMPI */	$"450D 554D 5054 590D 554D 5241 480D 554D"            /* EUMPTYUMRAHUM */	$"5241 530D 554E 4149 530D 554E 4150 540D"            /* RASUNAISUNAPT */	$"554E 4152 4D0D 554E 4152 590D 554E 4155"            /* UNARMUNARYUNAU */	$"530D 554E 4241 470D 554E 4241 4E0D 554E"            /* SUNBAGUNBANUN */	$"4241 520D 554E 4245 440D 554E 4249 440D"            /* BARUNBEDUNBID */	$"554E 424F 580D 554E 4341 500D 554E 4345"            /* UNBOXUNCAPUNCE */	$"530D 554E 4349 410D 554E 434F 530D 554E"            /* SUNCIAUNCOSUN */	$"434F 590D 554E 4355 530D 554E 4441 4D0D"            /* COYUNCUSUNDAM */	$"554E 4445 450D 554E 444F 530D 554E 4455"            /* UNDEEUNDOSUNDU */	$"470D 554E 4554 480D 554E 4649 580D 554E"            /* GUNETHUNFIXUN */	$"4741 470D 554E 4745 540D 554E 474F 440D"            /* GAGUNGETUNGOD */	$"554E 474F 540D 554E 4755 4D0D 554E 4841"            /* UNGOTUNGUMUNHA */	$"540D 554E 4849 500D 554E 4943 410D 554E"            /* TUNHIPUNICAUN */	$"4954 530D 554E 4A41 4D0D 554E 4B45 440D"            /* ITSUNJAMUNKED */	$"554E 4B45 540D 554E 4B49 440D 554E 4C41"            /* UNKETUNKIDUNLA */	$"570D 554E 4C41 590D 554E 4C45 440D 554E"            /* WUNLAYUNLEDUN */	$"4C45 540D 554E 4C49 440D 554E 4D41 4E0D"            /* LETUNLIDUNMAN */	$"554E 4D45 570D 554E 4D49 580D 554E 5041"            /* UNMEWUNMIXUNPA */	$"590D 554E 5045 470D 554E 5045 4E0D 554E"            /* YUNPEGUNPENUN */	$"5049 4E0D 554E 5245 440D 554E 5249 440D"            /* PINUNREDUNRID */	$"554E 5249 470D 554E 5249 500D 554E 5341"            /* UNRIGUNRIPUNSA */	$"570D 554E 5341 590D 554E 5345 450D 554E"            /* WUNSAYUNSEEUN */	$"5345 570D 554E 5345 580D 554E 534F 440D"            /* SEWUNSEXUNSOD */	$"554E 5441 580D 554E 5449 4E0D 554E 5745"            /* UNTAXUNTINUNWE */	$"540D 554E 5749 540D 554E 574F 4E0D 5550"            /* TUNWITUNWONUP */	$"424F 570D 5550 4259 450D 5550 444F 530D"            /* BOWUPBYEUPDOS */	$"5550 4452 590D 5550 454E 440D 5550 4A45"            /* UPDRYUPENDUPJE */	$"540D 5550 4C41 590D 5550 4C45 440D 5550"            /* TUPLAYUPLEDUP */	$"4C49 540D 5550 5045 440D 5550 5241 4E0D"            /* LITUPPEDUPRAN */	$"5550 5255 4E0D 5550 5345 450D 5550 5345"            /* UPRUNUPSEEUPSE */	$"590D 5550 5441 4B0D 5550 5445 520D 5550"            /* YUPTAKUPTERUP */	$"5449 450D 5552 4145 490D 5552 414C 490D"            /* TIEURAEIURALI */	$"5552 414F 530D 5552 4152 450D 5552 4152"            /* URAOSURAREURAR */	$"490D 5552 4153 450D 5552 4154 450D 5552"            /* IURASEURATEUR */	$"4245 580D 5552 4249 410D 5552 4445 450D"            /* BEXURBIAURDEE */	$"5552 4541 4C0D 5552 4541 530D 5552 4544"            /* UREALUREASURED */	$"4F0D 5552 4549 430D 5552 454E 410D 5552"            /* OUREICURENAUR */	$"454E 540D 5552 4745 440D 5552 4745 520D"            /* ENTURGEDURGER */	$"5552 4745 530D 5552 4941 4C0D 5552 4954"            /* URGESURIALURIT */	$"450D 5552 4D41 4E0D 5552 4E41 4C0D 5552"            /* EURMANURNALUR */	$"4E45 440D 5552 5045 440D 5552 5341 450D"            /* NEDURPEDURSAE */	$"5552 5349 440D 5552 534F 4E0D 5552 5542"            /* URSIDURSONURUB */	$"550D 5552 5641 530D 5553 4552 530D 5553"            /* UURVASUSERSUS */	$"4E45 410D 5553 5155 450D 5553 5552 450D"            /* NEAUSQUEUSURE */	$"5553 5552 590D 5554 4552 490D 5556 4541"            /* USURYUTERIUVEA */	$"4C0D 5556 4541 530D 5556 554C 410D 5641"            /* LUVEASUVULAVA */	$"4355 410D 5641 4445 440D 5641 4445 530D"            /* CUAVADEDVADES */	$"5641 4741 4C0D 5641 4755 530D 5641 494C"            /* VAGALVAGUSVAIL */	$"530D 5641 4952 450D 5641 4952 530D 5641"            /* SVAIREVAIRSVA */	$"4952 590D 5641 4B41 530D 5641 4B49 4C0D"            /* IRYVAKASVAKIL */	$"5641 4C45 530D 5641 4C49 530D 5641 4C53"            /* VALESVALISVALS */	$"450D 5641 4D50 530D 5641 4D50 590D 5641"            /* EVAMPSVAMPYVA */	$"4E44 410D 5641 4E45 440D 5641 4E45 530D"            /* NDAVANEDVANES */	$"5641 4E47 530D 5641 4E54 530D 5641 5045"            /* VANGSVANTSVAPE */	$"440D 5641 5045 520D 5641 5045 530D 5641"            /* DVAPERVAPESVA */	$"5241 4E0D 5641 5241 530D 5641 5244 590D"            /* RANVARASVARDY */	$"5641 5245 430D 5641 5245 530D 5641 5249"            /* VARECVARESVARI */	$"410D 5641 5249 580D 5641 524E 410D 5641"            /* AVARIXVARNAVA */	$"5255 530D 5641 5256 450D 5641 5341 4C0D"            /* RUSVARVEVASAL */	$"5641 5345 530D 5641 5354 530D 5641 5354"            /* VASESVASTSVAST */	$"590D 5641 5449 430D 5641 5455 530D 5641"            /* YVATICVATUSVA */	$"5543 480D 5641 5554 450D 5641 5554 530D"            /* UCHVAUTEVAUTS */	$"5641 5754 450D 5641 5845 530D 5645 414C"            /* VAWTEVAXESVEAL */	$"450D 5645 414C 530D 5645 414C 590D 5645"            /* EVEALSVEALYVE */	$"454E 410D 5645 4550 530D 5645 4552 530D"            /* ENAVEEPSVEERS */	$"5645 4552 590D 5645 4741 530D 5645 4745"            /* VEERYVEGASVEGE */	$"530D 5645 4749 450D 5645 474F 530D 5645"            /* SVEGIEVEGOSVE */	$"484D 450D 5645 494C 530D 5645 494C 590D"            /* HMEVEILSVEILY */	$"5645 494E 530D 5645 494E 590D 5645 4C41"            /* VEINSVEINYVELA */	$"520D 5645 4C44 530D 5645 4C44 540D 5645"            /* RVELDSVELDTVE */	$"4C45 530D 5645 4C4C 530D 5645 4C55 4D0D"            /* LESVELLSVELUM */	$"5645 4E41 450D 5645 4E41 4C0D 5645 4E44"            /* VENAEVENALVEND */	$"530D 5645 4E44 550D 5645 4E45 590D 5645"            /* SVENDUVENEYVE */	$"4E47 450D 5645 4E49 4E0D 5645 4E54 530D"            /* NGEVENINVENTS */	$"5645 4E55 530D 5645 5242 530D 5645 5252"            /* VENUSVERBSVERR */	$"410D 5645 5252 590D 5645 5253 540D 5645"            /* AVERRYVERSTVE */	$"5254 530D 5645 5254 550D 5645 5350 410D"            /* RTSVERTUVESPA */	$"5645 5354 410D 5645 5354 530D 5645 5443"            /* VESTAVESTSVETC */	$"480D 5645 5845 440D 5645 5845 520D 5645"            /* HVEXEDVEXERVE */	$"5845 530D 5645 5849 4C0D 5645 5A49 520D"            /* XESVEXILVEZIR */	$"5649 414C 530D 5649 414E 440D 5649 4245"            /* VIALSVIANDVIBE */	$"530D 5649 4245 580D 5649 4245 590D 5649"            /* SVIBEXVIBEYVI */	$"4345 440D 5649 4345 530D 5649 4348 590D"            /* CEDVICESVICHY */	$"5649 4552 530D 5649 4557 530D 5649 4557"            /* VIERSVIEWSVIEW */	$"590D 5649 4644 410D 5649 4646 530D 5649"            /* YVIFDAVIFFSVI */	$"4741 530D 5649 4749 410D 5649 4C44 450D"            /* GASVIGIAVILDE */	$"5649 4C45 520D 5649 4C4C 490D 5649 4C4C"            /* VILERVILLIVILL */	$"530D 5649 4D45 4E0D 5649 4E41 4C0D 5649"            /* SVIMENVINALVI */	$"4E41 530D 5649 4E43 410D 5649 4E45 440D"            /* NASVINCAVINED */	$"5649 4E45 520D 5649 4E45 530D 5649 4E45"            /* VINERVINESVINE */	$"570D 5649 4E49 430D 5649 4E4F 530D 5649"            /* WVINICVINOSVI */	$"4E54 530D 5649 4F4C 440D 5649 4F4C 530D"            /* NTSVIOLDVIOLS */	$"5649 5245 440D 5649 5245 4F0D 5649 5245"            /* VIREDVIREOVIRE */	$"530D 5649 5247 410D 5649 5247 450D 5649"            /* SVIRGAVIRGEVI */	$"5249 440D 5649 524C 530D 5649 5254 550D"            /* RIDVIRLSVIRTU */	$"5649 5341 530D 5649 5345 440D 5649 5345"            /* VISASVISEDVISE */	$"530D 5649 5349 450D 5649 534E 450D 5649"            /* SVISIEVISNEVI */	$"534F 4E0D 5649 5354 4F0D 5649 5441 450D"            /* SONVISTOVITAE */	$"5649 5441 530D 5649 5445 580D 5649 5452"            /* VITASVITEXVITR */	$"4F0D 5649 5454 410D 5649 5641 530D 5649"            /* OVITTAVIVASVI */	$"5641 540D 5649 5644 410D 5649 5645 520D"            /* VATVIVDAVIVER */	$"5649 5645 530D 5649 5A49 520D 5649 5A4F"            /* VIVESVIZIRVIZO */	$"520D 564C 4549 530D 564C 4945 530D 564C"            /* RVLEISVLIESVL */	$"4F47 530D 564F 4152 530D 564F 4341 420D"            /* OGSVOARSVOCAB */	$"564F 4345 530D 564F 4444 590D 564F 444F"            /* VOCESVODDYVODO */	$"550D 564F 4455 4E0D 564F 454D 410D 564F"            /* UVODUNVOEMAVO */	$"4749 450D 564F 4944 530D 564F 494C 450D"            /* GIEVOIDSVOILE */	$"564F 4950 530D 564F 4C41 450D 564F 4C41"            /* VOIPSVOLAEVOLA */	$"520D 564F 4C45 440D 564F 4C45 530D 564F"            /* RVOLEDVOLESVO */	$"4C45 540D 564F 4C4B 530D 564F 4C54 410D"            /* LETVOLKSVOLTA */	$"564F 4C54 450D 564F 4C54 490D 564F 4C54"            /* VOLTEVOLTIVOLT */	$"530D 564F 4C56 410D 564F 4C56 450D 564F"            /* SVOLVAVOLVEVO */	$"4D45 520D 564F 5445 440D 564F 5445 530D"            /* MERVOTEDVOTES */	$"564F 5547 450D 564F 554C 550D 564F 5745"            /* VOUGEVOULUVOWE */	$"440D 564F 5745 520D 564F 5845 4C0D 564F"            /* DVOWERVOXELVO */	$"5A48 440D 5652 4149 430D 5652 494C 530D"            /* ZHDVRAICVRILS */	$"5652 4F4F 4D0D 5652 4F55 530D 5652 4F55"            /* VROOMVROUSVROU */	$"570D 5652 4F57 530D 5655 4747 530D 5655"            /* WVROWSVUGGSVU */	$"4747 590D 5655 4748 530D 5655 4748 590D"            /* GGYVUGHSVUGHY */	$"5655 4C47 4F0D 5655 4C4E 530D 5655 4C56"            /* VULGOVULNSVULV */	$"410D 5655 5454 590D 5741 4143 530D 5741"            /* AVUTTYWAACSWA */	$"434B 450D 5741 434B 4F0D 5741 434B 530D"            /* CKEWACKOWACKS */	$"5741 4444 530D 5741 4444 590D 5741 4445"            /* WADDSWADDYWADE */	$"440D 5741 4445 520D 5741 4445 530D 5741"            /* DWADERWADESWA */	$"4447 450D 5741 4449 530D 5741 4454 530D"            /* DGEWADISWADTS */	$"5741 4646 530D 5741 4654 530D 5741 4745"            /* WAFFSWAFTSWAGE */	$"440D 5741 4745 530D 5741 4747 410D 5741"            /* DWAGESWAGGAWA */	$"4759 550D 5741 484F 4F0D 5741 4944 450D"            /* GYUWAHOOWAIDE */	$"5741 4946 530D 5741 4946 540D 5741 494C"            /* WAIFSWAIFTWAIL */	$"530D 5741 494E 530D 5741 4952 530D 5741"            /* SWAINSWAIRSWA */	$"4954 450D 5741 4954 530D 5741 4B41 530D"            /* ITEWAITSWAKAS */	$"5741 4B45 440D 5741 4B45 4E0D 5741 4B45"            /* WAKEDWAKENWAKE */	$"520D 5741 4B45 530D 5741 4B46 530D 5741"            /* RWAKESWAKFSWA */	$"4C44 4F0D 5741 4C44 530D 5741 4C45 440D"            /* LDOWALDSWALED */	$"5741 4C45 520D 5741 4C45 530D 5741 4C49"            /* WALERWALESWALI */	$"450D 5741 4C49 530D 5741 4C4B 530D 5741"            /* EWALISWALKSWA */	$"4C4C 410D 5741 4C4C 530D 5741 4C4C 590D"            /* LLAWALLSWALLY */	$"5741 4C54 590D 5741 4D45 440D 5741 4D45"            /* WALTYWAMEDWAME */	$"530D 5741 4D55 530D 5741 4E44 530D 5741"            /* SWAMUSWANDSWA */	$"4E45 440D 5741 4E45 530D 5741 4E45 590D"            /* NEDWANESWANEY */	$"5741 4E47 530D 5741 4E4B 530D 5741 4E4B"            /* WANGSWANKSWANK */	$"590D 5741 4E4C 450D 5741 4E4C 590D 5741"            /* YWANLEWANLYWA */	$"4E4E 410D 5741 4E54 530D 5741 4E54 590D"            /* NNAWANTSWANTY */	$"5741 4E5A 450D 5741 5146 530D 5741 5242"            /* WANZEWAQFSWARB */	$"530D 5741 5242 590D 5741 5244 530D 5741"            /* SWARBYWARDSWA */	$"5245 440D 5741 5245 530D 5741 5245 5A0D"            /* REDWARESWAREZ */	$"5741 524B 530D 5741 524D 530D 5741 524E"            /* WARKSWARMSWARN */	$"530D 5741 5250 530D 5741 5252 450D 5741"            /* SWARPSWARREWA */	$"5253 540D 5741 5254 530D 5741 5345 530D"            /* RSTWARTSWASES */	$"5741 5348 590D 5741 534D 530D 5741 5350"            /* WASHYWASMSWASP */	$"530D 5741 5350 590D 5741 5354 530D 5741"            /* SWASPYWASTSWA */	$"5441 500D 5741 5454 530D 5741 5546 460D"            /* TAPWATTSWAUFF */	$"5741 5547 480D 5741 554B 530D 5741 554C"            /* WAUGHWAUKSWAUL */	$"4B0D 5741 554C 530D 5741 5552 530D 5741"            /* KWAULSWAURSWA */	$"5645 440D 5741 5645 530D 5741 5645 590D"            /* VEDWAVESWAVEY */	$"5741 5741 530D 5741 5745 530D 5741 574C"            /* WAWASWAWESWAWL */	$"530D 5741 5845 440D 5741 5845 520D 5741"            /* SWAXEDWAXERWA */	$"5845 530D 5741 5945 440D 5741 5A49 520D"            /* XESWAYEDWAZIR */	$"5741 5A4F 4F0D 5745 414C 440D 5745 414C"            /* WAZOOWEALDWEAL */	$"530D 5745 414D 420D 5745 414E 530D 5745"            /* SWEAMBWEANSWE */	$"4152 530D 5745 4242 590D 5745 4245 520D"            /* ARSWEBBYWEBER */	$"5745 4348 540D 5745 4445 4C0D 5745 4447"            /* WECHTWEDELWEDG */	$"590D 5745 4544 530D 5745 454B 450D 5745"            /* YWEEDSWEEKEWE */	$"454B 530D 5745 454C 530D 5745 454D 530D"            /* EKSWEELSWEEMS */	$"5745 454E 530D 5745 454E 590D 5745 4550"            /* WEENSWEENYWEEP */	$"530D 5745 4550 590D 5745 4553 540D 5745"            /* SWEEPYWEESTWE */	$"4554 450D 5745 4554 530D 5745 4654 450D"            /* ETEWEETSWEFTE */	$"5745 4654 530D 5745 4944 530D 5745 494C"            /* WEFTSWEIDSWEIL */	$"530D 5745 4952 530D 5745 4953 450D 5745"            /* SWEIRSWEISEWE */	$"495A 450D 5745 4B41 530D 5745 4C44 530D"            /* IZEWEKASWELDS */	$"5745 4C4B 450D 5745 4C4B 530D 5745 4C4B"            /* WELKEWELKSWELK */	$"540D 5745 4C4C 530D 5745 4C4C 590D 5745"            /* TWELLSWELLYWE */	$"4C54 530D 5745 4D42 530D 5745 4E43 480D"            /* LTSWEMBSWENCH */	$"5745 4E44 530D 5745 4E47 450D 5745 4E4E"            /* WENDSWENGEWENN */	$"590D 5745 4E54 530D 5745 524F 530D 5745"            /* YWENTSWEROSWE */	$"5253 480D 5745 5354 530D 5745 5441 530D"            /* RSHWESTSWETAS */	$"5745 544C 590D 5745 5845 440D 5745 5845"            /* WETLYWEXEDWEXE */	$"530D 5748 414D 4F0D 5748 414D 530D 5748"            /* SWHAMOWHAMSWH */	$"414E 470D 5748 4150 530D 5748 4152 450D"            /* ANGWHAPSWHARE */	$"5748 4154 410D 5748 4154 530D 5748 4155"            /* WHATAWHATSWHAU */	$"500D 5748 4155 520D 5748 4541 4C0D 5748"            /* PWHAURWHEALWH */	$"4541 520D 5748 4545 4E0D 5748 4545 500D"            /* EARWHEENWHEEP */	$"5748 4546 540D 5748 454C 4B0D 5748 454C"            /* WHEFTWHELKWHEL */	$"4D0D 5748 454E 530D 5748 4554 530D 5748"            /* MWHENSWHETSWH */	$"4557 530D 5748 4559 530D 5748 4944 530D"            /* EWSWHEYSWHIDS */	$"5748 4946 540D 5748 4947 530D 5748 494C"            /* WHIFTWHIGSWHIL */	$"4B0D 5748 494D 530D 5748 494E 530D 5748"            /* KWHIMSWHINSWH */	$"494F 530D 5748 4950 530D 5748 4950 540D"            /* IOSWHIPSWHIPT */	$"5748 4952 520D 5748 4952 530D 5748 4953"            /* WHIRRWHIRSWHIS */	$"480D 5748 4953 530D 5748 4953 540D 5748"            /* HWHISSWHISTWH */	$"4954 530D 5748 4954 590D 5748 495A 5A0D"            /* ITSWHITYWHIZZ */	$"5748 4F4D 500D 5748 4F4F 460D 5748 4F4F"            /* WHOMPWHOOFWHOO */	$"540D 5748 4F50 530D 5748 4F52 450D 5748"            /* TWHOPSWHOREWH */	$"4F52 4C0D 5748 4F52 540D 5748 4F53 4F0D"            /* ORLWHORTWHOSO */	$"5748 4F57 530D 5748 554D 500D 5748 5550"            /* WHOWSWHUMPWHUP */	$"530D 5748 5944 410D 5749 4343 410D 5749"            /* SWHYDAWICCAWI */	$"434B 530D 5749 434B 590D 5749 4444 590D"            /* CKSWICKYWIDDY */	$"5749 4445 530D 5749 454C 530D 5749 4645"            /* WIDESWIELSWIFE */	$"440D 5749 4645 530D 5749 4645 590D 5749"            /* DWIFESWIFEYWI */	$"4649 450D 5749 4654 590D 5749 4741 4E0D"            /* FIEWIFTYWIGAN */	$"5749 4747 410D 5749 4747 590D 5749 4B49"            /* WIGGAWIGGYWIKI */	$"530D 5749 4C43 4F0D 5749 4C44 530D 5749"            /* SWILCOWILDSWI */	$"4C45 440D 5749 4C45 530D 5749 4C47 410D"            /* LEDWILESWILGA */	$"5749 4C49 530D 5749 4C4A 410D 5749 4C4C"            /* WILISWILJAWILL */	$"530D 5749 4C54 530D 5749 4D50 530D 5749"            /* SWILTSWIMPSWI */	$"4E44 530D 5749 4E45 440D 5749 4E45 530D"            /* NDSWINEDWINES */	$"5749 4E45 590D 5749 4E47 450D 5749 4E47"            /* WINEYWINGEWING */	$"530D 5749 4E47 590D 5749 4E4B 530D 5749"            /* SWINGYWINKSWI */	$"4E4E 410D 5749 4E4E 530D 5749 4E4F 530D"            /* NNAWINNSWINOS */	$"5749 4E5A 450D 5749 5045 440D 5749 5045"            /* WINZEWIPEDWIPE */	$"520D 5749 5045 530D 5749 5245 440D 5749"            /* RWIPESWIREDWI */	$"5245 520D 5749 5245 530D 5749 5252 410D"            /* RERWIRESWIRRA */	$"5749 5345 440D 5749 5345 530D 5749 5348"            /* WISEDWISESWISH */	$"410D 5749 5348 540D 5749 5350 530D 5749"            /* AWISHTWISPSWI */	$"5354 530D 5749 5441 4E0D 5749 5445 440D"            /* STSWITANWITED */	$"5749 5445 530D 5749 5448 450D 5749 5448"            /* WITESWITHEWITH */	$"530D 5749 5448 590D 5749 5645 440D 5749"            /* SWITHYWIVEDWI */	$"5645 520D 5749 5645 530D 5749 5A45 4E0D"            /* VERWIVESWIZEN */	$"5749 5A45 530D 574F 4144 530D 574F 414C"            /* WIZESWOADSWOAL */	$"440D 574F 434B 530D 574F 4447 450D 574F"            /* DWOCKSWODGEWO */	$"4655 4C0D 574F 4A55 530D 574F 4B45 520D"            /* FULWOJUSWOKER */	$"574F 4B4B 410D 574F 4C44 530D 574F 4C46"            /* WOKKAWOLDSWOLF */	$"530D 574F 4C4C 590D 574F 4C56 450D 574F"            /* SWOLLYWOLVEWO */	$"4D42 530D 574F 4D42 590D 574F 4D59 4E0D"            /* MBSWOMBYWOMYN */	$"574F 4E47 410D 574F 4E47 490D 574F 4E4B"            /* WONGAWONGIWONK */	$"530D 574F 4E4B 590D 574F 4E54 530D 574F"            /* SWONKYWONTSWO */	$"4F44 530D 574F 4F45 440D 574F 4F46 530D"            /* ODSWOOEDWOOFS */	$"574F 4F46 590D 574F 4F4C 440D 574F 4F4C"            /* WOOFYWOOLDWOOL */	$"530D 574F 4F4E 530D 574F 4F50 530D 574F"            /* SWOONSWOOPSWO */	$"4F50 590D 574F 4F53 450D 574F 4F53 480D"            /* OPYWOOSEWOOSH */	$"574F 4F54 5A0D 574F 5244 530D 574F 524B"            /* WOOTZWORDSWORK */	$"530D 574F 524D 530D 574F 524D 590D 574F"            /* SWORMSWORMYWO */	$"5254 530D 574F 5745 440D 574F 5745 450D"            /* RTSWOWEDWOWEE */	$"574F 5845 4E0D 5752 414E 470D 5752 4150"            /* WOXENWRANGWRAP */	$"530D 5752 4150 540D 5752 4153 540D 5752"            /* SWRAPTWRASTWR */	$"4154 450D 5752 4157 4C0D 5752 454E 530D"            /* ATEWRAWLWRENS */	$"5752 4943 4B0D 5752 4945 440D 5752 4945"            /* WRICKWRIEDWRIE */	$"520D 5752 4945 530D 5752 4954 530D 5752"            /* RWRIESWRITSWR */	$"4F4B 450D 5752 4F4F 540D 5752 4F54 480D"            /* OKEWROOTWROTH */	$"5752 5945 520D 5755 4444 590D 5755 4455"            /* WRYERWUDDYWUDU */	$"530D 5755 4C4C 530D 5755 5253 540D 5755"            /* SWULLSWURSTWU */	$"5345 530D 5755 5348 550D 5755 5353 590D"            /* SESWUSHUWUSSY */	$"5755 5849 410D 5759 4C45 440D 5759 4C45"            /* WUXIAWYLEDWYLE */	$"530D 5759 4E44 530D 5759 4E4E 530D 5759"            /* SWYNDSWYNNSWY */	$"5445 440D 5759 5445 530D 5845 4245 430D"            /* TEDWYTESXEBEC */	$"5845 4E49 410D 5845 4E49 430D 5845 4E4F"            /* XENIAXENICXENO */	$"4E0D 5845 5249 430D 5845 524F 580D 5845"            /* NXERICXEROXXE */	$"5255 530D 584F 414E 410D 5852 4159 530D"            /* RUSXOANAXRAYS */	$"5859 4C41 4E0D 5859 4C45 4D0D 5859 4C49"            /* XYLANXYLEMXYLI */	$"430D 5859 4C4F 4C0D 5859 4C59 4C0D 5859"            /* CXYLOLXYLYLXY */	$"5354 490D 5859 5354 530D 5941 4152 530D"            /* STIXYSTSYAARS */	$"5941 4241 530D 5941 4242 410D 5941 4242"            /* YABASYABBAYABB */	$"590D 5941 4343 410D 5941 434B 410D 5941"            /* YYACCAYACKAYA */	$"434B 530D 5941 4646 530D 5941 4745 520D"            /* CKSYAFFSYAGER */	$"5941 4745 530D 5941 4749 530D 5941 484F"            /* YAGESYAGISYAHO */	$"4F0D 5941 4952 440D 5941 4B4B 410D 5941"            /* OYAIRDYAKKAYA */	$"4B4F 570D 5941 4C45 530D 5941 4D45 4E0D"            /* KOWYALESYAMEN */	$"5941 4D50 590D 5941 4D55 4E0D 5941 4E47"            /* YAMPYYAMUNYANG */	$"530D 5941 4E4B 530D 5941 504F 4B0D 5941"            /* SYANKSYAPOKYA */	$"504F 4E0D 5941 5050 530D 5941 5050 590D"            /* PONYAPPSYAPPY */	$"5941 5241 4B0D 5941 5243 4F0D 5941 5244"            /* YARAKYARCOYARD */	$"530D 5941 5245 520D 5941 5246 410D 5941"            /* SYARERYARFAYA */	$"524B 530D 5941 524E 530D 5941 5252 530D"            /* RKSYARNSYARRS */	$"5941 5254 410D 5941 5254 4F0D 5941 5445"            /* YARTAYARTOYATE */	$"530D 5941 5544 530D 5941 554C 440D 5941"            /* SYAUDSYAULDYA */	$"5550 530D 5941 5745 440D 5941 5745 590D"            /* UPSYAWEDYAWEY */	$"5941 574C 530D 5941 574E 530D 5941 574E"            /* YAWLSYAWNSYAWN */	$"590D 5941 5750 530D 5942 4F52 450D 5943"            /* YYAWPSYBOREYC */	$"4C41 440D 5943 4C45 440D 5943 4F4E 440D"            /* LADYCLEDYCOND */	$"5944 5241 440D 5944 5245 440D 5945 4144"            /* YDRADYDREDYEAD */	$"530D 5945 4148 530D 5945 414C 4D0D 5945"            /* SYEAHSYEALMYE */	$"414E 530D 5945 4152 440D 5945 4152 530D"            /* ANSYEARDYEARS */	$"5945 4343 480D 5945 4348 530D 5945 4348"            /* YECCHYECHSYECH */	$"590D 5945 4445 530D 5945 4544 530D 5945"            /* YYEDESYEEDSYE */	$"4553 480D 5945 4747 530D 5945 4C4B 530D"            /* ESHYEGGSYELKS */	$"5945 4C4C 530D 5945 4C4D 530D 5945 4C50"            /* YELLSYELMSYELP */	$"530D 5945 4C54 530D 5945 4E54 410D 5945"            /* SYELTSYENTAYE */	$"4E54 450D 5945 5242 410D 5945 5244 530D"            /* NTEYERBAYERDS */	$"5945 524B 530D 5945 5345 530D 5945 534B"            /* YERKSYESESYESK */	$"530D 5945 5354 530D 5945 5354 590D 5945"            /* SYESTSYESTYYE */	$"5449 530D 5945 5454 530D 5945 554B 530D"            /* TISYETTSYEUKS */	$"5945 554B 590D 5945 5645 4E0D 5945 5645"            /* YEUKYYEVENYEVE */	$"530D 5945 5745 4E0D 5945 5845 440D 5945"            /* SYEWENYEXEDYE */	$"5845 530D 5946 4552 450D 5949 4B45 440D"            /* XESYFEREYIKED */	$"5949 4B45 530D 5949 4C4C 530D 5949 4E43"            /* YIKESYILLSYINC */	$"450D 5949 5045 530D 5949 5050 590D 5949"            /* EYIPESYIPPYYI */	$"5244 530D 5949 524B 530D 5949 5252 530D"            /* RDSYIRKSYIRRS */	$"5949 5254 480D 5949 5445 530D 5949 5449"            /* YIRTHYITESYITI */	$"450D 594C 454D 530D 594C 494B 450D 594C"            /* EYLEMSYLIKEYL */	$"4B45 530D 594D 4F4C 540D 594D 5045 530D"            /* KESYMOLTYMPES */	$"594F 4242 4F0D 594F 4242 590D 594F 434B"            /* YOBBOYOBBYYOCK */	$"530D 594F 4445 4C0D 594F 4448 530D 594F"            /* SYODELYODHSYO */	$"444C 450D 594F 4741 530D 594F 4745 450D"            /* DLEYOGASYOGEE */	$"594F 4748 530D 594F 4749 430D 594F 4749"            /* YOGHSYOGICYOGI */	$"4E0D 594F 4749 530D 594F 4943 4B0D 594F"            /* NYOGISYOICKYO */	$"4A41 4E0D 594F 4B45 440D 594F 4B45 4C0D"            /* JANYOKEDYOKEL */	$"594F 4B45 520D 594F 4B45 530D 594F 4B55"            /* YOKERYOKESYOKU */	$"4C0D 594F 4C4B 530D 594F 4C4B 590D 594F"            /* LYOLKSYOLKYYO */	$"4D49 4D0D 594F 4D50 530D 594F 4E49 430D"            /* MIMYOMPSYONIC */	$"594F 4E49 530D 594F 4E4B 530D 594F 4F46"            /* YONISYONKSYOOF */	$"530D 594F 4F50 530D 594F 5245 530D 594F"            /* SYOOPSYORESYO */	$"524B 530D 594F 5250 530D 594F 554B 530D"            /* RKSYORPSYOUKS */	$"594F 5552 4E0D 594F 5552 530D 594F 5552"            /* YOURNYOURSYOUR */	$"540D 594F 5553 450D 594F 5745 440D 594F"            /* TYOUSEYOWEDYO */	$"5745 530D 594F 5749 450D 594F 574C 530D"            /* WESYOWIEYOWLS */	$"594F 575A 410D 5952 4150 540D 5952 454E"            /* YOWZAYRAPTYREN */	$"540D 5952 4956 440D 5952 4E45 480D 5953"            /* TYRIVDYRNEHYS */	$"414D 450D 5954 4F53 540D 5955 414E 530D"            /* AMEYTOSTYUANS */	$"5955 4341 530D 5955 4343 410D 5955 4343"            /* YUCASYUCCAYUCC */	$"480D 5955 434B 4F0D 5955 434B 530D 5955"            /* HYUCKOYUCKSYU */	$"434B 590D 5955 4654 530D 5955 4741 530D"            /* CKYYUFTSYUGAS */	$"5955 4B45 440D 5955 4B45 530D 5955 4B4B"            /* YUKEDYUKESYUKK */	$"590D 5955 4B4F 530D 5955 4C41 4E0D 5955"            /* YYUKOSYULANYU */	$"4C45 530D 5955 4D4D 4F0D 5955 4D4D 590D"            /* LESYUMMOYUMMY */	$"5955 4D50 530D 5955 504F 4E0D 5955 5050"            /* YUMPSYUPONYUPP */	$"590D 5955 5254 410D 5955 5254 530D 5955"            /* YYURTAYURTSYU */	$"5A55 530D 5A41 4252 410D 5A41 434B 530D"            /* ZUSZABRAZACKS */	$"5A41 4944 410D 5A41 4944 590D 5A41 4952"            /* ZAIDAZAIDYZAIR */	$"450D 5A41 4B41 540D 5A41 4D41 4E0D 5A41"            /* EZAKATZAMANZA */	$"4D42 4F0D 5A41 4D49 410D 5A41 4E4A 410D"            /* MBOZAMIAZANJA */	$"5A41 4E54 450D 5A41 4E5A 410D 5A41 4E5A"            /* ZANTEZANZAZANZ */	$"450D 5A41 5050 590D 5A41 5246 530D 5A41"            /* EZAPPYZARFSZA */	$"5249 530D 5A41 5449 530D 5A41 5845 530D"            /* RISZATISZAXES */	$"5A41 5949 4E0D 5A41 5A45 4E0D 5A45 414C"            /* ZAYINZAZENZEAL */	$"530D 5A45 4245 430D 5A45 4255 420D 5A45"            /* SZEBECZEBUBZE */	$"4255 530D 5A45 4441 530D 5A45 494E 530D"            /* BUSZEDASZEINS */	$"5A45 4E44 4F0D 5A45 5244 410D 5A45 524B"            /* ZENDOZERDAZERK */	$"530D 5A45 524F 530D 5A45 5354 530D 5A45"            /* SZEROSZESTSZE */	$"5441 530D 5A45 5845 530D 5A45 5A45 530D"            /* TASZEXESZEZES */	$"5A48 4F4D 4F0D 5A49 4245 540D 5A49 4646"            /* ZHOMOZIBETZIFF */	$"530D 5A49 4741 4E0D 5A49 4C41 530D 5A49"            /* SZIGANZILASZI */	$"4C43 480D 5A49 4C4C 410D 5A49 4C4C 530D"            /* LCHZILLAZILLS */	$"5A49 4D42 490D 5A49 4D42 530D 5A49 4E43"            /* ZIMBIZIMBSZINC */	$"4F0D 5A49 4E43 530D 5A49 4E43 590D 5A49"            /* OZINCSZINCYZI */	$"4E45 420D 5A49 4E45 530D 5A49 4E47 530D"            /* NEBZINESZINGS */	$"5A49 4E47 590D 5A49 4E4B 450D 5A49 4E4B"            /* ZINGYZINKEZINK */	$"590D 5A49 5050 4F0D 5A49 5050 590D 5A49"            /* YZIPPOZIPPYZI */	$"5241 4D0D 5A49 5449 530D 5A49 5A45 4C0D"            /* RAMZITISZIZEL */	$"5A49 5A49 540D 5A4C 4F54 450D 5A4C 4F54"            /* ZIZITZLOTEZLOT */	$"590D 5A4F 4145 410D 5A4F 424F 530D 5A4F"            /* YZOAEAZOBOSZO */	$"4255 530D 5A4F 4343 4F0D 5A4F 4541 450D"            /* BUSZOCCOZOEAE */	$"5A4F 4541 4C0D 5A4F 4541 530D 5A4F 4953"            /* ZOEALZOEASZOIS */	$"4D0D 5A4F 4953 540D 5A4F 4D42 490D 5A4F"            /* MZOISTZOMBIZO */	$"4E41 450D 5A4F 4E44 410D 5A4F 4E45 440D"            /* NAEZONDAZONED */	$"5A4F 4E45 520D 5A4F 4E45 530D 5A4F 4E4B"            /* ZONERZONESZONK */	$"530D 5A4F 4F45 410D 5A4F 4F45 590D 5A4F"            /* SZOOEAZOOEYZO */	$"4F49 440D 5A4F 4F4B 530D 5A4F 4F4D 530D"            /* OIDZOOKSZOOMS */	$"5A4F 4F4E 530D 5A4F 4F54 590D 5A4F 5050"            /* ZOONSZOOTYZOPP */	$"410D 5A4F 5050 4F0D 5A4F 5249 4C0D 5A4F"            /* AZOPPOZORILZO */	$"5249 530D 5A4F 5252 4F0D 5A4F 554B 530D"            /* RISZORROZOUKS */	$"5A4F 5745 450D 5A4F 5749 450D 5A55 4C55"            /* ZOWEEZOWIEZULU */	$"530D 5A55 5041 4E0D 5A55 5041 530D 5A55"            /* SZUPANZUPASZU */	$"5050 410D 5A55 5246 530D 5A55 5A49 4D0D"            /* PPAZURFSZUZIM */	$"5A59 4741 4C0D 5A59 474F 4E0D 5A59 4D45"            /* ZYGALZYGONZYME */	$"530D 5A59 4D49 43"                                  /* SZYMIC */};data 'TEXT' (128) {	$"4142 4143 4B0D 4142 4153 450D 4142 4154"            /* ABACKABASEABAT */	$"450D 4142 4245 590D 4142 424F 540D 4142"            /* EABBEYABBOTAB */	$"484F 520D 4142 4944 450D 4142 4C45 440D"            /* HORABIDEABLED */	$"4142 4F44 450D 4142 4F52 540D 4142 4F55"            /* ABODEABORTABOU */	$"540D 4142 4F56 450D 4142 5553 450D 4142"            /* TABOVEABUSEAB */	$"5953 530D 4143 4F52 4E0D 4143 5249 440D"            /* YSSACORNACRID */	$"4143 544F 520D 4143 5554 450D 4144 4147"            /* ACTORACUTEADAG */	$"450D 4144 4150 540D 4144 4550 540D 4144"            /* EADAPTADEPTAD */	$"4D49 4E0D 4144 4D49 540D 4144 4F42 450D"            /* MINADMITADOBE */	$"4144 4F50 540D 4144 4F52 450D 4144 4F52"            /* ADOPTADOREADOR */	$"4E0D 4144 554C 540D 4146 4649 580D 4146"            /* NADULTAFFIXAF */	$"4952 450D 4146 4F4F 540D 4146 4F55 4C0D"            /* IREAFOOTAFOUL */	$"4146 5445 520D 4147 4149 4E0D 4147 4150"            /* AFTERAGAINAGAP */	$"450D 4147 4154 450D 4147 454E 540D 4147"            /* EAGATEAGENTAG */	$"494C 450D 4147 494E 470D 4147 4C4F 570D"            /* ILEAGINGAGLOW */	$"4147 4F4E 590D 4147 5245 450D 4148 4541"            /* AGONYAGREEAHEA */	$"440D 4149 4445 520D 4149 534C 450D 414C"            /* DAIDERAISLEAL */	$"4152 4D0D 414C 4255 4D0D 414C 4552 540D"            /* ARMALBUMALERT */	$"414C 4741 450D 414C 4942 490D 414C 4945"            /* ALGAEALIBIALIE */	$"4E0D 414C 4947 4E0D 414C 494B 450D 414C"            /* NALIGNALIKEAL */	$"4956 450D 414C 4C41 590D 414C 4C45 590D"            /* IVEALLAYALLEY */	$"414C 4C4F 540D 414C 4C4F 570D 414C 4C4F"            /* ALLOTALLOWALLO */	$"590D 414C 4F46 540D 414C 4F4E 450D 414C"            /* YALOFTALONEAL */	$"4F4E 470D 414C 4F4F 460D 414C 4F55 440D"            /* ONGALOOFALOUD */	$"414C 5048 410D 414C 5441 520D 414C 5445"            /* ALPHAALTARALTE */	$"520D 414D 4153 530D 414D 415A 450D 414D"            /* RAMASSAMAZEAM */	$"4245 520D 414D 424C 450D 414D 454E 440D"            /* BERAMBLEAMEND */	$"414D 4953 530D 414D 4954 590D 414D 4F4E"            /* AMISSAMITYAMON */	$"470D 414D 504C 450D 414D 504C 590D 414D"            /* GAMPLEAMPLYAM */	$"5553 450D 414E 4745 4C0D 414E 4745 520D"            /* USEANGELANGER */	$"414E 474C 450D 414E 4752 590D 414E 4753"            /* ANGLEANGRYANGS */	$"540D 414E 494D 450D 414E 4B4C 450D 414E"            /* TANIMEANKLEAN */	$"4E45 580D 414E 4E4F 590D 414E 4E55 4C0D"            /* NEXANNOYANNUL */	$"414E 4F44 450D 414E 5449 430D 414E 5649"            /* ANODEANTICANVI */	$"4C0D 414F 5254 410D 4150 4152 540D 4150"            /* LAORTAAPARTAP */	$"4849 440D 4150 494E 470D 4150 4E45 410D"            /* HIDAPINGAPNEA */	$"4150 504C 450D 4150 504C 590D 4150 524F"            /* APPLEAPPLYAPRO */	$"4E0D 4150 544C 590D 4152 424F 520D 4152"            /* NAPTLYARBORAR */	$"444F 520D 4152 454E 410D 4152 4755 450D"            /* DORARENAARGUE */	$"4152 4953 450D 4152 4D4F 520D 4152 4F4D"            /* ARISEARMORAROM */	$"410D 4152 4F53 450D 4152 5241 590D 4152"            /* AAROSEARRAYAR */	$"524F 570D 4152 534F 4E0D 4152 5453 590D"            /* ROWARSONARTSY */	$"4153 434F 540D 4153 4845 4E0D 4153 4944"            /* ASCOTASHENASID */	$"450D 4153 4B45 570D 4153 5341 590D 4153"            /* EASKEWASSAYAS */	$"5345 540D 4154 4F4C 4C0D 4154 4F4E 450D"            /* SETATOLLATONE */	$"4154 5449 430D 4155 4449 4F0D 4155 4449"            /* ATTICAUDIOAUDI */	$"540D 4155 4755 520D 4155 4E54 590D 4156"            /* TAUGURAUNTYAV */	$"4149 4C0D 4156 4552 540D 4156 4941 4E0D"            /* AILAVERTAVIAN */	$"4156 4F49 440D 4157 4149 540D 4157 414B"            /* AVOIDAWAITAWAK */	$"450D 4157 4152 440D 4157 4152 450D 4157"            /* EAWARDAWAREAW */	$"4153 480D 4157 4655 4C0D 4157 4F4B 450D"            /* ASHAWFULAWOKE */	$"4158 4941 4C0D 4158 494F 4D0D 4158 494F"            /* AXIALAXIOMAXIO */	$"4E0D 415A 5552 450D 4241 434F 4E0D 4241"            /* NAZUREBACONBA */	$"4447 450D 4241 444C 590D 4241 4745 4C0D"            /* DGEBADLYBAGEL */	$"4241 4747 590D 4241 4B45 520D 4241 4C45"            /* BAGGYBAKERBALE */	$"520D 4241 4C4D 590D 4241 4E41 4C0D 4241"            /* RBALMYBANALBA */	$"4E4A 4F0D 4241 5247 450D 4241 524F 4E0D"            /* NJOBARGEBARON */	$"4241 5341 4C0D 4241 5349 430D 4241 5349"            /* BASALBASICBASI */	$"4C0D 4241 5349 4E0D 4241 5349 530D 4241"            /* LBASINBASISBA */	$"5354 450D 4241 5443 480D 4241 5448 450D"            /* STEBATCHBATHE */	$"4241 544F 4E0D 4241 5454 590D 4241 5744"            /* BATONBATTYBAWD */	$"590D 4241 594F 550D 4245 4143 480D 4245"            /* YBAYOUBEACHBE */	$"4144 590D 4245 4152 440D 4245 4153 540D"            /* ADYBEARDBEAST */	$"4245 4543 480D 4245 4546 590D 4245 4649"            /* BEECHBEEFYBEFI */	$"540D 4245 4741 4E0D 4245 4741 540D 4245"            /* TBEGANBEGATBE */	$"4745 540D 4245 4749 4E0D 4245 4755 4E0D"            /* GETBEGINBEGUN */	$"4245 494E 470D 4245 4C43 480D 4245 4C49"            /* BEINGBELCHBELI */	$"450D 4245 4C4C 450D 4245 4C4C 590D 4245"            /* EBELLEBELLYBE */	$"4C4F 570D 4245 4E43 480D 4245 5245 540D"            /* LOWBENCHBERET */	$"4245 5252 590D 4245 5254 480D 4245 5345"            /* BERRYBERTHBESE */	$"540D 4245 5445 4C0D 4245 5645 4C0D 4245"            /* TBETELBEVELBE */	$"5A45 4C0D 4249 424C 450D 4249 4345 500D"            /* ZELBIBLEBICEP */	$"4249 4444 590D 4249 474F 540D 4249 4C47"            /* BIDDYBIGOTBILG */	$"450D 4249 4C4C 590D 4249 4E47 450D 4249"            /* EBILLYBINGEBI */	$"4E47 4F0D 4249 4F4D 450D 4249 5243 480D"            /* NGOBIOMEBIRCH */	$"4249 5254 480D 4249 534F 4E0D 4249 5454"            /* BIRTHBISONBITT */	$"590D 424C 4143 4B0D 424C 4144 450D 424C"            /* YBLACKBLADEBL */	$"414D 450D 424C 414E 440D 424C 414E 4B0D"            /* AMEBLANDBLANK */	$"424C 4152 450D 424C 4153 540D 424C 415A"            /* BLAREBLASTBLAZ */	$"450D 424C 4541 4B0D 424C 4541 540D 424C"            /* EBLEAKBLEATBL */	$"4545 440D 424C 4545 500D 424C 454E 440D"            /* EEDBLEEPBLEND */	$"424C 4553 530D 424C 494D 500D 424C 494E"            /* BLESSBLIMPBLIN */	$"440D 424C 494E 4B0D 424C 4953 530D 424C"            /* DBLINKBLISSBL */	$"4954 5A0D 424C 4F41 540D 424C 4F43 4B0D"            /* ITZBLOATBLOCK */	$"424C 4F4B 450D 424C 4F4E 440D 424C 4F4F"            /* BLOKEBLONDBLOO */	$"440D 424C 4F4F 4D0D 424C 4F57 4E0D 424C"            /* DBLOOMBLOWNBL */	$"5545 520D 424C 5546 460D 424C 554E 540D"            /* UERBLUFFBLUNT */	$"424C 5552 420D 424C 5552 540D 424C 5553"            /* BLURBBLURTBLUS */	$"480D 424F 4152 440D 424F 4153 540D 424F"            /* HBOARDBOASTBO */	$"4242 590D 424F 4E45 590D 424F 4E47 4F0D"            /* BBYBONEYBONGO */	$"424F 4E55 530D 424F 4F42 590D 424F 4F53"            /* BONUSBOOBYBOOS */	$"540D 424F 4F54 480D 424F 4F54 590D 424F"            /* TBOOTHBOOTYBO */	$"4F5A 450D 424F 4F5A 590D 424F 5241 580D"            /* OZEBOOZYBORAX */	$"424F 524E 450D 424F 534F 4D0D 424F 5353"            /* BORNEBOSOMBOSS */	$"590D 424F 5443 480D 424F 5547 480D 424F"            /* YBOTCHBOUGHBO */	$"554C 450D 424F 554E 440D 424F 5745 4C0D"            /* ULEBOUNDBOWEL */	$"424F 5845 520D 4252 4143 450D 4252 4149"            /* BOXERBRACEBRAI */	$"440D 4252 4149 4E0D 4252 414B 450D 4252"            /* DBRAINBRAKEBR */	$"414E 440D 4252 4153 480D 4252 4153 530D"            /* ANDBRASHBRASS */	$"4252 4156 450D 4252 4156 4F0D 4252 4157"            /* BRAVEBRAVOBRAW */	$"4C0D 4252 4157 4E0D 4252 4541 440D 4252"            /* LBRAWNBREADBR */	$"4541 4B0D 4252 4545 440D 4252 4941 520D"            /* EAKBREEDBRIAR */	$"4252 4942 450D 4252 4943 4B0D 4252 4944"            /* BRIBEBRICKBRID */	$"450D 4252 4945 460D 4252 494E 450D 4252"            /* EBRIEFBRINEBR */	$"494E 470D 4252 494E 4B0D 4252 494E 590D"            /* INGBRINKBRINY */	$"4252 4953 4B0D 4252 4F41 440D 4252 4F49"            /* BRISKBROADBROI */	$"4C0D 4252 4F4B 450D 4252 4F4F 440D 4252"            /* LBROKEBROODBR */	$"4F4F 4B0D 4252 4F4F 4D0D 4252 4F54 480D"            /* OOKBROOMBROTH */	$"4252 4F57 4E0D 4252 554E 540D 4252 5553"            /* BROWNBRUNTBRUS */	$"480D 4252 5554 450D 4255 4444 590D 4255"            /* HBRUTEBUDDYBU */	$"4447 450D 4255 4747 590D 4255 474C 450D"            /* DGEBUGGYBUGLE */	$"4255 494C 440D 4255 494C 540D 4255 4C47"            /* BUILDBUILTBULG */	$"450D 4255 4C4B 590D 4255 4C4C 590D 4255"            /* EBULKYBULLYBU */	$"4E43 480D 4255 4E4E 590D 4255 524C 590D"            /* NCHBUNNYBURLY */	$"4255 524E 540D 4255 5253 540D 4255 5345"            /* BURNTBURSTBUSE */	$"440D 4255 5348 590D 4255 5443 480D 4255"            /* DBUSHYBUTCHBU */	$"5454 450D 4255 584F 4D0D 4255 5945 520D"            /* TTEBUXOMBUYER */	$"4259 4C41 570D 4341 4241 4C0D 4341 4242"            /* BYLAWCABALCABB */	$"590D 4341 4249 4E0D 4341 424C 450D 4341"            /* YCABINCABLECA */	$"4341 4F0D 4341 4348 450D 4341 4354 490D"            /* CAOCACHECACTI */	$"4341 4444 590D 4341 4445 540D 4341 4745"            /* CADDYCADETCAGE */	$"590D 4341 4952 4E0D 4341 4D45 4C0D 4341"            /* YCAIRNCAMELCA */	$"4D45 4F0D 4341 4E41 4C0D 4341 4E44 590D"            /* MEOCANALCANDY */	$"4341 4E4E 590D 4341 4E4F 450D 4341 4E4F"            /* CANNYCANOECANO */	$"4E0D 4341 5045 520D 4341 5055 540D 4341"            /* NCAPERCAPUTCA */	$"5241 540D 4341 5247 4F0D 4341 524F 4C0D"            /* RATCARGOCAROL */	$"4341 5252 590D 4341 5256 450D 4341 5354"            /* CARRYCARVECAST */	$"450D 4341 5443 480D 4341 5445 520D 4341"            /* ECATCHCATERCA */	$"5454 590D 4341 554C 4B0D 4341 5553 450D"            /* TTYCAULKCAUSE */	$"4341 5649 4C0D 4345 4153 450D 4345 4441"            /* CAVILCEASECEDA */	$"520D 4345 4C4C 4F0D 4348 4146 450D 4348"            /* RCELLOCHAFECH */	$"4146 460D 4348 4149 4E0D 4348 4149 520D"            /* AFFCHAINCHAIR */	$"4348 414C 4B0D 4348 414D 500D 4348 414E"            /* CHALKCHAMPCHAN */	$"540D 4348 414F 530D 4348 4152 440D 4348"            /* TCHAOSCHARDCH */	$"4152 4D0D 4348 4152 540D 4348 4153 450D"            /* ARMCHARTCHASE */	$"4348 4153 4D0D 4348 4541 500D 4348 4541"            /* CHASMCHEAPCHEA */	$"540D 4348 4543 4B0D 4348 4545 4B0D 4348"            /* TCHECKCHEEKCH */	$"4545 520D 4348 4553 530D 4348 4553 540D"            /* EERCHESSCHEST */	$"4348 4943 4B0D 4348 4944 450D 4348 4945"            /* CHICKCHIDECHIE */	$"460D 4348 494C 440D 4348 494C 490D 4348"            /* FCHILDCHILICH */	$"494C 4C0D 4348 494D 450D 4348 494E 410D"            /* ILLCHIMECHINA */	$"4348 4952 500D 4348 4F43 4B0D 4348 4F49"            /* CHIRPCHOCKCHOI */	$"520D 4348 4F4B 450D 4348 4F52 440D 4348"            /* RCHOKECHORDCH */	$"4F52 450D 4348 4F53 450D 4348 5543 4B0D"            /* ORECHOSECHUCK */	$"4348 554D 500D 4348 554E 4B0D 4348 5552"            /* CHUMPCHUNKCHUR */	$"4E0D 4348 5554 450D 4349 4445 520D 4349"            /* NCHUTECIDERCI */	$"4741 520D 4349 4E43 480D 4349 5243 410D"            /* GARCINCHCIRCA */	$"4349 5649 430D 4349 5649 4C0D 434C 4143"            /* CIVICCIVILCLAC */	$"4B0D 434C 4149 4D0D 434C 414D 500D 434C"            /* KCLAIMCLAMPCL */	$"414E 470D 434C 414E 4B0D 434C 4153 480D"            /* ANGCLANKCLASH */	$"434C 4153 500D 434C 4153 530D 434C 4541"            /* CLASPCLASSCLEA */	$"4E0D 434C 4541 520D 434C 4541 540D 434C"            /* NCLEARCLEATCL */	$"4546 540D 434C 4552 4B0D 434C 4943 4B0D"            /* EFTCLERKCLICK */	$"434C 4946 460D 434C 494D 420D 434C 494E"            /* CLIFFCLIMBCLIN */	$"470D 434C 494E 4B0D 434C 4F41 4B0D 434C"            /* GCLINKCLOAKCL */	$"4F43 4B0D 434C 4F4E 450D 434C 4F53 450D"            /* OCKCLONECLOSE */	$"434C 4F54 480D 434C 4F55 440D 434C 4F55"            /* CLOTHCLOUDCLOU */	$"540D 434C 4F56 450D 434C 4F57 4E0D 434C"            /* TCLOVECLOWNCL */	$"5543 4B0D 434C 5545 440D 434C 554D 500D"            /* UCKCLUEDCLUMP */	$"434C 554E 470D 434F 4143 480D 434F 4153"            /* CLUNGCOACHCOAS */	$"540D 434F 4252 410D 434F 434F 410D 434F"            /* TCOBRACOCOACO */	$"4C4F 4E0D 434F 4C4F 520D 434F 4D45 540D"            /* LONCOLORCOMET */	$"434F 4D46 590D 434F 4D49 430D 434F 4D4D"            /* COMFYCOMICCOMM */	$"410D 434F 4E43 480D 434F 4E44 4F0D 434F"            /* ACONCHCONDOCO */	$"4E49 430D 434F 5053 450D 434F 5241 4C0D"            /* NICCOPSECORAL */	$"434F 5245 520D 434F 524E 590D 434F 5543"            /* CORERCORNYCOUC */	$"480D 434F 5547 480D 434F 554C 440D 434F"            /* HCOUGHCOULDCO */	$"554E 540D 434F 5550 450D 434F 5552 540D"            /* UNTCOUPECOURT */	$"434F 5645 4E0D 434F 5645 520D 434F 5645"            /* COVENCOVERCOVE */	$"540D 434F 5645 590D 434F 5745 520D 434F"            /* TCOVEYCOWERCO */	$"594C 590D 4352 4143 4B0D 4352 4146 540D"            /* YLYCRACKCRAFT */	$"4352 414D 500D 4352 414E 450D 4352 414E"            /* CRAMPCRANECRAN */	$"4B0D 4352 4153 480D 4352 4153 530D 4352"            /* KCRASHCRASSCR */	$"4154 450D 4352 4156 450D 4352 4157 4C0D"            /* ATECRAVECRAWL */	$"4352 415A 450D 4352 415A 590D 4352 4541"            /* CRAZECRAZYCREA */	$"4B0D 4352 4541 4D0D 4352 4544 4F0D 4352"            /* KCREAMCREDOCR */	$"4545 440D 4352 4545 4B0D 4352 4545 500D"            /* EEDCREEKCREEP */	$"4352 454D 450D 4352 4550 450D 4352 4550"            /* CREMECREPECREP */	$"540D 4352 4553 530D 4352 4553 540D 4352"            /* TCRESSCRESTCR */	$"4943 4B0D 4352 4945 440D 4352 4945 520D"            /* ICKCRIEDCRIER */	$"4352 494D 450D 4352 494D 500D 4352 4953"            /* CRIMECRIMPCRIS */	$"500D 4352 4F41 4B0D 4352 4F43 4B0D 4352"            /* PCROAKCROCKCR */	$"4F4E 450D 4352 4F4E 590D 4352 4F4F 4B0D"            /* ONECRONYCROOK */	$"4352 4F53 530D 4352 4F55 500D 4352 4F57"            /* CROSSCROUPCROW */	$"440D 4352 4F57 4E0D 4352 5544 450D 4352"            /* DCROWNCRUDECR */	$"5545 4C0D 4352 554D 420D 4352 554D 500D"            /* UELCRUMBCRUMP */	$"4352 5553 480D 4352 5553 540D 4352 5950"            /* CRUSHCRUSTCRYP */	$"540D 4355 4249 430D 4355 4D49 4E0D 4355"            /* TCUBICCUMINCU */	$"5249 4F0D 4355 524C 590D 4355 5252 590D"            /* RIOCURLYCURRY */	$"4355 5253 450D 4355 5256 450D 4355 5256"            /* CURSECURVECURV */	$"590D 4355 5449 450D 4359 4245 520D 4359"            /* YCUTIECYBERCY */	$"434C 450D 4359 4E49 430D 4441 4444 590D"            /* CLECYNICDADDY */	$"4441 494C 590D 4441 4952 590D 4441 4953"            /* DAILYDAIRYDAIS */	$"590D 4441 4C4C 590D 4441 4E43 450D 4441"            /* YDALLYDANCEDA */	$"4E44 590D 4441 5455 4D0D 4441 554E 540D"            /* NDYDATUMDAUNT */	$"4445 414C 540D 4445 4154 480D 4445 4241"            /* DEALTDEATHDEBA */	$"520D 4445 4249 540D 4445 4255 470D 4445"            /* RDEBITDEBUGDE */	$"4255 540D 4445 4341 4C0D 4445 4341 590D"            /* BUTDECALDECAY */	$"4445 434F 520D 4445 434F 590D 4445 4352"            /* DECORDECOYDECR */	$"590D 4445 4645 520D 4445 4947 4E0D 4445"            /* YDEFERDEIGNDE */	$"4954 590D 4445 4C41 590D 4445 4C54 410D"            /* ITYDELAYDELTA */	$"4445 4C56 450D 4445 4D4F 4E0D 4445 4D55"            /* DELVEDEMONDEMU */	$"520D 4445 4E49 4D0D 4445 4E53 450D 4445"            /* RDENIMDENSEDE */	$"504F 540D 4445 5054 480D 4445 5242 590D"            /* POTDEPTHDERBY */	$"4445 5445 520D 4445 544F 580D 4445 5543"            /* DETERDETOXDEUC */	$"450D 4445 5649 4C0D 4449 4152 590D 4449"            /* EDEVILDIARYDI */	$"4345 590D 4449 4749 540D 4449 4C4C 590D"            /* CEYDIGITDILLY */	$"4449 4D4C 590D 4449 4E45 520D 4449 4E47"            /* DIMLYDINERDING */	$"4F0D 4449 4E47 590D 4449 4F44 450D 4449"            /* ODINGYDIODEDI */	$"5247 450D 4449 5254 590D 4449 5343 4F0D"            /* RGEDIRTYDISCO */	$"4449 5443 480D 4449 5454 4F0D 4449 5454"            /* DITCHDITTODITT */	$"590D 4449 5645 520D 4449 5A5A 590D 444F"            /* YDIVERDIZZYDO */	$"4447 450D 444F 4447 590D 444F 474D 410D"            /* DGEDODGYDOGMA */	$"444F 494E 470D 444F 4C4C 590D 444F 4E4F"            /* DOINGDOLLYDONO */	$"520D 444F 4E55 540D 444F 5045 590D 444F"            /* RDONUTDOPEYDO */	$"5542 540D 444F 5547 480D 444F 5744 590D"            /* UBTDOUGHDOWDY */	$"444F 5745 4C0D 444F 574E 590D 444F 5752"            /* DOWELDOWNYDOWR */	$"590D 444F 5A45 4E0D 4452 4146 540D 4452"            /* YDOZENDRAFTDR */	$"4149 4E0D 4452 414B 450D 4452 414D 410D"            /* AINDRAKEDRAMA */	$"4452 414E 4B0D 4452 4150 450D 4452 4157"            /* DRANKDRAPEDRAW */	$"4C0D 4452 4157 4E0D 4452 4541 440D 4452"            /* LDRAWNDREADDR */	$"4541 4D0D 4452 4553 530D 4452 4945 440D"            /* EAMDRESSDRIED */	$"4452 4945 520D 4452 4946 540D 4452 494C"            /* DRIERDRIFTDRIL */	$"4C0D 4452 494E 4B0D 4452 4956 450D 4452"            /* LDRINKDRIVEDR */	$"4F49 540D 4452 4F4C 4C0D 4452 4F4E 450D"            /* OITDROLLDRONE */	$"4452 4F4F 4C0D 4452 4F4F 500D 4452 4F53"            /* DROOLDROOPDROS */	$"530D 4452 4F56 450D 4452 4F57 4E0D 4452"            /* SDROVEDROWNDR */	$"5549 440D 4452 554E 4B0D 4452 5945 520D"            /* UIDDRUNKDRYER */	$"4452 594C 590D 4455 4348 590D 4455 4C4C"            /* DRYLYDUCHYDULL */	$"590D 4455 4D4D 590D 4455 4D50 590D 4455"            /* YDUMMYDUMPYDU */	$"4E43 450D 4455 534B 590D 4455 5354 590D"            /* NCEDUSKYDUSTY */	$"4455 5443 480D 4455 5645 540D 4457 4152"            /* DUTCHDUVETDWAR */	$"460D 4457 454C 4C0D 4457 454C 540D 4459"            /* FDWELLDWELTDY */	$"494E 470D 4541 4745 520D 4541 474C 450D"            /* INGEAGEREAGLE */	$"4541 524C 590D 4541 5254 480D 4541 5345"            /* EARLYEARTHEASE */	$"4C0D 4541 5445 4E0D 4541 5445 520D 4542"            /* LEATENEATEREB */	$"4F4E 590D 4543 4C41 540D 4544 4943 540D"            /* ONYECLATEDICT */	$"4544 4946 590D 4545 5249 450D 4547 5245"            /* EDIFYEERIEEGRE */	$"540D 4549 4748 540D 454A 4543 540D 454B"            /* TEIGHTEJECTEK */	$"494E 470D 454C 4154 450D 454C 424F 570D"            /* INGELATEELBOW */	$"454C 4445 520D 454C 4543 540D 454C 4547"            /* ELDERELECTELEG */	$"590D 454C 4649 4E0D 454C 4944 450D 454C"            /* YELFINELIDEEL */	$"4954 450D 454C 4F50 450D 454C 5544 450D"            /* ITEELOPEELUDE */	$"454D 4149 4C0D 454D 4245 440D 454D 4245"            /* EMAILEMBEDEMBE */	$"520D 454D 4345 450D 454D 5054 590D 454E"            /* REMCEEEMPTYEN */	$"4143 540D 454E 444F 570D 454E 454D 410D"            /* ACTENDOWENEMA */	$"454E 454D 590D 454E 4A4F 590D 454E 4E55"            /* ENEMYENJOYENNU */	$"490D 454E 5355 450D 454E 5445 520D 454E"            /* IENSUEENTEREN */	$"5452 590D 454E 564F 590D 4550 4F43 480D"            /* TRYENVOYEPOCH */	$"4550 4F58 590D 4551 5541 4C0D 4551 5549"            /* EPOXYEQUALEQUI */	$"500D 4552 4153 450D 4552 4543 540D 4552"            /* PERASEERECTER */	$"4F44 450D 4552 524F 520D 4552 5550 540D"            /* ODEERRORERUPT */	$"4553 5341 590D 4553 5445 520D 4554 4845"            /* ESSAYESTERETHE */	$"520D 4554 4849 430D 4554 484F 530D 4554"            /* RETHICETHOSET */	$"5544 450D 4556 4144 450D 4556 454E 540D"            /* UDEEVADEEVENT */	$"4556 4552 590D 4556 4943 540D 4556 4F4B"            /* EVERYEVICTEVOK */	$"450D 4558 4143 540D 4558 414C 540D 4558"            /* EEXACTEXALTEX */	$"4345 4C0D 4558 4552 540D 4558 494C 450D"            /* CELEXERTEXILE */	$"4558 4953 540D 4558 5045 4C0D 4558 544F"            /* EXISTEXPELEXTO */	$"4C0D 4558 5452 410D 4558 554C 540D 4559"            /* LEXTRAEXULTEY */	$"494E 470D 4641 424C 450D 4641 4345 540D"            /* INGFABLEFACET */	$"4641 494E 540D 4641 4952 590D 4641 4954"            /* FAINTFAIRYFAIT */	$"480D 4641 4C53 450D 4641 4E43 590D 4641"            /* HFALSEFANCYFA */	$"4E4E 590D 4641 5243 450D 4641 5441 4C0D"            /* NNYFARCEFATAL */	$"4641 5454 590D 4641 554C 540D 4641 554E"            /* FATTYFAULTFAUN */	$"410D 4641 564F 520D 4645 4153 540D 4645"            /* AFAVORFEASTFE */	$"4341 4C0D 4645 4947 4E0D 4645 4C4C 410D"            /* CALFEIGNFELLA */	$"4645 4C4F 4E0D 4645 4D4D 450D 4645 4D55"            /* FELONFEMMEFEMU */	$"520D 4645 4E43 450D 4645 5241 4C0D 4645"            /* RFENCEFERALFE */	$"5252 590D 4645 5441 4C0D 4645 5443 480D"            /* RRYFETALFETCH */	$"4645 5449 440D 4645 5455 530D 4645 5645"            /* FETIDFETUSFEVE */	$"520D 4645 5745 520D 4649 4245 520D 4649"            /* RFEWERFIBERFI */	$"4355 530D 4649 454C 440D 4649 454E 440D"            /* CUSFIELDFIEND */	$"4649 4552 590D 4649 4654 480D 4649 4654"            /* FIERYFIFTHFIFT */	$"590D 4649 4748 540D 4649 4C45 520D 4649"            /* YFIGHTFILERFI */	$"4C45 540D 4649 4C4C 590D 4649 4C4D 590D"            /* LETFILLYFILMY */	$"4649 4C54 480D 4649 4E41 4C0D 4649 4E43"            /* FILTHFINALFINC */	$"480D 4649 4E45 520D 4649 5253 540D 4649"            /* HFINERFIRSTFI */	$"5348 590D 4649 5845 520D 4649 5A5A 590D"            /* SHYFIXERFIZZY */	$"464A 4F52 440D 464C 4143 4B0D 464C 4149"            /* FJORDFLACKFLAI */	$"4C0D 464C 4149 520D 464C 414B 450D 464C"            /* LFLAIRFLAKEFL */	$"414B 590D 464C 414D 450D 464C 414E 4B0D"            /* AKYFLAMEFLANK */	$"464C 4152 450D 464C 4153 480D 464C 4153"            /* FLAREFLASHFLAS */	$"4B0D 464C 4543 4B0D 464C 4545 540D 464C"            /* KFLECKFLEETFL */	$"4553 480D 464C 4943 4B0D 464C 4945 520D"            /* ESHFLICKFLIER */	$"464C 494E 470D 464C 494E 540D 464C 4952"            /* FLINGFLINTFLIR */	$"540D 464C 4F41 540D 464C 4F43 4B0D 464C"            /* TFLOATFLOCKFL */	$"4F4F 440D 464C 4F4F 520D 464C 4F52 410D"            /* OODFLOORFLORA */	$"464C 4F53 530D 464C 4F55 520D 464C 4F55"            /* FLOSSFLOURFLOU */	$"540D 464C 4F57 4E0D 464C 5546 460D 464C"            /* TFLOWNFLUFFFL */	$"5549 440D 464C 554B 450D 464C 554D 450D"            /* UIDFLUKEFLUME */	$"464C 554E 470D 464C 554E 4B0D 464C 5553"            /* FLUNGFLUNKFLUS */	$"480D 464C 5554 450D 464C 5945 520D 464F"            /* HFLUTEFLYERFO */	$"414D 590D 464F 4341 4C0D 464F 4355 530D"            /* AMYFOCALFOCUS */	$"464F 4747 590D 464F 4953 540D 464F 4C49"            /* FOGGYFOISTFOLI */	$"4F0D 464F 4C4C 590D 464F 5241 590D 464F"            /* OFOLLYFORAYFO */	$"5243 450D 464F 5247 450D 464F 5247 4F0D"            /* RCEFORGEFORGO */	$"464F 5254 450D 464F 5254 480D 464F 5254"            /* FORTEFORTHFORT */	$"590D 464F 5255 4D0D 464F 554E 440D 464F"            /* YFORUMFOUNDFO */	$"5945 520D 4652 4149 4C0D 4652 414D 450D"            /* YERFRAILFRAME */	$"4652 414E 4B0D 4652 4155 440D 4652 4541"            /* FRANKFRAUDFREA */	$"4B0D 4652 4545 440D 4652 4545 520D 4652"            /* KFREEDFREERFR */	$"4553 480D 4652 4941 520D 4652 4945 440D"            /* ESHFRIARFRIED */	$"4652 494C 4C0D 4652 4953 4B0D 4652 4954"            /* FRILLFRISKFRIT */	$"5A0D 4652 4F43 4B0D 4652 4F4E 440D 4652"            /* ZFROCKFRONDFR */	$"4F4E 540D 4652 4F53 540D 4652 4F54 480D"            /* ONTFROSTFROTH */	$"4652 4F57 4E0D 4652 4F5A 450D 4652 5549"            /* FROWNFROZEFRUI */	$"540D 4655 4447 450D 4655 4755 450D 4655"            /* TFUDGEFUGUEFU */	$"4C4C 590D 4655 4E47 490D 4655 4E4B 590D"            /* LLYFUNGIFUNKY */	$"4655 4E4E 590D 4655 524F 520D 4655 5252"            /* FUNNYFURORFURR */	$"590D 4655 5353 590D 4655 5A5A 590D 4741"            /* YFUSSYFUZZYGA */	$"4646 450D 4741 494C 590D 4741 4D45 520D"            /* FFEGAILYGAMER */	$"4741 4D4D 410D 4741 4D55 540D 4741 5353"            /* GAMMAGAMUTGASS */	$"590D 4741 5544 590D 4741 5547 450D 4741"            /* YGAUDYGAUGEGA */	$"554E 540D 4741 555A 450D 4741 5645 4C0D"            /* UNTGAUZEGAVEL */	$"4741 574B 590D 4741 5945 520D 4741 594C"            /* GAWKYGAYERGAYL */	$"590D 4741 5A45 520D 4745 434B 4F0D 4745"            /* YGAZERGECKOGE */	$"454B 590D 4745 4553 450D 4745 4E49 450D"            /* EKYGEESEGENIE */	$"4745 4E52 450D 4748 4F53 540D 4748 4F55"            /* GENREGHOSTGHOU */	$"4C0D 4749 414E 540D 4749 4444 590D 4749"            /* LGIANTGIDDYGI */	$"5053 590D 4749 524C 590D 4749 5254 480D"            /* PSYGIRLYGIRTH */	$"4749 5645 4E0D 4749 5645 520D 474C 4144"            /* GIVENGIVERGLAD */	$"450D 474C 414E 440D 474C 4152 450D 474C"            /* EGLANDGLAREGL */	$"4153 530D 474C 415A 450D 474C 4541 4D0D"            /* ASSGLAZEGLEAM */	$"474C 4541 4E0D 474C 4944 450D 474C 494E"            /* GLEANGLIDEGLIN */	$"540D 474C 4F41 540D 474C 4F42 450D 474C"            /* TGLOATGLOBEGL */	$"4F4F 4D0D 474C 4F52 590D 474C 4F53 530D"            /* OOMGLORYGLOSS */	$"474C 4F56 450D 474C 5950 480D 474E 4153"            /* GLOVEGLYPHGNAS */	$"480D 474E 4F4D 450D 474F 444C 590D 474F"            /* HGNOMEGODLYGO */	$"494E 470D 474F 4C45 4D0D 474F 4C4C 590D"            /* INGGOLEMGOLLY */	$"474F 4E41 440D 474F 4E45 520D 474F 4F44"            /* GONADGONERGOOD */	$"590D 474F 4F45 590D 474F 4F46 590D 474F"            /* YGOOEYGOOFYGO */	$"4F53 450D 474F 5247 450D 474F 5547 450D"            /* OSEGORGEGOUGE */	$"474F 5552 440D 4752 4143 450D 4752 4144"            /* GOURDGRACEGRAD */	$"450D 4752 4146 540D 4752 4149 4C0D 4752"            /* EGRAFTGRAILGR */	$"4149 4E0D 4752 414E 440D 4752 414E 540D"            /* AINGRANDGRANT */	$"4752 4150 450D 4752 4150 480D 4752 4153"            /* GRAPEGRAPHGRAS */	$"500D 4752 4153 530D 4752 4154 450D 4752"            /* PGRASSGRATEGR */	$"4156 450D 4752 4156 590D 4752 415A 450D"            /* AVEGRAVYGRAZE */	$"4752 4541 540D 4752 4545 440D 4752 4545"            /* GREATGREEDGREE */	$"4E0D 4752 4545 540D 4752 4945 460D 4752"            /* NGREETGRIEFGR */	$"494C 4C0D 4752 494D 450D 4752 494D 590D"            /* ILLGRIMEGRIMY */	$"4752 494E 440D 4752 4950 450D 4752 4F41"            /* GRINDGRIPEGROA */	$"4E0D 4752 4F49 4E0D 4752 4F4F 4D0D 4752"            /* NGROINGROOMGR */	$"4F50 450D 4752 4F53 530D 4752 4F55 500D"            /* OPEGROSSGROUP */	$"4752 4F55 540D 4752 4F56 450D 4752 4F57"            /* GROUTGROVEGROW */	$"4C0D 4752 4F57 4E0D 4752 5545 4C0D 4752"            /* LGROWNGRUELGR */	$"5546 460D 4752 554E 540D 4755 4152 440D"            /* UFFGRUNTGUARD */	$"4755 4156 410D 4755 4553 530D 4755 4553"            /* GUAVAGUESSGUES */	$"540D 4755 4944 450D 4755 494C 440D 4755"            /* TGUIDEGUILDGU */	$"494C 450D 4755 494C 540D 4755 4953 450D"            /* ILEGUILTGUISE */	$"4755 4C43 480D 4755 4C4C 590D 4755 4D42"            /* GULCHGULLYGUMB */	$"4F0D 4755 4D4D 590D 4755 5050 590D 4755"            /* OGUMMYGUPPYGU */	$"5354 4F0D 4755 5354 590D 4759 5053 590D"            /* STOGUSTYGYPSY */	$"4841 4249 540D 4841 4952 590D 4841 4C56"            /* HABITHAIRYHALV */	$"450D 4841 4E44 590D 4841 5050 590D 4841"            /* EHANDYHAPPYHA */	$"5244 590D 4841 5245 4D0D 4841 5250 590D"            /* RDYHAREMHARPY */	$"4841 5252 590D 4841 5253 480D 4841 5354"            /* HARRYHARSHHAST */	$"450D 4841 5354 590D 4841 5443 480D 4841"            /* EHASTYHATCHHA */	$"5445 520D 4841 554E 540D 4841 5554 450D"            /* TERHAUNTHAUTE */	$"4841 5645 4E0D 4841 564F 430D 4841 5A45"            /* HAVENHAVOCHAZE */	$"4C0D 4845 4144 590D 4845 4152 440D 4845"            /* LHEADYHEARDHE */	$"4152 540D 4845 4154 480D 4845 4156 450D"            /* ARTHEATHHEAVE */	$"4845 4156 590D 4845 4447 450D 4845 4654"            /* HEAVYHEDGEHEFT */	$"590D 4845 4953 540D 4845 4C49 580D 4845"            /* YHEISTHELIXHE */	$"4C4C 4F0D 4845 4E43 450D 4845 524F 4E0D"            /* LLOHENCEHERON */	$"4849 4C4C 590D 4849 4E47 450D 4849 5050"            /* HILLYHINGEHIPP */	$"4F0D 4849 5050 590D 4849 5443 480D 484F"            /* OHIPPYHITCHHO */	$"4152 440D 484F 4242 590D 484F 4953 540D"            /* ARDHOBBYHOIST */	$"484F 4C4C 590D 484F 4D45 520D 484F 4E45"            /* HOLLYHOMERHONE */	$"590D 484F 4E4F 520D 484F 5244 450D 484F"            /* YHONORHORDEHO */	$"524E 590D 484F 5253 450D 484F 5445 4C0D"            /* RNYHORSEHOTEL */	$"484F 544C 590D 484F 554E 440D 484F 5553"            /* HOTLYHOUNDHOUS */	$"450D 484F 5645 4C0D 484F 5645 520D 484F"            /* EHOVELHOVERHO */	$"5744 590D 4855 4D41 4E0D 4855 4D49 440D"            /* WDYHUMANHUMID */	$"4855 4D4F 520D 4855 4D50 480D 4855 4D55"            /* HUMORHUMPHHUMU */	$"530D 4855 4E43 480D 4855 4E4B 590D 4855"            /* SHUNCHHUNKYHU */	$"5252 590D 4855 534B 590D 4855 5353 590D"            /* RRYHUSKYHUSSY */	$"4855 5443 480D 4859 4452 4F0D 4859 454E"            /* HUTCHHYDROHYEN */	$"410D 4859 4D45 4E0D 4859 5045 520D 4943"            /* AHYMENHYPERIC */	$"494C 590D 4943 494E 470D 4944 4541 4C0D"            /* ILYICINGIDEAL */	$"4944 494F 4D0D 4944 494F 540D 4944 4C45"            /* IDIOMIDIOTIDLE */	$"520D 4944 594C 4C0D 4947 4C4F 4F0D 494C"            /* RIDYLLIGLOOIL */	$"4941 430D 494D 4147 450D 494D 4255 450D"            /* IACIMAGEIMBUE */	$"494D 5045 4C0D 494D 504C 590D 494E 414E"            /* IMPELIMPLYINAN */	$"450D 494E 424F 580D 494E 4355 520D 494E"            /* EINBOXINCURIN */	$"4445 580D 494E 4550 540D 494E 4552 540D"            /* DEXINEPTINERT */	$"494E 4645 520D 494E 474F 540D 494E 4C41"            /* INFERINGOTINLA */	$"590D 494E 4C45 540D 494E 4E45 520D 494E"            /* YINLETINNERIN */	$"5055 540D 494E 5445 520D 494E 5452 4F0D"            /* PUTINTERINTRO */	$"494F 4E49 430D 4952 4154 450D 4952 4F4E"            /* IONICIRATEIRON */	$"590D 4953 4C45 540D 4953 5355 450D 4954"            /* YISLETISSUEIT */	$"4348 590D 4956 4F52 590D 4A41 554E 540D"            /* CHYIVORYJAUNT */	$"4A41 5A5A 590D 4A45 4C4C 590D 4A45 524B"            /* JAZZYJELLYJERK */	$"590D 4A45 5454 590D 4A45 5745 4C0D 4A49"            /* YJETTYJEWELJI */	$"4646 590D 4A4F 494E 540D 4A4F 4953 540D"            /* FFYJOINTJOIST */	$"4A4F 4B45 520D 4A4F 4C4C 590D 4A4F 5553"            /* JOKERJOLLYJOUS */	$"540D 4A55 4447 450D 4A55 4943 450D 4A55"            /* TJUDGEJUICEJU */	$"4943 590D 4A55 4D42 4F0D 4A55 4D50 590D"            /* ICYJUMBOJUMPY */	$"4A55 4E54 410D 4A55 4E54 4F0D 4A55 524F"            /* JUNTAJUNTOJURO */	$"520D 4B41 5050 410D 4B41 524D 410D 4B41"            /* RKAPPAKARMAKA */	$"5941 4B0D 4B45 4241 420D 4B48 414B 490D"            /* YAKKEBABKHAKI */	$"4B49 4E4B 590D 4B49 4F53 4B0D 4B49 5454"            /* KINKYKIOSKKITT */	$"590D 4B4E 4143 4B0D 4B4E 4156 450D 4B4E"            /* YKNACKKNAVEKN */	$"4541 440D 4B4E 4545 440D 4B4E 4545 4C0D"            /* EADKNEEDKNEEL */	$"4B4E 454C 540D 4B4E 4946 450D 4B4E 4F43"            /* KNELTKNIFEKNOC */	$"4B0D 4B4E 4F4C 4C0D 4B4E 4F57 4E0D 4B4F"            /* KKNOLLKNOWNKO */	$"414C 410D 4B52 494C 4C0D 4C41 4245 4C0D"            /* ALAKRILLLABEL */	$"4C41 424F 520D 4C41 4445 4E0D 4C41 444C"            /* LABORLADENLADL */	$"450D 4C41 4745 520D 4C41 4E43 450D 4C41"            /* ELAGERLANCELA */	$"4E4B 590D 4C41 5045 4C0D 4C41 5053 450D"            /* NKYLAPELLAPSE */	$"4C41 5247 450D 4C41 5256 410D 4C41 5353"            /* LARGELARVALASS */	$"4F0D 4C41 5443 480D 4C41 5445 520D 4C41"            /* OLATCHLATERLA */	$"5448 450D 4C41 5454 450D 4C41 5547 480D"            /* THELATTELAUGH */	$"4C41 5945 520D 4C45 4143 480D 4C45 4146"            /* LAYERLEACHLEAF */	$"590D 4C45 414B 590D 4C45 414E 540D 4C45"            /* YLEAKYLEANTLE */	$"4150 540D 4C45 4152 4E0D 4C45 4153 450D"            /* APTLEARNLEASE */	$"4C45 4153 480D 4C45 4153 540D 4C45 4156"            /* LEASHLEASTLEAV */	$"450D 4C45 4447 450D 4C45 4543 480D 4C45"            /* ELEDGELEECHLE */	$"4552 590D 4C45 4654 590D 4C45 4741 4C0D"            /* ERYLEFTYLEGAL */	$"4C45 4747 590D 4C45 4D4F 4E0D 4C45 4D55"            /* LEGGYLEMONLEMU */	$"520D 4C45 5045 520D 4C45 5645 4C0D 4C45"            /* RLEPERLEVELLE */	$"5645 520D 4C49 4245 4C0D 4C49 4547 450D"            /* VERLIBELLIEGE */	$"4C49 4748 540D 4C49 4B45 4E0D 4C49 4C41"            /* LIGHTLIKENLILA */	$"430D 4C49 4D42 4F0D 4C49 4D49 540D 4C49"            /* CLIMBOLIMITLI */	$"4E45 4E0D 4C49 4E45 520D 4C49 4E47 4F0D"            /* NENLINERLINGO */	$"4C49 5049 440D 4C49 5448 450D 4C49 5645"            /* LIPIDLITHELIVE */	$"520D 4C49 5649 440D 4C4C 414D 410D 4C4F"            /* RLIVIDLLAMALO */	$"414D 590D 4C4F 4154 480D 4C4F 4242 590D"            /* AMYLOATHLOBBY */	$"4C4F 4341 4C0D 4C4F 4355 530D 4C4F 4447"            /* LOCALLOCUSLODG */	$"450D 4C4F 4654 590D 4C4F 4749 430D 4C4F"            /* ELOFTYLOGICLO */	$"4749 4E0D 4C4F 4F50 590D 4C4F 4F53 450D"            /* GINLOOPYLOOSE */	$"4C4F 5252 590D 4C4F 5345 520D 4C4F 5553"            /* LORRYLOSERLOUS */	$"450D 4C4F 5553 590D 4C4F 5645 520D 4C4F"            /* ELOUSYLOVERLO */	$"5745 520D 4C4F 574C 590D 4C4F 5941 4C0D"            /* WERLOWLYLOYAL */	$"4C55 4349 440D 4C55 434B 590D 4C55 4D45"            /* LUCIDLUCKYLUME */	$"4E0D 4C55 4D50 590D 4C55 4E41 520D 4C55"            /* NLUMPYLUNARLU */	$"4E43 480D 4C55 4E47 450D 4C55 5055 530D"            /* NCHLUNGELUPUS */	$"4C55 5243 480D 4C55 5249 440D 4C55 5354"            /* LURCHLURIDLUST */	$"590D 4C59 494E 470D 4C59 4D50 480D 4C59"            /* YLYINGLYMPHLY */	$"5249 430D 4D41 4341 570D 4D41 4348 4F0D"            /* RICMACAWMACHO */	$"4D41 4352 4F0D 4D41 4441 4D0D 4D41 444C"            /* MACROMADAMMADL */	$"590D 4D41 4649 410D 4D41 4749 430D 4D41"            /* YMAFIAMAGICMA */	$"474D 410D 4D41 495A 450D 4D41 4A4F 520D"            /* GMAMAIZEMAJOR */	$"4D41 4B45 520D 4D41 4D42 4F0D 4D41 4D4D"            /* MAKERMAMBOMAMM */	$"410D 4D41 4D4D 590D 4D41 4E47 410D 4D41"            /* AMAMMYMANGAMA */	$"4E47 450D 4D41 4E47 4F0D 4D41 4E47 590D"            /* NGEMANGOMANGY */	$"4D41 4E49 410D 4D41 4E49 430D 4D41 4E4C"            /* MANIAMANICMANL */	$"590D 4D41 4E4F 520D 4D41 504C 450D 4D41"            /* YMANORMAPLEMA */	$"5243 480D 4D41 5252 590D 4D41 5253 480D"            /* RCHMARRYMARSH */	$"4D41 534F 4E0D 4D41 5353 450D 4D41 5443"            /* MASONMASSEMATC */	$"480D 4D41 5445 590D 4D41 5556 450D 4D41"            /* HMATEYMAUVEMA */	$"5849 4D0D 4D41 5942 450D 4D41 594F 520D"            /* XIMMAYBEMAYOR */	$"4D45 414C 590D 4D45 414E 540D 4D45 4154"            /* MEALYMEANTMEAT */	$"590D 4D45 4343 410D 4D45 4441 4C0D 4D45"            /* YMECCAMEDALME */	$"4449 410D 4D45 4449 430D 4D45 4C45 450D"            /* DIAMEDICMELEE */	$"4D45 4C4F 4E0D 4D45 5243 590D 4D45 5247"            /* MELONMERCYMERG */	$"450D 4D45 5249 540D 4D45 5252 590D 4D45"            /* EMERITMERRYME */	$"5441 4C0D 4D45 5445 520D 4D45 5452 4F0D"            /* TALMETERMETRO */	$"4D49 4352 4F0D 4D49 4447 450D 4D49 4453"            /* MICROMIDGEMIDS */	$"540D 4D49 4748 540D 4D49 4C4B 590D 4D49"            /* TMIGHTMILKYMI */	$"4D49 430D 4D49 4E43 450D 4D49 4E45 520D"            /* MICMINCEMINER */	$"4D49 4E49 4D0D 4D49 4E4F 520D 4D49 4E54"            /* MINIMMINORMINT */	$"590D 4D49 4E55 530D 4D49 5254 480D 4D49"            /* YMINUSMIRTHMI */	$"5345 520D 4D49 5353 590D 4D4F 4348 410D"            /* SERMISSYMOCHA */	$"4D4F 4441 4C0D 4D4F 4445 4C0D 4D4F 4445"            /* MODALMODELMODE */	$"4D0D 4D4F 4755 4C0D 4D4F 4953 540D 4D4F"            /* MMOGULMOISTMO */	$"4C41 520D 4D4F 4C44 590D 4D4F 4E45 590D"            /* LARMOLDYMONEY */	$"4D4F 4E54 480D 4D4F 4F44 590D 4D4F 4F53"            /* MONTHMOODYMOOS */	$"450D 4D4F 5241 4C0D 4D4F 524F 4E0D 4D4F"            /* EMORALMORONMO */	$"5250 480D 4D4F 5353 590D 4D4F 5445 4C0D"            /* RPHMOSSYMOTEL */	$"4D4F 5449 460D 4D4F 544F 520D 4D4F 5454"            /* MOTIFMOTORMOTT */	$"4F0D 4D4F 554C 540D 4D4F 554E 440D 4D4F"            /* OMOULTMOUNDMO */	$"554E 540D 4D4F 5552 4E0D 4D4F 5553 450D"            /* UNTMOURNMOUSE */	$"4D4F 5554 480D 4D4F 5645 520D 4D4F 5649"            /* MOUTHMOVERMOVI */	$"450D 4D4F 5745 520D 4D55 434B 590D 4D55"            /* EMOWERMUCKYMU */	$"4355 530D 4D55 4444 590D 4D55 4C43 480D"            /* CUSMUDDYMULCH */	$"4D55 4D4D 590D 4D55 4E43 480D 4D55 5241"            /* MUMMYMUNCHMURA */	$"4C0D 4D55 524B 590D 4D55 5348 590D 4D55"            /* LMURKYMUSHYMU */	$"5349 430D 4D55 534B 590D 4D55 5354 590D"            /* SICMUSKYMUSTY */	$"4D59 5252 480D 4E41 4449 520D 4E41 4956"            /* MYRRHNADIRNAIV */	$"450D 4E41 4E4E 590D 4E41 5341 4C0D 4E41"            /* ENANNYNASALNA */	$"5354 590D 4E41 5441 4C0D 4E41 5641 4C0D"            /* STYNATALNAVAL */	$"4E41 5645 4C0D 4E45 4544 590D 4E45 4947"            /* NAVELNEEDYNEIG */	$"480D 4E45 5244 590D 4E45 5256 450D 4E45"            /* HNERDYNERVENE */	$"5645 520D 4E45 5745 520D 4E45 574C 590D"            /* VERNEWERNEWLY */	$"4E49 4345 520D 4E49 4348 450D 4E49 4543"            /* NICERNICHENIEC */	$"450D 4E49 4748 540D 4E49 4E4A 410D 4E49"            /* ENIGHTNINJANI */	$"4E4E 590D 4E49 4E54 480D 4E4F 424C 450D"            /* NNYNINTHNOBLE */	$"4E4F 424C 590D 4E4F 4953 450D 4E4F 4953"            /* NOBLYNOISENOIS */	$"590D 4E4F 4D41 440D 4E4F 4F53 450D 4E4F"            /* YNOMADNOOSENO */	$"5254 480D 4E4F 5345 590D 4E4F 5443 480D"            /* RTHNOSEYNOTCH */	$"4E4F 5645 4C0D 4E55 4447 450D 4E55 5253"            /* NOVELNUDGENURS */	$"450D 4E55 5454 590D 4E59 4C4F 4E0D 4E59"            /* ENUTTYNYLONNY */	$"4D50 480D 4F41 4B45 4E0D 4F42 4553 450D"            /* MPHOAKENOBESE */	$"4F43 4355 520D 4F43 4541 4E0D 4F43 5441"            /* OCCUROCEANOCTA */	$"4C0D 4F43 5445 540D 4F44 4445 520D 4F44"            /* LOCTETODDEROD */	$"444C 590D 4F46 4641 4C0D 4F46 4645 520D"            /* DLYOFFALOFFER */	$"4F46 5445 4E0D 4F4C 4445 4E0D 4F4C 4445"            /* OFTENOLDENOLDE */	$"520D 4F4C 4956 450D 4F4D 4252 450D 4F4D"            /* ROLIVEOMBREOM */	$"4547 410D 4F4E 494F 4E0D 4F4E 5345 540D"            /* EGAONIONONSET */	$"4F50 4552 410D 4F50 494E 450D 4F50 4955"            /* OPERAOPINEOPIU */	$"4D0D 4F50 5449 430D 4F52 4249 540D 4F52"            /* MOPTICORBITOR */	$"4445 520D 4F52 4741 4E0D 4F54 4845 520D"            /* DERORGANOTHER */	$"4F54 5445 520D 4F55 4748 540D 4F55 4E43"            /* OTTEROUGHTOUNC */	$"450D 4F55 5444 4F0D 4F55 5445 520D 4F55"            /* EOUTDOOUTEROU */	$"5447 4F0D 4F56 4152 590D 4F56 4154 450D"            /* TGOOVARYOVATE */	$"4F56 4552 540D 4F56 494E 450D 4F56 4F49"            /* OVERTOVINEOVOI */	$"440D 4F57 494E 470D 4F57 4E45 520D 4F58"            /* DOWINGOWNEROX */	$"4944 450D 4F5A 4F4E 450D 5041 4444 590D"            /* IDEOZONEPADDY */	$"5041 4741 4E0D 5041 494E 540D 5041 4C45"            /* PAGANPAINTPALE */	$"520D 5041 4C53 590D 5041 4E45 4C0D 5041"            /* RPALSYPANELPA */	$"4E49 430D 5041 4E53 590D 5041 5041 4C0D"            /* NICPANSYPAPAL */	$"5041 5045 520D 5041 5245 520D 5041 524B"            /* PAPERPARERPARK */	$"410D 5041 5252 590D 5041 5253 450D 5041"            /* APARRYPARSEPA */	$"5254 590D 5041 5354 410D 5041 5354 450D"            /* RTYPASTAPASTE */	$"5041 5354 590D 5041 5443 480D 5041 5449"            /* PASTYPATCHPATI */	$"4F0D 5041 5453 590D 5041 5454 590D 5041"            /* OPATSYPATTYPA */	$"5553 450D 5041 5945 450D 5041 5945 520D"            /* USEPAYEEPAYER */	$"5045 4143 450D 5045 4143 480D 5045 4152"            /* PEACEPEACHPEAR */	$"4C0D 5045 4341 4E0D 5045 4441 4C0D 5045"            /* LPECANPEDALPE */	$"4E41 4C0D 5045 4E43 450D 5045 4E4E 450D"            /* NALPENCEPENNE */	$"5045 4E4E 590D 5045 5243 480D 5045 5249"            /* PENNYPERCHPERI */	$"4C0D 5045 524B 590D 5045 534B 590D 5045"            /* LPERKYPESKYPE */	$"5354 4F0D 5045 5441 4C0D 5045 5454 590D"            /* STOPETALPETTY */	$"5048 4153 450D 5048 4F4E 450D 5048 4F4E"            /* PHASEPHONEPHON */	$"590D 5048 4F54 4F0D 5049 414E 4F0D 5049"            /* YPHOTOPIANOPI */	$"434B 590D 5049 4543 450D 5049 4554 590D"            /* CKYPIECEPIETY */	$"5049 4747 590D 5049 4C4F 540D 5049 4E43"            /* PIGGYPILOTPINC */	$"480D 5049 4E45 590D 5049 4E4B 590D 5049"            /* HPINEYPINKYPI */	$"4E54 4F0D 5049 5045 520D 5049 5155 450D"            /* NTOPIPERPIQUE */	$"5049 5443 480D 5049 5448 590D 5049 564F"            /* PITCHPITHYPIVO */	$"540D 5049 5845 4C0D 5049 5849 450D 5049"            /* TPIXELPIXIEPI */	$"5A5A 410D 504C 4143 450D 504C 4149 440D"            /* ZZAPLACEPLAID */	$"504C 4149 4E0D 504C 4149 540D 504C 414E"            /* PLAINPLAITPLAN */	$"450D 504C 414E 4B0D 504C 414E 540D 504C"            /* EPLANKPLANTPL */	$"4154 450D 504C 415A 410D 504C 4541 440D"            /* ATEPLAZAPLEAD */	$"504C 4541 540D 504C 4945 440D 504C 4945"            /* PLEATPLIEDPLIE */	$"520D 504C 5543 4B0D 504C 554D 420D 504C"            /* RPLUCKPLUMBPL */	$"554D 450D 504C 554D 500D 504C 554E 4B0D"            /* UMEPLUMPPLUNK */	$"504C 5553 480D 504F 4553 590D 504F 494E"            /* PLUSHPOESYPOIN */	$"540D 504F 4953 450D 504F 4B45 520D 504F"            /* TPOISEPOKERPO */	$"4C41 520D 504F 4C4B 410D 504F 4C59 500D"            /* LARPOLKAPOLYP */	$"504F 4F43 480D 504F 5050 590D 504F 5243"            /* POOCHPOPPYPORC */	$"480D 504F 5345 520D 504F 5349 540D 504F"            /* HPOSERPOSITPO */	$"5353 450D 504F 5543 480D 504F 554E 440D"            /* SSEPOUCHPOUND */	$"504F 5554 590D 504F 5745 520D 5052 414E"            /* POUTYPOWERPRAN */	$"4B0D 5052 4157 4E0D 5052 4545 4E0D 5052"            /* KPRAWNPREENPR */	$"4553 530D 5052 4943 450D 5052 4943 4B0D"            /* ESSPRICEPRICK */	$"5052 4944 450D 5052 4945 440D 5052 494D"            /* PRIDEPRIEDPRIM */	$"450D 5052 494D 4F0D 5052 494E 540D 5052"            /* EPRIMOPRINTPR */	$"494F 520D 5052 4953 4D0D 5052 4956 590D"            /* IORPRISMPRIVY */	$"5052 495A 450D 5052 4F42 450D 5052 4F4E"            /* PRIZEPROBEPRON */	$"450D 5052 4F4E 470D 5052 4F4F 460D 5052"            /* EPRONGPROOFPR */	$"4F53 450D 5052 4F55 440D 5052 4F56 450D"            /* OSEPROUDPROVE */	$"5052 4F57 4C0D 5052 4F58 590D 5052 5544"            /* PROWLPROXYPRUD */	$"450D 5052 554E 450D 5053 414C 4D0D 5055"            /* EPRUNEPSALMPU */	$"4249 430D 5055 4447 590D 5055 4646 590D"            /* BICPUDGYPUFFY */	$"5055 4C50 590D 5055 4C53 450D 5055 4E43"            /* PULPYPULSEPUNC */	$"480D 5055 5049 4C0D 5055 5050 590D 5055"            /* HPUPILPUPPYPU */	$"5245 450D 5055 5245 520D 5055 5247 450D"            /* REEPURERPURGE */	$"5055 5253 450D 5055 5348 590D 5055 5454"            /* PURSEPUSHYPUTT */	$"590D 5059 474D 590D 5155 4143 4B0D 5155"            /* YPYGMYQUACKQU */	$"4149 4C0D 5155 414B 450D 5155 414C 4D0D"            /* AILQUAKEQUALM */	$"5155 4152 4B0D 5155 4152 540D 5155 4153"            /* QUARKQUARTQUAS */	$"480D 5155 4153 490D 5155 4545 4E0D 5155"            /* HQUASIQUEENQU */	$"4545 520D 5155 454C 4C0D 5155 4552 590D"            /* EERQUELLQUERY */	$"5155 4553 540D 5155 4555 450D 5155 4943"            /* QUESTQUEUEQUIC */	$"4B0D 5155 4945 540D 5155 494C 4C0D 5155"            /* KQUIETQUILLQU */	$"494C 540D 5155 4952 4B0D 5155 4954 450D"            /* ILTQUIRKQUITE */	$"5155 4F54 410D 5155 4F54 450D 5155 4F54"            /* QUOTAQUOTEQUOT */	$"480D 5241 4242 490D 5241 4249 440D 5241"            /* HRABBIRABIDRA */	$"4345 520D 5241 4441 520D 5241 4449 490D"            /* CERRADARRADII */	$"5241 4449 4F0D 5241 494E 590D 5241 4953"            /* RADIORAINYRAIS */	$"450D 5241 4A41 480D 5241 4C4C 590D 5241"            /* ERAJAHRALLYRA */	$"4C50 480D 5241 4D45 4E0D 5241 4E43 480D"            /* LPHRAMENRANCH */	$"5241 4E44 590D 5241 4E47 450D 5241 5049"            /* RANDYRANGERAPI */	$"440D 5241 5245 520D 5241 5350 590D 5241"            /* DRARERRASPYRA */	$"5449 4F0D 5241 5454 590D 5241 5645 4E0D"            /* TIORATTYRAVEN */	$"5241 594F 4E0D 5241 5A4F 520D 5245 4143"            /* RAYONRAZORREAC */	$"480D 5245 4143 540D 5245 4144 590D 5245"            /* HREACTREADYRE */	$"414C 4D0D 5245 4152 4D0D 5245 4241 520D"            /* ALMREARMREBAR */	$"5245 4245 4C0D 5245 4255 530D 5245 4255"            /* REBELREBUSREBU */	$"540D 5245 4341 500D 5245 4355 520D 5245"            /* TRECAPRECURRE */	$"4355 540D 5245 4544 590D 5245 4645 520D"            /* CUTREEDYREFER */	$"5245 4649 540D 5245 4741 4C0D 5245 4841"            /* REFITREGALREHA */	$"420D 5245 4947 4E0D 5245 4C41 580D 5245"            /* BREIGNRELAXRE */	$"4C41 590D 5245 4C49 430D 5245 4D49 540D"            /* LAYRELICREMIT */	$"5245 4E41 4C0D 5245 4E45 570D 5245 5041"            /* RENALRENEWREPA */	$"590D 5245 5045 4C0D 5245 504C 590D 5245"            /* YREPELREPLYRE */	$"5255 4E0D 5245 5345 540D 5245 5349 4E0D"            /* RUNRESETRESIN */	$"5245 5443 480D 5245 5452 4F0D 5245 5452"            /* RETCHRETRORETR */	$"590D 5245 5553 450D 5245 5645 4C0D 5245"            /* YREUSEREVELRE */	$"5655 450D 5248 494E 4F0D 5248 594D 450D"            /* VUERHINORHYME */	$"5249 4445 520D 5249 4447 450D 5249 464C"            /* RIDERRIDGERIFL */	$"450D 5249 4748 540D 5249 4749 440D 5249"            /* ERIGHTRIGIDRI */	$"474F 520D 5249 4E53 450D 5249 5045 4E0D"            /* GORRINSERIPEN */	$"5249 5045 520D 5249 5345 4E0D 5249 5345"            /* RIPERRISENRISE */	$"520D 5249 534B 590D 5249 5641 4C0D 5249"            /* RRISKYRIVALRI */	$"5645 520D 5249 5645 540D 524F 4143 480D"            /* VERRIVETROACH */	$"524F 4153 540D 524F 4249 4E0D 524F 424F"            /* ROASTROBINROBO */	$"540D 524F 434B 590D 524F 4445 4F0D 524F"            /* TROCKYRODEORO */	$"4745 520D 524F 4755 450D 524F 4F4D 590D"            /* GERROGUEROOMY */	$"524F 4F53 540D 524F 544F 520D 524F 5547"            /* ROOSTROTORROUG */	$"450D 524F 5547 480D 524F 554E 440D 524F"            /* EROUGHROUNDRO */	$"5553 450D 524F 5554 450D 524F 5645 520D"            /* USEROUTEROVER */	$"524F 5744 590D 524F 5745 520D 524F 5941"            /* ROWDYROWERROYA */	$"4C0D 5255 4444 590D 5255 4445 520D 5255"            /* LRUDDYRUDERRU */	$"4742 590D 5255 4C45 520D 5255 4D42 410D"            /* GBYRULERRUMBA */	$"5255 4D4F 520D 5255 5045 450D 5255 5241"            /* RUMORRUPEERURA */	$"4C0D 5255 5354 590D 5341 444C 590D 5341"            /* LRUSTYSADLYSA */	$"4645 520D 5341 494E 540D 5341 4C41 440D"            /* FERSAINTSALAD */	$"5341 4C4C 590D 5341 4C4F 4E0D 5341 4C53"            /* SALLYSALONSALS */	$"410D 5341 4C54 590D 5341 4C56 450D 5341"            /* ASALTYSALVESA */	$"4C56 4F0D 5341 4E44 590D 5341 4E45 520D"            /* LVOSANDYSANER */	$"5341 5050 590D 5341 5353 590D 5341 5449"            /* SAPPYSASSYSATI */	$"4E0D 5341 5459 520D 5341 5543 450D 5341"            /* NSATYRSAUCESA */	$"5543 590D 5341 554E 410D 5341 5554 450D"            /* UCYSAUNASAUTE */	$"5341 564F 520D 5341 564F 590D 5341 5656"            /* SAVORSAVOYSAVV */	$"590D 5343 414C 440D 5343 414C 450D 5343"            /* YSCALDSCALESC */	$"414C 500D 5343 414C 590D 5343 414D 500D"            /* ALPSCALYSCAMP */	$"5343 414E 540D 5343 4152 450D 5343 4152"            /* SCANTSCARESCAR */	$"460D 5343 4152 590D 5343 454E 450D 5343"            /* FSCARYSCENESC */	$"454E 540D 5343 494F 4E0D 5343 4F46 460D"            /* ENTSCIONSCOFF */	$"5343 4F4C 440D 5343 4F4E 450D 5343 4F4F"            /* SCOLDSCONESCOO */	$"500D 5343 4F50 450D 5343 4F52 450D 5343"            /* PSCOPESCORESC */	$"4F52 4E0D 5343 4F55 520D 5343 4F55 540D"            /* ORNSCOURSCOUT */	$"5343 4F57 4C0D 5343 5241 4D0D 5343 5241"            /* SCOWLSCRAMSCRA */	$"500D 5343 5245 450D 5343 5245 570D 5343"            /* PSCREESCREWSC */	$"5255 420D 5343 5255 4D0D 5343 5542 410D"            /* RUBSCRUMSCUBA */	$"5345 4441 4E0D 5345 4544 590D 5345 4755"            /* SEDANSEEDYSEGU */	$"450D 5345 495A 450D 5345 4D45 4E0D 5345"            /* ESEIZESEMENSE */	$"4E53 450D 5345 5049 410D 5345 5249 460D"            /* NSESEPIASERIF */	$"5345 5255 4D0D 5345 5256 450D 5345 5455"            /* SERUMSERVESETU */	$"500D 5345 5645 4E0D 5345 5645 520D 5345"            /* PSEVENSEVERSE */	$"5745 520D 5348 4143 4B0D 5348 4144 450D"            /* WERSHACKSHADE */	$"5348 4144 590D 5348 4146 540D 5348 414B"            /* SHADYSHAFTSHAK */	$"450D 5348 414B 590D 5348 414C 450D 5348"            /* ESHAKYSHALESH */	$"414C 4C0D 5348 414C 540D 5348 414D 450D"            /* ALLSHALTSHAME */	$"5348 414E 4B0D 5348 4150 450D 5348 4152"            /* SHANKSHAPESHAR */	$"440D 5348 4152 450D 5348 4152 4B0D 5348"            /* DSHARESHARKSH */	$"4152 500D 5348 4156 450D 5348 4157 4C0D"            /* ARPSHAVESHAWL */	$"5348 4541 520D 5348 4545 4E0D 5348 4545"            /* SHEARSHEENSHEE */	$"500D 5348 4545 520D 5348 4545 540D 5348"            /* PSHEERSHEETSH */	$"4549 4B0D 5348 454C 460D 5348 454C 4C0D"            /* EIKSHELFSHELL */	$"5348 4945 440D 5348 4946 540D 5348 494E"            /* SHIEDSHIFTSHIN */	$"450D 5348 494E 590D 5348 4952 450D 5348"            /* ESHINYSHIRESH */	$"4952 4B0D 5348 4952 540D 5348 4F41 4C0D"            /* IRKSHIRTSHOAL */	$"5348 4F43 4B0D 5348 4F4E 450D 5348 4F4F"            /* SHOCKSHONESHOO */	$"4B0D 5348 4F4F 540D 5348 4F52 450D 5348"            /* KSHOOTSHORESH */	$"4F52 4E0D 5348 4F52 540D 5348 4F55 540D"            /* ORNSHORTSHOUT */	$"5348 4F56 450D 5348 4F57 4E0D 5348 4F57"            /* SHOVESHOWNSHOW */	$"590D 5348 5245 570D 5348 5255 420D 5348"            /* YSHREWSHRUBSH */	$"5255 470D 5348 5543 4B0D 5348 554E 540D"            /* RUGSHUCKSHUNT */	$"5348 5553 480D 5348 594C 590D 5349 4547"            /* SHUSHSHYLYSIEG */	$"450D 5349 4556 450D 5349 4748 540D 5349"            /* ESIEVESIGHTSI */	$"474D 410D 5349 4C4B 590D 5349 4C4C 590D"            /* GMASILKYSILLY */	$"5349 4E43 450D 5349 4E45 570D 5349 4E47"            /* SINCESINEWSING */	$"450D 5349 5245 4E0D 5349 5353 590D 5349"            /* ESIRENSISSYSI */	$"5854 480D 5349 5854 590D 534B 4154 450D"            /* XTHSIXTYSKATE */	$"534B 4945 520D 534B 4946 460D 534B 494C"            /* SKIERSKIFFSKIL */	$"4C0D 534B 494D 500D 534B 4952 540D 534B"            /* LSKIMPSKIRTSK */	$"554C 4B0D 534B 554C 4C0D 534B 554E 4B0D"            /* ULKSKULLSKUNK */	$"534C 4143 4B0D 534C 4149 4E0D 534C 414E"            /* SLACKSLAINSLAN */	$"470D 534C 414E 540D 534C 4153 480D 534C"            /* GSLANTSLASHSL */	$"4154 450D 534C 4545 4B0D 534C 4545 500D"            /* ATESLEEKSLEEP */	$"534C 4545 540D 534C 4550 540D 534C 4943"            /* SLEETSLEPTSLIC */	$"450D 534C 4943 4B0D 534C 4944 450D 534C"            /* ESLICKSLIDESL */	$"494D 450D 534C 494D 590D 534C 494E 470D"            /* IMESLIMYSLING */	$"534C 494E 4B0D 534C 4F4F 500D 534C 4F50"            /* SLINKSLOOPSLOP */	$"450D 534C 4F53 480D 534C 4F54 480D 534C"            /* ESLOSHSLOTHSL */	$"554D 500D 534C 554E 470D 534C 554E 4B0D"            /* UMPSLUNGSLUNK */	$"534C 5552 500D 534C 5553 480D 534C 594C"            /* SLURPSLUSHSLYL */	$"590D 534D 4143 4B0D 534D 414C 4C0D 534D"            /* YSMACKSMALLSM */	$"4152 540D 534D 4153 480D 534D 4541 520D"            /* ARTSMASHSMEAR */	$"534D 454C 4C0D 534D 454C 540D 534D 494C"            /* SMELLSMELTSMIL */	$"450D 534D 4952 4B0D 534D 4954 450D 534D"            /* ESMIRKSMITESM */	$"4954 480D 534D 4F43 4B0D 534D 4F4B 450D"            /* ITHSMOCKSMOKE */	$"534D 4F4B 590D 534D 4F54 450D 534E 4143"            /* SMOKYSMOTESNAC */	$"4B0D 534E 4149 4C0D 534E 414B 450D 534E"            /* KSNAILSNAKESN */	$"414B 590D 534E 4152 450D 534E 4152 4C0D"            /* AKYSNARESNARL */	$"534E 4541 4B0D 534E 4545 520D 534E 4944"            /* SNEAKSNEERSNID */	$"450D 534E 4946 460D 534E 4950 450D 534E"            /* ESNIFFSNIPESN */	$"4F4F 500D 534E 4F52 450D 534E 4F52 540D"            /* OOPSNORESNORT */	$"534E 4F55 540D 534E 4F57 590D 534E 5543"            /* SNOUTSNOWYSNUC */	$"4B0D 534E 5546 460D 534F 4150 590D 534F"            /* KSNUFFSOAPYSO */	$"4245 520D 534F 4747 590D 534F 4C41 520D"            /* BERSOGGYSOLAR */	$"534F 4C49 440D 534F 4C56 450D 534F 4E41"            /* SOLIDSOLVESONA */	$"520D 534F 4E49 430D 534F 4F54 480D 534F"            /* RSONICSOOTHSO */	$"4F54 590D 534F 5252 590D 534F 554E 440D"            /* OTYSORRYSOUND */	$"534F 5554 480D 534F 5745 520D 5350 4143"            /* SOUTHSOWERSPAC */	$"450D 5350 4144 450D 5350 414E 4B0D 5350"            /* ESPADESPANKSP */	$"4152 450D 5350 4152 4B0D 5350 4153 4D0D"            /* ARESPARKSPASM */	$"5350 4157 4E0D 5350 4541 4B0D 5350 4541"            /* SPAWNSPEAKSPEA */	$"520D 5350 4543 4B0D 5350 4545 440D 5350"            /* RSPECKSPEEDSP */	$"454C 4C0D 5350 454C 540D 5350 454E 440D"            /* ELLSPELTSPEND */	$"5350 454E 540D 5350 4552 4D0D 5350 4943"            /* SPENTSPERMSPIC */	$"450D 5350 4943 590D 5350 4945 440D 5350"            /* ESPICYSPIEDSP */	$"4945 4C0D 5350 494B 450D 5350 494B 590D"            /* IELSPIKESPIKY */	$"5350 494C 4C0D 5350 494C 540D 5350 494E"            /* SPILLSPILTSPIN */	$"450D 5350 494E 590D 5350 4952 450D 5350"            /* ESPINYSPIRESP */	$"4954 450D 5350 4C41 540D 5350 4C49 540D"            /* ITESPLATSPLIT */	$"5350 4F49 4C0D 5350 4F4B 450D 5350 4F4F"            /* SPOILSPOKESPOO */	$"460D 5350 4F4F 4B0D 5350 4F4F 4C0D 5350"            /* FSPOOKSPOOLSP */	$"4F4F 4E0D 5350 4F52 450D 5350 4F52 540D"            /* OONSPORESPORT */	$"5350 4F55 540D 5350 5241 590D 5350 5245"            /* SPOUTSPRAYSPRE */	$"450D 5350 5249 470D 5350 554E 4B0D 5350"            /* ESPRIGSPUNKSP */	$"5552 4E0D 5350 5552 540D 5351 5541 440D"            /* URNSPURTSQUAD */	$"5351 5541 540D 5351 5549 420D 5354 4143"            /* SQUATSQUIBSTAC */	$"4B0D 5354 4146 460D 5354 4147 450D 5354"            /* KSTAFFSTAGEST */	$"4149 440D 5354 4149 4E0D 5354 4149 520D"            /* AIDSTAINSTAIR */	$"5354 414B 450D 5354 414C 450D 5354 414C"            /* STAKESTALESTAL */	$"4B0D 5354 414C 4C0D 5354 414D 500D 5354"            /* KSTALLSTAMPST */	$"414E 440D 5354 414E 4B0D 5354 4152 450D"            /* ANDSTANKSTARE */	$"5354 4152 4B0D 5354 4152 540D 5354 4153"            /* STARKSTARTSTAS */	$"480D 5354 4154 450D 5354 4156 450D 5354"            /* HSTATESTAVEST */	$"4541 440D 5354 4541 4B0D 5354 4541 4C0D"            /* EADSTEAKSTEAL */	$"5354 4541 4D0D 5354 4545 440D 5354 4545"            /* STEAMSTEEDSTEE */	$"4C0D 5354 4545 500D 5354 4545 520D 5354"            /* LSTEEPSTEERST */	$"4549 4E0D 5354 4552 4E0D 5354 4943 4B0D"            /* EINSTERNSTICK */	$"5354 4946 460D 5354 494C 4C0D 5354 494C"            /* STIFFSTILLSTIL */	$"540D 5354 494E 470D 5354 494E 4B0D 5354"            /* TSTINGSTINKST */	$"494E 540D 5354 4F43 4B0D 5354 4F49 430D"            /* INTSTOCKSTOIC */	$"5354 4F4B 450D 5354 4F4C 450D 5354 4F4D"            /* STOKESTOLESTOM */	$"500D 5354 4F4E 450D 5354 4F4E 590D 5354"            /* PSTONESTONYST */	$"4F4F 440D 5354 4F4F 4C0D 5354 4F4F 500D"            /* OODSTOOLSTOOP */	$"5354 4F52 450D 5354 4F52 4B0D 5354 4F52"            /* STORESTORKSTOR */	$"4D0D 5354 4F52 590D 5354 4F55 540D 5354"            /* MSTORYSTOUTST */	$"4F56 450D 5354 5241 500D 5354 5241 570D"            /* OVESTRAPSTRAW */	$"5354 5241 590D 5354 5249 500D 5354 5255"            /* STRAYSTRIPSTRU */	$"540D 5354 5543 4B0D 5354 5544 590D 5354"            /* TSTUCKSTUDYST */	$"5546 460D 5354 554D 500D 5354 554E 470D"            /* UFFSTUMPSTUNG */	$"5354 554E 4B0D 5354 554E 540D 5354 594C"            /* STUNKSTUNTSTYL */	$"450D 5355 4156 450D 5355 4741 520D 5355"            /* ESUAVESUGARSU */	$"494E 470D 5355 4954 450D 5355 4C4B 590D"            /* INGSUITESULKY */	$"5355 4C4C 590D 5355 4D41 430D 5355 4E4E"            /* SULLYSUMACSUNN */	$"590D 5355 5045 520D 5355 5245 520D 5355"            /* YSUPERSURERSU */	$"5247 450D 5355 524C 590D 5355 5348 490D"            /* RGESURLYSUSHI */	$"5357 414D 490D 5357 414D 500D 5357 4152"            /* SWAMISWAMPSWAR */	$"4D0D 5357 4153 480D 5357 4154 480D 5357"            /* MSWASHSWATHSW */	$"4541 520D 5357 4541 540D 5357 4545 500D"            /* EARSWEATSWEEP */	$"5357 4545 540D 5357 454C 4C0D 5357 4550"            /* SWEETSWELLSWEP */	$"540D 5357 4946 540D 5357 494C 4C0D 5357"            /* TSWIFTSWILLSW */	$"494E 450D 5357 494E 470D 5357 4952 4C0D"            /* INESWINGSWIRL */	$"5357 4953 480D 5357 4F4F 4E0D 5357 4F4F"            /* SWISHSWOONSWOO */	$"500D 5357 4F52 440D 5357 4F52 450D 5357"            /* PSWORDSWORESW */	$"4F52 4E0D 5357 554E 470D 5359 4E4F 440D"            /* ORNSWUNGSYNOD */	$"5359 5255 500D 5441 4242 590D 5441 424C"            /* SYRUPTABBYTABL */	$"450D 5441 424F 4F0D 5441 4349 540D 5441"            /* ETABOOTACITTA */	$"434B 590D 5441 4646 590D 5441 494E 540D"            /* CKYTAFFYTAINT */	$"5441 4B45 4E0D 5441 4B45 520D 5441 4C4C"            /* TAKENTAKERTALL */	$"590D 5441 4C4F 4E0D 5441 4D45 520D 5441"            /* YTALONTAMERTA */	$"4E47 4F0D 5441 4E47 590D 5441 5045 520D"            /* NGOTANGYTAPER */	$"5441 5049 520D 5441 5244 590D 5441 524F"            /* TAPIRTARDYTARO */	$"540D 5441 5354 450D 5441 5354 590D 5441"            /* TTASTETASTYTA */	$"5454 590D 5441 554E 540D 5441 574E 590D"            /* TTYTAUNTTAWNY */	$"5445 4143 480D 5445 4152 590D 5445 4153"            /* TEACHTEARYTEAS */	$"450D 5445 4444 590D 5445 4554 480D 5445"            /* ETEDDYTEETHTE */	$"4D50 4F0D 5445 4E45 540D 5445 4E4F 520D"            /* MPOTENETTENOR */	$"5445 4E53 450D 5445 4E54 480D 5445 5045"            /* TENSETENTHTEPE */	$"450D 5445 5049 440D 5445 5252 410D 5445"            /* ETEPIDTERRATE */	$"5253 450D 5445 5354 590D 5448 414E 4B0D"            /* RSETESTYTHANK */	$"5448 4546 540D 5448 4549 520D 5448 454D"            /* THEFTTHEIRTHEM */	$"450D 5448 4552 450D 5448 4553 450D 5448"            /* ETHERETHESETH */	$"4554 410D 5448 4943 4B0D 5448 4945 460D"            /* ETATHICKTHIEF */	$"5448 4947 480D 5448 494E 470D 5448 494E"            /* THIGHTHINGTHIN */	$"4B0D 5448 4952 440D 5448 4F4E 470D 5448"            /* KTHIRDTHONGTH */	$"4F52 4E0D 5448 4F53 450D 5448 5245 450D"            /* ORNTHOSETHREE */	$"5448 5245 570D 5448 524F 420D 5448 524F"            /* THREWTHROBTHRO */	$"570D 5448 5255 4D0D 5448 554D 420D 5448"            /* WTHRUMTHUMBTH */	$"554D 500D 5448 594D 450D 5449 4152 410D"            /* UMPTHYMETIARA */	$"5449 4249 410D 5449 4441 4C0D 5449 4745"            /* TIBIATIDALTIGE */	$"520D 5449 4748 540D 5449 4C44 450D 5449"            /* RTIGHTTILDETI */	$"4D45 520D 5449 4D49 440D 5449 5053 590D"            /* MERTIMIDTIPSY */	$"5449 5441 4E0D 5449 5448 450D 5449 544C"            /* TITANTITHETITL */	$"450D 544F 4153 540D 544F 4441 590D 544F"            /* ETOASTTODAYTO */	$"4444 590D 544F 4B45 4E0D 544F 4E41 4C0D"            /* DDYTOKENTONAL */	$"544F 4E47 410D 544F 4E49 430D 544F 4F54"            /* TONGATONICTOOT */	$"480D 544F 5041 5A0D 544F 5049 430D 544F"            /* HTOPAZTOPICTO */	$"5243 480D 544F 5253 4F0D 544F 5255 530D"            /* RCHTORSOTORUS */	$"544F 5441 4C0D 544F 5445 4D0D 544F 5543"            /* TOTALTOTEMTOUC */	$"480D 544F 5547 480D 544F 5745 4C0D 544F"            /* HTOUGHTOWELTO */	$"5745 520D 544F 5849 430D 544F 5849 4E0D"            /* WERTOXICTOXIN */	$"5452 4143 450D 5452 4143 4B0D 5452 4143"            /* TRACETRACKTRAC */	$"540D 5452 4144 450D 5452 4149 4C0D 5452"            /* TTRADETRAILTR */	$"4149 4E0D 5452 4149 540D 5452 414D 500D"            /* AINTRAITTRAMP */	$"5452 4153 480D 5452 4157 4C0D 5452 4541"            /* TRASHTRAWLTREA */	$"440D 5452 4541 540D 5452 454E 440D 5452"            /* DTREATTRENDTR */	$"4941 440D 5452 4941 4C0D 5452 4942 450D"            /* IADTRIALTRIBE */	$"5452 4943 450D 5452 4943 4B0D 5452 4945"            /* TRICETRICKTRIE */	$"440D 5452 4950 450D 5452 4954 450D 5452"            /* DTRIPETRITETR */	$"4F4C 4C0D 5452 4F4F 500D 5452 4F50 450D"            /* OLLTROOPTROPE */	$"5452 4F55 540D 5452 4F56 450D 5452 5543"            /* TROUTTROVETRUC */	$"450D 5452 5543 4B0D 5452 5545 520D 5452"            /* ETRUCKTRUERTR */	$"554C 590D 5452 554D 500D 5452 554E 4B0D"            /* ULYTRUMPTRUNK */	$"5452 5553 530D 5452 5553 540D 5452 5554"            /* TRUSSTRUSTTRUT */	$"480D 5452 5953 540D 5455 4241 4C0D 5455"            /* HTRYSTTUBALTU */	$"4245 520D 5455 4C49 500D 5455 4C4C 450D"            /* BERTULIPTULLE */	$"5455 4D4F 520D 5455 4E49 430D 5455 5242"            /* TUMORTUNICTURB */	$"4F0D 5455 544F 520D 5457 414E 470D 5457"            /* OTUTORTWANGTW */	$"4541 4B0D 5457 4545 440D 5457 4545 540D"            /* EAKTWEEDTWEET */	$"5457 4943 450D 5457 494E 450D 5457 4952"            /* TWICETWINETWIR */	$"4C0D 5457 4953 540D 5457 4958 540D 5459"            /* LTWISTTWIXTTY */	$"494E 470D 5544 4445 520D 554C 4345 520D"            /* INGUDDERULCER */	$"554C 5452 410D 554D 4252 410D 554E 434C"            /* ULTRAUMBRAUNCL */	$"450D 554E 4355 540D 554E 4445 520D 554E"            /* EUNCUTUNDERUN */	$"4449 440D 554E 4455 450D 554E 4645 440D"            /* DIDUNDUEUNFED */	$"554E 4649 540D 554E 4946 590D 554E 494F"            /* UNFITUNIFYUNIO */	$"4E0D 554E 4954 450D 554E 4954 590D 554E"            /* NUNITEUNITYUN */	$"4C49 540D 554E 4D45 540D 554E 5345 540D"            /* LITUNMETUNSET */	$"554E 5449 450D 554E 5449 4C0D 554E 5745"            /* UNTIEUNTILUNWE */	$"440D 554E 5A49 500D 5550 5045 520D 5550"            /* DUNZIPUPPERUP */	$"5345 540D 5552 4241 4E0D 5552 494E 450D"            /* SETURBANURINE */	$"5553 4147 450D 5553 4845 520D 5553 494E"            /* USAGEUSHERUSIN */	$"470D 5553 5541 4C0D 5553 5552 500D 5554"            /* GUSUALUSURPUT */	$"494C 450D 5554 5445 520D 5641 4755 450D"            /* ILEUTTERVAGUE */	$"5641 4C45 540D 5641 4C49 440D 5641 4C4F"            /* VALETVALIDVALO */	$"520D 5641 4C55 450D 5641 4C56 450D 5641"            /* RVALUEVALVEVA */	$"5049 440D 5641 504F 520D 5641 554C 540D"            /* PIDVAPORVAULT */	$"5641 554E 540D 5645 4741 4E0D 5645 4E4F"            /* VAUNTVEGANVENO */	$"4D0D 5645 4E55 450D 5645 5247 450D 5645"            /* MVENUEVERGEVE */	$"5253 450D 5645 5253 4F0D 5645 5256 450D"            /* RSEVERSOVERVE */	$"5649 4341 520D 5649 4445 4F0D 5649 4749"            /* VICARVIDEOVIGI */	$"4C0D 5649 474F 520D 5649 4C4C 410D 5649"            /* LVIGORVILLAVI */	$"4E59 4C0D 5649 4F4C 410D 5649 5045 520D"            /* NYLVIOLAVIPER */	$"5649 5241 4C0D 5649 5255 530D 5649 5349"            /* VIRALVIRUSVISI */	$"540D 5649 534F 520D 5649 5354 410D 5649"            /* TVISORVISTAVI */	$"5441 4C0D 5649 5649 440D 5649 5845 4E0D"            /* TALVIVIDVIXEN */	$"564F 4341 4C0D 564F 444B 410D 564F 4755"            /* VOCALVODKAVOGU */	$"450D 564F 4943 450D 564F 494C 410D 564F"            /* EVOICEVOILAVO */	$"4D49 540D 564F 5445 520D 564F 5543 480D"            /* MITVOTERVOUCH */	$"564F 5745 4C0D 5659 494E 470D 5741 434B"            /* VOWELVYINGWACK */	$"590D 5741 4645 520D 5741 4745 520D 5741"            /* YWAFERWAGERWA */	$"474F 4E0D 5741 4953 540D 5741 4956 450D"            /* GONWAISTWAIVE */	$"5741 4C54 5A0D 5741 5254 590D 5741 5354"            /* WALTZWARTYWAST */	$"450D 5741 5443 480D 5741 5445 520D 5741"            /* EWATCHWATERWA */	$"5645 520D 5741 5845 4E0D 5745 4152 590D"            /* VERWAXENWEARY */	$"5745 4156 450D 5745 4447 450D 5745 4544"            /* WEAVEWEDGEWEED */	$"590D 5745 4947 480D 5745 4952 440D 5745"            /* YWEIGHWEIRDWE */	$"4C43 480D 5745 4C53 480D 5748 4143 4B0D"            /* LCHWELSHWHACK */	$"5748 414C 450D 5748 4152 460D 5748 4541"            /* WHALEWHARFWHEA */	$"540D 5748 4545 4C0D 5748 454C 500D 5748"            /* TWHEELWHELPWH */	$"4552 450D 5748 4943 480D 5748 4946 460D"            /* EREWHICHWHIFF */	$"5748 494C 450D 5748 494E 450D 5748 494E"            /* WHILEWHINEWHIN */	$"590D 5748 4952 4C0D 5748 4953 4B0D 5748"            /* YWHIRLWHISKWH */	$"4954 450D 5748 4F4C 450D 5748 4F4F 500D"            /* ITEWHOLEWHOOP */	$"5748 4F53 450D 5749 4445 4E0D 5749 4445"            /* WHOSEWIDENWIDE */	$"520D 5749 444F 570D 5749 4454 480D 5749"            /* RWIDOWWIDTHWI */	$"454C 440D 5749 4748 540D 5749 4C4C 590D"            /* ELDWIGHTWILLY */	$"5749 4D50 590D 5749 4E43 450D 5749 4E43"            /* WIMPYWINCEWINC */	$"480D 5749 4E44 590D 5749 5345 520D 5749"            /* HWINDYWISERWI */	$"5350 590D 5749 5443 480D 5749 5454 590D"            /* SPYWITCHWITTY */	$"574F 4B45 4E0D 574F 4D41 4E0D 574F 4D45"            /* WOKENWOMANWOME */	$"4E0D 574F 4F44 590D 574F 4F45 520D 574F"            /* NWOODYWOOERWO */	$"4F4C 590D 574F 4F5A 590D 574F 5244 590D"            /* OLYWOOZYWORDY */	$"574F 524C 440D 574F 5252 590D 574F 5253"            /* WORLDWORRYWORS */	$"450D 574F 5253 540D 574F 5254 480D 574F"            /* EWORSTWORTHWO */	$"554C 440D 574F 554E 440D 574F 5645 4E0D"            /* ULDWOUNDWOVEN */	$"5752 4143 4B0D 5752 4154 480D 5752 4541"            /* WRACKWRATHWREA */	$"4B0D 5752 4543 4B0D 5752 4553 540D 5752"            /* KWRECKWRESTWR */	$"494E 470D 5752 4953 540D 5752 4954 450D"            /* INGWRISTWRITE */	$"5752 4F4E 470D 5752 4F54 450D 5752 554E"            /* WRONGWROTEWRUN */	$"470D 5752 594C 590D 5941 4348 540D 5945"            /* GWRYLYYACHTYE */	$"4152 4E0D 5945 4153 540D 5949 454C 440D"            /* ARNYEASTYIELD */	$"594F 554E 470D 594F 5554 480D 5A45 4252"            /* YOUNGYOUTHZEBR */	$"410D 5A45 5354 590D 5A4F 4E41 4C"                   /* AZESTYZONAL */};data 'TEXT' (129) {	$"4141 4845 440D 4141 4C49 490D 4141 5247"            /* AAHEDAALIIAARG */	$"480D 4141 5254 490D 4142 4143 410D 4142"            /* HAARTIABACAAB */	$"4143 490D 4142 4143 530D 4142 4146 540D"            /* ACIABACSABAFT */	$"4142 414B 410D 4142 414D 500D 4142 414E"            /* ABAKAABAMPABAN */	$"440D 4142 4153 480D 4142 4153 4B0D 4142"            /* DABASHABASKAB */	$"4159 410D 4142 4241 530D 4142 4245 440D"            /* AYAABBASABBED */	$"4142 4245 530D 4142 4345 450D 4142 4541"            /* ABBESABCEEABEA */	$"4D0D 4142 4541 520D 4142 454C 450D 4142"            /* MABEARABELEAB */	$"4552 530D 4142 4554 530D 4142 4945 530D"            /* ERSABETSABIES */	$"4142 4C45 520D 4142 4C45 530D 4142 4C45"            /* ABLERABLESABLE */	$"540D 4142 4C4F 570D 4142 4D48 4F0D 4142"            /* TABLOWABMHOAB */	$"4F48 4D0D 4142 4F49 4C0D 4142 4F4D 410D"            /* OHMABOILABOMA */	$"4142 4F4F 4E0D 4142 4F52 440D 4142 4F52"            /* ABOONABORDABOR */	$"450D 4142 5241 4D0D 4142 5241 590D 4142"            /* EABRAMABRAYAB */	$"5249 4D0D 4142 5249 4E0D 4142 5249 530D"            /* RIMABRINABRIS */	$"4142 5345 590D 4142 5349 540D 4142 554E"            /* ABSEYABSITABUN */	$"410D 4142 554E 450D 4142 5554 530D 4142"            /* AABUNEABUTSAB */	$"555A 5A0D 4142 5945 530D 4142 5953 4D0D"            /* UZZABYESABYSM */	$"4143 4149 530D 4143 4152 490D 4143 4341"            /* ACAISACARIACCA */	$"530D 4143 434F 590D 4143 4552 420D 4143"            /* SACCOYACERBAC */	$"4552 530D 4143 4554 410D 4143 4841 520D"            /* ERSACETAACHAR */	$"4143 4845 440D 4143 4845 530D 4143 484F"            /* ACHEDACHESACHO */	$"4F0D 4143 4944 530D 4143 4944 590D 4143"            /* OACIDSACIDYAC */	$"494E 470D 4143 494E 490D 4143 4B45 450D"            /* INGACINIACKEE */	$"4143 4B45 520D 4143 4D45 530D 4143 4D49"            /* ACKERACMESACMI */	$"430D 4143 4E45 440D 4143 4E45 530D 4143"            /* CACNEDACNESAC */	$"4F43 4B0D 4143 4F4C 440D 4143 5245 440D"            /* OCKACOLDACRED */	$"4143 5245 530D 4143 524F 530D 4143 5445"            /* ACRESACROSACTE */	$"440D 4143 5449 4E0D 4143 544F 4E0D 4143"            /* DACTINACTONAC */	$"594C 530D 4144 4157 530D 4144 4159 530D"            /* YLSADAWSADAYS */	$"4144 424F 540D 4144 4441 580D 4144 4445"            /* ADBOTADDAXADDE */	$"440D 4144 4445 520D 4144 4449 4F0D 4144"            /* DADDERADDIOAD */	$"444C 450D 4144 4545 4D0D 4144 4841 4E0D"            /* DLEADEEMADHAN */	$"4144 4945 550D 4144 494F 530D 4144 4954"            /* ADIEUADIOSADIT */	$"530D 4144 4D41 4E0D 4144 4D45 4E0D 4144"            /* SADMANADMENAD */	$"4D49 580D 4144 4F42 4F0D 4144 4F57 4E0D"            /* MIXADOBOADOWN */	$"4144 4F5A 450D 4144 5241 440D 4144 5245"            /* ADOZEADRADADRE */	$"440D 4144 5355 4D0D 4144 554B 490D 4144"            /* DADSUMADUKIAD */	$"554E 430D 4144 5553 540D 4144 5645 570D"            /* UNCADUSTADVEW */	$"4144 5954 410D 4144 5A45 440D 4144 5A45"            /* ADYTAADZEDADZE */	$"530D 4145 4349 410D 4145 4445 530D 4145"            /* SAECIAAEDESAE */	$"4749 530D 4145 4F4E 530D 4145 5249 450D"            /* GISAEONSAERIE */	$"4145 524F 530D 4145 5349 520D 4146 414C"            /* AEROSAESIRAFAL */	$"440D 4146 4152 410D 4146 4152 530D 4146"            /* DAFARAAFARSAF */	$"4541 520D 4146 4C41 4A0D 4146 4F52 450D"            /* EARAFLAJAFORE */	$"4146 5249 540D 4146 524F 530D 4147 414D"            /* AFRITAFROSAGAM */	$"410D 4147 414D 490D 4147 4152 530D 4147"            /* AAGAMIAGARSAG */	$"4153 540D 4147 4156 450D 4147 415A 450D"            /* ASTAGAVEAGAZE */	$"4147 454E 450D 4147 4552 530D 4147 4745"            /* AGENEAGERSAGGE */	$"520D 4147 4749 450D 4147 4752 490D 4147"            /* RAGGIEAGGRIAG */	$"4752 4F0D 4147 4752 590D 4147 4841 530D"            /* GROAGGRYAGHAS */	$"4147 494C 410D 4147 494F 530D 4147 4953"            /* AGILAAGIOSAGIS */	$"4D0D 4147 4953 540D 4147 4954 410D 4147"            /* MAGISTAGITAAG */	$"4C45 450D 4147 4C45 540D 4147 4C45 590D"            /* LEEAGLETAGLEY */	$"4147 4C4F 4F0D 4147 4C55 530D 4147 4D41"            /* AGLOOAGLUSAGMA */	$"530D 4147 4F47 450D 4147 4F4E 450D 4147"            /* SAGOGEAGONEAG */	$"4F4E 530D 4147 4F4F 440D 4147 4F52 410D"            /* ONSAGOODAGORA */	$"4147 5249 410D 4147 5249 4E0D 4147 524F"            /* AGRIAAGRINAGRO */	$"530D 4147 5545 440D 4147 5545 530D 4147"            /* SAGUEDAGUESAG */	$"554E 410D 4147 5554 490D 4148 4541 500D"            /* UNAAGUTIAHEAP */	$"4148 454E 540D 4148 4947 480D 4148 494E"            /* AHENTAHIGHAHIN */	$"440D 4148 494E 470D 4148 494E 540D 4148"            /* DAHINGAHINTAH */	$"4F4C 440D 4148 554C 4C0D 4148 5552 550D"            /* OLDAHULLAHURU */	$"4149 4441 530D 4149 4445 440D 4149 4445"            /* AIDASAIDEDAIDE */	$"530D 4149 444F 490D 4149 444F 530D 4149"            /* SAIDOIAIDOSAI */	$"4552 590D 4149 4741 530D 4149 4748 540D"            /* ERYAIGASAIGHT */	$"4149 4C45 440D 4149 4D45 440D 4149 4D45"            /* AILEDAIMEDAIME */	$"520D 4149 4E45 450D 4149 4E47 410D 4149"            /* RAINEEAINGAAI */	$"4F4C 490D 4149 5245 440D 4149 5245 520D"            /* OLIAIREDAIRER */	$"4149 524E 530D 4149 5254 480D 4149 5254"            /* AIRNSAIRTHAIRT */	$"530D 4149 5443 480D 4149 5455 530D 4149"            /* SAITCHAITUSAI */	$"5645 520D 4149 5945 450D 4149 5A4C 450D"            /* VERAIYEEAIZLE */	$"414A 4945 530D 414A 4956 410D 414A 5547"            /* AJIESAJIVAAJUG */	$"410D 414A 5741 4E0D 414B 4545 530D 414B"            /* AAJWANAKEESAK */	$"454C 410D 414B 454E 450D 414B 494E 470D"            /* ELAAKENEAKING */	$"414B 4954 410D 414B 4B41 530D 414C 4141"            /* AKITAAKKASALAA */	$"500D 414C 4143 4B0D 414C 414D 4F0D 414C"            /* PALACKALAMOAL */	$"414E 440D 414C 414E 450D 414C 414E 470D"            /* ANDALANEALANG */	$"414C 414E 530D 414C 414E 540D 414C 4150"            /* ALANSALANTALAP */	$"410D 414C 4150 530D 414C 4152 590D 414C"            /* AALAPSALARYAL */	$"4154 450D 414C 4159 530D 414C 4241 530D"            /* ATEALAYSALBAS */	$"414C 4245 450D 414C 4349 440D 414C 434F"            /* ALBEEALCIDALCO */	$"530D 414C 4445 410D 414C 4445 520D 414C"            /* SALDEAALDERAL */	$"444F 4C0D 414C 4543 4B0D 414C 4543 530D"            /* DOLALECKALECS */	$"414C 4546 530D 414C 4546 540D 414C 4550"            /* ALEFSALEFTALEP */	$"480D 414C 4557 530D 414C 4559 450D 414C"            /* HALEWSALEYEAL */	$"4641 530D 414C 4741 4C0D 414C 4741 530D"            /* FASALGALALGAS */	$"414C 4749 440D 414C 4749 4E0D 414C 474F"            /* ALGIDALGINALGO */	$"520D 414C 4755 4D0D 414C 4941 530D 414C"            /* RALGUMALIASAL */	$"4946 530D 414C 494E 450D 414C 4953 540D"            /* IFSALINEALIST */	$"414C 4959 410D 414C 4B49 450D 414C 4B4F"            /* ALIYAALKIEALKO */	$"530D 414C 4B59 440D 414C 4B59 4C0D 414C"            /* SALKYDALKYLAL */	$"4C45 450D 414C 4C45 4C0D 414C 4C49 530D"            /* LEEALLELALLIS */	$"414C 4C4F 440D 414C 4C59 4C0D 414C 4D41"            /* ALLODALLYLALMA */	$"480D 414C 4D41 530D 414C 4D45 480D 414C"            /* HALMASALMEHAL */	$"4D45 530D 414C 4D55 440D 414C 4D55 470D"            /* MESALMUDALMUG */	$"414C 4F44 530D 414C 4F45 440D 414C 4F45"            /* ALODSALOEDALOE */	$"530D 414C 4F48 410D 414C 4F49 4E0D 414C"            /* SALOHAALOINAL */	$"4F4F 530D 414C 4F57 450D 414C 5448 4F0D"            /* OOSALOWEALTHO */	$"414C 544F 530D 414C 554C 410D 414C 554D"            /* ALTOSALULAALUM */	$"530D 414C 5552 450D 414C 5641 520D 414C"            /* SALUREALVARAL */	$"5741 590D 414D 4148 530D 414D 4149 4E0D"            /* WAYAMAHSAMAIN */	$"414D 4154 450D 414D 4155 540D 414D 4241"            /* AMATEAMAUTAMBA */	$"4E0D 414D 4249 540D 414D 424F 530D 414D"            /* NAMBITAMBOSAM */	$"4252 590D 414D 4542 410D 414D 4545 520D"            /* BRYAMEBAAMEER */	$"414D 454E 450D 414D 454E 530D 414D 454E"            /* AMENEAMENSAMEN */	$"540D 414D 4941 530D 414D 4943 450D 414D"            /* TAMIASAMICEAM */	$"4943 490D 414D 4944 450D 414D 4944 4F0D"            /* ICIAMIDEAMIDO */	$"414D 4944 530D 414D 4945 530D 414D 4947"            /* AMIDSAMIESAMIG */	$"410D 414D 4947 4F0D 414D 494E 450D 414D"            /* AAMIGOAMINEAM */	$"494E 4F0D 414D 494E 530D 414D 4952 530D"            /* INOAMINSAMIRS */	$"414D 4C41 530D 414D 4D41 4E0D 414D 4D4F"            /* AMLASAMMANAMMO */	$"4E0D 414D 4D4F 530D 414D 4E49 410D 414D"            /* NAMMOSAMNIAAM */	$"4E49 430D 414D 4E49 4F0D 414D 4F4B 530D"            /* NICAMNIOAMOKS */	$"414D 4F4C 450D 414D 4F52 540D 414D 4F55"            /* AMOLEAMORTAMOU */	$"520D 414D 4F56 450D 414D 4F57 540D 414D"            /* RAMOVEAMOWTAM */	$"5045 440D 414D 5055 4C0D 414D 5249 540D"            /* PEDAMPULAMRIT */	$"414D 5543 4B0D 414D 594C 530D 414E 414E"            /* AMUCKAMYLSANAN */	$"410D 414E 4154 410D 414E 4348 4F0D 414E"            /* AANATAANCHOAN */	$"434C 450D 414E 434F 4E0D 414E 4452 4F0D"            /* CLEANCONANDRO */	$"414E 4541 520D 414E 454C 450D 414E 454E"            /* ANEARANELEANEN */	$"540D 414E 4741 530D 414E 474C 4F0D 414E"            /* TANGASANGLOAN */	$"4947 480D 414E 494C 450D 414E 494C 530D"            /* IGHANILEANILS */	$"414E 494D 410D 414E 494D 490D 414E 494F"            /* ANIMAANIMIANIO */	$"4E0D 414E 4953 450D 414E 4B45 520D 414E"            /* NANISEANKERAN */	$"4B48 530D 414E 4B55 530D 414E 4C41 530D"            /* KHSANKUSANLAS */	$"414E 4E41 4C0D 414E 4E41 530D 414E 4E41"            /* ANNALANNASANNA */	$"540D 414E 4F41 530D 414E 4F4C 450D 414E"            /* TANOASANOLEAN */	$"4F4D 590D 414E 5341 450D 414E 5441 450D"            /* OMYANSAEANTAE */	$"414E 5441 520D 414E 5441 530D 414E 5445"            /* ANTARANTASANTE */	$"440D 414E 5445 530D 414E 5449 530D 414E"            /* DANTESANTISAN */	$"5452 410D 414E 5452 450D 414E 5453 590D"            /* TRAANTREANTSY */	$"414E 5552 410D 414E 594F 4E0D 4150 4143"            /* ANURAANYONAPAC */	$"450D 4150 4147 450D 4150 4149 440D 4150"            /* EAPAGEAPAIDAP */	$"4159 440D 4150 4159 530D 4150 4541 4B0D"            /* AYDAPAYSAPEAK */	$"4150 4545 4B0D 4150 4552 530D 4150 4552"            /* APEEKAPERSAPER */	$"540D 4150 4552 590D 4150 4741 520D 4150"            /* TAPERYAPGARAP */	$"4849 530D 4150 4941 4E0D 4150 494F 4C0D"            /* HISAPIANAPIOL */	$"4150 4953 480D 4150 4953 4D0D 4150 4F44"            /* APISHAPISMAPOD */	$"450D 4150 4F44 530D 4150 4F4F 500D 4150"            /* EAPODSAPOOPAP */	$"4F52 540D 4150 5041 4C0D 4150 5041 590D"            /* ORTAPPALAPPAY */	$"4150 5045 4C0D 4150 5052 4F0D 4150 5055"            /* APPELAPPROAPPU */	$"490D 4150 5055 590D 4150 5245 530D 4150"            /* IAPPUYAPRESAP */	$"5345 530D 4150 5349 530D 4150 534F 530D"            /* SESAPSISAPSOS */	$"4150 5445 440D 4150 5445 520D 4151 5541"            /* APTEDAPTERAQUA */	$"450D 4151 5541 530D 4152 4142 410D 4152"            /* EAQUASARABAAR */	$"414B 530D 4152 414D 450D 4152 4152 530D"            /* AKSARAMEARARS */	$"4152 4241 530D 4152 4345 440D 4152 4348"            /* ARBASARCEDARCH */	$"490D 4152 434F 530D 4152 4355 530D 4152"            /* IARCOSARCUSAR */	$"4445 420D 4152 4452 490D 4152 4541 440D"            /* DEBARDRIAREAD */	$"4152 4541 450D 4152 4541 4C0D 4152 4541"            /* AREAEAREALAREA */	$"520D 4152 4541 530D 4152 4543 410D 4152"            /* RAREASARECAAR */	$"4544 440D 4152 4544 450D 4152 4546 590D"            /* EDDAREDEAREFY */	$"4152 4549 430D 4152 454E 450D 4152 4550"            /* AREICARENEAREP */	$"410D 4152 4552 450D 4152 4554 450D 4152"            /* AAREREARETEAR */	$"4554 530D 4152 4554 540D 4152 4741 4C0D"            /* ETSARETTARGAL */	$"4152 4741 4E0D 4152 4749 4C0D 4152 474C"            /* ARGANARGILARGL */	$"450D 4152 474F 4C0D 4152 474F 4E0D 4152"            /* EARGOLARGONAR */	$"474F 540D 4152 4755 530D 4152 4841 540D"            /* GOTARGUSARHAT */	$"4152 4941 530D 4152 4945 4C0D 4152 494B"            /* ARIASARIELARIK */	$"490D 4152 494C 530D 4152 494F 540D 4152"            /* IARILSARIOTAR */	$"4953 480D 4152 4B45 440D 4152 4C45 440D"            /* ISHARKEDARLED */	$"4152 4C45 530D 4152 4D45 440D 4152 4D45"            /* ARLESARMEDARME */	$"520D 4152 4D45 540D 4152 4D49 4C0D 4152"            /* RARMETARMILAR */	$"4E41 530D 4152 4E55 540D 4152 4F42 410D"            /* NASARNUTAROBA */	$"4152 4F48 410D 4152 4F49 440D 4152 5041"            /* AROHAAROIDARPA */	$"530D 4152 5045 4E0D 4152 5241 480D 4152"            /* SARPENARRAHAR */	$"5241 530D 4152 5245 540D 4152 5249 530D"            /* RASARRETARRIS */	$"4152 524F 5A0D 4152 5345 440D 4152 5345"            /* ARROZARSEDARSE */	$"530D 4152 5345 590D 4152 5349 530D 4152"            /* SARSEYARSISAR */	$"5441 4C0D 4152 5445 4C0D 4152 5449 430D"            /* TALARTELARTIC */	$"4152 5449 530D 4152 5548 450D 4152 554D"            /* ARTISARUHEARUM */	$"530D 4152 5641 4C0D 4152 5645 450D 4152"            /* SARVALARVEEAR */	$"564F 530D 4152 594C 530D 4153 414E 410D"            /* VOSARYLSASANA */	$"4153 434F 4E0D 4153 4355 530D 4153 4449"            /* ASCONASCUSASDI */	$"430D 4153 4845 440D 4153 4845 530D 4153"            /* CASHEDASHESAS */	$"4845 540D 4153 4B45 440D 4153 4B45 520D"            /* HETASKEDASKER */	$"4153 4B4F 490D 4153 4B4F 530D 4153 5045"            /* ASKOIASKOSASPE */	$"4E0D 4153 5045 520D 4153 5049 430D 4153"            /* NASPERASPICAS */	$"5049 450D 4153 5049 530D 4153 5052 4F0D"            /* PIEASPISASPRO */	$"4153 5341 490D 4153 5341 4D0D 4153 5345"            /* ASSAIASSAMASSE */	$"530D 4153 5345 5A0D 4153 534F 540D 4153"            /* SASSEZASSOTAS */	$"5445 520D 4153 5449 520D 4153 5455 4E0D"            /* TERASTIRASTUN */	$"4153 5552 410D 4153 5741 590D 4153 5749"            /* ASURAASWAYASWI */	$"4D0D 4153 594C 410D 4154 4150 530D 4154"            /* MASYLAATAPSAT */	$"4158 590D 4154 4947 490D 4154 494C 540D"            /* AXYATIGIATILT */	$"4154 494D 590D 4154 4C41 530D 4154 4D41"            /* ATIMYATLASATMA */	$"4E0D 4154 4D41 530D 4154 4D4F 530D 4154"            /* NATMASATMOSAT */	$"4F43 530D 4154 4F4B 450D 4154 4F4B 530D"            /* OCSATOKEATOKS */	$"4154 4F4D 530D 4154 4F4D 590D 4154 4F4E"            /* ATOMSATOMYATON */	$"590D 4154 4F50 590D 4154 5249 410D 4154"            /* YATOPYATRIAAT */	$"5249 500D 4154 5441 500D 4154 5441 520D"            /* RIPATTAPATTAR */	$"4154 5541 530D 4155 4441 440D 4155 4745"            /* ATUASAUDADAUGE */	$"520D 4155 4748 540D 4155 4C41 530D 4155"            /* RAUGHTAULASAU */	$"4C49 430D 4155 4C4F 490D 4155 4C4F 530D"            /* LICAULOIAULOS */	$"4155 4D49 4C0D 4155 4E45 530D 4155 4E54"            /* AUMILAUNESAUNT */	$"530D 4155 5241 450D 4155 5241 4C0D 4155"            /* SAURAEAURALAU */	$"5241 520D 4155 5241 530D 4155 5245 490D"            /* RARAURASAUREI */	$"4155 5245 530D 4155 5249 430D 4155 5249"            /* AURESAURICAURI */	$"530D 4155 5255 4D0D 4155 544F 530D 4155"            /* SAURUMAUTOSAU */	$"5849 4E0D 4156 414C 450D 4156 414E 540D"            /* XINAVALEAVANT */	$"4156 4153 540D 4156 454C 530D 4156 454E"            /* AVASTAVELSAVEN */	$"530D 4156 4552 530D 4156 4741 530D 4156"            /* SAVERSAVGASAV */	$"494E 450D 4156 494F 4E0D 4156 4953 450D"            /* INEAVIONAVISE */	$"4156 4953 4F0D 4156 495A 450D 4156 4F57"            /* AVISOAVIZEAVOW */	$"530D 4156 595A 450D 4157 4152 4E0D 4157"            /* SAVYZEAWARNAW */	$"4154 4F0D 4157 4156 450D 4157 4159 530D"            /* ATOAWAVEAWAYS */	$"4157 444C 530D 4157 4545 4C0D 4157 4554"            /* AWDLSAWEELAWET */	$"4F0D 4157 494E 470D 4157 4D52 590D 4157"            /* OAWINGAWMRYAW */	$"4E45 440D 4157 4E45 520D 4157 4F4C 530D"            /* NEDAWNERAWOLS */	$"4157 4F52 4B0D 4158 454C 530D 4158 494C"            /* AWORKAXELSAXIL */	$"450D 4158 494C 530D 4158 494E 470D 4158"            /* EAXILSAXINGAX */	$"4954 450D 4158 4C45 440D 4158 4C45 530D"            /* ITEAXLEDAXLES */	$"4158 4D41 4E0D 4158 4D45 4E0D 4158 4F49"            /* AXMANAXMENAXOI */	$"440D 4158 4F4E 450D 4158 4F4E 530D 4159"            /* DAXONEAXONSAY */	$"4148 530D 4159 4159 410D 4159 454C 500D"            /* AHSAYAYAAYELP */	$"4159 4752 450D 4159 494E 530D 4159 4F4E"            /* AYGREAYINSAYON */	$"540D 4159 5245 530D 4159 5249 450D 415A"            /* TAYRESAYRIEAZ */	$"414E 530D 415A 4944 450D 415A 4944 4F0D"            /* ANSAZIDEAZIDO */	$"415A 494E 450D 415A 4C4F 4E0D 415A 4F49"            /* AZINEAZLONAZOI */	$"430D 415A 4F4C 450D 415A 4F4E 530D 415A"            /* CAZOLEAZONSAZ */	$"4F54 450D 415A 4F54 480D 415A 554B 490D"            /* OTEAZOTHAZUKI */	$"415A 5552 4E0D 415A 5552 590D 415A 5947"            /* AZURNAZURYAZYG */	$"590D 415A 594D 450D 415A 594D 530D 4241"            /* YAZYMEAZYMSBA */	$"4145 440D 4241 414C 530D 4241 4241 530D"            /* AEDBAALSBABAS */	$"4241 4245 4C0D 4241 4245 530D 4241 424B"            /* BABELBABESBABK */	$"410D 4241 424F 4F0D 4241 4255 4C0D 4241"            /* ABABOOBABULBA */	$"4255 530D 4241 4343 410D 4241 4343 4F0D"            /* BUSBACCABACCO */	$"4241 4343 590D 4241 4348 410D 4241 4348"            /* BACCYBACHABACH */	$"530D 4241 434B 530D 4241 4444 590D 4241"            /* SBACKSBADDYBA */	$"454C 530D 4241 4646 530D 4241 4646 590D"            /* ELSBAFFSBAFFY */	$"4241 4654 530D 4241 4748 530D 4241 4749"            /* BAFTSBAGHSBAGI */	$"450D 4241 4854 530D 4241 4855 530D 4241"            /* EBAHTSBAHUSBA */	$"4855 540D 4241 494C 530D 4241 4952 4E0D"            /* HUTBAILSBAIRN */	$"4241 4953 410D 4241 4954 480D 4241 4954"            /* BAISABAITHBAIT */	$"530D 4241 495A 410D 4241 495A 450D 4241"            /* SBAIZABAIZEBA */	$"4A41 4E0D 4241 4A52 410D 4241 4A52 490D"            /* JANBAJRABAJRI */	$"4241 4A55 530D 4241 4B45 440D 4241 4B45"            /* BAJUSBAKEDBAKE */	$"4E0D 4241 4B45 530D 4241 4B52 410D 4241"            /* NBAKESBAKRABA */	$"4C41 530D 4241 4C44 530D 4241 4C44 590D"            /* LASBALDSBALDY */	$"4241 4C45 440D 4241 4C45 530D 4241 4C4B"            /* BALEDBALESBALK */	$"530D 4241 4C4B 590D 4241 4C4C 530D 4241"            /* SBALKYBALLSBA */	$"4C4C 590D 4241 4C4D 530D 4241 4C4F 4F0D"            /* LLYBALMSBALOO */	$"4241 4C53 410D 4241 4C54 490D 4241 4C55"            /* BALSABALTIBALU */	$"4E0D 4241 4C55 530D 4241 4D42 490D 4241"            /* NBALUSBAMBIBA */	$"4E41 4B0D 4241 4E43 4F0D 4241 4E43 530D"            /* NAKBANCOBANCS */	$"4241 4E44 410D 4241 4E44 480D 4241 4E44"            /* BANDABANDHBAND */	$"530D 4241 4E44 590D 4241 4E45 440D 4241"            /* SBANDYBANEDBA */	$"4E45 530D 4241 4E47 530D 4241 4E49 410D"            /* NESBANGSBANIA */	$"4241 4E4B 530D 4241 4E4E 530D 4241 4E54"            /* BANKSBANNSBANT */	$"530D 4241 4E54 550D 4241 4E54 590D 4241"            /* SBANTUBANTYBA */	$"4E59 410D 4241 5055 530D 4241 5242 450D"            /* NYABAPUSBARBE */	$"4241 5242 530D 4241 5242 590D 4241 5243"            /* BARBSBARBYBARC */	$"410D 4241 5244 450D 4241 5244 4F0D 4241"            /* ABARDEBARDOBA */	$"5244 530D 4241 5244 590D 4241 5245 440D"            /* RDSBARDYBARED */	$"4241 5245 520D 4241 5245 530D 4241 5246"            /* BARERBARESBARF */	$"490D 4241 5246 530D 4241 5249 430D 4241"            /* IBARFSBARICBA */	$"524B 530D 4241 524B 590D 4241 524D 530D"            /* RKSBARKYBARMS */	$"4241 524D 590D 4241 524E 530D 4241 524E"            /* BARMYBARNSBARN */	$"590D 4241 5250 530D 4241 5252 410D 4241"            /* YBARPSBARRABA */	$"5252 450D 4241 5252 4F0D 4241 5252 590D"            /* RREBARROBARRY */	$"4241 5259 450D 4241 5341 4E0D 4241 5345"            /* BARYEBASANBASE */	$"440D 4241 5345 4E0D 4241 5345 520D 4241"            /* DBASENBASERBA */	$"5345 530D 4241 5348 4F0D 4241 5349 4A0D"            /* SESBASHOBASIJ */	$"4241 534B 530D 4241 534F 4E0D 4241 5353"            /* BASKSBASONBASS */	$"450D 4241 5353 490D 4241 5353 4F0D 4241"            /* EBASSIBASSOBA */	$"5353 590D 4241 5354 410D 4241 5354 490D"            /* SSYBASTABASTI */	$"4241 5354 4F0D 4241 5354 530D 4241 5445"            /* BASTOBASTSBATE */	$"440D 4241 5445 530D 4241 5448 530D 4241"            /* DBATESBATHSBA */	$"5449 4B0D 4241 5454 410D 4241 5454 530D"            /* TIKBATTABATTS */	$"4241 5454 550D 4241 5544 530D 4241 554B"            /* BATTUBAUDSBAUK */	$"530D 4241 554C 4B0D 4241 5552 530D 4241"            /* SBAULKBAURSBA */	$"5649 4E0D 4241 5744 530D 4241 574B 530D"            /* VINBAWDSBAWKS */	$"4241 574C 530D 4241 574E 530D 4241 5752"            /* BAWLSBAWNSBAWR */	$"530D 4241 5754 590D 4241 5945 440D 4241"            /* SBAWTYBAYEDBA */	$"5945 520D 4241 5945 530D 4241 594C 450D"            /* YERBAYESBAYLE */	$"4241 5954 530D 4241 5A41 520D 4241 5A4F"            /* BAYTSBAZARBAZO */	$"4F0D 4245 4144 530D 4245 414B 530D 4245"            /* OBEADSBEAKSBE */	$"414B 590D 4245 414C 530D 4245 414D 530D"            /* AKYBEALSBEAMS */	$"4245 414D 590D 4245 414E 4F0D 4245 414E"            /* BEAMYBEANOBEAN */	$"530D 4245 414E 590D 4245 4152 450D 4245"            /* SBEANYBEAREBE */	$"4152 530D 4245 4154 480D 4245 4154 530D"            /* ARSBEATHBEATS */	$"4245 4154 590D 4245 4155 530D 4245 4155"            /* BEATYBEAUSBEAU */	$"540D 4245 4155 580D 4245 424F 500D 4245"            /* TBEAUXBEBOPBE */	$"4341 500D 4245 434B 450D 4245 434B 530D"            /* CAPBECKEBECKS */	$"4245 4441 440D 4245 4445 4C0D 4245 4445"            /* BEDADBEDELBEDE */	$"530D 4245 4445 570D 4245 4449 4D0D 4245"            /* SBEDEWBEDIMBE */	$"4459 450D 4245 4544 490D 4245 4546 530D"            /* DYEBEEDIBEEFS */	$"4245 4550 530D 4245 4552 530D 4245 4552"            /* BEEPSBEERSBEER */	$"590D 4245 4554 530D 4245 464F 470D 4245"            /* YBEETSBEFOGBE */	$"4741 440D 4245 4741 520D 4245 4745 4D0D"            /* GADBEGARBEGEM */	$"4245 474F 540D 4245 4755 4D0D 4245 4947"            /* BEGOTBEGUMBEIG */	$"450D 4245 4947 590D 4245 494E 530D 4245"            /* EBEIGYBEINSBE */	$"4B41 480D 4245 4C41 480D 4245 4C41 520D"            /* KAHBELAHBELAR */	$"4245 4C41 590D 4245 4C45 450D 4245 4C47"            /* BELAYBELEEBELG */	$"410D 4245 4C4C 530D 4245 4C4F 4E0D 4245"            /* ABELLSBELONBE */	$"4C54 530D 4245 4D41 440D 4245 4D41 530D"            /* LTSBEMADBEMAS */	$"4245 4D49 580D 4245 4D55 440D 4245 4E44"            /* BEMIXBEMUDBEND */	$"530D 4245 4E44 590D 4245 4E45 530D 4245"            /* SBENDYBENESBE */	$"4E45 540D 4245 4E47 410D 4245 4E49 530D"            /* NETBENGABENIS */	$"4245 4E4E 450D 4245 4E4E 490D 4245 4E4E"            /* BENNEBENNIBENN */	$"590D 4245 4E54 4F0D 4245 4E54 530D 4245"            /* YBENTOBENTSBE */	$"4E54 590D 4245 5041 540D 4245 5241 590D"            /* NTYBEPATBERAY */	$"4245 5245 530D 4245 5247 530D 4245 524B"            /* BERESBERGSBERK */	$"4F0D 4245 524B 530D 4245 524D 450D 4245"            /* OBERKSBERMEBE */	$"524D 530D 4245 524F 420D 4245 5259 4C0D"            /* RMSBEROBBERYL */	$"4245 5341 540D 4245 5341 570D 4245 5345"            /* BESATBESAWBESE */	$"450D 4245 5345 530D 4245 5349 540D 4245"            /* EBESESBESITBE */	$"534F 4D0D 4245 534F 540D 4245 5354 490D"            /* SOMBESOTBESTI */	$"4245 5354 530D 4245 5441 530D 4245 5445"            /* BESTSBETASBETE */	$"440D 4245 5445 530D 4245 5448 530D 4245"            /* DBETESBETHSBE */	$"5449 440D 4245 544F 4E0D 4245 5454 410D"            /* TIDBETONBETTA */	$"4245 5454 590D 4245 5645 520D 4245 564F"            /* BETTYBEVERBEVO */	$"520D 4245 5655 450D 4245 5656 590D 4245"            /* RBEVUEBEVVYBE */	$"5745 540D 4245 5749 470D 4245 5A45 530D"            /* WETBEWIGBEZES */	$"4245 5A49 4C0D 4245 5A5A 590D 4248 4149"            /* BEZILBEZZYBHAI */	$"530D 4248 414A 490D 4248 414E 470D 4248"            /* SBHAJIBHANGBH */	$"4154 530D 4248 454C 530D 4248 4F4F 540D"            /* ATSBHELSBHOOT */	$"4248 554E 410D 4248 5554 530D 4249 4143"            /* BHUNABHUTSBIAC */	$"480D 4249 414C 490D 4249 414C 590D 4249"            /* HBIALIBIALYBI */	$"4242 530D 4249 4245 530D 4249 4343 590D"            /* BBSBIBESBICCY */	$"4249 4345 530D 4249 4445 440D 4249 4445"            /* BICESBIDEDBIDE */	$"520D 4249 4445 530D 4249 4445 540D 4249"            /* RBIDESBIDETBI */	$"4449 530D 4249 444F 4E0D 4249 454C 440D"            /* DISBIDONBIELD */	$"4249 4552 530D 4249 4646 4F0D 4249 4646"            /* BIERSBIFFOBIFF */	$"530D 4249 4646 590D 4249 4649 440D 4249"            /* SBIFFYBIFIDBI */	$"4741 450D 4249 4747 530D 4249 4747 590D"            /* GAEBIGGSBIGGY */	$"4249 4748 410D 4249 4748 540D 4249 474C"            /* BIGHABIGHTBIGL */	$"590D 4249 474F 530D 4249 4A4F 550D 4249"            /* YBIGOSBIJOUBI */	$"4B45 440D 4249 4B45 520D 4249 4B45 530D"            /* KEDBIKERBIKES */	$"4249 4B49 450D 4249 4C42 4F0D 4249 4C42"            /* BIKIEBILBOBILB */	$"590D 4249 4C45 440D 4249 4C45 530D 4249"            /* YBILEDBILESBI */	$"4C47 590D 4249 4C4B 530D 4249 4C4C 530D"            /* LGYBILKSBILLS */	$"4249 4D41 480D 4249 4D41 530D 4249 4D42"            /* BIMAHBIMASBIMB */	$"4F0D 4249 4E41 4C0D 4249 4E44 490D 4249"            /* OBINALBINDIBI */	$"4E44 530D 4249 4E45 520D 4249 4E45 530D"            /* NDSBINERBINES */	$"4249 4E47 530D 4249 4E47 590D 4249 4E49"            /* BINGSBINGYBINI */	$"540D 4249 4E4B 530D 4249 4E54 530D 4249"            /* TBINKSBINTSBI */	$"4F47 530D 4249 4F4E 540D 4249 4F54 410D"            /* OGSBIONTBIOTA */	$"4249 5045 440D 4249 504F 440D 4249 5244"            /* BIPEDBIPODBIRD */	$"530D 4249 524B 530D 4249 524C 450D 4249"            /* SBIRKSBIRLEBI */	$"524C 530D 4249 524F 530D 4249 5252 530D"            /* RLSBIROSBIRRS */	$"4249 5253 450D 4249 5253 590D 4249 5345"            /* BIRSEBIRSYBISE */	$"530D 4249 534B 530D 4249 534F 4D0D 4249"            /* SBISKSBISOMBI */	$"5443 480D 4249 5445 520D 4249 5445 530D"            /* TCHBITERBITES */	$"4249 544F 530D 4249 544F 550D 4249 5453"            /* BITOSBITOUBITS */	$"590D 4249 5454 450D 4249 5454 530D 4249"            /* YBITTEBITTSBI */	$"5649 410D 4249 5656 590D 4249 5A45 530D"            /* VIABIVVYBIZES */	$"4249 5A5A 4F0D 4249 5A5A 590D 424C 4142"            /* BIZZOBIZZYBLAB */	$"530D 424C 4144 530D 424C 4144 590D 424C"            /* SBLADSBLADYBL */	$"4145 520D 424C 4145 530D 424C 4146 460D"            /* AERBLAESBLAFF */	$"424C 4147 530D 424C 4148 530D 424C 4149"            /* BLAGSBLAHSBLAI */	$"4E0D 424C 414D 530D 424C 4152 540D 424C"            /* NBLAMSBLARTBL */	$"4153 450D 424C 4153 480D 424C 4154 450D"            /* ASEBLASHBLATE */	$"424C 4154 530D 424C 4154 540D 424C 4155"            /* BLATSBLATTBLAU */	$"440D 424C 4157 4E0D 424C 4157 530D 424C"            /* DBLAWNBLAWSBL */	$"4159 530D 424C 4541 520D 424C 4542 530D"            /* AYSBLEARBLEBS */	$"424C 4543 480D 424C 4545 530D 424C 454E"            /* BLECHBLEESBLEN */	$"540D 424C 4552 540D 424C 4553 540D 424C"            /* TBLERTBLESTBL */	$"4554 530D 424C 4559 530D 424C 494D 590D"            /* ETSBLEYSBLIMY */	$"424C 494E 470D 424C 494E 490D 424C 494E"            /* BLINGBLINIBLIN */	$"530D 424C 494E 590D 424C 4950 530D 424C"            /* SBLINYBLIPSBL */	$"4953 540D 424C 4954 450D 424C 4954 530D"            /* ISTBLITEBLITS */	$"424C 4956 450D 424C 4F42 530D 424C 4F43"            /* BLIVEBLOBSBLOC */	$"530D 424C 4F47 530D 424C 4F4F 4B0D 424C"            /* SBLOGSBLOOKBL */	$"4F4F 500D 424C 4F52 450D 424C 4F54 530D"            /* OOPBLOREBLOTS */	$"424C 4F57 530D 424C 4F57 590D 424C 5542"            /* BLOWSBLOWYBLUB */	$"530D 424C 5544 450D 424C 5544 530D 424C"            /* SBLUDEBLUDSBL */	$"5544 590D 424C 5545 440D 424C 5545 530D"            /* UDYBLUEDBLUES */	$"424C 5545 540D 424C 5545 590D 424C 5549"            /* BLUETBLUEYBLUI */	$"440D 424C 554D 450D 424C 554E 4B0D 424C"            /* DBLUMEBLUNKBL */	$"5552 530D 424C 5950 450D 424F 4142 530D"            /* URSBLYPEBOABS */	$"424F 414B 530D 424F 4152 530D 424F 4152"            /* BOAKSBOARSBOAR */	$"540D 424F 4154 530D 424F 4241 430D 424F"            /* TBOATSBOBACBO */	$"4241 4B0D 424F 4241 530D 424F 424F 4C0D"            /* BAKBOBASBOBOL */	$"424F 424F 530D 424F 4343 410D 424F 4343"            /* BOBOSBOCCABOCC */	$"450D 424F 4343 490D 424F 4348 450D 424F"            /* EBOCCIBOCHEBO */	$"434B 530D 424F 4445 440D 424F 4445 530D"            /* CKSBODEDBODES */	$"424F 4447 450D 424F 4448 490D 424F 444C"            /* BODGEBODHIBODL */	$"450D 424F 4550 530D 424F 4554 530D 424F"            /* EBOEPSBOETSBO */	$"4555 460D 424F 4646 4F0D 424F 4646 530D"            /* EUFBOFFOBOFFS */	$"424F 4741 4E0D 424F 4745 590D 424F 4747"            /* BOGANBOGEYBOGG */	$"590D 424F 4749 450D 424F 474C 450D 424F"            /* YBOGIEBOGLEBO */	$"4755 450D 424F 4755 530D 424F 4845 410D"            /* GUEBOGUSBOHEA */	$"424F 484F 530D 424F 494C 530D 424F 494E"            /* BOHOSBOILSBOIN */	$"470D 424F 494E 4B0D 424F 4954 450D 424F"            /* GBOINKBOITEBO */	$"4B45 440D 424F 4B45 480D 424F 4B45 530D"            /* KEDBOKEHBOKES */	$"424F 4B4F 530D 424F 4C41 520D 424F 4C41"            /* BOKOSBOLARBOLA */	$"530D 424F 4C44 530D 424F 4C45 530D 424F"            /* SBOLDSBOLESBO */	$"4C49 580D 424F 4C4C 530D 424F 4C4F 530D"            /* LIXBOLLSBOLOS */	$"424F 4C54 530D 424F 4C55 530D 424F 4D41"            /* BOLTSBOLUSBOMA */	$"530D 424F 4D42 450D 424F 4D42 4F0D 424F"            /* SBOMBEBOMBOBO */	$"4D42 530D 424F 4E43 450D 424F 4E44 530D"            /* MBSBONCEBONDS */	$"424F 4E45 440D 424F 4E45 520D 424F 4E45"            /* BONEDBONERBONE */	$"530D 424F 4E47 530D 424F 4E49 450D 424F"            /* SBONGSBONIEBO */	$"4E4B 530D 424F 4E4E 450D 424F 4E4E 590D"            /* NKSBONNEBONNY */	$"424F 4E5A 410D 424F 4E5A 450D 424F 4F41"            /* BONZABONZEBOOA */	$"490D 424F 4F41 590D 424F 4F42 530D 424F"            /* IBOOAYBOOBSBO */	$"4F44 590D 424F 4F45 440D 424F 4F46 590D"            /* ODYBOOEDBOOFY */	$"424F 4F47 590D 424F 4F48 530D 424F 4F4B"            /* BOOGYBOOHSBOOK */	$"530D 424F 4F4B 590D 424F 4F4C 530D 424F"            /* SBOOKYBOOLSBO */	$"4F4D 530D 424F 4F4D 590D 424F 4F4E 470D"            /* OMSBOOMYBOONG */	$"424F 4F4E 530D 424F 4F52 440D 424F 4F52"            /* BOONSBOORDBOOR */	$"530D 424F 4F53 450D 424F 4F54 530D 424F"            /* SBOOSEBOOTSBO */	$"5050 590D 424F 5241 4B0D 424F 5241 4C0D"            /* PPYBORAKBORAL */	$"424F 5241 530D 424F 5244 450D 424F 5244"            /* BORASBORDEBORD */	$"530D 424F 5245 440D 424F 5245 450D 424F"            /* SBOREDBOREEBO */	$"5245 4C0D 424F 5245 520D 424F 5245 530D"            /* RELBORERBORES */	$"424F 5247 4F0D 424F 5249 430D 424F 524B"            /* BORGOBORICBORK */	$"530D 424F 524D 530D 424F 524E 410D 424F"            /* SBORMSBORNABO */	$"524F 4E0D 424F 5254 530D 424F 5254 590D"            /* RONBORTSBORTY */	$"424F 5254 5A0D 424F 5349 450D 424F 534B"            /* BORTZBOSIEBOSK */	$"530D 424F 534B 590D 424F 534F 4E0D 424F"            /* SBOSKYBOSONBO */	$"5355 4E0D 424F 5441 530D 424F 5445 4C0D"            /* SUNBOTASBOTEL */	$"424F 5445 530D 424F 5448 590D 424F 5454"            /* BOTESBOTHYBOTT */	$"450D 424F 5454 530D 424F 5454 590D 424F"            /* EBOTTSBOTTYBO */	$"5547 450D 424F 554B 530D 424F 554C 540D"            /* UGEBOUKSBOULT */	$"424F 554E 530D 424F 5552 440D 424F 5552"            /* BOUNSBOURDBOUR */	$"470D 424F 5552 4E0D 424F 5553 450D 424F"            /* GBOURNBOUSEBO */	$"5553 590D 424F 5554 530D 424F 5649 440D"            /* USYBOUTSBOVID */	$"424F 5741 540D 424F 5745 440D 424F 5745"            /* BOWATBOWEDBOWE */	$"520D 424F 5745 530D 424F 5745 540D 424F"            /* RBOWESBOWETBO */	$"5749 450D 424F 574C 530D 424F 574E 450D"            /* WIEBOWLSBOWNE */	$"424F 5752 530D 424F 5753 450D 424F 5845"            /* BOWRSBOWSEBOXE */	$"440D 424F 5845 4E0D 424F 5845 530D 424F"            /* DBOXENBOXESBO */	$"584C 410D 424F 5854 590D 424F 5941 520D"            /* XLABOXTYBOYAR */	$"424F 5941 550D 424F 5945 440D 424F 5946"            /* BOYAUBOYEDBOYF */	$"530D 424F 5947 530D 424F 594C 410D 424F"            /* SBOYGSBOYLABO */	$"594F 530D 424F 5953 590D 424F 5A4F 530D"            /* YOSBOYSYBOZOS */	$"4252 4141 490D 4252 4143 480D 4252 4143"            /* BRAAIBRACHBRAC */	$"4B0D 4252 4143 540D 4252 4144 530D 4252"            /* KBRACTBRADSBR */	$"4145 530D 4252 4147 530D 4252 4149 4C0D"            /* AESBRAGSBRAIL */	$"4252 414B 530D 4252 414B 590D 4252 414D"            /* BRAKSBRAKYBRAM */	$"450D 4252 414E 450D 4252 414E 4B0D 4252"            /* EBRANEBRANKBR */	$"414E 530D 4252 414E 540D 4252 4153 540D"            /* ANSBRANTBRAST */	$"4252 4154 530D 4252 4156 410D 4252 4156"            /* BRATSBRAVABRAV */	$"490D 4252 4157 530D 4252 4158 590D 4252"            /* IBRAWSBRAXYBR */	$"4159 530D 4252 415A 410D 4252 415A 450D"            /* AYSBRAZABRAZE */	$"4252 4541 4D0D 4252 4544 450D 4252 4544"            /* BREAMBREDEBRED */	$"530D 4252 4545 4D0D 4252 4545 520D 4252"            /* SBREEMBREERBR */	$"4545 530D 4252 4549 440D 4252 4549 530D"            /* EESBREIDBREIS */	$"4252 454D 450D 4252 454E 530D 4252 454E"            /* BREMEBRENSBREN */	$"540D 4252 4552 450D 4252 4552 530D 4252"            /* TBREREBRERSBR */	$"4556 450D 4252 4557 530D 4252 4559 530D"            /* EVEBREWSBREYS */	$"4252 4945 520D 4252 4945 530D 4252 4947"            /* BRIERBRIESBRIG */	$"530D 4252 494B 490D 4252 494B 530D 4252"            /* SBRIKIBRIKSBR */	$"494C 4C0D 4252 494D 530D 4252 494E 530D"            /* ILLBRIMSBRINS */	$"4252 494F 530D 4252 4953 450D 4252 4953"            /* BRIOSBRISEBRIS */	$"530D 4252 4954 480D 4252 4954 530D 4252"            /* SBRITHBRITSBR */	$"4954 540D 4252 495A 450D 4252 4F43 480D"            /* ITTBRIZEBROCH */	$"4252 4F43 4B0D 4252 4F44 530D 4252 4F47"            /* BROCKBRODSBROG */	$"480D 4252 4F47 530D 4252 4F4D 450D 4252"            /* HBROGSBROMEBR */	$"4F4D 4F0D 4252 4F4E 430D 4252 4F4E 440D"            /* OMOBRONCBROND */	$"4252 4F4F 4C0D 4252 4F4F 530D 4252 4F53"            /* BROOLBROOSBROS */	$"450D 4252 4F53 590D 4252 4F57 530D 4252"            /* EBROSYBROWSBR */	$"5547 480D 4252 5549 4E0D 4252 5549 540D"            /* UGHBRUINBRUIT */	$"4252 554C 450D 4252 554D 450D 4252 554E"            /* BRULEBRUMEBRUN */	$"470D 4252 5553 4B0D 4252 5553 540D 4252"            /* GBRUSKBRUSTBR */	$"5554 530D 4255 4154 530D 4255 415A 450D"            /* UTSBUATSBUAZE */	$"4255 4241 4C0D 4255 4241 530D 4255 4242"            /* BUBALBUBASBUBB */	$"410D 4255 4242 450D 4255 4242 590D 4255"            /* ABUBBEBUBBYBU */	$"4255 530D 4255 4348 550D 4255 434B 4F0D"            /* BUSBUCHUBUCKO */	$"4255 434B 530D 4255 434B 550D 4255 4441"            /* BUCKSBUCKUBUDA */	$"530D 4255 4449 530D 4255 444F 530D 4255"            /* SBUDISBUDOSBU */	$"4646 410D 4255 4646 450D 4255 4646 490D"            /* FFABUFFEBUFFI */	$"4255 4646 4F0D 4255 4646 530D 4255 4646"            /* BUFFOBUFFSBUFF */	$"590D 4255 464F 530D 4255 4654 590D 4255"            /* YBUFOSBUFTYBU */	$"484C 530D 4255 4852 530D 4255 494B 530D"            /* HLSBUHRSBUIKS */	$"4255 4953 540D 4255 4B45 530D 4255 4C42"            /* BUISTBUKESBULB */	$"530D 4255 4C47 590D 4255 4C4B 530D 4255"            /* SBULGYBULKSBU */	$"4C4C 410D 4255 4C4C 530D 4255 4C53 450D"            /* LLABULLSBULSE */	$"4255 4D42 4F0D 4255 4D46 530D 4255 4D50"            /* BUMBOBUMFSBUMP */	$"480D 4255 4D50 530D 4255 4D50 590D 4255"            /* HBUMPSBUMPYBU */	$"4E41 530D 4255 4E43 450D 4255 4E43 4F0D"            /* NASBUNCEBUNCO */	$"4255 4E44 450D 4255 4E44 480D 4255 4E44"            /* BUNDEBUNDHBUND */	$"530D 4255 4E44 540D 4255 4E44 550D 4255"            /* SBUNDTBUNDUBU */	$"4E44 590D 4255 4E47 530D 4255 4E47 590D"            /* NDYBUNGSBUNGY */	$"4255 4E49 410D 4255 4E4A 450D 4255 4E4A"            /* BUNIABUNJEBUNJ */	$"590D 4255 4E4B 4F0D 4255 4E4B 530D 4255"            /* YBUNKOBUNKSBU */	$"4E4E 530D 4255 4E54 530D 4255 4E54 590D"            /* NNSBUNTSBUNTY */	$"4255 4E59 410D 4255 4F59 530D 4255 5050"            /* BUNYABUOYSBUPP */	$"590D 4255 5241 4E0D 4255 5241 530D 4255"            /* YBURANBURASBU */	$"5242 530D 4255 5244 530D 4255 5245 540D"            /* RBSBURDSBURET */	$"4255 5246 490D 4255 5247 480D 4255 5247"            /* BURFIBURGHBURG */	$"530D 4255 5249 4E0D 4255 524B 410D 4255"            /* SBURINBURKABU */	$"524B 450D 4255 524B 530D 4255 524C 530D"            /* RKEBURKSBURLS */	$"4255 524E 530D 4255 524F 4F0D 4255 5250"            /* BURNSBUROOBURP */	$"530D 4255 5251 410D 4255 5252 4F0D 4255"            /* SBURQABURROBU */	$"5252 530D 4255 5252 590D 4255 5253 410D"            /* RRSBURRYBURSA */	$"4255 5253 450D 4255 5342 590D 4255 5345"            /* BURSEBUSBYBUSE */	$"530D 4255 534B 530D 4255 534B 590D 4255"            /* SBUSKSBUSKYBU */	$"5353 550D 4255 5354 490D 4255 5354 530D"            /* SSUBUSTIBUSTS */	$"4255 5354 590D 4255 5445 4F0D 4255 5445"            /* BUSTYBUTEOBUTE */	$"530D 4255 544C 450D 4255 544F 480D 4255"            /* SBUTLEBUTOHBU */	$"5454 530D 4255 5454 590D 4255 5455 540D"            /* TTSBUTTYBUTUT */	$"4255 5459 4C0D 4255 5A5A 590D 4257 414E"            /* BUTYLBUZZYBWAN */	$"410D 4257 415A 490D 4259 4445 440D 4259"            /* ABWAZIBYDEDBY */	$"4445 530D 4259 4B45 440D 4259 4B45 530D"            /* DESBYKEDBYKES */	$"4259 5245 530D 4259 524C 530D 4259 5353"            /* BYRESBYRLSBYSS */	$"490D 4259 5445 530D 4259 5741 590D 4341"            /* IBYTESBYWAYCA */	$"4145 440D 4341 4241 530D 4341 4245 520D"            /* AEDCABASCABER */	$"4341 424F 420D 4341 424F 430D 4341 4252"            /* CABOBCABOCCABR */	$"450D 4341 4341 530D 4341 434B 530D 4341"            /* ECACASCACKSCA */	$"434B 590D 4341 4445 450D 4341 4445 530D"            /* CKYCADEECADES */	$"4341 4447 450D 4341 4447 590D 4341 4449"            /* CADGECADGYCADI */	$"450D 4341 4449 530D 4341 4452 450D 4341"            /* ECADISCADRECA */	$"4543 410D 4341 4553 450D 4341 4645 530D"            /* ECACAESECAFES */	$"4341 4646 530D 4341 4745 440D 4341 4745"            /* CAFFSCAGEDCAGE */	$"520D 4341 4745 530D 4341 474F 540D 4341"            /* RCAGESCAGOTCA */	$"484F 570D 4341 4944 530D 4341 494E 530D"            /* HOWCAIDSCAINS */	$"4341 4952 440D 4341 4A4F 4E0D 4341 4A55"            /* CAIRDCAJONCAJU */	$"4E0D 4341 4B45 440D 4341 4B45 530D 4341"            /* NCAKEDCAKESCA */	$"4B45 590D 4341 4C46 530D 4341 4C49 440D"            /* KEYCALFSCALID */	$"4341 4C49 460D 4341 4C49 580D 4341 4C4B"            /* CALIFCALIXCALK */	$"530D 4341 4C4C 410D 4341 4C4C 530D 4341"            /* SCALLACALLSCA */	$"4C4D 530D 4341 4C4D 590D 4341 4C4F 530D"            /* LMSCALMYCALOS */	$"4341 4C50 410D 4341 4C50 530D 4341 4C56"            /* CALPACALPSCALV */	$"450D 4341 4C59 580D 4341 4D41 4E0D 4341"            /* ECALYXCAMANCA */	$"4D41 530D 4341 4D45 530D 4341 4D49 530D"            /* MASCAMESCAMIS */	$"4341 4D4F 530D 4341 4D50 490D 4341 4D50"            /* CAMOSCAMPICAMP */	$"4F0D 4341 4D50 530D 4341 4D50 590D 4341"            /* OCAMPSCAMPYCA */	$"4D55 530D 4341 4E45 440D 4341 4E45 480D"            /* MUSCANEDCANEH */	$"4341 4E45 520D 4341 4E45 530D 4341 4E47"            /* CANERCANESCANG */	$"530D 4341 4E49 440D 4341 4E4E 410D 4341"            /* SCANIDCANNACA */	$"4E4E 530D 4341 4E53 4F0D 4341 4E53 540D"            /* NNSCANSOCANST */	$"4341 4E54 4F0D 4341 4E54 530D 4341 4E54"            /* CANTOCANTSCANT */	$"590D 4341 5041 530D 4341 5045 440D 4341"            /* YCAPASCAPEDCA */	$"5045 530D 4341 5045 580D 4341 5048 530D"            /* PESCAPEXCAPHS */	$"4341 5049 5A0D 4341 504C 450D 4341 504F"            /* CAPIZCAPLECAPO */	$"4E0D 4341 504F 530D 4341 504F 540D 4341"            /* NCAPOSCAPOTCA */	$"5052 490D 4341 5055 4C0D 4341 5241 500D"            /* PRICAPULCARAP */	$"4341 5242 4F0D 4341 5242 530D 4341 5242"            /* CARBOCARBSCARB */	$"590D 4341 5244 490D 4341 5244 530D 4341"            /* YCARDICARDSCA */	$"5244 590D 4341 5245 440D 4341 5245 520D"            /* RDYCAREDCARER */	$"4341 5245 530D 4341 5245 540D 4341 5245"            /* CARESCARETCARE */	$"580D 4341 524B 530D 4341 524C 450D 4341"            /* XCARKSCARLECA */	$"524C 530D 4341 524E 530D 4341 524E 590D"            /* RLSCARNSCARNY */	$"4341 524F 420D 4341 524F 4D0D 4341 524F"            /* CAROBCAROMCARO */	$"4E0D 4341 5250 490D 4341 5250 530D 4341"            /* NCARPICARPSCA */	$"5252 530D 4341 5253 450D 4341 5254 410D"            /* RRSCARSECARTA */	$"4341 5254 450D 4341 5254 530D 4341 5256"            /* CARTECARTSCARV */	$"590D 4341 5341 530D 4341 5343 4F0D 4341"            /* YCASASCASCOCA */	$"5345 440D 4341 5345 530D 4341 534B 530D"            /* SEDCASESCASKS */	$"4341 534B 590D 4341 5354 530D 4341 5355"            /* CASKYCASTSCASU */	$"530D 4341 5445 530D 4341 5544 410D 4341"            /* SCATESCAUDACA */	$"554B 530D 4341 554C 440D 4341 554C 530D"            /* UKSCAULDCAULS */	$"4341 554D 530D 4341 5550 530D 4341 5552"            /* CAUMSCAUPSCAUR */	$"490D 4341 5553 410D 4341 5641 530D 4341"            /* ICAUSACAVASCA */	$"5645 440D 4341 5645 4C0D 4341 5645 520D"            /* VEDCAVELCAVER */	$"4341 5645 530D 4341 5649 450D 4341 5745"            /* CAVESCAVIECAWE */	$"440D 4341 574B 530D 4341 584F 4E0D 4345"            /* DCAWKSCAXONCE */	$"415A 450D 4345 4249 440D 4345 4341 4C0D"            /* AZECEBIDCECAL */	$"4345 4355 4D0D 4345 4445 440D 4345 4445"            /* CECUMCEDEDCEDE */	$"520D 4345 4445 530D 4345 4449 530D 4345"            /* RCEDESCEDISCE */	$"4942 410D 4345 494C 490D 4345 494C 530D"            /* IBACEILICEILS */	$"4345 4C45 420D 4345 4C4C 410D 4345 4C4C"            /* CELEBCELLACELL */	$"490D 4345 4C4C 530D 4345 4C4F 4D0D 4345"            /* ICELLSCELOMCE */	$"4C54 530D 4345 4E53 450D 4345 4E54 4F0D"            /* LTSCENSECENTO */	$"4345 4E54 530D 4345 4E54 550D 4345 4F52"            /* CENTSCENTUCEOR */	$"4C0D 4345 5045 530D 4345 5243 490D 4345"            /* LCEPESCERCICE */	$"5245 440D 4345 5245 530D 4345 5247 450D"            /* REDCERESCERGE */	$"4345 5249 410D 4345 5249 430D 4345 524E"            /* CERIACERICCERN */	$"450D 4345 524F 430D 4345 524F 530D 4345"            /* ECEROCCEROSCE */	$"5254 530D 4345 5254 590D 4345 5353 450D"            /* RTSCERTYCESSE */	$"4345 5354 410D 4345 5354 490D 4345 5445"            /* CESTACESTICETE */	$"530D 4345 5459 4C0D 4345 5A56 450D 4348"            /* SCETYLCEZVECH */	$"4143 450D 4348 4143 4B0D 4348 4143 4F0D"            /* ACECHACKCHACO */	$"4348 4144 4F0D 4348 4144 530D 4348 4146"            /* CHADOCHADSCHAF */	$"540D 4348 4149 530D 4348 414C 530D 4348"            /* TCHAISCHALSCH */	$"414D 530D 4348 414E 410D 4348 414E 470D"            /* AMSCHANACHANG */	$"4348 414E 4B0D 4348 4150 450D 4348 4150"            /* CHANKCHAPECHAP */	$"530D 4348 4150 540D 4348 4152 410D 4348"            /* SCHAPTCHARACH */	$"4152 450D 4348 4152 4B0D 4348 4152 520D"            /* ARECHARKCHARR */	$"4348 4152 530D 4348 4152 590D 4348 4154"            /* CHARSCHARYCHAT */	$"530D 4348 4156 450D 4348 4156 530D 4348"            /* SCHAVECHAVSCH */	$"4157 4B0D 4348 4157 530D 4348 4159 410D"            /* AWKCHAWSCHAYA */	$"4348 4159 530D 4348 4545 500D 4348 4546"            /* CHAYSCHEEPCHEF */	$"530D 4348 454B 410D 4348 454C 410D 4348"            /* SCHEKACHELACH */	$"454C 500D 4348 454D 4F0D 4348 454D 530D"            /* ELPCHEMOCHEMS */	$"4348 4552 450D 4348 4552 540D 4348 4554"            /* CHERECHERTCHET */	$"480D 4348 4556 590D 4348 4557 530D 4348"            /* HCHEVYCHEWSCH */	$"4557 590D 4348 4941 4F0D 4348 4941 530D"            /* EWYCHIAOCHIAS */	$"4348 4942 530D 4348 4943 410D 4348 4943"            /* CHIBSCHICACHIC */	$"480D 4348 4943 4F0D 4348 4943 530D 4348"            /* HCHICOCHICSCH */	$"4945 4C0D 4348 494B 530D 4348 494C 450D"            /* IELCHIKSCHILE */	$"4348 494D 420D 4348 494D 4F0D 4348 494D"            /* CHIMBCHIMOCHIM */	$"500D 4348 494E 450D 4348 494E 470D 4348"            /* PCHINECHINGCH */	$"494E 4B0D 4348 494E 4F0D 4348 494E 530D"            /* INKCHINOCHINS */	$"4348 4950 530D 4348 4952 4B0D 4348 4952"            /* CHIPSCHIRKCHIR */	$"4C0D 4348 4952 4D0D 4348 4952 4F0D 4348"            /* LCHIRMCHIROCH */	$"4952 520D 4348 4952 540D 4348 4952 550D"            /* IRRCHIRTCHIRU */	$"4348 4954 530D 4348 4956 450D 4348 4956"            /* CHITSCHIVECHIV */	$"530D 4348 4956 590D 4348 495A 5A0D 4348"            /* SCHIVYCHIZZCH */	$"4F43 4F0D 4348 4F43 530D 4348 4F44 450D"            /* OCOCHOCSCHODE */	$"4348 4F47 530D 4348 4F49 4C0D 4348 4F4B"            /* CHOGSCHOILCHOK */	$"4F0D 4348 4F4B 590D 4348 4F4C 410D 4348"            /* OCHOKYCHOLACH */	$"4F4C 490D 4348 4F4C 4F0D 4348 4F4D 500D"            /* OLICHOLOCHOMP */	$"4348 4F4E 530D 4348 4F4F 460D 4348 4F4F"            /* CHONSCHOOFCHOO */	$"4B0D 4348 4F4F 4D0D 4348 4F4F 4E0D 4348"            /* KCHOOMCHOONCH */	$"4F50 530D 4348 4F54 410D 4348 4F54 540D"            /* OPSCHOTACHOTT */	$"4348 4F55 540D 4348 4F55 580D 4348 4F57"            /* CHOUTCHOUXCHOW */	$"4B0D 4348 4F57 530D 4348 5542 530D 4348"            /* KCHOWSCHUBSCH */	$"5546 410D 4348 5546 460D 4348 5547 530D"            /* UFACHUFFCHUGS */	$"4348 554D 530D 4348 5552 4C0D 4348 5552"            /* CHUMSCHURLCHUR */	$"520D 4348 5553 450D 4348 5554 530D 4348"            /* RCHUSECHUTSCH */	$"594C 450D 4348 594D 450D 4348 594E 440D"            /* YLECHYMECHYND */	$"4349 424F 4C0D 4349 4445 440D 4349 4445"            /* CIBOLCIDEDCIDE */	$"530D 4349 454C 530D 4349 4747 590D 4349"            /* SCIELSCIGGYCI */	$"4C49 410D 4349 4C4C 530D 4349 4D41 520D"            /* LIACILLSCIMAR */	$"4349 4D45 580D 4349 4E43 540D 4349 4E45"            /* CIMEXCINCTCINE */	$"530D 4349 4E51 530D 4349 4F4E 530D 4349"            /* SCINQSCIONSCI */	$"5050 490D 4349 5243 530D 4349 5245 530D"            /* PPICIRCSCIRES */	$"4349 524C 530D 4349 5252 490D 4349 5343"            /* CIRLSCIRRICISC */	$"4F0D 4349 5353 590D 4349 5354 530D 4349"            /* OCISSYCISTSCI */	$"5441 4C0D 4349 5445 440D 4349 5445 520D"            /* TALCITEDCITER */	$"4349 5445 530D 4349 5645 530D 4349 5645"            /* CITESCIVESCIVE */	$"540D 4349 5649 450D 4349 5656 590D 434C"            /* TCIVIECIVVYCL */	$"4143 480D 434C 4144 450D 434C 4144 530D"            /* ACHCLADECLADS */	$"434C 4145 530D 434C 4147 530D 434C 414D"            /* CLAESCLAGSCLAM */	$"450D 434C 414D 530D 434C 414E 530D 434C"            /* ECLAMSCLANSCL */	$"4150 530D 434C 4150 540D 434C 4152 4F0D"            /* APSCLAPTCLARO */	$"434C 4152 540D 434C 4152 590D 434C 4153"            /* CLARTCLARYCLAS */	$"540D 434C 4154 530D 434C 4155 540D 434C"            /* TCLATSCLAUTCL */	$"4156 450D 434C 4156 490D 434C 4157 530D"            /* AVECLAVICLAWS */	$"434C 4159 530D 434C 4543 4B0D 434C 4545"            /* CLAYSCLECKCLEE */	$"4B0D 434C 4545 500D 434C 4546 530D 434C"            /* KCLEEPCLEFSCL */	$"4547 530D 434C 4549 4B0D 434C 454D 530D"            /* EGSCLEIKCLEMS */	$"434C 4550 450D 434C 4550 540D 434C 4556"            /* CLEPECLEPTCLEV */	$"450D 434C 4557 530D 434C 4945 440D 434C"            /* ECLEWSCLIEDCL */	$"4945 530D 434C 4946 540D 434C 494D 450D"            /* IESCLIFTCLIME */	$"434C 494E 450D 434C 494E 540D 434C 4950"            /* CLINECLINTCLIP */	$"450D 434C 4950 530D 434C 4950 540D 434C"            /* ECLIPSCLIPTCL */	$"4954 530D 434C 4F41 4D0D 434C 4F44 530D"            /* ITSCLOAMCLODS */	$"434C 4F46 460D 434C 4F47 530D 434C 4F4B"            /* CLOFFCLOGSCLOK */	$"450D 434C 4F4D 420D 434C 4F4D 500D 434C"            /* ECLOMBCLOMPCL */	$"4F4E 4B0D 434C 4F4E 530D 434C 4F4F 500D"            /* ONKCLONSCLOOP */	$"434C 4F4F 540D 434C 4F50 530D 434C 4F54"            /* CLOOTCLOPSCLOT */	$"450D 434C 4F54 530D 434C 4F55 520D 434C"            /* ECLOTSCLOURCL */	$"4F55 530D 434C 4F57 530D 434C 4F59 450D"            /* OUSCLOWSCLOYE */	$"434C 4F59 530D 434C 4F5A 450D 434C 5542"            /* CLOYSCLOZECLUB */	$"530D 434C 5545 530D 434C 5545 590D 434C"            /* SCLUESCLUEYCL */	$"554E 4B0D 434C 5950 450D 434E 4944 410D"            /* UNKCLYPECNIDA */	$"434F 4143 540D 434F 4144 590D 434F 414C"            /* COACTCOADYCOAL */	$"410D 434F 414C 530D 434F 414C 590D 434F"            /* ACOALSCOALYCO */	$"4150 540D 434F 4152 420D 434F 4154 450D"            /* APTCOARBCOATE */	$"434F 4154 490D 434F 4154 530D 434F 4242"            /* COATICOATSCOBB */	$"530D 434F 4242 590D 434F 4249 410D 434F"            /* SCOBBYCOBIACO */	$"424C 450D 434F 425A 410D 434F 4341 530D"            /* BLECOBZACOCAS */	$"434F 4343 490D 434F 4343 4F0D 434F 434B"            /* COCCICOCCOCOCK */	$"530D 434F 434B 590D 434F 434F 530D 434F"            /* SCOCKYCOCOSCO */	$"4441 530D 434F 4445 430D 434F 4445 440D"            /* DASCODECCODED */	$"434F 4445 4E0D 434F 4445 520D 434F 4445"            /* CODENCODERCODE */	$"530D 434F 4445 580D 434F 444F 4E0D 434F"            /* SCODEXCODONCO */	$"4544 530D 434F 4646 530D 434F 4749 450D"            /* EDSCOFFSCOGIE */	$"434F 474F 4E0D 434F 4755 450D 434F 4841"            /* COGONCOGUECOHA */	$"420D 434F 4845 4E0D 434F 484F 450D 434F"            /* BCOHENCOHOECO */	$"484F 470D 434F 484F 530D 434F 4946 530D"            /* HOGCOHOSCOIFS */	$"434F 4947 4E0D 434F 494C 530D 434F 494E"            /* COIGNCOILSCOIN */	$"530D 434F 4952 530D 434F 4954 530D 434F"            /* SCOIRSCOITSCO */	$"4B45 440D 434F 4B45 530D 434F 4C41 530D"            /* KEDCOKESCOLAS */	$"434F 4C42 590D 434F 4C44 530D 434F 4C45"            /* COLBYCOLDSCOLE */	$"440D 434F 4C45 530D 434F 4C45 590D 434F"            /* DCOLESCOLEYCO */	$"4C49 430D 434F 4C49 4E0D 434F 4C4C 530D"            /* LICCOLINCOLLS */	$"434F 4C4C 590D 434F 4C4F 470D 434F 4C54"            /* COLLYCOLOGCOLT */	$"530D 434F 4C5A 410D 434F 4D41 450D 434F"            /* SCOLZACOMAECO */	$"4D41 4C0D 434F 4D41 530D 434F 4D42 450D"            /* MALCOMASCOMBE */	$"434F 4D42 490D 434F 4D42 4F0D 434F 4D42"            /* COMBICOMBOCOMB */	$"530D 434F 4D42 590D 434F 4D45 520D 434F"            /* SCOMBYCOMERCO */	$"4D45 530D 434F 4D49 580D 434F 4D4D 4F0D"            /* MESCOMIXCOMMO */	$"434F 4D4D 530D 434F 4D4D 590D 434F 4D50"            /* COMMSCOMMYCOMP */	$"4F0D 434F 4D50 530D 434F 4D50 540D 434F"            /* OCOMPSCOMPTCO */	$"4D54 450D 434F 4D55 530D 434F 4E45 440D"            /* MTECOMUSCONED */	$"434F 4E45 530D 434F 4E45 590D 434F 4E46"            /* CONESCONEYCONF */	$"530D 434F 4E47 410D 434F 4E47 450D 434F"            /* SCONGACONGECO */	$"4E47 4F0D 434F 4E49 410D 434F 4E49 4E0D"            /* NGOCONIACONIN */	$"434F 4E4B 530D 434F 4E4B 590D 434F 4E4E"            /* CONKSCONKYCONN */	$"450D 434F 4E4E 530D 434F 4E54 450D 434F"            /* ECONNSCONTECO */	$"4E54 4F0D 434F 4E55 530D 434F 4E56 4F0D"            /* NTOCONUSCONVO */	$"434F 4F43 480D 434F 4F45 440D 434F 4F45"            /* COOCHCOOEDCOOE */	$"450D 434F 4F45 520D 434F 4F45 590D 434F"            /* ECOOERCOOEYCO */	$"4F46 530D 434F 4F4B 530D 434F 4F4B 590D"            /* OFSCOOKSCOOKY */	$"434F 4F4C 530D 434F 4F4C 590D 434F 4F4D"            /* COOLSCOOLYCOOM */	$"420D 434F 4F4D 530D 434F 4F4D 590D 434F"            /* BCOOMSCOOMYCO */	$"4F4E 530D 434F 4F50 530D 434F 4F50 540D"            /* ONSCOOPSCOOPT */	$"434F 4F53 540D 434F 4F54 530D 434F 4F5A"            /* COOSTCOOTSCOOZ */	$"450D 434F 5041 4C0D 434F 5041 590D 434F"            /* ECOPALCOPAYCO */	$"5045 440D 434F 5045 4E0D 434F 5045 520D"            /* PEDCOPENCOPER */	$"434F 5045 530D 434F 5050 590D 434F 5052"            /* COPESCOPPYCOPR */	$"410D 434F 5053 590D 434F 5155 490D 434F"            /* ACOPSYCOQUICO */	$"5241 4D0D 434F 5242 450D 434F 5242 590D"            /* RAMCORBECORBY */	$"434F 5244 530D 434F 5245 440D 434F 5245"            /* CORDSCOREDCORE */	$"530D 434F 5245 590D 434F 5247 490D 434F"            /* SCOREYCORGICO */	$"5249 410D 434F 524B 530D 434F 524B 590D"            /* RIACORKSCORKY */	$"434F 524D 530D 434F 524E 490D 434F 524E"            /* CORMSCORNICORN */	$"4F0D 434F 524E 530D 434F 524E 550D 434F"            /* OCORNSCORNUCO */	$"5250 530D 434F 5253 450D 434F 5253 4F0D"            /* RPSCORSECORSO */	$"434F 5345 430D 434F 5345 440D 434F 5345"            /* COSECCOSEDCOSE */	$"530D 434F 5345 540D 434F 5345 590D 434F"            /* SCOSETCOSEYCO */	$"5349 450D 434F 5354 410D 434F 5354 450D"            /* SIECOSTACOSTE */	$"434F 5354 530D 434F 5441 4E0D 434F 5445"            /* COSTSCOTANCOTE */	$"440D 434F 5445 530D 434F 5448 530D 434F"            /* DCOTESCOTHSCO */	$"5454 410D 434F 5454 530D 434F 5544 450D"            /* TTACOTTSCOUDE */	$"434F 5550 530D 434F 5552 420D 434F 5552"            /* COUPSCOURBCOUR */	$"440D 434F 5552 450D 434F 5552 530D 434F"            /* DCOURECOURSCO */	$"5554 410D 434F 5554 480D 434F 5645 440D"            /* UTACOUTHCOVED */	$"434F 5645 530D 434F 5649 4E0D 434F 5741"            /* COVESCOVINCOWA */	$"4C0D 434F 5741 4E0D 434F 5745 440D 434F"            /* LCOWANCOWEDCO */	$"574B 530D 434F 574C 530D 434F 5750 530D"            /* WKSCOWLSCOWPS */	$"434F 5752 590D 434F 5841 450D 434F 5841"            /* COWRYCOXAECOXA */	$"4C0D 434F 5845 440D 434F 5845 530D 434F"            /* LCOXEDCOXESCO */	$"5849 420D 434F 5941 550D 434F 5945 440D"            /* XIBCOYAUCOYED */	$"434F 5945 520D 434F 5950 550D 434F 5A45"            /* COYERCOYPUCOZE */	$"440D 434F 5A45 4E0D 434F 5A45 530D 434F"            /* DCOZENCOZESCO */	$"5A45 590D 434F 5A49 450D 4352 4141 4C0D"            /* ZEYCOZIECRAAL */	$"4352 4142 530D 4352 4147 530D 4352 4149"            /* CRABSCRAGSCRAI */	$"430D 4352 4149 470D 4352 414B 450D 4352"            /* CCRAIGCRAKECR */	$"414D 450D 4352 414D 530D 4352 414E 530D"            /* AMECRAMSCRANS */	$"4352 4150 450D 4352 4150 530D 4352 4150"            /* CRAPECRAPSCRAP */	$"590D 4352 4152 450D 4352 4157 530D 4352"            /* YCRARECRAWSCR */	$"4159 530D 4352 4544 530D 4352 4545 4C0D"            /* AYSCREDSCREEL */	$"4352 4545 530D 4352 454D 530D 4352 454E"            /* CREESCREMSCREN */	$"410D 4352 4550 530D 4352 4550 590D 4352"            /* ACREPSCREPYCR */	$"4557 450D 4352 4557 530D 4352 4941 530D"            /* EWECREWSCRIAS */	$"4352 4942 530D 4352 4945 530D 4352 494D"            /* CRIBSCRIESCRIM */	$"530D 4352 494E 450D 4352 494F 530D 4352"            /* SCRINECRIOSCR */	$"4950 450D 4352 4950 530D 4352 4953 450D"            /* IPECRIPSCRISE */	$"4352 4954 480D 4352 4954 530D 4352 4F43"            /* CRITHCRITSCROC */	$"490D 4352 4F43 530D 4352 4F46 540D 4352"            /* ICROCSCROFTCR */	$"4F47 530D 4352 4F4D 420D 4352 4F4D 450D"            /* OGSCROMBCROME */	$"4352 4F4E 4B0D 4352 4F4E 530D 4352 4F4F"            /* CRONKCRONSCROO */	$"4C0D 4352 4F4F 4E0D 4352 4F50 530D 4352"            /* LCROONCROPSCR */	$"4F52 450D 4352 4F53 540D 4352 4F55 540D"            /* ORECROSTCROUT */	$"4352 4F57 530D 4352 4F5A 450D 4352 5543"            /* CROWSCROZECRUC */	$"4B0D 4352 5544 4F0D 4352 5544 530D 4352"            /* KCRUDOCRUDSCR */	$"5544 590D 4352 5545 530D 4352 5545 540D"            /* UDYCRUESCRUET */	$"4352 5546 540D 4352 554E 4B0D 4352 554F"            /* CRUFTCRUNKCRUO */	$"520D 4352 5552 410D 4352 5553 450D 4352"            /* RCRURACRUSECR */	$"5553 590D 4352 5556 450D 4352 5754 480D"            /* USYCRUVECRWTH */	$"4352 5945 520D 4354 454E 450D 4355 4242"            /* CRYERCTENECUBB */	$"590D 4355 4245 420D 4355 4245 440D 4355"            /* YCUBEBCUBEDCU */	$"4245 520D 4355 4245 530D 4355 4249 540D"            /* BERCUBESCUBIT */	$"4355 4444 590D 4355 4646 4F0D 4355 4646"            /* CUDDYCUFFOCUFF */	$"530D 4355 4946 530D 4355 494E 470D 4355"            /* SCUIFSCUINGCU */	$"4953 480D 4355 4954 530D 4355 4B45 530D"            /* ISHCUITSCUKES */	$"4355 4C43 480D 4355 4C45 540D 4355 4C45"            /* CULCHCULETCULE */	$"580D 4355 4C4C 530D 4355 4C4C 590D 4355"            /* XCULLSCULLYCU */	$"4C4D 530D 4355 4C50 410D 4355 4C54 490D"            /* LMSCULPACULTI */	$"4355 4C54 530D 4355 4C54 590D 4355 4D45"            /* CULTSCULTYCUME */	$"430D 4355 4E44 590D 4355 4E45 490D 4355"            /* CCUNDYCUNEICU */	$"4E49 540D 4355 4E54 530D 4355 5045 4C0D"            /* NITCUNTSCUPEL */	$"4355 5049 440D 4355 5050 410D 4355 5050"            /* CUPIDCUPPACUPP */	$"590D 4355 5241 540D 4355 5242 530D 4355"            /* YCURATCURBSCU */	$"5243 480D 4355 5244 530D 4355 5244 590D"            /* RCHCURDSCURDY */	$"4355 5245 440D 4355 5245 520D 4355 5245"            /* CUREDCURERCURE */	$"530D 4355 5245 540D 4355 5246 530D 4355"            /* SCURETCURFSCU */	$"5249 410D 4355 5249 450D 4355 524C 490D"            /* RIACURIECURLI */	$"4355 524C 530D 4355 524E 530D 4355 524E"            /* CURLSCURNSCURN */	$"590D 4355 5252 530D 4355 5253 490D 4355"            /* YCURRSCURSICU */	$"5253 540D 4355 5345 430D 4355 5348 590D"            /* RSTCUSECCUSHY */	$"4355 534B 530D 4355 5350 530D 4355 5350"            /* CUSKSCUSPSCUSP */	$"590D 4355 5353 4F0D 4355 5355 4D0D 4355"            /* YCUSSOCUSUMCU */	$"5443 480D 4355 5445 520D 4355 5445 530D"            /* TCHCUTERCUTES */	$"4355 5445 590D 4355 5449 4E0D 4355 5449"            /* CUTEYCUTINCUTI */	$"530D 4355 5454 4F0D 4355 5454 590D 4355"            /* SCUTTOCUTTYCU */	$"5455 500D 4355 5645 450D 4355 5A45 530D"            /* TUPCUVEECUZES */	$"4357 5443 480D 4359 414E 4F0D 4359 414E"            /* CWTCHCYANOCYAN */	$"530D 4359 4341 440D 4359 4341 530D 4359"            /* SCYCADCYCASCY */	$"434C 4F0D 4359 4445 520D 4359 4C49 580D"            /* CLOCYDERCYLIX */	$"4359 4D41 450D 4359 4D41 520D 4359 4D41"            /* CYMAECYMARCYMA */	$"530D 4359 4D45 530D 4359 4D4F 4C0D 4359"            /* SCYMESCYMOLCY */	$"5354 530D 4359 5445 530D 4359 544F 4E0D"            /* STSCYTESCYTON */	$"435A 4152 530D 4441 414C 530D 4441 4242"            /* CZARSDAALSDABB */	$"410D 4441 4345 530D 4441 4348 410D 4441"            /* ADACESDACHADA */	$"434B 530D 4441 4441 480D 4441 4441 530D"            /* CKSDADAHDADAS */	$"4441 444F 530D 4441 4646 530D 4441 4646"            /* DADOSDAFFSDAFF */	$"590D 4441 4747 410D 4441 4747 590D 4441"            /* YDAGGADAGGYDA */	$"474F 530D 4441 484C 530D 4441 494B 4F0D"            /* GOSDAHLSDAIKO */	$"4441 494E 450D 4441 494E 540D 4441 4B45"            /* DAINEDAINTDAKE */	$"520D 4441 4C45 440D 4441 4C45 530D 4441"            /* RDALEDDALESDA */	$"4C49 530D 4441 4C4C 450D 4441 4C54 530D"            /* LISDALLEDALTS */	$"4441 4D41 4E0D 4441 4D41 520D 4441 4D45"            /* DAMANDAMARDAME */	$"530D 4441 4D4D 450D 4441 4D4E 530D 4441"            /* SDAMMEDAMNSDA */	$"4D50 530D 4441 4D50 590D 4441 4E43 590D"            /* MPSDAMPYDANCY */	$"4441 4E47 530D 4441 4E49 4F0D 4441 4E4B"            /* DANGSDANIODANK */	$"530D 4441 4E4E 590D 4441 4E54 530D 4441"            /* SDANNYDANTSDA */	$"5241 460D 4441 5242 530D 4441 5243 590D"            /* RAFDARBSDARCY */	$"4441 5245 440D 4441 5245 520D 4441 5245"            /* DAREDDARERDARE */	$"530D 4441 5247 410D 4441 5247 530D 4441"            /* SDARGADARGSDA */	$"5249 430D 4441 5249 530D 4441 524B 530D"            /* RICDARISDARKS */	$"4441 524B 590D 4441 524E 530D 4441 5252"            /* DARKYDARNSDARR */	$"450D 4441 5254 530D 4441 525A 490D 4441"            /* EDARTSDARZIDA */	$"5348 490D 4441 5348 590D 4441 5441 4C0D"            /* SHIDASHYDATAL */	$"4441 5445 440D 4441 5445 520D 4441 5445"            /* DATEDDATERDATE */	$"530D 4441 544F 530D 4441 5454 4F0D 4441"            /* SDATOSDATTODA */	$"5542 450D 4441 5542 530D 4441 5542 590D"            /* UBEDAUBSDAUBY */	$"4441 5544 530D 4441 554C 540D 4441 5552"            /* DAUDSDAULTDAUR */	$"530D 4441 5554 530D 4441 5645 4E0D 4441"            /* SDAUTSDAVENDA */	$"5649 540D 4441 5741 480D 4441 5744 530D"            /* VITDAWAHDAWDS */	$"4441 5745 440D 4441 5745 4E0D 4441 574B"            /* DAWEDDAWENDAWK */	$"530D 4441 574E 530D 4441 5754 530D 4441"            /* SDAWNSDAWTSDA */	$"5941 4E0D 4441 5943 480D 4441 594E 540D"            /* YANDAYCHDAYNT */	$"4441 5A45 440D 4441 5A45 520D 4441 5A45"            /* DAZEDDAZERDAZE */	$"530D 4445 4144 530D 4445 4149 520D 4445"            /* SDEADSDEAIRDE */	$"414C 530D 4445 414E 530D 4445 4152 450D"            /* ALSDEANSDEARE */	$"4445 4152 4E0D 4445 4152 530D 4445 4152"            /* DEARNDEARSDEAR */	$"590D 4445 4153 480D 4445 4156 450D 4445"            /* YDEASHDEAVEDE */	$"4157 530D 4445 4157 590D 4445 4241 470D"            /* AWSDEAWYDEBAG */	$"4445 4242 590D 4445 4245 4C0D 4445 4245"            /* DEBBYDEBELDEBE */	$"530D 4445 4254 530D 4445 4255 440D 4445"            /* SDEBTSDEBUDDE */	$"4255 520D 4445 4255 530D 4445 4259 450D"            /* BURDEBUSDEBYE */	$"4445 4341 440D 4445 4341 460D 4445 4341"            /* DECADDECAFDECA */	$"4E0D 4445 434B 4F0D 4445 434B 530D 4445"            /* NDECKODECKSDE */	$"434F 530D 4445 4441 4C0D 4445 4544 530D"            /* COSDEDALDEEDS */	$"4445 4544 590D 4445 454C 590D 4445 454D"            /* DEEDYDEELYDEEM */	$"530D 4445 454E 530D 4445 4550 530D 4445"            /* SDEENSDEEPSDE */	$"4552 450D 4445 4552 530D 4445 4554 530D"            /* EREDEERSDEETS */	$"4445 4556 450D 4445 4556 530D 4445 4641"            /* DEEVEDEEVSDEFA */	$"540D 4445 4646 4F0D 4445 4649 530D 4445"            /* TDEFFODEFISDE */	$"464F 470D 4445 4741 530D 4445 4755 4D0D"            /* FOGDEGASDEGUM */	$"4445 4755 530D 4445 4943 450D 4445 4944"            /* DEGUSDEICEDEID */	$"530D 4445 4946 590D 4445 494C 530D 4445"            /* SDEIFYDEILSDE */	$"4953 4D0D 4445 4953 540D 4445 4B45 440D"            /* ISMDEISTDEKED */	$"4445 4B45 530D 4445 4B4B 4F0D 4445 4C45"            /* DEKESDEKKODELE */	$"440D 4445 4C45 530D 4445 4C46 530D 4445"            /* DDELESDELFSDE */	$"4C46 540D 4445 4C49 530D 4445 4C4C 530D"            /* LFTDELISDELLS */	$"4445 4C4C 590D 4445 4C4F 530D 4445 4C50"            /* DELLYDELOSDELP */	$"480D 4445 4C54 530D 4445 4D41 4E0D 4445"            /* HDELTSDEMANDE */	$"4D45 530D 4445 4D49 430D 4445 4D49 540D"            /* MESDEMICDEMIT */	$"4445 4D4F 420D 4445 4D4F 490D 4445 4D4F"            /* DEMOBDEMOIDEMO */	$"530D 4445 4D50 540D 4445 4E41 520D 4445"            /* SDEMPTDENARDE */	$"4E41 590D 4445 4E43 480D 4445 4E45 530D"            /* NAYDENCHDENES */	$"4445 4E45 540D 4445 4E49 530D 4445 4E54"            /* DENETDENISDENT */	$"530D 4445 4F58 590D 4445 5241 540D 4445"            /* SDEOXYDERATDE */	$"5241 590D 4445 5245 440D 4445 5245 530D"            /* RAYDEREDDERES */	$"4445 5249 470D 4445 524D 410D 4445 524D"            /* DERIGDERMADERM */	$"530D 4445 524E 530D 4445 524E 590D 4445"            /* SDERNSDERNYDE */	$"524F 530D 4445 5252 4F0D 4445 5252 590D"            /* ROSDERRODERRY */	$"4445 5254 480D 4445 5256 530D 4445 5345"            /* DERTHDERVSDESE */	$"580D 4445 5348 490D 4445 5349 530D 4445"            /* XDESHIDESISDE */	$"534B 530D 4445 5353 450D 4445 5641 530D"            /* SKSDESSEDEVAS */	$"4445 5645 4C0D 4445 5649 530D 4445 564F"            /* DEVELDEVISDEVO */	$"4E0D 4445 564F 530D 4445 564F 540D 4445"            /* NDEVOSDEVOTDE */	$"5741 4E0D 4445 5741 520D 4445 5741 580D"            /* WANDEWARDEWAX */	$"4445 5745 440D 4445 5845 530D 4445 5849"            /* DEWEDDEXESDEXI */	$"450D 4448 4142 410D 4448 414B 530D 4448"            /* EDHABADHAKSDH */	$"414C 530D 4448 494B 520D 4448 4F42 490D"            /* ALSDHIKRDHOBI */	$"4448 4F4C 450D 4448 4F4C 4C0D 4448 4F4C"            /* DHOLEDHOLLDHOL */	$"530D 4448 4F54 490D 4448 4F57 530D 4448"            /* SDHOTIDHOWSDH */	$"5554 490D 4449 4143 540D 4449 414C 530D"            /* UTIDIACTDIALS */	$"4449 414E 450D 4449 415A 4F0D 4449 4242"            /* DIANEDIAZODIBB */	$"530D 4449 4345 440D 4449 4345 520D 4449"            /* SDICEDDICERDI */	$"4345 530D 4449 4348 540D 4449 434B 530D"            /* CESDICHTDICKS */	$"4449 434B 590D 4449 434F 540D 4449 4354"            /* DICKYDICOTDICT */	$"410D 4449 4354 530D 4449 4354 590D 4449"            /* ADICTSDICTYDI */	$"4444 590D 4449 4449 450D 4449 444F 530D"            /* DDYDIDIEDIDOS */	$"4449 4453 540D 4449 4542 530D 4449 454C"            /* DIDSTDIEBSDIEL */	$"530D 4449 454E 450D 4449 4554 530D 4449"            /* SDIENEDIETSDI */	$"4646 530D 4449 4748 540D 4449 4B41 530D"            /* FFSDIGHTDIKAS */	$"4449 4B45 440D 4449 4B45 520D 4449 4B45"            /* DIKEDDIKERDIKE */	$"530D 4449 4B45 590D 4449 4C44 4F0D 4449"            /* SDIKEYDILDODI */	$"4C4C 490D 4449 4C4C 530D 4449 4D42 4F0D"            /* LLIDILLSDIMBO */	$"4449 4D45 520D 4449 4D45 530D 4449 4D50"            /* DIMERDIMESDIMP */	$"530D 4449 4E41 520D 4449 4E45 440D 4449"            /* SDINARDINEDDI */	$"4E45 530D 4449 4E47 450D 4449 4E47 530D"            /* NESDINGEDINGS */	$"4449 4E49 430D 4449 4E4B 530D 4449 4E4B"            /* DINICDINKSDINK */	$"590D 4449 4E4E 410D 4449 4E4F 530D 4449"            /* YDINNADINOSDI */	$"4E54 530D 4449 4F4C 530D 4449 4F54 410D"            /* NTSDIOLSDIOTA */	$"4449 5050 590D 4449 5053 4F0D 4449 5241"            /* DIPPYDIPSODIRA */	$"4D0D 4449 5245 520D 4449 524B 450D 4449"            /* MDIRERDIRKEDI */	$"524B 530D 4449 524C 530D 4449 5254 530D"            /* RKSDIRLSDIRTS */	$"4449 5341 530D 4449 5343 490D 4449 5343"            /* DISASDISCIDISC */	$"530D 4449 5348 590D 4449 534B 530D 4449"            /* SDISHYDISKSDI */	$"534D 450D 4449 5441 4C0D 4449 5441 530D"            /* SMEDITALDITAS */	$"4449 5445 440D 4449 5445 530D 4449 5453"            /* DITEDDITESDITS */	$"590D 4449 5454 530D 4449 545A 590D 4449"            /* YDITTSDITZYDI */	$"5641 4E0D 4449 5641 530D 4449 5645 440D"            /* VANDIVASDIVED */	$"4449 5645 530D 4449 5649 530D 4449 564E"            /* DIVESDIVISDIVN */	$"410D 4449 564F 530D 4449 564F 540D 4449"            /* ADIVOSDIVOTDI */	$"5656 590D 4449 5741 4E0D 4449 5849 450D"            /* VVYDIWANDIXIE */	$"4449 5849 540D 4449 5941 530D 4449 5A45"            /* DIXITDIYASDIZE */	$"4E0D 444A 494E 4E0D 444A 494E 530D 444F"            /* NDJINNDJINSDO */	$"4142 530D 444F 4154 530D 444F 4242 590D"            /* ABSDOATSDOBBY */	$"444F 4245 530D 444F 4249 450D 444F 424C"            /* DOBESDOBIEDOBL */	$"410D 444F 4252 410D 444F 4252 4F0D 444F"            /* ADOBRADOBRODO */	$"4348 540D 444F 434B 530D 444F 434F 530D"            /* CHTDOCKSDOCOS */	$"444F 4355 530D 444F 4444 590D 444F 444F"            /* DOCUSDODDYDODO */	$"530D 444F 454B 530D 444F 4552 530D 444F"            /* SDOEKSDOERSDO */	$"4553 540D 444F 4554 480D 444F 4646 530D"            /* ESTDOETHDOFFS */	$"444F 4741 4E0D 444F 4745 530D 444F 4745"            /* DOGANDOGESDOGE */	$"590D 444F 4747 4F0D 444F 4747 590D 444F"            /* YDOGGODOGGYDO */	$"4749 450D 444F 4859 4F0D 444F 494C 540D"            /* GIEDOHYODOILT */	$"444F 494C 590D 444F 4954 530D 444F 4A4F"            /* DOILYDOITSDOJO */	$"530D 444F 4C43 450D 444F 4C43 490D 444F"            /* SDOLCEDOLCIDO */	$"4C45 440D 444F 4C45 530D 444F 4C49 410D"            /* LEDDOLESDOLIA */	$"444F 4C4C 530D 444F 4C4D 410D 444F 4C4F"            /* DOLLSDOLMADOLO */	$"520D 444F 4C4F 530D 444F 4C54 530D 444F"            /* RDOLOSDOLTSDO */	$"4D41 4C0D 444F 4D45 440D 444F 4D45 530D"            /* MALDOMEDDOMES */	$"444F 4D49 430D 444F 4E41 480D 444F 4E41"            /* DOMICDONAHDONA */	$"530D 444F 4E45 450D 444F 4E45 520D 444F"            /* SDONEEDONERDO */	$"4E47 410D 444F 4E47 530D 444F 4E4B 4F0D"            /* NGADONGSDONKO */	$"444F 4E4E 410D 444F 4E4E 450D 444F 4E4E"            /* DONNADONNEDONN */	$"590D 444F 4E53 590D 444F 4F42 530D 444F"            /* YDONSYDOOBSDO */	$"4F43 450D 444F 4F44 590D 444F 4F4B 530D"            /* OCEDOODYDOOKS */	$"444F 4F4C 450D 444F 4F4C 530D 444F 4F4C"            /* DOOLEDOOLSDOOL */	$"590D 444F 4F4D 530D 444F 4F4D 590D 444F"            /* YDOOMSDOOMYDO */	$"4F4E 410D 444F 4F52 4E0D 444F 4F52 530D"            /* ONADOORNDOORS */	$"444F 4F5A 590D 444F 5041 530D 444F 5045"            /* DOOZYDOPASDOPE */	$"440D 444F 5045 520D 444F 5045 530D 444F"            /* DDOPERDOPESDO */	$"5241 440D 444F 5242 410D 444F 5242 530D"            /* RADDORBADORBS */	$"444F 5245 450D 444F 5245 530D 444F 5249"            /* DOREEDORESDORI */	$"430D 444F 5249 530D 444F 524B 530D 444F"            /* CDORISDORKSDO */	$"524B 590D 444F 524D 530D 444F 524D 590D"            /* RKYDORMSDORMY */	$"444F 5250 530D 444F 5252 530D 444F 5253"            /* DORPSDORRSDORS */	$"410D 444F 5253 450D 444F 5254 530D 444F"            /* ADORSEDORTSDO */	$"5254 590D 444F 5341 490D 444F 5341 530D"            /* RTYDOSAIDOSAS */	$"444F 5345 440D 444F 5345 480D 444F 5345"            /* DOSEDDOSEHDOSE */	$"520D 444F 5345 530D 444F 5348 410D 444F"            /* RDOSESDOSHADO */	$"5441 4C0D 444F 5445 440D 444F 5445 520D"            /* TALDOTEDDOTER */	$"444F 5445 530D 444F 5454 590D 444F 5541"            /* DOTESDOTTYDOUA */	$"520D 444F 5543 450D 444F 5543 530D 444F"            /* RDOUCEDOUCSDO */	$"554B 530D 444F 554C 410D 444F 554D 410D"            /* UKSDOULADOUMA */	$"444F 554D 530D 444F 5550 530D 444F 5552"            /* DOUMSDOUPSDOUR */	$"410D 444F 5553 450D 444F 5554 530D 444F"            /* ADOUSEDOUTSDO */	$"5645 440D 444F 5645 4E0D 444F 5645 520D"            /* VEDDOVENDOVER */	$"444F 5645 530D 444F 5649 450D 444F 5741"            /* DOVESDOVIEDOWA */	$"520D 444F 5744 530D 444F 5745 440D 444F"            /* RDOWDSDOWEDDO */	$"5745 520D 444F 5749 450D 444F 574C 450D"            /* WERDOWIEDOWLE */	$"444F 574C 530D 444F 574C 590D 444F 574E"            /* DOWLSDOWLYDOWN */	$"410D 444F 574E 530D 444F 5750 530D 444F"            /* ADOWNSDOWPSDO */	$"5753 450D 444F 5754 530D 444F 5845 440D"            /* WSEDOWTSDOXED */	$"444F 5845 530D 444F 5849 450D 444F 5945"            /* DOXESDOXIEDOYE */	$"4E0D 444F 594C 590D 444F 5A45 440D 444F"            /* NDOYLYDOZEDDO */	$"5A45 520D 444F 5A45 530D 4452 4142 530D"            /* ZERDOZESDRABS */	$"4452 4143 4B0D 4452 4143 4F0D 4452 4146"            /* DRACKDRACODRAF */	$"460D 4452 4147 530D 4452 4149 4C0D 4452"            /* FDRAGSDRAILDR */	$"414D 530D 4452 414E 540D 4452 4150 530D"            /* AMSDRANTDRAPS */	$"4452 4154 530D 4452 4156 450D 4452 4157"            /* DRATSDRAVEDRAW */	$"530D 4452 4159 530D 4452 4541 520D 4452"            /* SDRAYSDREARDR */	$"4543 4B0D 4452 4545 440D 4452 4545 520D"            /* ECKDREEDDREER */	$"4452 4545 530D 4452 4547 530D 4452 454B"            /* DREESDREGSDREK */	$"530D 4452 454E 540D 4452 4552 450D 4452"            /* SDRENTDREREDR */	$"4553 540D 4452 4559 530D 4452 4942 530D"            /* ESTDREYSDRIBS */	$"4452 4943 450D 4452 4945 530D 4452 494C"            /* DRICEDRIESDRIL */	$"590D 4452 4950 530D 4452 4950 540D 4452"            /* YDRIPSDRIPTDR */	$"4F49 440D 4452 4F49 4C0D 4452 4F4B 450D"            /* OIDDROILDROKE */	$"4452 4F4C 450D 4452 4F4D 450D 4452 4F4E"            /* DROLEDROMEDRON */	$"590D 4452 4F4F 420D 4452 4F4F 470D 4452"            /* YDROOBDROOGDR */	$"4F4F 4B0D 4452 4F50 530D 4452 4F50 540D"            /* OOKDROPSDROPT */	$"4452 4F55 4B0D 4452 4F57 530D 4452 5542"            /* DROUKDROWSDRUB */	$"530D 4452 5547 530D 4452 554D 530D 4452"            /* SDRUGSDRUMSDR */	$"5550 450D 4452 5553 450D 4452 5553 590D"            /* UPEDRUSEDRUSY */	$"4452 5558 590D 4452 5941 440D 4452 5941"            /* DRUXYDRYADDRYA */	$"530D 4453 4F42 4F0D 4453 4F4D 4F0D 4455"            /* SDSOBODSOMODU */	$"4144 530D 4455 414C 530D 4455 414E 530D"            /* ADSDUALSDUANS */	$"4455 4152 530D 4455 4242 4F0D 4455 4341"            /* DUARSDUBBODUCA */	$"4C0D 4455 4341 540D 4455 4345 530D 4455"            /* LDUCATDUCESDU */	$"434B 530D 4455 434B 590D 4455 4354 530D"            /* CKSDUCKYDUCTS */	$"4455 4444 590D 4455 4445 440D 4455 4445"            /* DUDDYDUDEDDUDE */	$"530D 4455 454C 530D 4455 4554 530D 4455"            /* SDUELSDUETSDU */	$"4554 540D 4455 4646 530D 4455 4655 530D"            /* ETTDUFFSDUFUS */	$"4455 494E 470D 4455 4954 530D 4455 4B41"            /* DUINGDUITSDUKA */	$"530D 4455 4B45 440D 4455 4B45 530D 4455"            /* SDUKEDDUKESDU */	$"4B4B 410D 4455 4C43 450D 4455 4C45 530D"            /* KKADULCEDULES */	$"4455 4C49 410D 4455 4C4C 530D 4455 4C53"            /* DULIADULLSDULS */	$"450D 4455 4D41 530D 4455 4D42 4F0D 4455"            /* EDUMASDUMBODU */	$"4D42 530D 4455 4D4B 410D 4455 4D4B 590D"            /* MBSDUMKADUMKY */	$"4455 4D50 530D 4455 4E41 4D0D 4455 4E43"            /* DUMPSDUNAMDUNC */	$"480D 4455 4E45 530D 4455 4E47 530D 4455"            /* HDUNESDUNGSDU */	$"4E47 590D 4455 4E4B 530D 4455 4E4E 4F0D"            /* NGYDUNKSDUNNO */	$"4455 4E4E 590D 4455 4E53 480D 4455 4E54"            /* DUNNYDUNSHDUNT */	$"530D 4455 4F4D 490D 4455 4F4D 4F0D 4455"            /* SDUOMIDUOMODU */	$"5045 440D 4455 5045 520D 4455 5045 530D"            /* PEDDUPERDUPES */	$"4455 504C 450D 4455 504C 590D 4455 5050"            /* DUPLEDUPLYDUPP */	$"590D 4455 5241 4C0D 4455 5241 530D 4455"            /* YDURALDURASDU */	$"5245 440D 4455 5245 530D 4455 5247 590D"            /* REDDURESDURGY */	$"4455 524E 530D 4455 524F 430D 4455 524F"            /* DURNSDUROCDURO */	$"530D 4455 524F 590D 4455 5252 410D 4455"            /* SDUROYDURRADU */	$"5252 530D 4455 5252 590D 4455 5253 540D"            /* RRSDURRYDURST */	$"4455 5255 4D0D 4455 525A 490D 4455 534B"            /* DURUMDURZIDUSK */	$"530D 4455 5354 530D 4455 5845 530D 4457"            /* SDUSTSDUXESDW */	$"4141 4C0D 4457 414C 450D 4457 414C 4D0D"            /* AALDWALEDWALM */	$"4457 414D 530D 4457 414E 470D 4457 4155"            /* DWAMSDWANGDWAU */	$"4D0D 4457 4545 420D 4457 494C 450D 4457"            /* MDWEEBDWILEDW */	$"494E 450D 4459 4144 530D 4459 4552 530D"            /* INEDYADSDYERS */	$"4459 4B45 440D 4459 4B45 530D 4459 4B45"            /* DYKEDDYKESDYKE */	$"590D 4459 4B4F 4E0D 4459 4E45 4C0D 4459"            /* YDYKONDYNELDY */	$"4E45 530D 445A 484F 530D 4541 4752 450D"            /* NESDZHOSEAGRE */	$"4541 4C45 440D 4541 4C45 530D 4541 4E45"            /* EALEDEALESEANE */	$"440D 4541 5244 530D 4541 5245 440D 4541"            /* DEARDSEAREDEA */	$"524C 530D 4541 524E 530D 4541 524E 540D"            /* RLSEARNSEARNT */	$"4541 5253 540D 4541 5345 440D 4541 5345"            /* EARSTEASEDEASE */	$"520D 4541 5345 530D 4541 534C 450D 4541"            /* REASESEASLEEA */	$"5354 530D 4541 5448 450D 4541 5645 440D"            /* STSEATHEEAVED */	$"4541 5645 530D 4542 4245 440D 4542 4245"            /* EAVESEBBEDEBBE */	$"540D 4542 4F4E 530D 4542 4F4F 4B0D 4543"            /* TEBONSEBOOKEC */	$"4144 530D 4543 4845 440D 4543 4845 530D"            /* ADSECHEDECHES */	$"4543 484F 530D 4543 5255 530D 4544 454D"            /* ECHOSECRUSEDEM */	$"410D 4544 4745 440D 4544 4745 520D 4544"            /* AEDGEDEDGERED */	$"4745 530D 4544 494C 450D 4544 4954 530D"            /* GESEDILEEDITS */	$"4544 5543 450D 4544 5543 540D 4545 4A49"            /* EDUCEEDUCTEEJI */	$"540D 4545 4E53 590D 4545 5645 4E0D 4545"            /* TEENSYEEVENEE */	$"564E 530D 4546 4645 440D 4547 4144 530D"            /* VNSEFFEDEGADS */	$"4547 4552 530D 4547 4553 540D 4547 4741"            /* EGERSEGESTEGGA */	$"520D 4547 4745 440D 4547 4745 520D 4547"            /* REGGEDEGGEREG */	$"4D41 530D 4548 494E 470D 4549 4445 520D"            /* MASEHINGEIDER */	$"4549 444F 530D 4549 474E 450D 4549 4B45"            /* EIDOSEIGNEEIKE */	$"440D 4549 4B4F 4E0D 4549 4C44 530D 4549"            /* DEIKONEILDSEI */	$"5345 4C0D 454A 4944 4F0D 454B 4B41 530D"            /* SELEJIDOEKKAS */	$"454C 4149 4E0D 454C 414E 440D 454C 414E"            /* ELAINELANDELAN */	$"530D 454C 4348 490D 454C 4449 4E0D 454C"            /* SELCHIELDINEL */	$"454D 490D 454C 4645 440D 454C 4941 440D"            /* EMIELFEDELIAD */	$"454C 494E 540D 454C 4D45 4E0D 454C 4F47"            /* ELINTELMENELOG */	$"450D 454C 4F47 590D 454C 4F49 4E0D 454C"            /* EELOGYELOINEL */	$"4F50 530D 454C 5045 450D 454C 5349 4E0D"            /* OPSELPEEELSIN */	$"454C 5554 450D 454C 5641 4E0D 454C 5645"            /* ELUTEELVANELVE */	$"4E0D 454C 5645 520D 454C 5645 530D 454D"            /* NELVERELVESEM */	$"4143 530D 454D 4241 520D 454D 4241 590D"            /* ACSEMBAREMBAY */	$"454D 424F 470D 454D 424F 570D 454D 424F"            /* EMBOGEMBOWEMBO */	$"580D 454D 4255 530D 454D 4545 520D 454D"            /* XEMBUSEMEEREM */	$"454E 440D 454D 4552 470D 454D 4552 590D"            /* ENDEMERGEMERY */	$"454D 4555 530D 454D 4943 530D 454D 4952"            /* EMEUSEMICSEMIR */	$"530D 454D 4954 530D 454D 4D41 530D 454D"            /* SEMITSEMMASEM */	$"4D45 520D 454D 4D45 540D 454D 4D45 570D"            /* MEREMMETEMMEW */	$"454D 4D59 530D 454D 4F4A 490D 454D 4F4E"            /* EMMYSEMOJIEMON */	$"470D 454D 4F54 450D 454D 4F56 450D 454D"            /* GEMOTEEMOVEEM */	$"5054 530D 454D 554C 450D 454D 5552 450D"            /* PTSEMULEEMURE */	$"454D 5944 450D 454D 5944 530D 454E 4152"            /* EMYDEEMYDSENAR */	$"4D0D 454E 4154 450D 454E 4445 440D 454E"            /* MENATEENDEDEN */	$"4445 520D 454E 4445 570D 454E 4455 450D"            /* DERENDEWENDUE */	$"454E 4557 530D 454E 4649 580D 454E 4941"            /* ENEWSENFIXENIA */	$"430D 454E 4C49 540D 454E 4D45 570D 454E"            /* CENLITENMEWEN */	$"4E4F 470D 454E 4F4B 490D 454E 4F4C 530D"            /* NOGENOKIENOLS */	$"454E 4F52 4D0D 454E 4F57 530D 454E 524F"            /* ENORMENOWSENRO */	$"4C0D 454E 5345 570D 454E 534B 590D 454E"            /* LENSEWENSKYEN */	$"5449 410D 454E 5552 450D 454E 5552 4E0D"            /* TIAENUREENURN */	$"454E 564F 490D 454E 5A59 4D0D 454F 524C"            /* ENVOIENZYMEORL */	$"530D 454F 5349 4E0D 4550 4143 540D 4550"            /* SEOSINEPACTEP */	$"4545 530D 4550 4841 480D 4550 4841 530D"            /* EESEPHAHEPHAS */	$"4550 484F 440D 4550 484F 520D 4550 4943"            /* EPHODEPHOREPIC */	$"530D 4550 4F44 450D 4550 4F50 540D 4550"            /* SEPODEEPOPTEP */	$"5249 530D 4551 5545 530D 4551 5549 440D"            /* RISEQUESEQUID */	$"4552 4249 410D 4552 4556 530D 4552 474F"            /* ERBIAEREVSERGO */	$"4E0D 4552 474F 530D 4552 474F 540D 4552"            /* NERGOSERGOTER */	$"4855 530D 4552 4943 410D 4552 4943 4B0D"            /* HUSERICAERICK */	$"4552 4943 530D 4552 494E 470D 4552 4E45"            /* ERICSERINGERNE */	$"440D 4552 4E45 530D 4552 4F53 450D 4552"            /* DERNESEROSEER */	$"5245 440D 4552 5345 530D 4552 5543 540D"            /* REDERSESERUCT */	$"4552 5547 4F0D 4552 5556 530D 4552 5645"            /* ERUGOERUVSERVE */	$"4E0D 4552 5649 4C0D 4553 4341 520D 4553"            /* NERVILESCARES */	$"434F 540D 4553 494C 450D 4553 4B41 520D"            /* COTESILEESKAR */	$"4553 4B45 520D 4553 4E45 530D 4553 5345"            /* ESKERESNESESSE */	$"530D 4553 544F 430D 4553 544F 500D 4553"            /* SESTOCESTOPES */	$"5452 4F0D 4554 4147 450D 4554 4150 450D"            /* TROETAGEETAPE */	$"4554 4154 530D 4554 454E 530D 4554 4841"            /* ETATSETENSETHA */	$"4C0D 4554 484E 450D 4554 4859 4C0D 4554"            /* LETHNEETHYLET */	$"4943 530D 4554 4E41 530D 4554 5449 4E0D"            /* ICSETNASETTIN */	$"4554 544C 450D 4554 5549 530D 4554 5745"            /* ETTLEETUISETWE */	$"450D 4554 594D 410D 4555 4748 530D 4555"            /* EETYMAEUGHSEU */	$"4B45 440D 4555 5041 440D 4555 524F 530D"            /* KEDEUPADEUROS */	$"4555 534F 4C0D 4556 454E 530D 4556 4552"            /* EUSOLEVENSEVER */	$"540D 4556 4554 530D 4556 484F 450D 4556"            /* TEVETSEVHOEEV */	$"494C 530D 4556 4954 450D 4556 4F48 450D"            /* ILSEVITEEVOHE */	$"4557 4552 530D 4557 4553 540D 4557 484F"            /* EWERSEWESTEWHO */	$"570D 4557 4B45 440D 4558 414D 530D 4558"            /* WEWKEDEXAMSEX */	$"4541 540D 4558 4543 530D 4558 4545 4D0D"            /* EATEXECSEXEEM */	$"4558 454D 450D 4558 4649 4C0D 4558 4945"            /* EXEMEEXFILEXIE */	$"530D 4558 494E 450D 4558 494E 470D 4558"            /* SEXINEEXINGEX */	$"4954 530D 4558 4F44 450D 4558 4F4D 450D"            /* ITSEXODEEXOME */	$"4558 4F4E 530D 4558 5041 540D 4558 504F"            /* EXONSEXPATEXPO */	$"530D 4558 5544 450D 4558 554C 530D 4558"            /* SEXUDEEXULSEX */	$"5552 420D 4559 4153 530D 4559 4552 530D"            /* URBEYASSEYERS */	$"4559 4F54 530D 4559 5241 530D 4559 5245"            /* EYOTSEYRASEYRE */	$"530D 4559 5249 450D 4559 5249 520D 455A"            /* SEYRIEEYRIREZ */	$"494E 450D 4641 4242 590D 4641 4345 440D"            /* INEFABBYFACED */	$"4641 4345 520D 4641 4345 530D 4641 4349"            /* FACERFACESFACI */	$"410D 4641 4354 410D 4641 4354 530D 4641"            /* AFACTAFACTSFA */	$"4444 590D 4641 4445 440D 4641 4445 520D"            /* DDYFADEDFADER */	$"4641 4445 530D 4641 4447 450D 4641 444F"            /* FADESFADGEFADO */	$"530D 4641 454E 410D 4641 4552 590D 4641"            /* SFAENAFAERYFA */	$"4646 530D 4641 4646 590D 4641 4747 590D"            /* FFSFAFFYFAGGY */	$"4641 4749 4E0D 4641 474F 540D 4641 494B"            /* FAGINFAGOTFAIK */	$"530D 4641 494C 530D 4641 494E 450D 4641"            /* SFAILSFAINEFA */	$"494E 530D 4641 4952 530D 4641 4B45 440D"            /* INSFAIRSFAKED */	$"4641 4B45 520D 4641 4B45 530D 4641 4B45"            /* FAKERFAKESFAKE */	$"590D 4641 4B49 450D 4641 4B49 520D 4641"            /* YFAKIEFAKIRFA */	$"4C41 4A0D 4641 4C4C 530D 4641 4D45 440D"            /* LAJFALLSFAMED */	$"4641 4D45 530D 4641 4E41 4C0D 4641 4E44"            /* FAMESFANALFAND */	$"530D 4641 4E45 530D 4641 4E47 410D 4641"            /* SFANESFANGAFA */	$"4E47 4F0D 4641 4E47 530D 4641 4E4B 530D"            /* NGOFANGSFANKS */	$"4641 4E4F 4E0D 4641 4E4F 530D 4641 4E55"            /* FANONFANOSFANU */	$"4D0D 4641 5149 520D 4641 5241 440D 4641"            /* MFAQIRFARADFA */	$"5243 490D 4641 5243 590D 4641 5244 530D"            /* RCIFARCYFARDS */	$"4641 5245 440D 4641 5245 520D 4641 5245"            /* FAREDFARERFARE */	$"530D 4641 524C 450D 4641 524C 530D 4641"            /* SFARLEFARLSFA */	$"524D 530D 4641 524F 530D 4641 5252 4F0D"            /* RMSFAROSFARRO */	$"4641 5253 450D 4641 5254 530D 4641 5343"            /* FARSEFARTSFASC */	$"490D 4641 5354 490D 4641 5354 530D 4641"            /* IFASTIFASTSFA */	$"5445 440D 4641 5445 530D 4641 544C 590D"            /* TEDFATESFATLY */	$"4641 5453 4F0D 4641 5457 410D 4641 5547"            /* FATSOFATWAFAUG */	$"480D 4641 554C 440D 4641 554E 530D 4641"            /* HFAULDFAUNSFA */	$"5552 440D 4641 5554 530D 4641 5556 450D"            /* URDFAUTSFAUVE */	$"4641 5641 530D 4641 5645 4C0D 4641 5645"            /* FAVASFAVELFAVE */	$"520D 4641 5645 530D 4641 5655 530D 4641"            /* RFAVESFAVUSFA */	$"574E 530D 4641 574E 590D 4641 5845 440D"            /* WNSFAWNYFAXED */	$"4641 5845 530D 4641 5945 440D 4641 5945"            /* FAXESFAYEDFAYE */	$"520D 4641 594E 450D 4641 5952 450D 4641"            /* RFAYNEFAYREFA */	$"5A45 440D 4641 5A45 530D 4645 414C 530D"            /* ZEDFAZESFEALS */	$"4645 4152 450D 4645 4152 530D 4645 4152"            /* FEAREFEARSFEAR */	$"540D 4645 4153 450D 4645 4154 530D 4645"            /* TFEASEFEATSFE */	$"415A 450D 4645 4345 530D 4645 4348 540D"            /* AZEFECESFECHT */	$"4645 4349 540D 4645 434B 530D 4645 4445"            /* FECITFECKSFEDE */	$"580D 4645 4542 530D 4645 4544 530D 4645"            /* XFEEBSFEEDSFE */	$"454C 530D 4645 454E 530D 4645 4552 530D"            /* ELSFEENSFEERS */	$"4645 4553 450D 4645 455A 450D 4645 484D"            /* FEESEFEEZEFEHM */	$"450D 4645 494E 540D 4645 4953 540D 4645"            /* EFEINTFEISTFE */	$"4C43 480D 4645 4C49 440D 4645 4C4C 530D"            /* LCHFELIDFELLS */	$"4645 4C4C 590D 4645 4C54 530D 4645 4C54"            /* FELLYFELTSFELT */	$"590D 4645 4D41 4C0D 4645 4D45 530D 4645"            /* YFEMALFEMESFE */	$"4D4D 590D 4645 4E44 530D 4645 4E44 590D"            /* MMYFENDSFENDY */	$"4645 4E49 530D 4645 4E4B 530D 4645 4E4E"            /* FENISFENKSFENN */	$"590D 4645 4E54 530D 4645 4F44 530D 4645"            /* YFENTSFEODSFE */	$"4F46 460D 4645 5245 520D 4645 5245 530D"            /* OFFFERERFERES */	$"4645 5249 410D 4645 524C 590D 4645 524D"            /* FERIAFERLYFERM */	$"490D 4645 524D 530D 4645 524E 530D 4645"            /* IFERMSFERNSFE */	$"524E 590D 4645 5353 450D 4645 5354 410D"            /* RNYFESSEFESTA */	$"4645 5354 530D 4645 5354 590D 4645 5441"            /* FESTSFESTYFETA */	$"530D 4645 5445 440D 4645 5445 530D 4645"            /* SFETEDFETESFE */	$"544F 520D 4645 5454 410D 4645 5454 530D"            /* TORFETTAFETTS */	$"4645 5457 410D 4645 5541 520D 4645 5544"            /* FETWAFEUARFEUD */	$"530D 4645 5545 440D 4645 5945 440D 4645"            /* SFEUEDFEYEDFE */	$"5945 520D 4645 594C 590D 4645 5A45 530D"            /* YERFEYLYFEZES */	$"4645 5A5A 590D 4649 4152 530D 4649 4154"            /* FEZZYFIARSFIAT */	$"530D 4649 4252 450D 4649 4252 4F0D 4649"            /* SFIBREFIBROFI */	$"4345 530D 4649 4348 450D 4649 4348 550D"            /* CESFICHEFICHU */	$"4649 4349 4E0D 4649 434F 530D 4649 4445"            /* FICINFICOSFIDE */	$"530D 4649 4447 450D 4649 444F 530D 4649"            /* SFIDGEFIDOSFI */	$"4546 530D 4649 454E 540D 4649 4552 450D"            /* EFSFIENTFIERE */	$"4649 4552 530D 4649 4553 540D 4649 4645"            /* FIERSFIESTFIFE */	$"440D 4649 4645 520D 4649 4645 530D 4649"            /* DFIFERFIFESFI */	$"4649 530D 4649 4747 590D 4649 474F 530D"            /* FISFIGGYFIGOS */	$"4649 4B45 440D 4649 4B45 530D 4649 4C41"            /* FIKEDFIKESFILA */	$"520D 4649 4C43 480D 4649 4C45 440D 4649"            /* RFILCHFILEDFI */	$"4C45 530D 4649 4C49 490D 4649 4C4B 530D"            /* LESFILIIFILKS */	$"4649 4C4C 450D 4649 4C4C 4F0D 4649 4C4C"            /* FILLEFILLOFILL */	$"530D 4649 4C4D 490D 4649 4C4D 530D 4649"            /* SFILMIFILMSFI */	$"4C4F 530D 4649 4C55 4D0D 4649 4E43 410D"            /* LOSFILUMFINCA */	$"4649 4E44 530D 4649 4E45 440D 4649 4E45"            /* FINDSFINEDFINE */	$"530D 4649 4E49 530D 4649 4E4B 530D 4649"            /* SFINISFINKSFI */	$"4E4E 590D 4649 4E4F 530D 4649 4F52 440D"            /* NNYFINOSFIORD */	$"4649 5148 530D 4649 5155 450D 4649 5245"            /* FIQHSFIQUEFIRE */	$"440D 4649 5245 520D 4649 5245 530D 4649"            /* DFIRERFIRESFI */	$"5249 450D 4649 524B 530D 4649 524D 530D"            /* RIEFIRKSFIRMS */	$"4649 524E 530D 4649 5252 590D 4649 5254"            /* FIRNSFIRRYFIRT */	$"480D 4649 5343 530D 4649 534B 530D 4649"            /* HFISCSFISKSFI */	$"5354 530D 4649 5354 590D 4649 5443 480D"            /* STSFISTYFITCH */	$"4649 544C 590D 4649 544E 410D 4649 5454"            /* FITLYFITNAFITT */	$"450D 4649 5454 530D 4649 5645 520D 4649"            /* EFITTSFIVERFI */	$"5645 530D 4649 5845 440D 4649 5845 530D"            /* VESFIXEDFIXES */	$"4649 5849 540D 464A 454C 440D 464C 4142"            /* FIXITFJELDFLAB */	$"530D 464C 4146 460D 464C 4147 530D 464C"            /* SFLAFFFLAGSFL */	$"414B 530D 464C 414D 4D0D 464C 414D 530D"            /* AKSFLAMMFLAMS */	$"464C 414D 590D 464C 414E 450D 464C 414E"            /* FLAMYFLANEFLAN */	$"530D 464C 4150 530D 464C 4152 590D 464C"            /* SFLAPSFLARYFL */	$"4154 530D 464C 4156 410D 464C 4157 4E0D"            /* ATSFLAVAFLAWN */	$"464C 4157 530D 464C 4157 590D 464C 4158"            /* FLAWSFLAWYFLAX */	$"590D 464C 4159 530D 464C 4541 4D0D 464C"            /* YFLAYSFLEAMFL */	$"4541 530D 464C 4545 4B0D 464C 4545 520D"            /* EASFLEEKFLEER */	$"464C 4545 530D 464C 4547 530D 464C 454D"            /* FLEESFLEGSFLEM */	$"450D 464C 4555 520D 464C 4557 530D 464C"            /* EFLEURFLEWSFL */	$"4558 490D 464C 4558 4F0D 464C 4559 530D"            /* EXIFLEXOFLEYS */	$"464C 4943 530D 464C 4945 440D 464C 4945"            /* FLICSFLIEDFLIE */	$"530D 464C 494D 500D 464C 494D 530D 464C"            /* SFLIMPFLIMSFL */	$"4950 530D 464C 4952 530D 464C 4953 4B0D"            /* IPSFLIRSFLISK */	$"464C 4954 450D 464C 4954 530D 464C 4954"            /* FLITEFLITSFLIT */	$"540D 464C 4F42 530D 464C 4F43 530D 464C"            /* TFLOBSFLOCSFL */	$"4F45 530D 464C 4F47 530D 464C 4F4E 470D"            /* OESFLOGSFLONG */	$"464C 4F50 530D 464C 4F52 530D 464C 4F52"            /* FLOPSFLORSFLOR */	$"590D 464C 4F53 480D 464C 4F54 410D 464C"            /* YFLOSHFLOTAFL */	$"4F54 450D 464C 4F57 530D 464C 5542 530D"            /* OTEFLOWSFLUBS */	$"464C 5545 440D 464C 5545 530D 464C 5545"            /* FLUEDFLUESFLUE */	$"590D 464C 554B 590D 464C 554D 500D 464C"            /* YFLUKYFLUMPFL */	$"554F 520D 464C 5552 520D 464C 5554 590D"            /* UORFLURRFLUTY */	$"464C 5559 540D 464C 5942 590D 464C 5950"            /* FLUYTFLYBYFLYP */	$"450D 464C 5954 450D 464F 414C 530D 464F"            /* EFLYTEFOALSFO */	$"414D 530D 464F 4548 4E0D 464F 4745 590D"            /* AMSFOEHNFOGEY */	$"464F 4749 450D 464F 474C 450D 464F 474F"            /* FOGIEFOGLEFOGO */	$"550D 464F 484E 530D 464F 4944 530D 464F"            /* UFOHNSFOIDSFO */	$"494C 530D 464F 494E 530D 464F 4C44 530D"            /* ILSFOINSFOLDS */	$"464F 4C45 590D 464F 4C49 410D 464F 4C49"            /* FOLEYFOLIAFOLI */	$"430D 464F 4C49 450D 464F 4C4B 530D 464F"            /* CFOLIEFOLKSFO */	$"4C4B 590D 464F 4D45 530D 464F 4E44 410D"            /* LKYFOMESFONDA */	$"464F 4E44 530D 464F 4E44 550D 464F 4E45"            /* FONDSFONDUFONE */	$"530D 464F 4E4C 590D 464F 4E54 530D 464F"            /* SFONLYFONTSFO */	$"4F44 530D 464F 4F44 590D 464F 4F4C 530D"            /* ODSFOODYFOOLS */	$"464F 4F54 530D 464F 4F54 590D 464F 5241"            /* FOOTSFOOTYFORA */	$"4D0D 464F 5242 530D 464F 5242 590D 464F"            /* MFORBSFORBYFO */	$"5244 4F0D 464F 5244 530D 464F 5245 4C0D"            /* RDOFORDSFOREL */	$"464F 5245 530D 464F 5245 580D 464F 524B"            /* FORESFOREXFORK */	$"530D 464F 524B 590D 464F 524D 450D 464F"            /* SFORKYFORMEFO */	$"524D 530D 464F 5254 530D 464F 525A 410D"            /* RMSFORTSFORZA */	$"464F 525A 450D 464F 5353 410D 464F 5353"            /* FORZEFOSSAFOSS */	$"450D 464F 5541 540D 464F 5544 530D 464F"            /* EFOUATFOUDSFO */	$"5545 520D 464F 5545 540D 464F 554C 450D"            /* UERFOUETFOULE */	$"464F 554C 530D 464F 554E 540D 464F 5552"            /* FOULSFOUNTFOUR */	$"530D 464F 5554 480D 464F 5645 410D 464F"            /* SFOUTHFOVEAFO */	$"574C 530D 464F 5754 480D 464F 5845 440D"            /* WLSFOWTHFOXED */	$"464F 5845 530D 464F 5849 450D 464F 594C"            /* FOXESFOXIEFOYL */	$"450D 464F 594E 450D 4652 4142 530D 4652"            /* EFOYNEFRABSFR */	$"4143 4B0D 4652 4143 540D 4652 4147 530D"            /* ACKFRACTFRAGS */	$"4652 4149 4D0D 4652 414E 430D 4652 4150"            /* FRAIMFRANCFRAP */	$"450D 4652 4150 530D 4652 4153 530D 4652"            /* EFRAPSFRASSFR */	$"4154 450D 4652 4154 490D 4652 4154 530D"            /* ATEFRATIFRATS */	$"4652 4155 530D 4652 4159 530D 4652 4545"            /* FRAUSFRAYSFREE */	$"530D 4652 4545 540D 4652 4549 540D 4652"            /* SFREETFREITFR */	$"454D 440D 4652 454E 410D 4652 454F 4E0D"            /* EMDFRENAFREON */	$"4652 4552 450D 4652 4554 530D 4652 4942"            /* FREREFRETSFRIB */	$"530D 4652 4945 520D 4652 4945 530D 4652"            /* SFRIERFRIESFR */	$"4947 530D 4652 4953 450D 4652 4953 540D"            /* IGSFRISEFRIST */	$"4652 4954 480D 4652 4954 530D 4652 4954"            /* FRITHFRITSFRIT */	$"540D 4652 495A 450D 4652 495A 5A0D 4652"            /* TFRIZEFRIZZFR */	$"4F45 530D 4652 4F47 530D 4652 4F4E 530D"            /* OESFROGSFRONS */	$"4652 4F52 450D 4652 4F52 4E0D 4652 4F52"            /* FROREFRORNFROR */	$"590D 4652 4F53 480D 4652 4F57 530D 4652"            /* YFROSHFROWSFR */	$"4F57 590D 4652 5547 530D 4652 554D 500D"            /* OWYFRUGSFRUMP */	$"4652 5553 480D 4652 5553 540D 4652 5945"            /* FRUSHFRUSTFRYE */	$"520D 4655 4241 520D 4655 4242 590D 4655"            /* RFUBARFUBBYFU */	$"4253 590D 4655 434B 530D 4655 4355 530D"            /* BSYFUCKSFUCUS */	$"4655 4444 590D 4655 4447 590D 4655 454C"            /* FUDDYFUDGYFUEL */	$"530D 4655 4552 4F0D 4655 4646 530D 4655"            /* SFUEROFUFFSFU */	$"4646 590D 4655 4741 4C0D 4655 4747 590D"            /* FFYFUGALFUGGY */	$"4655 4749 450D 4655 4749 4F0D 4655 474C"            /* FUGIEFUGIOFUGL */	$"450D 4655 474C 590D 4655 4755 530D 4655"            /* EFUGLYFUGUSFU */	$"4A49 530D 4655 4C4C 530D 4655 4D45 440D"            /* JISFULLSFUMED */	$"4655 4D45 520D 4655 4D45 530D 4655 4D45"            /* FUMERFUMESFUME */	$"540D 4655 4E44 490D 4655 4E44 530D 4655"            /* TFUNDIFUNDSFU */	$"4E44 590D 4655 4E47 4F0D 4655 4E47 530D"            /* NDYFUNGOFUNGS */	$"4655 4E4B 530D 4655 5241 4C0D 4655 5241"            /* FUNKSFURALFURA */	$"4E0D 4655 5243 410D 4655 524C 530D 4655"            /* NFURCAFURLSFU */	$"524F 4C0D 4655 5252 530D 4655 5254 480D"            /* ROLFURRSFURTH */	$"4655 525A 450D 4655 525A 590D 4655 5345"            /* FURZEFURZYFUSE */	$"440D 4655 5345 450D 4655 5345 4C0D 4655"            /* DFUSEEFUSELFU */	$"5345 530D 4655 5349 4C0D 4655 534B 530D"            /* SESFUSILFUSKS */	$"4655 5354 530D 4655 5354 590D 4655 544F"            /* FUSTSFUSTYFUTO */	$"4E0D 4655 5A45 440D 4655 5A45 450D 4655"            /* NFUZEDFUZEEFU */	$"5A45 530D 4655 5A49 4C0D 4659 4345 530D"            /* ZESFUZILFYCES */	$"4659 4B45 440D 4659 4B45 530D 4659 4C45"            /* FYKEDFYKESFYLE */	$"530D 4659 5244 530D 4659 5454 450D 4741"            /* SFYRDSFYTTEGA */	$"4242 410D 4741 4242 590D 4741 424C 450D"            /* BBAGABBYGABLE */	$"4741 4444 490D 4741 4445 530D 4741 4447"            /* GADDIGADESGADG */	$"450D 4741 4449 440D 4741 4449 530D 4741"            /* EGADIDGADISGA */	$"444A 450D 4741 444A 4F0D 4741 4453 4F0D"            /* DJEGADJOGADSO */	$"4741 4646 530D 4741 4745 440D 4741 4745"            /* GAFFSGAGEDGAGE */	$"520D 4741 4745 530D 4741 4944 530D 4741"            /* RGAGESGAIDSGA */	$"494E 530D 4741 4952 530D 4741 4954 410D"            /* INSGAIRSGAITA */	$"4741 4954 530D 4741 4954 540D 4741 4A4F"            /* GAITSGAITTGAJO */	$"530D 4741 4C41 480D 4741 4C41 530D 4741"            /* SGALAHGALASGA */	$"4C41 580D 4741 4C45 410D 4741 4C45 440D"            /* LAXGALEAGALED */	$"4741 4C45 530D 4741 4C4C 530D 4741 4C4C"            /* GALESGALLSGALL */	$"590D 4741 4C4F 500D 4741 4C55 540D 4741"            /* YGALOPGALUTGA */	$"4C56 4F0D 4741 4D41 530D 4741 4D41 590D"            /* LVOGAMASGAMAY */	$"4741 4D42 410D 4741 4D42 450D 4741 4D42"            /* GAMBAGAMBEGAMB */	$"4F0D 4741 4D42 530D 4741 4D45 440D 4741"            /* OGAMBSGAMEDGA */	$"4D45 530D 4741 4D45 590D 4741 4D49 430D"            /* MESGAMEYGAMIC */	$"4741 4D49 4E0D 4741 4D4D 450D 4741 4D4D"            /* GAMINGAMMEGAMM */	$"590D 4741 4D50 530D 4741 4E43 480D 4741"            /* YGAMPSGANCHGA */	$"4E44 590D 4741 4E45 460D 4741 4E45 560D"            /* NDYGANEFGANEV */	$"4741 4E47 530D 4741 4E4A 410D 4741 4E4F"            /* GANGSGANJAGANO */	$"460D 4741 4E54 530D 4741 4F4C 530D 4741"            /* FGANTSGAOLSGA */	$"5045 440D 4741 5045 520D 4741 5045 530D"            /* PEDGAPERGAPES */	$"4741 504F 530D 4741 5050 590D 4741 5242"            /* GAPOSGAPPYGARB */	$"450D 4741 5242 4F0D 4741 5242 530D 4741"            /* EGARBOGARBSGA */	$"5244 410D 4741 5245 530D 4741 5249 530D"            /* RDAGARESGARIS */	$"4741 524D 530D 4741 524E 490D 4741 5252"            /* GARMSGARNIGARR */	$"450D 4741 5254 480D 4741 5255 4D0D 4741"            /* EGARTHGARUMGA */	$"5345 530D 4741 5350 530D 4741 5350 590D"            /* SESGASPSGASPY */	$"4741 5354 530D 4741 5443 480D 4741 5445"            /* GASTSGATCHGATE */	$"440D 4741 5445 520D 4741 5445 530D 4741"            /* DGATERGATESGA */	$"5448 530D 4741 544F 520D 4741 5543 480D"            /* THSGATORGAUCH */	$"4741 5543 590D 4741 5544 530D 4741 554A"            /* GAUCYGAUDSGAUJ */	$"450D 4741 554C 540D 4741 554D 530D 4741"            /* EGAULTGAUMSGA */	$"554D 590D 4741 5550 530D 4741 5552 530D"            /* UMYGAUPSGAURS */	$"4741 5553 530D 4741 555A 590D 4741 564F"            /* GAUSSGAUZYGAVO */	$"540D 4741 5743 590D 4741 5744 530D 4741"            /* TGAWCYGAWDSGA */	$"574B 530D 4741 5750 530D 4741 5753 590D"            /* WKSGAWPSGAWSY */	$"4741 5941 4C0D 4741 5A41 4C0D 4741 5A41"            /* GAYALGAZALGAZA */	$"520D 4741 5A45 440D 4741 5A45 530D 4741"            /* RGAZEDGAZESGA */	$"5A4F 4E0D 4741 5A4F 4F0D 4745 414C 530D"            /* ZONGAZOOGEALS */	$"4745 414E 530D 4745 4152 450D 4745 4152"            /* GEANSGEAREGEAR */	$"530D 4745 4154 530D 4745 4255 520D 4745"            /* SGEATSGEBURGE */	$"434B 530D 4745 454B 530D 4745 4550 530D"            /* CKSGEEKSGEEPS */	$"4745 4553 540D 4745 4953 540D 4745 4954"            /* GEESTGEISTGEIT */	$"530D 4745 4C44 530D 4745 4C45 450D 4745"            /* SGELDSGELEEGE */	$"4C49 440D 4745 4C4C 590D 4745 4C54 530D"            /* LIDGELLYGELTS */	$"4745 4D45 4C0D 4745 4D4D 410D 4745 4D4D"            /* GEMELGEMMAGEMM */	$"590D 4745 4D4F 540D 4745 4E41 4C0D 4745"            /* YGEMOTGENALGE */	$"4E41 530D 4745 4E45 530D 4745 4E45 540D"            /* NASGENESGENET */	$"4745 4E49 430D 4745 4E49 490D 4745 4E49"            /* GENICGENIIGENI */	$"500D 4745 4E4E 590D 4745 4E4F 410D 4745"            /* PGENNYGENOAGE */	$"4E4F 4D0D 4745 4E52 4F0D 4745 4E54 530D"            /* NOMGENROGENTS */	$"4745 4E54 590D 4745 4E55 410D 4745 4E55"            /* GENTYGENUAGENU */	$"530D 4745 4F44 450D 4745 4F49 440D 4745"            /* SGEODEGEOIDGE */	$"5241 480D 4745 5242 450D 4745 5245 530D"            /* RAHGERBEGERES */	$"4745 524C 450D 4745 524D 530D 4745 524D"            /* GERLEGERMSGERM */	$"590D 4745 524E 450D 4745 5353 450D 4745"            /* YGERNEGESSEGE */	$"5353 4F0D 4745 5354 450D 4745 5354 530D"            /* SSOGESTEGESTS */	$"4745 5441 530D 4745 5455 500D 4745 554D"            /* GETASGETUPGEUM */	$"530D 4745 5941 4E0D 4745 5945 520D 4748"            /* SGEYANGEYERGH */	$"4153 540D 4748 4154 530D 4748 4155 540D"            /* ASTGHATSGHAUT */	$"4748 415A 490D 4748 4545 530D 4748 4553"            /* GHAZIGHEESGHES */	$"540D 4748 594C 4C0D 4749 4245 440D 4749"            /* TGHYLLGIBEDGI */	$"4245 4C0D 4749 4245 520D 4749 4245 530D"            /* BELGIBERGIBES */	$"4749 424C 490D 4749 4255 530D 4749 4654"            /* GIBLIGIBUSGIFT */	$"530D 4749 4741 530D 4749 4748 450D 4749"            /* SGIGASGIGHEGI */	$"474F 540D 4749 4755 450D 4749 4C41 530D"            /* GOTGIGUEGILAS */	$"4749 4C44 530D 4749 4C45 540D 4749 4C4C"            /* GILDSGILETGILL */	$"530D 4749 4C4C 590D 4749 4C50 590D 4749"            /* SGILLYGILPYGI */	$"4C54 530D 4749 4D45 4C0D 4749 4D4D 450D"            /* LTSGIMELGIMME */	$"4749 4D50 530D 4749 4D50 590D 4749 4E43"            /* GIMPSGIMPYGINC */	$"480D 4749 4E47 450D 4749 4E47 530D 4749"            /* HGINGEGINGSGI */	$"4E4B 530D 4749 4E4E 590D 4749 4E5A 4F0D"            /* NKSGINNYGINZO */	$"4749 504F 4E0D 4749 5050 4F0D 4749 5050"            /* GIPONGIPPOGIPP */	$"590D 4749 5244 530D 4749 524C 530D 4749"            /* YGIRDSGIRLSGI */	$"524E 530D 4749 524F 4E0D 4749 524F 530D"            /* RNSGIRONGIROS */	$"4749 5252 530D 4749 5253 480D 4749 5254"            /* GIRRSGIRSHGIRT */	$"530D 4749 534D 4F0D 4749 534D 530D 4749"            /* SGISMOGISMSGI */	$"5354 530D 4749 5443 480D 4749 5445 530D"            /* STSGITCHGITES */	$"4749 5553 540D 4749 5645 440D 4749 5645"            /* GIUSTGIVEDGIVE */	$"530D 4749 5A4D 4F0D 474C 4143 450D 474C"            /* SGIZMOGLACEGL */	$"4144 530D 474C 4144 590D 474C 4149 4B0D"            /* ADSGLADYGLAIK */	$"474C 4149 520D 474C 414D 530D 474C 414E"            /* GLAIRGLAMSGLAN */	$"530D 474C 4152 590D 474C 4155 4D0D 474C"            /* SGLARYGLAUMGL */	$"4155 520D 474C 415A 590D 474C 4542 410D"            /* AURGLAZYGLEBA */	$"474C 4542 450D 474C 4542 590D 474C 4544"            /* GLEBEGLEBYGLED */	$"450D 474C 4544 530D 474C 4545 440D 474C"            /* EGLEDSGLEEDGL */	$"4545 4B0D 474C 4545 530D 474C 4545 540D"            /* EEKGLEESGLEET */	$"474C 4549 530D 474C 454E 530D 474C 454E"            /* GLEISGLENSGLEN */	$"540D 474C 4559 530D 474C 4941 4C0D 474C"            /* TGLEYSGLIALGL */	$"4941 530D 474C 4942 530D 474C 4946 460D"            /* IASGLIBSGLIFF */	$"474C 4946 540D 474C 494B 450D 474C 494D"            /* GLIFTGLIKEGLIM */	$"450D 474C 494D 530D 474C 4953 4B0D 474C"            /* EGLIMSGLISKGL */	$"4954 530D 474C 4954 5A0D 474C 4F41 4D0D"            /* ITSGLITZGLOAM */	$"474C 4F42 490D 474C 4F42 530D 474C 4F42"            /* GLOBIGLOBSGLOB */	$"590D 474C 4F44 450D 474C 4F47 470D 474C"            /* YGLODEGLOGGGL */	$"4F4D 530D 474C 4F4F 500D 474C 4F50 530D"            /* OMSGLOOPGLOPS */	$"474C 4F53 540D 474C 4F55 540D 474C 4F57"            /* GLOSTGLOUTGLOW */	$"530D 474C 4F5A 450D 474C 5545 440D 474C"            /* SGLOZEGLUEDGL */	$"5545 520D 474C 5545 530D 474C 5545 590D"            /* UERGLUESGLUEY */	$"474C 5547 530D 474C 554D 450D 474C 554D"            /* GLUGSGLUMEGLUM */	$"530D 474C 554F 4E0D 474C 5554 450D 474C"            /* SGLUONGLUTEGL */	$"5554 530D 474E 4152 4C0D 474E 4152 520D"            /* UTSGNARLGNARR */	$"474E 4152 530D 474E 4154 530D 474E 4157"            /* GNARSGNATSGNAW */	$"4E0D 474E 4157 530D 474E 4F57 530D 474F"            /* NGNAWSGNOWSGO */	$"4144 530D 474F 4146 530D 474F 414C 530D"            /* ADSGOAFSGOALS */	$"474F 4152 590D 474F 4154 530D 474F 4154"            /* GOARYGOATSGOAT */	$"590D 474F 4241 4E0D 474F 4241 520D 474F"            /* YGOBANGOBARGO */	$"4242 490D 474F 4242 4F0D 474F 4242 590D"            /* BBIGOBBOGOBBY */	$"474F 4249 530D 474F 424F 530D 474F 4445"            /* GOBISGOBOSGODE */	$"540D 474F 4453 4F0D 474F 454C 530D 474F"            /* TGODSOGOELSGO */	$"4552 530D 474F 4553 540D 474F 4554 480D"            /* ERSGOESTGOETH */	$"474F 4554 590D 474F 4645 520D 474F 4646"            /* GOETYGOFERGOFF */	$"530D 474F 4747 410D 474F 474F 530D 474F"            /* SGOGGAGOGOSGO */	$"4945 520D 474F 4A49 530D 474F 4C44 530D"            /* IERGOJISGOLDS */	$"474F 4C44 590D 474F 4C45 530D 474F 4C46"            /* GOLDYGOLESGOLF */	$"530D 474F 4C50 450D 474F 4C50 530D 474F"            /* SGOLPEGOLPSGO */	$"4D42 4F0D 474F 4D45 520D 474F 4D50 410D"            /* MBOGOMERGOMPA */	$"474F 4E43 480D 474F 4E45 460D 474F 4E47"            /* GONCHGONEFGONG */	$"530D 474F 4E49 410D 474F 4E49 460D 474F"            /* SGONIAGONIFGO */	$"4E4B 530D 474F 4E4E 410D 474F 4E4F 460D"            /* NKSGONNAGONOF */	$"474F 4E59 530D 474F 4E5A 4F0D 474F 4F42"            /* GONYSGONZOGOOB */	$"590D 474F 4F44 530D 474F 4F46 530D 474F"            /* YGOODSGOOFSGO */	$"4F47 530D 474F 4F4B 530D 474F 4F4B 590D"            /* OGSGOOKSGOOKY */	$"474F 4F4C 440D 474F 4F4C 530D 474F 4F4C"            /* GOOLDGOOLSGOOL */	$"590D 474F 4F4E 530D 474F 4F4E 590D 474F"            /* YGOONSGOONYGO */	$"4F50 530D 474F 4F50 590D 474F 4F52 530D"            /* OPSGOOPYGOORS */	$"474F 4F52 590D 474F 4F53 590D 474F 5041"            /* GOORYGOOSYGOPA */	$"4B0D 474F 5049 4B0D 474F 5241 4C0D 474F"            /* KGOPIKGORALGO */	$"5241 530D 474F 5245 440D 474F 5245 530D"            /* RASGOREDGORES */	$"474F 5249 530D 474F 524D 530D 474F 524D"            /* GORISGORMSGORM */	$"590D 474F 5250 530D 474F 5253 450D 474F"            /* YGORPSGORSEGO */	$"5253 590D 474F 5348 540D 474F 5353 450D"            /* RSYGOSHTGOSSE */	$"474F 5443 480D 474F 5448 530D 474F 5448"            /* GOTCHGOTHSGOTH */	$"590D 474F 5454 410D 474F 5543 480D 474F"            /* YGOTTAGOUCHGO */	$"554B 530D 474F 5552 410D 474F 5554 530D"            /* UKSGOURAGOUTS */	$"474F 5554 590D 474F 5741 4E0D 474F 5744"            /* GOUTYGOWANGOWD */	$"530D 474F 5746 530D 474F 574B 530D 474F"            /* SGOWFSGOWKSGO */	$"574C 530D 474F 574E 530D 474F 5845 530D"            /* WLSGOWNSGOXES */	$"474F 5949 4D0D 474F 594C 450D 4752 4141"            /* GOYIMGOYLEGRAA */	$"4C0D 4752 4142 530D 4752 4144 530D 4752"            /* LGRABSGRADSGR */	$"4146 460D 4752 4149 500D 4752 414D 410D"            /* AFFGRAIPGRAMA */	$"4752 414D 450D 4752 414D 500D 4752 414D"            /* GRAMEGRAMPGRAM */	$"530D 4752 414E 410D 4752 414E 530D 4752"            /* SGRANAGRANSGR */	$"4150 590D 4752 4156 530D 4752 4159 530D"            /* APYGRAVSGRAYS */	$"4752 4542 450D 4752 4542 4F0D 4752 4543"            /* GREBEGREBOGREC */	$"450D 4752 4545 4B0D 4752 4545 530D 4752"            /* EGREEKGREESGR */	$"4547 450D 4752 4547 4F0D 4752 4549 4E0D"            /* EGEGREGOGREIN */	$"4752 454E 530D 4752 4553 450D 4752 4556"            /* GRENSGRESEGREV */	$"450D 4752 4557 530D 4752 4559 530D 4752"            /* EGREWSGREYSGR */	$"4943 450D 4752 4944 450D 4752 4944 530D"            /* ICEGRIDEGRIDS */	$"4752 4946 460D 4752 4946 540D 4752 4947"            /* GRIFFGRIFTGRIG */	$"530D 4752 494B 450D 4752 494E 530D 4752"            /* SGRIKEGRINSGR */	$"494F 540D 4752 4950 530D 4752 4950 540D"            /* IOTGRIPSGRIPT */	$"4752 4950 590D 4752 4953 450D 4752 4953"            /* GRIPYGRISEGRIS */	$"540D 4752 4953 590D 4752 4954 480D 4752"            /* TGRISYGRITHGR */	$"4954 530D 4752 495A 450D 4752 4F41 540D"            /* ITSGRIZEGROAT */	$"4752 4F44 590D 4752 4F47 530D 4752 4F4B"            /* GRODYGROGSGROK */	$"530D 4752 4F4D 410D 4752 4F4E 450D 4752"            /* SGROMAGRONEGR */	$"4F4F 460D 4752 4F53 5A0D 4752 4F54 530D"            /* OOFGROSZGROTS */	$"4752 4F55 460D 4752 4F56 590D 4752 4F57"            /* GROUFGROVYGROW */	$"530D 4752 524C 530D 4752 5252 4C0D 4752"            /* SGRRLSGRRRLGR */	$"5542 530D 4752 5545 440D 4752 5545 530D"            /* UBSGRUEDGRUES */	$"4752 5546 450D 4752 554D 450D 4752 554D"            /* GRUFEGRUMEGRUM */	$"500D 4752 554E 440D 4752 5943 450D 4752"            /* PGRUNDGRYCEGR */	$"5944 450D 4752 594B 450D 4752 5950 450D"            /* YDEGRYKEGRYPE */	$"4752 5950 540D 4755 4143 4F0D 4755 414E"            /* GRYPTGUACOGUAN */	$"410D 4755 414E 4F0D 4755 414E 530D 4755"            /* AGUANOGUANSGU */	$"4152 530D 4755 434B 530D 4755 434B 590D"            /* ARSGUCKSGUCKY */	$"4755 4445 530D 4755 4646 530D 4755 4741"            /* GUDESGUFFSGUGA */	$"530D 4755 4944 530D 4755 494D 500D 4755"            /* SGUIDSGUIMPGU */	$"4952 4F0D 4755 4C41 470D 4755 4C41 520D"            /* IROGULAGGULAR */	$"4755 4C41 530D 4755 4C45 530D 4755 4C45"            /* GULASGULESGULE */	$"540D 4755 4C46 530D 4755 4C46 590D 4755"            /* TGULFSGULFYGU */	$"4C4C 530D 4755 4C50 480D 4755 4C50 530D"            /* LLSGULPHGULPS */	$"4755 4C50 590D 4755 4D4D 410D 4755 4D4D"            /* GULPYGUMMAGUMM */	$"490D 4755 4D50 530D 4755 4E44 590D 4755"            /* IGUMPSGUNDYGU */	$"4E47 450D 4755 4E47 590D 4755 4E4B 530D"            /* NGEGUNGYGUNKS */	$"4755 4E4B 590D 4755 4E4E 590D 4755 5149"            /* GUNKYGUNNYGUQI */	$"4E0D 4755 5244 590D 4755 5247 450D 4755"            /* NGURDYGURGEGU */	$"524C 530D 4755 524C 590D 4755 524E 530D"            /* RLSGURLYGURNS */	$"4755 5252 590D 4755 5253 480D 4755 5255"            /* GURRYGURSHGURU */	$"530D 4755 5348 590D 4755 534C 410D 4755"            /* SGUSHYGUSLAGU */	$"534C 450D 4755 534C 490D 4755 5353 590D"            /* SLEGUSLIGUSSY */	$"4755 5354 530D 4755 5453 590D 4755 5454"            /* GUSTSGUTSYGUTT */	$"410D 4755 5454 590D 4755 5945 440D 4755"            /* AGUTTYGUYEDGU */	$"594C 450D 4755 594F 540D 4755 5953 450D"            /* YLEGUYOTGUYSE */	$"4757 494E 450D 4759 414C 530D 4759 414E"            /* GWINEGYALSGYAN */	$"530D 4759 4245 440D 4759 4245 530D 4759"            /* SGYBEDGYBESGY */	$"454C 440D 4759 4D50 530D 4759 4E41 450D"            /* ELDGYMPSGYNAE */	$"4759 4E49 450D 4759 4E4E 590D 4759 4E4F"            /* GYNIEGYNNYGYNO */	$"530D 4759 4F5A 410D 4759 504F 530D 4759"            /* SGYOZAGYPOSGY */	$"5050 4F0D 4759 5050 590D 4759 5241 4C0D"            /* PPOGYPPYGYRAL */	$"4759 5245 440D 4759 5245 530D 4759 524F"            /* GYREDGYRESGYRO */	$"4E0D 4759 524F 530D 4759 5255 530D 4759"            /* NGYROSGYRUSGY */	$"5445 530D 4759 5645 440D 4759 5645 530D"            /* TESGYVEDGYVES */	$"4841 4146 530D 4841 4152 530D 4841 424C"            /* HAAFSHAARSHABL */	$"450D 4841 4255 530D 4841 4345 4B0D 4841"            /* EHABUSHACEKHA */	$"434B 530D 4841 4441 4C0D 4841 4445 440D"            /* CKSHADALHADED */	$"4841 4445 530D 4841 444A 490D 4841 4453"            /* HADESHADJIHADS */	$"540D 4841 454D 530D 4841 4554 530D 4841"            /* THAEMSHAETSHA */	$"4646 530D 4841 4649 5A0D 4841 4654 530D"            /* FFSHAFIZHAFTS */	$"4841 4747 530D 4841 4841 530D 4841 4943"            /* HAGGSHAHASHAIC */	$"4B0D 4841 494B 410D 4841 494B 530D 4841"            /* KHAIKAHAIKSHA */	$"494B 550D 4841 494C 530D 4841 494C 590D"            /* IKUHAILSHAILY */	$"4841 494E 530D 4841 494E 540D 4841 4952"            /* HAINSHAINTHAIR */	$"530D 4841 4954 480D 4841 4A45 530D 4841"            /* SHAITHHAJESHA */	$"4A49 530D 4841 4A4A 490D 4841 4B41 4D0D"            /* JISHAJJIHAKAM */	$"4841 4B41 530D 4841 4B45 410D 4841 4B45"            /* HAKASHAKEAHAKE */	$"530D 4841 4B49 4D0D 4841 4B55 530D 4841"            /* SHAKIMHAKUSHA */	$"4C41 4C0D 4841 4C45 440D 4841 4C45 520D"            /* LALHALEDHALER */	$"4841 4C45 530D 4841 4C46 410D 4841 4C46"            /* HALESHALFAHALF */	$"530D 4841 4C49 440D 4841 4C4C 4F0D 4841"            /* SHALIDHALLOHA */	$"4C4C 530D 4841 4C4D 410D 4841 4C4D 530D"            /* LLSHALMAHALMS */	$"4841 4C4F 4E0D 4841 4C4F 530D 4841 4C53"            /* HALONHALOSHALS */	$"450D 4841 4C54 530D 4841 4C56 410D 4841"            /* EHALTSHALVAHA */	$"4C57 410D 4841 4D41 4C0D 4841 4D42 410D"            /* LWAHAMALHAMBA */	$"4841 4D45 440D 4841 4D45 530D 4841 4D4D"            /* HAMEDHAMESHAMM */	$"590D 4841 4D5A 410D 4841 4E41 500D 4841"            /* YHAMZAHANAPHA */	$"4E43 450D 4841 4E43 480D 4841 4E44 530D"            /* NCEHANCHHANDS */	$"4841 4E47 490D 4841 4E47 530D 4841 4E4B"            /* HANGIHANGSHANK */	$"530D 4841 4E4B 590D 4841 4E53 410D 4841"            /* SHANKYHANSAHA */	$"4E53 450D 4841 4E54 530D 4841 4F4C 450D"            /* NSEHANTSHAOLE */	$"4841 4F4D 410D 4841 5041 580D 4841 504C"            /* HAOMAHAPAXHAPL */	$"590D 4841 5050 490D 4841 5055 530D 4841"            /* YHAPPIHAPUSHA */	$"5241 4D0D 4841 5244 530D 4841 5245 440D"            /* RAMHARDSHARED */	$"4841 5245 530D 4841 5249 4D0D 4841 524B"            /* HARESHARIMHARK */	$"530D 4841 524C 530D 4841 524D 530D 4841"            /* SHARLSHARMSHA */	$"524E 530D 4841 524F 530D 4841 5250 530D"            /* RNSHAROSHARPS */	$"4841 5254 530D 4841 5348 590D 4841 534B"            /* HARTSHASHYHASK */	$"530D 4841 5350 530D 4841 5354 410D 4841"            /* SHASPSHASTAHA */	$"5445 440D 4841 5445 530D 4841 5448 410D"            /* TEDHATESHATHA */	$"4841 5544 530D 4841 5546 530D 4841 5547"            /* HAUDSHAUFSHAUG */	$"480D 4841 554C 440D 4841 554C 4D0D 4841"            /* HHAULDHAULMHA */	$"554C 530D 4841 554C 540D 4841 554E 530D"            /* ULSHAULTHAUNS */	$"4841 5553 450D 4841 5645 520D 4841 5645"            /* HAUSEHAVERHAVE */	$"530D 4841 5745 440D 4841 574B 530D 4841"            /* SHAWEDHAWKSHA */	$"574D 530D 4841 5753 450D 4841 5945 440D"            /* WMSHAWSEHAYED */	$"4841 5945 520D 4841 5945 590D 4841 594C"            /* HAYERHAYEYHAYL */	$"450D 4841 5A41 4E0D 4841 5A45 440D 4841"            /* EHAZANHAZEDHA */	$"5A45 520D 4841 5A45 530D 4845 4144 530D"            /* ZERHAZESHEADS */	$"4845 414C 440D 4845 414C 530D 4845 414D"            /* HEALDHEALSHEAM */	$"450D 4845 4150 530D 4845 4150 590D 4845"            /* EHEAPSHEAPYHE */	$"4152 450D 4845 4152 530D 4845 4153 540D"            /* AREHEARSHEAST */	$"4845 4154 530D 4845 4245 4E0D 4845 4245"            /* HEATSHEBENHEBE */	$"530D 4845 4348 540D 4845 434B 530D 4845"            /* SHECHTHECKSHE */	$"4445 520D 4845 4447 590D 4845 4544 530D"            /* DERHEDGYHEEDS */	$"4845 4544 590D 4845 454C 530D 4845 455A"            /* HEEDYHEELSHEEZ */	$"450D 4845 4654 450D 4845 4654 530D 4845"            /* EHEFTEHEFTSHE */	$"4944 530D 4845 4947 480D 4845 494C 530D"            /* IDSHEIGHHEILS */	$"4845 4952 530D 4845 4A41 420D 4845 4A52"            /* HEIRSHEJABHEJR */	$"410D 4845 4C45 440D 4845 4C45 530D 4845"            /* AHELEDHELESHE */	$"4C49 4F0D 4845 4C4C 530D 4845 4C4D 530D"            /* LIOHELLSHELMS */	$"4845 4C4F 530D 4845 4C4F 540D 4845 4C50"            /* HELOSHELOTHELP */	$"530D 4845 4C56 450D 4845 4D41 4C0D 4845"            /* SHELVEHEMALHE */	$"4D45 530D 4845 4D49 430D 4845 4D49 4E0D"            /* MESHEMICHEMIN */	$"4845 4D50 530D 4845 4D50 590D 4845 4E43"            /* HEMPSHEMPYHENC */	$"480D 4845 4E44 530D 4845 4E47 450D 4845"            /* HHENDSHENGEHE */	$"4E4E 410D 4845 4E4E 590D 4845 4E52 590D"            /* NNAHENNYHENRY */	$"4845 4E54 530D 4845 5041 520D 4845 5242"            /* HENTSHEPARHERB */	$"530D 4845 5242 590D 4845 5244 530D 4845"            /* SHERBYHERDSHE */	$"5245 530D 4845 524C 530D 4845 524D 410D"            /* RESHERLSHERMA */	$"4845 524D 530D 4845 524E 530D 4845 524F"            /* HERMSHERNSHERO */	$"530D 4845 5252 590D 4845 5253 450D 4845"            /* SHERRYHERSEHE */	$"5254 5A0D 4845 5259 450D 4845 5350 530D"            /* RTZHERYEHESPS */	$"4845 5354 530D 4845 5445 530D 4845 5448"            /* HESTSHETESHETH */	$"530D 4845 5543 480D 4845 5547 480D 4845"            /* SHEUCHHEUGHHE */	$"5645 410D 4845 5745 440D 4845 5745 520D"            /* VEAHEWEDHEWER */	$"4845 5747 480D 4845 5841 440D 4845 5845"            /* HEWGHHEXADHEXE */	$"440D 4845 5845 520D 4845 5845 530D 4845"            /* DHEXERHEXESHE */	$"5859 4C0D 4845 5945 440D 4849 414E 540D"            /* XYLHEYEDHIANT */	$"4849 434B 530D 4849 4445 440D 4849 4445"            /* HICKSHIDEDHIDE */	$"520D 4849 4445 530D 4849 454D 530D 4849"            /* RHIDESHIEMSHI */	$"4748 530D 4849 4748 540D 4849 4A41 420D"            /* GHSHIGHTHIJAB */	$"4849 4A52 410D 4849 4B45 440D 4849 4B45"            /* HIJRAHIKEDHIKE */	$"520D 4849 4B45 530D 4849 4B4F 490D 4849"            /* RHIKESHIKOIHI */	$"4C41 520D 4849 4C43 480D 4849 4C4C 4F0D"            /* LARHILCHHILLO */	$"4849 4C4C 530D 4849 4C54 530D 4849 4C55"            /* HILLSHILTSHILU */	$"4D0D 4849 4C55 530D 4849 4D42 4F0D 4849"            /* MHILUSHIMBOHI */	$"4E41 550D 4849 4E44 530D 4849 4E47 530D"            /* NAUHINDSHINGS */	$"4849 4E4B 590D 4849 4E4E 590D 4849 4E54"            /* HINKYHINNYHINT */	$"530D 4849 4F49 530D 4849 504C 590D 4849"            /* SHIOISHIPLYHI */	$"5245 440D 4849 5245 450D 4849 5245 520D"            /* REDHIREEHIRER */	$"4849 5245 530D 4849 5353 590D 4849 5354"            /* HIRESHISSYHIST */	$"530D 4849 5448 450D 4849 5645 440D 4849"            /* SHITHEHIVEDHI */	$"5645 520D 4849 5645 530D 4849 5A45 4E0D"            /* VERHIVESHIZEN */	$"484F 4145 440D 484F 4147 590D 484F 4152"            /* HOAEDHOAGYHOAR */	$"530D 484F 4152 590D 484F 4153 540D 484F"            /* SHOARYHOASTHO */	$"424F 530D 484F 434B 530D 484F 4355 530D"            /* BOSHOCKSHOCUS */	$"484F 4441 440D 484F 444A 410D 484F 4552"            /* HODADHODJAHOER */	$"530D 484F 4741 4E0D 484F 4745 4E0D 484F"            /* SHOGANHOGENHO */	$"4747 530D 484F 4748 530D 484F 4845 440D"            /* GGSHOGHSHOHED */	$"484F 4943 4B0D 484F 4945 440D 484F 494B"            /* HOICKHOIEDHOIK */	$"530D 484F 494E 470D 484F 4953 450D 484F"            /* SHOINGHOISEHO */	$"4B41 530D 484F 4B45 440D 484F 4B45 530D"            /* KASHOKEDHOKES */	$"484F 4B45 590D 484F 4B49 530D 484F 4B4B"            /* HOKEYHOKISHOKK */	$"550D 484F 4B55 4D0D 484F 4C44 530D 484F"            /* UHOKUMHOLDSHO */	$"4C45 440D 484F 4C45 530D 484F 4C45 590D"            /* LEDHOLESHOLEY */	$"484F 4C4B 530D 484F 4C4C 410D 484F 4C4C"            /* HOLKSHOLLAHOLL */	$"4F0D 484F 4C4D 450D 484F 4C4D 530D 484F"            /* OHOLMEHOLMSHO */	$"4C4F 4E0D 484F 4C4F 530D 484F 4C54 530D"            /* LONHOLOSHOLTS */	$"484F 4D41 530D 484F 4D45 440D 484F 4D45"            /* HOMASHOMEDHOME */	$"530D 484F 4D45 590D 484F 4D49 450D 484F"            /* SHOMEYHOMIEHO */	$"4D4D 450D 484F 4D4F 530D 484F 4E41 4E0D"            /* MMEHOMOSHONAN */	$"484F 4E44 410D 484F 4E44 530D 484F 4E45"            /* HONDAHONDSHONE */	$"440D 484F 4E45 520D 484F 4E45 530D 484F"            /* DHONERHONESHO */	$"4E47 490D 484F 4E47 530D 484F 4E4B 530D"            /* NGIHONGSHONKS */	$"484F 4E4B 590D 484F 4F43 480D 484F 4F44"            /* HONKYHOOCHHOOD */	$"530D 484F 4F44 590D 484F 4F45 590D 484F"            /* SHOODYHOOEYHO */	$"4F46 530D 484F 4F4B 410D 484F 4F4B 530D"            /* OFSHOOKAHOOKS */	$"484F 4F4B 590D 484F 4F4C 590D 484F 4F4E"            /* HOOKYHOOLYHOON */	$"530D 484F 4F50 530D 484F 4F52 440D 484F"            /* SHOOPSHOORDHO */	$"4F52 530D 484F 4F53 480D 484F 4F54 530D"            /* ORSHOOSHHOOTS */	$"484F 4F54 590D 484F 4F56 450D 484F 5041"            /* HOOTYHOOVEHOPA */	$"4B0D 484F 5045 440D 484F 5045 520D 484F"            /* KHOPEDHOPERHO */	$"5045 530D 484F 5050 590D 484F 5241 480D"            /* PESHOPPYHORAH */	$"484F 5241 4C0D 484F 5241 530D 484F 5249"            /* HORALHORASHORI */	$"530D 484F 524B 530D 484F 524D 450D 484F"            /* SHORKSHORMEHO */	$"524E 530D 484F 5253 540D 484F 5253 590D"            /* RNSHORSTHORSY */	$"484F 5345 440D 484F 5345 4C0D 484F 5345"            /* HOSEDHOSELHOSE */	$"4E0D 484F 5345 520D 484F 5345 530D 484F"            /* NHOSERHOSESHO */	$"5345 590D 484F 5354 410D 484F 5354 530D"            /* SEYHOSTAHOSTS */	$"484F 5443 480D 484F 5445 4E0D 484F 5454"            /* HOTCHHOTENHOTT */	$"590D 484F 5546 460D 484F 5546 530D 484F"            /* YHOUFFHOUFSHO */	$"5547 480D 484F 5552 490D 484F 5552 530D"            /* UGHHOURIHOURS */	$"484F 5554 530D 484F 5645 410D 484F 5645"            /* HOUTSHOVEAHOVE */	$"440D 484F 5645 4E0D 484F 5645 530D 484F"            /* DHOVENHOVESHO */	$"5742 450D 484F 5745 530D 484F 5746 460D"            /* WBEHOWESHOWFF */	$"484F 5746 530D 484F 574B 530D 484F 574C"            /* HOWFSHOWKSHOWL */	$"530D 484F 5752 450D 484F 5753 4F0D 484F"            /* SHOWREHOWSOHO */	$"5845 440D 484F 5845 530D 484F 5941 530D"            /* XEDHOXESHOYAS */	$"484F 5945 440D 484F 594C 450D 4855 4242"            /* HOYEDHOYLEHUBB */	$"590D 4855 434B 530D 4855 444E 410D 4855"            /* YHUCKSHUDNAHU */	$"4455 440D 4855 4552 530D 4855 4646 530D"            /* DUDHUERSHUFFS */	$"4855 4646 590D 4855 4745 520D 4855 4747"            /* HUFFYHUGERHUGG */	$"590D 4855 4855 530D 4855 4941 530D 4855"            /* YHUHUSHUIASHU */	$"4C41 530D 4855 4C45 530D 4855 4C4B 530D"            /* LASHULESHULKS */	$"4855 4C4B 590D 4855 4C4C 4F0D 4855 4C4C"            /* HULKYHULLOHULL */	$"530D 4855 4C4C 590D 4855 4D41 530D 4855"            /* SHULLYHUMASHU */	$"4D46 530D 4855 4D49 430D 4855 4D50 530D"            /* MFSHUMICHUMPS */	$"4855 4D50 590D 4855 4E4B 530D 4855 4E54"            /* HUMPYHUNKSHUNT */	$"530D 4855 5244 530D 4855 524C 530D 4855"            /* SHURDSHURLSHU */	$"524C 590D 4855 5252 410D 4855 5253 540D"            /* RLYHURRAHURST */	$"4855 5254 530D 4855 5348 590D 4855 534B"            /* HURTSHUSHYHUSK */	$"530D 4855 534F 530D 4855 5449 410D 4855"            /* SHUSOSHUTIAHU */	$"5A5A 410D 4855 5A5A 590D 4857 594C 530D"            /* ZZAHUZZYHWYLS */	$"4859 4452 410D 4859 454E 530D 4859 4747"            /* HYDRAHYENSHYGG */	$"450D 4859 494E 470D 4859 4B45 530D 4859"            /* EHYINGHYKESHY */	$"4C41 530D 4859 4C45 470D 4859 4C45 530D"            /* LASHYLEGHYLES */	$"4859 4C49 430D 4859 4D4E 530D 4859 4E44"            /* HYLICHYMNSHYND */	$"450D 4859 4F49 440D 4859 5045 440D 4859"            /* EHYOIDHYPEDHY */	$"5045 530D 4859 5048 410D 4859 5048 590D"            /* PESHYPHAHYPHY */	$"4859 504F 530D 4859 5241 580D 4859 534F"            /* HYPOSHYRAXHYSO */	$"4E0D 4859 5448 450D 4941 4D42 490D 4941"            /* NHYTHEIAMBIIA */	$"4D42 530D 4942 5249 4B0D 4943 4552 530D"            /* MBSIBRIKICERS */	$"4943 4845 440D 4943 4845 530D 4943 484F"            /* ICHEDICHESICHO */	$"520D 4943 4945 520D 4943 4B45 520D 4943"            /* RICIERICKERIC */	$"4B4C 450D 4943 4F4E 530D 4943 5441 4C0D"            /* KLEICONSICTAL */	$"4943 5449 430D 4943 5455 530D 4944 414E"            /* ICTICICTUSIDAN */	$"540D 4944 4541 530D 4944 4545 530D 4944"            /* TIDEASIDEESID */	$"454E 540D 4944 4C45 440D 4944 4C45 530D"            /* ENTIDLEDIDLES */	$"4944 4F4C 410D 4944 4F4C 530D 4944 594C"            /* IDOLAIDOLSIDYL */	$"530D 4946 5441 520D 4947 4150 4F0D 4947"            /* SIFTARIGAPOIG */	$"4745 440D 4947 4C55 530D 4948 5241 4D0D"            /* GEDIGLUSIHRAM */	$"494B 414E 530D 494B 4154 530D 494B 4F4E"            /* IKANSIKATSIKON */	$"530D 494C 4541 430D 494C 4541 4C0D 494C"            /* SILEACILEALIL */	$"4555 4D0D 494C 4555 530D 494C 4941 440D"            /* EUMILEUSILIAD */	$"494C 4941 4C0D 494C 4955 4D0D 494C 4C45"            /* ILIALILIUMILLE */	$"520D 494C 4C54 480D 494D 4147 4F0D 494D"            /* RILLTHIMAGOIM */	$"414D 530D 494D 4152 490D 494D 4155 4D0D"            /* AMSIMARIIMAUM */	$"494D 4241 520D 494D 4245 440D 494D 4944"            /* IMBARIMBEDIMID */	$"450D 494D 4944 4F0D 494D 4944 530D 494D"            /* EIMIDOIMIDSIM */	$"494E 450D 494D 494E 4F0D 494D 4D45 570D"            /* INEIMINOIMMEW */	$"494D 4D49 540D 494D 4D49 580D 494D 5045"            /* IMMITIMMIXIMPE */	$"440D 494D 5049 530D 494D 504F 540D 494D"            /* DIMPISIMPOTIM */	$"5052 4F0D 494D 5348 490D 494D 5348 590D"            /* PROIMSHIIMSHY */	$"494E 4150 540D 494E 4152 4D0D 494E 4259"            /* INAPTINARMINBY */	$"450D 494E 4345 4C0D 494E 434C 450D 494E"            /* EINCELINCLEIN */	$"434F 470D 494E 4355 530D 494E 4355 540D"            /* COGINCUSINCUT */	$"494E 4445 570D 494E 4449 410D 494E 4449"            /* INDEWINDIAINDI */	$"450D 494E 444F 4C0D 494E 444F 570D 494E"            /* EINDOLINDOWIN */	$"4452 490D 494E 4455 450D 494E 4552 4D0D"            /* DRIINDUEINERM */	$"494E 4649 580D 494E 464F 530D 494E 4652"            /* INFIXINFOSINFR */	$"410D 494E 4741 4E0D 494E 474C 450D 494E"            /* AINGANINGLEIN */	$"494F 4E0D 494E 4B45 440D 494E 4B45 520D"            /* IONINKEDINKER */	$"494E 4B4C 450D 494E 4E45 440D 494E 4E49"            /* INKLEINNEDINNI */	$"540D 494E 4F52 420D 494E 5255 4E0D 494E"            /* TINORBINRUNIN */	$"5345 540D 494E 5350 4F0D 494E 5445 4C0D"            /* SETINSPOINTEL */	$"494E 5449 4C0D 494E 5449 530D 494E 5452"            /* INTILINTISINTR */	$"410D 494E 554C 410D 494E 5552 450D 494E"            /* AINULAINUREIN */	$"5552 4E0D 494E 5553 540D 494E 5641 520D"            /* URNINUSTINVAR */	$"494E 5749 540D 494F 4449 430D 494F 4449"            /* INWITIODICIODI */	$"440D 494F 4449 4E0D 494F 5441 530D 4950"            /* DIODINIOTASIP */	$"504F 4E0D 4952 4144 450D 4952 4944 530D"            /* PONIRADEIRIDS */	$"4952 494E 470D 4952 4B45 440D 4952 4F4B"            /* IRINGIRKEDIROK */	$"4F0D 4952 4F4E 450D 4952 4F4E 530D 4953"            /* OIRONEIRONSIS */	$"4241 530D 4953 4845 530D 4953 4C45 440D"            /* BASISHESISLED */	$"4953 4C45 530D 4953 4E41 450D 4953 5345"            /* ISLESISNAEISSE */	$"490D 4953 544C 450D 4954 454D 530D 4954"            /* IISTLEITEMSIT */	$"4845 520D 4956 4945 440D 4956 4945 530D"            /* HERIVIEDIVIES */	$"4958 4941 530D 4958 4E41 590D 4958 4F52"            /* IXIASIXNAYIXOR */	$"410D 4958 544C 450D 495A 4152 440D 495A"            /* AIXTLEIZARDIZ */	$"4152 530D 495A 5A41 540D 4A41 4150 530D"            /* ARSIZZATJAAPS */	$"4A41 424F 540D 4A41 4341 4C0D 4A41 434B"            /* JABOTJACALJACK */	$"530D 4A41 434B 590D 4A41 4445 440D 4A41"            /* SJACKYJADEDJA */	$"4445 530D 4A41 4641 530D 4A41 4646 410D"            /* DESJAFASJAFFA */	$"4A41 4741 530D 4A41 4745 520D 4A41 4747"            /* JAGASJAGERJAGG */	$"530D 4A41 4747 590D 4A41 4749 520D 4A41"            /* SJAGGYJAGIRJA */	$"4752 410D 4A41 494C 530D 4A41 4B45 520D"            /* GRAJAILSJAKER */	$"4A41 4B45 530D 4A41 4B45 590D 4A41 4C41"            /* JAKESJAKEYJALA */	$"500D 4A41 4C4F 500D 4A41 4D42 450D 4A41"            /* PJALOPJAMBEJA */	$"4D42 4F0D 4A41 4D42 530D 4A41 4D42 550D"            /* MBOJAMBSJAMBU */	$"4A41 4D45 530D 4A41 4D4D 590D 4A41 4D4F"            /* JAMESJAMMYJAMO */	$"4E0D 4A41 4E45 530D 4A41 4E4E 530D 4A41"            /* NJANESJANNSJA */	$"4E4E 590D 4A41 4E54 590D 4A41 5041 4E0D"            /* NNYJANTYJAPAN */	$"4A41 5045 440D 4A41 5045 520D 4A41 5045"            /* JAPEDJAPERJAPE */	$"530D 4A41 524B 530D 4A41 524C 530D 4A41"            /* SJARKSJARLSJA */	$"5250 530D 4A41 5254 410D 4A41 5255 4C0D"            /* RPSJARTAJARUL */	$"4A41 5345 590D 4A41 5350 450D 4A41 5350"            /* JASEYJASPEJASP */	$"530D 4A41 544F 530D 4A41 554B 530D 4A41"            /* SJATOSJAUKSJA */	$"5550 530D 4A41 5641 530D 4A41 5645 4C0D"            /* UPSJAVASJAVEL */	$"4A41 5741 4E0D 4A41 5745 440D 4A41 5849"            /* JAWANJAWEDJAXI */	$"450D 4A45 414E 530D 4A45 4154 530D 4A45"            /* EJEANSJEATSJE */	$"4245 4C0D 4A45 4449 530D 4A45 454C 530D"            /* BELJEDISJEELS */	$"4A45 454C 590D 4A45 4550 530D 4A45 4552"            /* JEELYJEEPSJEER */	$"530D 4A45 455A 450D 4A45 4645 530D 4A45"            /* SJEEZEJEFESJE */	$"4646 530D 4A45 4841 440D 4A45 4855 530D"            /* FFSJEHADJEHUS */	$"4A45 4C41 420D 4A45 4C4C 4F0D 4A45 4C4C"            /* JELABJELLOJELL */	$"530D 4A45 4D42 450D 4A45 4D4D 590D 4A45"            /* SJEMBEJEMMYJE */	$"4E4E 590D 4A45 4F4E 530D 4A45 5249 440D"            /* NNYJEONSJERID */	$"4A45 524B 530D 4A45 5252 590D 4A45 5353"            /* JERKSJERRYJESS */	$"450D 4A45 5354 530D 4A45 5355 530D 4A45"            /* EJESTSJESUSJE */	$"5445 530D 4A45 544F 4E0D 4A45 554E 450D"            /* TESJETONJEUNE */	$"4A45 5745 440D 4A45 5749 450D 4A48 414C"            /* JEWEDJEWIEJHAL */	$"410D 4A49 414F 530D 4A49 4242 410D 4A49"            /* AJIAOSJIBBAJI */	$"4242 530D 4A49 4245 440D 4A49 4245 520D"            /* BBSJIBEDJIBER */	$"4A49 4245 530D 4A49 4646 530D 4A49 4747"            /* JIBESJIFFSJIGG */	$"590D 4A49 474F 540D 4A49 4841 440D 4A49"            /* YJIGOTJIHADJI */	$"4C4C 530D 4A49 4C54 530D 4A49 4D4D 590D"            /* LLSJILTSJIMMY */	$"4A49 4D50 590D 4A49 4E47 4F0D 4A49 4E4B"            /* JIMPYJINGOJINK */	$"530D 4A49 4E4E 450D 4A49 4E4E 490D 4A49"            /* SJINNEJINNIJI */	$"4E4E 530D 4A49 5244 530D 4A49 5247 410D"            /* NNSJIRDSJIRGA */	$"4A49 5252 450D 4A49 534D 530D 4A49 5645"            /* JIRREJISMSJIVE */	$"440D 4A49 5645 520D 4A49 5645 530D 4A49"            /* DJIVERJIVESJI */	$"5645 590D 4A4E 414E 410D 4A4F 4245 440D"            /* VEYJNANAJOBED */	$"4A4F 4245 530D 4A4F 434B 4F0D 4A4F 434B"            /* JOBESJOCKOJOCK */	$"530D 4A4F 434B 590D 4A4F 434F 530D 4A4F"            /* SJOCKYJOCOSJO */	$"4445 4C0D 4A4F 4559 530D 4A4F 484E 530D"            /* DELJOEYSJOHNS */	$"4A4F 494E 530D 4A4F 4B45 440D 4A4F 4B45"            /* JOINSJOKEDJOKE */	$"530D 4A4F 4B45 590D 4A4F 4B4F 4C0D 4A4F"            /* SJOKEYJOKOLJO */	$"4C45 440D 4A4F 4C45 530D 4A4F 4C4C 530D"            /* LEDJOLESJOLLS */	$"4A4F 4C54 530D 4A4F 4C54 590D 4A4F 4D4F"            /* JOLTSJOLTYJOMO */	$"4E0D 4A4F 4D4F 530D 4A4F 4E45 530D 4A4F"            /* NJOMOSJONESJO */	$"4E47 530D 4A4F 4E54 590D 4A4F 4F4B 530D"            /* NGSJONTYJOOKS */	$"4A4F 5241 4D0D 4A4F 5255 4D0D 4A4F 5441"            /* JORAMJORUMJOTA */	$"530D 4A4F 5454 590D 4A4F 5455 4E0D 4A4F"            /* SJOTTYJOTUNJO */	$"5541 4C0D 4A4F 5547 530D 4A4F 554B 530D"            /* UALJOUGSJOUKS */	$"4A4F 554C 450D 4A4F 5552 530D 4A4F 5741"            /* JOULEJOURSJOWA */	$"520D 4A4F 5745 440D 4A4F 574C 530D 4A4F"            /* RJOWEDJOWLSJO */	$"574C 590D 4A4F 5945 440D 4A55 4241 530D"            /* WLYJOYEDJUBAS */	$"4A55 4245 530D 4A55 434F 530D 4A55 4441"            /* JUBESJUCOSJUDA */	$"530D 4A55 4447 590D 4A55 444F 530D 4A55"            /* SJUDGYJUDOSJU */	$"4741 4C0D 4A55 4755 4D0D 4A55 4A55 530D"            /* GALJUGUMJUJUS */	$"4A55 4B45 440D 4A55 4B45 530D 4A55 4B55"            /* JUKEDJUKESJUKU */	$"530D 4A55 4C45 500D 4A55 4D41 520D 4A55"            /* SJULEPJUMARJU */	$"4D42 590D 4A55 4D50 530D 4A55 4E43 4F0D"            /* MBYJUMPSJUNCO */	$"4A55 4E4B 530D 4A55 4E4B 590D 4A55 5045"            /* JUNKSJUNKYJUPE */	$"530D 4A55 504F 4E0D 4A55 5241 4C0D 4A55"            /* SJUPONJURALJU */	$"5241 540D 4A55 5245 4C0D 4A55 5245 530D"            /* RATJURELJURES */	$"4A55 5354 530D 4A55 5445 530D 4A55 5454"            /* JUSTSJUTESJUTT */	$"590D 4A55 5645 530D 4A55 5649 450D 4B41"            /* YJUVESJUVIEKA */	$"414D 410D 4B41 4241 420D 4B41 4241 520D"            /* AMAKABABKABAR */	$"4B41 424F 420D 4B41 4348 410D 4B41 434B"            /* KABOBKACHAKACK */	$"530D 4B41 4441 490D 4B41 4445 530D 4B41"            /* SKADAIKADESKA */	$"4449 530D 4B41 4649 520D 4B41 474F 530D"            /* DISKAFIRKAGOS */	$"4B41 4755 530D 4B41 4841 4C0D 4B41 4941"            /* KAGUSKAHALKAIA */	$"4B0D 4B41 4944 530D 4B41 4945 530D 4B41"            /* KKAIDSKAIESKA */	$"4946 530D 4B41 494B 410D 4B41 494B 530D"            /* IFSKAIKAKAIKS */	$"4B41 494C 530D 4B41 494D 530D 4B41 494E"            /* KAILSKAIMSKAIN */	$"470D 4B41 494E 530D 4B41 4B41 530D 4B41"            /* GKAINSKAKASKA */	$"4B49 530D 4B41 4C41 4D0D 4B41 4C45 530D"            /* KISKALAMKALES */	$"4B41 4C49 460D 4B41 4C49 530D 4B41 4C50"            /* KALIFKALISKALP */	$"410D 4B41 4D41 530D 4B41 4D45 530D 4B41"            /* AKAMASKAMESKA */	$"4D49 4B0D 4B41 4D49 530D 4B41 4D4D 450D"            /* MIKKAMISKAMME */	$"4B41 4E41 450D 4B41 4E41 530D 4B41 4E44"            /* KANAEKANASKAND */	$"590D 4B41 4E45 480D 4B41 4E45 530D 4B41"            /* YKANEHKANESKA */	$"4E47 410D 4B41 4E47 530D 4B41 4E4A 490D"            /* NGAKANGSKANJI */	$"4B41 4E54 530D 4B41 4E5A 550D 4B41 4F4E"            /* KANTSKANZUKAON */	$"530D 4B41 5041 530D 4B41 5048 530D 4B41"            /* SKAPASKAPHSKA */	$"504F 4B0D 4B41 504F 570D 4B41 5055 530D"            /* POKKAPOWKAPUS */	$"4B41 5055 540D 4B41 5241 530D 4B41 5241"            /* KAPUTKARASKARA */	$"540D 4B41 524B 530D 4B41 524E 530D 4B41"            /* TKARKSKARNSKA */	$"524F 4F0D 4B41 524F 530D 4B41 5252 490D"            /* ROOKAROSKARRI */	$"4B41 5253 540D 4B41 5253 590D 4B41 5254"            /* KARSTKARSYKART */	$"530D 4B41 525A 590D 4B41 5348 410D 4B41"            /* SKARZYKASHAKA */	$"534D 450D 4B41 5441 4C0D 4B41 5441 530D"            /* SMEKATALKATAS */	$"4B41 5449 530D 4B41 5454 490D 4B41 5547"            /* KATISKATTIKAUG */	$"480D 4B41 5552 490D 4B41 5552 550D 4B41"            /* HKAURIKAURUKA */	$"5552 590D 4B41 5641 4C0D 4B41 5641 530D"            /* URYKAVALKAVAS */	$"4B41 5741 530D 4B41 5741 550D 4B41 5745"            /* KAWASKAWAUKAWE */	$"440D 4B41 594C 450D 4B41 594F 530D 4B41"            /* DKAYLEKAYOSKA */	$"5A49 530D 4B41 5A4F 4F0D 4B42 4152 530D"            /* ZISKAZOOKBARS */	$"4B45 4241 520D 4B45 424F 420D 4B45 434B"            /* KEBARKEBOBKECK */	$"530D 4B45 4447 450D 4B45 4447 590D 4B45"            /* SKEDGEKEDGYKE */	$"4543 480D 4B45 4546 530D 4B45 454B 530D"            /* ECHKEEFSKEEKS */	$"4B45 454C 530D 4B45 454D 410D 4B45 454E"            /* KEELSKEEMAKEEN */	$"4F0D 4B45 454E 530D 4B45 4550 530D 4B45"            /* OKEENSKEEPSKE */	$"4554 530D 4B45 4556 450D 4B45 4649 520D"            /* ETSKEEVEKEFIR */	$"4B45 4855 410D 4B45 4952 530D 4B45 4C45"            /* KEHUAKEIRSKELE */	$"500D 4B45 4C49 4D0D 4B45 4C4C 530D 4B45"            /* PKELIMKELLSKE */	$"4C4C 590D 4B45 4C50 530D 4B45 4C50 590D"            /* LLYKELPSKELPY */	$"4B45 4C54 530D 4B45 4C54 590D 4B45 4D42"            /* KELTSKELTYKEMB */	$"4F0D 4B45 4D42 530D 4B45 4D50 530D 4B45"            /* OKEMBSKEMPSKE */	$"4D50 540D 4B45 4D50 590D 4B45 4E41 460D"            /* MPTKEMPYKENAF */	$"4B45 4E43 480D 4B45 4E44 4F0D 4B45 4E4F"            /* KENCHKENDOKENO */	$"530D 4B45 4E54 450D 4B45 4E54 530D 4B45"            /* SKENTEKENTSKE */	$"5049 530D 4B45 5242 530D 4B45 5245 4C0D"            /* PISKERBSKEREL */	$"4B45 5246 530D 4B45 524B 590D 4B45 524D"            /* KERFSKERKYKERM */	$"410D 4B45 524E 450D 4B45 524E 530D 4B45"            /* AKERNEKERNSKE */	$"524F 530D 4B45 5252 590D 4B45 5256 450D"            /* ROSKERRYKERVE */	$"4B45 5341 520D 4B45 5354 530D 4B45 5441"            /* KESARKESTSKETA */	$"530D 4B45 5443 480D 4B45 5445 530D 4B45"            /* SKETCHKETESKE */	$"544F 4C0D 4B45 5645 4C0D 4B45 5649 4C0D"            /* TOLKEVELKEVIL */	$"4B45 5845 530D 4B45 5945 440D 4B45 5945"            /* KEXESKEYEDKEYE */	$"520D 4B48 4144 490D 4B48 4146 530D 4B48"            /* RKHADIKHAFSKH */	$"414E 530D 4B48 4150 480D 4B48 4154 530D"            /* ANSKHAPHKHATS */	$"4B48 4159 410D 4B48 415A 490D 4B48 4544"            /* KHAYAKHAZIKHED */	$"410D 4B48 4554 480D 4B48 4554 530D 4B48"            /* AKHETHKHETSKH */	$"4F4A 410D 4B48 4F52 530D 4B48 4F55 4D0D"            /* OJAKHORSKHOUM */	$"4B48 5544 530D 4B49 4141 540D 4B49 4143"            /* KHUDSKIAATKIAC */	$"4B0D 4B49 414E 470D 4B49 4242 450D 4B49"            /* KKIANGKIBBEKI */	$"4242 490D 4B49 4245 490D 4B49 4245 530D"            /* BBIKIBEIKIBES */	$"4B49 424C 410D 4B49 434B 530D 4B49 434B"            /* KIBLAKICKSKICK */	$"590D 4B49 4444 4F0D 4B49 4444 590D 4B49"            /* YKIDDOKIDDYKI */	$"4445 4C0D 4B49 4447 450D 4B49 4546 530D"            /* DELKIDGEKIEFS */	$"4B49 4552 530D 4B49 4556 450D 4B49 4556"            /* KIERSKIEVEKIEV */	$"530D 4B49 4748 540D 4B49 4B45 530D 4B49"            /* SKIGHTKIKESKI */	$"4B4F 490D 4B49 4C45 590D 4B49 4C49 4D0D"            /* KOIKILEYKILIM */	$"4B49 4C4C 530D 4B49 4C4E 530D 4B49 4C4F"            /* KILLSKILNSKILO */	$"530D 4B49 4C50 530D 4B49 4C54 530D 4B49"            /* SKILPSKILTSKI */	$"4C54 590D 4B49 4D42 4F0D 4B49 4E41 530D"            /* LTYKIMBOKINAS */	$"4B49 4E44 410D 4B49 4E44 530D 4B49 4E44"            /* KINDAKINDSKIND */	$"590D 4B49 4E45 530D 4B49 4E47 530D 4B49"            /* YKINESKINGSKI */	$"4E49 4E0D 4B49 4E4B 530D 4B49 4E4F 530D"            /* NINKINKSKINOS */	$"4B49 4F52 450D 4B49 5045 530D 4B49 5050"            /* KIOREKIPESKIPP */	$"410D 4B49 5050 530D 4B49 5242 590D 4B49"            /* AKIPPSKIRBYKI */	$"524B 530D 4B49 524E 530D 4B49 5252 490D"            /* RKSKIRNSKIRRI */	$"4B49 5341 4E0D 4B49 5353 590D 4B49 5354"            /* KISANKISSYKIST */	$"530D 4B49 5445 440D 4B49 5445 520D 4B49"            /* SKITEDKITERKI */	$"5445 530D 4B49 5448 450D 4B49 5448 530D"            /* TESKITHEKITHS */	$"4B49 5455 4C0D 4B49 5641 530D 4B49 5749"            /* KITULKIVASKIWI */	$"530D 4B4C 414E 470D 4B4C 4150 530D 4B4C"            /* SKLANGKLAPSKL */	$"4554 540D 4B4C 4943 4B0D 4B4C 4945 470D"            /* ETTKLICKKLIEG */	$"4B4C 494B 530D 4B4C 4F4E 470D 4B4C 4F4F"            /* KLIKSKLONGKLOO */	$"460D 4B4C 5547 450D 4B4C 5554 5A0D 4B4E"            /* FKLUGEKLUTZKN */	$"4147 530D 4B4E 4150 530D 4B4E 4152 4C0D"            /* AGSKNAPSKNARL */	$"4B4E 4152 530D 4B4E 4155 520D 4B4E 4157"            /* KNARSKNAURKNAW */	$"450D 4B4E 4545 530D 4B4E 454C 4C0D 4B4E"            /* EKNEESKNELLKN */	$"4953 480D 4B4E 4954 530D 4B4E 4956 450D"            /* ISHKNITSKNIVE */	$"4B4E 4F42 530D 4B4E 4F50 530D 4B4E 4F53"            /* KNOBSKNOPSKNOS */	$"500D 4B4E 4F54 530D 4B4E 4F55 540D 4B4E"            /* PKNOTSKNOUTKN */	$"4F57 450D 4B4E 4F57 530D 4B4E 5542 530D"            /* OWEKNOWSKNUBS */	$"4B4E 5552 4C0D 4B4E 5552 520D 4B4E 5552"            /* KNURLKNURRKNUR */	$"530D 4B4E 5554 530D 4B4F 414E 530D 4B4F"            /* SKNUTSKOANSKO */	$"4150 530D 4B4F 4241 4E0D 4B4F 424F 530D"            /* APSKOBANKOBOS */	$"4B4F 454C 530D 4B4F 4646 530D 4B4F 4654"            /* KOELSKOFFSKOFT */	$"410D 4B4F 4741 4C0D 4B4F 4841 530D 4B4F"            /* AKOGALKOHASKO */	$"4845 4E0D 4B4F 484C 530D 4B4F 494E 450D"            /* HENKOHLSKOINE */	$"4B4F 4A49 530D 4B4F 4B41 4D0D 4B4F 4B41"            /* KOJISKOKAMKOKA */	$"530D 4B4F 4B45 520D 4B4F 4B52 410D 4B4F"            /* SKOKERKOKRAKO */	$"4B55 4D0D 4B4F 4C41 530D 4B4F 4C4F 530D"            /* KUMKOLASKOLOS */	$"4B4F 4D42 550D 4B4F 4E42 550D 4B4F 4E44"            /* KOMBUKONBUKOND */	$"4F0D 4B4F 4E4B 530D 4B4F 4F4B 530D 4B4F"            /* OKONKSKOOKSKO */	$"4F4B 590D 4B4F 4F52 490D 4B4F 5045 4B0D"            /* OKYKOORIKOPEK */	$"4B4F 5048 530D 4B4F 504A 450D 4B4F 5050"            /* KOPHSKOPJEKOPP */	$"410D 4B4F 5241 490D 4B4F 5241 530D 4B4F"            /* AKORAIKORASKO */	$"5241 540D 4B4F 5245 530D 4B4F 524D 410D"            /* RATKORESKORMA */	$"4B4F 524F 530D 4B4F 5255 4E0D 4B4F 5255"            /* KOROSKORUNKORU */	$"530D 4B4F 5345 530D 4B4F 5443 480D 4B4F"            /* SKOSESKOTCHKO */	$"544F 530D 4B4F 544F 570D 4B4F 5552 410D"            /* TOSKOTOWKOURA */	$"4B52 4141 4C0D 4B52 4142 530D 4B52 4146"            /* KRAALKRABSKRAF */	$"540D 4B52 4149 530D 4B52 4149 540D 4B52"            /* TKRAISKRAITKR */	$"414E 470D 4B52 414E 530D 4B52 414E 5A0D"            /* ANGKRANSKRANZ */	$"4B52 4155 540D 4B52 4159 530D 4B52 4545"            /* KRAUTKRAYSKREE */	$"500D 4B52 454E 470D 4B52 4557 450D 4B52"            /* PKRENGKREWEKR */	$"4F4E 410D 4B52 4F4E 450D 4B52 4F4F 4E0D"            /* ONAKRONEKROON */	$"4B52 5542 490D 4B52 554E 4B0D 4B53 4152"            /* KRUBIKRUNKKSAR */	$"530D 4B55 4249 450D 4B55 444F 530D 4B55"            /* SKUBIEKUDOSKU */	$"4455 530D 4B55 445A 550D 4B55 4649 530D"            /* DUSKUDZUKUFIS */	$"4B55 4745 4C0D 4B55 4941 530D 4B55 4B52"            /* KUGELKUIASKUKR */	$"490D 4B55 4B55 530D 4B55 4C41 4B0D 4B55"            /* IKUKUSKULAKKU */	$"4C41 4E0D 4B55 4C41 530D 4B55 4C46 490D"            /* LANKULASKULFI */	$"4B55 4D49 530D 4B55 4D59 530D 4B55 5249"            /* KUMISKUMYSKURI */	$"530D 4B55 5252 450D 4B55 5254 410D 4B55"            /* SKURREKURTAKU */	$"5255 530D 4B55 5353 4F0D 4B55 5441 530D"            /* RUSKUSSOKUTAS */	$"4B55 5443 480D 4B55 5449 530D 4B55 5455"            /* KUTCHKUTISKUTU */	$"530D 4B55 5A55 530D 4B56 4153 530D 4B56"            /* SKUZUSKVASSKV */	$"454C 4C0D 4B57 454C 410D 4B59 4143 4B0D"            /* ELLKWELAKYACK */	$"4B59 414B 530D 4B59 414E 470D 4B59 4152"            /* KYAKSKYANGKYAR */	$"530D 4B59 4154 530D 4B59 424F 530D 4B59"            /* SKYATSKYBOSKY */	$"4453 540D 4B59 4C45 530D 4B59 4C49 450D"            /* DSTKYLESKYLIE */	$"4B59 4C49 4E0D 4B59 4C49 580D 4B59 4C4F"            /* KYLINKYLIXKYLO */	$"450D 4B59 4E44 450D 4B59 4E44 530D 4B59"            /* EKYNDEKYNDSKY */	$"5045 530D 4B59 5249 450D 4B59 5445 530D"            /* PESKYRIEKYTES */	$"4B59 5448 450D 4C41 4152 490D 4C41 4244"            /* KYTHELAARILABD */	$"410D 4C41 4249 410D 4C41 4249 530D 4C41"            /* ALABIALABISLA */	$"4252 410D 4C41 4345 440D 4C41 4345 520D"            /* BRALACEDLACER */	$"4C41 4345 530D 4C41 4345 540D 4C41 4345"            /* LACESLACETLACE */	$"590D 4C41 434B 530D 4C41 4444 590D 4C41"            /* YLACKSLADDYLA */	$"4445 440D 4C41 4445 520D 4C41 4445 530D"            /* DEDLADERLADES */	$"4C41 4552 530D 4C41 4556 4F0D 4C41 4741"            /* LAERSLAEVOLAGA */	$"4E0D 4C41 4841 4C0D 4C41 4841 520D 4C41"            /* NLAHALLAHARLA */	$"4943 480D 4C41 4943 530D 4C41 4944 530D"            /* ICHLAICSLAIDS */	$"4C41 4947 480D 4C41 494B 410D 4C41 494B"            /* LAIGHLAIKALAIK */	$"530D 4C41 4952 440D 4C41 4952 530D 4C41"            /* SLAIRDLAIRSLA */	$"4952 590D 4C41 4954 480D 4C41 4954 590D"            /* IRYLAITHLAITY */	$"4C41 4B45 440D 4C41 4B45 520D 4C41 4B45"            /* LAKEDLAKERLAKE */	$"530D 4C41 4B48 530D 4C41 4B49 4E0D 4C41"            /* SLAKHSLAKINLA */	$"4B53 410D 4C41 4C44 590D 4C41 4C4C 530D"            /* KSALALDYLALLS */	$"4C41 4D41 530D 4C41 4D42 530D 4C41 4D42"            /* LAMASLAMBSLAMB */	$"590D 4C41 4D45 440D 4C41 4D45 520D 4C41"            /* YLAMEDLAMERLA */	$"4D45 530D 4C41 4D49 410D 4C41 4D4D 590D"            /* MESLAMIALAMMY */	$"4C41 4D50 530D 4C41 4E41 490D 4C41 4E41"            /* LAMPSLANAILANA */	$"530D 4C41 4E43 480D 4C41 4E44 450D 4C41"            /* SLANCHLANDELA */	$"4E44 530D 4C41 4E45 530D 4C41 4E4B 530D"            /* NDSLANESLANKS */	$"4C41 4E54 530D 4C41 5049 4E0D 4C41 5049"            /* LANTSLAPINLAPI */	$"530D 4C41 504A 450D 4C41 5243 480D 4C41"            /* SLAPJELARCHLA */	$"5244 530D 4C41 5244 590D 4C41 5245 450D"            /* RDSLARDYLAREE */	$"4C41 5245 530D 4C41 5247 4F0D 4C41 5249"            /* LARESLARGOLARI */	$"530D 4C41 524B 530D 4C41 524B 590D 4C41"            /* SLARKSLARKYLA */	$"524E 530D 4C41 524E 540D 4C41 5255 4D0D"            /* RNSLARNTLARUM */	$"4C41 5345 440D 4C41 5345 520D 4C41 5345"            /* LASEDLASERLASE */	$"530D 4C41 5353 490D 4C41 5353 550D 4C41"            /* SLASSILASSULA */	$"5353 590D 4C41 5354 530D 4C41 5441 480D"            /* SSYLASTSLATAH */	$"4C41 5445 440D 4C41 5445 4E0D 4C41 5445"            /* LATEDLATENLATE */	$"580D 4C41 5448 490D 4C41 5448 530D 4C41"            /* XLATHILATHSLA */	$"5448 590D 4C41 544B 450D 4C41 5455 530D"            /* THYLATKELATUS */	$"4C41 5541 4E0D 4C41 5543 480D 4C41 5544"            /* LAUANLAUCHLAUD */	$"530D 4C41 5546 530D 4C41 554E 440D 4C41"            /* SLAUFSLAUNDLA */	$"5552 410D 4C41 5641 4C0D 4C41 5641 530D"            /* URALAVALLAVAS */	$"4C41 5645 440D 4C41 5645 520D 4C41 5645"            /* LAVEDLAVERLAVE */	$"530D 4C41 5652 410D 4C41 5656 590D 4C41"            /* SLAVRALAVVYLA */	$"5745 440D 4C41 5745 520D 4C41 5749 4E0D"            /* WEDLAWERLAWIN */	$"4C41 574B 530D 4C41 574E 530D 4C41 574E"            /* LAWKSLAWNSLAWN */	$"590D 4C41 5845 440D 4C41 5845 520D 4C41"            /* YLAXEDLAXERLA */	$"5845 530D 4C41 584C 590D 4C41 5945 440D"            /* XESLAXLYLAYED */	$"4C41 5949 4E0D 4C41 5955 500D 4C41 5A41"            /* LAYINLAYUPLAZA */	$"520D 4C41 5A45 440D 4C41 5A45 530D 4C41"            /* RLAZEDLAZESLA */	$"5A4F 530D 4C41 5A5A 490D 4C41 5A5A 4F0D"            /* ZOSLAZZILAZZO */	$"4C45 4144 530D 4C45 4144 590D 4C45 4146"            /* LEADSLEADYLEAF */	$"530D 4C45 414B 530D 4C45 414D 530D 4C45"            /* SLEAKSLEAMSLE */	$"414E 530D 4C45 414E 590D 4C45 4150 530D"            /* ANSLEANYLEAPS */	$"4C45 4152 450D 4C45 4152 530D 4C45 4152"            /* LEARELEARSLEAR */	$"590D 4C45 4154 530D 4C45 4156 590D 4C45"            /* YLEATSLEAVYLE */	$"415A 450D 4C45 4245 4E0D 4C45 4343 590D"            /* AZELEBENLECCY */	$"4C45 4445 530D 4C45 4447 590D 4C45 4455"            /* LEDESLEDGYLEDU */	$"4D0D 4C45 4541 520D 4C45 454B 530D 4C45"            /* MLEEARLEEKSLE */	$"4550 530D 4C45 4552 530D 4C45 4553 450D"            /* EPSLEERSLEESE */	$"4C45 4554 530D 4C45 455A 450D 4C45 4654"            /* LEETSLEEZELEFT */	$"450D 4C45 4654 530D 4C45 4745 520D 4C45"            /* ELEFTSLEGERLE */	$"4745 530D 4C45 4747 450D 4C45 4747 4F0D"            /* GESLEGGELEGGO */	$"4C45 4749 540D 4C45 4852 530D 4C45 4855"            /* LEGITLEHRSLEHU */	$"410D 4C45 4952 530D 4C45 4953 480D 4C45"            /* ALEIRSLEISHLE */	$"4D41 4E0D 4C45 4D45 440D 4C45 4D45 4C0D"            /* MANLEMEDLEMEL */	$"4C45 4D45 530D 4C45 4D4D 410D 4C45 4D4D"            /* LEMESLEMMALEMM */	$"450D 4C45 4E44 530D 4C45 4E45 530D 4C45"            /* ELENDSLENESLE */	$"4E47 530D 4C45 4E49 530D 4C45 4E4F 530D"            /* NGSLENISLENOS */	$"4C45 4E53 450D 4C45 4E54 490D 4C45 4E54"            /* LENSELENTILENT */	$"4F0D 4C45 4F4E 450D 4C45 5049 440D 4C45"            /* OLEONELEPIDLE */	$"5052 410D 4C45 5054 410D 4C45 5245 440D"            /* PRALEPTALERED */	$"4C45 5245 530D 4C45 5250 530D 4C45 5342"            /* LERESLERPSLESB */	$"4F0D 4C45 5345 530D 4C45 5354 530D 4C45"            /* OLESESLESTSLE */	$"5443 480D 4C45 5448 450D 4C45 5455 500D"            /* TCHLETHELETUP */	$"4C45 5543 480D 4C45 5543 4F0D 4C45 5544"            /* LEUCHLEUCOLEUD */	$"530D 4C45 5547 480D 4C45 5641 530D 4C45"            /* SLEUGHLEVASLE */	$"5645 450D 4C45 5645 530D 4C45 5649 4E0D"            /* VEELEVESLEVIN */	$"4C45 5649 530D 4C45 5749 530D 4C45 5845"            /* LEVISLEWISLEXE */	$"530D 4C45 5849 530D 4C45 5A45 530D 4C45"            /* SLEXISLEZESLE */	$"5A5A 410D 4C45 5A5A 590D 4C49 414E 410D"            /* ZZALEZZYLIANA */	$"4C49 414E 450D 4C49 414E 470D 4C49 4152"            /* LIANELIANGLIAR */	$"440D 4C49 4152 530D 4C49 4152 540D 4C49"            /* DLIARSLIARTLI */	$"4245 520D 4C49 4252 410D 4C49 4252 490D"            /* BERLIBRALIBRI */	$"4C49 4348 490D 4C49 4348 540D 4C49 4349"            /* LICHILICHTLICI */	$"540D 4C49 434B 530D 4C49 4441 520D 4C49"            /* TLICKSLIDARLI */	$"444F 530D 4C49 4546 530D 4C49 454E 530D"            /* DOSLIEFSLIENS */	$"4C49 4552 530D 4C49 4555 530D 4C49 4556"            /* LIERSLIEUSLIEV */	$"450D 4C49 4645 520D 4C49 4645 530D 4C49"            /* ELIFERLIFESLI */	$"4654 530D 4C49 4741 4E0D 4C49 4745 520D"            /* FTSLIGANLIGER */	$"4C49 4747 450D 4C49 474E 450D 4C49 4B45"            /* LIGGELIGNELIKE */	$"440D 4C49 4B45 520D 4C49 4B45 530D 4C49"            /* DLIKERLIKESLI */	$"4B49 4E0D 4C49 4C4C 530D 4C49 4C4F 530D"            /* KINLILLSLILOS */	$"4C49 4C54 530D 4C49 4D41 4E0D 4C49 4D41"            /* LILTSLIMANLIMA */	$"530D 4C49 4D41 580D 4C49 4D42 410D 4C49"            /* SLIMAXLIMBALI */	$"4D42 490D 4C49 4D42 530D 4C49 4D42 590D"            /* MBILIMBSLIMBY */	$"4C49 4D45 440D 4C49 4D45 4E0D 4C49 4D45"            /* LIMEDLIMENLIME */	$"530D 4C49 4D45 590D 4C49 4D4D 410D 4C49"            /* SLIMEYLIMMALI */	$"4D4E 530D 4C49 4D4F 530D 4C49 4D50 410D"            /* MNSLIMOSLIMPA */	$"4C49 4D50 530D 4C49 4E41 430D 4C49 4E43"            /* LIMPSLINACLINC */	$"480D 4C49 4E44 530D 4C49 4E44 590D 4C49"            /* HLINDSLINDYLI */	$"4E45 440D 4C49 4E45 530D 4C49 4E45 590D"            /* NEDLINESLINEY */	$"4C49 4E47 410D 4C49 4E47 530D 4C49 4E47"            /* LINGALINGSLING */	$"590D 4C49 4E49 4E0D 4C49 4E4B 530D 4C49"            /* YLININLINKSLI */	$"4E4B 590D 4C49 4E4E 530D 4C49 4E4E 590D"            /* NKYLINNSLINNY */	$"4C49 4E4F 530D 4C49 4E54 530D 4C49 4E54"            /* LINOSLINTSLINT */	$"590D 4C49 4E55 4D0D 4C49 4E55 580D 4C49"            /* YLINUMLINUXLI */	$"4F4E 530D 4C49 5041 530D 4C49 5045 530D"            /* ONSLIPASLIPES */	$"4C49 5049 4E0D 4C49 504F 530D 4C49 5050"            /* LIPINLIPOSLIPP */	$"590D 4C49 5241 530D 4C49 524B 530D 4C49"            /* YLIRASLIRKSLI */	$"524F 540D 4C49 534B 530D 4C49 534C 450D"            /* ROTLISKSLISLE */	$"4C49 5350 530D 4C49 5354 530D 4C49 5441"            /* LISPSLISTSLITA */	$"490D 4C49 5441 530D 4C49 5445 440D 4C49"            /* ILITASLITEDLI */	$"5445 520D 4C49 5445 530D 4C49 5448 4F0D"            /* TERLITESLITHO */	$"4C49 5448 530D 4C49 5452 450D 4C49 5645"            /* LITHSLITRELIVE */	$"440D 4C49 5645 4E0D 4C49 5645 530D 4C49"            /* DLIVENLIVESLI */	$"564F 520D 4C49 5652 450D 4C4C 414E 4F0D"            /* VORLIVRELLANO */	$"4C4F 4143 480D 4C4F 4144 530D 4C4F 4146"            /* LOACHLOADSLOAF */	$"530D 4C4F 414D 530D 4C4F 414E 530D 4C4F"            /* SLOAMSLOANSLO */	$"4153 540D 4C4F 4156 450D 4C4F 4241 520D"            /* ASTLOAVELOBAR */	$"4C4F 4245 440D 4C4F 4245 530D 4C4F 424F"            /* LOBEDLOBESLOBO */	$"530D 4C4F 4255 530D 4C4F 4348 450D 4C4F"            /* SLOBUSLOCHELO */	$"4348 530D 4C4F 4349 450D 4C4F 4349 530D"            /* CHSLOCIELOCIS */	$"4C4F 434B 530D 4C4F 434F 530D 4C4F 4355"            /* LOCKSLOCOSLOCU */	$"4D0D 4C4F 4445 4E0D 4C4F 4445 530D 4C4F"            /* MLODENLODESLO */	$"4553 530D 4C4F 4654 530D 4C4F 4741 4E0D"            /* ESSLOFTSLOGAN */	$"4C4F 4745 530D 4C4F 4747 590D 4C4F 4749"            /* LOGESLOGGYLOGI */	$"410D 4C4F 4749 450D 4C4F 474F 490D 4C4F"            /* ALOGIELOGOILO */	$"474F 4E0D 4C4F 474F 530D 4C4F 4841 4E0D"            /* GONLOGOSLOHAN */	$"4C4F 4944 530D 4C4F 494E 530D 4C4F 4950"            /* LOIDSLOINSLOIP */	$"450D 4C4F 4952 530D 4C4F 4B45 530D 4C4F"            /* ELOIRSLOKESLO */	$"4C4C 530D 4C4F 4C4C 590D 4C4F 4C4F 470D"            /* LLSLOLLYLOLOG */	$"4C4F 4D41 530D 4C4F 4D45 440D 4C4F 4D45"            /* LOMASLOMEDLOME */	$"530D 4C4F 4E45 520D 4C4F 4E47 410D 4C4F"            /* SLONERLONGALO */	$"4E47 450D 4C4F 4E47 530D 4C4F 4F42 590D"            /* NGELONGSLOOBY */	$"4C4F 4F45 440D 4C4F 4F45 590D 4C4F 4F46"            /* LOOEDLOOEYLOOF */	$"410D 4C4F 4F46 530D 4C4F 4F49 450D 4C4F"            /* ALOOFSLOOIELO */	$"4F4B 530D 4C4F 4F4B 590D 4C4F 4F4D 530D"            /* OKSLOOKYLOOMS */	$"4C4F 4F4E 530D 4C4F 4F4E 590D 4C4F 4F50"            /* LOONSLOONYLOOP */	$"530D 4C4F 4F52 440D 4C4F 4F54 530D 4C4F"            /* SLOORDLOOTSLO */	$"5045 440D 4C4F 5045 520D 4C4F 5045 530D"            /* PEDLOPERLOPES */	$"4C4F 5050 590D 4C4F 5241 4C0D 4C4F 5241"            /* LOPPYLORALLORA */	$"4E0D 4C4F 5244 530D 4C4F 5244 590D 4C4F"            /* NLORDSLORDYLO */	$"5245 4C0D 4C4F 5245 530D 4C4F 5249 430D"            /* RELLORESLORIC */	$"4C4F 5249 530D 4C4F 5345 440D 4C4F 5345"            /* LORISLOSEDLOSE */	$"4C0D 4C4F 5345 4E0D 4C4F 5345 530D 4C4F"            /* LLOSENLOSESLO */	$"5353 590D 4C4F 5441 480D 4C4F 5441 530D"            /* SSYLOTAHLOTAS */	$"4C4F 5445 530D 4C4F 5449 430D 4C4F 544F"            /* LOTESLOTICLOTO */	$"530D 4C4F 5453 410D 4C4F 5454 410D 4C4F"            /* SLOTSALOTTALO */	$"5454 450D 4C4F 5454 4F0D 4C4F 5455 530D"            /* TTELOTTOLOTUS */	$"4C4F 5545 440D 4C4F 5547 480D 4C4F 5549"            /* LOUEDLOUGHLOUI */	$"450D 4C4F 5549 530D 4C4F 554D 410D 4C4F"            /* ELOUISLOUMALO */	$"554E 440D 4C4F 554E 530D 4C4F 5550 450D"            /* UNDLOUNSLOUPE */	$"4C4F 5550 530D 4C4F 5552 450D 4C4F 5552"            /* LOUPSLOURELOUR */	$"53"                                                 /* S */};data 'vers' (128) {	$"0120 8000 0000 0531 2E32 2E30 1976 312E"            /* . ....1.2.0.v1. */	$"322E 3020 5472 6576 6F72 2047 616C 6520"            /* 2.0 Trevor Gale  */	$"2832 3032 3429"                                     /* (2024) */};data 'SIZE' (-1) {	$"00C8 004C 4B40 004C 4B40"                           /* ..LK@.LK@ */};
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "painter.hh"
+
+const char* const keyboardRows[KEYBOARD_NUM_ROWS + 1] = {"QWERTYUIOP", "ASDFGHJKL", "\nZXCVBNM\b", nil};
+
+static const RenderColor scoreColors[] = {RenderLightGrey, RenderGrey, RenderYellow, RenderGreen};
+
+CellPainter::CellPainter()
+{
+	boardFont.size = 0;
+	keyboardFont.size = 0;
+}
+
+void CellPainter::buildFonts(Renderer* renderer, short keySize, short tileSize)
+{
+	buildFontMetrics(renderer, &keyboardFont, keySize, keySize);
+	buildFontMetrics(renderer, &boardFont, tileSize, tileSize);
+}
+
+void CellPainter::useKeyboardFont(Renderer* renderer)
+{
+	renderer->setFont(CellFont, keyboardFont.size);
+}
+
+void CellPainter::useBoardFont(Renderer* renderer)
+{
+	renderer->setFont(CellFont, boardFont.size);
+}
+
+// The keyboard font must already be set with useKeyboardFont
+void CellPainter::drawKey(Renderer* renderer, char key, letterScore score, Rect r)
+{
+	renderer->fillRoundRect(&r, ROUND_RECT_SZ, scoreColors[score]);
+
+	if ( key == '\n' )
+	{
+		key = ENTER_GLYPH;
+	}
+	else if (key == '\b' )
+	{
+		key = DELETE_GLYPH;
+	}
+
+	drawLetter(renderer, key, r, &keyboardFont);
+}
+
+// The board font must already be set with useBoardFont
+void CellPainter::drawTile(Renderer* renderer, char letter, letterScore score, Rect r)
+{
+	if (score == Unknown)
+	{
+		renderer->frameRect(&r, RenderBlack);
+	}
+	else
+	{
+		renderer->fillRect(&r, scoreColors[score]);
+	}
+
+	if (letter != '\0')
+	{
+		drawLetter(renderer, letter, r, &boardFont);
+	}
+}
+
+// Pick the largest size whose letters fit the cell and cache the glyph metrics for it
+void CellPainter::buildFontMetrics(Renderer* renderer, FontMetrics* metrics, short cellWidth, short cellHeight)
+{
+	short fontSizes[] = { 72, 48, 36, 24, 18, 14, 12, 10, 9, 8, 7, 6, 5, 4};
+
+	short ascent = 0;
+	short descent = 0;
+
+	for (int i = 0; i < (int)(sizeof(fontSizes) / sizeof(fontSizes[0])); i++)
+	{
+		renderer->setFont(CellFont, fontSizes[i]);
+		metrics->size = fontSizes[i];
+
+		short charWidth = renderer->charWidth('A');
+		renderer->fontMetrics(&ascent, &descent);
+
+		if ( charWidth < cellWidth && ((ascent + descent) <= cellHeight))
+		{
+			break;
+		}
+	}
+
+	metrics->ascent = ascent;
+	metrics->descent = descent;
+
+	for (int g = 0; g < ALPHABET_LENGTH; g++)
+	{
+		metrics->widths[g] = renderer->charWidth('A' + g);
+	}
+	metrics->widths[ALPHABET_LENGTH] = renderer->charWidth(ENTER_GLYPH);
+	metrics->widths[ALPHABET_LENGTH + 1] = renderer->charWidth(DELETE_GLYPH);
+}
+
+void CellPainter::drawLetter(Renderer* renderer, char letter, Rect r, const FontMetrics* metrics)
+{
+	short width;
+	if (letter == ENTER_GLYPH)
+	{
+		width = metrics->widths[ALPHABET_LENGTH];
+	}
+	else if (letter == DELETE_GLYPH)
+	{
+		width = metrics->widths[ALPHABET_LENGTH + 1];
+	}
+	else
+	{
+		width = metrics->widths[letter - 'A'];
+	}
+
+	short space = ((r.right - r.left) - width) / 2;
+	short vSpace = ((r.bottom - r.top) - (metrics->ascent + metrics->descent)) / 2;
+
+	renderer->drawChar(r.left + space, r.bottom - vSpace - metrics->descent, letter, RenderBlack);
+}
@@ -0,0 +1,66 @@
+#ifndef PAINTER_HH
+#define PAINTER_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "engine.hh"
+#include "layout.hh"
+#include "renderer.hh"
+
+// Arrow glyphs drawn on the Enter and Delete keys
+#define ENTER_GLYPH ((char)0xc8)
+#define DELETE_GLYPH ((char)0xc7)
+#define NUM_GLYPHS (ALPHABET_LENGTH + 2)
+
+#define ROUND_RECT_SZ (5)
+
+// Letters of each keyboard row, with Enter as '\n' and Delete as '\b'
+extern const char* const keyboardRows[KEYBOARD_NUM_ROWS + 1];
+
+// Font results for one class of cell, rebuilt only when the layout changes
+struct FontMetrics
+{
+	short size;
+	short ascent;
+	short descent;
+	short widths[NUM_GLYPHS];
+};
+
+// Draws single keys and tiles with any renderer, so the Mac and host builds share it
+class CellPainter
+{
+public:
+	CellPainter();
+
+	void buildFonts(Renderer* renderer, short keySize, short tileSize);
+	void useKeyboardFont(Renderer* renderer);
+	void useBoardFont(Renderer* renderer);
+
+	void drawKey(Renderer* renderer, char key, letterScore score, Rect r);
+	void drawTile(Renderer* renderer, char letter, letterScore score, Rect r);
+
+private:
+	void buildFontMetrics(Renderer* renderer, FontMetrics* metrics, short cellWidth, short cellHeight);
+	void drawLetter(Renderer* renderer, char letter, Rect r, const FontMetrics* metrics);
+
+	FontMetrics boardFont;
+	FontMetrics keyboardFont;
+};
+
+#endif
@@ -0,0 +1,323 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "qdrender.hh"
+#include <Fonts.h>
+#include <Gestalt.h>
+#include <string.h>
+
+#include "board.hh"
+#include "theme.hh"
+#include "alloc.hh"
+
+static const char* fontNames[NUM_RENDER_FONTS] = {"courier", "geneva"};
+
+static short families[NUM_RENDER_FONTS];
+static BOOL familiesFound = FALSE;
+
+BOOL monochromeMode = FALSE;
+
+// GWorlds and colour calls need 32-bit QuickDraw, and a 1-bit main screen gains nothing from them
+void chooseRenderMode()
+{
+	long qdVersion = gestaltOriginalQD;
+
+	if (Gestalt(gestaltQuickdrawVersion, &qdVersion) != noErr || qdVersion < gestalt32BitQD)
+	{
+		monochromeMode = TRUE;
+		return;
+	}
+
+	PixMapHandle mainPixMap = (**GetMainDevice()).gdPMap;
+	monochromeMode = ((**mainPixMap).pixelSize == 1);
+}
+
+// Renderers only keep a source port, so the ones drawing into windows can be shared
+Renderer* windowRenderer()
+{
+	static QuickDrawRenderer colorRenderer;
+	static ClassicRenderer classicRenderer;
+
+	if (monochromeMode)
+	{
+		return &classicRenderer;
+	}
+	return &colorRenderer;
+}
+
+WindowPtr newWindow(short resourceID)
+{
+	if (monochromeMode)
+	{
+		return GetNewWindow(resourceID, nil, (WindowPtr) -1);
+	}
+	return GetNewCWindow(resourceID, nil, (WindowPtr) -1);
+}
+
+// Font families are looked up by name once and shared by both renderers
+static void useFont(RenderFont font, short size)
+{
+	if (!familiesFound)
+	{
+		for (int i = 0; i < NUM_RENDER_FONTS; i++)
+		{
+			Str255 fontName;
+			families[i] = 0;
+			c2pstrcpy_cust(fontName, fontNames[i]);
+			GetFNum(fontName, &families[i]);
+		}
+		familiesFound = TRUE;
+	}
+
+	TextFont(families[font]);
+	TextSize(size);
+}
+
+QuickDrawRenderer::QuickDrawRenderer()
+{
+	sourcePort = NULL;
+}
+
+QuickDrawRenderer::QuickDrawRenderer(CGrafPtr source)
+{
+	sourcePort = source;
+}
+
+// Text and lines use the foreground colour, which is left black for CopyBits
+void QuickDrawRenderer::useColor(RenderColor color)
+{
+	RGBForeColor(themePalette.rgb(color));
+}
+
+void QuickDrawRenderer::eraseRect(const Rect* r)
+{
+	EraseRect(r);
+}
+
+void QuickDrawRenderer::fillRect(const Rect* r, RenderColor color)
+{
+	FillCRect(r, themePalette.pattern(color));
+}
+
+void QuickDrawRenderer::fillRoundRect(const Rect* r, short diameter, RenderColor color)
+{
+	FillCRoundRect(r, diameter, diameter, themePalette.pattern(color));
+}
+
+void QuickDrawRenderer::frameRect(const Rect* r, RenderColor color)
+{
+	useColor(color);
+	FrameRect(r);
+	useColor(RenderBlack);
+}
+
+void QuickDrawRenderer::drawLine(short h1, short v1, short h2, short v2, RenderColor color)
+{
+	useColor(color);
+	MoveTo(h1, v1);
+	LineTo(h2, v2);
+	useColor(RenderBlack);
+}
+
+void QuickDrawRenderer::setFont(RenderFont font, short size)
+{
+	useFont(font, size);
+}
+
+void QuickDrawRenderer::fontMetrics(short* ascent, short* descent)
+{
+	FontInfo info;
+	GetFontInfo(&info);
+
+	*ascent = info.ascent;
+	*descent = info.descent;
+}
+
+short QuickDrawRenderer::charWidth(char c)
+{
+	return CharWidth((unsigned char)c);
+}
+
+void QuickDrawRenderer::drawChar(short h, short v, char c, RenderColor color)
+{
+	if (color != RenderBlack)
+	{
+		useColor(color);
+	}
+
+	MoveTo(h, v);
+	DrawChar((unsigned char)c);
+
+	if (color != RenderBlack)
+	{
+		useColor(RenderBlack);
+	}
+}
+
+void QuickDrawRenderer::drawText(short h, short v, const char* text, RenderColor color)
+{
+	if (color != RenderBlack)
+	{
+		useColor(color);
+	}
+
+	MoveTo(h, v);
+	DrawText(text, 0, strlen(text));
+
+	if (color != RenderBlack)
+	{
+		useColor(RenderBlack);
+	}
+}
+
+void QuickDrawRenderer::copyFrom(Renderer* source, const Rect* srcRect, const Rect* dstRect)
+{
+	CGrafPtr port;
+	GDHandle device;
+	GetGWorld(&port, &device);
+
+	CGrafPtr from = ((QuickDrawRenderer*)source)->sourcePort;
+
+	CopyBits((BitMap *)*(from->portPixMap), (BitMap *)*(port->portPixMap), srcRect, dstRect, srcCopy, NULL);
+}
+
+ClassicRenderer::ClassicRenderer()
+{
+	sourcePort = NULL;
+}
+
+ClassicRenderer::ClassicRenderer(GrafPtr source)
+{
+	sourcePort = source;
+}
+
+// NULL for the colours that are white in 1-bit
+const Pattern* ClassicRenderer::pattern(RenderColor color)
+{
+	switch (color)
+	{
+		case RenderBlack:
+		case RenderGreen:
+			return &qd.black;
+		case RenderYellow:
+			return &qd.ltGray;
+		default:
+			return NULL;
+	}
+}
+
+void ClassicRenderer::eraseRect(const Rect* r)
+{
+	EraseRect(r);
+}
+
+void ClassicRenderer::fillRect(const Rect* r, RenderColor color)
+{
+	const Pattern* fill = pattern(color);
+
+	if (fill)
+	{
+		FillRect(r, fill);
+	}
+	else
+	{
+		EraseRect(r);
+	}
+
+	// Unused keys keep an outline so they still read as keys
+	if (color == RenderLightGrey)
+	{
+		FrameRect(r);
+	}
+}
+
+void ClassicRenderer::fillRoundRect(const Rect* r, short diameter, RenderColor color)
+{
+	const Pattern* fill = pattern(color);
+
+	if (fill)
+	{
+		FillRoundRect(r, diameter, diameter, fill);
+	}
+	else
+	{
+		EraseRoundRect(r, diameter, diameter);
+	}
+
+	if (color == RenderLightGrey)
+	{
+		FrameRoundRect(r, diameter, diameter);
+	}
+}
+
+void ClassicRenderer::frameRect(const Rect* r, RenderColor color)
+{
+	FrameRect(r);
+}
+
+void ClassicRenderer::drawLine(short h1, short v1, short h2, short v2, RenderColor color)
+{
+	MoveTo(h1, v1);
+	LineTo(h2, v2);
+}
+
+void ClassicRenderer::setFont(RenderFont font, short size)
+{
+	useFont(font, size);
+}
+
+void ClassicRenderer::fontMetrics(short* ascent, short* descent)
+{
+	FontInfo info;
+	GetFontInfo(&info);
+
+	*ascent = info.ascent;
+	*descent = info.descent;
+}
+
+short ClassicRenderer::charWidth(char c)
+{
+	return CharWidth((unsigned char)c);
+}
+
+// Inverting keeps letters readable on white, black and dithered cells alike
+void ClassicRenderer::drawChar(short h, short v, char c, RenderColor color)
+{
+	TextMode(srcXor);
+	MoveTo(h, v);
+	DrawChar((unsigned char)c);
+	TextMode(srcOr);
+}
+
+void ClassicRenderer::drawText(short h, short v, const char* text, RenderColor color)
+{
+	TextMode(srcXor);
+	MoveTo(h, v);
+	DrawText(text, 0, strlen(text));
+	TextMode(srcOr);
+}
+
+void ClassicRenderer::copyFrom(Renderer* source, const Rect* srcRect, const Rect* dstRect)
+{
+	GrafPtr port;
+	GetPort(&port);
+
+	GrafPtr from = ((ClassicRenderer*)source)->sourcePort;
+
+	CopyBits(&from->portBits, &port->portBits, srcRect, dstRect, srcCopy, NULL);
+}
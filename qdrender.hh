@@ -0,0 +1,92 @@
+#ifndef QDRENDER_HH
+#define QDRENDER_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include <QDOffscreen.h>
+#include <MacWindows.h>
+#include "engine.hh"
+#include "renderer.hh"
+
+// Draws with QuickDraw into the current port. Patterns come from the shared theme palette and
+// font families are looked up once, so renderers are cheap to create on the stack.
+class QuickDrawRenderer : public Renderer
+{
+public:
+	QuickDrawRenderer();
+	QuickDrawRenderer(CGrafPtr source);
+
+	void eraseRect(const Rect* r);
+	void fillRect(const Rect* r, RenderColor color);
+	void fillRoundRect(const Rect* r, short diameter, RenderColor color);
+	void frameRect(const Rect* r, RenderColor color);
+	void drawLine(short h1, short v1, short h2, short v2, RenderColor color);
+
+	void setFont(RenderFont font, short size);
+	void fontMetrics(short* ascent, short* descent);
+	short charWidth(char c);
+	void drawChar(short h, short v, char c, RenderColor color);
+	void drawText(short h, short v, const char* text, RenderColor color);
+
+	void copyFrom(Renderer* source, const Rect* srcRect, const Rect* dstRect);
+
+private:
+	static void useColor(RenderColor color);
+
+	// Port read by copyFrom when this renderer is the source
+	CGrafPtr sourcePort;
+};
+
+// Draws 1-bit with the original QuickDraw calls and patterns, for machines without Color
+// QuickDraw and for 1-bit screens. Scored cells are black when placed, grey dither when
+// present and white when absent; letters are drawn inverted over whatever is below them.
+class ClassicRenderer : public Renderer
+{
+public:
+	ClassicRenderer();
+	ClassicRenderer(GrafPtr source);
+
+	void eraseRect(const Rect* r);
+	void fillRect(const Rect* r, RenderColor color);
+	void fillRoundRect(const Rect* r, short diameter, RenderColor color);
+	void frameRect(const Rect* r, RenderColor color);
+	void drawLine(short h1, short v1, short h2, short v2, RenderColor color);
+
+	void setFont(RenderFont font, short size);
+	void fontMetrics(short* ascent, short* descent);
+	short charWidth(char c);
+	void drawChar(short h, short v, char c, RenderColor color);
+	void drawText(short h, short v, const char* text, RenderColor color);
+
+	void copyFrom(Renderer* source, const Rect* srcRect, const Rect* dstRect);
+
+private:
+	static const Pattern* pattern(RenderColor color);
+
+	GrafPtr sourcePort;
+};
+
+// TRUE when drawing 1-bit with ClassicRenderer, chosen once at startup
+extern BOOL monochromeMode;
+
+void chooseRenderMode();
+Renderer* windowRenderer();
+WindowPtr newWindow(short resourceID);
+
+#endif
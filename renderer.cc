@@ -0,0 +1,59 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "renderer.hh"
+
+const RGBColor themeRGB[NUM_RENDER_THEMES][NUM_RENDER_COLORS] =
+{
+	{
+		{255 << 8, 255 << 8, 255 << 8},
+		{0, 0, 0},
+		{119 << 8, 124 << 8, 126 << 8},
+		{205 << 8, 178 << 8, 100 << 8},
+		{93 << 8, 170 << 8, 107 << 8},
+		{211 << 8, 214 << 8, 218 << 8},
+		{204 << 8, 204 << 8, 204 << 8}
+	},
+	{
+		{255 << 8, 255 << 8, 255 << 8},
+		{0, 0, 0},
+		{58 << 8, 58 << 8, 60 << 8},
+		{230 << 8, 170 << 8, 0},
+		{0, 128 << 8, 40 << 8},
+		{190 << 8, 192 << 8, 196 << 8},
+		{204 << 8, 204 << 8, 204 << 8}
+	},
+	{
+		{255 << 8, 255 << 8, 255 << 8},
+		{0, 0, 0},
+		{119 << 8, 124 << 8, 126 << 8},
+		{133 << 8, 192 << 8, 249 << 8},
+		{245 << 8, 121 << 8, 58 << 8},
+		{211 << 8, 214 << 8, 218 << 8},
+		{204 << 8, 204 << 8, 204 << 8}
+	}
+};
+
+const RGBColor* renderRGB = themeRGB[StandardTheme];
+RenderTheme renderTheme = StandardTheme;
+
+void setRenderTheme(RenderTheme theme)
+{
+	renderTheme = theme;
+	renderRGB = themeRGB[theme];
+}
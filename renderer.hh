@@ -0,0 +1,88 @@
+#ifndef RENDERER_HH
+#define RENDERER_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include <MacTypes.h>
+#include <Quickdraw.h>
+
+// Colours the game draws with. Each renderer maps them to its own pixels.
+enum RenderColor
+{
+	RenderWhite,
+	RenderBlack,
+	RenderGrey,
+	RenderYellow,
+	RenderGreen,
+	RenderLightGrey,
+	RenderMacGrey,
+	NUM_RENDER_COLORS
+};
+
+enum RenderFont
+{
+	// Monospaced letters for the board and keyboard
+	CellFont,
+	// Labels in the About and Score windows
+	LabelFont,
+	NUM_RENDER_FONTS
+};
+
+enum RenderTheme
+{
+	StandardTheme,
+	// Darker greys and saturated colours for low-contrast screens
+	HighContrastTheme,
+	// Orange and blue in place of green and yellow
+	ColourBlindTheme,
+	NUM_RENDER_THEMES
+};
+
+extern const RGBColor themeRGB[NUM_RENDER_THEMES][NUM_RENDER_COLORS];
+
+// The current theme's colours
+extern const RGBColor* renderRGB;
+extern RenderTheme renderTheme;
+
+void setRenderTheme(RenderTheme theme);
+
+// The drawing calls the game needs, so it can render with QuickDraw on the Mac and into
+// a plain framebuffer on a host. Coordinates are those of the current destination.
+class Renderer
+{
+public:
+	virtual ~Renderer() {}
+
+	virtual void eraseRect(const Rect* r) = 0;
+	virtual void fillRect(const Rect* r, RenderColor color) = 0;
+	virtual void fillRoundRect(const Rect* r, short diameter, RenderColor color) = 0;
+	virtual void frameRect(const Rect* r, RenderColor color) = 0;
+	virtual void drawLine(short h1, short v1, short h2, short v2, RenderColor color) = 0;
+
+	virtual void setFont(RenderFont font, short size) = 0;
+	virtual void fontMetrics(short* ascent, short* descent) = 0;
+	virtual short charWidth(char c) = 0;
+	virtual void drawChar(short h, short v, char c, RenderColor color) = 0;
+	virtual void drawText(short h, short v, const char* text, RenderColor color) = 0;
+
+	// The source must be a renderer of the same kind
+	virtual void copyFrom(Renderer* source, const Rect* srcRect, const Rect* dstRect) = 0;
+};
+
+#endif
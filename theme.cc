@@ -0,0 +1,79 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "theme.hh"
+#include "alloc.hh"
+
+ThemePalette themePalette;
+
+ThemePalette::ThemePalette()
+{
+	built = FALSE;
+	for (int i = 0; i < NUM_RENDER_COLORS; i++)
+	{
+		patterns[i] = NULL;
+	}
+}
+
+// Called after the Toolbox is up, and only when drawing in colour
+void ThemePalette::init()
+{
+	for (int i = 0; i < NUM_RENDER_COLORS; i++)
+	{
+		patterns[i] = NewPixPat();
+		if (patterns[i])
+		{
+			MakeRGBPat(patterns[i], &renderRGB[i]);
+		}
+	}
+	built = TRUE;
+}
+
+// The existing patterns are reused, so switching themes doesn't fragment the heap
+void ThemePalette::setTheme(RenderTheme theme)
+{
+	setRenderTheme(theme);
+
+	for (int i = 0; built && i < NUM_RENDER_COLORS; i++)
+	{
+		if (patterns[i])
+		{
+			MakeRGBPat(patterns[i], &renderRGB[i]);
+		}
+	}
+}
+
+RenderTheme ThemePalette::theme()
+{
+	return renderTheme;
+}
+
+PixPatHandle ThemePalette::pattern(RenderColor color)
+{
+	if (!built)
+	{
+		init();
+	}
+
+	return patterns[color];
+}
+
+const RGBColor* ThemePalette::rgb(RenderColor color)
+{
+	return &renderRGB[color];
+}
@@ -0,0 +1,46 @@
+#ifndef THEME_HH
+#define THEME_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include <Quickdraw.h>
+#include "engine.hh"
+#include "renderer.hh"
+
+// Colour patterns for every window, built once and refilled in place when the theme changes
+class ThemePalette
+{
+public:
+	ThemePalette();
+
+	void init();
+	void setTheme(RenderTheme theme);
+	RenderTheme theme();
+
+	PixPatHandle pattern(RenderColor color);
+	const RGBColor* rgb(RenderColor color);
+
+private:
+	PixPatHandle patterns[NUM_RENDER_COLORS];
+	BOOL built;
+};
+
+extern ThemePalette themePalette;
+
+#endif
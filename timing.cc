@@ -0,0 +1,361 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "timing.hh"
+#include <Timer.h>
+#include <Quickdraw.h>
+#include <stdio.h>
+#include <string.h>
+
+// A tick is 1/60th of a second
+#define MICROSECONDS_PER_TICK (16667L)
+
+FrameTimer frameTimer;
+KeyLatency keyLatency;
+
+const char* const framePhaseNames[NUM_FRAME_PHASES + 1] = {"Layout", "Keyboard", "Grid", "Fonts", "CopyBits", "Frame"};
+const char* const frameTriggerNames[NUM_FRAME_TRIGGERS] = {"Update", "Key", "Resize"};
+
+const unsigned short latencyBuckets[NUM_LATENCY_BUCKETS] = {5, 10, 17, 33, 50, 75, 100, 150, 250, 500, 1000, 0xFFFF};
+const char* const keyKindNames[NUM_KEY_KINDS] = {"Letters", "Enter"};
+
+// Only the low half is kept; differences stay right across its wrap every 71 minutes
+unsigned long microseconds()
+{
+	UnsignedWide micro;
+	Microseconds(&micro);
+	return micro.lo;
+}
+
+FrameTimer::FrameTimer()
+{
+	enabled = FALSE;
+	inFrame = FALSE;
+	pending = TriggerUpdate;
+	historyLength = 0;
+	historyNext = 0;
+	frames = 0;
+	memset(started, 0, sizeof(started));
+	memset(current, 0, sizeof(current));
+	memset(triggers, 0, sizeof(triggers));
+}
+
+unsigned long FrameTimer::now()
+{
+	return microseconds();
+}
+
+// Statistics start over each time timing is switched on
+void FrameTimer::setEnabled(BOOL enable)
+{
+	enabled = enable;
+	inFrame = FALSE;
+	historyLength = 0;
+	historyNext = 0;
+	frames = 0;
+	memset(triggers, 0, sizeof(triggers));
+}
+
+BOOL FrameTimer::isEnabled()
+{
+	return enabled;
+}
+
+void FrameTimer::setTrigger(FrameTrigger trigger)
+{
+	pending = trigger;
+}
+
+void FrameTimer::beginFrame()
+{
+	if (!enabled)
+	{
+		return;
+	}
+
+	memset(current, 0, sizeof(current));
+	inFrame = TRUE;
+	started[PHASE_TOTAL] = now();
+}
+
+void FrameTimer::endFrame()
+{
+	if (!enabled || !inFrame)
+	{
+		return;
+	}
+
+	current[PHASE_TOTAL] = now() - started[PHASE_TOTAL];
+	memcpy(history[historyNext], current, sizeof(current));
+
+	historyNext = (historyNext + 1) % FRAME_HISTORY;
+	if (historyLength < FRAME_HISTORY)
+	{
+		historyLength++;
+	}
+
+	triggers[pending]++;
+	pending = TriggerUpdate;
+	frames++;
+	inFrame = FALSE;
+}
+
+void FrameTimer::begin(FramePhase phase)
+{
+	if (enabled)
+	{
+		started[phase] = now();
+	}
+}
+
+// A phase can run several times in one frame, once per screen world
+void FrameTimer::end(FramePhase phase)
+{
+	if (enabled)
+	{
+		current[phase] += now() - started[phase];
+	}
+}
+
+// Sorting a copy is fine for the few frames kept, and only happens when the numbers are shown
+void FrameTimer::stats(int phase, PhaseStats* out)
+{
+	memset(out, 0, sizeof(PhaseStats));
+
+	if (historyLength == 0)
+	{
+		return;
+	}
+
+	unsigned long sorted[FRAME_HISTORY];
+	unsigned long sum = 0;
+	int i;
+
+	for (i = 0; i < historyLength; i++)
+	{
+		unsigned long value = history[i][phase];
+		sum += value;
+
+		int j = i;
+		while (j > 0 && sorted[j - 1] > value)
+		{
+			sorted[j] = sorted[j - 1];
+			j--;
+		}
+		sorted[j] = value;
+	}
+
+	int newest = (historyNext + FRAME_HISTORY - 1) % FRAME_HISTORY;
+	out->last = history[newest][phase];
+	out->min = sorted[0];
+	out->avg = sum / historyLength;
+	out->p95 = sorted[(historyLength * 95 + 99) / 100 - 1];
+}
+
+unsigned long FrameTimer::triggerCount(FrameTrigger trigger)
+{
+	return triggers[trigger];
+}
+
+unsigned long FrameTimer::frameCount()
+{
+	return frames;
+}
+
+KeyLatency::KeyLatency()
+{
+	pendingBoard = NULL;
+	pendingKind = LetterKey;
+	pendingWhen = 0;
+	pendingTicks = 0;
+	pendingMicro = 0;
+	pendingExpected = FALSE;
+	pendingAnimation = FALSE;
+	memset(&pendingArea, 0, sizeof(pendingArea));
+	memset(histograms, 0, sizeof(histograms));
+}
+
+// The time spent queued is only known in ticks; from here on it is timed in microseconds
+void KeyLatency::received(Board* board, const EventRecord* event, KeyKind kind)
+{
+	if (pendingBoard != NULL && TickCount() - pendingTicks < LATENCY_TIMEOUT_TICKS)
+	{
+		return;
+	}
+
+	pendingBoard = board;
+	pendingKind = kind;
+	pendingWhen = event->when;
+	pendingTicks = TickCount();
+	pendingMicro = microseconds();
+	pendingExpected = FALSE;
+}
+
+// Where the pending key will first change pixels, and whether an animation frame draws it
+void KeyLatency::expect(Board* board, const Rect* area, BOOL animation)
+{
+	if (board != pendingBoard)
+	{
+		return;
+	}
+
+	pendingExpected = TRUE;
+	pendingAnimation = animation;
+	pendingArea = *area;
+}
+
+// An animation that never drew a frame leaves its end state for the next board draw
+void KeyLatency::settled(Board* board, const Rect* area)
+{
+	if (board != pendingBoard || !pendingExpected || !pendingAnimation)
+	{
+		return;
+	}
+
+	pendingAnimation = FALSE;
+	pendingArea = *area;
+}
+
+// Called after a board's CopyBits or direct drawing to its window, with the area it covered
+void KeyLatency::drawn(Board* board, const Rect* shown, BOOL animation)
+{
+	Rect overlap;
+
+	if (board != pendingBoard || !pendingExpected || animation != pendingAnimation ||
+		!SectRect(shown, &pendingArea, &overlap))
+	{
+		return;
+	}
+
+	unsigned long queued = (pendingTicks - pendingWhen) * MICROSECONDS_PER_TICK;
+	unsigned long latencyMs = (queued + (microseconds() - pendingMicro) + 500) / 1000;
+
+	LatencyHistogram* histogram = &histograms[pendingKind];
+	int bucket = 0;
+	while (bucket < NUM_LATENCY_BUCKETS - 1 && latencyMs > latencyBuckets[bucket])
+	{
+		bucket++;
+	}
+
+	histogram->counts[bucket]++;
+	histogram->samples++;
+	histogram->totalMs += latencyMs;
+	if (latencyMs > histogram->maxMs)
+	{
+		histogram->maxMs = latencyMs;
+	}
+
+	pendingBoard = NULL;
+}
+
+// For keys that only beep, so nothing on screen will ever show them
+void KeyLatency::cancel(Board* board)
+{
+	if (board == pendingBoard)
+	{
+		pendingBoard = NULL;
+	}
+}
+
+const LatencyHistogram* KeyLatency::histogram(KeyKind kind)
+{
+	return &histograms[kind];
+}
+
+// The upper bound of the bucket holding the percentile, in milliseconds
+unsigned long KeyLatency::percentile(KeyKind kind, int percent)
+{
+	const LatencyHistogram* histogram = &histograms[kind];
+	unsigned long wanted = (histogram->samples * percent + 99) / 100;
+	unsigned long seen = 0;
+
+	for (int bucket = 0; bucket < NUM_LATENCY_BUCKETS - 1; bucket++)
+	{
+		seen += histogram->counts[bucket];
+		if (seen >= wanted)
+		{
+			return latencyBuckets[bucket];
+		}
+	}
+
+	return histogram->maxMs;
+}
+
+unsigned long KeyLatency::sampleCount()
+{
+	return histograms[LetterKey].samples + histograms[EnterKey].samples;
+}
+
+// Tab separated, one row per bucket, for a spreadsheet
+BOOL KeyLatency::save(const char* path)
+{
+	FILE* file = fopen(path, "w");
+	if (file == NULL)
+	{
+		return FALSE;
+	}
+
+	int kind;
+
+	fprintf(file, "Latency (ms)");
+	for (kind = 0; kind < NUM_KEY_KINDS; kind++)
+	{
+		fprintf(file, "\t%s", keyKindNames[kind]);
+	}
+	fprintf(file, "\n");
+
+	for (int bucket = 0; bucket < NUM_LATENCY_BUCKETS; bucket++)
+	{
+		if (bucket < NUM_LATENCY_BUCKETS - 1)
+		{
+			fprintf(file, "<= %u", latencyBuckets[bucket]);
+		}
+		else
+		{
+			fprintf(file, "> %u", latencyBuckets[bucket - 1]);
+		}
+
+		for (kind = 0; kind < NUM_KEY_KINDS; kind++)
+		{
+			fprintf(file, "\t%lu", histograms[kind].counts[bucket]);
+		}
+		fprintf(file, "\n");
+	}
+
+	fprintf(file, "Samples");
+	for (kind = 0; kind < NUM_KEY_KINDS; kind++)
+	{
+		fprintf(file, "\t%lu", histograms[kind].samples);
+	}
+	fprintf(file, "\nAverage");
+	for (kind = 0; kind < NUM_KEY_KINDS; kind++)
+	{
+		unsigned long samples = histograms[kind].samples;
+		fprintf(file, "\t%lu", samples ? histograms[kind].totalMs / samples : 0);
+	}
+	fprintf(file, "\nMax");
+	for (kind = 0; kind < NUM_KEY_KINDS; kind++)
+	{
+		fprintf(file, "\t%lu", histograms[kind].maxMs);
+	}
+	fprintf(file, "\n");
+
+	BOOL ok = !ferror(file);
+	fclose(file);
+	return ok;
+}
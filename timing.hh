@@ -0,0 +1,176 @@
+#ifndef TIMING_HH
+#define TIMING_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include <Events.h>
+#include "engine.hh"
+
+class Board;
+
+// Low 32 bits of the Microseconds clock
+unsigned long microseconds();
+
+// Frames kept for the rolling statistics
+#define FRAME_HISTORY (64)
+
+// Parts of Board::draw that are timed separately
+enum FramePhase
+{
+	// Layout, screen worlds and offscreen allocation
+	PhaseLayout,
+	PhaseKeyboard,
+	PhaseGrid,
+	// Font size search and sprite atlas builds
+	PhaseFonts,
+	// CopyBits from the offscreen to the window
+	PhaseCopy,
+	NUM_FRAME_PHASES
+};
+
+// Slot after the phases holding the whole frame
+#define PHASE_TOTAL (NUM_FRAME_PHASES)
+
+// What caused a frame to be drawn
+enum FrameTrigger
+{
+	TriggerUpdate,
+	TriggerKey,
+	TriggerResize,
+	NUM_FRAME_TRIGGERS
+};
+
+// In microseconds over the frames kept
+struct PhaseStats
+{
+	unsigned long last;
+	unsigned long min;
+	unsigned long avg;
+	unsigned long p95;
+};
+
+// Times each phase of a board frame with Microseconds. Does nothing but test a flag while
+// no one is looking at the numbers.
+class FrameTimer
+{
+public:
+	FrameTimer();
+
+	void setEnabled(BOOL enable);
+	BOOL isEnabled();
+
+	// The next frame is counted against this trigger instead of an update
+	void setTrigger(FrameTrigger trigger);
+
+	void beginFrame();
+	void endFrame();
+	void begin(FramePhase phase);
+	void end(FramePhase phase);
+
+	void stats(int phase, PhaseStats* out);
+	unsigned long triggerCount(FrameTrigger trigger);
+	unsigned long frameCount();
+
+private:
+	static unsigned long now();
+
+	BOOL enabled;
+	BOOL inFrame;
+	FrameTrigger pending;
+
+	unsigned long started[NUM_FRAME_PHASES + 1];
+	unsigned long current[NUM_FRAME_PHASES + 1];
+
+	unsigned long history[FRAME_HISTORY][NUM_FRAME_PHASES + 1];
+	int historyLength;
+	int historyNext;
+
+	unsigned long triggers[NUM_FRAME_TRIGGERS];
+	unsigned long frames;
+};
+
+extern FrameTimer frameTimer;
+
+// Latency histogram buckets, by upper bound in milliseconds. The last is open ended.
+#define NUM_LATENCY_BUCKETS (12)
+#define LATENCY_FILE_NAME "MacWords Latency"
+
+// A sample still open after this long is dropped, so a key that never drew can't block the next
+#define LATENCY_TIMEOUT_TICKS (180)
+
+// Enter validates and scores the guess, so it is measured apart from plain letters
+enum KeyKind
+{
+	LetterKey,
+	EnterKey,
+	NUM_KEY_KINDS
+};
+
+struct LatencyHistogram
+{
+	unsigned long counts[NUM_LATENCY_BUCKETS];
+	unsigned long samples;
+	unsigned long totalMs;
+	unsigned long maxMs;
+};
+
+// Keystroke to pixel: from a keyDown's event.when to the end of the CopyBits that first shows
+// it. Keys typed before that CopyBits are covered by the oldest one's sample. The board says
+// where the key will show and whether an animation frame shows it first, and a sample only
+// closes when pixels in that area actually reach the window.
+class KeyLatency
+{
+public:
+	KeyLatency();
+
+	void received(Board* board, const EventRecord* event, KeyKind kind);
+	void expect(Board* board, const Rect* area, BOOL animation);
+	void settled(Board* board, const Rect* area);
+	void drawn(Board* board, const Rect* shown, BOOL animation);
+	void cancel(Board* board);
+
+	const LatencyHistogram* histogram(KeyKind kind);
+	unsigned long percentile(KeyKind kind, int percent);
+	unsigned long sampleCount();
+	BOOL save(const char* path);
+
+private:
+	Board* pendingBoard;
+	KeyKind pendingKind;
+	unsigned long pendingWhen;
+	unsigned long pendingTicks;
+	unsigned long pendingMicro;
+
+	// Set once the board knows what will show the key
+	BOOL pendingExpected;
+	BOOL pendingAnimation;
+	Rect pendingArea;
+
+	LatencyHistogram histograms[NUM_KEY_KINDS];
+};
+
+extern KeyLatency keyLatency;
+
+extern const unsigned short latencyBuckets[NUM_LATENCY_BUCKETS];
+extern const char* const keyKindNames[NUM_KEY_KINDS];
+
+extern const char* const framePhaseNames[NUM_FRAME_PHASES + 1];
+extern const char* const frameTriggerNames[NUM_FRAME_TRIGGERS];
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "trace.hh"
+
+const char* const traceEventNames[NUM_TRACE_EVENTS] =
+{
+	"update",
+	"board-draw",
+	"grow",
+	"world-size",
+	"update-world-failed",
+	"new-world-failed",
+	"key",
+	"click",
+	"idle-task"
+};
+
+#if TRACE_ENABLED
+
+#include <stdio.h>
+
+TraceBuffer traceBuffer;
+
+static void putLong(FILE* file, unsigned long value)
+{
+	fputc((int)((value >> 24) & 0xFF), file);
+	fputc((int)((value >> 16) & 0xFF), file);
+	fputc((int)((value >> 8) & 0xFF), file);
+	fputc((int)(value & 0xFF), file);
+}
+
+// Writes the buffer oldest record first; recording carries on afterwards
+BOOL traceDump(const char* path)
+{
+	FILE* file = fopen(path, "wb");
+	if (file == NULL)
+	{
+		return FALSE;
+	}
+
+	unsigned long count = traceBuffer.next;
+	unsigned long first = 0;
+	if (count > TRACE_CAPACITY)
+	{
+		first = count - TRACE_CAPACITY;
+		count = TRACE_CAPACITY;
+	}
+
+	putLong(file, TRACE_MAGIC);
+	putLong(file, count);
+
+	for (unsigned long i = 0; i < count; i++)
+	{
+		const TraceRecord* r = &traceBuffer.records[(first + i) & (TRACE_CAPACITY - 1)];
+		putLong(file, r->ticks);
+		putLong(file, r->event);
+		putLong(file, r->arg1);
+		putLong(file, r->arg2);
+	}
+
+	BOOL ok = !ferror(file);
+	fclose(file);
+	return ok;
+}
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef TRACE_HH
+#define TRACE_HH
+
+/*
+ * Copyright 2022 Trevor Gale
+ *
+ * This file is part of MacWords
+ *
+ * MacWords is free software: you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * MacWords is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with MacWords. If not,
+ * see <https://www.gnu.org/licenses/>. 
+ */
+
+
+#include "engine.hh"
+
+// Build with TRACE_ENABLED defined as 0 to compile every TRACE out entirely
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED (1)
+#endif
+
+// Records kept, a power of two so the write index wraps with a mask
+#define TRACE_CAPACITY (1024)
+
+// Dump files start with this, then the count, then the records oldest first. Every field is
+// a big-endian 32-bit value, so the host decoder needn't share the Mac's struct layout.
+#define TRACE_MAGIC (0x4D575452L)
+#define TRACE_FILE_NAME "MacWords Trace"
+
+enum TraceEvent
+{
+	// Window and zero
+	TraceUpdate,
+	// Whether the layout changed and the number of screen worlds
+	TraceBoardDraw,
+	// Window and new size, height in the high word
+	TraceGrow,
+	// Bytes needed and free memory
+	TraceWorldSize,
+	// QuickDraw error and zero
+	TraceUpdateWorldFailed,
+	TraceNewWorldFailed,
+	// Character and guesses made
+	TraceKey,
+	// Local point of a content click, h and v
+	TraceClick,
+	// Calls a finished background task took and microseconds spent in them
+	TraceIdleTask,
+	NUM_TRACE_EVENTS
+};
+
+extern const char* const traceEventNames[NUM_TRACE_EVENTS];
+
+#if TRACE_ENABLED
+
+#include <LowMem.h>
+
+struct TraceRecord
+{
+	unsigned long ticks;
+	long event;
+	long arg1;
+	long arg2;
+};
+
+struct TraceBuffer
+{
+	TraceRecord records[TRACE_CAPACITY];
+	unsigned long next;
+};
+
+extern TraceBuffer traceBuffer;
+
+// A handful of moves with no trap or stdio call, so it can sit in the drawing and event paths
+inline void traceRecord(long event, long arg1, long arg2)
+{
+	TraceRecord* r = &traceBuffer.records[traceBuffer.next++ & (TRACE_CAPACITY - 1)];
+	r->ticks = LMGetTicks();
+	r->event = event;
+	r->arg1 = arg1;
+	r->arg2 = arg2;
+}
+
+BOOL traceDump(const char* path);
+
+#define TRACE(event, arg1, arg2) traceRecord((event), (long)(arg1), (long)(arg2))
+
+#else
+
+#define TRACE(event, arg1, arg2) ((void)0)
+
+#endif
+
+#endif
@@ -31,6 +31,11 @@
 
 #include "board.hh"
 #include "windows.hh"
+#include "theme.hh"
+#include "trace.hh"
+#include "timing.hh"
+#include "idle.hh"
+#include "alloc.hh"
 
 static const char programName[] = "MacWords";
 
@@ -41,11 +46,24 @@ static const short editMenu = 130;
 static const short gameMenu = 131;
 
 static const short appleMenuAbout = 1;
-static const short fileMenuQuit = 1;
+static const short fileMenuSaveTrace = 1;
+static const short fileMenuSaveLatency = 2;
+static const short fileMenuQuit = 4;
 static const short editMenuCopy = 1;
 static const short editMenuClear = 2;
 static const short gameMenuBegin = 1;
-static const short gameMenuClose = 2;
+static const short gameMenuNewWindow = 2;
+static const short gameMenuClose = 3;
+static const short gameMenuIndexed = 5;
+static const short gameMenuFirstTheme = 7;
+static const short gameMenuTiming = 11;
+
+// Shown when a window can't be made larger even after purging caches
+static const short memoryAlert = 128;
+
+// Offset between successive game windows so they don't stack exactly
+static const short windowStagger = 20;
+static const short maxStaggeredWindows = 8;
 
 #if __MWERKS__ == 0
 QDGlobals qd;
@@ -59,15 +77,30 @@ void mainLoop();
 void terminate();
 void processMouseMenuEvent(long action);
 void processKeyMenuEvent(char key);
+void processKeyEvent(EventRecord* event);
 void beginGame();
 void newGame(WindowPtr window);
 void clearEntry(WindowPtr window);
 WindowPtr createAboutWindow();
 void drawAboutWindow(WindowPtr window);
+void drawAboutContent(WindowPtr window);
 void closeAboutWinow(WindowPtr window);
 void closeWindow(WindowPtr window);
+void toggleIndexedOffscreen();
+void saveTrace();
+void toggleFrameTiming();
+long liveGrow(WindowPtr window, Board* board, Point start, const Rect* limits);
+void chooseTheme(RenderTheme theme);
+void recordAboutWindow(WindowPtr window);
+Size purgeAboutPicture(void* picture);
+BOOL ownsAboutPicture(void* picture, Handle h);
+void showMemoryAlert();
 
 static BOOL aboutWindowOpen;
+static PicHandle aboutPicture;
+static WindowPtr statsWindow;
+static short openBoards;
+static short boardsCreated;
 
 void main()
 {
@@ -89,6 +122,17 @@ void initialize()
 	InitCursor();
 
 	aboutWindowOpen = FALSE;
+	aboutPicture = NULL;
+	statsWindow = NULL;
+	openBoards = 0;
+	boardsCreated = 0;
+
+	memoryBudget.init();
+	chooseRenderMode();
+	if (!monochromeMode)
+	{
+		themePalette.init();
+	}
 
 	FlushEvents(everyEvent, 0);
 	qd.randSeed = TickCount();
@@ -96,6 +140,19 @@ void initialize()
 	Handle menuBar = GetNewMBar(defaultMenubar);
 	SetMenuBar(menuBar);
 	AppendResMenu(GetMenuHandle(appleMenu), 'DRVR');
+	CheckItem(GetMenuHandle(gameMenu), gameMenuIndexed, Board::indexedOffscreen);
+	CheckItem(GetMenuHandle(gameMenu), gameMenuFirstTheme + themePalette.theme(), TRUE);
+#if !TRACE_ENABLED
+	DisableItem(GetMenuHandle(fileMenu), fileMenuSaveTrace);
+#endif
+	if (monochromeMode)
+	{
+		DisableItem(GetMenuHandle(gameMenu), gameMenuIndexed);
+		for (short i = 0; i < NUM_RENDER_THEMES; i++)
+		{
+			DisableItem(GetMenuHandle(gameMenu), gameMenuFirstTheme + i);
+		}
+	}
 	DrawMenuBar();
 }
 
@@ -104,7 +161,17 @@ void mainLoop()
 	EventRecord event;
 	while (true)
 	{
-		if (WaitNextEvent(everyEvent, &event, 10L, nil))
+		// Don't sleep through animation frames or queued background work
+		long sleep = animator.sleepTicks();
+		if (idleScheduler.sleepTicks() < sleep)
+		{
+			sleep = idleScheduler.sleepTicks();
+		}
+
+		BOOL gotEvent = WaitNextEvent(everyEvent, &event, sleep, nil);
+		ACCOUNT_EVENT(AllocAccounting::eventFor(gotEvent ? event.what : nullEvent));
+
+		if (gotEvent)
 		{
 			if (event.what == mouseDown)
 			{
@@ -117,7 +184,14 @@ void mainLoop()
 				else if (clickedPort == inDrag)
 				{
 					SelectWindow(clickedWindow);
-					DragWindow(clickedWindow, event.where, &qd.screenBits.bounds);
+					// The desktop spans every monitor, so windows can be dragged between them
+					DragWindow(clickedWindow, event.where, &(**GetGrayRgn()).rgnBBox);
+
+					Board* b = (Board*) GetWRefCon((WindowPtr) clickedWindow);
+					if (b != NULL && b->type == BoardWindow)
+					{
+						b->moved();
+					}
 				}
 				else if (clickedPort == inGrow)
 				{
@@ -127,26 +201,36 @@ void mainLoop()
 					r.left = minWidth;
 					r.right = 32767;
 
-					long newSize = GrowWindow(clickedWindow, event.where, &r);
-					printf("inGrow. window %x becomes %lx\n", clickedWindow, newSize);
-
 					Board* b = (Board*) GetWRefCon((WindowPtr) clickedWindow);
 
-					BOOL canResize = b->canCreateGWorld(LoWord(newSize), HiWord(newSize));
+					SetPort(clickedWindow);
+					Rect original = clickedWindow->portRect;
 
-					if (newSize && canResize)
-					{
-						SetPort(clickedWindow);
+					long newSize = liveGrow(clickedWindow, b, event.where, &r);
+					TRACE(TraceGrow, clickedWindow, newSize);
 
-						// could try to resize here or calculate if memory is sufficient
+					// A cancelled drag has nothing to ask the budget about
+					BOOL canResize = newSize && b->canResize(LoWord(newSize), HiWord(newSize));
 
-						SizeWindow(clickedWindow, LoWord(newSize), HiWord(newSize), false);
+					if (canResize)
+					{
+						// The window already has its new size; the board is rebuilt for it now
 						InvalRect(&clickedWindow->portRect);
+						frameTimer.setTrigger(TriggerResize);
 						b->resized();
 					}
 					else
 					{
-						SysBeep(1);
+						if (newSize)
+						{
+							SizeWindow(clickedWindow, original.right - original.left, original.bottom - original.top, false);
+							InvalRect(&clickedWindow->portRect);
+							showMemoryAlert();
+						}
+						else
+						{
+							SysBeep(1);
+						}
 					}
 				}
 				else if (clickedPort == inGoAway) {
@@ -174,15 +258,21 @@ void mainLoop()
 								// Close the About Window on click
 								closeAboutWinow(clickedWindow);
 							}
-
-							// Process the click event
+							else if (b->type == BoardWindow)
+							{
+								Point where = event.where;
+								SetPort(clickedWindow);
+								GlobalToLocal(&where);
+								frameTimer.setTrigger(TriggerKey);
+								b->process_click(where);
+							}
 						}
 					}
 				}
 			}
 			else if (event.what == updateEvt)
 			{
-				printf("Doing an update event!!!!\n");
+				TRACE(TraceUpdate, event.message, 0);
 				BeginUpdate((WindowPtr) event.message);
 				Board* b = (Board*) GetWRefCon((WindowPtr) event.message);
 				if (b == 0)
@@ -191,50 +281,93 @@ void mainLoop()
 				}
 				else if(b->type == BoardWindow)
 				{
-					RgnHandle rgn = NewRgn();
-					//GetWindowRegion((WindowPtr) event.message, kWindowUpdateRgn, rgn);
-					printf("The update region appears to be %x\n", rgn);
+					// BeginUpdate has clipped the visRgn to the update region
 					b->draw();
-					DisposeRgn(rgn);
 				}
 				else if(b->type == ScoreWindow)
 				{
 					Score* s = (Score*)b;
 					s->draw();
 				}
+				else if(b->type == StatsWindow)
+				{
+					((FrameStats*)b)->draw();
+				}
 
 				EndUpdate((WindowPtr) event.message);
 			}
-			else if (event.what == keyDown)
+			else if (event.what == activateEvt)
 			{
-				if(((event.modifiers & cmdKey) != 0))
+				Board* b = (Board*) GetWRefCon((WindowPtr) event.message);
+				if (b != NULL && b->type == BoardWindow)
 				{
-					processKeyMenuEvent(tolower(LoWord(event.message)));
+					b->activate((event.modifiers & activeFlag) != 0);
 				}
-				else
-				{
-					// Standard keyboard input
-					Board* b = (Board*) GetWRefCon((WindowPtr) FrontWindow());
+			}
+			else if (event.what == keyDown || event.what == autoKey)
+			{
+				processKeyEvent(&event);
 
-					if(b != NULL && b->type == BoardWindow)
-					{
-						char ch = LoWord(event.message);
-						ch = toupper(ch);
-						if (isalpha(ch) || ch == '\n' || ch == '\b')
-						{
-							b->process_key(ch);
-							b->draw();
-						}
-					}
+				// Drain typeahead first; the board is only redrawn by the update event that follows
+				while (GetNextEvent(keyDownMask | autoKeyMask, &event))
+				{
+					processKeyEvent(&event);
 				}
 			}
 		}
 
+		animator.step();
+
+		// Background work only gets the time no event wants
+		if (!gotEvent)
+		{
+			idleScheduler.step();
+		}
+
+		if (statsWindow)
+		{
+			((FrameStats*)GetWRefCon(statsWindow))->refresh();
+		}
+
+	}
+}
+
+// Key presses only change board state and invalidate what changed
+void processKeyEvent(EventRecord* event)
+{
+	if(((event->modifiers & cmdKey) != 0))
+	{
+		if (event->what == keyDown)
+		{
+			ACCOUNT_EVENT(AllocMenu);
+			processKeyMenuEvent(tolower(LoWord(event->message)));
+		}
+	}
+	else
+	{
+		// Standard keyboard input, which may follow a command key in the same drain
+		ACCOUNT_EVENT(AllocKey);
+		Board* b = (Board*) GetWRefCon((WindowPtr) FrontWindow());
+
+		if(b != NULL && b->type == BoardWindow)
+		{
+			char ch = LoWord(event->message);
+			ch = toupper(ch);
+			if (isalpha(ch) || ch == '\n' || ch == '\b')
+			{
+				frameTimer.setTrigger(TriggerKey);
+				keyLatency.received(b, event, (ch == '\n') ? EnterKey : LetterKey);
+				b->process_key(ch);
+			}
+		}
 	}
 }
 
 void terminate()
 {
+#if ALLOC_ACCOUNTING
+	allocAccounting.save(ALLOC_FILE_NAME);
+#endif
 	ExitToShell();
 }
 
@@ -245,6 +378,8 @@ void processMouseMenuEvent(long action)
 		return;
 	}
 
+	ACCOUNT_EVENT(AllocMenu);
+
 	short menu = HiWord(action);
 	short item = LoWord(action);
 
@@ -266,7 +401,18 @@ void processMouseMenuEvent(long action)
 	else if (menu == fileMenu)
 	{
 		HiliteMenu(fileMenu);
-		if (item == fileMenuQuit)
+		if (item == fileMenuSaveTrace)
+		{
+			saveTrace();
+		}
+		else if (item == fileMenuSaveLatency)
+		{
+			if (!keyLatency.save(LATENCY_FILE_NAME))
+			{
+				SysBeep(1);
+			}
+		}
+		else if (item == fileMenuQuit)
 		{
 			terminate();
 		}
@@ -292,10 +438,26 @@ void processMouseMenuEvent(long action)
 		{
 			newGame(FrontWindow());
 		}
+		else if (item == gameMenuNewWindow)
+		{
+			beginGame();
+		}
 		else if (item == gameMenuClose)
 		{
 			closeWindow(FrontWindow());
 		}
+		else if (item == gameMenuIndexed)
+		{
+			toggleIndexedOffscreen();
+		}
+		else if (item >= gameMenuFirstTheme && item < gameMenuFirstTheme + NUM_RENDER_THEMES)
+		{
+			chooseTheme((RenderTheme)(item - gameMenuFirstTheme));
+		}
+		else if (item == gameMenuTiming)
+		{
+			toggleFrameTiming();
+		}
 	}
 	HiliteMenu(0);
 }
@@ -319,6 +481,12 @@ void processKeyMenuEvent(char key)
 		newGame(FrontWindow());
 		HiliteMenu(0);
 	}
+	else if (key == 'n')
+	{
+		HiliteMenu(gameMenu);
+		beginGame();
+		HiliteMenu(0);
+	}
 	else if (key == 'w')
 	{
 		WindowPtr window = FrontWindow();
@@ -357,7 +525,6 @@ void newGame(WindowPtr window)
 	}
 
 	board->newGame();
-	board->draw();
 }
 
 void clearEntry(WindowPtr window)
@@ -379,21 +546,33 @@ void clearEntry(WindowPtr window)
 	}
 
 	board->clear();
-	board->draw();
 }
 
 void beginGame()
 {
-	WindowPtr window = GetNewCWindow(mainWindow, nil, (WindowPtr) -1);
+	WindowPtr window = newWindow(mainWindow);
 	DrawGrowIcon(window);
 	Str255 title;
 	c2pstrcpy_cust(title, programName);
 	SetWTitle(window, title);
 
+	// Cascade new windows down from the resource position
+	short offset = (boardsCreated % maxStaggeredWindows) * windowStagger;
+	if (offset != 0)
+	{
+		SetPort(window);
+		Point topLeft = {0, 0};
+		LocalToGlobal(&topLeft);
+		MoveWindow(window, topLeft.h + offset, topLeft.v + offset, FALSE);
+	}
+
 	Board* board = new Board(window);
 	SetWRefCon(window, (long) board);
 	SelectWindow(window);
 
+	openBoards++;
+	boardsCreated++;
+
 	board->draw();
 }
 
@@ -404,14 +583,25 @@ WindowPtr createAboutWindow()
 		return NULL;
 	}
 
-	WindowPtr window = GetNewCWindow(aboutWindow, nil, (WindowPtr) -1);
+	WindowPtr window = newWindow(aboutWindow);
 	SetWRefCon(window, (long) 0);
 
 	aboutWindowOpen = TRUE;
 
+	recordAboutWindow(window);
+	memoryBudget.addConsumer(MemoryPictures, purgeAboutPicture, ownsAboutPicture, &aboutPicture);
+
 	return window;
 }
 
+void recordAboutWindow(WindowPtr window)
+{
+	MemoryHold hold(&aboutPicture);
+	aboutPicture = openWindowPicture(window);
+	drawAboutContent(window);
+	aboutPicture = closeWindowPicture(aboutPicture);
+}
+
 void drawAboutWindow(WindowPtr window)
 {
 	if (!window || !aboutWindowOpen)
@@ -419,80 +609,61 @@ void drawAboutWindow(WindowPtr window)
 		return;
 	}
 
+	MemoryHold hold(&aboutPicture);
 	SetPort(window);
 
-	RGBColor green;
-	green.red = 93 << 8;
-	green.green = 170 << 8;
-	green.blue = 107 << 8;
-
-	PixPatHandle greenPixPat = NewPixPat();
-	MakeRGBPat(greenPixPat, &green);
-
-	Rect r = window->portRect;
-
-	FillCRect(&r, greenPixPat);
-
-	RGBColor white;
-	white.red = 255 << 8;
-	white.green = 255 << 8;
-	white.blue = 255 << 8;
-
-	RGBForeColor(&white);
-
-	short fontSize = 18;
-	PenState oldState;
-	GetPenState(&oldState);
-
-	Style s = {0};
-	Str255 fontName;
-
-	short fontFamily = 0;
-	c2pstrcpy_cust(fontName, "geneva");
-	GetFNum(fontName, &fontFamily);
-
-	TextFont(fontFamily);
-	TextSize(fontSize);
-
-	PenState ps = {0};
-	ps.pnLoc.v = window->portRect.top + 20;
-	ps.pnLoc.h = window->portRect.left + 5;
-	ps.pnSize.v = 1;
-	ps.pnSize.h = 1;
-
-	SetPenState(&ps);
-
-	Str255 writeString;
-	c2pstrcpy_cust(writeString, programName);
-
-	DrawString(writeString);
-
-	c2pstrcpy_cust(writeString, " v1.2.0");
+	if (aboutPicture)
+	{
+		DrawPicture(aboutPicture, &window->portRect);
+	}
+	else
+	{
+		drawAboutContent(window);
+	}
+}
 
-	DrawString(writeString);
+Size purgeAboutPicture(void* picture)
+{
+	PicHandle* about = (PicHandle*)picture;
+	if (*about == NULL)
+	{
+		return 0;
+	}
 
-	fontSize = 14;
-	TextSize(fontSize);
+	Size freed = GetHandleSize((Handle)*about);
+	disposeWindowPicture(*about);
+	*about = NULL;
+	return freed;
+}
 
-	ps.pnLoc.v = ((window->portRect.bottom - window->portRect.top) / 2) + window->portRect.top;
-	ps.pnLoc.h = window->portRect.left + 5;
+// Compared with the PicHandle, which is what grows while the picture is recorded
+BOOL ownsAboutPicture(void* picture, Handle h)
+{
+	return (Handle)*(PicHandle*)picture == h;
+}
 
-	SetPenState(&ps);
+void drawAboutContent(WindowPtr window)
+{
+	SetPort(window);
+	Renderer* renderer = windowRenderer();
 
-	c2pstrcpy_cust(writeString, "Copyright 2024 Trevor Gale");
+	Rect r = window->portRect;
 
-	DrawString(writeString);
+	renderer->fillRect(&r, RenderGreen);
 
-	c2pstrcpy_cust(writeString, "under the GNU GPL");
+	short h = window->portRect.left + 5;
 
-	ps.pnLoc.v += 16;
-	ps.pnLoc.h = window->portRect.left + 5;
+	char title[64];
+	sprintf(title, "%s v1.2.0", programName);
 
-	SetPenState(&ps);
+	renderer->setFont(LabelFont, 18);
+	renderer->drawText(h, window->portRect.top + 20, title, RenderWhite);
 
-	DrawString(writeString);
+	short v = ((window->portRect.bottom - window->portRect.top) / 2) + window->portRect.top;
 
-	DisposePixPat(greenPixPat);
+	renderer->setFont(LabelFont, 14);
+	renderer->drawText(h, v, "Copyright 2024 Trevor Gale", RenderWhite);
+	renderer->drawText(h, v + 16, "under the GNU GPL", RenderWhite);
 }
 
 void closeAboutWinow(WindowPtr window)
@@ -502,6 +673,10 @@ void closeAboutWinow(WindowPtr window)
 		return;
 	}
 
+	memoryBudget.removeConsumer(&aboutPicture);
+	disposeWindowPicture(aboutPicture);
+	aboutPicture = NULL;
+
 	DisposeWindow(window);
 	aboutWindowOpen = FALSE;
 }
@@ -517,7 +692,16 @@ void closeWindow(WindowPtr window)
 
 	if (window && board && ((Board*)board)->type == BoardWindow)
 	{
-		terminate();
+		// Closing the last game window quits
+		if (openBoards <= 1)
+		{
+			terminate();
+		}
+
+		Board* b = (Board*) board;
+		delete b;
+		DisposeWindow(window);
+		openBoards--;
 	}
 	else if (window && board && ((Score*)board)->type == ScoreWindow)
 	{
@@ -525,8 +709,154 @@ void closeWindow(WindowPtr window)
 		delete s;
 		DisposeWindow(window);
 	}
+	else if (window && board && ((FrameStats*)board)->type == StatsWindow)
+	{
+		toggleFrameTiming();
+	}
 	else if (window)
 	{
 		closeAboutWinow(window);
 	}
-}
\ No newline at end of file
+}
+
+// Like GrowWindow, but the window follows the mouse and the board stretches its last frame to
+// fit. Returns the new size in the same form, or 0 if it didn't change.
+long liveGrow(WindowPtr window, Board* board, Point start, const Rect* limits)
+{
+	SetPort(window);
+
+	short startWidth = window->portRect.right - window->portRect.left;
+	short startHeight = window->portRect.bottom - window->portRect.top;
+	short width = startWidth;
+	short height = startHeight;
+
+	while (StillDown())
+	{
+		Point mouse;
+		GetMouse(&mouse);
+		LocalToGlobal(&mouse);
+
+		long newWidth = (long)startWidth + mouse.h - start.h;
+		long newHeight = (long)startHeight + mouse.v - start.v;
+
+		newWidth = (newWidth < limits->left) ? limits->left : (newWidth > limits->right) ? limits->right : newWidth;
+		newHeight = (newHeight < limits->top) ? limits->top : (newHeight > limits->bottom) ? limits->bottom : newHeight;
+
+		if (newWidth != width || newHeight != height)
+		{
+			width = (short)newWidth;
+			height = (short)newHeight;
+			SizeWindow(window, width, height, false);
+			board->drawResizePreview();
+		}
+	}
+
+	if (width == startWidth && height == startHeight)
+	{
+		return 0;
+	}
+
+	return ((long)height << 16) | (unsigned short)width;
+}
+
+// Board frames are only timed while the window showing the numbers is open
+void toggleFrameTiming()
+{
+	if (statsWindow)
+	{
+		delete (FrameStats*)GetWRefCon(statsWindow);
+		DisposeWindow(statsWindow);
+		statsWindow = NULL;
+		frameTimer.setEnabled(FALSE);
+	}
+	else
+	{
+		statsWindow = newWindow(scoreWindow);
+		Str255 title;
+		c2pstrcpy_cust(title, "Frame Timing");
+		SetWTitle(statsWindow, title);
+		SetWRefCon(statsWindow, (long)new FrameStats(statsWindow));
+		frameTimer.setEnabled(TRUE);
+	}
+
+	CheckItem(GetMenuHandle(gameMenu), gameMenuTiming, statsWindow != NULL);
+}
+
+// The window has already been put back to its old size
+void showMemoryAlert()
+{
+	CautionAlert(memoryAlert, nil);
+}
+
+// Written next to the application for host/tracedecode to read
+void saveTrace()
+{
+#if TRACE_ENABLED
+	if (!traceDump(TRACE_FILE_NAME))
+	{
+		SysBeep(1);
+	}
+#endif
+}
+
+// Switch every board between indexed and screen-depth offscreen worlds
+void toggleIndexedOffscreen()
+{
+	Board::indexedOffscreen = !Board::indexedOffscreen;
+	CheckItem(GetMenuHandle(gameMenu), gameMenuIndexed, Board::indexedOffscreen);
+
+	for (WindowPtr w = FrontWindow(); w != NULL; w = (WindowPtr)((WindowPeek)w)->nextWindow)
+	{
+		// Desk accessory windows have negative kinds and someone else's refCon
+		if (((WindowPeek)w)->windowKind < 0)
+		{
+			continue;
+		}
+
+		Board* board = (Board*)GetWRefCon(w);
+		if (board && board->type == BoardWindow)
+		{
+			board->depthChanged();
+		}
+	}
+}
+
+// Refills the shared patterns, then drops only what was drawn or recorded in the old colours
+void chooseTheme(RenderTheme theme)
+{
+	if (theme == themePalette.theme())
+	{
+		return;
+	}
+
+	CheckItem(GetMenuHandle(gameMenu), gameMenuFirstTheme + themePalette.theme(), FALSE);
+	themePalette.setTheme(theme);
+	CheckItem(GetMenuHandle(gameMenu), gameMenuFirstTheme + theme, TRUE);
+
+	Board::releaseColorTable();
+
+	for (WindowPtr w = FrontWindow(); w != NULL; w = (WindowPtr)((WindowPeek)w)->nextWindow)
+	{
+		// Desk accessory windows have negative kinds and someone else's refCon
+		if (((WindowPeek)w)->windowKind < 0)
+		{
+			continue;
+		}
+
+		Board* board = (Board*)GetWRefCon(w);
+		if (board == NULL)
+		{
+			disposeWindowPicture(aboutPicture);
+			recordAboutWindow(w);
+			InvalRect(&w->portRect);
+		}
+		else if (board->type == BoardWindow)
+		{
+			board->themeChanged();
+		}
+		else if (board->type == ScoreWindow)
+		{
+			((Score*)board)->themeChanged();
+		}
+	}
+}
@@ -21,8 +21,24 @@
 
 #include "board.hh"
 #include "windows.hh"
+#include "timing.hh"
+#include "idle.hh"
+#include "alloc.hh"
 
-Score::Score(WindowPtr w, BOOL win, char rounds, char* correctWord)
+#define ANALYSIS_ROW_HEIGHT (13)
+#define ANALYSIS_FONT_SIZE (9)
+
+// Ticks between redraws of the timing window, so watching doesn't swamp what is measured
+#define STATS_REFRESH_TICKS (30)
+
+static const short statsColumns[] = {8, 78, 128, 178, 228};
+static const char* statsHeadings[] = {"Phase (us)", "Last", "Min", "Avg", "P95"};
+static const char* latencyHeadings[] = {"Latency (ms)", "Count", "Avg", "Max", "P95"};
+
+static const short analysisColumns[] = {8, 22, 66, 106, 142, 180, 218};
+static const char* analysisHeadings[] = {"#", "Guess", "Before", "After", "Bits", "Exp", "Best"};
+
+Score::Score(WindowPtr w, BOOL win, char rounds, char* correctWord, const GameAnalysis* gameAnalysis)
 {
 	type = ScoreWindow;
 	window = w;
@@ -30,27 +46,82 @@ Score::Score(WindowPtr w, BOOL win, char rounds, char* correctWord)
 	numRounds = rounds;
 	strcpy(word, correctWord);
 	word[WORD_LENGTH] = '\0';
+	numAnalysisRows = 0;
+	if (gameAnalysis)
+	{
+		numAnalysisRows = gameAnalysis->numRows;
+		memcpy(analysisRows, gameAnalysis->rows, sizeof(analysisRows));
+	}
+
+	record();
+	memoryBudget.addConsumer(MemoryPictures, purgePicture, ownsPicture, this);
 }
 
-void Score::draw()
+Score::~Score()
 {
-	SetPort(window);
-	EraseRect(&window->portRect);
+	memoryBudget.removeConsumer(this);
+	disposeWindowPicture(picture);
+}
 
-	// Scope for grey color
+// Without its picture the window just draws its content on each update
+Size Score::purgePicture(void* score)
+{
+	Score* s = (Score*)score;
+	if (s->picture == NULL)
 	{
-		RGBColor macGrey;
-		macGrey.red = 204 << 8;
-		macGrey.green = 204 << 8;
-		macGrey.blue = 204 << 8;
+		return 0;
+	}
+
+	Size freed = GetHandleSize((Handle)s->picture);
+	disposeWindowPicture(s->picture);
+	s->picture = NULL;
+	return freed;
+}
 
-		PixPatHandle macGreyPixPat = NewPixPat();
-		MakeRGBPat(macGreyPixPat, &macGrey);
+// A picture being recorded grows in its PicHandle itself
+BOOL Score::ownsPicture(void* score, Handle h)
+{
+	return (Handle)((Score*)score)->picture == h;
+}
 
-		FillCRect(&window->portRect, macGreyPixPat);
+void Score::record()
+{
+	MemoryHold hold(this);
+	picture = openWindowPicture(window);
+	drawContent();
+	picture = closeWindowPicture(picture);
+}
 
-		DisposePixPat(macGreyPixPat);
+// The picture holds the old theme's colours
+void Score::themeChanged()
+{
+	disposeWindowPicture(picture);
+	record();
+	InvalRect(&window->portRect);
+}
+
+// Updates replay the recorded picture, clipped to the update region by the visRgn
+void Score::draw()
+{
+	MemoryHold hold(this);
+	SetPort(window);
+
+	if (picture)
+	{
+		DrawPicture(picture, &window->portRect);
 	}
+	else
+	{
+		drawContent();
+	}
+}
+
+void Score::drawContent()
+{
+	SetPort(window);
+	Renderer* renderer = windowRenderer();
+
+	renderer->fillRect(&window->portRect, RenderMacGrey);
 
 	int squareSize = 32;
 	int bufferSpace = 8;
@@ -61,88 +132,255 @@ void Score::draw()
 	topRightSquare.top = window->portRect.top + bufferSpace;
 	topRightSquare.bottom = topRightSquare.top + squareSize;
 
-	if (didWin)
-	{
-		RGBColor green;
-		green.red = 93 << 8;
-		green.green = 170 << 8;
-		green.blue = 107 << 8;
+	renderer->fillRect(&topRightSquare, didWin ? RenderGreen : RenderGrey);
+
+	short winLoseFS = 24;
+	short h = window->portRect.left + 8;
+	short v = window->portRect.top + 35;
+
+	renderer->setFont(LabelFont, winLoseFS);
+	renderer->drawText(h, v, didWin ? "You Won!" : "You Lost :(", RenderBlack);
+
+	v += 35;
 
-		PixPatHandle greenPixPat = NewPixPat();
-		MakeRGBPat(greenPixPat, &green);
+	char recordString[255];
+	sprintf(recordString, "Guesses: %d/%d", numRounds, NUM_OF_GUESSES);
+	renderer->drawText(h, v, recordString, RenderBlack);
 
-		FillCRect(&topRightSquare, greenPixPat);
+	v += 35;
 
-		DisposePixPat(greenPixPat);
+	renderer->setFont(LabelFont, 14);
+
+	char correctWordString[255];
+	sprintf(correctWordString, "The word was %s", word);
+	renderer->drawText(h, v, correctWordString, RenderBlack);
+
+	drawAnalysis(renderer, v + 25);
+}
+
+// Draws one row per guess: candidates left, bits gained and the best guess available at that point
+void Score::drawAnalysis(Renderer* renderer, short top)
+{
+	renderer->setFont(LabelFont, ANALYSIS_FONT_SIZE);
+
+	char cell[32];
+	short v = top;
+	short left = window->portRect.left;
+	int col;
+
+	for (col = 0; col < (sizeof(analysisColumns) / sizeof(analysisColumns[0])); col++)
+	{
+		renderer->drawText(left + analysisColumns[col], v, analysisHeadings[col], RenderBlack);
 	}
-	else
+
+	renderer->drawLine(left + analysisColumns[0], v + 3, window->portRect.right - 8, v + 3, RenderBlack);
+
+	for (int i = 0; i < numAnalysisRows; i++)
 	{
-		RGBColor grey;
-		grey.red = 119 << 8;
-		grey.green = 124 << 8;
-		grey.blue = 126 << 8;
+		GuessAnalysis* row = &analysisRows[i];
+		v += ANALYSIS_ROW_HEIGHT;
+
+		for (col = 0; col < (sizeof(analysisColumns) / sizeof(analysisColumns[0])); col++)
+		{
+			switch (col)
+			{
+				case 0:
+					sprintf(cell, "%d", i + 1);
+					break;
+				case 1:
+					sprintf(cell, "%s", row->guess);
+					break;
+				case 2:
+					sprintf(cell, "%d", row->candidatesBefore);
+					break;
+				case 3:
+					sprintf(cell, "%d", row->candidatesAfter);
+					break;
+				case 4:
+					sprintf(cell, "%d.%02d", row->bitsGained / 100, row->bitsGained % 100);
+					break;
+				case 5:
+					sprintf(cell, "%d.%02d", row->expectedBits / 100, row->expectedBits % 100);
+					break;
+				default:
+					sprintf(cell, "%s %d.%02d", row->bestGuess, row->bestBits / 100, row->bestBits % 100);
+					break;
+			}
+
+			renderer->drawText(left + analysisColumns[col], v, cell, RenderBlack);
+		}
+	}
+}
 
-		PixPatHandle greyPixPat = NewPixPat();
-		MakeRGBPat(greyPixPat, &grey);
+FrameStats::FrameStats(WindowPtr w)
+{
+	type = StatsWindow;
+	window = w;
+	shownFrames = 0;
+	shownSamples = 0;
+	shownIdleTasks = 0;
+	shownTicks = 0;
+}
 
-		FillCRect(&topRightSquare, greyPixPat);
+void FrameStats::draw()
+{
+	SetPort(window);
+	Renderer* renderer = windowRenderer();
+
+	renderer->fillRect(&window->portRect, RenderMacGrey);
+	renderer->setFont(LabelFont, ANALYSIS_FONT_SIZE);
 
-		DisposePixPat(greyPixPat);
+	// Holds the longest status line with every count at its widest
+	char cell[64];
+	short left = window->portRect.left;
+	short v = window->portRect.top + 16;
+	int col;
+
+	for (col = 0; col < (sizeof(statsColumns) / sizeof(statsColumns[0])); col++)
+	{
+		renderer->drawText(left + statsColumns[col], v, statsHeadings[col], RenderBlack);
 	}
 
-	short winLoseFS = 24;
-	PenState oldState;
-	GetPenState(&oldState);
+	renderer->drawLine(left + statsColumns[0], v + 3, window->portRect.right - 8, v + 3, RenderBlack);
 
-	Style s = {0};
-	Str255 fontName;
+	for (int phase = 0; phase <= PHASE_TOTAL; phase++)
+	{
+		PhaseStats stats;
+		frameTimer.stats(phase, &stats);
+		unsigned long values[] = {stats.last, stats.min, stats.avg, stats.p95};
+
+		v += ANALYSIS_ROW_HEIGHT;
+		renderer->drawText(left + statsColumns[0], v, framePhaseNames[phase], RenderBlack);
+
+		for (col = 1; col < (sizeof(statsColumns) / sizeof(statsColumns[0])); col++)
+		{
+			sprintf(cell, "%lu", values[col - 1]);
+			renderer->drawText(left + statsColumns[col], v, cell, RenderBlack);
+		}
+	}
 
-	short fontFamily = 0;
-	c2pstrcpy_cust(fontName, "geneva");
-	GetFNum(fontName, &fontFamily);
+	v += ANALYSIS_ROW_HEIGHT;
+	renderer->drawText(left + statsColumns[0], v, "Frames by", RenderBlack);
 
-	TextFont(fontFamily);
-	TextSize(winLoseFS);
+	for (int trigger = 0; trigger < NUM_FRAME_TRIGGERS; trigger++)
+	{
+		sprintf(cell, "%s %lu", frameTriggerNames[trigger], frameTimer.triggerCount((FrameTrigger)trigger));
+		renderer->drawText(left + statsColumns[trigger + 1], v, cell, RenderBlack);
+	}
 
-	PenState ps = {0};
+	v += ANALYSIS_ROW_HEIGHT;
+	sprintf(cell, "Memory %ldK of %ldK, %lu purges", memoryBudget.totalUsage() / 1024,
+			memoryBudget.budgetSize() / 1024, memoryBudget.purgeCount());
+	renderer->drawText(left + statsColumns[0], v, cell, RenderBlack);
 
-	ps.pnLoc.v = window->portRect.top + 35;
-	ps.pnLoc.h = window->portRect.left + 8;
-	ps.pnSize.v = 1;
-	ps.pnSize.h = 1;
+	v += ANALYSIS_ROW_HEIGHT;
+	sprintf(cell, "Idle tasks %d queued, %lu done, %lu ms", idleScheduler.taskCount(),
+			idleScheduler.finishedCount(), idleScheduler.busyMicros() / 1000);
+	renderer->drawText(left + statsColumns[0], v, cell, RenderBlack);
 
-	SetPenState(&ps);
+	// Analyses and other tasks that ran to completion, which the total above also counts
+	v += ANALYSIS_ROW_HEIGHT;
+	sprintf(cell, "Finished tasks %lu calls, %lu ms", idleScheduler.finishedCalls(),
+			idleScheduler.finishedMicros() / 1000);
+	renderer->drawText(left + statsColumns[0], v, cell, RenderBlack);
 
-	Str255 str;
+#if ALLOC_ACCOUNTING
+	v += ANALYSIS_ROW_HEIGHT;
+	sprintf(cell, "Steady-state allocations %lu", allocAccounting.steadyCount());
+	renderer->drawText(left + statsColumns[0], v, cell, RenderBlack);
+#endif
 
-	if (didWin)
+	v += 2 * ANALYSIS_ROW_HEIGHT;
+
+	for (col = 0; col < (sizeof(statsColumns) / sizeof(statsColumns[0])); col++)
 	{
-		c2pstrcpy_cust(str, "You Won!");
+		renderer->drawText(left + statsColumns[col], v, latencyHeadings[col], RenderBlack);
 	}
-	else
+
+	renderer->drawLine(left + statsColumns[0], v + 3, window->portRect.right - 8, v + 3, RenderBlack);
+
+	for (int kind = 0; kind < NUM_KEY_KINDS; kind++)
 	{
-		c2pstrcpy_cust(str, "You Lost :(");
+		const LatencyHistogram* histogram = keyLatency.histogram((KeyKind)kind);
+		unsigned long average = histogram->samples ? histogram->totalMs / histogram->samples : 0;
+		unsigned long values[] = {histogram->samples, average, histogram->maxMs, keyLatency.percentile((KeyKind)kind, 95)};
+
+		v += ANALYSIS_ROW_HEIGHT;
+		renderer->drawText(left + statsColumns[0], v, keyKindNames[kind], RenderBlack);
+
+		for (col = 1; col < (sizeof(statsColumns) / sizeof(statsColumns[0])); col++)
+		{
+			sprintf(cell, "%lu", values[col - 1]);
+			renderer->drawText(left + statsColumns[col], v, cell, RenderBlack);
+		}
 	}
 
-	DrawString(str);
+	shownFrames = frameTimer.frameCount();
+	shownSamples = keyLatency.sampleCount();
+	shownIdleTasks = idleScheduler.finishedCount();
+	shownTicks = TickCount();
+}
 
-	ps.pnLoc.v += 35;
-	SetPenState(&ps);
+// Called every pass of the event loop
+void FrameStats::refresh()
+{
+	BOOL changed = frameTimer.frameCount() != shownFrames || keyLatency.sampleCount() != shownSamples ||
+		idleScheduler.finishedCount() != shownIdleTasks;
 
-	char recordString[255];
-	sprintf(recordString, "Guesses: %d/%d", numRounds, NUM_OF_GUESSES);
-	c2pstrcpy_cust(str, recordString);
-	DrawString(str);
+	if (!changed || TickCount() - shownTicks < STATS_REFRESH_TICKS)
+	{
+		return;
+	}
 
-	ps.pnLoc.v += 35;
-	SetPenState(&ps);
+	GrafPtr origPort;
+	GetPort(&origPort);
+	SetPort(window);
+	InvalRect(&window->portRect);
+	SetPort(origPort);
 
-	TextSize(14);
+	// Not redrawn again until the update has been handled
+	shownTicks = TickCount();
+}
 
-	char correctWordString[255];
-	sprintf(correctWordString, "The word was %s", word);
-	c2pstrcpy_cust(str, correctWordString);
-	DrawString(str);
+PicHandle openWindowPicture(WindowPtr window)
+{
+	SetPort(window);
+
+	// A wide-open clip region would be recorded as is and can't be drawn back
+	ClipRect(&window->portRect);
+
+	return OpenPicture(&window->portRect);
+}
+
+// Returns NULL if recording ran out of memory or the budget can't cover it, so the caller
+// falls back to drawing directly
+PicHandle closeWindowPicture(PicHandle picture)
+{
+	ClosePicture();
+
+	if (picture == NULL)
+	{
+		return NULL;
+	}
+
+	Size size = GetHandleSize((Handle)picture);
+
+	if (size <= sizeof(Picture) || !memoryBudget.canAllocate(0, size))
+	{
+		KillPicture(picture);
+		return NULL;
+	}
+
+	memoryBudget.allocated(MemoryPictures, size);
 
-	SetPenState(&oldState);
-}
\ No newline at end of file
+	return picture;
+}
+
+void disposeWindowPicture(PicHandle picture)
+{
+	if (picture)
+	{
+		memoryBudget.released(MemoryPictures, GetHandleSize((Handle)picture));
+		KillPicture(picture);
+	}
+}
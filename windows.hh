@@ -21,6 +21,8 @@
 #include <MacWindows.h>
 
 #include "engine.hh"
+#include "analysis.hh"
+#include "renderer.hh"
  
 static const short mainWindow = 128;
 static const short aboutWindow = 129;
@@ -29,7 +31,8 @@ static const short scoreWindow = 130;
 enum WindowType
 {
 	BoardWindow,
-	ScoreWindow
+	ScoreWindow,
+	StatsWindow
 };
 
 class Score
@@ -37,14 +40,48 @@ class Score
 	public:
 	WindowType type;
 
-	Score(WindowPtr w, BOOL win, char rounds, char* correctWord);
+	Score(WindowPtr w, BOOL win, char rounds, char* correctWord, const GameAnalysis* gameAnalysis);
+	~Score();
 	void draw();
+	void themeChanged();
+	static Size purgePicture(void* score);
+	static BOOL ownsPicture(void* score, Handle h);
 
 	private:
+	void record();
+	void drawContent();
+	void drawAnalysis(Renderer* renderer, short top);
+
 	WindowPtr window;
 	BOOL didWin;
 	char numRounds;
 	char word[WORD_LENGTH + 1];
+	int numAnalysisRows;
+	GuessAnalysis analysisRows[NUM_OF_GUESSES];
+	PicHandle picture;
+};
+
+// Frame timing from frameTimer, redrawn as new frames are timed
+class FrameStats
+{
+	public:
+	WindowType type;
+
+	FrameStats(WindowPtr w);
+	void draw();
+	void refresh();
+
+	private:
+	WindowPtr window;
+	unsigned long shownFrames;
+	unsigned long shownSamples;
+	unsigned long shownIdleTasks;
+	unsigned long shownTicks;
 };
 
+// Static windows record their content once and replay it on every update
+PicHandle openWindowPicture(WindowPtr window);
+PicHandle closeWindowPicture(PicHandle picture);
+void disposeWindowPicture(PicHandle picture);
+
 #endif /* WINDOWS_HH */
\ No newline at end of file